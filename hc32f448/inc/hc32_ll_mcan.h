@@ -19,6 +19,7 @@
                                     6. Changed u8Activity of stc_mcan_protocol_status_t to u8ComState.
                                     7. Changed MCAN_Comm_State to MCAN_Com_State and optimized the macros definitions.
                                     8. Changed u8MsgStorageIndex of stc_mcan_hpm_status_t to u8MsgIndex. Optimized MCAN_HPM_Storage macros definitions.
+   2026-10-19       CDT             Added message RAM planner and zero-copy Rx element APIs
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2022-2023, Xiaohua Semiconductor Co., Ltd. All rights reserved.
@@ -349,6 +350,51 @@ typedef struct {
     uint32_t u32DataSize;               /*!< Size of Rx data payload */
 } stc_mcan_rx_msg_t;
 
+/**
+ * @brief MCAN Rx element structure definition
+ * @note  The payload stays in the message RAM, the element must be acknowledged by
+ *        @ref MCAN_AckRxElement() after the payload has been consumed.
+ */
+typedef struct {
+    uint32_t ID;                        /*!< Specifies the ID. See ID of @ref stc_mcan_rx_msg_t */
+    uint32_t IDE;                       /*!< IDentifier Extension bit. See IDE of @ref stc_mcan_rx_msg_t */
+    uint32_t RTR;                       /*!< Remote Transmission Request. See RTR of @ref stc_mcan_rx_msg_t */
+    uint32_t DLC;                       /*!< Data Length Code. This parameter can be a value of @ref MCAN_Data_Length_Code */
+    uint32_t ESI;                       /*!< Error State Indicator. See ESI of @ref stc_mcan_rx_msg_t */
+    uint32_t BRS;                       /*!< Bit Rate Switch. See BRS of @ref stc_mcan_rx_msg_t */
+    uint32_t FDF;                       /*!< FD Format indicator. See FDF of @ref stc_mcan_rx_msg_t */
+    uint32_t u32RxTimestamp;            /*!< Timestamp counter value captured on start of frame reception. */
+    uint32_t u32FilterIndex;            /*!< Index of matching Rx acceptance filter element. */
+    uint32_t u32NmfFlag;                /*!< Non-matching frame flag. See u32NmfFlag of @ref stc_mcan_rx_msg_t */
+    __I uint32_t *pu32Data;             /*!< Data payload in the message RAM, to be read in words.
+                                             Byte n of the payload is bits [8*(n%4)+7:8*(n%4)] of word n/4. */
+    uint32_t u32DataSize;               /*!< Size of Rx data payload */
+    uint32_t u32RxLocation;             /*!< Location of the element, a value of @ref MCAN_Rx_Location. Used by MCAN_AckRxElement(). */
+    uint32_t u32RxIndex;                /*!< FIFO get index of the element. Used by MCAN_AckRxElement(). */
+} stc_mcan_rx_element_t;
+
+/**
+ * @brief MCAN message RAM plan structure definition
+ * @note  Describes the workload of one MCAN unit, @ref MCAN_MsgRamPlan() derives the
+ *        message RAM layout from it.
+ */
+typedef struct {
+    uint32_t u32AddrOffset;             /*!< Message RAM start offset of the MCAN unit, must be 4-byte aligned. */
+    uint32_t u32RamSize;                /*!< Message RAM size in bytes available to the MCAN unit from u32AddrOffset.
+                                             0 means up to the end of the message RAM. */
+    uint32_t u32StdIdNum;               /*!< Number of standard IDs to be filtered, one filter element each. 0 ~ 128 */
+    uint32_t u32ExtIdNum;               /*!< Number of extended IDs to be filtered, one filter element each. 0 ~ 64 */
+    uint32_t u32RxPayload;              /*!< Largest payload to be received in bytes. 0 ~ 64 */
+    uint32_t u32RxFifo0Burst;           /*!< Frames that may arrive into Rx FIFO0 before it is served. 0 ~ 64 */
+    uint32_t u32RxFifo1Burst;           /*!< Frames that may arrive into Rx FIFO1 before it is served. 0 ~ 64 */
+    uint32_t u32RxBufferNum;            /*!< Number of dedicated Rx buffers. 0 ~ 64 */
+    uint32_t u32TxPayload;              /*!< Largest payload to be transmitted in bytes. 0 ~ 64 */
+    uint32_t u32TxBufferNum;            /*!< Number of dedicated Tx buffers. */
+    uint32_t u32TxFifoQueueNum;         /*!< Number of Tx FIFO/queue elements.
+                                             The sum of u32TxBufferNum and u32TxFifoQueueNum must be a number between 0 and 32 */
+    uint32_t u32TxEventNum;             /*!< Number of Tx event FIFO elements. 0 ~ 32 */
+} stc_mcan_msg_ram_plan_t;
+
 /**
  * @brief MCAN Tx event structure definition
  */
@@ -1033,6 +1079,8 @@ void MCAN_Start(CM_MCAN_TypeDef *MCANx);
 int32_t MCAN_Stop(CM_MCAN_TypeDef *MCANx);
 int32_t MCAN_EnterSleepMode(CM_MCAN_TypeDef *MCANx);
 int32_t MCAN_ExitSleepMode(CM_MCAN_TypeDef *MCANx);
+int32_t MCAN_MsgRamPlan(const stc_mcan_msg_ram_plan_t *pstcPlan, stc_mcan_msg_ram_config_t *pstcMsgRam,
+                        int32_t *pi32Headroom);
 int32_t MCAN_GetMsgRamAddr(const CM_MCAN_TypeDef *MCANx, stc_mcan_msg_ram_addr_t *pstcAddr);
 
 /* Configuration functions ****************************************************/
@@ -1065,6 +1113,8 @@ int32_t MCAN_AddMsgToTxBuffer(CM_MCAN_TypeDef *MCANx, stc_mcan_tx_msg_t *pTxMsg)
 void MCAN_EnableTxBufferRequest(CM_MCAN_TypeDef *MCANx, uint32_t u32TxBuffer);
 void MCAN_AbortTxRequest(CM_MCAN_TypeDef *MCANx, uint32_t u32TxBuffer);
 int32_t MCAN_GetRxMsg(CM_MCAN_TypeDef *MCANx, uint32_t u32RxLocation, stc_mcan_rx_msg_t *pRxMsg);
+int32_t MCAN_GetRxElement(const CM_MCAN_TypeDef *MCANx, uint32_t u32RxLocation, stc_mcan_rx_element_t *pRxElmt);
+int32_t MCAN_AckRxElement(CM_MCAN_TypeDef *MCANx, const stc_mcan_rx_element_t *pRxElmt);
 int32_t MCAN_GetTxEvent(CM_MCAN_TypeDef *MCANx, stc_mcan_tx_event_t *pTxEvent);
 int32_t MCAN_GetHighPriorityMsgStatus(const CM_MCAN_TypeDef *MCANx, stc_mcan_hpm_status_t *pHpmStatus);
 
@@ -116,6 +116,10 @@ extern "C"
 #include "hc32_ll_adc.h"
 #endif /* LL_ADC_ENABLE */
 
+#if (LL_ADC_ACQ_ENABLE == DDL_ON)
+#include "hc32_ll_adc_acq.h"
+#endif /* LL_ADC_ACQ_ENABLE */
+
 #if (LL_AES_ENABLE == DDL_ON)
 #include "hc32_ll_aes.h"
 #endif /* LL_AES_ENABLE */
@@ -132,6 +136,10 @@ extern "C"
 #include "hc32_ll_clk.h"
 #endif /* LL_CLK_ENABLE */
 
+#if (LL_CLK_SOLVE_ENABLE == DDL_ON)
+#include "hc32_ll_clk_solve.h"
+#endif /* LL_CLK_SOLVE_ENABLE */
+
 #if (LL_CMP_ENABLE == DDL_ON)
 #include "hc32_ll_cmp.h"
 #endif /* LL_CMP_ENABLE */
@@ -152,10 +160,18 @@ extern "C"
 #include "hc32_ll_dbgc.h"
 #endif /* LL_DBGC_ENABLE */
 
+#if (LL_DAC_WAVE_ENABLE == DDL_ON)
+#include "hc32_ll_dac_wave.h"
+#endif /* LL_DAC_WAVE_ENABLE */
+
 #if (LL_DCU_ENABLE == DDL_ON)
 #include "hc32_ll_dcu.h"
 #endif /* LL_DCU_ENABLE */
 
+#if (LL_DCU_BATCH_ENABLE == DDL_ON)
+#include "hc32_ll_dcu_batch.h"
+#endif /* LL_DCU_BATCH_ENABLE */
+
 #if (LL_DMA_ENABLE == DDL_ON)
 #include "hc32_ll_dma.h"
 #endif /* LL_DMA_ENABLE */
@@ -164,10 +180,22 @@ extern "C"
 #include "hc32_ll_dmc.h"
 #endif /* LL_DMC_ENABLE */
 
+#if (LL_DMC_MEM_ENABLE == DDL_ON)
+#include "hc32_ll_dmc_mem.h"
+#endif /* LL_DMC_MEM_ENABLE */
+
+#if (LL_DVFS_ENABLE == DDL_ON)
+#include "hc32_ll_dvfs.h"
+#endif /* LL_DVFS_ENABLE */
+
 #if (LL_DVP_ENABLE == DDL_ON)
 #include "hc32_ll_dvp.h"
 #endif /* LL_DVP_ENABLE */
 
+#if (LL_DVP_FRAME_ENABLE == DDL_ON)
+#include "hc32_ll_dvp_frame.h"
+#endif /* LL_DVP_FRAME_ENABLE */
+
 #if (LL_EFM_ENABLE == DDL_ON)
 #include "hc32_ll_efm.h"
 #endif /* LL_EFM_ENABLE */
@@ -196,6 +224,10 @@ extern "C"
 #include "hc32_ll_fmac.h"
 #endif /* LL_FMAC_ENABLE */
 
+#if (LL_FMAC_BLOCK_ENABLE == DDL_ON)
+#include "hc32_ll_fmac_block.h"
+#endif /* LL_FMAC_BLOCK_ENABLE */
+
 #if (LL_GPIO_ENABLE == DDL_ON)
 #include "hc32_ll_gpio.h"
 #endif /* LL_GPIO_ENABLE */
@@ -208,14 +240,26 @@ extern "C"
 #include "hc32_ll_hrpwm.h"
 #endif /* LL_HRPWM_ENABLE */
 
+#if (LL_HRPWM_DUTY_ENABLE == DDL_ON)
+#include "hc32_ll_hrpwm_duty.h"
+#endif /* LL_HRPWM_DUTY_ENABLE */
+
 #if (LL_I2C_ENABLE == DDL_ON)
 #include "hc32_ll_i2c.h"
 #endif /* LL_I2C_ENABLE */
 
+#if (LL_I2C_XFER_ENABLE == DDL_ON)
+#include "hc32_ll_i2c_xfer.h"
+#endif /* LL_I2C_XFER_ENABLE */
+
 #if (LL_I2S_ENABLE == DDL_ON)
 #include "hc32_ll_i2s.h"
 #endif /* LL_I2S_ENABLE */
 
+#if (LL_I2S_STREAM_ENABLE == DDL_ON)
+#include "hc32_ll_i2s_stream.h"
+#endif /* LL_I2S_STREAM_ENABLE */
+
 #if (LL_ICG_ENABLE == DDL_ON)
 #include "hc32_ll_icg.h"
 #endif /* LL_ICG_ENABLE */
@@ -236,6 +280,10 @@ extern "C"
 #include "hc32_ll_mau.h"
 #endif /* LL_MAU_ENABLE */
 
+#if (LL_MAU_BATCH_ENABLE == DDL_ON)
+#include "hc32_ll_mau_batch.h"
+#endif /* LL_MAU_BATCH_ENABLE */
+
 #if (LL_MPU_ENABLE == DDL_ON)
 #include "hc32_ll_mpu.h"
 #endif /* LL_MPU_ENABLE */
@@ -272,6 +320,10 @@ extern "C"
 #include "hc32_ll_smc.h"
 #endif /* LL_SMC_ENABLE */
 
+#if (LL_SMC_LCD_ENABLE == DDL_ON)
+#include "hc32_ll_smc_lcd.h"
+#endif /* LL_SMC_LCD_ENABLE */
+
 #if (LL_SPI_ENABLE == DDL_ON)
 #include "hc32_ll_spi.h"
 #endif /* LL_SPI_ENABLE */
@@ -284,6 +336,14 @@ extern "C"
 #include "hc32_ll_swdt.h"
 #endif /* LL_SWDT_ENABLE */
 
+#if (LL_SWTMR_ENABLE == DDL_ON)
+#include "hc32_ll_swtmr.h"
+#endif /* LL_SWTMR_ENABLE */
+
+#if (LL_TICKLESS_ENABLE == DDL_ON)
+#include "hc32_ll_tickless.h"
+#endif /* LL_TICKLESS_ENABLE */
+
 #if (LL_TMR0_ENABLE == DDL_ON)
 #include "hc32_ll_tmr0.h"
 #endif /* LL_TMR0_ENABLE */
@@ -296,18 +356,34 @@ extern "C"
 #include "hc32_ll_tmr4.h"
 #endif /* LL_TMR4_ENABLE */
 
+#if (LL_TMR4_SVPWM_ENABLE == DDL_ON)
+#include "hc32_ll_tmr4_svpwm.h"
+#endif /* LL_TMR4_SVPWM_ENABLE */
+
 #if (LL_TMR6_ENABLE == DDL_ON)
 #include "hc32_ll_tmr6.h"
 #endif /* LL_TMR6_ENABLE */
 
+#if (LL_TMR6_SYNC_ENABLE == DDL_ON)
+#include "hc32_ll_tmr6_sync.h"
+#endif /* LL_TMR6_SYNC_ENABLE */
+
 #if (LL_TMRA_ENABLE == DDL_ON)
 #include "hc32_ll_tmra.h"
 #endif /* LL_TMRA_ENABLE */
 
+#if (LL_TMRA_ENC_ENABLE == DDL_ON)
+#include "hc32_ll_tmra_enc.h"
+#endif /* LL_TMRA_ENC_ENABLE */
+
 #if (LL_TRNG_ENABLE == DDL_ON)
 #include "hc32_ll_trng.h"
 #endif /* LL_TRNG_ENABLE */
 
+#if (LL_TSTAMP_ENABLE == DDL_ON)
+#include "hc32_ll_tstamp.h"
+#endif /* LL_TSTAMP_ENABLE */
+
 #if (LL_USART_ENABLE == DDL_ON)
 #include "hc32_ll_usart.h"
 #endif /* LL_USART_ENABLE */
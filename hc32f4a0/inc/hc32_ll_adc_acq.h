@@ -0,0 +1,264 @@
+/**
+ *******************************************************************************
+ * @file  hc32_ll_adc_acq.h
+ * @brief This file contains all the functions prototypes of the ADC continuous
+ *        acquisition driver library.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       CDT             First version
+                                    Added analog watchdog gated capture
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2025, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+#ifndef __HC32_LL_ADC_ACQ_H__
+#define __HC32_LL_ADC_ACQ_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ll_def.h"
+#include "hc32_ll_adc.h"
+#include "hc32_ll_dma.h"
+
+#include "hc32f4xx.h"
+#include "hc32f4xx_conf.h"
+
+/**
+ * @addtogroup LL_Driver
+ * @{
+ */
+
+/**
+ * @addtogroup LL_ADC_ACQ
+ * @{
+ */
+
+#if (LL_ADC_ACQ_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup ADC_ACQ_Global_Macros ADC_ACQ Global Macros
+ * @{
+ */
+
+/**
+ * @defgroup ADC_ACQ_Limits ADC_ACQ Limits
+ * @{
+ */
+#define ADC_ACQ_CH_MAX                  (20U)       /*!< Maximum frame width, channels of ADC3 */
+#define ADC_ACQ_CIC_ORDER_MAX           (4U)        /*!< Maximum order of the CIC decimator */
+/**
+ * @}
+ */
+
+/**
+ * @defgroup ADC_ACQ_Trigger ADC_ACQ Trigger
+ * @{
+ */
+#define ADC_ACQ_TRIG_NONE               (0xFFFFU)   /*!< No hardware trigger, sequence A converts continuously */
+/**
+ * @}
+ */
+
+/**
+ * @defgroup ADC_ACQ_AWD_Channel ADC_ACQ AWD Channel
+ * @{
+ */
+#define ADC_ACQ_AWD_CH_NONE             (0xFFU)     /*!< The analog watchdog unit is not used */
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup ADC_ACQ_Global_Types ADC_ACQ Global Types
+ * @{
+ */
+
+typedef struct stc_adc_acq stc_adc_acq_t;
+
+/**
+ * @brief ADC acquisition block callback
+ * @param [in] pstcAcq                  Acquisition of the block.
+ * @param [in] pu16Frame                Frames of the block, u8FrameWidth channels per frame.
+ * @param [in] u32FrameNum              Number of frames.
+ * @param [in] pvArg                    Argument given in @ref stc_adc_acq_init_t.
+ */
+typedef void (*func_ptr_adc_acq_t)(stc_adc_acq_t *pstcAcq, const uint16_t *pu16Frame,
+                                   uint32_t u32FrameNum, void *pvArg);
+
+/**
+ * @brief CIC decimator structure definition
+ * @note  Integrators run at the frame rate and combs at the decimated rate, with a differential
+ *        delay of one. The members are private to the driver.
+ */
+typedef struct {
+    uint8_t u8Order;                                            /*!< Number of integrator/comb stages */
+    uint8_t u8Width;                                            /*!< Number of channels */
+    uint8_t u8Shift;                                            /*!< Gain compensation, right shift of the output */
+    uint16_t u16Decim;                                          /*!< Decimation ratio */
+    uint16_t u16Phase;                                          /*!< Frames since the last output */
+    uint32_t au32Integ[ADC_ACQ_CIC_ORDER_MAX][ADC_ACQ_CH_MAX];  /*!< Integrator states */
+    uint32_t au32Comb[ADC_ACQ_CIC_ORDER_MAX][ADC_ACQ_CH_MAX];   /*!< Comb delay lines */
+} stc_adc_acq_cic_t;
+
+/**
+ * @brief ADC acquisition initialization structure definition
+ * @note  Sequence A channels are moved by DMA on every end of sequence A conversion, into a ring
+ *        of u16BlockNum blocks of u16BlockFrames frames. One frame holds the data registers from
+ *        the lowest to the highest sequence A channel, so the channels are interleaved in channel
+ *        order and the slots of the channels in between which are not converted are kept.
+ */
+typedef struct {
+    uint16_t u16Resolution;             /*!< A value of @ref ADC_Resolution */
+    uint16_t u16DataAlign;              /*!< A value of @ref ADC_Data_Align */
+    uint32_t u32SeqAMxCh;               /*!< Sequence A channels, a combination of @ref ADC_Mx_Channel */
+    uint16_t u16SeqATrigger;            /*!< A value of @ref ADC_Hard_Trigger_Sel, or @ref ADC_ACQ_TRIG_NONE for
+                                             continuous conversion */
+    uint32_t u32SeqBMxCh;               /*!< Sequence B channels, 0 if not used. Their results are read by
+                                             ADC_GetValue(), they are not part of the frames */
+    uint16_t u16SeqBTrigger;            /*!< A value of @ref ADC_Hard_Trigger_Sel */
+    uint16_t u16AverageCount;           /*!< A value of @ref ADC_Average_Count */
+    uint32_t u32AverageMxCh;            /*!< Averaged channels, a combination of @ref ADC_Mx_Channel, 0 for none */
+    CM_DMA_TypeDef *pstcDmaUnit;        /*!< DMA unit, it must be enabled by DMA_Cmd() */
+    uint8_t u8DmaCh;                    /*!< DMA channel */
+    uint32_t u32DmaTrigTarget;          /*!< AOS target of u8DmaCh, a value of @ref AOS_Target_Select */
+    en_event_src_t enEocaEvtSrc;        /*!< End of sequence A conversion event source of the ADC unit */
+    uint16_t *pu16Ring;                 /*!< Ring buffer, u16BlockNum * u16BlockFrames frames */
+    stc_dma_llp_descriptor_t *pstcDesc; /*!< u16BlockNum DMA descriptors, 32-bit aligned */
+    uint16_t u16BlockNum;               /*!< Number of blocks of the ring, at least 2 */
+    uint16_t u16BlockFrames;            /*!< Number of frames of a block */
+    func_ptr_adc_acq_t pfnCallback;     /*!< Block callback, called in interrupt context */
+    void *pvArg;                        /*!< Argument of the block callback */
+    stc_adc_acq_cic_t *pstcCic;         /*!< CIC decimator run on each block, NULL for none */
+    uint16_t *pu16DecimBuf;             /*!< Decimator output, u16BlockFrames / decimation + 1 frames */
+} stc_adc_acq_init_t;
+
+/**
+ * @brief ADC acquisition gate structure definition
+ * @note  In gated mode the ring keeps running but the blocks are not reported. When an analog
+ *        watchdog fires, the u16PreFrames frames before and the u16PostFrames frames from the event
+ *        on are copied to the snapshot and reported to the gate callback. The ring must hold at
+ *        least u16PreFrames + u16PostFrames + u16BlockFrames frames, because the end of the post
+ *        trigger window is checked on the block interrupts.
+ */
+typedef struct {
+    uint8_t u8Awd0Ch;                   /*!< Channel of AWD0, a value of @ref ADC_Channel or @ref ADC_ACQ_AWD_CH_NONE */
+    stc_adc_awd_config_t stcAwd0;       /*!< Window of AWD0 */
+    uint8_t u8Awd1Ch;                   /*!< Channel of AWD1, a value of @ref ADC_Channel or @ref ADC_ACQ_AWD_CH_NONE */
+    stc_adc_awd_config_t stcAwd1;       /*!< Window of AWD1 */
+    uint16_t u16CombMode;               /*!< A value of @ref ADC_AWD_Comb_Mode, both units are required
+                                             unless ADC_AWD_COMB_INVD */
+    uint16_t u16PreFrames;              /*!< Frames captured before the event */
+    uint16_t u16PostFrames;             /*!< Frames captured from the event on, at least 1 */
+    uint16_t *pu16Snapshot;             /*!< Capture buffer, u16PreFrames + u16PostFrames frames */
+    func_ptr_adc_acq_t pfnCallback;     /*!< Capture callback, called in interrupt context */
+    void *pvArg;                        /*!< Argument of the capture callback */
+} stc_adc_acq_gate_t;
+
+/**
+ * @brief ADC acquisition structure definition
+ * @note  The members are private to the driver.
+ */
+struct stc_adc_acq {
+    CM_ADC_TypeDef *pstcAdc;            /*!< ADC unit */
+    CM_DMA_TypeDef *pstcDmaUnit;        /*!< DMA unit */
+    uint8_t u8DmaCh;                    /*!< DMA channel */
+    uint8_t u8FirstCh;                  /*!< First channel of a frame */
+    uint8_t u8FrameWidth;               /*!< Channels per frame */
+    uint8_t u8Triggered;                /*!< Sequence A waits for a hardware trigger */
+    uint16_t *pu16Ring;                 /*!< Ring buffer */
+    stc_dma_llp_descriptor_t *pstcDesc; /*!< DMA descriptors, one per block */
+    uint16_t u16BlockNum;               /*!< Number of blocks */
+    uint16_t u16BlockFrames;            /*!< Frames per block */
+    uint16_t u16NextBlock;              /*!< Next block to be reported */
+    func_ptr_adc_acq_t pfnCallback;     /*!< Block callback */
+    void *pvArg;                        /*!< Argument of the block callback */
+    stc_adc_acq_cic_t *pstcCic;         /*!< CIC decimator */
+    uint16_t *pu16DecimBuf;             /*!< Decimator output */
+    uint32_t u32BlockCount;             /*!< Statistics: blocks reported */
+    const stc_adc_acq_gate_t *pstcGate; /*!< Gate, NULL if every block is reported */
+    uint8_t u8GateState;                /*!< Gate state */
+    uint32_t u32TrigFrame;              /*!< Ring frame of the event being captured */
+    uint32_t u32AwdFlags;               /*!< AWD flags of the event being captured */
+    uint32_t u32EventCount;             /*!< Statistics: events captured */
+};
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup ADC_ACQ_Global_Functions
+ * @{
+ */
+int32_t ADC_ACQ_StructInit(stc_adc_acq_init_t *pstcAcqInit);
+int32_t ADC_ACQ_Init(stc_adc_acq_t *pstcAcq, CM_ADC_TypeDef *ADCx, const stc_adc_acq_init_t *pstcAcqInit);
+int32_t ADC_ACQ_Start(stc_adc_acq_t *pstcAcq);
+void ADC_ACQ_Stop(stc_adc_acq_t *pstcAcq);
+int32_t ADC_ACQ_SyncStart(stc_adc_acq_t *const apstcAcq[], uint8_t u8Num, uint16_t u16SyncUnit,
+                          uint16_t u16SyncMode, uint8_t u8TriggerDelay);
+void ADC_ACQ_SyncStop(stc_adc_acq_t *const apstcAcq[], uint8_t u8Num);
+void ADC_ACQ_DmaIrqHandler(stc_adc_acq_t *pstcAcq);
+
+int32_t ADC_ACQ_GateConfig(stc_adc_acq_t *pstcAcq, const stc_adc_acq_gate_t *pstcGate);
+uint32_t ADC_ACQ_GetGateFlags(const stc_adc_acq_t *pstcAcq);
+void ADC_ACQ_AwdIrqHandler(stc_adc_acq_t *pstcAcq);
+
+int32_t ADC_ACQ_CicInit(stc_adc_acq_cic_t *pstcCic, uint8_t u8Order, uint16_t u16Decim, uint8_t u8Width);
+uint32_t ADC_ACQ_CicProcess(stc_adc_acq_cic_t *pstcCic, const uint16_t *pu16In, uint32_t u32FrameNum,
+                            uint16_t *pu16Out);
+
+/**
+ * @}
+ */
+
+#endif /* LL_ADC_ACQ_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __HC32_LL_ADC_ACQ_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
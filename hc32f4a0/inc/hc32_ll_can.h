@@ -13,6 +13,9 @@
                                     Modify typo
    2024-06-30       CDT             API CAN_DeInit() added return value
                                     Added macro group CAN_ID_Mask
+   2026-10-19       CDT             Added RX ring drain and software ID dispatch APIs
+                                    Added TTCAN schedule APIs
+                                    Skipped a TTCAN slot whose transmit buffer is still filled
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2022-2025, Xiaohua Semiconductor Co., Ltd. All rights reserved.
@@ -217,6 +220,76 @@ typedef struct {
     uint8_t au8Data[64U];                   /*!< RX data payload. */
 } stc_can_rx_frame_t;
 
+/**
+ * @brief CAN RX frame handler prototype.
+ */
+typedef void (*func_ptr_can_rx_t)(const stc_can_rx_frame_t *pstcRx, void *pvArg);
+
+/**
+ * @brief CAN RX dispatch entry structure.
+ */
+typedef struct {
+    uint32_t u32ID;                         /*!< 11 bits standard ID or 29 bits extended ID, depending on u8IDE. */
+    uint8_t u8IDE;                          /*!< Identifier extension flag, 0: standard ID, 1: extended ID. */
+    func_ptr_can_rx_t pfnHandler;           /*!< Handler of the frames with this ID. */
+    void *pvArg;                            /*!< Argument of the handler. */
+} stc_can_rx_dispatch_entry_t;
+
+/**
+ * @brief CAN RX dispatch table structure.
+ * @note  Built by CAN_RxDispatchInit(), the members are private to the driver.
+ */
+typedef struct {
+    const stc_can_rx_dispatch_entry_t *pstcEntry;   /*!< Dispatch entries. */
+    uint16_t *pu16Hash;                     /*!< Hash buckets, entry index plus one, 0 for an empty bucket. */
+    uint8_t u8HashBits;                     /*!< Number of hash buckets is 2^u8HashBits. */
+    uint32_t au32StdIdMap[64U];             /*!< Bitmap of the standard IDs in the table. */
+    uint32_t au32ExtIdMap[32U];             /*!< Bitmap of the hashes of the extended IDs in the table. */
+} stc_can_rx_dispatch_t;
+
+/**
+ * @brief CAN RX ring structure.
+ * @note  One writer (CAN_DrainRxFrame) and one reader. The head and tail run freely and
+ *        are masked with the ring size, which must be a power of 2.
+ */
+typedef struct {
+    stc_can_rx_frame_t *pstcBuf;            /*!< Frame buffer of the ring. */
+    uint16_t u16Size;                       /*!< Number of frames of the buffer, a power of 2. */
+    __IO uint16_t u16Head;                  /*!< Write index, updated by CAN_DrainRxFrame(). */
+    __IO uint16_t u16Tail;                  /*!< Read index, updated by the reader. */
+    uint32_t u32OvfCount;                   /*!< Frames dropped because the ring was full. */
+    uint32_t u32RejectCount;                /*!< Frames dropped because the dispatch table has no entry for the ID. */
+} stc_can_rx_ring_t;
+
+/**
+ * @brief TTCAN schedule slot structure.
+ * @note  A slot is transmitted in the basic cycles c of the matrix with (c % u8Repeat) == u8BaseCycle.
+ */
+typedef struct {
+    uint16_t u16Offset;                     /*!< Trigger time of the slot in NTU from the start of the basic cycle. Range is [1, 65535] */
+    uint16_t u16Length;                     /*!< Length of the exclusive time window of the slot in NTU, not 0. */
+    uint8_t u8BaseCycle;                    /*!< First basic cycle of the slot, less than u8Repeat. */
+    uint8_t u8Repeat;                       /*!< Repetition of the slot in basic cycles, a power of 2 not greater than
+                                                 the number of basic cycles of the matrix. */
+    uint8_t u8TxEnableWindow;               /*!< Tx_Enable window of the slot in NTU. Range is [1, 16] */
+    const stc_can_tx_frame_t *pstcFrame;    /*!< Frame of the slot. The payload may be updated between two transmissions. */
+} stc_can_ttc_slot_t;
+
+/**
+ * @brief TTCAN schedule structure.
+ * @note  Built by CAN_TTC_SchedCompile() or CAN_TTC_SchedLoad(), the members are private to the driver.
+ */
+typedef struct {
+    stc_can_ttc_slot_t *pstcSlot;           /*!< Slots sorted by trigger time. */
+    uint16_t u16SlotNum;                    /*!< Number of the slots. */
+    uint16_t u16CycleLength;                /*!< Length of the basic cycle in NTU. */
+    uint8_t u8CycleNum;                     /*!< Number of basic cycles of the matrix, a power of 2. */
+    uint8_t u8Cycle;                        /*!< Current basic cycle. */
+    uint16_t u16Armed;                      /*!< Slot of the armed trigger, u16SlotNum for the start of the next basic cycle. */
+    uint8_t u8TxBuf;                        /*!< Transmit buffer to be filled by the next slot. */
+    uint32_t u32MissCount;                  /*!< Slots skipped because the transmit buffer to be filled was still filled. */
+} stc_can_ttc_sched_t;
+
 /**
  * @}
  */
@@ -644,6 +717,18 @@ typedef struct {
 #define CAN_TTC_TRIG_TX_START_TRIG      (CAN_TRG_CFG_TTYPE_1 | \
                                          CAN_TRG_CFG_TTYPE_0)   /*!< Transmit start trigger for merged arbitrating time windows. */
 #define CAN_TTC_TRIG_TX_STOP_TRIG       (CAN_TRG_CFG_TTYPE_2)   /*!< Transmit stop trigger for merged arbitrating time windows. */
+/**
+ * @defgroup TTCAN_Sched_Table TTCAN Schedule Binary Table
+ * @brief    Little-endian layout loaded by CAN_TTC_SchedLoad().
+ *           Header: magic(2 bytes 'T' 'S'), version(1), number of basic cycles(1), basic cycle length(2), number of slots(2).
+ *           Slot:   offset(2), length(2), base cycle(1), repetition(1), Tx_Enable window(1), frame index(1).
+ * @{
+ */
+#define CAN_TTC_SCHED_TBL_MAGIC0        (0x54U)                 /*!< 'T' */
+#define CAN_TTC_SCHED_TBL_MAGIC1        (0x53U)                 /*!< 'S' */
+#define CAN_TTC_SCHED_TBL_VER           (0x01U)                 /*!< Version of the table layout. */
+#define CAN_TTC_SCHED_TBL_HDR_SIZE      (8U)                    /*!< Size of the table header in bytes. */
+#define CAN_TTC_SCHED_TBL_SLOT_SIZE     (8U)                    /*!< Size of a slot record in bytes. */
 /**
  * @}
  */
@@ -673,6 +758,15 @@ void CAN_StartTx(CM_CAN_TypeDef *CANx, uint8_t u8TxRequest);
 void CAN_AbortTx(CM_CAN_TypeDef *CANx, uint8_t u8TxBufType);
 int32_t CAN_GetRxFrame(CM_CAN_TypeDef *CANx, stc_can_rx_frame_t *pstcRx);
 
+int32_t CAN_RxRingInit(stc_can_rx_ring_t *pstcRing, stc_can_rx_frame_t *pstcBuf, uint16_t u16Size);
+int32_t CAN_RxDispatchInit(stc_can_rx_dispatch_t *pstcDisp, const stc_can_rx_dispatch_entry_t *pstcEntry,
+                           uint16_t u16EntryNum, uint16_t *pu16Hash, uint16_t u16HashSize);
+const stc_can_rx_dispatch_entry_t *CAN_RxDispatchFind(const stc_can_rx_dispatch_t *pstcDisp,
+                                                      uint32_t u32ID, uint8_t u8IDE);
+uint32_t CAN_DrainRxFrame(CM_CAN_TypeDef *CANx, stc_can_rx_ring_t *pstcRing, const stc_can_rx_dispatch_t *pstcDisp);
+int32_t CAN_RxRingGet(stc_can_rx_ring_t *pstcRing, stc_can_rx_frame_t *pstcRx);
+uint32_t CAN_RxRingDispatch(stc_can_rx_ring_t *pstcRing, const stc_can_rx_dispatch_t *pstcDisp);
+
 void CAN_EnterLocalReset(CM_CAN_TypeDef *CANx);
 void CAN_ExitLocalReset(CM_CAN_TypeDef *CANx);
 en_flag_status_t CAN_GetLocalResetStatus(CM_CAN_TypeDef *CANx);
@@ -708,6 +802,17 @@ int32_t CAN_TTC_FillTxFrame(CM_CAN_TypeDef *CANx, uint8_t u8CANTTCTxBuf, const s
 
 int32_t CAN_TTC_GetConfig(const CM_CAN_TypeDef *CANx, stc_can_ttc_config_t *pstcCanTtc);
 
+int32_t CAN_TTC_SchedCompile(stc_can_ttc_sched_t *pstcSched, stc_can_ttc_slot_t *pstcSlot, uint16_t u16SlotNum,
+                             uint16_t u16CycleLength, uint8_t u8CycleNum);
+int32_t CAN_TTC_SchedLoad(stc_can_ttc_sched_t *pstcSched, stc_can_ttc_slot_t *pstcSlot, uint16_t u16SlotBufNum,
+                          const uint8_t *pu8Table, uint32_t u32TableSize,
+                          const stc_can_tx_frame_t *pstcFrame, uint16_t u16FrameNum);
+int32_t CAN_TTC_SchedStart(CM_CAN_TypeDef *CANx, stc_can_ttc_sched_t *pstcSched);
+void CAN_TTC_SchedStop(CM_CAN_TypeDef *CANx);
+void CAN_TTC_SchedSetCycle(stc_can_ttc_sched_t *pstcSched, uint8_t u8Cycle);
+uint32_t CAN_TTC_SchedGetMissCount(const stc_can_ttc_sched_t *pstcSched);
+void CAN_TTC_SchedIrqHandler(CM_CAN_TypeDef *CANx, stc_can_ttc_sched_t *pstcSched);
+
 /**
  * @}
  */
@@ -10,6 +10,8 @@
    2022-06-30       CDT             Refine stc_clock_freq_t
    2023-12-15       CDT             Modify comment
                                     Refine API CLK_XtalStdInit and add API CLK_XtalStdCmd, CLK_SetXtalStdExceptionType
+   2026-10-19       CDT             Added bus clock frequency cache and change notification APIs
+                                    Added change notify events and API CLK_ChangeBegin(), CLK_ChangeEnd()
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2022-2025, Xiaohua Semiconductor Co., Ltd. All rights reserved.
@@ -188,6 +190,23 @@ typedef struct {
     uint32_t u32PllxR;                 /*!< pllxr clock frequency.         */
 } stc_pll_clock_freq_t;
 
+/**
+ * @brief  CLK frequency change callback prototype
+ * @note   u32Event is a value of @ref CLK_Notify_Event. For CLK_NOTIFY_PRE a return value other than
+ *         LL_OK refuses the change, the return value of the other events is ignored.
+ */
+typedef int32_t (*func_ptr_clk_notify_t)(uint32_t u32Event, const stc_clock_freq_t *pstcClockFreq, void *pvArg);
+
+/**
+ * @brief  CLK frequency change notifier structure definition
+ * @note   The members are private to the driver.
+ */
+typedef struct stc_clock_notify {
+    func_ptr_clk_notify_t pfnCallback;     /*!< Called with the frequencies.     */
+    void *pvArg;                           /*!< Argument of the callback.        */
+    struct stc_clock_notify *pstcNext;     /*!< Next notifier.                   */
+} stc_clock_notify_t;
+
 /**
  * @}
  */
@@ -375,6 +394,17 @@ typedef struct {
  * @}
  */
 
+/**
+ * @defgroup CLK_Notify_Event CLK Frequency Change Notify Event
+ * @{
+ */
+#define CLK_NOTIFY_PRE                  (0UL)   /*!< Before a change, with the frequencies to come      */
+#define CLK_NOTIFY_POST                 (1UL)   /*!< After a change, with the new frequencies           */
+#define CLK_NOTIFY_ABORT                (2UL)   /*!< Change cancelled, with the frequencies left behind */
+/**
+ * @}
+ */
+
 /**
  * @defgroup CLK_Bus_Clock_Sel Clock Bus Clock Category Selection
  * @{
@@ -711,6 +741,11 @@ void CLK_SetSysClockSrc(uint8_t u8Src);
 void CLK_SetClockDiv(uint32_t u32Clock, uint32_t u32Div);
 int32_t CLK_GetClockFreq(stc_clock_freq_t *pstcClockFreq);
 uint32_t CLK_GetBusClockFreq(uint32_t u32Clock);
+void CLK_UpdateClockFreq(void);
+int32_t CLK_RegisterNotify(stc_clock_notify_t *pstcNotify, func_ptr_clk_notify_t pfnCallback, void *pvArg);
+int32_t CLK_UnregisterNotify(stc_clock_notify_t *pstcNotify);
+int32_t CLK_ChangeBegin(const stc_clock_freq_t *pstcClockFreq);
+void CLK_ChangeEnd(uint32_t u32Event);
 
 void CLK_SetPeriClockSrc(uint16_t u16Src);
 void CLK_SetUSBClockSrc(uint8_t u8Src);
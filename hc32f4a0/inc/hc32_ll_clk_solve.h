@@ -0,0 +1,175 @@
+/**
+ *******************************************************************************
+ * @file  hc32_ll_clk_solve.h
+ * @brief This file contains all the functions prototypes of the clock tree
+ *        solver driver library.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2025, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+#ifndef __HC32_LL_CLK_SOLVE_H__
+#define __HC32_LL_CLK_SOLVE_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ll_def.h"
+#include "hc32_ll_clk.h"
+
+#include "hc32f4xx.h"
+#include "hc32f4xx_conf.h"
+
+/**
+ * @addtogroup LL_Driver
+ * @{
+ */
+
+/**
+ * @addtogroup LL_CLK_SOLVE
+ * @{
+ */
+
+#if (LL_CLK_SOLVE_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup CLK_SOLVE_Global_Macros CLK_SOLVE Global Macros
+ * @{
+ */
+
+/**
+ * @defgroup CLK_SOLVE_Bus_Max CLK_SOLVE Bus Clock Maximum Frequency
+ * @{
+ */
+#define CLK_SOLVE_HCLK_MAX              (240UL*1000UL*1000UL)
+#define CLK_SOLVE_PCLK0_MAX             (240UL*1000UL*1000UL)
+#define CLK_SOLVE_PCLK1_MAX             (120UL*1000UL*1000UL)
+#define CLK_SOLVE_PCLK2_MAX             (60UL*1000UL*1000UL)
+#define CLK_SOLVE_PCLK3_MAX             (60UL*1000UL*1000UL)
+#define CLK_SOLVE_PCLK4_MAX             (120UL*1000UL*1000UL)
+#define CLK_SOLVE_EXCLK_MAX             (120UL*1000UL*1000UL)
+/**
+ * @}
+ */
+
+#define CLK_SOLVE_EFM_WAIT_STEP         (40UL*1000UL*1000UL)    /*!< HCLK range of one EFM read wait cycle */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup CLK_SOLVE_Global_Types CLK_SOLVE Global Types
+ * @{
+ */
+
+/**
+ * @brief Clock solver target structure definition
+ */
+typedef struct {
+    uint32_t u32PllSrc;                 /*!< PLL source, a value of @ref CLK_PLL_Source_Clock */
+    uint32_t u32InFreq;                 /*!< Frequency of the PLL source in Hz */
+    uint32_t u32PFreq;                  /*!< Wanted P output in Hz, 0 for don't care */
+    uint32_t u32QFreq;                  /*!< Wanted Q output in Hz, 0 for don't care */
+    uint32_t u32RFreq;                  /*!< Wanted R output in Hz, 0 for don't care */
+    uint32_t u32Tol;                    /*!< Largest error of a wanted output in ppm */
+} stc_clk_solve_target_t;
+
+/**
+ * @brief Clock solver result structure definition
+ */
+typedef struct {
+    uint32_t u32PFreq;                  /*!< P output in Hz */
+    uint32_t u32QFreq;                  /*!< Q output in Hz */
+    uint32_t u32RFreq;                  /*!< R output in Hz */
+    uint32_t u32VcoIn;                  /*!< VCO input in Hz */
+    uint32_t u32VcoOut;                 /*!< VCO output in Hz */
+    uint32_t u32Err;                    /*!< Largest error of the wanted outputs in ppm */
+} stc_clk_solve_result_t;
+
+/**
+ * @brief Clock tree configuration structure definition
+ * @note  One entry of a boot table, filled by CLK_SOLVE_Config() offline or at run time.
+ */
+typedef struct {
+    stc_clock_pll_init_t stcPLLInit;    /*!< PLLH configuration, its P output is the system clock */
+    uint32_t u32ClockDiv;               /*!< Dividers of CLK_BUS_CLK_ALL, an OR of @ref CLK_Clock_Divider values */
+    uint32_t u32WaitCycle;              /*!< EFM read wait cycle of the HCLK, a value of @ref EFM_Wait_Cycle */
+} stc_clk_solve_cfg_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup CLK_SOLVE_Global_Functions
+ * @{
+ */
+int32_t CLK_SOLVE_TargetStructInit(stc_clk_solve_target_t *pstcTarget);
+
+int32_t CLK_SOLVE_PLL(const stc_clk_solve_target_t *pstcTarget, stc_clock_pll_init_t *pstcPLLInit,
+                      stc_clk_solve_result_t *pstcResult);
+int32_t CLK_SOLVE_PLLx(const stc_clk_solve_target_t *pstcTarget, stc_clock_pllx_init_t *pstcPLLxInit,
+                       stc_clk_solve_result_t *pstcResult);
+
+uint32_t CLK_SOLVE_ClockDiv(uint32_t u32SysclkFreq);
+uint32_t CLK_SOLVE_WaitCycle(uint32_t u32HclkFreq);
+int32_t CLK_SOLVE_Config(const stc_clk_solve_target_t *pstcTarget, stc_clk_solve_cfg_t *pstcCfg,
+                         stc_clk_solve_result_t *pstcResult);
+
+#if (LL_EFM_ENABLE == DDL_ON)
+int32_t CLK_SOLVE_Apply(const stc_clk_solve_cfg_t *pstcCfg);
+#endif /* LL_EFM_ENABLE */
+
+/**
+ * @}
+ */
+
+#endif /* LL_CLK_SOLVE_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __HC32_LL_CLK_SOLVE_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
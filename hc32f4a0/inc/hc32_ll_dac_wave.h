@@ -0,0 +1,205 @@
+/**
+ *******************************************************************************
+ * @file  hc32_ll_dac_wave.h
+ * @brief This file contains all the functions prototypes of the DAC DMA
+ *        waveform generator driver library.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2025, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+#ifndef __HC32_LL_DAC_WAVE_H__
+#define __HC32_LL_DAC_WAVE_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ll_def.h"
+#include "hc32_ll_dac.h"
+#include "hc32_ll_dma.h"
+
+#include "hc32f4xx.h"
+#include "hc32f4xx_conf.h"
+
+/**
+ * @addtogroup LL_Driver
+ * @{
+ */
+
+/**
+ * @addtogroup LL_DAC_WAVE
+ * @{
+ */
+
+#if (LL_DAC_WAVE_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup DAC_WAVE_Global_Types DAC_WAVE Global Types
+ * @{
+ */
+
+typedef struct stc_dac_wave stc_dac_wave_t;
+
+/**
+ * @brief DAC waveform refill callback
+ * @param [in] pstcWave                 Waveform of the event.
+ * @param [in] pvBuf                    Half buffer which has just been played and is to be refilled,
+ *                                      uint16_t samples for one channel, uint32_t pairs for dual channel.
+ * @param [in] u32Len                   Number of samples of pvBuf.
+ * @param [in] pvArg                    Argument given in @ref stc_dac_wave_init_t.
+ */
+typedef void (*func_ptr_dac_wave_t)(stc_dac_wave_t *pstcWave, void *pvBuf, uint32_t u32Len, void *pvArg);
+
+/**
+ * @brief DAC waveform initialization structure definition
+ */
+typedef struct {
+    uint16_t u16Ch;                     /*!< Output channel, a value of @ref DAC_WAVE_Channel */
+    uint16_t u16Mode;                   /*!< Play mode, a value of @ref DAC_WAVE_Mode */
+    void *pvBuf;                        /*!< Sample table, uint16_t samples or, for @ref DAC_WAVE_CH_DUAL,
+                                             uint32_t pairs built by DAC_WAVE_Interleave() */
+    uint32_t u32Len;                    /*!< Number of samples of the table, see @ref DAC_WAVE_Mode */
+    CM_DMA_TypeDef *pstcDmaUnit;        /*!< DMA unit, it must be enabled by DMA_Cmd() */
+    uint8_t u8DmaCh;                    /*!< DMA channel */
+    uint32_t u32TrigTarget;             /*!< AOS target of u8DmaCh, a value of @ref AOS_Target_Select */
+    en_event_src_t enEvtSrc;            /*!< Timer event pacing the samples */
+    func_ptr_dac_wave_t pfnCallback;    /*!< Refill callback of @ref DAC_WAVE_MD_STREAM, called in interrupt context */
+    void *pvArg;                        /*!< Argument of the refill callback */
+} stc_dac_wave_init_t;
+
+/**
+ * @brief DAC waveform structure definition
+ * @note  The members are private to the driver. The structure holds the DMA linked list
+ *        descriptors and must stay valid while the waveform plays.
+ */
+struct stc_dac_wave {
+    CM_DAC_TypeDef *pstcDac;                    /*!< DAC unit */
+    uint16_t u16Ch;                             /*!< Output channel */
+    uint16_t u16Mode;                           /*!< Play mode */
+    void *pvBuf;                                /*!< Sample table */
+    uint32_t u32Len;                            /*!< Number of samples of the table */
+    CM_DMA_TypeDef *pstcDmaUnit;                /*!< DMA unit */
+    uint8_t u8DmaCh;                            /*!< DMA channel */
+    func_ptr_dac_wave_t pfnCallback;            /*!< Refill callback */
+    void *pvArg;                                /*!< Argument of the refill callback */
+    stc_dma_llp_descriptor_t astcDesc[2U];      /*!< Linked list of the table */
+    uint8_t u8Running;                          /*!< Waveform playing */
+    uint32_t u32HalfCount;                      /*!< Statistics: halves refilled */
+};
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup DAC_WAVE_Global_Macros DAC_WAVE Global Macros
+ * @{
+ */
+
+/**
+ * @defgroup DAC_WAVE_Channel DAC_WAVE Channel
+ * @{
+ */
+#define DAC_WAVE_CH1                    (DAC_CH1)   /*!< Channel 1 only */
+#define DAC_WAVE_CH2                    (DAC_CH2)   /*!< Channel 2 only */
+#define DAC_WAVE_CH_DUAL                (0x02U)     /*!< Both channels, updated by one 32-bit write */
+/**
+ * @}
+ */
+
+/**
+ * @defgroup DAC_WAVE_Mode DAC_WAVE Mode
+ * @{
+ */
+#define DAC_WAVE_MD_LOOP                (0U)        /*!< Play the table forever, up to 0xFFFF samples */
+#define DAC_WAVE_MD_STREAM              (1U)        /*!< Play the two halves of the table in turn and refill
+                                                         the played one, even length up to 2 * 0xFFFF */
+/**
+ * @}
+ */
+
+/**
+ * @defgroup DAC_WAVE_Table_Length DAC_WAVE Table Length
+ * @{
+ */
+#define DAC_WAVE_TABLE_LEN_MIN          (4UL)
+#define DAC_WAVE_TABLE_LEN_MAX          (0xFFFFUL)
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup DAC_WAVE_Global_Functions
+ * @{
+ */
+int32_t DAC_WAVE_StructInit(stc_dac_wave_init_t *pstcWaveInit);
+int32_t DAC_WAVE_Init(stc_dac_wave_t *pstcWave, CM_DAC_TypeDef *DACx, const stc_dac_wave_init_t *pstcWaveInit);
+int32_t DAC_WAVE_Start(stc_dac_wave_t *pstcWave);
+void DAC_WAVE_Stop(stc_dac_wave_t *pstcWave);
+void DAC_WAVE_DmaIrqHandler(stc_dac_wave_t *pstcWave);
+
+uint32_t DAC_WAVE_CalcTableLen(uint32_t u32SampleRate, uint32_t u32FreqMilliHz);
+int32_t DAC_WAVE_GenSine(uint16_t *pu16Table, uint32_t u32Len, uint16_t u16Amp, uint16_t u16Offset,
+                         uint16_t u16Align);
+int32_t DAC_WAVE_GenTriangle(uint16_t *pu16Table, uint32_t u32Len, uint16_t u16Amp, uint16_t u16Offset,
+                             uint16_t u16Align);
+int32_t DAC_WAVE_GenArbitrary(uint16_t *pu16Table, uint32_t u32Len, const int16_t *pi16Point,
+                              uint32_t u32PointNum, uint16_t u16Amp, uint16_t u16Offset, uint16_t u16Align);
+void DAC_WAVE_Interleave(uint32_t *pu32Dual, const uint16_t *pu16Ch1, const uint16_t *pu16Ch2, uint32_t u32Len);
+
+/**
+ * @}
+ */
+
+#endif /* LL_DAC_WAVE_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __HC32_LL_DAC_WAVE_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
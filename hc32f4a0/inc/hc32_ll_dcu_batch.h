@@ -0,0 +1,188 @@
+/**
+ *******************************************************************************
+ * @file  hc32_ll_dcu_batch.h
+ * @brief This file contains all the functions prototypes of the DCU batch
+ *        kernels driver library.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       CDT             First version
+                                    Removed enEvtSrc from stc_dcu_batch_init_t
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2025, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+#ifndef __HC32_LL_DCU_BATCH_H__
+#define __HC32_LL_DCU_BATCH_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ll_def.h"
+#include "hc32_ll_dma.h"
+
+#include "hc32f4xx.h"
+#include "hc32f4xx_conf.h"
+
+/**
+ * @addtogroup LL_Driver
+ * @{
+ */
+
+/**
+ * @addtogroup LL_DCU_BATCH
+ * @{
+ */
+
+#if (LL_DCU_BATCH_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup DCU_BATCH_Global_Types DCU_BATCH Global Types
+ * @{
+ */
+
+typedef struct stc_dcu_batch stc_dcu_batch_t;
+
+/**
+ * @brief DCU batch completion callback
+ * @param [in] pstcBatch                Kernel of the event.
+ * @param [in] u32Event                 A value of @ref DCU_BATCH_Event.
+ * @param [in] pvArg                    Argument given in @ref stc_dcu_batch_init_t.
+ */
+typedef void (*func_ptr_dcu_batch_t)(stc_dcu_batch_t *pstcBatch, uint32_t u32Event, void *pvArg);
+
+/**
+ * @brief DCU batch accumulation result structure definition
+ */
+typedef struct {
+    uint32_t u32Sum;                    /*!< Result wrapped to the data width, as DATA0 holds it */
+    uint32_t u32SatSum;                 /*!< Result saturated to the data width */
+    uint8_t u8Carry;                    /*!< 1 if an addition overflowed or a subtraction underflowed */
+} stc_dcu_batch_acc_t;
+
+/**
+ * @brief DCU batch initialization structure definition
+ */
+typedef struct {
+    CM_DMA_TypeDef *pstcDmaUnit;        /*!< DMA unit, it must be enabled by DMA_Cmd() */
+    uint8_t u8DmaCh;                    /*!< DMA channel feeding the DCU, requested by DMA_MxChSWTrigger() */
+    uint32_t u32TrigTarget;             /*!< AOS target of u8DmaCh, a value of @ref AOS_Target_Select,
+                                             set to no event so that only the kernel requests the channel */
+    func_ptr_dcu_batch_t pfnCallback;   /*!< Completion callback, called in interrupt context */
+    void *pvArg;                        /*!< Argument of the completion callback */
+} stc_dcu_batch_init_t;
+
+/**
+ * @brief DCU batch structure definition
+ * @note  The members are private to the driver.
+ */
+struct stc_dcu_batch {
+    CM_DCU_TypeDef *pstcDcu;            /*!< DCU unit */
+    CM_DMA_TypeDef *pstcDmaUnit;        /*!< DMA unit */
+    uint8_t u8DmaCh;                    /*!< DMA channel */
+    func_ptr_dcu_batch_t pfnCallback;   /*!< Completion callback */
+    void *pvArg;                        /*!< Argument of the completion callback */
+    uint8_t u8State;                    /*!< Kernel running */
+    uint8_t u8Size;                     /*!< Bytes per element */
+    uint32_t u32Mode;                   /*!< DCU mode of the kernel */
+    const void *pvSrc;                  /*!< Source array */
+    uint32_t u32Len;                    /*!< Number of elements */
+    uint32_t u32Pos;                    /*!< First element of the current chunk */
+    uint32_t u32Lower;                  /*!< Lower limit of the compare kernel */
+    uint32_t u32Upper;                  /*!< Upper limit of the compare kernel */
+    uint32_t u32CrossIdx;               /*!< First element out of the limits, u32Len if none */
+    stc_dcu_batch_acc_t stcAcc;         /*!< Result of the accumulation kernel */
+};
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup DCU_BATCH_Global_Macros DCU_BATCH Global Macros
+ * @{
+ */
+
+/**
+ * @defgroup DCU_BATCH_Event DCU_BATCH Event
+ * @{
+ */
+#define DCU_BATCH_EVT_ACC_DONE          (0x01UL)    /*!< Accumulation done */
+#define DCU_BATCH_EVT_CMP_DONE          (0x02UL)    /*!< Compare done, all elements within the limits */
+#define DCU_BATCH_EVT_CMP_CROSS         (0x04UL)    /*!< Compare stopped at an element out of the limits */
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup DCU_BATCH_Global_Functions
+ * @{
+ */
+int32_t DCU_BATCH_StructInit(stc_dcu_batch_init_t *pstcBatchInit);
+int32_t DCU_BATCH_Init(stc_dcu_batch_t *pstcBatch, CM_DCU_TypeDef *DCUx, const stc_dcu_batch_init_t *pstcBatchInit);
+int32_t DCU_BATCH_Accumulate(stc_dcu_batch_t *pstcBatch, uint32_t u32Mode, uint32_t u32DataWidth,
+                             const void *pvSrc, uint32_t u32Len, uint32_t u32Seed);
+int32_t DCU_BATCH_Compare(stc_dcu_batch_t *pstcBatch, uint32_t u32DataWidth, const void *pvSrc, uint32_t u32Len,
+                          uint32_t u32Lower, uint32_t u32Upper);
+int32_t DCU_BATCH_GetAccResult(const stc_dcu_batch_t *pstcBatch, stc_dcu_batch_acc_t *pstcAcc);
+int32_t DCU_BATCH_GetCrossing(const stc_dcu_batch_t *pstcBatch, uint32_t *pu32Idx);
+
+void DCU_BATCH_DmaIrqHandler(stc_dcu_batch_t *pstcBatch);
+void DCU_BATCH_DcuIrqHandler(stc_dcu_batch_t *pstcBatch);
+
+int32_t DCU_BATCH_AccumulateModel(uint32_t u32Mode, uint32_t u32DataWidth, const void *pvSrc, uint32_t u32Len,
+                                  uint32_t u32Seed, stc_dcu_batch_acc_t *pstcAcc);
+
+/**
+ * @}
+ */
+
+#endif /* LL_DCU_BATCH_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __HC32_LL_DCU_BATCH_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
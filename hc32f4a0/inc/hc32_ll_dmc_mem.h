@@ -0,0 +1,158 @@
+/**
+ *******************************************************************************
+ * @file  hc32_ll_dmc_mem.h
+ * @brief This file contains all the functions prototypes of the SDRAM memory
+ *        manager driver library.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2025, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+#ifndef __HC32_LL_DMC_MEM_H__
+#define __HC32_LL_DMC_MEM_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ll_def.h"
+
+#include "hc32f4xx.h"
+#include "hc32f4xx_conf.h"
+
+/**
+ * @addtogroup LL_Driver
+ * @{
+ */
+
+/**
+ * @addtogroup LL_DMC_MEM
+ * @{
+ */
+
+#if (LL_DMC_MEM_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup DMC_MEM_Global_Types DMC_MEM Global Types
+ * @{
+ */
+
+/**
+ * @brief Memory region structure definition
+ * @note  The members are private to the driver.
+ */
+typedef struct {
+    uint32_t u32Base;                   /*!< First address of the region */
+    uint32_t u32End;                    /*!< Address after the region */
+    uint32_t u32Top;                    /*!< First address not allocated by the arena */
+} stc_dmc_mem_region_t;
+
+/**
+ * @brief Fixed size block pool structure definition
+ * @note  The members are private to the driver.
+ */
+typedef struct {
+    void *pvFree;                       /*!< First free block, each free block holds the next one */
+    uint32_t u32Base;                   /*!< First block */
+    uint32_t u32End;                    /*!< Address after the last block */
+    uint32_t u32BlkSize;                /*!< Block size in bytes */
+    uint32_t u32FreeNum;                /*!< Free blocks */
+    uint32_t u32MinFreeNum;             /*!< Lowest number of free blocks seen */
+} stc_dmc_mem_pool_t;
+
+/**
+ * @brief Memory test configuration structure definition
+ */
+typedef struct {
+    uint32_t u32Offset;                 /*!< Offset of the window of the march test in the region, a multiple of 4 */
+    uint32_t u32Size;                   /*!< Size of the window of the march test, a multiple of 4, 0 for the rest
+                                             of the region */
+    en_functional_state_t enBusTest;    /*!< Data and address bus test over the whole region */
+} stc_dmc_mem_test_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup DMC_MEM_Global_Macros DMC_MEM Global Macros
+ * @{
+ */
+#define DMC_MEM_POOL_ALIGN              (8UL)       /*!< Alignment of the pool blocks */
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup DMC_MEM_Global_Functions
+ * @{
+ */
+int32_t DMC_MEM_RegionInit(stc_dmc_mem_region_t *pstcRegion, uint32_t u32Base, uint32_t u32Size);
+int32_t DMC_MEM_RegionInitChip(stc_dmc_mem_region_t *pstcRegion, uint32_t u32Chip, uint32_t u32ChipSize);
+
+void *DMC_MEM_ArenaAlloc(stc_dmc_mem_region_t *pstcRegion, uint32_t u32Size, uint32_t u32Align);
+uint32_t DMC_MEM_ArenaMark(const stc_dmc_mem_region_t *pstcRegion);
+int32_t DMC_MEM_ArenaReset(stc_dmc_mem_region_t *pstcRegion, uint32_t u32Mark);
+uint32_t DMC_MEM_ArenaGetFree(const stc_dmc_mem_region_t *pstcRegion);
+
+int32_t DMC_MEM_PoolInit(stc_dmc_mem_pool_t *pstcPool, stc_dmc_mem_region_t *pstcRegion,
+                         uint32_t u32BlkSize, uint32_t u32BlkNum);
+void *DMC_MEM_PoolAlloc(stc_dmc_mem_pool_t *pstcPool);
+int32_t DMC_MEM_PoolFree(stc_dmc_mem_pool_t *pstcPool, void *pvBlk);
+uint32_t DMC_MEM_PoolGetFree(const stc_dmc_mem_pool_t *pstcPool);
+
+int32_t DMC_MEM_TestStructInit(stc_dmc_mem_test_t *pstcTest);
+int32_t DMC_MEM_Test(const stc_dmc_mem_region_t *pstcRegion, const stc_dmc_mem_test_t *pstcTest,
+                     uint32_t *pu32FailAddr);
+
+/**
+ * @}
+ */
+
+#endif /* LL_DMC_MEM_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __HC32_LL_DMC_MEM_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
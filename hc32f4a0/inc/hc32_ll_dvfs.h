@@ -0,0 +1,177 @@
+/**
+ *******************************************************************************
+ * @file  hc32_ll_dvfs.h
+ * @brief This file contains all the functions prototypes of the dynamic
+ *        frequency scaling driver library.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       CDT             First version
+                                    Notify the peripherals through the CLK notifiers, reject a source at two frequencies
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2025, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+#ifndef __HC32_LL_DVFS_H__
+#define __HC32_LL_DVFS_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ll_def.h"
+#include "hc32_ll_clk.h"
+
+#include "hc32f4xx.h"
+#include "hc32f4xx_conf.h"
+
+/**
+ * @addtogroup LL_Driver
+ * @{
+ */
+
+/**
+ * @addtogroup LL_DVFS
+ * @{
+ */
+
+#if (LL_DVFS_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup DVFS_Global_Macros DVFS Global Macros
+ * @{
+ */
+
+/**
+ * @defgroup DVFS_Power_Mode DVFS Power Mode
+ * @{
+ */
+#define DVFS_PWR_HIGH_SPEED             (0U)        /*!< High speed mode */
+#define DVFS_PWR_ULOW_SPEED             (1U)        /*!< Ultra low speed mode, see PWC_HighSpeedToLowSpeed() */
+/**
+ * @}
+ */
+
+/**
+ * @defgroup DVFS_Step DVFS Transition Step
+ * @{
+ */
+#define DVFS_STEP_HIGH_SPEED            (0U)        /*!< PWC_LowSpeedToHighSpeed() */
+#define DVFS_STEP_WAIT_RAISE            (1U)        /*!< Raise the wait cycles to the larger of both points */
+#define DVFS_STEP_CLK_DIV               (2U)        /*!< CLK_SetClockDiv() */
+#define DVFS_STEP_CLK_SRC               (3U)        /*!< CLK_SetSysClockSrc() */
+#define DVFS_STEP_WAIT_FINAL            (4U)        /*!< Set the wait cycles of the target point */
+#define DVFS_STEP_ULOW_SPEED            (5U)        /*!< PWC_HighSpeedToLowSpeed() */
+#define DVFS_STEP_MAX                   (6U)        /*!< Largest number of steps of a transition */
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup DVFS_Global_Types DVFS Global Types
+ * @{
+ */
+
+/**
+ * @brief DVFS operating point structure definition
+ */
+typedef struct {
+    uint8_t u8SysClockSrc;              /*!< System clock source, a value of @ref CLK_System_Clock_Source,
+                                             the source is kept running by the user */
+    uint32_t u32SysclkFreq;             /*!< System clock frequency in Hz, the same for all points of a source */
+    uint32_t u32ClockDiv;               /*!< Dividers of CLK_BUS_CLK_ALL, an OR of @ref CLK_Clock_Divider values */
+    uint32_t u32EfmWait;                /*!< EFM read wait cycle, a value of @ref EFM_Wait_Cycle */
+    uint32_t u32SramhWait;              /*!< SRAMH access wait cycle, a value of @ref SRAM_Access_Wait_Cycle */
+    uint32_t u32SramWait;               /*!< SRAM123, SRAM4 and SRAMB access wait cycle,
+                                             a value of @ref SRAM_Access_Wait_Cycle */
+    uint16_t u16GpioWait;               /*!< GPIO read wait cycle, a value of @ref GPIO_ReadCycle_Sel */
+    uint8_t u8PowerMode;                /*!< Power mode, a value of @ref DVFS_Power_Mode */
+} stc_dvfs_opp_t;
+
+/**
+ * @brief DVFS transition plan structure definition
+ */
+typedef struct {
+    uint8_t au8Step[DVFS_STEP_MAX];     /*!< Steps in order, values of @ref DVFS_Step */
+    uint8_t u8StepNum;                  /*!< Number of steps */
+} stc_dvfs_plan_t;
+
+/**
+ * @brief DVFS manager structure definition
+ * @note  The members are private to the driver.
+ */
+typedef struct {
+    const stc_dvfs_opp_t *pstcOpp;      /*!< Operating point table */
+    uint8_t u8OppNum;                   /*!< Number of operating points */
+    uint8_t u8Cur;                      /*!< Current operating point */
+    uint32_t u32LastNs;                 /*!< Latency of the last transition */
+    uint32_t u32MaxNs;                  /*!< Largest latency of a transition */
+} stc_dvfs_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup DVFS_Global_Functions
+ * @{
+ */
+int32_t DVFS_Init(stc_dvfs_t *pstcDvfs, const stc_dvfs_opp_t *pstcOpp, uint8_t u8OppNum, uint8_t u8Cur);
+
+int32_t DVFS_Plan(const stc_dvfs_opp_t *pstcFrom, const stc_dvfs_opp_t *pstcTo, stc_dvfs_plan_t *pstcPlan);
+int32_t DVFS_SetOpp(stc_dvfs_t *pstcDvfs, uint8_t u8Opp);
+uint8_t DVFS_GetOpp(const stc_dvfs_t *pstcDvfs);
+void DVFS_GetLatency(const stc_dvfs_t *pstcDvfs, uint32_t *pu32LastNs, uint32_t *pu32MaxNs);
+
+/**
+ * @}
+ */
+
+#endif /* LL_DVFS_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __HC32_LL_DVFS_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
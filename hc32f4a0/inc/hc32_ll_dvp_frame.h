@@ -0,0 +1,202 @@
+/**
+ *******************************************************************************
+ * @file  hc32_ll_dvp_frame.h
+ * @brief This file contains all the functions prototypes of the DVP frame
+ *        pipeline driver library.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2025, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+#ifndef __HC32_LL_DVP_FRAME_H__
+#define __HC32_LL_DVP_FRAME_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ll_def.h"
+#include "hc32_ll_dma.h"
+#include "hc32_ll_dvp.h"
+
+#include "hc32f4xx.h"
+#include "hc32f4xx_conf.h"
+
+/**
+ * @addtogroup LL_Driver
+ * @{
+ */
+
+/**
+ * @addtogroup LL_DVP_FRAME
+ * @{
+ */
+
+#if (LL_DVP_FRAME_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup DVP_FRAME_Global_Macros DVP_FRAME Global Macros
+ * @{
+ */
+
+#define DVP_FRAME_BUF_MAX               (4U)        /*!< Maximum number of frame buffers */
+#define DVP_FRAME_SEG_MAX               (4U)        /*!< Maximum number of DMA descriptors per frame buffer */
+#define DVP_FRAME_SEG_WORDS             (0xFFFFUL)  /*!< Words moved by one DMA descriptor */
+
+/**
+ * @defgroup DVP_FRAME_Mode DVP_FRAME Mode
+ * @{
+ */
+#define DVP_FRAME_MD_RAW                (0U)    /*!< Fixed size frames, checked against the line and byte counts */
+#define DVP_FRAME_MD_JPEG               (1U)    /*!< Variable size frames, delimited by the SOI and EOI markers */
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup DVP_FRAME_Global_Types DVP_FRAME Global Types
+ * @{
+ */
+
+typedef struct stc_dvp_frame_pipe stc_dvp_frame_pipe_t;
+
+/**
+ * @brief DVP frame ready callback
+ * @param [in] pstcPipe                 Pipeline of the event.
+ * @param [in] pvArg                    Argument given in @ref stc_dvp_frame_init_t.
+ */
+typedef void (*func_ptr_dvp_frame_t)(stc_dvp_frame_pipe_t *pstcPipe, void *pvArg);
+
+/**
+ * @brief DVP frame structure definition
+ */
+typedef struct {
+    void *pvBuf;                        /*!< Frame data, owned by the consumer until DVP_FRAME_Release() */
+    uint32_t u32Len;                    /*!< Frame size in bytes */
+    uint32_t u32Seq;                    /*!< Frame sequence number, gaps are dropped frames */
+} stc_dvp_frame_t;
+
+/**
+ * @brief DVP frame pipeline initialization structure definition
+ */
+typedef struct {
+    CM_DMA_TypeDef *pstcDmaUnit;        /*!< DMA unit, it must be enabled by DMA_Cmd() */
+    uint8_t u8DmaCh;                    /*!< DMA channel reading the DVP */
+    uint32_t u32TrigTarget;             /*!< AOS target of u8DmaCh, a value of @ref AOS_Target_Select */
+    en_event_src_t enEvtSrc;            /*!< DVP DMA request event, EVT_SRC_DVP_DMAREQ */
+    uint8_t u8Mode;                     /*!< Frame mode, a value of @ref DVP_FRAME_Mode */
+    uint8_t u8BufNum;                   /*!< Number of frame buffers, 2 ~ @ref DVP_FRAME_BUF_MAX */
+    void *apvBuf[DVP_FRAME_BUF_MAX];    /*!< Frame buffers, word aligned, in SRAM or in SDRAM */
+    uint32_t u32BufSize;                /*!< Size of each frame buffer in bytes, a multiple of 4 */
+    uint32_t u32Lines;                  /*!< Raw mode: lines per frame, see DVP_FRAME_CalcGeometry() */
+    uint32_t u32LineBytes;              /*!< Raw mode: bytes per line, see DVP_FRAME_CalcGeometry() */
+    func_ptr_dvp_frame_t pfnCallback;   /*!< Frame ready callback, called in interrupt context */
+    void *pvArg;                        /*!< Argument of the frame ready callback */
+} stc_dvp_frame_init_t;
+
+/**
+ * @brief DVP frame pipeline structure definition
+ * @note  The members are private to the driver.
+ */
+struct stc_dvp_frame_pipe {
+    CM_DMA_TypeDef *pstcDmaUnit;        /*!< DMA unit */
+    uint8_t u8DmaCh;                    /*!< DMA channel */
+    uint8_t u8Mode;                     /*!< Frame mode */
+    uint8_t u8BufNum;                   /*!< Number of frame buffers */
+    uint8_t u8Fill;                     /*!< Buffer written by the DMA */
+    uint8_t u8FrameErr;                 /*!< FIFO or sync error during the current frame */
+    uint8_t u8Run;                      /*!< Capture started */
+    void *apvBuf[DVP_FRAME_BUF_MAX];    /*!< Frame buffers */
+    uint8_t au8State[DVP_FRAME_BUF_MAX];    /*!< Buffer states */
+    uint32_t au32Len[DVP_FRAME_BUF_MAX];    /*!< Frame sizes of the ready buffers */
+    uint32_t au32Seq[DVP_FRAME_BUF_MAX];    /*!< Sequence numbers of the ready buffers */
+    uint32_t u32BufSize;                /*!< Size of each frame buffer */
+    uint32_t u32Lines;                  /*!< Expected lines per raw frame */
+    uint32_t u32FrameBytes;             /*!< Expected bytes per raw frame */
+    uint32_t u32LineCnt;                /*!< Lines of the current frame */
+    uint32_t u32Seq;                    /*!< Sequence number of the current frame */
+    uint32_t u32DropCnt;                /*!< Frames dropped on consumer stall */
+    uint32_t u32ErrCnt;                 /*!< Frames dropped as incomplete or corrupted */
+    func_ptr_dvp_frame_t pfnCallback;   /*!< Frame ready callback */
+    void *pvArg;                        /*!< Argument of the frame ready callback */
+    stc_dma_llp_descriptor_t astcDesc[DVP_FRAME_BUF_MAX][DVP_FRAME_SEG_MAX];    /*!< DMA descriptors */
+};
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup DVP_FRAME_Global_Functions
+ * @{
+ */
+int32_t DVP_FRAME_StructInit(stc_dvp_frame_init_t *pstcFrameInit);
+int32_t DVP_FRAME_Init(stc_dvp_frame_pipe_t *pstcPipe, const stc_dvp_frame_init_t *pstcFrameInit);
+int32_t DVP_FRAME_Start(stc_dvp_frame_pipe_t *pstcPipe);
+void DVP_FRAME_Stop(stc_dvp_frame_pipe_t *pstcPipe);
+
+int32_t DVP_FRAME_Get(stc_dvp_frame_pipe_t *pstcPipe, stc_dvp_frame_t *pstcFrame);
+int32_t DVP_FRAME_Release(stc_dvp_frame_pipe_t *pstcPipe, const void *pvBuf);
+void DVP_FRAME_GetStats(const stc_dvp_frame_pipe_t *pstcPipe, uint32_t *pu32DropCnt, uint32_t *pu32ErrCnt);
+
+void DVP_FRAME_IrqHandler(stc_dvp_frame_pipe_t *pstcPipe);
+
+int32_t DVP_FRAME_CalcGeometry(uint32_t u32SrcLines, uint32_t u32SrcClocks, uint32_t u32DataWidth,
+                               const stc_dvp_crop_window_config_t *pstcCrop,
+                               uint32_t *pu32Lines, uint32_t *pu32LineBytes);
+
+/**
+ * @}
+ */
+
+#endif /* LL_DVP_FRAME_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __HC32_LL_DVP_FRAME_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,196 @@
+/**
+ *******************************************************************************
+ * @file  hc32_ll_fmac_block.h
+ * @brief This file contains all the functions prototypes of the FMAC block
+ *        FIR filtering driver library.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2025, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+#ifndef __HC32_LL_FMAC_BLOCK_H__
+#define __HC32_LL_FMAC_BLOCK_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ll_def.h"
+#include "hc32_ll_dma.h"
+
+#include "hc32f4xx.h"
+#include "hc32f4xx_conf.h"
+
+/**
+ * @addtogroup LL_Driver
+ * @{
+ */
+
+/**
+ * @addtogroup LL_FMAC_BLOCK
+ * @{
+ */
+
+#if (LL_FMAC_BLOCK_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup FMAC_BLOCK_Global_Macros FMAC_BLOCK Global Macros
+ * @{
+ */
+
+/**
+ * @defgroup FMAC_BLOCK_Filter_Length FMAC_BLOCK Filter Length
+ * @{
+ */
+#define FMAC_BLOCK_UNIT_TAPS            (17U)       /*!< Taps of one FMAC unit, FMAC_FIR_STAGE_16 */
+#define FMAC_BLOCK_UNIT_MAX             (4U)        /*!< FMAC units which can be chained */
+#define FMAC_BLOCK_TAPS_MAX             (FMAC_BLOCK_UNIT_TAPS * FMAC_BLOCK_UNIT_MAX)
+#define FMAC_BLOCK_HIST_MAX             (FMAC_BLOCK_TAPS_MAX - FMAC_BLOCK_UNIT_TAPS)
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup FMAC_BLOCK_Global_Types FMAC_BLOCK Global Types
+ * @{
+ */
+
+typedef struct stc_fmac_block stc_fmac_block_t;
+
+/**
+ * @brief FMAC block completion callback
+ * @param [in] pstcBlock                Filter of the event.
+ * @param [in] pi32Out                  Output array given to FMAC_BLOCK_ProcessDma().
+ * @param [in] u32Len                   Number of output samples.
+ * @param [in] pvArg                    Argument given in @ref stc_fmac_block_init_t.
+ */
+typedef void (*func_ptr_fmac_block_t)(stc_fmac_block_t *pstcBlock, int32_t *pi32Out, uint32_t u32Len,
+                                      void *pvArg);
+
+/**
+ * @brief FMAC coefficient set structure definition
+ * @note  Built once by FMAC_BLOCK_CoefSetInit() in the register layout, so that switching
+ *        filters is a plain register copy.
+ */
+typedef struct {
+    uint32_t u32Taps;                   /*!< Number of taps, 1 ~ FMAC_BLOCK_TAPS_MAX */
+    uint32_t u32Shift;                  /*!< Result right shift, a value of @ref FMAC_Filter_Shift */
+    uint32_t au32Cor[FMAC_BLOCK_UNIT_MAX][FMAC_BLOCK_UNIT_TAPS];   /*!< COR registers of each unit */
+} stc_fmac_coef_set_t;
+
+/**
+ * @brief FMAC block initialization structure definition
+ */
+typedef struct {
+    CM_FMAC_TypeDef *apstcUnit[FMAC_BLOCK_UNIT_MAX];    /*!< Units in chain order, the first one runs the first
+                                                             taps, NULL terminated if less than FMAC_BLOCK_UNIT_MAX */
+    CM_DMA_TypeDef *pstcDmaUnit;        /*!< DMA unit of FMAC_BLOCK_ProcessDma(), NULL if not used.
+                                             It must be enabled by DMA_Cmd() */
+    uint8_t u8OutCh;                    /*!< DMA channel reading the results, lower number than u8InCh so
+                                             that it is served first */
+    uint8_t u8InCh;                     /*!< DMA channel writing the inputs */
+    uint32_t u32OutTrigTarget;          /*!< AOS target of u8OutCh, a value of @ref AOS_Target_Select */
+    uint32_t u32InTrigTarget;           /*!< AOS target of u8InCh, a value of @ref AOS_Target_Select */
+    en_event_src_t enEvtSrc;            /*!< Result ready event of the first unit */
+    func_ptr_fmac_block_t pfnCallback;  /*!< Completion callback of FMAC_BLOCK_ProcessDma(), called in
+                                             interrupt context */
+    void *pvArg;                        /*!< Argument of the completion callback */
+} stc_fmac_block_init_t;
+
+/**
+ * @brief FMAC block structure definition
+ * @note  The members are private to the driver.
+ */
+struct stc_fmac_block {
+    CM_FMAC_TypeDef *apstcUnit[FMAC_BLOCK_UNIT_MAX];    /*!< Chained units */
+    uint8_t u8UnitNum;                                  /*!< Number of units */
+    uint8_t u8UsedNum;                                  /*!< Units used by the coefficient set */
+    const stc_fmac_coef_set_t *pstcCoef;                /*!< Loaded coefficient set */
+    CM_DMA_TypeDef *pstcDmaUnit;                        /*!< DMA unit */
+    uint8_t u8OutCh;                                    /*!< Result DMA channel */
+    uint8_t u8InCh;                                     /*!< Input DMA channel */
+    func_ptr_fmac_block_t pfnCallback;                  /*!< Completion callback */
+    void *pvArg;                                        /*!< Argument of the completion callback */
+    int32_t *pi32Out;                                   /*!< Output of the DMA block */
+    uint32_t u32Len;                                    /*!< Length of the DMA block */
+    uint8_t u8Busy;                                     /*!< DMA block in progress */
+    int16_t ai16Hist[FMAC_BLOCK_HIST_MAX];              /*!< Last inputs, oldest first, feeding the
+                                                             delayed units of the chain */
+};
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup FMAC_BLOCK_Global_Functions
+ * @{
+ */
+int32_t FMAC_BLOCK_CoefSetInit(stc_fmac_coef_set_t *pstcCoef, const int16_t *pi16Coef, uint32_t u32Taps,
+                               uint32_t u32Shift);
+int32_t FMAC_BLOCK_StructInit(stc_fmac_block_init_t *pstcBlockInit);
+int32_t FMAC_BLOCK_Init(stc_fmac_block_t *pstcBlock, const stc_fmac_block_init_t *pstcBlockInit);
+int32_t FMAC_BLOCK_LoadCoef(stc_fmac_block_t *pstcBlock, const stc_fmac_coef_set_t *pstcCoef);
+int32_t FMAC_BLOCK_Process(stc_fmac_block_t *pstcBlock, const int16_t *pi16In, int32_t *pi32Out, uint32_t u32Len);
+int32_t FMAC_BLOCK_ProcessDma(stc_fmac_block_t *pstcBlock, const int16_t *pi16In, int32_t *pi32Out,
+                              uint32_t u32Len);
+void FMAC_BLOCK_DmaIrqHandler(stc_fmac_block_t *pstcBlock);
+
+int32_t FMAC_BLOCK_Reference(const stc_fmac_coef_set_t *pstcCoef, int16_t *pi16State, const int16_t *pi16In,
+                             int32_t *pi32Out, uint32_t u32Len);
+
+/**
+ * @}
+ */
+
+#endif /* LL_FMAC_BLOCK_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __HC32_LL_FMAC_BLOCK_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,173 @@
+/**
+ *******************************************************************************
+ * @file  hc32_ll_hrpwm_duty.h
+ * @brief This file contains all the functions prototypes of the HRPWM
+ *        high resolution duty driver library.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2025, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+#ifndef __HC32_LL_HRPWM_DUTY_H__
+#define __HC32_LL_HRPWM_DUTY_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ll_def.h"
+
+#include "hc32f4xx.h"
+#include "hc32f4xx_conf.h"
+
+/**
+ * @addtogroup LL_Driver
+ * @{
+ */
+
+/**
+ * @addtogroup LL_HRPWM_DUTY
+ * @{
+ */
+
+#if (LL_HRPWM_DUTY_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup HRPWM_DUTY_Global_Macros HRPWM_DUTY Global Macros
+ * @{
+ */
+
+/**
+ * @defgroup HRPWM_DUTY_Edge HRPWM_DUTY Edge
+ * @{
+ */
+#define HRPWM_DUTY_EDGE_POS             (0U)        /*!< Delay the rising edge */
+#define HRPWM_DUTY_EDGE_NEG             (1U)        /*!< Delay the falling edge */
+/**
+ * @}
+ */
+
+#define HRPWM_DUTY_FRAC_ONE             (0x10000UL) /*!< One timer count in the fractional duty */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup HRPWM_DUTY_Global_Types HRPWM_DUTY Global Types
+ * @{
+ */
+
+/**
+ * @brief HRPWM calibration cache structure definition
+ * @note  The members are private to the driver.
+ */
+typedef struct {
+    uint32_t u32Unit;                   /*!< Calibration unit */
+    uint8_t u8Code;                     /*!< Delay elements per PCLK0 cycle */
+    uint8_t u8Running;                  /*!< Calibration in progress */
+    int32_t i32Temp;                    /*!< Temperature of the last calibration */
+    int32_t i32TempDelta;               /*!< Temperature change starting a calibration */
+    uint32_t u32Polls;                  /*!< Polls since the last calibration or the start of the running one */
+    uint32_t u32PollPeriod;             /*!< Polls between two calibrations, 0 for temperature only */
+    __IO uint32_t u32Gen;               /*!< Changed by each new code */
+} stc_hrpwm_duty_calib_t;
+
+/**
+ * @brief HRPWM duty channel initialization structure definition
+ */
+typedef struct {
+    CM_TMR6_TypeDef *TMR6x;             /*!< TMR6 unit of the channel, with single buffered compare */
+    uint32_t u32TmrCh;                  /*!< TMR6_CH_A or TMR6_CH_B */
+    uint32_t u32HrCh;                   /*!< HRPWM channel of the output, HRPWM_CH_MIN to HRPWM_CH_MAX */
+    uint8_t u8Edge;                     /*!< Edge moved by the fraction, a value of @ref HRPWM_DUTY_Edge */
+    uint32_t u32ClockFreq;              /*!< Count frequency of TMR6x in Hz, PCLK0 */
+    stc_hrpwm_duty_calib_t *pstcCalib;  /*!< Calibration of the channel */
+} stc_hrpwm_duty_init_t;
+
+/**
+ * @brief HRPWM duty channel structure definition
+ * @note  The members are private to the driver.
+ */
+typedef struct {
+    CM_TMR6_TypeDef *TMR6x;             /*!< TMR6 unit */
+    uint32_t u32CmpBufIdx;              /*!< Compare buffer register of the channel */
+    uint32_t u32HrCh;                   /*!< HRPWM channel */
+    uint8_t u8Edge;                     /*!< Edge moved */
+    uint32_t u32ClockFreq;              /*!< Count frequency */
+    stc_hrpwm_duty_calib_t *pstcCalib;  /*!< Calibration */
+    uint32_t u32Frac;                   /*!< Fraction of the staged duty, in 1/65536 count */
+    uint32_t u32Gen;                    /*!< Calibration of the applied code */
+    uint8_t u8Pending;                  /*!< Code to apply at the next transfer */
+} stc_hrpwm_duty_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup HRPWM_DUTY_Global_Functions
+ * @{
+ */
+int32_t HRPWM_DUTY_CalibInit(stc_hrpwm_duty_calib_t *pstcCalib, uint32_t u32Unit, int32_t i32Temp,
+                             int32_t i32TempDelta, uint32_t u32PollPeriod);
+int32_t HRPWM_DUTY_CalibPoll(stc_hrpwm_duty_calib_t *pstcCalib, int32_t i32Temp);
+
+int32_t HRPWM_DUTY_StructInit(stc_hrpwm_duty_init_t *pstcDutyInit);
+int32_t HRPWM_DUTY_Init(stc_hrpwm_duty_t *pstcDuty, const stc_hrpwm_duty_init_t *pstcDutyInit);
+
+void HRPWM_DUTY_SetFrac(stc_hrpwm_duty_t *pstcDuty, uint32_t u32Count, uint32_t u32Frac);
+void HRPWM_DUTY_SetPs(stc_hrpwm_duty_t *pstcDuty, uint32_t u32Ps);
+void HRPWM_DUTY_Apply(stc_hrpwm_duty_t *pstcDuty);
+
+/**
+ * @}
+ */
+
+#endif /* LL_HRPWM_DUTY_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __HC32_LL_HRPWM_DUTY_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
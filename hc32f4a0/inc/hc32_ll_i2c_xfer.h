@@ -0,0 +1,267 @@
+/**
+ *******************************************************************************
+ * @file  hc32_ll_i2c_xfer.h
+ * @brief This file contains all the functions prototypes of the interrupt
+ *        driven I2C transaction driver library.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       CDT             First version
+                                    Added DMA payloads and register read coalescing
+                                    Fixed double start on resubmission and single byte read ACK
+                                    Added arbitration loss retries
+                                    Waited for the bus after a lost arbitration from the stop interrupt
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2025, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+#ifndef __HC32_LL_I2C_XFER_H__
+#define __HC32_LL_I2C_XFER_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ll_def.h"
+
+#include "hc32f4xx.h"
+#include "hc32f4xx_conf.h"
+
+/**
+ * @addtogroup LL_Driver
+ * @{
+ */
+
+/**
+ * @addtogroup LL_I2C_XFER
+ * @{
+ */
+
+#if (LL_I2C_XFER_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup I2C_XFER_Global_Types I2C_XFER Global Types
+ * @{
+ */
+
+/**
+ * @brief I2C transaction structure definition
+ * @note  A transaction writes u16TxLen bytes, then reads u16RxLen bytes after a repeated start.
+ *        Either length may be 0, both 0 only addresses the device. The structure is owned by the
+ *        application and must stay valid until its callback has been called.
+ */
+typedef struct stc_i2c_xfer {
+    struct stc_i2c_xfer *pstcNext;      /*!< Private: next transaction in the queue */
+    uint16_t u16Addr;                   /*!< 7-bit slave address */
+    const uint8_t *pu8TxBuf;            /*!< Data to be written */
+    uint16_t u16TxLen;                  /*!< Number of bytes to be written */
+    uint8_t *pu8RxBuf;                  /*!< Buffer of the data to be read */
+    uint16_t u16RxLen;                  /*!< Number of bytes to be read */
+    int32_t i32Result;                  /*!< Result of the transaction, valid in the callback:
+                                             - LL_OK:          Success
+                                             - LL_ERR:         NACK received
+                                             - LL_ERR_BUSY:    Arbitration lost I2C_XFER_ARLO_RETRY + 1 times,
+                                                               or SCL timeout while the winner held the bus
+                                             - LL_ERR_TIMEOUT: SCL timeout detected */
+    void (*pfnCallback)(struct stc_i2c_xfer *pstcXfer, void *pvArg);   /*!< Completion callback, called in interrupt context */
+    void *pvArg;                        /*!< Argument of the completion callback */
+} stc_i2c_xfer_t;
+
+/**
+ * @brief I2C transaction engine DMA configuration structure definition
+ * @note  Payloads of at least u16Threshold bytes are moved by DMA, paced by the I2C TXI and RXI
+ *        events through AOS. The TXI event must not be routed to the NVIC. The RXI interrupt is
+ *        masked in the NVIC while the DMA owns the receive data register.
+ */
+typedef struct {
+    CM_DMA_TypeDef *pstcDmaUnit;        /*!< DMA unit, it must be enabled by DMA_Cmd() */
+    uint8_t u8TxCh;                     /*!< DMA channel for the written payload */
+    uint8_t u8RxCh;                     /*!< DMA channel for the read payload */
+    uint16_t u16Threshold;              /*!< Minimum payload moved by DMA, values below 3 are taken as 3 */
+    uint32_t u32TxTrigTarget;           /*!< AOS target of u8TxCh, a value of @ref AOS_Target_Select */
+    uint32_t u32RxTrigTarget;           /*!< AOS target of u8RxCh, a value of @ref AOS_Target_Select */
+    en_event_src_t enTxEvtSrc;          /*!< TXI event source of the I2C unit */
+    en_event_src_t enRxEvtSrc;          /*!< RXI event source of the I2C unit */
+    IRQn_Type enRxIrqn;                 /*!< IRQ number the RXI interrupt of the I2C unit is routed to */
+} stc_i2c_xfer_dma_t;
+
+/**
+ * @brief I2C transaction engine handle structure definition
+ * @note  One handle per I2C unit, the members are private to the driver.
+ */
+typedef struct {
+    CM_I2C_TypeDef *pstcUnit;           /*!< I2C unit */
+    stc_i2c_xfer_t *pstcHead;           /*!< Transaction in progress */
+    stc_i2c_xfer_t *pstcTail;           /*!< Last queued transaction */
+    const stc_i2c_xfer_dma_t *pstcDma;  /*!< DMA configuration, NULL if the payloads are moved by the CPU */
+    uint8_t u8State;                    /*!< State of the transaction in progress */
+    uint8_t u8Dir;                      /*!< Direction of the current segment */
+    uint8_t u8DmaDir;                   /*!< Direction of the DMA in progress, @ref I2C_XFER_DMA_NONE if none */
+    uint16_t u16Pos;                    /*!< Bytes done in the current segment */
+    int32_t i32Result;                  /*!< Result of the transaction in progress */
+    uint8_t u8Retry;                    /*!< Arbitration retries of the transaction in progress */
+    uint32_t u32ArloCount;              /*!< Statistics: arbitration losses */
+} stc_i2c_xfer_handle_t;
+
+/**
+ * @brief I2C register read request structure definition
+ * @note  Reads u16Len registers from u8Reg on, the device is expected to auto-increment the register
+ *        address on burst reads. The structure must stay valid until its callback has been called.
+ */
+typedef struct stc_i2c_reg_read {
+    struct stc_i2c_reg_read *pstcNext;  /*!< Private: next request in register order */
+    uint16_t u16Addr;                   /*!< 7-bit slave address */
+    uint8_t u8Reg;                      /*!< First register */
+    uint16_t u16Len;                    /*!< Number of registers */
+    uint8_t *pu8Buf;                    /*!< Buffer of the register values */
+    int32_t i32Result;                  /*!< Result of the burst serving the request, see @ref stc_i2c_xfer_t */
+    void (*pfnCallback)(struct stc_i2c_reg_read *pstcReq, void *pvArg);    /*!< Completion callback, called in interrupt context */
+    void *pvArg;                        /*!< Argument of the completion callback */
+} stc_i2c_reg_read_t;
+
+/**
+ * @brief I2C burst segment structure definition
+ * @note  One segment is one bus transaction serving one or more register read requests.
+ *        The members are private to the driver.
+ */
+typedef struct {
+    stc_i2c_xfer_t stcXfer;             /*!< Transaction of the burst */
+    void *pvBurst;                      /*!< Owner @ref stc_i2c_burst_t */
+    stc_i2c_reg_read_t *pstcReq;        /*!< First request served */
+    uint16_t u16ReqNum;                 /*!< Number of requests served */
+    uint8_t u8Reg;                      /*!< First register of the burst */
+} stc_i2c_burst_seg_t;
+
+/**
+ * @brief I2C register read coalescer structure definition
+ * @note  Pending requests of the same device are merged into one register burst when the registers
+ *        in between are at most u8MaxGap and the burst is at most u16MaxLen bytes. Merged bursts are
+ *        read into the staging pool and scattered back to the requests on completion.
+ */
+typedef struct {
+    stc_i2c_reg_read_t *pstcPending;    /*!< Pending requests sorted by address and register */
+    stc_i2c_burst_seg_t *pstcSeg;       /*!< Segment array */
+    uint16_t u16SegNum;                 /*!< Number of segments */
+    uint16_t u16PoolSize;               /*!< Size of the staging pool */
+    uint8_t *pu8Pool;                   /*!< Staging pool of merged bursts */
+    uint16_t u16MaxLen;                 /*!< Maximum burst length */
+    uint8_t u8MaxGap;                   /*!< Maximum number of unrequested registers read between two requests */
+    __IO uint16_t u16Outstanding;       /*!< Segments still on the bus */
+    uint32_t u32ReqCount;               /*!< Statistics: requests served */
+    uint32_t u32XferCount;              /*!< Statistics: bus transactions issued */
+} stc_i2c_burst_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup I2C_XFER_Global_Macros I2C_XFER Global Macros
+ * @{
+ */
+
+/**
+ * @defgroup I2C_XFER_Configuration I2C_XFER Configuration
+ * @note These values can be redefined in hc32f4xx_conf.h.
+ * @{
+ */
+/* Number of times a transaction is run again after a lost arbitration */
+#ifndef I2C_XFER_ARLO_RETRY
+#define I2C_XFER_ARLO_RETRY             (3U)
+#endif
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup I2C_XFER_Int I2C_XFER Interrupt Sources
+ * @brief    The interrupt sources used by the engine, all of them must call I2C_XFER_IrqHandler().
+ * @{
+ */
+#define I2C_XFER_INT                    (I2C_INT_START | I2C_INT_TX_CPLT | I2C_INT_RX_FULL | I2C_INT_STOP | \
+                                         I2C_INT_ARBITRATE_FAIL | I2C_INT_NACK | I2C_INT_TMOUTIE)
+/**
+ * @}
+ */
+
+/**
+ * @defgroup I2C_XFER_DMA_Dir I2C_XFER DMA Direction
+ * @{
+ */
+#define I2C_XFER_DMA_NONE               (0U)    /*!< No DMA in progress */
+#define I2C_XFER_DMA_TX                 (1U)    /*!< DMA writes the payload */
+#define I2C_XFER_DMA_RX                 (2U)    /*!< DMA reads the payload */
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup I2C_XFER_Global_Functions
+ * @{
+ */
+int32_t I2C_XFER_Init(stc_i2c_xfer_handle_t *pstcHandle, CM_I2C_TypeDef *I2Cx);
+int32_t I2C_XFER_Submit(stc_i2c_xfer_handle_t *pstcHandle, stc_i2c_xfer_t *pstcXfer);
+en_flag_status_t I2C_XFER_GetBusyStatus(const stc_i2c_xfer_handle_t *pstcHandle);
+void I2C_XFER_IrqHandler(stc_i2c_xfer_handle_t *pstcHandle);
+
+int32_t I2C_XFER_DmaConfig(stc_i2c_xfer_handle_t *pstcHandle, const stc_i2c_xfer_dma_t *pstcDma);
+void I2C_XFER_DmaIrqHandler(stc_i2c_xfer_handle_t *pstcHandle);
+
+int32_t I2C_XFER_BurstInit(stc_i2c_burst_t *pstcBurst, stc_i2c_burst_seg_t *pstcSeg, uint16_t u16SegNum,
+                           uint8_t *pu8Pool, uint16_t u16PoolSize, uint16_t u16MaxLen, uint8_t u8MaxGap);
+int32_t I2C_XFER_BurstAdd(stc_i2c_burst_t *pstcBurst, stc_i2c_reg_read_t *pstcReq);
+int32_t I2C_XFER_BurstFlush(stc_i2c_xfer_handle_t *pstcHandle, stc_i2c_burst_t *pstcBurst);
+
+/**
+ * @}
+ */
+
+#endif /* LL_I2C_XFER_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __HC32_LL_I2C_XFER_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
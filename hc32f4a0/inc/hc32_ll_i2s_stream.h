@@ -0,0 +1,188 @@
+/**
+ *******************************************************************************
+ * @file  hc32_ll_i2s_stream.h
+ * @brief This file contains all the functions prototypes of the I2S DMA
+ *        streaming driver library.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2025, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+#ifndef __HC32_LL_I2S_STREAM_H__
+#define __HC32_LL_I2S_STREAM_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ll_def.h"
+#include "hc32_ll_dma.h"
+
+#include "hc32f4xx.h"
+#include "hc32f4xx_conf.h"
+
+/**
+ * @addtogroup LL_Driver
+ * @{
+ */
+
+/**
+ * @addtogroup LL_I2S_STREAM
+ * @{
+ */
+
+#if (LL_I2S_STREAM_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup I2S_STREAM_Global_Types I2S_STREAM Global Types
+ * @{
+ */
+
+typedef struct stc_i2s_stream stc_i2s_stream_t;
+
+/**
+ * @brief I2S stream event callback
+ * @param [in] pstcStream               Stream of the event.
+ * @param [in] u32Event                 A value of @ref I2S_STREAM_Event.
+ * @param [in] pu32Buf                  Half buffer to be filled (TX) or consumed (RX), NULL for the error events.
+ * @param [in] u32Len                   Number of slots of pu32Buf.
+ * @param [in] pvArg                    Argument given in @ref stc_i2s_stream_init_t.
+ */
+typedef void (*func_ptr_i2s_stream_t)(stc_i2s_stream_t *pstcStream, uint32_t u32Event,
+                                      uint32_t *pu32Buf, uint32_t u32Len, void *pvArg);
+
+/**
+ * @brief I2S stream direction configuration structure definition
+ * @note  The buffer holds one 32-bit slot per sample word written to TXBUF or read from RXBUF,
+ *        and is split into two halves which the DMA plays in turn.
+ */
+typedef struct {
+    uint32_t *pu32Buf;                  /*!< Ping-pong buffer, NULL if the direction is not used */
+    uint32_t u32Len;                    /*!< Number of slots of the buffer, even and at most 2 * 0xFFFF */
+    uint8_t u8DmaCh;                    /*!< DMA channel of the direction */
+    uint32_t u32TrigTarget;             /*!< AOS target of u8DmaCh, a value of @ref AOS_Target_Select */
+    en_event_src_t enEvtSrc;            /*!< TXI or RXI event source of the I2S unit */
+} stc_i2s_stream_dir_t;
+
+/**
+ * @brief I2S stream initialization structure definition
+ */
+typedef struct {
+    CM_DMA_TypeDef *pstcDmaUnit;        /*!< DMA unit, it must be enabled by DMA_Cmd() */
+    stc_i2s_stream_dir_t stcTx;         /*!< Transmit direction */
+    stc_i2s_stream_dir_t stcRx;         /*!< Receive direction */
+    func_ptr_i2s_stream_t pfnCallback;  /*!< Event callback, called in interrupt context */
+    void *pvArg;                        /*!< Argument of the event callback */
+} stc_i2s_stream_init_t;
+
+/**
+ * @brief I2S stream structure definition
+ * @note  The members are private to the driver. The structure holds the DMA linked list
+ *        descriptors and must stay valid while the stream runs.
+ */
+struct stc_i2s_stream {
+    CM_I2S_TypeDef *pstcUnit;                   /*!< I2S unit */
+    CM_DMA_TypeDef *pstcDmaUnit;                /*!< DMA unit */
+    stc_i2s_stream_dir_t stcTx;                 /*!< Transmit direction */
+    stc_i2s_stream_dir_t stcRx;                 /*!< Receive direction */
+    func_ptr_i2s_stream_t pfnCallback;          /*!< Event callback */
+    void *pvArg;                                /*!< Argument of the event callback */
+    stc_dma_llp_descriptor_t astcTxDesc[2U];    /*!< Linked list of the transmit halves */
+    stc_dma_llp_descriptor_t astcRxDesc[2U];    /*!< Linked list of the receive halves */
+    uint8_t u8Running;                          /*!< Stream running */
+    uint32_t u32UnderrunCount;                  /*!< Statistics: transmit underruns recovered */
+    uint32_t u32OverrunCount;                   /*!< Statistics: receive overruns recovered */
+};
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup I2S_STREAM_Global_Macros I2S_STREAM Global Macros
+ * @{
+ */
+
+/**
+ * @defgroup I2S_STREAM_Event I2S_STREAM Event
+ * @{
+ */
+#define I2S_STREAM_EVT_TX_HALF          (0x01UL)    /*!< A transmit half is free to be filled */
+#define I2S_STREAM_EVT_RX_HALF          (0x02UL)    /*!< A receive half is ready to be consumed */
+#define I2S_STREAM_EVT_TX_UNDERRUN      (0x04UL)    /*!< Transmit underrun, the stream has been restarted */
+#define I2S_STREAM_EVT_RX_OVERRUN       (0x08UL)    /*!< Receive overrun, the stream has been restarted */
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup I2S_STREAM_Global_Functions
+ * @{
+ */
+int32_t I2S_STREAM_StructInit(stc_i2s_stream_init_t *pstcStreamInit);
+int32_t I2S_STREAM_Init(stc_i2s_stream_t *pstcStream, CM_I2S_TypeDef *I2Sx,
+                        const stc_i2s_stream_init_t *pstcStreamInit);
+int32_t I2S_STREAM_Start(stc_i2s_stream_t *pstcStream);
+void I2S_STREAM_Stop(stc_i2s_stream_t *pstcStream);
+
+void I2S_STREAM_DmaIrqHandler(stc_i2s_stream_t *pstcStream);
+void I2S_STREAM_ErrIrqHandler(stc_i2s_stream_t *pstcStream);
+
+void I2S_STREAM_Pack16(uint32_t *pu32Slot, const int16_t *pi16Pcm, uint32_t u32Len, uint32_t u32DataWidth);
+void I2S_STREAM_Unpack16(int16_t *pi16Pcm, const uint32_t *pu32Slot, uint32_t u32Len, uint32_t u32DataWidth);
+
+/**
+ * @}
+ */
+
+#endif /* LL_I2S_STREAM_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __HC32_LL_I2S_STREAM_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,124 @@
+/**
+ *******************************************************************************
+ * @file  hc32_ll_mau_batch.h
+ * @brief This file contains all the functions prototypes of the MAU batch
+ *        driver library.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2025, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+#ifndef __HC32_LL_MAU_BATCH_H__
+#define __HC32_LL_MAU_BATCH_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ll_def.h"
+
+#include "hc32f4xx.h"
+#include "hc32f4xx_conf.h"
+
+/**
+ * @addtogroup LL_Driver
+ * @{
+ */
+
+/**
+ * @addtogroup LL_MAU_BATCH
+ * @{
+ */
+
+#if (LL_MAU_BATCH_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup MAU_BATCH_Global_Macros MAU_BATCH Global Macros
+ * @{
+ */
+
+/**
+ * @defgroup MAU_BATCH_Angle_Index MAU_BATCH Angle Index
+ * @brief    Angles are indexes of @ref MAU_SIN_ANGIDX_TOTAL steps per turn, as MAU_Sin() takes them.
+ * @{
+ */
+#define MAU_BATCH_ANGIDX_MASK           (0xFFFU)
+#define MAU_BATCH_ANGIDX_QUARTER        (0x400U)    /*!< 90 degrees */
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup MAU_BATCH_Global_Functions
+ * @{
+ */
+void MAU_BATCH_Sin(CM_MAU_TypeDef *MAUx, const uint16_t *pu16AngleIdx, int16_t *pi16Sin, uint32_t u32Len);
+void MAU_BATCH_Cos(CM_MAU_TypeDef *MAUx, const uint16_t *pu16AngleIdx, int16_t *pi16Cos, uint32_t u32Len);
+void MAU_BATCH_SinCos(CM_MAU_TypeDef *MAUx, const uint16_t *pu16AngleIdx, int16_t *pi16Sin, int16_t *pi16Cos,
+                      uint32_t u32Len);
+int32_t MAU_BATCH_Sqrt(CM_MAU_TypeDef *MAUx, const uint32_t *pu32Radicand, uint32_t *pu32Root, uint32_t u32Len,
+                       uint8_t u8ShiftNum);
+int32_t MAU_BATCH_Polar(CM_MAU_TypeDef *MAUx, const int16_t *pi16X, const int16_t *pi16Y, uint32_t *pu32Mag,
+                        uint16_t *pu16AngleIdx, uint32_t u32Len);
+
+int16_t MAU_BATCH_SinLut(uint16_t u16AngleIdx);
+int16_t MAU_BATCH_CosLut(uint16_t u16AngleIdx);
+uint32_t MAU_BATCH_SqrtSw(uint32_t u32Radicand, uint8_t u8ShiftNum);
+uint16_t MAU_BATCH_Atan2(int16_t i16Y, int16_t i16X);
+
+/**
+ * @}
+ */
+
+#endif /* LL_MAU_BATCH_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __HC32_LL_MAU_BATCH_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,201 @@
+/**
+ *******************************************************************************
+ * @file  hc32_ll_smc_lcd.h
+ * @brief This file contains all the functions prototypes of the SMC LCD
+ *        framebuffer flush driver library.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       CDT             First version
+                                    Removed enEvtSrc from stc_smc_lcd_init_t
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2025, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+#ifndef __HC32_LL_SMC_LCD_H__
+#define __HC32_LL_SMC_LCD_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ll_def.h"
+#include "hc32_ll_dma.h"
+
+#include "hc32f4xx.h"
+#include "hc32f4xx_conf.h"
+
+/**
+ * @addtogroup LL_Driver
+ * @{
+ */
+
+/**
+ * @addtogroup LL_SMC_LCD
+ * @{
+ */
+
+#if (LL_SMC_LCD_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup SMC_LCD_Global_Macros SMC_LCD Global Macros
+ * @{
+ */
+
+#define SMC_LCD_RECT_MAX                (8U)        /*!< Dirty rectangles kept before merging */
+#define SMC_LCD_WIDTH_MAX               (1024U)     /*!< Widest panel, one row fits a DMA block */
+
+/**
+ * @defgroup SMC_LCD_Command SMC_LCD Command
+ * @brief    MIPI DCS commands used by default.
+ * @{
+ */
+#define SMC_LCD_CMD_COL_ADDR            (0x2AU)     /*!< Column address set */
+#define SMC_LCD_CMD_ROW_ADDR            (0x2BU)     /*!< Page address set */
+#define SMC_LCD_CMD_MEM_WRITE           (0x2CU)     /*!< Memory write */
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup SMC_LCD_Global_Types SMC_LCD Global Types
+ * @{
+ */
+
+typedef struct stc_smc_lcd stc_smc_lcd_t;
+
+/**
+ * @brief SMC LCD flush done callback
+ * @param [in] pstcLcd                  LCD of the event.
+ * @param [in] pvArg                    Argument given in @ref stc_smc_lcd_init_t.
+ */
+typedef void (*func_ptr_smc_lcd_t)(stc_smc_lcd_t *pstcLcd, void *pvArg);
+
+/**
+ * @brief SMC LCD rectangle structure definition
+ */
+typedef struct {
+    uint16_t u16X;                      /*!< Left column */
+    uint16_t u16Y;                      /*!< Top row */
+    uint16_t u16Width;                  /*!< Width in pixels */
+    uint16_t u16Height;                 /*!< Height in pixels */
+} stc_smc_lcd_rect_t;
+
+/**
+ * @brief SMC LCD initialization structure definition
+ */
+typedef struct {
+    uint32_t u32Chip;                   /*!< SMC chip of the LCD, a value of @ref EXMC_SMC_Chip */
+    uint32_t u32DataOffset;             /*!< Byte offset of the data address (RS high) from the chip start address */
+    uint16_t u16Width;                  /*!< Panel width, up to @ref SMC_LCD_WIDTH_MAX */
+    uint16_t u16Height;                 /*!< Panel height */
+    uint16_t u16ColAddrCmd;             /*!< Column address command, see @ref SMC_LCD_Command */
+    uint16_t u16RowAddrCmd;             /*!< Row address command, see @ref SMC_LCD_Command */
+    uint16_t u16MemWriteCmd;            /*!< Memory write command, see @ref SMC_LCD_Command */
+    CM_DMA_TypeDef *pstcDmaUnit;        /*!< DMA unit, it must be enabled by DMA_Cmd() */
+    uint8_t u8DmaCh;                    /*!< DMA channel writing the pixels, requested by DMA_MxChSWTrigger() */
+    uint32_t u32TrigTarget;             /*!< AOS target of u8DmaCh, a value of @ref AOS_Target_Select,
+                                             set to no event so that only the flush requests the channel */
+    func_ptr_smc_lcd_t pfnCallback;     /*!< Flush done callback, called in interrupt context */
+    void *pvArg;                        /*!< Argument of the flush done callback */
+} stc_smc_lcd_init_t;
+
+/**
+ * @brief SMC LCD structure definition
+ * @note  The members are private to the driver.
+ */
+struct stc_smc_lcd {
+    uint32_t u32CmdAddr;                /*!< Command address */
+    uint32_t u32DataAddr;               /*!< Data address */
+    uint16_t u16Width;                  /*!< Panel width */
+    uint16_t u16Height;                 /*!< Panel height */
+    uint16_t u16ColAddrCmd;             /*!< Column address command */
+    uint16_t u16RowAddrCmd;             /*!< Row address command */
+    uint16_t u16MemWriteCmd;            /*!< Memory write command */
+    CM_DMA_TypeDef *pstcDmaUnit;        /*!< DMA unit */
+    uint8_t u8DmaCh;                    /*!< DMA channel */
+    func_ptr_smc_lcd_t pfnCallback;     /*!< Flush done callback */
+    void *pvArg;                        /*!< Argument of the flush done callback */
+    stc_smc_lcd_rect_t astcDirty[SMC_LCD_RECT_MAX];    /*!< Rectangles to flush next */
+    uint8_t u8DirtyNum;                 /*!< Number of rectangles to flush next */
+    stc_smc_lcd_rect_t astcFlush[SMC_LCD_RECT_MAX];    /*!< Rectangles of the last flush */
+    uint8_t u8FlushNum;                 /*!< Number of rectangles of the last flush */
+    uint8_t u8FlushIdx;                 /*!< Rectangle being sent */
+    uint16_t u16Row;                    /*!< Next row of the rectangle being sent */
+    uint16_t u16Rows;                   /*!< Rows of the DMA chunk being sent */
+    const uint16_t *pu16Fb;             /*!< Framebuffer being sent */
+    __IO uint8_t u8Busy;                /*!< Flush running */
+};
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup SMC_LCD_Global_Functions
+ * @{
+ */
+int32_t SMC_LCD_StructInit(stc_smc_lcd_init_t *pstcLcdInit);
+int32_t SMC_LCD_Init(stc_smc_lcd_t *pstcLcd, const stc_smc_lcd_init_t *pstcLcdInit);
+
+void SMC_LCD_WriteCmd(const stc_smc_lcd_t *pstcLcd, uint16_t u16Cmd, const uint16_t *pu16Param, uint32_t u32Len);
+void SMC_LCD_Invalidate(stc_smc_lcd_t *pstcLcd, const stc_smc_lcd_rect_t *pstcRect);
+void SMC_LCD_InvalidateAll(stc_smc_lcd_t *pstcLcd);
+int32_t SMC_LCD_Flush(stc_smc_lcd_t *pstcLcd, const uint16_t *pu16Fb);
+en_flag_status_t SMC_LCD_GetBusyStatus(const stc_smc_lcd_t *pstcLcd);
+void SMC_LCD_CopyFlushed(const stc_smc_lcd_t *pstcLcd, uint16_t *pu16Dst, const uint16_t *pu16Src);
+
+void SMC_LCD_DmaIrqHandler(stc_smc_lcd_t *pstcLcd);
+
+/**
+ * @}
+ */
+
+#endif /* LL_SMC_LCD_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __HC32_LL_SMC_LCD_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,169 @@
+/**
+ *******************************************************************************
+ * @file  hc32_ll_swtmr.h
+ * @brief This file contains all the functions prototypes of the software timer
+ *        wheel driver library.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2025, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+#ifndef __HC32_LL_SWTMR_H__
+#define __HC32_LL_SWTMR_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ll_def.h"
+
+#include "hc32f4xx.h"
+#include "hc32f4xx_conf.h"
+
+/**
+ * @addtogroup LL_Driver
+ * @{
+ */
+
+/**
+ * @addtogroup LL_SWTMR
+ * @{
+ */
+
+#if (LL_SWTMR_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup SWTMR_Global_Types SWTMR Global Types
+ * @{
+ */
+
+/**
+ * @brief Software timer structure definition
+ * @note  The structure is owned by the application and must stay valid while the timer is started.
+ *        The list links are private to the driver.
+ */
+typedef struct stc_swtmr {
+    struct stc_swtmr *pstcNext;         /*!< Private: next timer in the same slot */
+    struct stc_swtmr *pstcPrev;         /*!< Private: previous timer in the same slot */
+    uint32_t u32Expires;                /*!< Private: expiry in wheel ticks */
+    uint16_t u16Slot;                   /*!< Private: slot of the timer */
+    uint32_t u32Period;                 /*!< Reload in wheel ticks, 0 for a one-shot timer */
+    void (*pfnCallback)(struct stc_swtmr *pstcTimer, void *pvArg);  /*!< Expiry callback */
+    void *pvArg;                        /*!< Argument of the expiry callback */
+} stc_swtmr_t;
+
+/**
+ * @brief Software timer wheel initialization structure definition
+ * @note  One wheel tick is one count of the TMR0 channel.
+ */
+typedef struct {
+    uint32_t u32ClockSrc;               /*!< Specifies the clock source of the TMR0 channel.
+                                             This parameter can be a value of @ref TMR0_Clock_Source
+                                             except TMR0_CLK_SRC_SPEC_EVT */
+    uint32_t u32ClockDiv;               /*!< Specifies the clock division of the TMR0 channel.
+                                             This parameter can be a value of @ref TMR0_Clock_Division */
+} stc_swtmr_init_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup SWTMR_Global_Macros SWTMR Global Macros
+ * @{
+ */
+
+/**
+ * @defgroup SWTMR_Configuration SWTMR Configuration
+ * @note These values can be redefined in hc32f4xx_conf.h.
+ * @{
+ */
+/* Minimum distance in counts between the running counter and a new compare value */
+#ifndef SWTMR_CLK_MARGIN
+#define SWTMR_CLK_MARGIN                (2UL)
+#endif
+/**
+ * @}
+ */
+
+/**
+ * @defgroup SWTMR_Max_Delay SWTMR Max Delay
+ * @{
+ */
+#define SWTMR_DELAY_MAX                 (0x7FFFFFFFUL)
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup SWTMR_Global_Functions
+ * @{
+ */
+int32_t SWTMR_StructInit(stc_swtmr_init_t *pstcSwtmrInit);
+int32_t SWTMR_Init(CM_TMR0_TypeDef *TMR0x, uint32_t u32Ch, const stc_swtmr_init_t *pstcSwtmrInit);
+void SWTMR_DeInit(void);
+
+void SWTMR_TimerInit(stc_swtmr_t *pstcTimer, void (*pfnCallback)(stc_swtmr_t *pstcTimer, void *pvArg),
+                     void *pvArg, uint32_t u32Period);
+int32_t SWTMR_Start(stc_swtmr_t *pstcTimer, uint32_t u32Delay);
+void SWTMR_Stop(stc_swtmr_t *pstcTimer);
+en_flag_status_t SWTMR_GetStatus(const stc_swtmr_t *pstcTimer);
+uint32_t SWTMR_GetTick(void);
+
+void SWTMR_IrqHandler(void);
+
+/**
+ * @}
+ */
+
+#endif /* LL_SWTMR_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __HC32_LL_SWTMR_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
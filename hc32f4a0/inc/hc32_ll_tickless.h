@@ -0,0 +1,171 @@
+/**
+ *******************************************************************************
+ * @file  hc32_ll_tickless.h
+ * @brief This file contains all the functions prototypes of the tickless time
+ *        base driver library.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2025, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+#ifndef __HC32_LL_TICKLESS_H__
+#define __HC32_LL_TICKLESS_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ll_def.h"
+
+#include "hc32f4xx.h"
+#include "hc32f4xx_conf.h"
+
+/**
+ * @addtogroup LL_Driver
+ * @{
+ */
+
+/**
+ * @addtogroup LL_TICKLESS
+ * @{
+ */
+
+#if (LL_TICKLESS_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup TICKLESS_Global_Types TICKLESS Global Types
+ * @{
+ */
+
+/**
+ * @brief Tickless time base initialization structure definition
+ */
+typedef struct {
+    uint32_t u32ClockSrc;               /*!< Specifies the clock source of the TMR0 channel.
+                                             This parameter can be a value of @ref TMR0_Clock_Source
+                                             except TMR0_CLK_SRC_SPEC_EVT */
+    uint32_t u32ClockDiv;               /*!< Specifies the clock division of the TMR0 channel.
+                                             This parameter can be a value of @ref TMR0_Clock_Division */
+    uint32_t u32ClockFreq;              /*!< Frequency in Hz of the selected clock source before division,
+                                             e.g. PCLK1 frequency, LRC or XTAL32 frequency */
+    func_ptr_t pfnAlarmCallback;        /*!< Called from TICKLESS_IrqHandler() when the alarm expires, can be NULL */
+} stc_tickless_init_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup TICKLESS_Global_Macros TICKLESS Global Macros
+ * @{
+ */
+
+/**
+ * @defgroup TICKLESS_Configuration TICKLESS Configuration
+ * @note These values can be redefined in hc32f4xx_conf.h.
+ * @{
+ */
+/* Replace the weak SysTick_xxx functions of the utility driver, so SysTick_Delay()
+   sleeps on the tickless time base instead of requiring a periodic SysTick interrupt.
+   Enable it only when TICKLESS_Init() is called before the first SysTick_xxx() call. */
+#ifndef TICKLESS_SYSTICK_REPLACE
+#define TICKLESS_SYSTICK_REPLACE        (DDL_OFF)
+#endif
+
+/* Minimum distance in counts between the running counter and a new compare value.
+   Asynchronous clock sources need more margin because register writes are synchronized. */
+#ifndef TICKLESS_SYNC_CLK_MARGIN
+#define TICKLESS_SYNC_CLK_MARGIN        (2UL)
+#endif
+
+#ifndef TICKLESS_ASYNC_CLK_MARGIN
+#define TICKLESS_ASYNC_CLK_MARGIN       (6UL)
+#endif
+/**
+ * @}
+ */
+
+/**
+ * @defgroup TICKLESS_Alarm_None TICKLESS Alarm None
+ * @{
+ */
+#define TICKLESS_ALARM_NONE             (0xFFFFFFFFFFFFFFFFULL)
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup TICKLESS_Global_Functions
+ * @{
+ */
+int32_t TICKLESS_StructInit(stc_tickless_init_t *pstcTicklessInit);
+int32_t TICKLESS_Init(CM_TMR0_TypeDef *TMR0x, uint32_t u32Ch, const stc_tickless_init_t *pstcTicklessInit);
+void TICKLESS_DeInit(void);
+
+uint64_t TICKLESS_GetTick(void);
+uint64_t TICKLESS_GetTimeUS(void);
+uint32_t TICKLESS_GetTickFreq(void);
+
+int32_t TICKLESS_SetAlarm(uint64_t u64Tick);
+void TICKLESS_CancelAlarm(void);
+
+void TICKLESS_DelayUS(uint32_t u32Count);
+void TICKLESS_DelayMS(uint32_t u32Count);
+
+void TICKLESS_IrqHandler(void);
+
+/**
+ * @}
+ */
+
+#endif /* LL_TICKLESS_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __HC32_LL_TICKLESS_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,151 @@
+/**
+ *******************************************************************************
+ * @file  hc32_ll_tmr4_svpwm.h
+ * @brief This file contains all the functions prototypes of the TMR4
+ *        space vector PWM driver library.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2025, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+#ifndef __HC32_LL_TMR4_SVPWM_H__
+#define __HC32_LL_TMR4_SVPWM_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ll_def.h"
+
+#include "hc32f4xx.h"
+#include "hc32f4xx_conf.h"
+
+/**
+ * @addtogroup LL_Driver
+ * @{
+ */
+
+/**
+ * @addtogroup LL_TMR4_SVPWM
+ * @{
+ */
+
+#if (LL_TMR4_SVPWM_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup TMR4_SVPWM_Global_Types TMR4_SVPWM Global Types
+ * @{
+ */
+
+/**
+ * @brief TMR4 SVPWM initialization structure definition
+ */
+typedef struct {
+    CM_TMR4_TypeDef *TMR4x;             /*!< TMR4 unit, in triangle count mode */
+    uint32_t u32EvtCh;                  /*!< EVT channel of the ADC trigger, a value of @ref TMR4_Event_Channel */
+    uint16_t u16DeadTime;               /*!< Dead time of the U/V/W couples in timer ticks, 0 to keep the
+                                             PDAR/PDBR values */
+    uint16_t u16SettleTicks;            /*!< Ringing after a switching edge (dead time excluded) in timer ticks */
+    uint16_t u16SampleTicks;            /*!< ADC sampling time in timer ticks */
+} stc_tmr4_svpwm_init_t;
+
+/**
+ * @brief TMR4 SVPWM structure definition
+ * @note  The members are private to the driver.
+ */
+typedef struct {
+    CM_TMR4_TypeDef *TMR4x;             /*!< TMR4 unit */
+    uint32_t u32EvtCh;                  /*!< EVT channel of the ADC trigger */
+    uint16_t u16Period;                 /*!< Peak value of the counter */
+    uint16_t u16Guard;                  /*!< Ticks kept from a switching edge to the sampling center */
+    uint16_t u16SampleHalf;             /*!< Half of the ADC sampling time */
+    uint16_t u16TrigCond;               /*!< EVT match condition programmed */
+} stc_tmr4_svpwm_t;
+
+/**
+ * @brief TMR4 SVPWM compare values structure definition
+ */
+typedef struct {
+    uint16_t au16Cmp[3];                /*!< Compare values of the U, V and W high channels */
+    uint16_t u16TrigCmp;                /*!< EVT compare value of the ADC trigger */
+    uint16_t u16TrigCond;               /*!< EVT match condition, TMR4_EVT_MATCH_CNT_UP or TMR4_EVT_MATCH_CNT_DOWN */
+    uint16_t u16QuietTicks;             /*!< Ticks from the sampling center to the nearest switching edge */
+    uint8_t u8Sector;                   /*!< Sector of the voltage vector, 1 to 6 */
+} stc_tmr4_svpwm_cmp_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup TMR4_SVPWM_Global_Macros TMR4_SVPWM Global Macros
+ * @{
+ */
+#define TMR4_SVPWM_Q15_ONE              (32768L)    /*!< 1.0 in Q15, the DC link voltage */
+#define TMR4_SVPWM_LINEAR_MAX           (18919L)    /*!< Longest vector of the linear range, 1/sqrt(3) in Q15 */
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup TMR4_SVPWM_Global_Functions
+ * @{
+ */
+int32_t TMR4_SVPWM_StructInit(stc_tmr4_svpwm_init_t *pstcSvpwmInit);
+int32_t TMR4_SVPWM_Init(stc_tmr4_svpwm_t *pstcSvpwm, const stc_tmr4_svpwm_init_t *pstcSvpwmInit);
+
+int32_t TMR4_SVPWM_Calc(const stc_tmr4_svpwm_t *pstcSvpwm, int16_t i16Alpha, int16_t i16Beta,
+                        stc_tmr4_svpwm_cmp_t *pstcCmp);
+int32_t TMR4_SVPWM_Update(stc_tmr4_svpwm_t *pstcSvpwm, int16_t i16Alpha, int16_t i16Beta);
+
+/**
+ * @}
+ */
+
+#endif /* LL_TMR4_SVPWM_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __HC32_LL_TMR4_SVPWM_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
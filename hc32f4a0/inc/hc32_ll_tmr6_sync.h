@@ -0,0 +1,184 @@
+/**
+ *******************************************************************************
+ * @file  hc32_ll_tmr6_sync.h
+ * @brief This file contains all the functions prototypes of the TMR6
+ *        synchronous PWM update driver library.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       CDT             First version
+                                    Documented the hold of the buffer transfer in sawtooth and triangle mode
+                                    Add API TMR6_SYNC_ReplayStructInit()
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2025, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+#ifndef __HC32_LL_TMR6_SYNC_H__
+#define __HC32_LL_TMR6_SYNC_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ll_def.h"
+#include "hc32_ll_dma.h"
+
+#include "hc32f4xx.h"
+#include "hc32f4xx_conf.h"
+
+/**
+ * @addtogroup LL_Driver
+ * @{
+ */
+
+/**
+ * @addtogroup LL_TMR6_SYNC
+ * @{
+ */
+
+#if (LL_TMR6_SYNC_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup TMR6_SYNC_Global_Macros TMR6_SYNC Global Macros
+ * @{
+ */
+
+#define TMR6_SYNC_UNIT_MAX              (8U)        /*!< Units of a PWM set */
+
+/**
+ * @defgroup TMR6_SYNC_Channel TMR6_SYNC Channel
+ * @{
+ */
+#define TMR6_SYNC_CH_A                  (0x01U)     /*!< PWMA, compare register GCMAR buffered by GCMCR */
+#define TMR6_SYNC_CH_B                  (0x02U)     /*!< PWMB, compare register GCMBR buffered by GCMDR */
+#define TMR6_SYNC_CH_AB                 (0x03U)
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup TMR6_SYNC_Global_Types TMR6_SYNC Global Types
+ * @{
+ */
+
+/**
+ * @brief TMR6 PWM set initialization structure definition
+ * @note  While values are staged the buffer functions of the units are disabled, so the working
+ *        registers are held in sawtooth and triangle wave mode alike. Meanwhile GCMCR and GCMDR
+ *        are plain compare registers, their compare match events must not be used.
+ */
+typedef struct {
+    uint8_t u8UnitNum;                              /*!< Number of units of the set */
+    CM_TMR6_TypeDef *apstcTmr6[TMR6_SYNC_UNIT_MAX]; /*!< Units, the first one is the time reference */
+    uint8_t au8Ch[TMR6_SYNC_UNIT_MAX];              /*!< Channels of each unit, a value of @ref TMR6_SYNC_Channel */
+    uint32_t u32BufTransCond;                       /*!< Commit point, a value of @ref TMR6_Buf_Trans_Cond_Define
+                                                         except TMR6_BUF_TRANS_INVD: peak (overflow),
+                                                         valley (underflow) or both. It applies in triangle
+                                                         wave mode, in sawtooth mode the commit point is the
+                                                         overflow counting up, the underflow counting down */
+    uint32_t u32GuardTicks;                         /*!< Timer ticks before the commit point in which a commit
+                                                         waits for the point to pass */
+} stc_tmr6_sync_init_t;
+
+/**
+ * @brief TMR6 PWM set structure definition
+ * @note  The members are private to the driver.
+ */
+typedef struct {
+    uint8_t u8UnitNum;                              /*!< Number of units */
+    CM_TMR6_TypeDef *apstcTmr6[TMR6_SYNC_UNIT_MAX]; /*!< Units */
+    uint8_t au8Ch[TMR6_SYNC_UNIT_MAX];              /*!< Channels of each unit */
+    uint32_t au32BconrRun[TMR6_SYNC_UNIT_MAX];      /*!< BCONR with the buffer functions enabled */
+    uint32_t au32BconrHold[TMR6_SYNC_UNIT_MAX];     /*!< BCONR with the buffer functions disabled */
+    uint32_t u32SyncUnit;                           /*!< Units for TMR6_SWSyncStart() */
+    uint32_t u32GuardTicks;                         /*!< Guard before the commit point */
+    uint8_t u8Staging;                              /*!< Buffer transfer held */
+} stc_tmr6_sync_t;
+
+/**
+ * @brief TMR6 PWM duty table replay configuration structure definition
+ */
+typedef struct {
+    CM_DMA_TypeDef *pstcDmaUnit;        /*!< DMA unit, it must be enabled by DMA_Cmd() */
+    uint8_t u8DmaCh;                    /*!< DMA channel writing the buffer registers */
+    uint32_t u32TrigTarget;             /*!< AOS target of u8DmaCh, a value of @ref AOS_Target_Select */
+    en_event_src_t enEvtSrc;            /*!< Commit point event of the unit, its overflow or underflow */
+    const uint32_t *pu32Table;          /*!< Compare values, interleaved A, B when both channels are replayed */
+    uint32_t u32Len;                    /*!< Number of PWM periods of the table */
+} stc_tmr6_sync_replay_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup TMR6_SYNC_Global_Functions
+ * @{
+ */
+int32_t TMR6_SYNC_StructInit(stc_tmr6_sync_init_t *pstcSyncInit);
+int32_t TMR6_SYNC_Init(stc_tmr6_sync_t *pstcSync, const stc_tmr6_sync_init_t *pstcSyncInit);
+void TMR6_SYNC_Start(const stc_tmr6_sync_t *pstcSync);
+void TMR6_SYNC_Stop(const stc_tmr6_sync_t *pstcSync);
+
+void TMR6_SYNC_SetCompare(stc_tmr6_sync_t *pstcSync, uint8_t u8Unit, uint8_t u8Ch, uint32_t u32Value);
+void TMR6_SYNC_SetCompareAll(stc_tmr6_sync_t *pstcSync, const uint32_t *pu32Value);
+void TMR6_SYNC_SetPeriod(stc_tmr6_sync_t *pstcSync, uint8_t u8Unit, uint32_t u32Value);
+void TMR6_SYNC_Commit(stc_tmr6_sync_t *pstcSync);
+
+int32_t TMR6_SYNC_ReplayStructInit(stc_tmr6_sync_replay_t *pstcReplay);
+int32_t TMR6_SYNC_ReplayStart(const stc_tmr6_sync_t *pstcSync, uint8_t u8Unit,
+                              const stc_tmr6_sync_replay_t *pstcReplay);
+void TMR6_SYNC_ReplayStop(const stc_tmr6_sync_replay_t *pstcReplay);
+
+/**
+ * @}
+ */
+
+#endif /* LL_TMR6_SYNC_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __HC32_LL_TMR6_SYNC_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,189 @@
+/**
+ *******************************************************************************
+ * @file  hc32_ll_tmra_enc.h
+ * @brief This file contains all the functions prototypes of the TMRA
+ *        quadrature encoder driver library.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       CDT             First version
+                                    Documented the default of enEvtSrc
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2025, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+#ifndef __HC32_LL_TMRA_ENC_H__
+#define __HC32_LL_TMRA_ENC_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ll_def.h"
+#include "hc32_ll_tmra.h"
+
+#include "hc32f4xx.h"
+#include "hc32f4xx_conf.h"
+
+/**
+ * @addtogroup LL_Driver
+ * @{
+ */
+
+/**
+ * @addtogroup LL_TMRA_ENC
+ * @{
+ */
+
+#if (LL_TMRA_ENC_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup TMRA_ENC_Global_Macros TMRA_ENC Global Macros
+ * @{
+ */
+
+/**
+ * @defgroup TMRA_ENC_Count_Cond TMRA_ENC Count Condition
+ * @brief    Every edge of CLKA and CLKB counted, up when CLKA leads CLKB.
+ * @{
+ */
+#define TMRA_ENC_CNT_UP_X4              (TMRA_CNT_UP_COND_CLKB_LOW_CLKA_RISING   |                          \
+                                         TMRA_CNT_UP_COND_CLKA_HIGH_CLKB_RISING  |                          \
+                                         TMRA_CNT_UP_COND_CLKB_HIGH_CLKA_FALLING |                          \
+                                         TMRA_CNT_UP_COND_CLKA_LOW_CLKB_FALLING)
+#define TMRA_ENC_CNT_DOWN_X4            (TMRA_CNT_DOWN_COND_CLKA_LOW_CLKB_RISING   |                        \
+                                         TMRA_CNT_DOWN_COND_CLKB_HIGH_CLKA_RISING  |                        \
+                                         TMRA_CNT_DOWN_COND_CLKA_HIGH_CLKB_FALLING |                        \
+                                         TMRA_CNT_DOWN_COND_CLKB_LOW_CLKA_FALLING)
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup TMRA_ENC_Global_Types TMRA_ENC Global Types
+ * @{
+ */
+
+/**
+ * @brief TMRA encoder axis initialization structure definition
+ */
+typedef struct {
+    CM_TMRA_TypeDef *TMRAx;             /*!< TMRA unit counting the encoder on CLKA/CLKB */
+    uint16_t u16CountUpCond;            /*!< Count up condition, see @ref TMRA_ENC_Count_Cond */
+    uint16_t u16CountDownCond;          /*!< Count down condition, see @ref TMRA_ENC_Count_Cond */
+    uint32_t u32PosCaptCh;              /*!< Channel of TMRAx capturing the position on the rising edge of
+                                             its PWM pin, a value of @ref TMRA_Channel */
+    CM_TMRA_TypeDef *pstcTimeBase;      /*!< Free running TMRA unit of the timestamps, started by the user */
+    uint32_t u32TimeCaptCh;             /*!< Channel of pstcTimeBase capturing the timestamp */
+    uint32_t u32TrigTarget;             /*!< AOS target of the capture event of pstcTimeBase,
+                                             a value of @ref AOS_Target_Select */
+    en_event_src_t enEvtSrc;            /*!< Compare event of TMRAx (EVT_SRC_TMRA_x_CMP), raised by u32PosCaptCh,
+                                             EVT_SRC_MAX by default and rejected by TMRA_ENC_Init() */
+    uint32_t u32TimeBaseFreq;           /*!< Count frequency of pstcTimeBase in Hz */
+    uint32_t u32EdgeCounts;             /*!< Counts between two position captures, 4 for X4 counting */
+    uint32_t u32StopTime;               /*!< Ticks of pstcTimeBase without capture after which the speed is 0 */
+} stc_tmra_enc_init_t;
+
+/**
+ * @brief TMRA encoder axis state structure definition
+ */
+typedef struct {
+    int64_t i64Pos;                     /*!< Position in counts */
+    int32_t i32Speed;                   /*!< Speed in counts per second */
+    uint32_t u32Time;                   /*!< Sampling time in ticks of the time base */
+} stc_tmra_enc_state_t;
+
+/**
+ * @brief TMRA encoder axis structure definition
+ * @note  The members are private to the driver.
+ */
+typedef struct {
+    CM_TMRA_TypeDef *TMRAx;             /*!< Counting unit */
+    uint32_t u32PosCaptCh;              /*!< Position capture channel */
+    CM_TMRA_TypeDef *pstcTimeBase;      /*!< Time base unit */
+    uint32_t u32TimeCaptCh;             /*!< Timestamp capture channel */
+    uint32_t u32TimeBaseFreq;           /*!< Time base frequency */
+    uint32_t u32EdgeCounts;             /*!< Counts between two captures */
+    uint32_t u32StopTime;               /*!< Standstill time */
+    int64_t i64High;                    /*!< Position of the counter zero, written by the interrupt */
+    __IO uint32_t u32IrqSeq;            /*!< Changed by each update of i64High */
+    uint32_t u32Now;                    /*!< Extended time of the last sample */
+    uint16_t u16Now;                    /*!< Time base count of the last sample */
+    uint16_t u16TimeCapt;               /*!< Timestamp capture of the last sample */
+    int64_t i64EdgePos;                 /*!< Position of the last captured edge */
+    uint32_t u32EdgeTime;               /*!< Extended time of the last captured edge */
+    int32_t i32Speed;                   /*!< Last speed */
+    __IO uint32_t u32Seq;               /*!< Odd while stcState is written */
+    stc_tmra_enc_state_t stcState;      /*!< Last sample */
+} stc_tmra_enc_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup TMRA_ENC_Global_Functions
+ * @{
+ */
+int32_t TMRA_ENC_StructInit(stc_tmra_enc_init_t *pstcEncInit);
+int32_t TMRA_ENC_Init(stc_tmra_enc_t *pstcEnc, const stc_tmra_enc_init_t *pstcEncInit);
+void TMRA_ENC_Start(stc_tmra_enc_t *pstcEnc, uint8_t u8Num);
+
+int64_t TMRA_ENC_GetPosition(const stc_tmra_enc_t *pstcEnc);
+void TMRA_ENC_Sample(stc_tmra_enc_t *pstcEnc, uint8_t u8Num);
+int32_t TMRA_ENC_GetState(const stc_tmra_enc_t *pstcEnc, stc_tmra_enc_state_t *pstcState);
+
+void TMRA_ENC_IrqHandler(stc_tmra_enc_t *pstcEnc);
+
+/**
+ * @}
+ */
+
+#endif /* LL_TMRA_ENC_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __HC32_LL_TMRA_ENC_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,122 @@
+/**
+ *******************************************************************************
+ * @file  hc32_ll_tstamp.h
+ * @brief This file contains all the functions prototypes of the timestamp
+ *        driver library.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2025, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+#ifndef __HC32_LL_TSTAMP_H__
+#define __HC32_LL_TSTAMP_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ll_def.h"
+
+#include "hc32f4xx.h"
+#include "hc32f4xx_conf.h"
+
+/**
+ * @addtogroup LL_Driver
+ * @{
+ */
+
+/**
+ * @addtogroup LL_TSTAMP
+ * @{
+ */
+
+#if (LL_TSTAMP_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup TSTAMP_Global_Types TSTAMP Global Types
+ * @{
+ */
+
+/**
+ * @brief Timestamp initialization structure definition
+ */
+typedef struct {
+    uint8_t u8ClockDiv;                 /*!< Specifies the clock division of the low unit.
+                                             This parameter can be a value of @ref TMRA_Clock_Divider */
+    uint32_t u32BusClock;               /*!< Specifies the bus clock which drives the TMRA units.
+                                             This parameter can be a value of @ref CLK_Bus_Clock_Sel */
+} stc_tstamp_init_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup TSTAMP_Global_Functions
+ * @{
+ */
+int32_t TSTAMP_StructInit(stc_tstamp_init_t *pstcTstampInit);
+int32_t TSTAMP_Init(CM_TMRA_TypeDef *TMRAxL, CM_TMRA_TypeDef *TMRAxH, const stc_tstamp_init_t *pstcTstampInit);
+void TSTAMP_DeInit(void);
+void TSTAMP_UpdateFreq(void);
+
+uint64_t TSTAMP_GetTick(void);
+uint64_t TSTAMP_GetNs(void);
+uint32_t TSTAMP_GetTickFreq(void);
+uint64_t TSTAMP_TickToNs(uint64_t u64Tick);
+uint64_t TSTAMP_NsToTick(uint64_t u64Ns);
+
+void TSTAMP_IrqHandler(void);
+
+/**
+ * @}
+ */
+
+#endif /* LL_TSTAMP_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __HC32_LL_TSTAMP_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
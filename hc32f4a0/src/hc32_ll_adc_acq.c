@@ -0,0 +1,769 @@
+/**
+ *******************************************************************************
+ * @file  hc32_ll_adc_acq.c
+ * @brief This file provides firmware functions to manage the ADC continuous
+ *        acquisition.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       CDT             First version
+                                    Added analog watchdog gated capture
+                                    Checked the DMA trigger target and event source in ADC_ACQ_Init()
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2025, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ll_adc_acq.h"
+#include "hc32_ll_adc.h"
+#include "hc32_ll_aos.h"
+#include "hc32_ll_utility.h"
+
+/**
+ * @addtogroup LL_Driver
+ * @{
+ */
+
+/**
+ * @defgroup LL_ADC_ACQ ADC_ACQ
+ * @brief ADC Continuous Acquisition Driver Library
+ * @note  Every end of sequence A conversion triggers one DMA block which copies a frame of data
+ *        registers into the ring. The DMA walks a circular linked list with one descriptor per
+ *        ring block and raises its transfer complete interrupt at the end of each block.
+ *        In gated mode the blocks are not reported, only the frames around the analog
+ *        watchdog events are.
+ * @{
+ */
+
+#if (LL_ADC_ACQ_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup ADC_ACQ_Local_Macros ADC_ACQ Local Macros
+ * @{
+ */
+/* DMA channel control of the ring descriptors: the source repeats over one frame */
+#define ADC_ACQ_DMA_CHCTL               (DMA_SRC_ADDR_INC | DMA_DEST_ADDR_INC | DMA_DATAWIDTH_16BIT | \
+                                         DMA_RPT_SRC | DMA_LLP_ENABLE | DMA_LLP_WAIT | DMA_INT_ENABLE)
+
+/* Gate states */
+#define ADC_ACQ_GATE_OFF                (0U)    /* Every block is reported */
+#define ADC_ACQ_GATE_ARMED              (1U)    /* Waiting for an AWD event */
+#define ADC_ACQ_GATE_POST               (2U)    /* Waiting for the post trigger frames */
+
+/* Bits of integrator growth the 32-bit CIC states can hold above a 16-bit input */
+#define ADC_ACQ_CIC_GROWTH_MAX          (16U)
+
+/**
+ * @defgroup ADC_ACQ_Check_Parameters_Validity ADC_ACQ Check Parameters Validity
+ * @{
+ */
+#define IS_ADC_ACQ_UNIT(x)                                                     \
+(   ((x) == CM_ADC1)                        ||                                 \
+    ((x) == CM_ADC2)                        ||                                 \
+    ((x) == CM_ADC3))
+
+#define IS_ADC_ACQ_DMA_CH(x)            ((x) <= DMA_CH7)
+
+#define IS_ADC_ACQ_AWD_CH(x)            (((x) < ADC_ACQ_CH_MAX) || ((x) == ADC_ACQ_AWD_CH_NONE))
+
+#define IS_ADC_ACQ_DMA_TARGET(unit, ch, target)                                \
+(   ((target) == ((((unit) == CM_DMA1) ? AOS_DMA1_0 : AOS_DMA2_0) + ((uint32_t)(ch) * 4UL))))
+
+#define IS_ADC_ACQ_EOCA_EVT(adc, evt)                                          \
+(   (((adc) == CM_ADC1) && ((evt) == EVT_SRC_ADC1_EOCA))                    ||  \
+    (((adc) == CM_ADC2) && ((evt) == EVT_SRC_ADC2_EOCA))                    ||  \
+    (((adc) == CM_ADC3) && ((evt) == EVT_SRC_ADC3_EOCA)))
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+static void ADC_ACQ_GateArm(stc_adc_acq_t *pstcAcq);
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @defgroup ADC_ACQ_Local_Functions ADC_ACQ Local Functions
+ * @{
+ */
+
+/**
+ * @brief  Load the first ring descriptor into the DMA channel and enable it.
+ * @param  [in] pstcAcq                 Pointer to a @ref stc_adc_acq_t structure.
+ * @retval None
+ */
+static void ADC_ACQ_DmaArm(stc_adc_acq_t *pstcAcq)
+{
+    stc_dma_init_t stcDmaInit;
+    stc_dma_repeat_init_t stcRptInit;
+    stc_dma_llp_init_t stcLlpInit;
+    const stc_dma_llp_descriptor_t *pstcDesc = pstcAcq->pstcDesc;
+
+    (void)DMA_ChCmd(pstcAcq->pstcDmaUnit, pstcAcq->u8DmaCh, DISABLE);
+
+    (void)DMA_StructInit(&stcDmaInit);
+    stcDmaInit.u32IntEn       = DMA_INT_ENABLE;
+    stcDmaInit.u32SrcAddr     = pstcDesc[0].SARx;
+    stcDmaInit.u32DestAddr    = pstcDesc[0].DARx;
+    stcDmaInit.u32DataWidth   = DMA_DATAWIDTH_16BIT;
+    stcDmaInit.u32BlockSize   = pstcAcq->u8FrameWidth;
+    stcDmaInit.u32TransCount  = pstcAcq->u16BlockFrames;
+    stcDmaInit.u32SrcAddrInc  = DMA_SRC_ADDR_INC;
+    stcDmaInit.u32DestAddrInc = DMA_DEST_ADDR_INC;
+    (void)DMA_Init(pstcAcq->pstcDmaUnit, pstcAcq->u8DmaCh, &stcDmaInit);
+
+    (void)DMA_RepeatStructInit(&stcRptInit);
+    stcRptInit.u32Mode     = DMA_RPT_SRC;
+    stcRptInit.u32SrcCount = pstcAcq->u8FrameWidth;
+    (void)DMA_RepeatInit(pstcAcq->pstcDmaUnit, pstcAcq->u8DmaCh, &stcRptInit);
+
+    (void)DMA_LlpStructInit(&stcLlpInit);
+    stcLlpInit.u32State = DMA_LLP_ENABLE;
+    stcLlpInit.u32Mode  = DMA_LLP_WAIT;
+    stcLlpInit.u32Addr  = pstcDesc[0].LLPx;
+    (void)DMA_LlpInit(pstcAcq->pstcDmaUnit, pstcAcq->u8DmaCh, &stcLlpInit);
+
+    pstcAcq->u16NextBlock = 0U;
+    if (NULL != pstcAcq->pstcGate) {
+        ADC_ACQ_GateArm(pstcAcq);
+    }
+    DMA_ClearTransCompleteStatus(pstcAcq->pstcDmaUnit, DMA_FLAG_TC_CH0 << pstcAcq->u8DmaCh);
+    DMA_TransCompleteIntCmd(pstcAcq->pstcDmaUnit, DMA_INT_TC_CH0 << pstcAcq->u8DmaCh, ENABLE);
+    (void)DMA_ChCmd(pstcAcq->pstcDmaUnit, pstcAcq->u8DmaCh, ENABLE);
+}
+
+/**
+ * @brief  Stop the conversion and the DMA channel.
+ * @param  [in] pstcAcq                 Pointer to a @ref stc_adc_acq_t structure.
+ * @retval None
+ */
+static void ADC_ACQ_Halt(stc_adc_acq_t *pstcAcq)
+{
+    ADC_TriggerCmd(pstcAcq->pstcAdc, ADC_SEQ_A, DISABLE);
+    ADC_Stop(pstcAcq->pstcAdc);
+    (void)DMA_ChCmd(pstcAcq->pstcDmaUnit, pstcAcq->u8DmaCh, DISABLE);
+    DMA_ClearTransCompleteStatus(pstcAcq->pstcDmaUnit, DMA_FLAG_TC_CH0 << pstcAcq->u8DmaCh);
+}
+
+/**
+ * @brief  Get the ring frame the DMA is writing.
+ * @param  [in] pstcAcq                 Pointer to a @ref stc_adc_acq_t structure.
+ * @retval Frame index in the ring.
+ */
+static uint32_t ADC_ACQ_GetFramePos(const stc_adc_acq_t *pstcAcq)
+{
+    uint32_t u32Pos;
+
+    u32Pos = (DMA_GetDestAddr(pstcAcq->pstcDmaUnit, pstcAcq->u8DmaCh) - (uint32_t)pstcAcq->pu16Ring) /
+             ((uint32_t)pstcAcq->u8FrameWidth * 2UL);
+    return u32Pos % ((uint32_t)pstcAcq->u16BlockNum * pstcAcq->u16BlockFrames);
+}
+
+/**
+ * @brief  Wait for the next analog watchdog event.
+ * @param  [in] pstcAcq                 Pointer to a @ref stc_adc_acq_t structure.
+ * @retval None
+ */
+static void ADC_ACQ_GateArm(stc_adc_acq_t *pstcAcq)
+{
+    uint16_t u16Int = 0U;
+
+    if (ADC_ACQ_AWD_CH_NONE != pstcAcq->pstcGate->u8Awd0Ch) {
+        u16Int |= ADC_AWD_INT_AWD0;
+    }
+    if (ADC_ACQ_AWD_CH_NONE != pstcAcq->pstcGate->u8Awd1Ch) {
+        u16Int |= ADC_AWD_INT_AWD1;
+    }
+    ADC_AWD_ClearStatus(pstcAcq->pstcAdc, ADC_AWD_FLAG_ALL);
+    pstcAcq->u8GateState = ADC_ACQ_GATE_ARMED;
+    ADC_AWD_IntCmd(pstcAcq->pstcAdc, u16Int, ENABLE);
+}
+
+/**
+ * @brief  Copy the frames around the event to the snapshot and report them.
+ * @param  [in] pstcAcq                 Pointer to a @ref stc_adc_acq_t structure.
+ * @retval None
+ */
+static void ADC_ACQ_GateCapture(stc_adc_acq_t *pstcAcq)
+{
+    const stc_adc_acq_gate_t *pstcGate = pstcAcq->pstcGate;
+    const uint32_t u32RingFrames = (uint32_t)pstcAcq->u16BlockNum * pstcAcq->u16BlockFrames;
+    const uint32_t u32Width = pstcAcq->u8FrameWidth;
+    const uint32_t u32FrameNum = (uint32_t)pstcGate->u16PreFrames + pstcGate->u16PostFrames;
+    const uint16_t *pu16Src;
+    uint32_t u32Frame;
+    uint32_t i;
+    uint32_t c;
+
+    u32Frame = (pstcAcq->u32TrigFrame + u32RingFrames - pstcGate->u16PreFrames) % u32RingFrames;
+    for (i = 0UL; i < u32FrameNum; i++) {
+        pu16Src = &pstcAcq->pu16Ring[u32Frame * u32Width];
+        for (c = 0UL; c < u32Width; c++) {
+            pstcGate->pu16Snapshot[(i * u32Width) + c] = pu16Src[c];
+        }
+        u32Frame = (u32Frame + 1UL) % u32RingFrames;
+    }
+    pstcAcq->u32EventCount++;
+    if (NULL != pstcGate->pfnCallback) {
+        pstcGate->pfnCallback(pstcAcq, pstcGate->pu16Snapshot, u32FrameNum, pstcGate->pvArg);
+    }
+    ADC_ACQ_GateArm(pstcAcq);
+}
+
+/**
+ * @brief  Report one completed ring block, through the decimator if any.
+ * @param  [in] pstcAcq                 Pointer to a @ref stc_adc_acq_t structure.
+ * @param  [in] u32Block                Index of the block.
+ * @retval None
+ */
+static void ADC_ACQ_BlockDone(stc_adc_acq_t *pstcAcq, uint32_t u32Block)
+{
+    const uint16_t *pu16Frame;
+    uint32_t u32FrameNum;
+
+    pu16Frame = &pstcAcq->pu16Ring[u32Block * pstcAcq->u16BlockFrames * pstcAcq->u8FrameWidth];
+    u32FrameNum = pstcAcq->u16BlockFrames;
+    if (NULL != pstcAcq->pstcCic) {
+        u32FrameNum = ADC_ACQ_CicProcess(pstcAcq->pstcCic, pu16Frame, u32FrameNum, pstcAcq->pu16DecimBuf);
+        pu16Frame = pstcAcq->pu16DecimBuf;
+    }
+    pstcAcq->u32BlockCount++;
+    if ((NULL != pstcAcq->pfnCallback) && (u32FrameNum > 0UL)) {
+        pstcAcq->pfnCallback(pstcAcq, pu16Frame, u32FrameNum, pstcAcq->pvArg);
+    }
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup ADC_ACQ_Global_Functions ADC_ACQ Global Functions
+ * @{
+ */
+
+/**
+ * @brief  Set each @ref stc_adc_acq_init_t field to default value.
+ * @param  [out] pstcAcqInit            Pointer to a @ref stc_adc_acq_init_t structure.
+ * @retval int32_t:
+ *           - LL_OK:                   Initialize success
+ *           - LL_ERR_INVD_PARAM:       pstcAcqInit is NULL
+ */
+int32_t ADC_ACQ_StructInit(stc_adc_acq_init_t *pstcAcqInit)
+{
+    int32_t i32Ret = LL_OK;
+
+    if (NULL == pstcAcqInit) {
+        i32Ret = LL_ERR_INVD_PARAM;
+    } else {
+        pstcAcqInit->u16Resolution    = ADC_RESOLUTION_12BIT;
+        pstcAcqInit->u16DataAlign     = ADC_DATAALIGN_RIGHT;
+        pstcAcqInit->u32SeqAMxCh      = 0UL;
+        pstcAcqInit->u16SeqATrigger   = ADC_ACQ_TRIG_NONE;
+        pstcAcqInit->u32SeqBMxCh      = 0UL;
+        pstcAcqInit->u16SeqBTrigger   = ADC_HARDTRIG_EVT1;
+        pstcAcqInit->u16AverageCount  = ADC_AVG_CNT2;
+        pstcAcqInit->u32AverageMxCh   = 0UL;
+        pstcAcqInit->pstcDmaUnit      = NULL;
+        pstcAcqInit->u8DmaCh          = DMA_CH0;
+        pstcAcqInit->u32DmaTrigTarget = AOS_DMA1_0;
+        pstcAcqInit->enEocaEvtSrc     = EVT_SRC_ADC1_EOCA;
+        pstcAcqInit->pu16Ring         = NULL;
+        pstcAcqInit->pstcDesc         = NULL;
+        pstcAcqInit->u16BlockNum      = 0U;
+        pstcAcqInit->u16BlockFrames   = 0U;
+        pstcAcqInit->pfnCallback      = NULL;
+        pstcAcqInit->pvArg            = NULL;
+        pstcAcqInit->pstcCic          = NULL;
+        pstcAcqInit->pu16DecimBuf     = NULL;
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Initialize an ADC unit for continuous acquisition into a ring.
+ * @param  [out] pstcAcq                Pointer to a @ref stc_adc_acq_t structure.
+ * @param  [in] ADCx                    Pointer to ADC instance register base.
+ *                                      This parameter can be a value of the following:
+ *   @arg  CM_ADC or CM_ADCx:           ADC instance register base.
+ * @param  [in] pstcAcqInit             Pointer to a @ref stc_adc_acq_init_t structure.
+ * @retval int32_t:
+ *           - LL_OK:                   Initialize success
+ *           - LL_ERR_INVD_PARAM:       Invalid parameter, or u32DmaTrigTarget is not the target of
+ *                                      u8DmaCh, or enEocaEvtSrc is not the EOCA event of ADCx
+ * @note   Sample times, channel remapping and the AOS event of the hardware triggers are left
+ *         to the application.
+ */
+int32_t ADC_ACQ_Init(stc_adc_acq_t *pstcAcq, CM_ADC_TypeDef *ADCx, const stc_adc_acq_init_t *pstcAcqInit)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+    stc_adc_init_t stcAdcInit;
+    stc_dma_llp_descriptor_t *pstcDesc;
+    uint32_t u32FirstCh;
+    uint32_t u32Width;
+    uint32_t u32BlockSize;
+    uint32_t i;
+
+    DDL_ASSERT(IS_ADC_ACQ_UNIT(ADCx));
+
+    if ((NULL != pstcAcq) && (NULL != pstcAcqInit) && (0UL != pstcAcqInit->u32SeqAMxCh) &&
+        (NULL != pstcAcqInit->pstcDmaUnit) && (NULL != pstcAcqInit->pu16Ring) &&
+        (NULL != pstcAcqInit->pstcDesc) && (pstcAcqInit->u16BlockNum >= 2U) &&
+        (pstcAcqInit->u16BlockFrames > 0U) &&
+        ((NULL == pstcAcqInit->pstcCic) || (NULL != pstcAcqInit->pu16DecimBuf)) &&
+        IS_ADC_ACQ_DMA_TARGET(pstcAcqInit->pstcDmaUnit, pstcAcqInit->u8DmaCh, pstcAcqInit->u32DmaTrigTarget) &&
+        IS_ADC_ACQ_EOCA_EVT(ADCx, pstcAcqInit->enEocaEvtSrc)) {
+        DDL_ASSERT(IS_ADC_ACQ_DMA_CH(pstcAcqInit->u8DmaCh));
+
+        u32FirstCh = __CLZ(__RBIT(pstcAcqInit->u32SeqAMxCh));
+        u32Width   = 32UL - __CLZ(pstcAcqInit->u32SeqAMxCh) - u32FirstCh;
+        u32BlockSize = (uint32_t)pstcAcqInit->u16BlockFrames * u32Width;
+        DDL_ASSERT((NULL == pstcAcqInit->pstcCic) || (pstcAcqInit->pstcCic->u8Width == u32Width));
+
+        pstcAcq->pstcAdc        = ADCx;
+        pstcAcq->pstcDmaUnit    = pstcAcqInit->pstcDmaUnit;
+        pstcAcq->u8DmaCh        = pstcAcqInit->u8DmaCh;
+        pstcAcq->u8FirstCh      = (uint8_t)u32FirstCh;
+        pstcAcq->u8FrameWidth   = (uint8_t)u32Width;
+        pstcAcq->u8Triggered    = (ADC_ACQ_TRIG_NONE != pstcAcqInit->u16SeqATrigger) ? 1U : 0U;
+        pstcAcq->pu16Ring       = pstcAcqInit->pu16Ring;
+        pstcAcq->pstcDesc       = pstcAcqInit->pstcDesc;
+        pstcAcq->u16BlockNum    = pstcAcqInit->u16BlockNum;
+        pstcAcq->u16BlockFrames = pstcAcqInit->u16BlockFrames;
+        pstcAcq->u16NextBlock   = 0U;
+        pstcAcq->pfnCallback    = pstcAcqInit->pfnCallback;
+        pstcAcq->pvArg          = pstcAcqInit->pvArg;
+        pstcAcq->pstcCic        = pstcAcqInit->pstcCic;
+        pstcAcq->pu16DecimBuf   = pstcAcqInit->pu16DecimBuf;
+        pstcAcq->u32BlockCount  = 0UL;
+        pstcAcq->pstcGate       = NULL;
+        pstcAcq->u8GateState    = ADC_ACQ_GATE_OFF;
+        pstcAcq->u32TrigFrame   = 0UL;
+        pstcAcq->u32AwdFlags    = 0UL;
+        pstcAcq->u32EventCount  = 0UL;
+
+        /* Scan mode */
+        (void)ADC_StructInit(&stcAdcInit);
+        stcAdcInit.u16Resolution = pstcAcqInit->u16Resolution;
+        stcAdcInit.u16DataAlign  = pstcAcqInit->u16DataAlign;
+        if (0U != pstcAcq->u8Triggered) {
+            stcAdcInit.u16ScanMode = (0UL != pstcAcqInit->u32SeqBMxCh) ? ADC_MD_SEQA_SEQB_SINGLESHOT : \
+                                     ADC_MD_SEQA_SINGLESHOT;
+        } else {
+            stcAdcInit.u16ScanMode = (0UL != pstcAcqInit->u32SeqBMxCh) ? ADC_MD_SEQA_CONT_SEQB_SINGLESHOT : \
+                                     ADC_MD_SEQA_CONT;
+        }
+        (void)ADC_Init(ADCx, &stcAdcInit);
+
+        ADC_MxChCmd(ADCx, ADC_SEQ_A, pstcAcqInit->u32SeqAMxCh, ENABLE);
+        if (0U != pstcAcq->u8Triggered) {
+            ADC_TriggerConfig(ADCx, ADC_SEQ_A, pstcAcqInit->u16SeqATrigger);
+        }
+        if (0UL != pstcAcqInit->u32SeqBMxCh) {
+            ADC_MxChCmd(ADCx, ADC_SEQ_B, pstcAcqInit->u32SeqBMxCh, ENABLE);
+            ADC_TriggerConfig(ADCx, ADC_SEQ_B, pstcAcqInit->u16SeqBTrigger);
+            ADC_TriggerCmd(ADCx, ADC_SEQ_B, ENABLE);
+        }
+        if (0UL != pstcAcqInit->u32AverageMxCh) {
+            ADC_ConvDataAverageConfig(ADCx, pstcAcqInit->u16AverageCount);
+            ADC_ConvDataAverageMxChCmd(ADCx, pstcAcqInit->u32AverageMxCh, ENABLE);
+        }
+
+        /* Circular list of the ring blocks */
+        pstcDesc = pstcAcqInit->pstcDesc;
+        for (i = 0UL; i < pstcAcqInit->u16BlockNum; i++) {
+            pstcDesc[i].SARx      = (uint32_t)&ADCx->DR0 + (u32FirstCh * 2UL);
+            pstcDesc[i].DARx      = (uint32_t)&pstcAcqInit->pu16Ring[i * u32BlockSize];
+            pstcDesc[i].DTCTLx    = ((uint32_t)pstcAcqInit->u16BlockFrames << DMA_DTCTL_CNT_POS) | u32Width;
+            pstcDesc[i].RPTx      = u32Width;
+            pstcDesc[i].SNSEQCTLx = 0UL;
+            pstcDesc[i].DNSEQCTLx = 0UL;
+            pstcDesc[i].LLPx      = (uint32_t)&pstcDesc[(i + 1UL) % pstcAcqInit->u16BlockNum];
+            pstcDesc[i].CHCTLx    = ADC_ACQ_DMA_CHCTL;
+        }
+        AOS_SetTriggerEventSrc(pstcAcqInit->u32DmaTrigTarget, pstcAcqInit->enEocaEvtSrc);
+        i32Ret = LL_OK;
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Start the acquisition of one ADC unit.
+ * @param  [in] pstcAcq                 Pointer to a @ref stc_adc_acq_t structure.
+ * @retval int32_t:
+ *           - LL_OK:                   Started
+ *           - LL_ERR_INVD_PARAM:       pstcAcq is NULL
+ *           - LL_ERR_BUSY:             The ADC unit is converting
+ */
+int32_t ADC_ACQ_Start(stc_adc_acq_t *pstcAcq)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if (NULL != pstcAcq) {
+        ADC_ACQ_DmaArm(pstcAcq);
+        if (0U != pstcAcq->u8Triggered) {
+            ADC_TriggerCmd(pstcAcq->pstcAdc, ADC_SEQ_A, ENABLE);
+            i32Ret = LL_OK;
+        } else {
+            i32Ret = ADC_Start(pstcAcq->pstcAdc);
+        }
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Stop the acquisition of one ADC unit.
+ * @param  [in] pstcAcq                 Pointer to a @ref stc_adc_acq_t structure.
+ * @retval None
+ */
+void ADC_ACQ_Stop(stc_adc_acq_t *pstcAcq)
+{
+    DDL_ASSERT(NULL != pstcAcq);
+
+    ADC_ACQ_Halt(pstcAcq);
+}
+
+/**
+ * @brief  Start the acquisitions of synchronized ADC units.
+ * @param  [in] apstcAcq                Acquisitions, the first one on ADC1.
+ * @param  [in] u8Num                   Number of acquisitions, 2 or 3.
+ * @param  [in] u16SyncUnit             A value of @ref ADC_Sync_Unit
+ * @param  [in] u16SyncMode             A value of @ref ADC_Sync_Mode
+ * @param  [in] u8TriggerDelay          Trigger delay time(ADCLK cycle), range is [1, 255].
+ * @retval int32_t:
+ *           - LL_OK:                   Started
+ *           - LL_ERR_INVD_PARAM:       Invalid parameter
+ * @note   ADC1 drives the other units: by its sequence A hardware trigger if it has one, or
+ *         by a software start otherwise. Each unit fills its own ring, the frames of the
+ *         same index of all the rings are taken from the same synchronous scan.
+ */
+int32_t ADC_ACQ_SyncStart(stc_adc_acq_t *const apstcAcq[], uint8_t u8Num, uint16_t u16SyncUnit,
+                          uint16_t u16SyncMode, uint8_t u8TriggerDelay)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+    uint32_t i;
+
+    if ((NULL != apstcAcq) && (u8Num >= 2U) && (u8Num <= 3U) && (NULL != apstcAcq[0]) &&
+        (CM_ADC1 == apstcAcq[0]->pstcAdc)) {
+        for (i = 0UL; i < u8Num; i++) {
+            DDL_ASSERT(NULL != apstcAcq[i]);
+            ADC_ACQ_DmaArm(apstcAcq[i]);
+        }
+        ADC_SyncModeConfig(u16SyncUnit, u16SyncMode, u8TriggerDelay);
+        ADC_SyncModeCmd(ENABLE);
+        if (0U != apstcAcq[0]->u8Triggered) {
+            ADC_TriggerCmd(CM_ADC1, ADC_SEQ_A, ENABLE);
+            i32Ret = LL_OK;
+        } else {
+            i32Ret = ADC_Start(CM_ADC1);
+        }
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Stop the acquisitions of synchronized ADC units.
+ * @param  [in] apstcAcq                Acquisitions given to ADC_ACQ_SyncStart().
+ * @param  [in] u8Num                   Number of acquisitions.
+ * @retval None
+ */
+void ADC_ACQ_SyncStop(stc_adc_acq_t *const apstcAcq[], uint8_t u8Num)
+{
+    uint32_t i;
+
+    DDL_ASSERT(NULL != apstcAcq);
+
+    ADC_SyncModeCmd(DISABLE);
+    for (i = 0UL; i < u8Num; i++) {
+        ADC_ACQ_Halt(apstcAcq[i]);
+    }
+}
+
+/**
+ * @brief  DMA transfer complete interrupt handler of an acquisition.
+ * @param  [in] pstcAcq                 Pointer to a @ref stc_adc_acq_t structure.
+ * @retval None
+ * @note   The block in progress is located from the DMA destination address, every block
+ *         completed since the previous call is reported in order.
+ */
+void ADC_ACQ_DmaIrqHandler(stc_adc_acq_t *pstcAcq)
+{
+    uint32_t u32Flag;
+    uint32_t u32Cur;
+    uint32_t u32BlockBytes;
+    uint32_t u32RingFrames;
+
+    DDL_ASSERT(NULL != pstcAcq);
+
+    u32Flag = DMA_FLAG_TC_CH0 << pstcAcq->u8DmaCh;
+    if (SET == DMA_GetTransCompleteStatus(pstcAcq->pstcDmaUnit, u32Flag)) {
+        DMA_ClearTransCompleteStatus(pstcAcq->pstcDmaUnit, u32Flag);
+
+        if (NULL == pstcAcq->pstcGate) {
+            u32BlockBytes = (uint32_t)pstcAcq->u16BlockFrames * pstcAcq->u8FrameWidth * 2UL;
+            u32Cur = (DMA_GetDestAddr(pstcAcq->pstcDmaUnit, pstcAcq->u8DmaCh) - (uint32_t)pstcAcq->pu16Ring) /
+                     u32BlockBytes;
+            if (u32Cur >= pstcAcq->u16BlockNum) {
+                u32Cur = 0UL;
+            }
+            /* Report up to the block the DMA is writing */
+            do {
+                ADC_ACQ_BlockDone(pstcAcq, pstcAcq->u16NextBlock);
+                pstcAcq->u16NextBlock = (uint16_t)((pstcAcq->u16NextBlock + 1U) % pstcAcq->u16BlockNum);
+            } while (pstcAcq->u16NextBlock != u32Cur);
+        } else if (ADC_ACQ_GATE_POST == pstcAcq->u8GateState) {
+            u32RingFrames = (uint32_t)pstcAcq->u16BlockNum * pstcAcq->u16BlockFrames;
+            u32Cur = (ADC_ACQ_GetFramePos(pstcAcq) + u32RingFrames - pstcAcq->u32TrigFrame) % u32RingFrames;
+            if (u32Cur >= pstcAcq->pstcGate->u16PostFrames) {
+                ADC_ACQ_GateCapture(pstcAcq);
+            }
+        } else {
+            /* Gated, waiting for an AWD event */
+        }
+    }
+}
+
+/**
+ * @brief  Gate the acquisition on analog watchdog events.
+ * @param  [in] pstcAcq                 Pointer to a @ref stc_adc_acq_t structure.
+ * @param  [in] pstcGate                Pointer to a @ref stc_adc_acq_gate_t structure, it must stay valid
+ *                                      while configured. NULL reports every block again.
+ * @retval int32_t:
+ *           - LL_OK:                   Configure success
+ *           - LL_ERR_INVD_PARAM:       Invalid parameter
+ * @note   The AWD interrupts of the ADC unit must call ADC_ACQ_AwdIrqHandler().
+ */
+int32_t ADC_ACQ_GateConfig(stc_adc_acq_t *pstcAcq, const stc_adc_acq_gate_t *pstcGate)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+    uint32_t u32RingFrames;
+
+    if (NULL != pstcAcq) {
+        ADC_AWD_IntCmd(pstcAcq->pstcAdc, ADC_AWD_INT_ALL, DISABLE);
+        ADC_AWD_Cmd(pstcAcq->pstcAdc, ADC_AWD0, DISABLE);
+        ADC_AWD_Cmd(pstcAcq->pstcAdc, ADC_AWD1, DISABLE);
+        pstcAcq->pstcGate    = NULL;
+        pstcAcq->u8GateState = ADC_ACQ_GATE_OFF;
+
+        u32RingFrames = (uint32_t)pstcAcq->u16BlockNum * pstcAcq->u16BlockFrames;
+        if (NULL == pstcGate) {
+            i32Ret = LL_OK;
+        } else if ((NULL != pstcGate->pu16Snapshot) && (pstcGate->u16PostFrames > 0U) &&
+                   (((uint32_t)pstcGate->u16PreFrames + pstcGate->u16PostFrames + pstcAcq->u16BlockFrames) <=
+                    u32RingFrames) &&
+                   ((ADC_ACQ_AWD_CH_NONE != pstcGate->u8Awd0Ch) || (ADC_ACQ_AWD_CH_NONE != pstcGate->u8Awd1Ch)) &&
+                   ((ADC_AWD_COMB_INVD == pstcGate->u16CombMode) ||
+                    ((ADC_ACQ_AWD_CH_NONE != pstcGate->u8Awd0Ch) && (ADC_ACQ_AWD_CH_NONE != pstcGate->u8Awd1Ch)))) {
+            DDL_ASSERT(IS_ADC_ACQ_AWD_CH(pstcGate->u8Awd0Ch));
+            DDL_ASSERT(IS_ADC_ACQ_AWD_CH(pstcGate->u8Awd1Ch));
+
+            if (ADC_ACQ_AWD_CH_NONE != pstcGate->u8Awd0Ch) {
+                (void)ADC_AWD_Config(pstcAcq->pstcAdc, ADC_AWD0, pstcGate->u8Awd0Ch, &pstcGate->stcAwd0);
+                ADC_AWD_Cmd(pstcAcq->pstcAdc, ADC_AWD0, ENABLE);
+            }
+            if (ADC_ACQ_AWD_CH_NONE != pstcGate->u8Awd1Ch) {
+                (void)ADC_AWD_Config(pstcAcq->pstcAdc, ADC_AWD1, pstcGate->u8Awd1Ch, &pstcGate->stcAwd1);
+                ADC_AWD_Cmd(pstcAcq->pstcAdc, ADC_AWD1, ENABLE);
+            }
+            ADC_AWD_SetCombMode(pstcAcq->pstcAdc, pstcGate->u16CombMode);
+
+            pstcAcq->pstcGate = pstcGate;
+            ADC_ACQ_GateArm(pstcAcq);
+            i32Ret = LL_OK;
+        } else {
+            /* Invalid gate */
+        }
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Get the AWD flags of the last captured event.
+ * @param  [in] pstcAcq                 Pointer to a @ref stc_adc_acq_t structure.
+ * @retval A combination of @ref ADC_AWD_Status_Flag, valid in the capture callback.
+ */
+uint32_t ADC_ACQ_GetGateFlags(const stc_adc_acq_t *pstcAcq)
+{
+    DDL_ASSERT(NULL != pstcAcq);
+
+    return pstcAcq->u32AwdFlags;
+}
+
+/**
+ * @brief  Analog watchdog interrupt handler of an acquisition.
+ * @param  [in] pstcAcq                 Pointer to a @ref stc_adc_acq_t structure.
+ * @retval None
+ * @note   The event is taken at the frame the DMA is writing. The AWD interrupts stay off until
+ *         the capture has been reported, so a channel staying out of the window costs one
+ *         interrupt per capture.
+ */
+void ADC_ACQ_AwdIrqHandler(stc_adc_acq_t *pstcAcq)
+{
+    uint32_t u32Flags = 0UL;
+
+    DDL_ASSERT(NULL != pstcAcq);
+
+    if (SET == ADC_AWD_GetStatus(pstcAcq->pstcAdc, ADC_AWD_FLAG_AWD0)) {
+        u32Flags |= ADC_AWD_FLAG_AWD0;
+    }
+    if (SET == ADC_AWD_GetStatus(pstcAcq->pstcAdc, ADC_AWD_FLAG_AWD1)) {
+        u32Flags |= ADC_AWD_FLAG_AWD1;
+    }
+    if (SET == ADC_AWD_GetStatus(pstcAcq->pstcAdc, ADC_AWD_FLAG_COMB)) {
+        u32Flags |= ADC_AWD_FLAG_COMB;
+    }
+    ADC_AWD_ClearStatus(pstcAcq->pstcAdc, ADC_AWD_FLAG_ALL);
+
+    if ((NULL != pstcAcq->pstcGate) && (ADC_ACQ_GATE_ARMED == pstcAcq->u8GateState) &&
+        ((ADC_AWD_COMB_INVD == pstcAcq->pstcGate->u16CombMode) || (0UL != (u32Flags & ADC_AWD_FLAG_COMB)))) {
+        ADC_AWD_IntCmd(pstcAcq->pstcAdc, ADC_AWD_INT_ALL, DISABLE);
+        pstcAcq->u32TrigFrame = ADC_ACQ_GetFramePos(pstcAcq);
+        pstcAcq->u32AwdFlags  = u32Flags;
+        pstcAcq->u8GateState  = ADC_ACQ_GATE_POST;
+    }
+}
+
+/**
+ * @brief  Initialize a CIC decimator.
+ * @param  [out] pstcCic                Pointer to a @ref stc_adc_acq_cic_t structure.
+ * @param  [in] u8Order                 Number of stages, [1, ADC_ACQ_CIC_ORDER_MAX].
+ * @param  [in] u16Decim                Decimation ratio, at least 2.
+ * @param  [in] u8Width                 Channels per frame, [1, ADC_ACQ_CH_MAX].
+ * @retval int32_t:
+ *           - LL_OK:                   Initialize success
+ *           - LL_ERR_INVD_PARAM:       Invalid parameter, or the gain of u16Decim^u8Order
+ *                                      overflows the 32-bit states
+ * @note   The output is divided by the power of 2 nearest above the gain, so it stays in the
+ *         input range and is exact for a power of 2 ratio.
+ */
+int32_t ADC_ACQ_CicInit(stc_adc_acq_cic_t *pstcCic, uint8_t u8Order, uint16_t u16Decim, uint8_t u8Width)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+    uint32_t u32Bits = 0UL;
+    uint32_t i;
+    uint32_t j;
+
+    while ((1UL << u32Bits) < u16Decim) {
+        u32Bits++;
+    }
+    if ((NULL != pstcCic) && (u8Order >= 1U) && (u8Order <= ADC_ACQ_CIC_ORDER_MAX) && (u16Decim >= 2U) &&
+        (u8Width >= 1U) && (u8Width <= ADC_ACQ_CH_MAX) && ((u32Bits * u8Order) <= ADC_ACQ_CIC_GROWTH_MAX)) {
+        pstcCic->u8Order  = u8Order;
+        pstcCic->u8Width  = u8Width;
+        pstcCic->u8Shift  = (uint8_t)(u32Bits * u8Order);
+        pstcCic->u16Decim = u16Decim;
+        pstcCic->u16Phase = 0U;
+        for (i = 0UL; i < ADC_ACQ_CIC_ORDER_MAX; i++) {
+            for (j = 0UL; j < ADC_ACQ_CH_MAX; j++) {
+                pstcCic->au32Integ[i][j] = 0UL;
+                pstcCic->au32Comb[i][j]  = 0UL;
+            }
+        }
+        i32Ret = LL_OK;
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Run frames through a CIC decimator.
+ * @param  [in] pstcCic                 Pointer to a @ref stc_adc_acq_cic_t structure.
+ * @param  [in] pu16In                  Input frames.
+ * @param  [in] u32FrameNum             Number of input frames.
+ * @param  [out] pu16Out                Output frames, room for u32FrameNum / decimation + 1 frames.
+ * @retval Number of output frames.
+ * @note   The states wrap modulo 2^32, which the comb stages cancel as long as the gain fits.
+ */
+uint32_t ADC_ACQ_CicProcess(stc_adc_acq_cic_t *pstcCic, const uint16_t *pu16In, uint32_t u32FrameNum,
+                            uint16_t *pu16Out)
+{
+    uint32_t u32OutNum = 0UL;
+    uint32_t u32Val;
+    uint32_t u32Prev;
+    uint32_t f;
+    uint32_t c;
+    uint32_t k;
+
+    DDL_ASSERT((NULL != pstcCic) && (NULL != pu16In) && (NULL != pu16Out));
+
+    for (f = 0UL; f < u32FrameNum; f++) {
+        for (c = 0UL; c < pstcCic->u8Width; c++) {
+            u32Val = pu16In[(f * pstcCic->u8Width) + c];
+            for (k = 0UL; k < pstcCic->u8Order; k++) {
+                pstcCic->au32Integ[k][c] += u32Val;
+                u32Val = pstcCic->au32Integ[k][c];
+            }
+        }
+        pstcCic->u16Phase++;
+        if (pstcCic->u16Phase >= pstcCic->u16Decim) {
+            pstcCic->u16Phase = 0U;
+            for (c = 0UL; c < pstcCic->u8Width; c++) {
+                u32Val = pstcCic->au32Integ[pstcCic->u8Order - 1U][c];
+                for (k = 0UL; k < pstcCic->u8Order; k++) {
+                    u32Prev = pstcCic->au32Comb[k][c];
+                    pstcCic->au32Comb[k][c] = u32Val;
+                    u32Val -= u32Prev;
+                }
+                pu16Out[(u32OutNum * pstcCic->u8Width) + c] = (uint16_t)(u32Val >> pstcCic->u8Shift);
+            }
+            u32OutNum++;
+        }
+    }
+
+    return u32OutNum;
+}
+
+/**
+ * @}
+ */
+
+#endif /* LL_ADC_ACQ_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/******************************************************************************
+ * EOF (not truncated)
+ *****************************************************************************/
@@ -13,6 +13,9 @@
    2024-06-30       CDT             API CAN_DeInit() added return value
                                     API optimized: CAN_WriteTxBuf()
                                     Replace constants with Macros
+   2026-10-19       CDT             Added RX ring drain and software ID dispatch APIs
+                                    Added TTCAN schedule APIs
+                                    Skipped a TTCAN slot whose transmit buffer is still filled
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2022-2025, Xiaohua Semiconductor Co., Ltd. All rights reserved.
@@ -163,6 +166,8 @@
 /* FDF bit check */
 #define IS_CAN20_FDF(x)                     ((x) == 0U)
 
+#define IS_CAN_POWER_OF_2(x)                (((x) != 0U) && (((x) & ((x) - 1U)) == 0U))
+
 /**
  * @}
  */
@@ -178,6 +183,18 @@
 
 #define CAN_ERRINT_FLAG_MASK                (CAN_ERRINT_BEIF | CAN_ERRINT_ALIF | CAN_ERRINT_EPIF)
 
+/* Software ID dispatch: multiplicative hash of the ID with IDE in bit 31 */
+#define CAN_RX_HASH_MUL                     (0x9E3779B1UL)
+#define CAN_RX_HASH_KEY(id, ide)            ((id) | ((uint32_t)(ide) << 31U))
+#define CAN_RX_HASH_BITS_MAX                (16U)
+#define CAN_RX_EXT_MAP_BITS                 (10U)
+#define CAN_RX_MAP_BIT(n)                   (1UL << ((n) & 31UL))
+
+/* TTCAN schedule */
+#define CAN_TTC_TX_BUF_NUM                  (4U)
+#define CAN_TTC_CYCLE_NUM_MAX               (64U)
+#define CAN_TTC_CYCLE_START                 (0U)
+
 /**
  * @}
  */
@@ -467,6 +484,66 @@ static void CAN_ReadRxBuf(const CM_CAN_TypeDef *CANx, stc_can_rx_frame_t *pstcRx
     }
 }
 
+/**
+ * @brief  Hash a CAN ID.
+ * @param  [in]  u32Key                 ID with IDE in bit 31, see CAN_RX_HASH_KEY.
+ * @retval uint32_t                     32-bit hash, the upper bits are the best mixed.
+ */
+static uint32_t CAN_RxHash(uint32_t u32Key)
+{
+    return u32Key * CAN_RX_HASH_MUL;
+}
+
+/**
+ * @brief  Arm the TTCAN trigger for the next slot of the current basic cycle, or for the start
+ *         of the next basic cycle when the current one has no more slot.
+ * @param  [in]  CANx                   Pointer to CAN instance register base.
+ * @param  [in]  pstcSched              Pointer to a @ref stc_can_ttc_sched_t structure.
+ * @param  [in]  u16From                First slot to be checked.
+ * @retval None
+ */
+static void CAN_TTC_SchedArm(CM_CAN_TypeDef *CANx, stc_can_ttc_sched_t *pstcSched, uint16_t u16From)
+{
+    uint16_t i = u16From;
+    const stc_can_ttc_slot_t *pstcSlot;
+    uint8_t u8TxBuf;
+
+    while (i < pstcSched->u16SlotNum) {
+        pstcSlot = &pstcSched->pstcSlot[i];
+        if ((pstcSched->u8Cycle & (pstcSlot->u8Repeat - 1U)) == pstcSlot->u8BaseCycle) {
+            break;
+        }
+        i++;
+    }
+    pstcSched->u16Armed = i;
+
+    if (i < pstcSched->u16SlotNum) {
+        pstcSlot = &pstcSched->pstcSlot[i];
+        if (READ_REG8_BIT(CANx->TCTRL, CAN_TX_BUF_FULL) == CAN_TX_BUF_FULL) {
+            /* The buffers are used in turn, so the next one still holds the frame of a slot
+               which has not been sent. Keep it, and only wake up at the trigger time of the slot. */
+            pstcSched->u32MissCount++;
+            WRITE_REG16(CANx->TRG_CFG, CAN_TTC_TRIG_TIME_TRIG);
+        } else {
+            /* Fill the frame into a buffer other than the ones of the previous slots */
+            u8TxBuf = pstcSched->u8TxBuf;
+            pstcSched->u8TxBuf = (u8TxBuf + 1U) % CAN_TTC_TX_BUF_NUM;
+            WRITE_REG8(CANx->TBSLOT, u8TxBuf);
+            CAN_WriteTxBuf(CANx, pstcSlot->pstcFrame);
+            SET_REG8_BIT(CANx->TBSLOT, CAN_TBSLOT_TBF);
+
+            WRITE_REG16(CANx->TRG_CFG, CAN_TTC_TRIG_SINGLESHOT_TX_TRIG | (uint16_t)u8TxBuf |
+                        (uint16_t)(((uint16_t)pstcSlot->u8TxEnableWindow - 1U) << CAN_TRG_CFG_TEW_POS));
+        }
+        /* Writing TT_TRIG arms the trigger. */
+        WRITE_REG16(CANx->TT_TRIG, pstcSlot->u16Offset);
+    } else {
+        /* Time trigger at the cycle time reset by the next reference message */
+        WRITE_REG16(CANx->TRG_CFG, CAN_TTC_TRIG_TIME_TRIG);
+        WRITE_REG16(CANx->TT_TRIG, CAN_TTC_CYCLE_START);
+    }
+}
+
 /**
  * @}
  */
@@ -825,6 +902,259 @@ int32_t CAN_GetRxFrame(CM_CAN_TypeDef *CANx, stc_can_rx_frame_t *pstcRx)
     return i32Ret;
 }
 
+/**
+ * @brief  Initialize a RX ring.
+ * @param  [out] pstcRing               Pointer to a @ref stc_can_rx_ring_t structure.
+ * @param  [in]  pstcBuf                Frame buffer of the ring.
+ * @param  [in]  u16Size                Number of frames of the buffer, a power of 2.
+ * @retval int32_t:
+ *           - LL_OK:                   Initialize successfully.
+ *           - LL_ERR_INVD_PARAM:       pstcRing == NULL, pstcBuf == NULL or u16Size is not a power of 2.
+ */
+int32_t CAN_RxRingInit(stc_can_rx_ring_t *pstcRing, stc_can_rx_frame_t *pstcBuf, uint16_t u16Size)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if ((pstcRing != NULL) && (pstcBuf != NULL) && IS_CAN_POWER_OF_2(u16Size)) {
+        pstcRing->pstcBuf        = pstcBuf;
+        pstcRing->u16Size        = u16Size;
+        pstcRing->u16Head        = 0U;
+        pstcRing->u16Tail        = 0U;
+        pstcRing->u32OvfCount    = 0UL;
+        pstcRing->u32RejectCount = 0UL;
+        i32Ret = LL_OK;
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Build a software ID dispatch table.
+ * @note   The entries and the hash buckets are referenced by the table and must stay valid.
+ *         When an ID appears more than once, the first entry is used.
+ * @param  [out] pstcDisp               Pointer to a @ref stc_can_rx_dispatch_t structure.
+ * @param  [in]  pstcEntry              Pointer to the @ref stc_can_rx_dispatch_entry_t entries.
+ * @param  [in]  u16EntryNum            Number of the entries.
+ * @param  [in]  pu16Hash               Hash buckets.
+ * @param  [in]  u16HashSize            Number of hash buckets, a power of 2 greater than u16EntryNum.
+ *                                      Twice the number of entries keeps the probe sequences short.
+ * @retval int32_t:
+ *           - LL_OK:                   Build successfully.
+ *           - LL_ERR_INVD_PARAM:       Invalid parameter.
+ */
+int32_t CAN_RxDispatchInit(stc_can_rx_dispatch_t *pstcDisp, const stc_can_rx_dispatch_entry_t *pstcEntry,
+                           uint16_t u16EntryNum, uint16_t *pu16Hash, uint16_t u16HashSize)
+{
+    uint32_t i;
+    uint32_t u32Key;
+    uint32_t u32Hash;
+    uint32_t u32Mask;
+    uint32_t u32Pos;
+    uint8_t u8Bits = 0U;
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if ((pstcDisp != NULL) && (pstcEntry != NULL) && (pu16Hash != NULL) &&
+        IS_CAN_POWER_OF_2(u16HashSize) && (u16HashSize > u16EntryNum)) {
+        while ((1UL << u8Bits) < u16HashSize) {
+            u8Bits++;
+        }
+        u32Mask = (uint32_t)u16HashSize - 1UL;
+
+        pstcDisp->pstcEntry  = pstcEntry;
+        pstcDisp->pu16Hash   = pu16Hash;
+        pstcDisp->u8HashBits = u8Bits;
+        for (i = 0UL; i < u16HashSize; i++) {
+            pu16Hash[i] = 0U;
+        }
+        for (i = 0UL; i < ARRAY_SZ(pstcDisp->au32StdIdMap); i++) {
+            pstcDisp->au32StdIdMap[i] = 0UL;
+        }
+        for (i = 0UL; i < ARRAY_SZ(pstcDisp->au32ExtIdMap); i++) {
+            pstcDisp->au32ExtIdMap[i] = 0UL;
+        }
+
+        for (i = 0UL; i < u16EntryNum; i++) {
+            DDL_ASSERT(IS_CAN_IDE(pstcEntry[i].u8IDE));
+            DDL_ASSERT(IS_CAN_ID(pstcEntry[i].u8IDE, pstcEntry[i].u32ID));
+
+            u32Key  = CAN_RX_HASH_KEY(pstcEntry[i].u32ID, pstcEntry[i].u8IDE);
+            u32Hash = CAN_RxHash(u32Key);
+            if (pstcEntry[i].u8IDE == 0U) {
+                pstcDisp->au32StdIdMap[pstcEntry[i].u32ID >> 5U] |= CAN_RX_MAP_BIT(pstcEntry[i].u32ID);
+            } else {
+                u32Pos = u32Hash >> (32U - CAN_RX_EXT_MAP_BITS);
+                pstcDisp->au32ExtIdMap[u32Pos >> 5U] |= CAN_RX_MAP_BIT(u32Pos);
+            }
+
+            /* Linear probing, skip the IDs already in the table */
+            u32Pos = (u8Bits == 0U) ? 0UL : (u32Hash >> (32U - u8Bits));
+            while (pu16Hash[u32Pos] != 0U) {
+                if (CAN_RX_HASH_KEY(pstcEntry[pu16Hash[u32Pos] - 1U].u32ID,
+                                    pstcEntry[pu16Hash[u32Pos] - 1U].u8IDE) == u32Key) {
+                    break;
+                }
+                u32Pos = (u32Pos + 1UL) & u32Mask;
+            }
+            if (pu16Hash[u32Pos] == 0U) {
+                pu16Hash[u32Pos] = (uint16_t)(i + 1UL);
+            }
+        }
+        i32Ret = LL_OK;
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Look up the dispatch entry of an ID.
+ * @param  [in]  pstcDisp               Pointer to a @ref stc_can_rx_dispatch_t structure.
+ * @param  [in]  u32ID                  11 bits standard ID or 29 bits extended ID, depending on u8IDE.
+ * @param  [in]  u8IDE                  Identifier extension flag, 0: standard ID, 1: extended ID.
+ * @retval Pointer to the @ref stc_can_rx_dispatch_entry_t entry, NULL if the ID is not in the table.
+ */
+const stc_can_rx_dispatch_entry_t *CAN_RxDispatchFind(const stc_can_rx_dispatch_t *pstcDisp,
+                                                      uint32_t u32ID, uint8_t u8IDE)
+{
+    const stc_can_rx_dispatch_entry_t *pstcRet = NULL;
+    const stc_can_rx_dispatch_entry_t *pstcEntry;
+    const uint32_t u32Key = CAN_RX_HASH_KEY(u32ID, u8IDE);
+    const uint32_t u32Hash = CAN_RxHash(u32Key);
+    uint32_t u32Mask;
+    uint32_t u32Pos;
+    en_flag_status_t enHit;
+
+    DDL_ASSERT(pstcDisp != NULL);
+    DDL_ASSERT(IS_CAN_IDE(u8IDE));
+
+    /* The bitmaps reject most of the unknown IDs without probing */
+    if (u8IDE == 0U) {
+        enHit = ((pstcDisp->au32StdIdMap[(u32ID & CAN_STD_ID_MASK) >> 5U] & CAN_RX_MAP_BIT(u32ID)) != 0UL) ? SET : RESET;
+    } else {
+        u32Pos = u32Hash >> (32U - CAN_RX_EXT_MAP_BITS);
+        enHit = ((pstcDisp->au32ExtIdMap[u32Pos >> 5U] & CAN_RX_MAP_BIT(u32Pos)) != 0UL) ? SET : RESET;
+    }
+
+    if (enHit == SET) {
+        u32Mask = (1UL << pstcDisp->u8HashBits) - 1UL;
+        u32Pos  = (pstcDisp->u8HashBits == 0U) ? 0UL : (u32Hash >> (32U - pstcDisp->u8HashBits));
+        while (pstcDisp->pu16Hash[u32Pos] != 0U) {
+            pstcEntry = &pstcDisp->pstcEntry[pstcDisp->pu16Hash[u32Pos] - 1U];
+            if (CAN_RX_HASH_KEY(pstcEntry->u32ID, pstcEntry->u8IDE) == u32Key) {
+                pstcRet = pstcEntry;
+                break;
+            }
+            u32Pos = (u32Pos + 1UL) & u32Mask;
+        }
+    }
+
+    return pstcRet;
+}
+
+/**
+ * @brief  Drain all received frames into a RX ring, call it from the RX interrupt.
+ * @note   Frames are read from RBUF straight into the ring. With a dispatch table, the frames
+ *         whose ID is not in the table are released without entering the ring.
+ * @param  [in]  CANx                   Pointer to CAN instance register base.
+ *                                      This parameter can be a value of the following:
+ *   @arg  CM_CAN or CM_CANx:           CAN instance register base.
+ * @param  [in]  pstcRing               Pointer to a @ref stc_can_rx_ring_t structure.
+ * @param  [in]  pstcDisp               Pointer to a @ref stc_can_rx_dispatch_t structure, NULL to accept all frames.
+ * @retval uint32_t                     Number of frames put into the ring.
+ */
+uint32_t CAN_DrainRxFrame(CM_CAN_TypeDef *CANx, stc_can_rx_ring_t *pstcRing, const stc_can_rx_dispatch_t *pstcDisp)
+{
+    uint32_t u32Cnt = 0UL;
+    uint16_t u16Head;
+    uint16_t u16Mask;
+    stc_can_rx_frame_t *pstcRx;
+
+    DDL_ASSERT(IS_CAN_UNIT(CANx));
+    DDL_ASSERT(pstcRing != NULL);
+
+    u16Head = pstcRing->u16Head;
+    u16Mask = pstcRing->u16Size - 1U;
+    while (READ_REG8_BIT(CANx->RCTRL, CAN_RCTRL_RSTAT) != CAN_RX_BUF_EMPTY) {
+        if ((uint16_t)(u16Head - pstcRing->u16Tail) >= pstcRing->u16Size) {
+            pstcRing->u32OvfCount++;
+        } else {
+            pstcRx = &pstcRing->pstcBuf[u16Head & u16Mask];
+            CAN_ReadRxBuf(CANx, pstcRx);
+            if ((pstcDisp != NULL) && (CAN_RxDispatchFind(pstcDisp, pstcRx->u32ID, (uint8_t)pstcRx->IDE) == NULL)) {
+                pstcRing->u32RejectCount++;
+            } else {
+                u16Head++;
+                u32Cnt++;
+            }
+        }
+        /* Set RB to point to the next RB slot. */
+        SET_REG8_BIT(CANx->RCTRL, CAN_RCTRL_RREL);
+    }
+    /* Publish all frames at once */
+    pstcRing->u16Head = u16Head;
+
+    return u32Cnt;
+}
+
+/**
+ * @brief  Get one frame from a RX ring.
+ * @param  [in]  pstcRing               Pointer to a @ref stc_can_rx_ring_t structure.
+ * @param  [out] pstcRx                 Pointer to a @ref stc_can_rx_frame_t structure.
+ * @retval int32_t:
+ *           - LL_OK:                   Get one frame successfully.
+ *           - LL_ERR_BUF_EMPTY:        The ring is empty.
+ *           - LL_ERR_INVD_PARAM:       pstcRing == NULL or pstcRx == NULL.
+ */
+int32_t CAN_RxRingGet(stc_can_rx_ring_t *pstcRing, stc_can_rx_frame_t *pstcRx)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+    uint16_t u16Tail;
+
+    if ((pstcRing != NULL) && (pstcRx != NULL)) {
+        i32Ret = LL_ERR_BUF_EMPTY;
+        u16Tail = pstcRing->u16Tail;
+        if (u16Tail != pstcRing->u16Head) {
+            *pstcRx = pstcRing->pstcBuf[u16Tail & (pstcRing->u16Size - 1U)];
+            pstcRing->u16Tail = u16Tail + 1U;
+            i32Ret = LL_OK;
+        }
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Pass all frames of a RX ring to their handlers.
+ * @note   The handlers get the frame in place in the ring. Frames without a handler are discarded.
+ * @param  [in]  pstcRing               Pointer to a @ref stc_can_rx_ring_t structure.
+ * @param  [in]  pstcDisp               Pointer to a @ref stc_can_rx_dispatch_t structure.
+ * @retval uint32_t                     Number of frames passed to a handler.
+ */
+uint32_t CAN_RxRingDispatch(stc_can_rx_ring_t *pstcRing, const stc_can_rx_dispatch_t *pstcDisp)
+{
+    uint32_t u32Cnt = 0UL;
+    uint16_t u16Tail;
+    const stc_can_rx_frame_t *pstcRx;
+    const stc_can_rx_dispatch_entry_t *pstcEntry;
+
+    DDL_ASSERT(pstcRing != NULL);
+    DDL_ASSERT(pstcDisp != NULL);
+
+    u16Tail = pstcRing->u16Tail;
+    while (u16Tail != pstcRing->u16Head) {
+        pstcRx = &pstcRing->pstcBuf[u16Tail & (pstcRing->u16Size - 1U)];
+        pstcEntry = CAN_RxDispatchFind(pstcDisp, pstcRx->u32ID, (uint8_t)pstcRx->IDE);
+        if ((pstcEntry != NULL) && (pstcEntry->pfnHandler != NULL)) {
+            pstcEntry->pfnHandler(pstcRx, pstcEntry->pvArg);
+            u32Cnt++;
+        }
+        u16Tail++;
+        /* Release the slot only after the handler returned */
+        pstcRing->u16Tail = u16Tail;
+    }
+
+    return u32Cnt;
+}
+
 /** Request a local-reset. The some register (e.g for node configuration) can only be modified if RESET=1.
  *  Bit RESET forces several components to a reset state, see the reference manual for details.
  * @brief
@@ -1529,6 +1859,248 @@ int32_t CAN_TTC_GetConfig(const CM_CAN_TypeDef *CANx, stc_can_ttc_config_t *pstc
     return i32Ret;
 }
 
+/**
+ * @brief  Compile a TTCAN schedule from a matrix of slots.
+ * @note   The slots are sorted in place by trigger time and must stay valid while the schedule is used.
+ *         Two slots overlap when their exclusive time windows intersect in a basic cycle in which both
+ *         are transmitted.
+ * @param  [out] pstcSched              Pointer to a @ref stc_can_ttc_sched_t structure.
+ * @param  [in]  pstcSlot               Pointer to the @ref stc_can_ttc_slot_t slots.
+ * @param  [in]  u16SlotNum             Number of the slots.
+ * @param  [in]  u16CycleLength         Length of the basic cycle in NTU.
+ * @param  [in]  u8CycleNum             Number of basic cycles of the matrix, a power of 2 up to 64.
+ * @retval int32_t:
+ *           - LL_OK:                   No error occurred.
+ *           - LL_ERR_INVD_PARAM:       A pointer is NULL or a slot is out of range.
+ *           - LL_ERR:                  Two slots overlap.
+ */
+int32_t CAN_TTC_SchedCompile(stc_can_ttc_sched_t *pstcSched, stc_can_ttc_slot_t *pstcSlot, uint16_t u16SlotNum,
+                             uint16_t u16CycleLength, uint8_t u8CycleNum)
+{
+    uint32_t i;
+    uint32_t j;
+    uint8_t u8Repeat;
+    stc_can_ttc_slot_t stcTmp;
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if ((pstcSched != NULL) && (pstcSlot != NULL) &&
+        IS_CAN_POWER_OF_2(u8CycleNum) && (u8CycleNum <= CAN_TTC_CYCLE_NUM_MAX)) {
+        i32Ret = LL_OK;
+        for (i = 0UL; i < u16SlotNum; i++) {
+            if ((pstcSlot[i].pstcFrame == NULL) || (pstcSlot[i].u16Offset == 0U) || (pstcSlot[i].u16Length == 0U) ||
+                (((uint32_t)pstcSlot[i].u16Offset + pstcSlot[i].u16Length) > u16CycleLength) ||
+                (!IS_CAN_POWER_OF_2(pstcSlot[i].u8Repeat)) || (pstcSlot[i].u8Repeat > u8CycleNum) ||
+                (pstcSlot[i].u8BaseCycle >= pstcSlot[i].u8Repeat) ||
+                (!IS_TTCAN_TX_EN_WINDOW(pstcSlot[i].u8TxEnableWindow))) {
+                i32Ret = LL_ERR_INVD_PARAM;
+                break;
+            }
+        }
+    }
+
+    if (i32Ret == LL_OK) {
+        /* Insertion sort by trigger time, the matrix is small and mostly sorted */
+        for (i = 1UL; i < u16SlotNum; i++) {
+            stcTmp = pstcSlot[i];
+            j = i;
+            while ((j > 0UL) && (pstcSlot[j - 1UL].u16Offset > stcTmp.u16Offset)) {
+                pstcSlot[j] = pstcSlot[j - 1UL];
+                j--;
+            }
+            pstcSlot[j] = stcTmp;
+        }
+
+        /* Two slots share a basic cycle when their base cycles match modulo the smaller repetition */
+        for (i = 0UL; (i < u16SlotNum) && (i32Ret == LL_OK); i++) {
+            for (j = i + 1UL; j < u16SlotNum; j++) {
+                if (pstcSlot[j].u16Offset >= ((uint32_t)pstcSlot[i].u16Offset + pstcSlot[i].u16Length)) {
+                    break;
+                }
+                u8Repeat = LL_MIN(pstcSlot[i].u8Repeat, pstcSlot[j].u8Repeat);
+                if (((pstcSlot[i].u8BaseCycle ^ pstcSlot[j].u8BaseCycle) & (u8Repeat - 1U)) == 0U) {
+                    i32Ret = LL_ERR;
+                    break;
+                }
+            }
+        }
+    }
+
+    if (i32Ret == LL_OK) {
+        pstcSched->pstcSlot       = pstcSlot;
+        pstcSched->u16SlotNum     = u16SlotNum;
+        pstcSched->u16CycleLength = u16CycleLength;
+        pstcSched->u8CycleNum     = u8CycleNum;
+        pstcSched->u8Cycle        = 0U;
+        pstcSched->u16Armed       = u16SlotNum;
+        pstcSched->u8TxBuf        = CAN_TTC_TX_BUF_PTB;
+        pstcSched->u32MissCount   = 0UL;
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Load a TTCAN schedule from a binary table and compile it.
+ * @param  [out] pstcSched              Pointer to a @ref stc_can_ttc_sched_t structure.
+ * @param  [out] pstcSlot               Slot buffer which is used to save the decoded slots.
+ * @param  [in]  u16SlotBufNum          Number of slots of the slot buffer.
+ * @param  [in]  pu8Table               Binary table, see @ref TTCAN_Sched_Table.
+ * @param  [in]  u32TableSize           Size of the binary table in bytes.
+ * @param  [in]  pstcFrame              Frames referenced by the frame index of the slot records.
+ * @param  [in]  u16FrameNum            Number of the frames.
+ * @retval int32_t:
+ *           - LL_OK:                   No error occurred.
+ *           - LL_ERR_INVD_PARAM:       Invalid parameter or malformed table.
+ *           - LL_ERR:                  Two slots overlap.
+ */
+int32_t CAN_TTC_SchedLoad(stc_can_ttc_sched_t *pstcSched, stc_can_ttc_slot_t *pstcSlot, uint16_t u16SlotBufNum,
+                          const uint8_t *pu8Table, uint32_t u32TableSize,
+                          const stc_can_tx_frame_t *pstcFrame, uint16_t u16FrameNum)
+{
+    uint32_t i;
+    uint16_t u16SlotNum;
+    const uint8_t *pu8Rec;
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if ((pstcSlot != NULL) && (pu8Table != NULL) && (pstcFrame != NULL) &&
+        (u32TableSize >= CAN_TTC_SCHED_TBL_HDR_SIZE) &&
+        (pu8Table[0U] == CAN_TTC_SCHED_TBL_MAGIC0) && (pu8Table[1U] == CAN_TTC_SCHED_TBL_MAGIC1) &&
+        (pu8Table[2U] == CAN_TTC_SCHED_TBL_VER)) {
+        u16SlotNum = (uint16_t)pu8Table[6U] | (uint16_t)((uint16_t)pu8Table[7U] << 8U);
+        if ((u16SlotNum <= u16SlotBufNum) &&
+            (u32TableSize >= (CAN_TTC_SCHED_TBL_HDR_SIZE + ((uint32_t)u16SlotNum * CAN_TTC_SCHED_TBL_SLOT_SIZE)))) {
+            i32Ret = LL_OK;
+            for (i = 0UL; i < u16SlotNum; i++) {
+                pu8Rec = &pu8Table[CAN_TTC_SCHED_TBL_HDR_SIZE + (i * CAN_TTC_SCHED_TBL_SLOT_SIZE)];
+                if (pu8Rec[7U] >= u16FrameNum) {
+                    i32Ret = LL_ERR_INVD_PARAM;
+                    break;
+                }
+                pstcSlot[i].u16Offset        = (uint16_t)pu8Rec[0U] | (uint16_t)((uint16_t)pu8Rec[1U] << 8U);
+                pstcSlot[i].u16Length        = (uint16_t)pu8Rec[2U] | (uint16_t)((uint16_t)pu8Rec[3U] << 8U);
+                pstcSlot[i].u8BaseCycle      = pu8Rec[4U];
+                pstcSlot[i].u8Repeat         = pu8Rec[5U];
+                pstcSlot[i].u8TxEnableWindow = pu8Rec[6U];
+                pstcSlot[i].pstcFrame        = &pstcFrame[pu8Rec[7U]];
+            }
+            if (i32Ret == LL_OK) {
+                i32Ret = CAN_TTC_SchedCompile(pstcSched, pstcSlot, u16SlotNum,
+                                              (uint16_t)pu8Table[4U] | (uint16_t)((uint16_t)pu8Table[5U] << 8U),
+                                              pu8Table[3U]);
+            }
+        }
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Start running a TTCAN schedule.
+ * @note   TTCAN must have been configured by CAN_TTC_Config() with CAN_TTC_TX_BUF_MD_TTCAN and enabled
+ *         by CAN_TTC_Cmd(). The first slot is armed at the start of the next basic cycle, which becomes
+ *         basic cycle 0 of the matrix. CAN_TTC_SchedIrqHandler() must be called from the CAN interrupt.
+ * @param  [in]  CANx                   Pointer to CAN instance register base.
+ *                                      This parameter can be a value of the following:
+ *   @arg  CM_CAN or CM_CANx:           CAN instance register base.
+ * @param  [in]  pstcSched              Pointer to a @ref stc_can_ttc_sched_t structure.
+ * @retval int32_t:
+ *           - LL_OK:                   No error occurred.
+ *           - LL_ERR_INVD_PARAM:       pstcSched == NULL.
+ */
+int32_t CAN_TTC_SchedStart(CM_CAN_TypeDef *CANx, stc_can_ttc_sched_t *pstcSched)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    DDL_ASSERT(IS_CAN_UNIT(CANx));
+
+    if (pstcSched != NULL) {
+        pstcSched->u8Cycle      = pstcSched->u8CycleNum - 1U;
+        pstcSched->u8TxBuf      = CAN_TTC_TX_BUF_PTB;
+        pstcSched->u32MissCount = 0UL;
+        CAN_TTC_ClearStatus(CANx, CAN_TTC_FLAG_TIME_TRIG | CAN_TTC_FLAG_TRIG_ERR);
+        CAN_TTC_SchedArm(CANx, pstcSched, pstcSched->u16SlotNum);
+        CAN_TTC_IntCmd(CANx, CAN_TTC_INT_TIME_TRIG, ENABLE);
+        i32Ret = LL_OK;
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Stop running the TTCAN schedule.
+ * @param  [in]  CANx                   Pointer to CAN instance register base.
+ *                                      This parameter can be a value of the following:
+ *   @arg  CM_CAN or CM_CANx:           CAN instance register base.
+ * @retval None
+ */
+void CAN_TTC_SchedStop(CM_CAN_TypeDef *CANx)
+{
+    DDL_ASSERT(IS_CAN_UNIT(CANx));
+
+    CAN_TTC_IntCmd(CANx, CAN_TTC_INT_TIME_TRIG, DISABLE);
+    CAN_TTC_ClearStatus(CANx, CAN_TTC_FLAG_TIME_TRIG | CAN_TTC_FLAG_TRIG_ERR);
+}
+
+/**
+ * @brief  Set the current basic cycle of a TTCAN schedule, e.g. to the cycle count of the time master.
+ * @param  [in]  pstcSched              Pointer to a @ref stc_can_ttc_sched_t structure.
+ * @param  [in]  u8Cycle                Basic cycle, less than the number of basic cycles of the matrix.
+ * @retval None
+ * @note   Call it with the CAN interrupt masked. The new cycle is used from the next slot armed.
+ */
+void CAN_TTC_SchedSetCycle(stc_can_ttc_sched_t *pstcSched, uint8_t u8Cycle)
+{
+    DDL_ASSERT(pstcSched != NULL);
+    DDL_ASSERT(u8Cycle < pstcSched->u8CycleNum);
+
+    pstcSched->u8Cycle = u8Cycle;
+}
+
+/**
+ * @brief  Get the number of slots of a TTCAN schedule which were not transmitted because all the
+ *         transmit buffers were still filled.
+ * @param  [in]  pstcSched              Pointer to a @ref stc_can_ttc_sched_t structure.
+ * @retval uint32_t                     Number of missed slots since CAN_TTC_SchedStart().
+ */
+uint32_t CAN_TTC_SchedGetMissCount(const stc_can_ttc_sched_t *pstcSched)
+{
+    DDL_ASSERT(pstcSched != NULL);
+
+    return pstcSched->u32MissCount;
+}
+
+/**
+ * @brief  TTCAN schedule interrupt handler, call it from the CAN interrupt.
+ * @note   Each time trigger arms the next slot: its frame is written into the next transmit buffer
+ *         and the trigger time is programmed, so no application code runs per slot. When that buffer
+ *         still holds an unsent frame, the slot is counted as missed instead, see
+ *         CAN_TTC_SchedGetMissCount().
+ * @param  [in]  CANx                   Pointer to CAN instance register base.
+ *                                      This parameter can be a value of the following:
+ *   @arg  CM_CAN or CM_CANx:           CAN instance register base.
+ * @param  [in]  pstcSched              Pointer to a @ref stc_can_ttc_sched_t structure.
+ * @retval None
+ */
+void CAN_TTC_SchedIrqHandler(CM_CAN_TypeDef *CANx, stc_can_ttc_sched_t *pstcSched)
+{
+    uint16_t u16Next;
+
+    DDL_ASSERT(IS_CAN_UNIT(CANx));
+    DDL_ASSERT(pstcSched != NULL);
+
+    if (CAN_TTC_GetStatus(CANx, CAN_TTC_FLAG_TIME_TRIG) == SET) {
+        CAN_TTC_ClearStatus(CANx, CAN_TTC_FLAG_TIME_TRIG | CAN_TTC_FLAG_TRIG_ERR);
+        if (pstcSched->u16Armed >= pstcSched->u16SlotNum) {
+            /* A new basic cycle started */
+            pstcSched->u8Cycle = (pstcSched->u8Cycle + 1U) & (pstcSched->u8CycleNum - 1U);
+            u16Next = 0U;
+        } else {
+            u16Next = pstcSched->u16Armed + 1U;
+        }
+        CAN_TTC_SchedArm(CANx, pstcSched, u16Next);
+    }
+}
+
 /**
  * @}
  */
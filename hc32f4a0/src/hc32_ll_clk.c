@@ -16,6 +16,10 @@
    2024-08-31       CDT             Modify CLK_PLLXM_DIV_MAX as 25U
                                     Modify CLK_PLLXM_DIV_MIN as 1U
    2024-11-08       CDT             Delete group definition for CLK_FREQ
+   2026-10-19       CDT             Cache bus clock frequencies and notify their changes
+                                    Re-validate the bus clock frequency cache against the clock registers on read
+                                    Add API CLK_ChangeBegin() and CLK_ChangeEnd() grouping the steps of a change
+                                    Call the notifiers from the changing APIs only, not from the getters
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2022-2025, Xiaohua Semiconductor Co., Ltd. All rights reserved.
@@ -413,6 +417,11 @@
     ((x) == CLK_BUS_PCLK3)                        ||                           \
     ((x) == CLK_BUS_PCLK4))
 
+/* Parameter valid check for the event ending a change */
+#define IS_CLK_NOTIFY_END(x)                                                   \
+(   ((x) == CLK_NOTIFY_POST)                      ||                           \
+    ((x) == CLK_NOTIFY_ABORT))
+
 /* Parameter valid check for USB clock source */
 #define IS_CLK_USBCLK_SRC(x)                                                   \
 (   ((x) == CLK_USBCLK_SYSCLK_DIV2)               ||                           \
@@ -519,6 +528,17 @@
 /*******************************************************************************
  * Local variable definitions ('static')
  ******************************************************************************/
+/* Bus clock frequencies, refreshed by the APIs changing them, and the clock registers they come from */
+static stc_clock_freq_t m_stcClockFreq;
+static uint8_t m_u8ClockFreqValid = 0U;
+static uint8_t m_u8ClockCkswr;
+static uint32_t m_u32ClockPllhcfgr;
+static uint32_t m_u32ClockScfgr;
+static stc_clock_notify_t *m_pstcClockNotify = NULL;
+/* Set between CLK_ChangeBegin() and CLK_ChangeEnd(), the notifiers are not called for the steps */
+static uint8_t m_u8ClockChange = 0U;
+/* Set when a refresh changed the cache, cleared by the API calling the notifiers for it */
+static uint8_t m_u8ClockNotifyPend = 0U;
 
 /*******************************************************************************
  * Function implementation - global ('extern') and local ('static')
@@ -679,6 +699,127 @@ static void GetClockFreq(stc_clock_freq_t *pstcClockFreq)
     pstcClockFreq->u32Pclk2Freq = pstcClockFreq->u32SysclkFreq >> pstcClockScale->SCFGR_f.PCLK2S;
 }
 
+/**
+ * @brief  Call the notifiers.
+ * @param  [in] pstcEnd         Notifier after the last one called, NULL for all.
+ * @param  [in] u32Event        A value of @ref CLK_Notify_Event.
+ * @param  [in] pstcClockFreq   Frequencies passed to the callbacks.
+ * @retval stc_clock_notify_t*: The notifier refusing CLK_NOTIFY_PRE, or NULL
+ * @note   The links, callback and argument are read with the interrupts masked, so that an interrupt
+ *         registering or unregistering a notifier is seen whole. The callbacks run unmasked.
+ */
+static stc_clock_notify_t *NotifyClockFreq(const stc_clock_notify_t *pstcEnd, uint32_t u32Event,
+                                           const stc_clock_freq_t *pstcClockFreq)
+{
+    stc_clock_notify_t *pstcNotify;
+    stc_clock_notify_t *pstcNext;
+    func_ptr_clk_notify_t pfnCallback;
+    void *pvArg;
+    uint32_t u32Primask;
+
+    u32Primask = __get_PRIMASK();
+    __disable_irq();
+    pstcNotify = m_pstcClockNotify;
+    __set_PRIMASK(u32Primask);
+    while (pstcNotify != pstcEnd) {
+        /* A callback may unregister its own notifier */
+        __disable_irq();
+        pstcNext    = pstcNotify->pstcNext;
+        pfnCallback = pstcNotify->pfnCallback;
+        pvArg       = pstcNotify->pvArg;
+        __set_PRIMASK(u32Primask);
+        if ((LL_OK != pfnCallback(u32Event, pstcClockFreq, pvArg)) && (CLK_NOTIFY_PRE == u32Event)) {
+            break;
+        }
+        pstcNotify = pstcNext;
+    }
+    return pstcNotify;
+}
+
+/**
+ * @brief  Refresh the bus clock frequency cache, without calling the notifiers.
+ * @param  None
+ * @retval None
+ * @note   A change of the frequencies is left pending for UpdateClockFreq() or CLK_ChangeEnd().
+ */
+static void RefreshClockFreq(void)
+{
+    stc_clock_freq_t stcClockFreq;
+    uint32_t u32Primask;
+    uint32_t u32Pllhcfgr;
+    uint32_t u32Scfgr;
+    uint8_t u8Ckswr;
+    uint8_t u8Changed;
+
+    /* Read before the decode, a change in between is seen by the next ClockFreqValid() */
+    u8Ckswr     = (uint8_t)READ_REG8_BIT(CM_CMU->CKSWR, CMU_CKSWR_CKSW);
+    u32Pllhcfgr = READ_REG32(CM_CMU->PLLHCFGR);
+    u32Scfgr    = READ_REG32(CM_CMU->SCFGR);
+    GetClockFreq(&stcClockFreq);
+
+    u32Primask = __get_PRIMASK();
+    __disable_irq();
+    u8Changed = (uint8_t)((0U == m_u8ClockFreqValid)                                  ||
+                          (stcClockFreq.u32SysclkFreq != m_stcClockFreq.u32SysclkFreq) ||
+                          (stcClockFreq.u32HclkFreq   != m_stcClockFreq.u32HclkFreq)   ||
+                          (stcClockFreq.u32Pclk0Freq  != m_stcClockFreq.u32Pclk0Freq)  ||
+                          (stcClockFreq.u32Pclk1Freq  != m_stcClockFreq.u32Pclk1Freq)  ||
+                          (stcClockFreq.u32Pclk2Freq  != m_stcClockFreq.u32Pclk2Freq)  ||
+                          (stcClockFreq.u32Pclk3Freq  != m_stcClockFreq.u32Pclk3Freq)  ||
+                          (stcClockFreq.u32Pclk4Freq  != m_stcClockFreq.u32Pclk4Freq)  ||
+                          (stcClockFreq.u32ExclkFreq  != m_stcClockFreq.u32ExclkFreq));
+    m_stcClockFreq     = stcClockFreq;
+    m_u8ClockCkswr     = u8Ckswr;
+    m_u32ClockPllhcfgr = u32Pllhcfgr;
+    m_u32ClockScfgr    = u32Scfgr;
+    m_u8ClockFreqValid = 1U;
+    if (0U != u8Changed) {
+        m_u8ClockNotifyPend = 1U;
+    }
+    __set_PRIMASK(u32Primask);
+}
+
+/**
+ * @brief  Refresh the bus clock frequency cache and call the notifiers if it changed.
+ * @param  None
+ * @retval None
+ * @note   A change seen by a read since the last call is reported as well. Between CLK_ChangeBegin()
+ *         and CLK_ChangeEnd() only the cache is refreshed.
+ */
+static void UpdateClockFreq(void)
+{
+    stc_clock_freq_t stcClockFreq;
+    uint32_t u32Primask;
+    uint8_t u8Notify = 0U;
+
+    RefreshClockFreq();
+    u32Primask = __get_PRIMASK();
+    __disable_irq();
+    if (0U == m_u8ClockChange) {
+        u8Notify = m_u8ClockNotifyPend;
+        m_u8ClockNotifyPend = 0U;
+    }
+    stcClockFreq = m_stcClockFreq;
+    __set_PRIMASK(u32Primask);
+
+    if (0U != u8Notify) {
+        (void)NotifyClockFreq(NULL, CLK_NOTIFY_POST, &stcClockFreq);
+    }
+}
+
+/**
+ * @brief  Check the bus clock frequency cache against the clock registers.
+ * @param  None
+ * @retval uint8_t: 1 if the cache is filled and its registers are unchanged, else 0
+ */
+static uint8_t ClockFreqValid(void)
+{
+    return (uint8_t)((0U != m_u8ClockFreqValid)                                        &&
+                     (READ_REG8_BIT(CM_CMU->CKSWR, CMU_CKSWR_CKSW) == m_u8ClockCkswr) &&
+                     (READ_REG32(CM_CMU->PLLHCFGR) == m_u32ClockPllhcfgr)             &&
+                     (READ_REG32(CM_CMU->SCFGR) == m_u32ClockScfgr));
+}
+
 static void SetSysClockDiv(uint32_t u32Clock, uint32_t u32Div)
 {
     uint8_t u8TmpFlag = 0U;
@@ -1274,6 +1415,7 @@ int32_t CLK_PLLInit(const stc_clock_pll_init_t *pstcPLLInit)
         } else {
             i32Ret = CLK_PLLCmd(DISABLE);
         }
+        UpdateClockFreq();
     }
 
     return i32Ret;
@@ -1474,6 +1616,7 @@ void CLK_SetSysClockSrc(uint8_t u8Src)
     SetSysClockSrc(u8Src);
     /* Update system clock */
     SystemCoreClockUpdate();
+    UpdateClockFreq();
 }
 
 /**
@@ -1482,6 +1625,10 @@ void CLK_SetSysClockSrc(uint8_t u8Src)
  * @retval int32_t:
  *         - LL_OK: Initialize success
  *         - LL_ERR_INVD_PARAM: NULL pointer
+ * @note   The frequencies come from the cache refreshed by CLK_SetSysClockSrc(), CLK_SetClockDiv(),
+ *         CLK_PLLInit() and CLK_UpdateClockFreq(). A cache whose clock switch, PLLH or divider register
+ *         was written since is refreshed first. The notifiers are not called, the change is reported
+ *         by the next API calling them, so the getters may be called from an interrupt.
  */
 int32_t CLK_GetClockFreq(stc_clock_freq_t *pstcClockFreq)
 {
@@ -1490,7 +1637,10 @@ int32_t CLK_GetClockFreq(stc_clock_freq_t *pstcClockFreq)
     if (NULL == pstcClockFreq) {
         i32Ret = LL_ERR_INVD_PARAM;
     } else {
-        GetClockFreq(pstcClockFreq);
+        if (0U == ClockFreqValid()) {
+            RefreshClockFreq();
+        }
+        *pstcClockFreq = m_stcClockFreq;
     }
     return i32Ret;
 }
@@ -1498,44 +1648,195 @@ int32_t CLK_GetClockFreq(stc_clock_freq_t *pstcClockFreq)
 /**
  * @brief  Get bus clock frequency.
  * @param  [in] u32Clock specifies the bus clock to get frequency. @ref CLK_Bus_Clock_Sel
- * @retval int32_t:
- *         - LL_OK: Initialize success
- *         - LL_ERR_INVD_PARAM: NULL pointer
+ * @retval uint32_t: The bus clock frequency
+ * @note   The frequency comes from the cache, see CLK_GetClockFreq().
  */
 uint32_t CLK_GetBusClockFreq(uint32_t u32Clock)
 {
     uint32_t u32ClockFreq;
     DDL_ASSERT(IS_CLK_BUS_CLK(u32Clock));
 
+    if (0U == ClockFreqValid()) {
+        RefreshClockFreq();
+    }
     switch (u32Clock) {
         case CLK_BUS_HCLK:
-            u32ClockFreq = SystemCoreClock >> (READ_REG32_BIT(CM_CMU->SCFGR, CMU_SCFGR_HCLKS) >> CMU_SCFGR_HCLKS_POS);
+            u32ClockFreq = m_stcClockFreq.u32HclkFreq;
             break;
         case CLK_BUS_PCLK1:
-            u32ClockFreq = SystemCoreClock >> (READ_REG32_BIT(CM_CMU->SCFGR, CMU_SCFGR_PCLK1S) >> CMU_SCFGR_PCLK1S_POS);
+            u32ClockFreq = m_stcClockFreq.u32Pclk1Freq;
             break;
         case CLK_BUS_PCLK4:
-            u32ClockFreq = SystemCoreClock >> (READ_REG32_BIT(CM_CMU->SCFGR, CMU_SCFGR_PCLK4S) >> CMU_SCFGR_PCLK4S_POS);
+            u32ClockFreq = m_stcClockFreq.u32Pclk4Freq;
             break;
         case CLK_BUS_PCLK3:
-            u32ClockFreq = SystemCoreClock >> (READ_REG32_BIT(CM_CMU->SCFGR, CMU_SCFGR_PCLK3S) >> CMU_SCFGR_PCLK3S_POS);
+            u32ClockFreq = m_stcClockFreq.u32Pclk3Freq;
             break;
         case CLK_BUS_EXCLK:
-            u32ClockFreq = SystemCoreClock >> (READ_REG32_BIT(CM_CMU->SCFGR, CMU_SCFGR_EXCKS) >> CMU_SCFGR_EXCKS_POS);
+            u32ClockFreq = m_stcClockFreq.u32ExclkFreq;
             break;
         case CLK_BUS_PCLK0:
-            u32ClockFreq = SystemCoreClock >> (READ_REG32_BIT(CM_CMU->SCFGR, CMU_SCFGR_PCLK0S) >> CMU_SCFGR_PCLK0S_POS);
+            u32ClockFreq = m_stcClockFreq.u32Pclk0Freq;
             break;
         case CLK_BUS_PCLK2:
-            u32ClockFreq = SystemCoreClock >> (READ_REG32_BIT(CM_CMU->SCFGR, CMU_SCFGR_PCLK2S) >> CMU_SCFGR_PCLK2S_POS);
+            u32ClockFreq = m_stcClockFreq.u32Pclk2Freq;
             break;
         default:
-            u32ClockFreq = SystemCoreClock;
+            u32ClockFreq = m_stcClockFreq.u32SysclkFreq;
             break;
     }
     return u32ClockFreq;
 }
 
+/**
+ * @brief  Refresh the bus clock frequency cache from the clock registers.
+ * @param  None
+ * @retval None
+ * @note   Also updates SystemCoreClock. After the clock registers are written without the CLK APIs the
+ *         cache is refreshed by the next read as well, this also calls the notifiers for the change.
+ */
+void CLK_UpdateClockFreq(void)
+{
+    SystemCoreClockUpdate();
+    UpdateClockFreq();
+}
+
+/**
+ * @brief  Register a notifier called when the bus clock frequencies change.
+ * @param  [in] pstcNotify  Pointer to a @ref stc_clock_notify_t structure, kept by the driver until
+ *                          CLK_UnregisterNotify().
+ * @param  [in] pfnCallback Callback, called in the context of the API changing the frequencies.
+ *                          A change by a single API gives CLK_NOTIFY_POST only, see CLK_ChangeBegin()
+ *                          for a change of several steps.
+ * @param  [in] pvArg       Argument of the callback.
+ * @retval int32_t:
+ *         - LL_OK: No error occurred
+ *         - LL_ERR_INVD_PARAM: pstcNotify == NULL or pfnCallback == NULL
+ * @note   Registering a registered notifier changes its callback.
+ */
+int32_t CLK_RegisterNotify(stc_clock_notify_t *pstcNotify, func_ptr_clk_notify_t pfnCallback, void *pvArg)
+{
+    stc_clock_notify_t *pstcIter;
+    uint32_t u32Primask;
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if ((NULL != pstcNotify) && (NULL != pfnCallback)) {
+        u32Primask = __get_PRIMASK();
+        __disable_irq();
+        pstcNotify->pfnCallback = pfnCallback;
+        pstcNotify->pvArg       = pvArg;
+        pstcIter = m_pstcClockNotify;
+        while ((NULL != pstcIter) && (pstcIter != pstcNotify)) {
+            pstcIter = pstcIter->pstcNext;
+        }
+        if (NULL == pstcIter) {
+            pstcNotify->pstcNext = m_pstcClockNotify;
+            m_pstcClockNotify = pstcNotify;
+        }
+        __set_PRIMASK(u32Primask);
+        i32Ret = LL_OK;
+    }
+    return i32Ret;
+}
+
+/**
+ * @brief  Unregister a notifier.
+ * @param  [in] pstcNotify  Pointer to a @ref stc_clock_notify_t structure.
+ * @retval int32_t:
+ *         - LL_OK: No error occurred
+ *         - LL_ERR: The notifier is not registered
+ *         - LL_ERR_INVD_PARAM: pstcNotify == NULL
+ */
+int32_t CLK_UnregisterNotify(stc_clock_notify_t *pstcNotify)
+{
+    stc_clock_notify_t **ppstcLink;
+    uint32_t u32Primask;
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if (NULL != pstcNotify) {
+        i32Ret = LL_ERR;
+        u32Primask = __get_PRIMASK();
+        __disable_irq();
+        ppstcLink = &m_pstcClockNotify;
+        while (NULL != *ppstcLink) {
+            if (*ppstcLink == pstcNotify) {
+                *ppstcLink = pstcNotify->pstcNext;
+                i32Ret = LL_OK;
+                break;
+            }
+            ppstcLink = &(*ppstcLink)->pstcNext;
+        }
+        __set_PRIMASK(u32Primask);
+    }
+    return i32Ret;
+}
+
+/**
+ * @brief  Begin a bus clock frequency change of several steps.
+ * @param  [in] pstcClockFreq Pointer to a @ref stc_clock_freq_t structure, the frequencies to come.
+ * @retval int32_t:
+ *         - LL_OK: No error occurred, CLK_ChangeEnd() must follow
+ *         - LL_ERR_BUSY: A notifier refused the change or another change is running, nothing changed
+ *         - LL_ERR_INVD_PARAM: pstcClockFreq == NULL
+ * @note   The notifiers get CLK_NOTIFY_PRE, any of them may refuse. Those before the refusing one
+ *         then get CLK_NOTIFY_ABORT with the current frequencies. Until CLK_ChangeEnd() the CLK
+ *         APIs refresh the frequency cache without calling the notifiers, so no notifier sees the
+ *         intermediate steps.
+ */
+int32_t CLK_ChangeBegin(const stc_clock_freq_t *pstcClockFreq)
+{
+    const stc_clock_notify_t *pstcRefuse;
+    stc_clock_freq_t stcClockFreq;
+    uint32_t u32Primask;
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if (NULL != pstcClockFreq) {
+        i32Ret = LL_ERR_BUSY;
+        u32Primask = __get_PRIMASK();
+        __disable_irq();
+        if (0U == m_u8ClockChange) {
+            m_u8ClockChange = 1U;
+            i32Ret = LL_OK;
+        }
+        __set_PRIMASK(u32Primask);
+
+        if (LL_OK == i32Ret) {
+            pstcRefuse = NotifyClockFreq(NULL, CLK_NOTIFY_PRE, pstcClockFreq);
+            if (NULL != pstcRefuse) {
+                (void)CLK_GetClockFreq(&stcClockFreq);
+                (void)NotifyClockFreq(pstcRefuse, CLK_NOTIFY_ABORT, &stcClockFreq);
+                m_u8ClockChange = 0U;
+                i32Ret = LL_ERR_BUSY;
+            }
+        }
+    }
+    return i32Ret;
+}
+
+/**
+ * @brief  End a bus clock frequency change begun by CLK_ChangeBegin().
+ * @param  [in] u32Event    CLK_NOTIFY_POST when the change completed, CLK_NOTIFY_ABORT when a
+ *                          step failed.
+ * @retval None
+ * @note   The notifiers get u32Event with the frequencies the clocks are at, even if they did not
+ *         change.
+ */
+void CLK_ChangeEnd(uint32_t u32Event)
+{
+    stc_clock_freq_t stcClockFreq;
+    uint32_t u32Primask;
+
+    DDL_ASSERT(IS_CLK_NOTIFY_END(u32Event));
+
+    (void)CLK_GetClockFreq(&stcClockFreq);
+    u32Primask = __get_PRIMASK();
+    __disable_irq();
+    m_u8ClockChange     = 0U;
+    m_u8ClockNotifyPend = 0U;
+    __set_PRIMASK(u32Primask);
+    (void)NotifyClockFreq(NULL, u32Event, &stcClockFreq);
+}
+
 /**
  * @brief  Get PLL clock frequency.
  * @param  [out] pstcPllClkFreq specifies the pointer to get PLL frequency.
@@ -1608,6 +1909,7 @@ void CLK_SetClockDiv(uint32_t u32Clock, uint32_t u32Div)
     SetSysClockDiv(u32Clock, u32Div);
     /* Update system clock */
     SystemCoreClockUpdate();
+    UpdateClockFreq();
 }
 
 /**
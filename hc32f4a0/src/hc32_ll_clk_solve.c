@@ -0,0 +1,539 @@
+/**
+ *******************************************************************************
+ * @file  hc32_ll_clk_solve.c
+ * @brief This file provides firmware functions to compute the PLL and bus
+ *        clock settings of target frequencies.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2025, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ll_clk_solve.h"
+#include "hc32_ll_efm.h"
+#include "hc32_ll_utility.h"
+
+/**
+ * @addtogroup LL_Driver
+ * @{
+ */
+
+/**
+ * @defgroup LL_CLK_SOLVE CLK_SOLVE
+ * @brief Clock Tree Solver Driver Library
+ * @note  CLK_SOLVE_PLL() and CLK_SOLVE_PLLx() search every M and N within the limits checked by
+ *        CLK_PLLInit() and CLK_PLLxInit(), and for each VCO the P, Q and R dividers nearest to the
+ *        wanted outputs. The setting with the smallest largest error wins; between equal errors
+ *        the higher VCO input, that is the smaller N multiplying the reference noise, and then
+ *        the lower VCO output are preferred. An output without wanted frequency gets the
+ *        lowest legal frequency.
+ *        CLK_SOLVE_Config() adds the bus dividers and the EFM read wait cycle of the system
+ *        clock, and CLK_SOLVE_Apply() writes such a configuration at boot.
+ *        Only CLK_SOLVE_Apply() accesses registers. With LL_EFM_ENABLE off it is left out, and
+ *        the file builds into a host tool generating a verified table of configurations.
+ * @{
+ */
+
+#if (LL_CLK_SOLVE_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @brief PLL limits structure definition
+ */
+typedef struct {
+    uint32_t u32MMax;                   /*!< Largest M divider */
+    uint32_t u32NMin;                   /*!< Smallest N multiplier */
+    uint32_t u32NMax;                   /*!< Largest N multiplier */
+    uint32_t u32VcoInMin;               /*!< Lowest VCO input */
+    uint32_t u32VcoInMax;               /*!< Highest VCO input */
+    uint32_t u32VcoOutMin;              /*!< Lowest VCO output */
+    uint32_t u32VcoOutMax;              /*!< Highest VCO output */
+    uint32_t u32FreqMin;                /*!< Lowest P/Q/R output */
+    uint32_t u32FreqMax;                /*!< Highest P/Q/R output */
+} stc_clk_solve_limit_t;
+
+/**
+ * @brief PLL setting structure definition
+ */
+typedef struct {
+    uint32_t u32M;                      /*!< M divider */
+    uint32_t u32N;                      /*!< N multiplier */
+    uint32_t au32Div[3U];               /*!< P, Q and R dividers */
+    uint32_t u32VcoIn;                  /*!< VCO input */
+    uint32_t u32VcoOut;                 /*!< VCO output */
+    uint64_t u64Err;                    /*!< Largest error in ppb */
+} stc_clk_solve_pll_t;
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup CLK_SOLVE_Local_Macros CLK_SOLVE Local Macros
+ * @{
+ */
+/* P/Q/R divider range, the same for PLLH and PLLA */
+#define CLK_SOLVE_DIV_MIN               (2UL)
+#define CLK_SOLVE_DIV_MAX               (16UL)
+
+#define CLK_SOLVE_PPM                   (1000000ULL)
+#define CLK_SOLVE_PPB                   (1000000000ULL)
+
+/* Largest divider of @ref CLK_System_Clock_Divider */
+#define CLK_SOLVE_SYSCLK_DIV_MAX        (CLK_SYSCLK_DIV64)
+#define CLK_SOLVE_WAIT_CYCLE_MAX        (15UL)
+
+/**
+ * @defgroup CLK_SOLVE_Check_Parameters_Validity CLK_SOLVE Check Parameters Validity
+ * @{
+ */
+#define IS_CLK_SOLVE_PLL_SRC(x)         (((x) == CLK_PLL_SRC_XTAL) || ((x) == CLK_PLL_SRC_HRC))
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+/* Limits of PLLH, see PLL parameter range of the CLK driver */
+static const stc_clk_solve_limit_t m_stcPllLimit = {
+    4UL, 25UL, 150UL,
+    8UL * 1000UL * 1000UL, 25UL * 1000UL * 1000UL,
+    600UL * 1000UL * 1000UL, 1200UL * 1000UL * 1000UL,
+    375UL * 100UL * 1000UL, 240UL * 1000UL * 1000UL
+};
+
+/* Limits of PLLA, see PLLx parameter range of the CLK driver */
+static const stc_clk_solve_limit_t m_stcPllxLimit = {
+    25UL, 20UL, 480UL,
+    1UL * 1000UL * 1000UL, 25UL * 1000UL * 1000UL,
+    240UL * 1000UL * 1000UL, 480UL * 1000UL * 1000UL,
+    15UL * 1000UL * 1000UL, 240UL * 1000UL * 1000UL
+};
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @defgroup CLK_SOLVE_Local_Functions CLK_SOLVE Local Functions
+ * @{
+ */
+
+/**
+ * @brief  Error of an output.
+ * @param  [in] u64Num                  Input frequency times N.
+ * @param  [in] u64Den                  M times the divider.
+ * @param  [in] u32Target               Wanted frequency.
+ * @retval uint64_t                     Error in ppb.
+ */
+static uint64_t OutputErr(uint64_t u64Num, uint64_t u64Den, uint32_t u32Target)
+{
+    uint64_t u64Want = (uint64_t)u32Target * u64Den;
+    uint64_t u64Diff = (u64Num > u64Want) ? (u64Num - u64Want) : (u64Want - u64Num);
+
+    return (u64Diff * CLK_SOLVE_PPB) / u64Want;
+}
+
+/**
+ * @brief  Choose the divider of an output.
+ * @param  [in] pstcLimit               Limits of the PLL.
+ * @param  [in] u32VcoOut               VCO output as checked by the CLK driver.
+ * @param  [in] u64Num                  Input frequency times N.
+ * @param  [in] u32M                    M divider.
+ * @param  [in] u32Target               Wanted frequency, 0 for don't care.
+ * @param  [out] pu64Err                Error of the chosen divider in ppb.
+ * @retval uint32_t                     Divider, 0 if no divider gives a legal output.
+ */
+static uint32_t OutputDiv(const stc_clk_solve_limit_t *pstcLimit, uint32_t u32VcoOut, uint64_t u64Num,
+                          uint32_t u32M, uint32_t u32Target, uint64_t *pu64Err)
+{
+    uint32_t u32Div;
+    uint32_t u32Best = 0UL;
+    uint32_t u32Freq;
+    uint32_t u32Near;
+    uint64_t u64Err;
+
+    *pu64Err = 0ULL;
+    if (0UL == u32Target) {
+        /* Lowest legal output */
+        for (u32Div = CLK_SOLVE_DIV_MAX; u32Div >= CLK_SOLVE_DIV_MIN; u32Div--) {
+            u32Freq = u32VcoOut / u32Div;
+            if ((u32Freq >= pstcLimit->u32FreqMin) && (u32Freq <= pstcLimit->u32FreqMax)) {
+                u32Best = u32Div;
+                break;
+            }
+        }
+    } else {
+        /* The nearest divider is one of the two around the ratio */
+        u32Near = u32VcoOut / u32Target;
+        for (u32Div = u32Near; u32Div <= (u32Near + 1UL); u32Div++) {
+            if ((u32Div < CLK_SOLVE_DIV_MIN) || (u32Div > CLK_SOLVE_DIV_MAX)) {
+                continue;
+            }
+            u32Freq = u32VcoOut / u32Div;
+            if ((u32Freq < pstcLimit->u32FreqMin) || (u32Freq > pstcLimit->u32FreqMax)) {
+                continue;
+            }
+            u64Err = OutputErr(u64Num, (uint64_t)u32M * u32Div, u32Target);
+            if ((0UL == u32Best) || (u64Err < *pu64Err)) {
+                u32Best  = u32Div;
+                *pu64Err = u64Err;
+            }
+        }
+    }
+    return u32Best;
+}
+
+/**
+ * @brief  Search the setting of a PLL.
+ * @param  [in] pstcTarget              Pointer to a @ref stc_clk_solve_target_t structure.
+ * @param  [in] pstcLimit               Limits of the PLL.
+ * @param  [out] pstcPll                Best setting.
+ * @param  [out] pstcResult             Pointer to a @ref stc_clk_solve_result_t structure, or NULL.
+ * @retval int32_t:
+ *           - LL_OK:                   A setting was found.
+ *           - LL_ERR:                  No setting meets the tolerance.
+ *           - LL_ERR_INVD_PARAM:       pstcTarget == NULL.
+ */
+static int32_t SolvePll(const stc_clk_solve_target_t *pstcTarget, const stc_clk_solve_limit_t *pstcLimit,
+                        stc_clk_solve_pll_t *pstcPll, stc_clk_solve_result_t *pstcResult)
+{
+    uint32_t au32Target[3U];
+    uint32_t au32Div[3U];
+    uint32_t u32M;
+    uint32_t u32N;
+    uint32_t i;
+    uint32_t u32VcoIn;
+    uint32_t u32VcoOut;
+    uint64_t u64Num;
+    uint64_t u64Err;
+    uint64_t u64Worst;
+    uint64_t u64Tol;
+    uint8_t u8Found = 0U;
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if (NULL != pstcTarget) {
+        DDL_ASSERT(IS_CLK_SOLVE_PLL_SRC(pstcTarget->u32PllSrc));
+
+        au32Target[0U] = pstcTarget->u32PFreq;
+        au32Target[1U] = pstcTarget->u32QFreq;
+        au32Target[2U] = pstcTarget->u32RFreq;
+        u64Tol = (uint64_t)pstcTarget->u32Tol * (CLK_SOLVE_PPB / CLK_SOLVE_PPM);
+
+        for (u32M = 1UL; u32M <= pstcLimit->u32MMax; u32M++) {
+            /* The CLK driver checks the truncated VCO frequencies */
+            u32VcoIn = pstcTarget->u32InFreq / u32M;
+            if ((u32VcoIn < pstcLimit->u32VcoInMin) || (u32VcoIn > pstcLimit->u32VcoInMax)) {
+                continue;
+            }
+            for (u32N = pstcLimit->u32NMin; u32N <= pstcLimit->u32NMax; u32N++) {
+                if (u32N > (pstcLimit->u32VcoOutMax / u32VcoIn)) {
+                    break;
+                }
+                u32VcoOut = u32VcoIn * u32N;
+                if (u32VcoOut < pstcLimit->u32VcoOutMin) {
+                    continue;
+                }
+
+                u64Num   = (uint64_t)pstcTarget->u32InFreq * u32N;
+                u64Worst = 0ULL;
+                for (i = 0UL; i < 3UL; i++) {
+                    au32Div[i] = OutputDiv(pstcLimit, u32VcoOut, u64Num, u32M, au32Target[i], &u64Err);
+                    if ((0UL == au32Div[i]) || (u64Err > u64Tol)) {
+                        break;
+                    }
+                    if (u64Err > u64Worst) {
+                        u64Worst = u64Err;
+                    }
+                }
+                if (i < 3UL) {
+                    continue;
+                }
+
+                /* M rises in the loop, so a tie keeps the higher VCO input */
+                if ((0U == u8Found) || (u64Worst < pstcPll->u64Err) ||
+                    ((u64Worst == pstcPll->u64Err) && (u32M == pstcPll->u32M) && (u32VcoOut < pstcPll->u32VcoOut))) {
+                    pstcPll->u32M        = u32M;
+                    pstcPll->u32N        = u32N;
+                    pstcPll->au32Div[0U] = au32Div[0U];
+                    pstcPll->au32Div[1U] = au32Div[1U];
+                    pstcPll->au32Div[2U] = au32Div[2U];
+                    pstcPll->u32VcoIn    = u32VcoIn;
+                    pstcPll->u32VcoOut   = u32VcoOut;
+                    pstcPll->u64Err      = u64Worst;
+                    u8Found = 1U;
+                }
+            }
+        }
+
+        if (0U == u8Found) {
+            i32Ret = LL_ERR;
+        } else {
+            if (NULL != pstcResult) {
+                u64Num = (uint64_t)pstcTarget->u32InFreq * pstcPll->u32N;
+                pstcResult->u32PFreq  = (uint32_t)(u64Num / ((uint64_t)pstcPll->u32M * pstcPll->au32Div[0U]));
+                pstcResult->u32QFreq  = (uint32_t)(u64Num / ((uint64_t)pstcPll->u32M * pstcPll->au32Div[1U]));
+                pstcResult->u32RFreq  = (uint32_t)(u64Num / ((uint64_t)pstcPll->u32M * pstcPll->au32Div[2U]));
+                pstcResult->u32VcoIn  = pstcPll->u32VcoIn;
+                pstcResult->u32VcoOut = (uint32_t)(u64Num / pstcPll->u32M);
+                pstcResult->u32Err    = (uint32_t)((pstcPll->u64Err + (CLK_SOLVE_PPB / CLK_SOLVE_PPM) - 1ULL) /
+                                                   (CLK_SOLVE_PPB / CLK_SOLVE_PPM));
+            }
+            i32Ret = LL_OK;
+        }
+    }
+    return i32Ret;
+}
+
+/**
+ * @brief  Smallest divider keeping a bus clock within its maximum.
+ * @param  [in] u32SysclkFreq           System clock frequency.
+ * @param  [in] u32Max                  Maximum of the bus clock.
+ * @retval uint32_t                     A value of @ref CLK_System_Clock_Divider.
+ */
+static uint32_t BusDiv(uint32_t u32SysclkFreq, uint32_t u32Max)
+{
+    uint32_t u32Div = CLK_SYSCLK_DIV1;
+
+    while (((u32SysclkFreq >> u32Div) > u32Max) && (u32Div < CLK_SOLVE_SYSCLK_DIV_MAX)) {
+        u32Div++;
+    }
+    return u32Div;
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup CLK_SOLVE_Global_Functions CLK_SOLVE Global Functions
+ * @{
+ */
+
+/**
+ * @brief  Set the fields of stc_clk_solve_target_t to default values.
+ * @param  [out] pstcTarget             Pointer to a @ref stc_clk_solve_target_t structure.
+ * @retval int32_t:
+ *           - LL_OK:                   No error occurred.
+ *           - LL_ERR_INVD_PARAM:       pstcTarget == NULL.
+ */
+int32_t CLK_SOLVE_TargetStructInit(stc_clk_solve_target_t *pstcTarget)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if (NULL != pstcTarget) {
+        pstcTarget->u32PllSrc = CLK_PLL_SRC_XTAL;
+        pstcTarget->u32InFreq = XTAL_VALUE;
+        pstcTarget->u32PFreq  = 0UL;
+        pstcTarget->u32QFreq  = 0UL;
+        pstcTarget->u32RFreq  = 0UL;
+        pstcTarget->u32Tol    = 0UL;
+        i32Ret = LL_OK;
+    }
+    return i32Ret;
+}
+
+/**
+ * @brief  Compute the PLLH setting of target frequencies.
+ * @param  [in] pstcTarget              Pointer to a @ref stc_clk_solve_target_t structure.
+ * @param  [out] pstcPLLInit            Pointer to a @ref stc_clock_pll_init_t structure for CLK_PLLInit().
+ * @param  [out] pstcResult             Pointer to a @ref stc_clk_solve_result_t structure, or NULL.
+ * @retval int32_t:
+ *           - LL_OK:                   No error occurred.
+ *           - LL_ERR:                  No setting meets the tolerance.
+ *           - LL_ERR_INVD_PARAM:       pstcTarget == NULL or pstcPLLInit == NULL.
+ */
+int32_t CLK_SOLVE_PLL(const stc_clk_solve_target_t *pstcTarget, stc_clock_pll_init_t *pstcPLLInit,
+                      stc_clk_solve_result_t *pstcResult)
+{
+    stc_clk_solve_pll_t stcPll;
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if (NULL != pstcPLLInit) {
+        i32Ret = SolvePll(pstcTarget, &m_stcPllLimit, &stcPll, pstcResult);
+        if (LL_OK == i32Ret) {
+            pstcPLLInit->u8PLLState = CLK_PLL_ON;
+            pstcPLLInit->PLLCFGR = 0UL;
+            pstcPLLInit->PLLCFGR_f.PLLSRC = pstcTarget->u32PllSrc;
+            pstcPLLInit->PLLCFGR_f.PLLM = stcPll.u32M - 1UL;
+            pstcPLLInit->PLLCFGR_f.PLLN = stcPll.u32N - 1UL;
+            pstcPLLInit->PLLCFGR_f.PLLP = stcPll.au32Div[0U] - 1UL;
+            pstcPLLInit->PLLCFGR_f.PLLQ = stcPll.au32Div[1U] - 1UL;
+            pstcPLLInit->PLLCFGR_f.PLLR = stcPll.au32Div[2U] - 1UL;
+        }
+    }
+    return i32Ret;
+}
+
+/**
+ * @brief  Compute the PLLA setting of target frequencies.
+ * @param  [in] pstcTarget              Pointer to a @ref stc_clk_solve_target_t structure.
+ * @param  [out] pstcPLLxInit           Pointer to a @ref stc_clock_pllx_init_t structure for CLK_PLLxInit().
+ * @param  [out] pstcResult             Pointer to a @ref stc_clk_solve_result_t structure, or NULL.
+ * @retval int32_t:
+ *           - LL_OK:                   No error occurred.
+ *           - LL_ERR:                  No setting meets the tolerance.
+ *           - LL_ERR_INVD_PARAM:       pstcTarget == NULL or pstcPLLxInit == NULL.
+ * @note   PLLA takes the source of PLLH, given by the PLLSRC field of the PLLH setting.
+ */
+int32_t CLK_SOLVE_PLLx(const stc_clk_solve_target_t *pstcTarget, stc_clock_pllx_init_t *pstcPLLxInit,
+                       stc_clk_solve_result_t *pstcResult)
+{
+    stc_clk_solve_pll_t stcPll;
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if (NULL != pstcPLLxInit) {
+        i32Ret = SolvePll(pstcTarget, &m_stcPllxLimit, &stcPll, pstcResult);
+        if (LL_OK == i32Ret) {
+            pstcPLLxInit->u8PLLState = CLK_PLLX_ON;
+            pstcPLLxInit->PLLCFGR = 0UL;
+            pstcPLLxInit->PLLCFGR_f.PLLM = stcPll.u32M - 1UL;
+            pstcPLLxInit->PLLCFGR_f.PLLN = stcPll.u32N - 1UL;
+            pstcPLLxInit->PLLCFGR_f.PLLP = stcPll.au32Div[0U] - 1UL;
+            pstcPLLxInit->PLLCFGR_f.PLLQ = stcPll.au32Div[1U] - 1UL;
+            pstcPLLxInit->PLLCFGR_f.PLLR = stcPll.au32Div[2U] - 1UL;
+        }
+    }
+    return i32Ret;
+}
+
+/**
+ * @brief  Compute the bus clock dividers of a system clock.
+ * @param  [in] u32SysclkFreq           System clock frequency in Hz.
+ * @retval uint32_t                     Dividers for CLK_SetClockDiv(CLK_BUS_CLK_ALL, ...), each bus at the
+ *                                      highest frequency within @ref CLK_SOLVE_Bus_Max.
+ */
+uint32_t CLK_SOLVE_ClockDiv(uint32_t u32SysclkFreq)
+{
+    return ((BusDiv(u32SysclkFreq, CLK_SOLVE_HCLK_MAX)  << CMU_SCFGR_HCLKS_POS)  |
+            (BusDiv(u32SysclkFreq, CLK_SOLVE_EXCLK_MAX) << CMU_SCFGR_EXCKS_POS)  |
+            (BusDiv(u32SysclkFreq, CLK_SOLVE_PCLK0_MAX) << CMU_SCFGR_PCLK0S_POS) |
+            (BusDiv(u32SysclkFreq, CLK_SOLVE_PCLK1_MAX) << CMU_SCFGR_PCLK1S_POS) |
+            (BusDiv(u32SysclkFreq, CLK_SOLVE_PCLK2_MAX) << CMU_SCFGR_PCLK2S_POS) |
+            (BusDiv(u32SysclkFreq, CLK_SOLVE_PCLK3_MAX) << CMU_SCFGR_PCLK3S_POS) |
+            (BusDiv(u32SysclkFreq, CLK_SOLVE_PCLK4_MAX) << CMU_SCFGR_PCLK4S_POS));
+}
+
+/**
+ * @brief  Compute the EFM read wait cycle of an HCLK.
+ * @param  [in] u32HclkFreq             HCLK frequency in Hz.
+ * @retval uint32_t                     A value of @ref EFM_Wait_Cycle, one cycle per CLK_SOLVE_EFM_WAIT_STEP.
+ */
+uint32_t CLK_SOLVE_WaitCycle(uint32_t u32HclkFreq)
+{
+    uint32_t u32Wait = 0UL;
+
+    if (u32HclkFreq > 0UL) {
+        u32Wait = (u32HclkFreq - 1UL) / CLK_SOLVE_EFM_WAIT_STEP;
+    }
+    if (u32Wait > CLK_SOLVE_WAIT_CYCLE_MAX) {
+        u32Wait = CLK_SOLVE_WAIT_CYCLE_MAX;
+    }
+    return (u32Wait << EFM_FRMC_FLWT_POS);
+}
+
+/**
+ * @brief  Compute a clock tree configuration with PLLH as system clock.
+ * @param  [in] pstcTarget              Pointer to a @ref stc_clk_solve_target_t structure, the P output
+ *                                      being the system clock.
+ * @param  [out] pstcCfg                Pointer to a @ref stc_clk_solve_cfg_t structure.
+ * @param  [out] pstcResult             Pointer to a @ref stc_clk_solve_result_t structure, or NULL.
+ * @retval int32_t:
+ *           - LL_OK:                   No error occurred.
+ *           - LL_ERR:                  No setting meets the tolerance.
+ *           - LL_ERR_INVD_PARAM:       A pointer is NULL or the P output is don't care.
+ */
+int32_t CLK_SOLVE_Config(const stc_clk_solve_target_t *pstcTarget, stc_clk_solve_cfg_t *pstcCfg,
+                         stc_clk_solve_result_t *pstcResult)
+{
+    stc_clk_solve_result_t stcResult;
+    uint32_t u32HclkDiv;
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if ((NULL != pstcTarget) && (NULL != pstcCfg) && (0UL != pstcTarget->u32PFreq)) {
+        i32Ret = CLK_SOLVE_PLL(pstcTarget, &pstcCfg->stcPLLInit, &stcResult);
+        if (LL_OK == i32Ret) {
+            pstcCfg->u32ClockDiv  = CLK_SOLVE_ClockDiv(stcResult.u32PFreq);
+            u32HclkDiv = (pstcCfg->u32ClockDiv & CMU_SCFGR_HCLKS) >> CMU_SCFGR_HCLKS_POS;
+            pstcCfg->u32WaitCycle = CLK_SOLVE_WaitCycle(stcResult.u32PFreq >> u32HclkDiv);
+            if (NULL != pstcResult) {
+                *pstcResult = stcResult;
+            }
+        }
+    }
+    return i32Ret;
+}
+
+#if (LL_EFM_ENABLE == DDL_ON)
+/**
+ * @brief  Switch the system clock to PLLH with a computed configuration.
+ * @param  [in] pstcCfg                 Pointer to a @ref stc_clk_solve_cfg_t structure.
+ * @retval int32_t:
+ *           - LL_OK:                   No error occurred.
+ *           - LL_ERR_TIMEOUT:          The EFM or PLLH is not ready.
+ *           - LL_ERR_INVD_PARAM:       pstcCfg == NULL.
+ * @note   Call at boot, with the system clock not on PLLH, the PLL source stable and the CLK,
+ *         PWC and EFM registers unlocked. The dividers and wait cycle are set before the
+ *         system clock rises.
+ */
+int32_t CLK_SOLVE_Apply(const stc_clk_solve_cfg_t *pstcCfg)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if (NULL != pstcCfg) {
+        CLK_SetClockDiv(CLK_BUS_CLK_ALL, pstcCfg->u32ClockDiv);
+        i32Ret = EFM_SetWaitCycle(pstcCfg->u32WaitCycle);
+        if (LL_OK == i32Ret) {
+            i32Ret = CLK_PLLInit(&pstcCfg->stcPLLInit);
+        }
+        if (LL_OK == i32Ret) {
+            CLK_SetSysClockSrc(CLK_SYSCLK_SRC_PLL);
+        }
+    }
+    return i32Ret;
+}
+#endif /* LL_EFM_ENABLE */
+
+/**
+ * @}
+ */
+
+#endif /* LL_CLK_SOLVE_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,614 @@
+/**
+ *******************************************************************************
+ * @file  hc32_ll_dac_wave.c
+ * @brief This file provides firmware functions to manage the DAC DMA waveform
+ *        generator.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       CDT             First version
+                                    Checked the DMA trigger target in DAC_WAVE_Init()
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2025, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ll_dac_wave.h"
+#include "hc32_ll_aos.h"
+#include "hc32_ll_utility.h"
+
+/**
+ * @addtogroup LL_Driver
+ * @{
+ */
+
+/**
+ * @defgroup LL_DAC_WAVE DAC_WAVE
+ * @brief DAC DMA Waveform Generator Driver Library
+ * @note  One DMA channel, paced by a timer event through AOS, writes the sample table to the
+ *        data register of the DAC, one sample per event. The table is played by a self-linked
+ *        descriptor in loop mode, or by two descriptors, one per half, in stream mode where the
+ *        DMA transfer complete interrupt hands back the half which has just been played.
+ *        The DAC must be initialized by DAC_Init() with @ref DAC_DATA_SRC_DATAREG, and the
+ *        timer started after DAC_WAVE_Start().
+ * @{
+ */
+
+#if (LL_DAC_WAVE_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup DAC_WAVE_Local_Macros DAC_WAVE Local Macros
+ * @{
+ */
+#define DAC_WAVE_DATA_MAX               (0xFFFL)
+#define DAC_WAVE_LEFT_ALIGN_SHIFT       (4U)
+
+/* Full turn of a Q16 phase */
+#define DAC_WAVE_PHASE_TURN             (0x10000UL)
+#define DAC_WAVE_PHASE_QUARTER          (0x4000UL)
+
+/* Q15 coefficients of sin(x * pi / 2) ~= x * (A - x^2 * (B - x^2 * C)), 0 <= x <= 1, fitted
+   for the least peak error */
+#define DAC_WAVE_SIN_A                  (51455L)
+#define DAC_WAVE_SIN_B                  (21040L)
+#define DAC_WAVE_SIN_C                  (2355L)
+#define DAC_WAVE_Q15_ONE                (32768L)
+#define DAC_WAVE_Q15_MAX                (32767L)
+
+/**
+ * @defgroup DAC_WAVE_Check_Parameters_Validity DAC_WAVE Check Parameters Validity
+ * @{
+ */
+#define IS_DAC_WAVE_UNIT(x)             (((x) == CM_DAC1) || ((x) == CM_DAC2))
+
+#define IS_DAC_WAVE_CH(x)                                                      \
+(   ((x) == DAC_WAVE_CH1)                   ||                                 \
+    ((x) == DAC_WAVE_CH2)                   ||                                 \
+    ((x) == DAC_WAVE_CH_DUAL))
+
+#define IS_DAC_WAVE_DATA_ALIGN(x)                                              \
+(   ((x) == DAC_DATA_ALIGN_LEFT)            ||                                 \
+    ((x) == DAC_DATA_ALIGN_RIGHT))
+
+#define IS_DAC_WAVE_LEN(md, len)                                               \
+(   (((md) == DAC_WAVE_MD_LOOP)             &&                                 \
+     ((len) >= 1UL)                         &&                                 \
+     ((len) <= DAC_WAVE_TABLE_LEN_MAX))     ||                                 \
+    (((md) == DAC_WAVE_MD_STREAM)           &&                                 \
+     ((len) >= 2UL)                         &&                                 \
+     (((len) & 1UL) == 0UL)                 &&                                 \
+     (((len) / 2UL) <= DAC_WAVE_TABLE_LEN_MAX)))
+
+#define IS_DAC_WAVE_DMA_TARGET(unit, ch, target)                               \
+(   ((target) == ((((unit) == CM_DMA1) ? AOS_DMA1_0 : AOS_DMA2_0) + ((uint32_t)(ch) * 4UL))))
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @defgroup DAC_WAVE_Local_Functions DAC_WAVE Local Functions
+ * @{
+ */
+
+/**
+ * @brief  Get the size of one sample of the table.
+ * @param  [in] pstcWave                Pointer to a @ref stc_dac_wave_t structure.
+ * @retval 2 or 4 bytes.
+ */
+static uint32_t DAC_WAVE_SampleSize(const stc_dac_wave_t *pstcWave)
+{
+    return (DAC_WAVE_CH_DUAL == pstcWave->u16Ch) ? 4UL : 2UL;
+}
+
+/**
+ * @brief  Build the descriptors of the table.
+ * @param  [in] pstcWave                Pointer to a @ref stc_dac_wave_t structure.
+ * @retval None
+ * @note   Loop mode uses one descriptor linked to itself without interrupt, stream mode two
+ *         descriptors linked to each other with the transfer complete interrupt.
+ */
+static void DAC_WAVE_DescInit(stc_dac_wave_t *pstcWave)
+{
+    const uint32_t u32Size = DAC_WAVE_SampleSize(pstcWave);
+    uint32_t u32DescNum = 1UL;
+    uint32_t u32ChCtl = DMA_SRC_ADDR_INC | DMA_DEST_ADDR_FIX | DMA_LLP_ENABLE | DMA_LLP_WAIT;
+    uint32_t u32DataAddr;
+    uint32_t i;
+
+    if (DAC_WAVE_CH_DUAL == pstcWave->u16Ch) {
+        u32DataAddr = (uint32_t)&pstcWave->pstcDac->DADR1;
+        u32ChCtl |= DMA_DATAWIDTH_32BIT;
+    } else {
+        u32DataAddr = (uint32_t)&pstcWave->pstcDac->DADR1 + ((uint32_t)pstcWave->u16Ch * 2UL);
+        u32ChCtl |= DMA_DATAWIDTH_16BIT;
+    }
+    if (DAC_WAVE_MD_STREAM == pstcWave->u16Mode) {
+        u32DescNum = 2UL;
+        u32ChCtl |= DMA_INT_ENABLE;
+    }
+
+    for (i = 0UL; i < u32DescNum; i++) {
+        pstcWave->astcDesc[i].SARx      = (uint32_t)pstcWave->pvBuf + (i * (pstcWave->u32Len / u32DescNum) * u32Size);
+        pstcWave->astcDesc[i].DARx      = u32DataAddr;
+        pstcWave->astcDesc[i].DTCTLx    = ((pstcWave->u32Len / u32DescNum) << DMA_DTCTL_CNT_POS) | 1UL;
+        pstcWave->astcDesc[i].RPTx      = 0UL;
+        pstcWave->astcDesc[i].SNSEQCTLx = 0UL;
+        pstcWave->astcDesc[i].DNSEQCTLx = 0UL;
+        pstcWave->astcDesc[i].LLPx      = (uint32_t)&pstcWave->astcDesc[(i + 1UL) % u32DescNum];
+        pstcWave->astcDesc[i].CHCTLx    = u32ChCtl;
+    }
+}
+
+/**
+ * @brief  Load the first descriptor into the channel and enable it.
+ * @param  [in] pstcWave                Pointer to a @ref stc_dac_wave_t structure.
+ * @retval None
+ */
+static void DAC_WAVE_DmaArm(stc_dac_wave_t *pstcWave)
+{
+    CM_DMA_TypeDef *DMAx = pstcWave->pstcDmaUnit;
+    const stc_dma_llp_descriptor_t *pstcDesc = &pstcWave->astcDesc[0];
+    stc_dma_init_t stcDmaInit;
+    stc_dma_llp_init_t stcLlpInit;
+
+    (void)DMA_StructInit(&stcDmaInit);
+    stcDmaInit.u32IntEn       = pstcDesc->CHCTLx & DMA_INT_ENABLE;
+    stcDmaInit.u32SrcAddr     = pstcDesc->SARx;
+    stcDmaInit.u32DestAddr    = pstcDesc->DARx;
+    stcDmaInit.u32DataWidth   = pstcDesc->CHCTLx & DMA_CHCTL_HSIZE;
+    stcDmaInit.u32BlockSize   = 1UL;
+    stcDmaInit.u32TransCount  = pstcDesc->DTCTLx >> DMA_DTCTL_CNT_POS;
+    stcDmaInit.u32SrcAddrInc  = DMA_SRC_ADDR_INC;
+    stcDmaInit.u32DestAddrInc = DMA_DEST_ADDR_FIX;
+    (void)DMA_Init(DMAx, pstcWave->u8DmaCh, &stcDmaInit);
+
+    (void)DMA_LlpStructInit(&stcLlpInit);
+    stcLlpInit.u32State = DMA_LLP_ENABLE;
+    stcLlpInit.u32Mode  = DMA_LLP_WAIT;
+    stcLlpInit.u32Addr  = pstcDesc->LLPx;
+    (void)DMA_LlpInit(DMAx, pstcWave->u8DmaCh, &stcLlpInit);
+
+    DMA_ClearTransCompleteStatus(DMAx, DMA_FLAG_TC_CH0 << pstcWave->u8DmaCh);
+    if (DAC_WAVE_MD_STREAM == pstcWave->u16Mode) {
+        DMA_TransCompleteIntCmd(DMAx, DMA_INT_TC_CH0 << pstcWave->u8DmaCh, ENABLE);
+    }
+    (void)DMA_ChCmd(DMAx, pstcWave->u8DmaCh, ENABLE);
+}
+
+/**
+ * @brief  Q15 sine of a Q16 phase.
+ * @param  [in] u32Phase                Phase, 0x10000 is a full turn.
+ * @retval Sine in [-32767, 32767].
+ */
+static int32_t DAC_WAVE_Sin(uint32_t u32Phase)
+{
+    const uint32_t u32Quadrant = (u32Phase % DAC_WAVE_PHASE_TURN) / DAC_WAVE_PHASE_QUARTER;
+    uint32_t u32Pos = u32Phase % DAC_WAVE_PHASE_QUARTER;
+    int32_t i32X;
+    int32_t i32X2;
+    int32_t i32Sin;
+
+    /* Mirror the second and fourth quadrants onto the first one */
+    if ((1UL == u32Quadrant) || (3UL == u32Quadrant)) {
+        u32Pos = DAC_WAVE_PHASE_QUARTER - u32Pos;
+    }
+    /* Q15 position in the quadrant */
+    i32X  = (int32_t)(u32Pos << 1U);
+    i32X2 = (i32X * i32X) / DAC_WAVE_Q15_ONE;
+    i32Sin = DAC_WAVE_SIN_B - ((i32X2 * DAC_WAVE_SIN_C) / DAC_WAVE_Q15_ONE);
+    i32Sin = DAC_WAVE_SIN_A - ((i32X2 * i32Sin) / DAC_WAVE_Q15_ONE);
+    i32Sin = (int32_t)(((int64_t)i32X * i32Sin) / DAC_WAVE_Q15_ONE);
+    if (i32Sin > DAC_WAVE_Q15_MAX) {
+        i32Sin = DAC_WAVE_Q15_MAX;
+    }
+
+    return (u32Quadrant >= 2UL) ? -i32Sin : i32Sin;
+}
+
+/**
+ * @brief  Scale a Q15 value to a DAC code.
+ * @param  [in] i32Val                  Q15 value in [-32768, 32767].
+ * @param  [in] u16Amp                  Amplitude in DAC codes.
+ * @param  [in] u16Offset               Offset in DAC codes.
+ * @param  [in] u16Align                A value of @ref DAC_DATA_ALIGN.
+ * @retval DAC data register value.
+ */
+static uint16_t DAC_WAVE_Scale(int32_t i32Val, uint16_t u16Amp, uint16_t u16Offset, uint16_t u16Align)
+{
+    int32_t i32Code;
+
+    i32Code = (int32_t)u16Offset + (((int32_t)u16Amp * i32Val) / DAC_WAVE_Q15_ONE);
+    if (i32Code < 0L) {
+        i32Code = 0L;
+    } else if (i32Code > DAC_WAVE_DATA_MAX) {
+        i32Code = DAC_WAVE_DATA_MAX;
+    } else {
+        /* In range */
+    }
+    if (DAC_DATA_ALIGN_LEFT == u16Align) {
+        i32Code <<= DAC_WAVE_LEFT_ALIGN_SHIFT;
+    }
+
+    return (uint16_t)i32Code;
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup DAC_WAVE_Global_Functions DAC_WAVE Global Functions
+ * @{
+ */
+
+/**
+ * @brief  Set each @ref stc_dac_wave_init_t field to default value.
+ * @param  [out] pstcWaveInit           Pointer to a @ref stc_dac_wave_init_t structure.
+ * @retval int32_t:
+ *           - LL_OK:                   Initialize success
+ *           - LL_ERR_INVD_PARAM:       pstcWaveInit is NULL
+ */
+int32_t DAC_WAVE_StructInit(stc_dac_wave_init_t *pstcWaveInit)
+{
+    int32_t i32Ret = LL_OK;
+
+    if (NULL == pstcWaveInit) {
+        i32Ret = LL_ERR_INVD_PARAM;
+    } else {
+        pstcWaveInit->u16Ch         = DAC_WAVE_CH1;
+        pstcWaveInit->u16Mode       = DAC_WAVE_MD_LOOP;
+        pstcWaveInit->pvBuf         = NULL;
+        pstcWaveInit->u32Len        = 0UL;
+        pstcWaveInit->pstcDmaUnit   = NULL;
+        pstcWaveInit->u8DmaCh       = DMA_CH0;
+        pstcWaveInit->u32TrigTarget = AOS_DMA1_0;
+        pstcWaveInit->enEvtSrc      = EVT_SRC_TMR0_1_CMP_A;
+        pstcWaveInit->pfnCallback   = NULL;
+        pstcWaveInit->pvArg         = NULL;
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Initialize a DAC waveform.
+ * @param  [out] pstcWave               Pointer to a @ref stc_dac_wave_t structure.
+ * @param  [in] DACx                    Pointer to DAC unit instance
+ *         This parameter can be one of the following values:
+ *           @arg CM_DACx:              DAC unit instance
+ * @param  [in] pstcWaveInit            Pointer to a @ref stc_dac_wave_init_t structure.
+ * @retval int32_t:
+ *           - LL_OK:                   Initialize success
+ *           - LL_ERR_INVD_PARAM:       Invalid parameter, or u32TrigTarget is not the target of u8DmaCh
+ */
+int32_t DAC_WAVE_Init(stc_dac_wave_t *pstcWave, CM_DAC_TypeDef *DACx, const stc_dac_wave_init_t *pstcWaveInit)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    DDL_ASSERT(IS_DAC_WAVE_UNIT(DACx));
+
+    if ((NULL != pstcWave) && (NULL != pstcWaveInit) && (NULL != pstcWaveInit->pvBuf) &&
+        (NULL != pstcWaveInit->pstcDmaUnit) && IS_DAC_WAVE_LEN(pstcWaveInit->u16Mode, pstcWaveInit->u32Len) &&
+        IS_DAC_WAVE_DMA_TARGET(pstcWaveInit->pstcDmaUnit, pstcWaveInit->u8DmaCh, pstcWaveInit->u32TrigTarget)) {
+        DDL_ASSERT(IS_DAC_WAVE_CH(pstcWaveInit->u16Ch));
+        DDL_ASSERT(pstcWaveInit->u8DmaCh <= DMA_CH7);
+
+        pstcWave->pstcDac      = DACx;
+        pstcWave->u16Ch        = pstcWaveInit->u16Ch;
+        pstcWave->u16Mode      = pstcWaveInit->u16Mode;
+        pstcWave->pvBuf        = pstcWaveInit->pvBuf;
+        pstcWave->u32Len       = pstcWaveInit->u32Len;
+        pstcWave->pstcDmaUnit  = pstcWaveInit->pstcDmaUnit;
+        pstcWave->u8DmaCh      = pstcWaveInit->u8DmaCh;
+        pstcWave->pfnCallback  = pstcWaveInit->pfnCallback;
+        pstcWave->pvArg        = pstcWaveInit->pvArg;
+        pstcWave->u8Running    = 0U;
+        pstcWave->u32HalfCount = 0UL;
+
+        DAC_WAVE_DescInit(pstcWave);
+        AOS_SetTriggerEventSrc(pstcWaveInit->u32TrigTarget, pstcWaveInit->enEvtSrc);
+        i32Ret = LL_OK;
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Start playing a DAC waveform from the beginning of the table.
+ * @param  [in] pstcWave                Pointer to a @ref stc_dac_wave_t structure.
+ * @retval int32_t:
+ *           - LL_OK:                   Waveform started
+ *           - LL_ERR_INVD_PARAM:       pstcWave is NULL
+ *           - LL_ERR_BUSY:             Waveform already playing
+ *           - LL_ERR:                  The DAC channel can not be started
+ * @note   Stream mode plays the table as it is, fill both halves before starting.
+ */
+int32_t DAC_WAVE_Start(stc_dac_wave_t *pstcWave)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if (NULL != pstcWave) {
+        if (0U != pstcWave->u8Running) {
+            i32Ret = LL_ERR_BUSY;
+        } else {
+            DAC_WAVE_DmaArm(pstcWave);
+            if (DAC_WAVE_CH_DUAL == pstcWave->u16Ch) {
+                DAC_StartDualCh(pstcWave->pstcDac);
+                i32Ret = LL_OK;
+            } else {
+                i32Ret = DAC_Start(pstcWave->pstcDac, pstcWave->u16Ch);
+            }
+            if (LL_OK == i32Ret) {
+                pstcWave->u8Running = 1U;
+            } else {
+                (void)DMA_ChCmd(pstcWave->pstcDmaUnit, pstcWave->u8DmaCh, DISABLE);
+                i32Ret = LL_ERR;
+            }
+        }
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Stop a DAC waveform, the output holds the last sample.
+ * @param  [in] pstcWave                Pointer to a @ref stc_dac_wave_t structure.
+ * @retval None
+ */
+void DAC_WAVE_Stop(stc_dac_wave_t *pstcWave)
+{
+    DDL_ASSERT(NULL != pstcWave);
+
+    pstcWave->u8Running = 0U;
+    (void)DMA_ChCmd(pstcWave->pstcDmaUnit, pstcWave->u8DmaCh, DISABLE);
+    DMA_TransCompleteIntCmd(pstcWave->pstcDmaUnit, DMA_INT_TC_CH0 << pstcWave->u8DmaCh, DISABLE);
+    DMA_ClearTransCompleteStatus(pstcWave->pstcDmaUnit, DMA_FLAG_TC_CH0 << pstcWave->u8DmaCh);
+}
+
+/**
+ * @brief  DMA transfer complete interrupt handler of a streaming DAC waveform.
+ * @param  [in] pstcWave                Pointer to a @ref stc_dac_wave_t structure.
+ * @retval None
+ * @note   The DMA has already loaded the next descriptor, so the played half is the one
+ *         which does not hold the current source address.
+ */
+void DAC_WAVE_DmaIrqHandler(stc_dac_wave_t *pstcWave)
+{
+    const uint32_t u32Flag = DMA_FLAG_TC_CH0 << pstcWave->u8DmaCh;
+    uint32_t u32Half;
+    uint32_t u32Done;
+
+    DDL_ASSERT(NULL != pstcWave);
+
+    if (SET == DMA_GetTransCompleteStatus(pstcWave->pstcDmaUnit, u32Flag)) {
+        DMA_ClearTransCompleteStatus(pstcWave->pstcDmaUnit, u32Flag);
+        if (0U != pstcWave->u8Running) {
+            u32Half = pstcWave->u32Len / 2UL;
+            u32Done = (uint32_t)pstcWave->pvBuf;
+            if (DMA_GetSrcAddr(pstcWave->pstcDmaUnit, pstcWave->u8DmaCh) <
+                (u32Done + (u32Half * DAC_WAVE_SampleSize(pstcWave)))) {
+                u32Done += u32Half * DAC_WAVE_SampleSize(pstcWave);
+            }
+            pstcWave->u32HalfCount++;
+            if (NULL != pstcWave->pfnCallback) {
+                pstcWave->pfnCallback(pstcWave, (void *)u32Done, u32Half, pstcWave->pvArg);
+            }
+        }
+    }
+}
+
+/**
+ * @brief  Pick the table length playing a frequency at a sample rate.
+ * @param  [in] u32SampleRate           Rate of the pacing timer event in Hz.
+ * @param  [in] u32FreqMilliHz          Target output frequency in mHz.
+ * @retval Table length, 0 if out of [DAC_WAVE_TABLE_LEN_MIN, DAC_WAVE_TABLE_LEN_MAX].
+ * @note   The output frequency is u32SampleRate / length, the nearest one to the target.
+ */
+uint32_t DAC_WAVE_CalcTableLen(uint32_t u32SampleRate, uint32_t u32FreqMilliHz)
+{
+    uint64_t u64Len;
+    uint32_t u32Len = 0UL;
+
+    if (0UL != u32FreqMilliHz) {
+        u64Len = (((uint64_t)u32SampleRate * 1000ULL) + ((uint64_t)u32FreqMilliHz / 2ULL)) / u32FreqMilliHz;
+        if ((u64Len >= DAC_WAVE_TABLE_LEN_MIN) && (u64Len <= DAC_WAVE_TABLE_LEN_MAX)) {
+            u32Len = (uint32_t)u64Len;
+        }
+    }
+
+    return u32Len;
+}
+
+/**
+ * @brief  Fill a table with one period of a sine.
+ * @param  [out] pu16Table              Table of u32Len samples.
+ * @param  [in] u32Len                  Number of samples.
+ * @param  [in] u16Amp                  Peak amplitude in DAC codes.
+ * @param  [in] u16Offset               Mid level in DAC codes.
+ * @param  [in] u16Align                Data alignment of the DAC, a value of @ref DAC_DATA_ALIGN.
+ * @retval int32_t:
+ *           - LL_OK:                   Table filled
+ *           - LL_ERR_INVD_PARAM:       pu16Table is NULL or u32Len is 0
+ * @note   Computed in fixed point, the error of the sine is below 4 / 32768 of u16Amp.
+ *         Samples are clipped to the 12-bit range of the DAC.
+ */
+int32_t DAC_WAVE_GenSine(uint16_t *pu16Table, uint32_t u32Len, uint16_t u16Amp, uint16_t u16Offset,
+                         uint16_t u16Align)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+    uint32_t u32Phase;
+    uint32_t i;
+
+    DDL_ASSERT(IS_DAC_WAVE_DATA_ALIGN(u16Align));
+
+    if ((NULL != pu16Table) && (0UL != u32Len)) {
+        for (i = 0UL; i < u32Len; i++) {
+            u32Phase = (uint32_t)(((uint64_t)i * DAC_WAVE_PHASE_TURN) / u32Len);
+            pu16Table[i] = DAC_WAVE_Scale(DAC_WAVE_Sin(u32Phase), u16Amp, u16Offset, u16Align);
+        }
+        i32Ret = LL_OK;
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Fill a table with one period of a triangle, rising from the bottom.
+ * @param  [out] pu16Table              Table of u32Len samples.
+ * @param  [in] u32Len                  Number of samples.
+ * @param  [in] u16Amp                  Peak amplitude in DAC codes.
+ * @param  [in] u16Offset               Mid level in DAC codes.
+ * @param  [in] u16Align                Data alignment of the DAC, a value of @ref DAC_DATA_ALIGN.
+ * @retval int32_t:
+ *           - LL_OK:                   Table filled
+ *           - LL_ERR_INVD_PARAM:       pu16Table is NULL or u32Len is 0
+ */
+int32_t DAC_WAVE_GenTriangle(uint16_t *pu16Table, uint32_t u32Len, uint16_t u16Amp, uint16_t u16Offset,
+                             uint16_t u16Align)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+    uint32_t u32Phase;
+    int32_t i32Val;
+    uint32_t i;
+
+    DDL_ASSERT(IS_DAC_WAVE_DATA_ALIGN(u16Align));
+
+    if ((NULL != pu16Table) && (0UL != u32Len)) {
+        for (i = 0UL; i < u32Len; i++) {
+            u32Phase = (uint32_t)(((uint64_t)i * DAC_WAVE_PHASE_TURN) / u32Len);
+            if (u32Phase < (DAC_WAVE_PHASE_TURN / 2UL)) {
+                i32Val = ((int32_t)u32Phase * 2L) - DAC_WAVE_Q15_ONE;
+            } else {
+                i32Val = (3L * DAC_WAVE_Q15_ONE) - ((int32_t)u32Phase * 2L);
+            }
+            if (i32Val > DAC_WAVE_Q15_MAX) {
+                i32Val = DAC_WAVE_Q15_MAX;
+            }
+            pu16Table[i] = DAC_WAVE_Scale(i32Val, u16Amp, u16Offset, u16Align);
+        }
+        i32Ret = LL_OK;
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Fill a table with one period of an arbitrary shape.
+ * @param  [out] pu16Table              Table of u32Len samples.
+ * @param  [in] u32Len                  Number of samples.
+ * @param  [in] pi16Point               Q15 points of one period, evenly spaced, the last one
+ *                                      joins the first one.
+ * @param  [in] u32PointNum             Number of points.
+ * @param  [in] u16Amp                  Amplitude in DAC codes of a full scale point.
+ * @param  [in] u16Offset               Level in DAC codes of a zero point.
+ * @param  [in] u16Align                Data alignment of the DAC, a value of @ref DAC_DATA_ALIGN.
+ * @retval int32_t:
+ *           - LL_OK:                   Table filled
+ *           - LL_ERR_INVD_PARAM:       Invalid parameter
+ * @note   The samples between the points are linearly interpolated.
+ */
+int32_t DAC_WAVE_GenArbitrary(uint16_t *pu16Table, uint32_t u32Len, const int16_t *pi16Point,
+                              uint32_t u32PointNum, uint16_t u16Amp, uint16_t u16Offset, uint16_t u16Align)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+    uint64_t u64Pos;
+    uint32_t u32Idx;
+    int32_t i32Frac;
+    int32_t i32A;
+    int32_t i32B;
+    uint32_t i;
+
+    DDL_ASSERT(IS_DAC_WAVE_DATA_ALIGN(u16Align));
+
+    if ((NULL != pu16Table) && (0UL != u32Len) && (NULL != pi16Point) && (0UL != u32PointNum)) {
+        for (i = 0UL; i < u32Len; i++) {
+            /* Q16 position in the point list */
+            u64Pos  = ((uint64_t)i * u32PointNum * DAC_WAVE_PHASE_TURN) / u32Len;
+            u32Idx  = (uint32_t)(u64Pos / DAC_WAVE_PHASE_TURN);
+            i32Frac = (int32_t)(uint32_t)(u64Pos % DAC_WAVE_PHASE_TURN);
+            i32A = pi16Point[u32Idx];
+            i32B = pi16Point[(u32Idx + 1UL) % u32PointNum];
+            i32A += (int32_t)(((int64_t)(i32B - i32A) * i32Frac) / (int64_t)DAC_WAVE_PHASE_TURN);
+            pu16Table[i] = DAC_WAVE_Scale(i32A, u16Amp, u16Offset, u16Align);
+        }
+        i32Ret = LL_OK;
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Merge two channel tables into a dual channel table.
+ * @param  [out] pu32Dual               Dual channel table of u32Len pairs.
+ * @param  [in] pu16Ch1                 Channel 1 table.
+ * @param  [in] pu16Ch2                 Channel 2 table.
+ * @param  [in] u32Len                  Number of samples.
+ * @retval None
+ * @note   Each pair updates both channels by one write, keeping them in phase.
+ */
+void DAC_WAVE_Interleave(uint32_t *pu32Dual, const uint16_t *pu16Ch1, const uint16_t *pu16Ch2, uint32_t u32Len)
+{
+    uint32_t i;
+
+    DDL_ASSERT(NULL != pu32Dual);
+    DDL_ASSERT(NULL != pu16Ch1);
+    DDL_ASSERT(NULL != pu16Ch2);
+
+    for (i = 0UL; i < u32Len; i++) {
+        pu32Dual[i] = ((uint32_t)pu16Ch2[i] << 16U) | pu16Ch1[i];
+    }
+}
+
+/**
+ * @}
+ */
+
+#endif /* LL_DAC_WAVE_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
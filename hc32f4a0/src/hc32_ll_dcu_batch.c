@@ -0,0 +1,647 @@
+/**
+ *******************************************************************************
+ * @file  hc32_ll_dcu_batch.c
+ * @brief This file provides firmware functions to run DCU kernels on arrays
+ *        fed by DMA.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       CDT             First version
+                                    Requested the chunks by DMA_MxChSWTrigger() instead of AOS_SW_Trigger()
+                                    Checked the DMA trigger target in DCU_BATCH_Init()
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2025, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ll_dcu_batch.h"
+#include "hc32_ll_dcu.h"
+#include "hc32_ll_aos.h"
+#include "hc32_ll_utility.h"
+
+/**
+ * @addtogroup LL_Driver
+ * @{
+ */
+
+/**
+ * @defgroup LL_DCU_BATCH DCU_BATCH
+ * @brief DCU Batch Kernels Driver Library
+ * @note  A DMA channel, requested by software on its own, copies the array into a DCU data
+ *        register, one block of up to 1024 elements per request, and the DCU works on each write:
+ *        - Accumulation writes DATA1 in add or sub mode, DATA0 keeps the running result,
+ *          wrapped to the data width, and the carry flag records any overflow or underflow.
+ *        - Compare writes DATA0 against the window DATA2 ~ DATA1, the outside window interrupt
+ *          stops the kernel. The DMA may run a few elements past the crossing before the
+ *          interrupt is served, so the first crossing element is found by scanning the
+ *          current block.
+ *        The DCU compares and adds unsigned values.
+ * @{
+ */
+
+#if (LL_DCU_BATCH_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup DCU_BATCH_Local_Macros DCU_BATCH Local Macros
+ * @{
+ */
+#define DCU_BATCH_CHUNK_MAX             (1024UL)
+
+/* Kernel states */
+#define DCU_BATCH_STATE_IDLE            (0U)
+#define DCU_BATCH_STATE_ACC             (1U)
+#define DCU_BATCH_STATE_CMP             (2U)
+
+#define DCU_BATCH_FLAG_OUTSIDE          (DCU_FLAG_DATA0_GT_DATA1 | DCU_FLAG_DATA0_LT_DATA2)
+/* Flags valid on both base and wave function units */
+#define DCU_BATCH_FLAG_USED             (DCU_FLAG_CARRY | DCU_BATCH_FLAG_OUTSIDE)
+
+/**
+ * @defgroup DCU_BATCH_Check_Parameters_Validity DCU_BATCH Check Parameters Validity
+ * @{
+ */
+#define IS_DCU_BATCH_ACC_MD(x)                                                 \
+(   ((x) == DCU_MD_ADD)                     ||                                 \
+    ((x) == DCU_MD_SUB))
+
+#define IS_DCU_BATCH_DATA_WIDTH(x)                                             \
+(   ((x) == DCU_DATA_WIDTH_8BIT)            ||                                 \
+    ((x) == DCU_DATA_WIDTH_16BIT)           ||                                 \
+    ((x) == DCU_DATA_WIDTH_32BIT))
+
+#define IS_DCU_BATCH_DMA_TARGET(unit, ch, target)                              \
+(   ((target) == ((((unit) == CM_DMA1) ? AOS_DMA1_0 : AOS_DMA2_0) + ((uint32_t)(ch) * 4UL))))
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @defgroup DCU_BATCH_Local_Functions DCU_BATCH Local Functions
+ * @{
+ */
+
+/**
+ * @brief  Bytes per element of a data width.
+ * @param  [in] u32DataWidth            A value of @ref DCU_Data_Width.
+ * @retval 1, 2 or 4.
+ */
+static uint8_t DCU_BATCH_Size(uint32_t u32DataWidth)
+{
+    uint8_t u8Size = 4U;
+
+    if (DCU_DATA_WIDTH_8BIT == u32DataWidth) {
+        u8Size = 1U;
+    } else if (DCU_DATA_WIDTH_16BIT == u32DataWidth) {
+        u8Size = 2U;
+    } else {
+        /* 32 bit */
+    }
+
+    return u8Size;
+}
+
+/**
+ * @brief  Largest value of an element.
+ * @param  [in] u8Size                  Bytes per element.
+ * @retval Mask of the data width.
+ */
+static uint32_t DCU_BATCH_Mask(uint8_t u8Size)
+{
+    return (4U == u8Size) ? 0xFFFFFFFFUL : ((1UL << (8U * u8Size)) - 1UL);
+}
+
+/**
+ * @brief  Read one element of an array.
+ * @param  [in] pvSrc                   Array.
+ * @param  [in] u8Size                  Bytes per element.
+ * @param  [in] u32Idx                  Element index.
+ * @retval Element value.
+ */
+static uint32_t DCU_BATCH_Elem(const void *pvSrc, uint8_t u8Size, uint32_t u32Idx)
+{
+    uint32_t u32Val;
+
+    if (1U == u8Size) {
+        u32Val = ((const uint8_t *)pvSrc)[u32Idx];
+    } else if (2U == u8Size) {
+        u32Val = ((const uint16_t *)pvSrc)[u32Idx];
+    } else {
+        u32Val = ((const uint32_t *)pvSrc)[u32Idx];
+    }
+
+    return u32Val;
+}
+
+/**
+ * @brief  Configure the DMA channel for a kernel.
+ * @param  [in] pstcBatch               Pointer to a @ref stc_dcu_batch_t structure.
+ * @param  [in] u32DataIdx              DCU data register written by the DMA.
+ * @retval None
+ */
+static void DCU_BATCH_DmaInit(const stc_dcu_batch_t *pstcBatch, uint32_t u32DataIdx)
+{
+    stc_dma_init_t stcDmaInit;
+
+    (void)DMA_StructInit(&stcDmaInit);
+    stcDmaInit.u32IntEn       = DMA_INT_ENABLE;
+    stcDmaInit.u32SrcAddr     = (uint32_t)pstcBatch->pvSrc;
+    stcDmaInit.u32DestAddr    = (uint32_t)&pstcBatch->pstcDcu->DATA0 + (u32DataIdx * 4UL);
+    if (1U == pstcBatch->u8Size) {
+        stcDmaInit.u32DataWidth = DMA_DATAWIDTH_8BIT;
+    } else if (2U == pstcBatch->u8Size) {
+        stcDmaInit.u32DataWidth = DMA_DATAWIDTH_16BIT;
+    } else {
+        stcDmaInit.u32DataWidth = DMA_DATAWIDTH_32BIT;
+    }
+    stcDmaInit.u32BlockSize   = 1UL;
+    stcDmaInit.u32TransCount  = 1UL;
+    stcDmaInit.u32SrcAddrInc  = DMA_SRC_ADDR_INC;
+    stcDmaInit.u32DestAddrInc = DMA_DEST_ADDR_FIX;
+    (void)DMA_Init(pstcBatch->pstcDmaUnit, pstcBatch->u8DmaCh, &stcDmaInit);
+    DMA_ClearTransCompleteStatus(pstcBatch->pstcDmaUnit, DMA_FLAG_TC_CH0 << pstcBatch->u8DmaCh);
+    DMA_TransCompleteIntCmd(pstcBatch->pstcDmaUnit, DMA_INT_TC_CH0 << pstcBatch->u8DmaCh, ENABLE);
+}
+
+/**
+ * @brief  Start the chunk at u32Pos.
+ * @param  [in] pstcBatch               Pointer to a @ref stc_dcu_batch_t structure.
+ * @retval None
+ */
+static void DCU_BATCH_Launch(const stc_dcu_batch_t *pstcBatch)
+{
+    uint32_t u32Chunk = pstcBatch->u32Len - pstcBatch->u32Pos;
+
+    if (u32Chunk > DCU_BATCH_CHUNK_MAX) {
+        u32Chunk = DCU_BATCH_CHUNK_MAX;
+    }
+    (void)DMA_SetSrcAddr(pstcBatch->pstcDmaUnit, pstcBatch->u8DmaCh,
+                         (uint32_t)pstcBatch->pvSrc + (pstcBatch->u32Pos * pstcBatch->u8Size));
+    (void)DMA_SetBlockSize(pstcBatch->pstcDmaUnit, pstcBatch->u8DmaCh, (uint16_t)u32Chunk);
+    (void)DMA_SetTransCount(pstcBatch->pstcDmaUnit, pstcBatch->u8DmaCh, 1U);
+    (void)DMA_ChCmd(pstcBatch->pstcDmaUnit, pstcBatch->u8DmaCh, ENABLE);
+    /* The request of the channel alone, AOS_SW_Trigger() would start every channel and
+       peripheral listening to the AOS software event */
+    DMA_MxChSWTrigger(pstcBatch->pstcDmaUnit, (uint8_t)(DMA_MX_CH0 << pstcBatch->u8DmaCh));
+}
+
+/**
+ * @brief  End a kernel and report it.
+ * @param  [in] pstcBatch               Pointer to a @ref stc_dcu_batch_t structure.
+ * @param  [in] u32Event                A value of @ref DCU_BATCH_Event.
+ * @retval None
+ */
+static void DCU_BATCH_Finish(stc_dcu_batch_t *pstcBatch, uint32_t u32Event)
+{
+    (void)DMA_ChCmd(pstcBatch->pstcDmaUnit, pstcBatch->u8DmaCh, DISABLE);
+    DMA_TransCompleteIntCmd(pstcBatch->pstcDmaUnit, DMA_INT_TC_CH0 << pstcBatch->u8DmaCh, DISABLE);
+    DMA_ClearTransCompleteStatus(pstcBatch->pstcDmaUnit, DMA_FLAG_TC_CH0 << pstcBatch->u8DmaCh);
+    DCU_GlobalIntCmd(pstcBatch->pstcDcu, DISABLE);
+
+    if (DCU_BATCH_STATE_ACC == pstcBatch->u8State) {
+        pstcBatch->stcAcc.u32Sum = DCU_ReadData32(pstcBatch->pstcDcu, DCU_DATA0_IDX) &
+                                   DCU_BATCH_Mask(pstcBatch->u8Size);
+        pstcBatch->stcAcc.u8Carry = (SET == DCU_GetStatus(pstcBatch->pstcDcu, DCU_FLAG_CARRY)) ? 1U : 0U;
+        pstcBatch->stcAcc.u32SatSum = pstcBatch->stcAcc.u32Sum;
+        if (0U != pstcBatch->stcAcc.u8Carry) {
+            pstcBatch->stcAcc.u32SatSum = (DCU_MD_ADD == pstcBatch->u32Mode) ? DCU_BATCH_Mask(pstcBatch->u8Size) : 0UL;
+        }
+    }
+    pstcBatch->u8State = DCU_BATCH_STATE_IDLE;
+
+    if (NULL != pstcBatch->pfnCallback) {
+        pstcBatch->pfnCallback(pstcBatch, u32Event, pstcBatch->pvArg);
+    }
+}
+
+/**
+ * @brief  Look for the first element out of the limits once the DCU has flagged one.
+ * @param  [in] pstcBatch               Pointer to a @ref stc_dcu_batch_t structure.
+ * @retval 1 if the kernel has been stopped at a crossing.
+ */
+static uint8_t DCU_BATCH_CmpCheck(stc_dcu_batch_t *pstcBatch)
+{
+    uint32_t u32End;
+    uint32_t u32Val;
+    uint32_t i;
+    uint8_t u8Cross = 0U;
+
+    if (SET == DCU_GetStatus(pstcBatch->pstcDcu, DCU_BATCH_FLAG_OUTSIDE)) {
+        DCU_ClearStatus(pstcBatch->pstcDcu, DCU_BATCH_FLAG_OUTSIDE);
+        /* Elements already written to the DCU */
+        u32End = (DMA_GetSrcAddr(pstcBatch->pstcDmaUnit, pstcBatch->u8DmaCh) - (uint32_t)pstcBatch->pvSrc) /
+                 pstcBatch->u8Size;
+        if (u32End > pstcBatch->u32Len) {
+            u32End = pstcBatch->u32Len;
+        }
+        for (i = pstcBatch->u32Pos; i < u32End; i++) {
+            u32Val = DCU_BATCH_Elem(pstcBatch->pvSrc, pstcBatch->u8Size, i);
+            if ((u32Val < pstcBatch->u32Lower) || (u32Val > pstcBatch->u32Upper)) {
+                pstcBatch->u32CrossIdx = i;
+                u8Cross = 1U;
+                DCU_BATCH_Finish(pstcBatch, DCU_BATCH_EVT_CMP_CROSS);
+                break;
+            }
+        }
+    }
+
+    return u8Cross;
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup DCU_BATCH_Global_Functions DCU_BATCH Global Functions
+ * @{
+ */
+
+/**
+ * @brief  Set each @ref stc_dcu_batch_init_t field to default value.
+ * @param  [out] pstcBatchInit          Pointer to a @ref stc_dcu_batch_init_t structure.
+ * @retval int32_t:
+ *           - LL_OK:                   Initialize success
+ *           - LL_ERR_INVD_PARAM:       pstcBatchInit is NULL
+ */
+int32_t DCU_BATCH_StructInit(stc_dcu_batch_init_t *pstcBatchInit)
+{
+    int32_t i32Ret = LL_OK;
+
+    if (NULL == pstcBatchInit) {
+        i32Ret = LL_ERR_INVD_PARAM;
+    } else {
+        pstcBatchInit->pstcDmaUnit   = NULL;
+        pstcBatchInit->u8DmaCh       = DMA_CH0;
+        pstcBatchInit->u32TrigTarget = AOS_DMA1_0;
+        pstcBatchInit->pfnCallback   = NULL;
+        pstcBatchInit->pvArg         = NULL;
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Initialize a DCU batch kernel.
+ * @param  [out] pstcBatch              Pointer to a @ref stc_dcu_batch_t structure.
+ * @param  [in] DCUx                    Pointer to DCU instance register base
+ *         This parameter can be one of the following values:
+ *           @arg CM_DCU or CM_DCUx:    DCU instance register base
+ * @param  [in] pstcBatchInit           Pointer to a @ref stc_dcu_batch_init_t structure.
+ * @retval int32_t:
+ *           - LL_OK:                   Initialize success
+ *           - LL_ERR_INVD_PARAM:       Invalid parameter, or u32TrigTarget is not the target of u8DmaCh
+ * @note   The DCU is owned by the kernel, its mode and data registers are rewritten by each run.
+ */
+int32_t DCU_BATCH_Init(stc_dcu_batch_t *pstcBatch, CM_DCU_TypeDef *DCUx, const stc_dcu_batch_init_t *pstcBatchInit)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if ((NULL != pstcBatch) && (NULL != DCUx) && (NULL != pstcBatchInit) &&
+        (NULL != pstcBatchInit->pstcDmaUnit) &&
+        IS_DCU_BATCH_DMA_TARGET(pstcBatchInit->pstcDmaUnit, pstcBatchInit->u8DmaCh, pstcBatchInit->u32TrigTarget)) {
+        DDL_ASSERT(pstcBatchInit->u8DmaCh <= DMA_CH7);
+
+        pstcBatch->pstcDcu     = DCUx;
+        pstcBatch->pstcDmaUnit = pstcBatchInit->pstcDmaUnit;
+        pstcBatch->u8DmaCh     = pstcBatchInit->u8DmaCh;
+        pstcBatch->pfnCallback = pstcBatchInit->pfnCallback;
+        pstcBatch->pvArg       = pstcBatchInit->pvArg;
+        pstcBatch->u8State     = DCU_BATCH_STATE_IDLE;
+        pstcBatch->u8Size      = 4U;
+        pstcBatch->u32Mode     = DCU_MD_INVD;
+        pstcBatch->pvSrc       = NULL;
+        pstcBatch->u32Len      = 0UL;
+        pstcBatch->u32Pos      = 0UL;
+        pstcBatch->u32CrossIdx = 0UL;
+        pstcBatch->stcAcc.u32Sum    = 0UL;
+        pstcBatch->stcAcc.u32SatSum = 0UL;
+        pstcBatch->stcAcc.u8Carry   = 0U;
+
+        /* No event left by a former user of the channel may request it */
+        AOS_SetTriggerEventSrc(pstcBatchInit->u32TrigTarget, EVT_SRC_MAX);
+        i32Ret = LL_OK;
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Start accumulating an array.
+ * @param  [in] pstcBatch               Pointer to a @ref stc_dcu_batch_t structure.
+ * @param  [in] u32Mode                 @ref DCU_MD_ADD or @ref DCU_MD_SUB.
+ * @param  [in] u32DataWidth            Width of the elements and of the result, a value of @ref DCU_Data_Width.
+ * @param  [in] pvSrc                   Array, valid until the completion callback.
+ * @param  [in] u32Len                  Number of elements.
+ * @param  [in] u32Seed                 Initial value of the result.
+ * @retval int32_t:
+ *           - LL_OK:                   Kernel started
+ *           - LL_ERR_INVD_PARAM:       Invalid parameter
+ *           - LL_ERR_BUSY:             A kernel is running
+ * @note   Completion is reported with @ref DCU_BATCH_EVT_ACC_DONE, the result is read by
+ *         DCU_BATCH_GetAccResult().
+ */
+int32_t DCU_BATCH_Accumulate(stc_dcu_batch_t *pstcBatch, uint32_t u32Mode, uint32_t u32DataWidth,
+                             const void *pvSrc, uint32_t u32Len, uint32_t u32Seed)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+    stc_dcu_init_t stcDcuInit;
+
+    if ((NULL != pstcBatch) && (NULL != pvSrc) && (0UL != u32Len) && IS_DCU_BATCH_ACC_MD(u32Mode) &&
+        IS_DCU_BATCH_DATA_WIDTH(u32DataWidth)) {
+        if (DCU_BATCH_STATE_IDLE != pstcBatch->u8State) {
+            i32Ret = LL_ERR_BUSY;
+        } else {
+            pstcBatch->u8State = DCU_BATCH_STATE_ACC;
+            pstcBatch->u8Size  = DCU_BATCH_Size(u32DataWidth);
+            pstcBatch->u32Mode = u32Mode;
+            pstcBatch->pvSrc   = pvSrc;
+            pstcBatch->u32Len  = u32Len;
+            pstcBatch->u32Pos  = 0UL;
+
+            (void)DCU_StructInit(&stcDcuInit);
+            stcDcuInit.u32Mode      = u32Mode;
+            stcDcuInit.u32DataWidth = u32DataWidth;
+            (void)DCU_Init(pstcBatch->pstcDcu, &stcDcuInit);
+            DCU_WriteData32(pstcBatch->pstcDcu, DCU_DATA0_IDX, u32Seed & DCU_BATCH_Mask(pstcBatch->u8Size));
+            DCU_ClearStatus(pstcBatch->pstcDcu, DCU_BATCH_FLAG_USED);
+
+            DCU_BATCH_DmaInit(pstcBatch, DCU_DATA1_IDX);
+            DCU_BATCH_Launch(pstcBatch);
+            i32Ret = LL_OK;
+        }
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Start checking an array against limits.
+ * @param  [in] pstcBatch               Pointer to a @ref stc_dcu_batch_t structure.
+ * @param  [in] u32DataWidth            Width of the elements, a value of @ref DCU_Data_Width.
+ * @param  [in] pvSrc                   Array, valid until the completion callback.
+ * @param  [in] u32Len                  Number of elements.
+ * @param  [in] u32Lower                Lowest value within the limits.
+ * @param  [in] u32Upper                Highest value within the limits.
+ * @retval int32_t:
+ *           - LL_OK:                   Kernel started
+ *           - LL_ERR_INVD_PARAM:       Invalid parameter
+ *           - LL_ERR_BUSY:             A kernel is running
+ * @note   The DCU outside window interrupt must call DCU_BATCH_DcuIrqHandler(). The kernel stops
+ *         at the first element out of the limits with @ref DCU_BATCH_EVT_CMP_CROSS, its index
+ *         is read by DCU_BATCH_GetCrossing().
+ */
+int32_t DCU_BATCH_Compare(stc_dcu_batch_t *pstcBatch, uint32_t u32DataWidth, const void *pvSrc, uint32_t u32Len,
+                          uint32_t u32Lower, uint32_t u32Upper)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+    stc_dcu_init_t stcDcuInit;
+
+    if ((NULL != pstcBatch) && (NULL != pvSrc) && (0UL != u32Len) && (u32Lower <= u32Upper) &&
+        IS_DCU_BATCH_DATA_WIDTH(u32DataWidth)) {
+        if (DCU_BATCH_STATE_IDLE != pstcBatch->u8State) {
+            i32Ret = LL_ERR_BUSY;
+        } else {
+            pstcBatch->u8State     = DCU_BATCH_STATE_CMP;
+            pstcBatch->u8Size      = DCU_BATCH_Size(u32DataWidth);
+            pstcBatch->u32Mode     = DCU_MD_CMP;
+            pstcBatch->pvSrc       = pvSrc;
+            pstcBatch->u32Len      = u32Len;
+            pstcBatch->u32Pos      = 0UL;
+            pstcBatch->u32Lower    = u32Lower;
+            pstcBatch->u32Upper    = u32Upper;
+            pstcBatch->u32CrossIdx = u32Len;
+
+            (void)DCU_StructInit(&stcDcuInit);
+            stcDcuInit.u32Mode      = DCU_MD_CMP;
+            stcDcuInit.u32DataWidth = u32DataWidth;
+            (void)DCU_Init(pstcBatch->pstcDcu, &stcDcuInit);
+            DCU_SetCompareCond(pstcBatch->pstcDcu, DCU_CMP_TRIG_DATA0);
+            DCU_WriteData32(pstcBatch->pstcDcu, DCU_DATA1_IDX, u32Upper);
+            DCU_WriteData32(pstcBatch->pstcDcu, DCU_DATA2_IDX, u32Lower);
+            DCU_ClearStatus(pstcBatch->pstcDcu, DCU_BATCH_FLAG_USED);
+            DCU_IntCmd(pstcBatch->pstcDcu, DCU_CATEGORY_CMP_WIN, DCU_INT_CMP_WIN_OUTSIDE, ENABLE);
+            DCU_GlobalIntCmd(pstcBatch->pstcDcu, ENABLE);
+
+            DCU_BATCH_DmaInit(pstcBatch, DCU_DATA0_IDX);
+            DCU_BATCH_Launch(pstcBatch);
+            i32Ret = LL_OK;
+        }
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Get the result of the last accumulation.
+ * @param  [in] pstcBatch               Pointer to a @ref stc_dcu_batch_t structure.
+ * @param  [out] pstcAcc                Pointer to a @ref stc_dcu_batch_acc_t structure.
+ * @retval int32_t:
+ *           - LL_OK:                   Result read
+ *           - LL_ERR_INVD_PARAM:       Invalid parameter
+ *           - LL_ERR_BUSY:             A kernel is running
+ */
+int32_t DCU_BATCH_GetAccResult(const stc_dcu_batch_t *pstcBatch, stc_dcu_batch_acc_t *pstcAcc)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if ((NULL != pstcBatch) && (NULL != pstcAcc)) {
+        if (DCU_BATCH_STATE_IDLE != pstcBatch->u8State) {
+            i32Ret = LL_ERR_BUSY;
+        } else {
+            *pstcAcc = pstcBatch->stcAcc;
+            i32Ret = LL_OK;
+        }
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Get the first element out of the limits of the last compare.
+ * @param  [in] pstcBatch               Pointer to a @ref stc_dcu_batch_t structure.
+ * @param  [out] pu32Idx                Index of the element.
+ * @retval int32_t:
+ *           - LL_OK:                   Crossing found
+ *           - LL_ERR:                  All elements within the limits
+ *           - LL_ERR_INVD_PARAM:       Invalid parameter
+ *           - LL_ERR_BUSY:             A kernel is running
+ */
+int32_t DCU_BATCH_GetCrossing(const stc_dcu_batch_t *pstcBatch, uint32_t *pu32Idx)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if ((NULL != pstcBatch) && (NULL != pu32Idx)) {
+        if (DCU_BATCH_STATE_IDLE != pstcBatch->u8State) {
+            i32Ret = LL_ERR_BUSY;
+        } else if (pstcBatch->u32CrossIdx < pstcBatch->u32Len) {
+            *pu32Idx = pstcBatch->u32CrossIdx;
+            i32Ret = LL_OK;
+        } else {
+            i32Ret = LL_ERR;
+        }
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  DMA transfer complete interrupt handler of a DCU batch kernel.
+ * @param  [in] pstcBatch               Pointer to a @ref stc_dcu_batch_t structure.
+ * @retval None
+ */
+void DCU_BATCH_DmaIrqHandler(stc_dcu_batch_t *pstcBatch)
+{
+    const uint32_t u32Flag = DMA_FLAG_TC_CH0 << pstcBatch->u8DmaCh;
+    uint32_t u32Chunk;
+
+    DDL_ASSERT(NULL != pstcBatch);
+
+    if (SET == DMA_GetTransCompleteStatus(pstcBatch->pstcDmaUnit, u32Flag)) {
+        DMA_ClearTransCompleteStatus(pstcBatch->pstcDmaUnit, u32Flag);
+        if (DCU_BATCH_STATE_IDLE != pstcBatch->u8State) {
+            /* A crossing not served yet belongs to this chunk */
+            if ((DCU_BATCH_STATE_CMP != pstcBatch->u8State) || (0U == DCU_BATCH_CmpCheck(pstcBatch))) {
+                u32Chunk = pstcBatch->u32Len - pstcBatch->u32Pos;
+                if (u32Chunk > DCU_BATCH_CHUNK_MAX) {
+                    u32Chunk = DCU_BATCH_CHUNK_MAX;
+                }
+                pstcBatch->u32Pos += u32Chunk;
+                if (pstcBatch->u32Pos < pstcBatch->u32Len) {
+                    DCU_BATCH_Launch(pstcBatch);
+                } else {
+                    DCU_BATCH_Finish(pstcBatch, (DCU_BATCH_STATE_ACC == pstcBatch->u8State) ?
+                                     DCU_BATCH_EVT_ACC_DONE : DCU_BATCH_EVT_CMP_DONE);
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief  DCU interrupt handler of a DCU batch compare kernel.
+ * @param  [in] pstcBatch               Pointer to a @ref stc_dcu_batch_t structure.
+ * @retval None
+ */
+void DCU_BATCH_DcuIrqHandler(stc_dcu_batch_t *pstcBatch)
+{
+    DDL_ASSERT(NULL != pstcBatch);
+
+    if (DCU_BATCH_STATE_CMP == pstcBatch->u8State) {
+        (void)DCU_BATCH_CmpCheck(pstcBatch);
+    } else {
+        DCU_ClearStatus(pstcBatch->pstcDcu, DCU_BATCH_FLAG_OUTSIDE);
+    }
+}
+
+/**
+ * @brief  Software model of the accumulation kernel.
+ * @param  [in] u32Mode                 @ref DCU_MD_ADD or @ref DCU_MD_SUB.
+ * @param  [in] u32DataWidth            A value of @ref DCU_Data_Width.
+ * @param  [in] pvSrc                   Array.
+ * @param  [in] u32Len                  Number of elements.
+ * @param  [in] u32Seed                 Initial value of the result.
+ * @param  [out] pstcAcc                Pointer to a @ref stc_dcu_batch_acc_t structure.
+ * @retval int32_t:
+ *           - LL_OK:                   Result computed
+ *           - LL_ERR_INVD_PARAM:       Invalid parameter
+ * @note   It gives the result DCU_BATCH_GetAccResult() reads after the same kernel: each element
+ *         is added to or subtracted from the result modulo the data width, and the carry is
+ *         sticky. The elements are unsigned, so once the carry is set the exact result is beyond
+ *         the range and the saturated result is its bound. It touches no register and may be
+ *         built on the host.
+ */
+int32_t DCU_BATCH_AccumulateModel(uint32_t u32Mode, uint32_t u32DataWidth, const void *pvSrc, uint32_t u32Len,
+                                  uint32_t u32Seed, stc_dcu_batch_acc_t *pstcAcc)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+    uint8_t u8Size;
+    uint32_t u32Mask;
+    uint32_t u32Acc;
+    uint32_t u32Val;
+    uint8_t u8Carry = 0U;
+    uint32_t i;
+
+    if ((NULL != pvSrc) && (NULL != pstcAcc) && IS_DCU_BATCH_ACC_MD(u32Mode) &&
+        IS_DCU_BATCH_DATA_WIDTH(u32DataWidth)) {
+        u8Size  = DCU_BATCH_Size(u32DataWidth);
+        u32Mask = DCU_BATCH_Mask(u8Size);
+        u32Acc  = u32Seed & u32Mask;
+        for (i = 0UL; i < u32Len; i++) {
+            u32Val = DCU_BATCH_Elem(pvSrc, u8Size, i);
+            if (DCU_MD_ADD == u32Mode) {
+                if (u32Val > (u32Mask - u32Acc)) {
+                    u8Carry = 1U;
+                }
+                u32Acc = (u32Acc + u32Val) & u32Mask;
+            } else {
+                if (u32Val > u32Acc) {
+                    u8Carry = 1U;
+                }
+                u32Acc = (u32Acc - u32Val) & u32Mask;
+            }
+        }
+        pstcAcc->u32Sum    = u32Acc;
+        pstcAcc->u8Carry   = u8Carry;
+        pstcAcc->u32SatSum = u32Acc;
+        if (0U != u8Carry) {
+            pstcAcc->u32SatSum = (DCU_MD_ADD == u32Mode) ? u32Mask : 0UL;
+        }
+        i32Ret = LL_OK;
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @}
+ */
+
+#endif /* LL_DCU_BATCH_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,581 @@
+/**
+ *******************************************************************************
+ * @file  hc32_ll_dmc_mem.c
+ * @brief This file provides firmware functions to manage and test the memory
+ *        behind EXMC_DMC.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2025, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ll_dmc_mem.h"
+#include "hc32_ll_dmc.h"
+#include "hc32_ll_utility.h"
+
+/**
+ * @addtogroup LL_Driver
+ * @{
+ */
+
+/**
+ * @defgroup LL_DMC_MEM DMC_MEM
+ * @brief SDRAM Memory Manager Driver Library
+ * @note  A region is a window of memory, usually an SDRAM chip set up by EXMC_DMC_Init() and
+ *        EXMC_DMC_ChipConfig(). Memory is taken from the bottom of a region by a bump arena,
+ *        for long-lived or frame-scoped buffers released together by DMC_MEM_ArenaReset(),
+ *        and fixed size block pools are carved from the arena for buffers freed one by one,
+ *        with O(1) allocation and free. The allocators touch no register.
+ * @{
+ */
+
+#if (LL_DMC_MEM_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup DMC_MEM_Local_Macros DMC_MEM Local Macros
+ * @{
+ */
+
+/* Size of the address window of EXMC_DMC_GetChipEndAddr() */
+#define DMC_MEM_CHIP_END_BLK            (0x01000000UL)
+
+/* Word patterns of the memory test */
+#define DMC_MEM_PATTERN                 (0x55555555UL)
+#define DMC_MEM_ANTI_PATTERN            (0xAAAAAAAAUL)
+
+/* March element operations */
+#define DMC_MEM_MARCH_RD                (0x01U)
+#define DMC_MEM_MARCH_WR                (0x02U)
+#define DMC_MEM_MARCH_DOWN              (0x04U)
+
+/**
+ * @defgroup DMC_MEM_Check_Parameters_Validity DMC_MEM Check Parameters Validity
+ * @{
+ */
+#define IS_DMC_MEM_ALIGN(x)             (((x) != 0UL) && (((x) & ((x) - 1UL)) == 0UL))
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @defgroup DMC_MEM_Local_Functions DMC_MEM Local Functions
+ * @{
+ */
+
+/**
+ * @brief  Walking one test of the data bus.
+ * @param  [in] pu32Mem                 Word to test.
+ * @retval 1 if passed.
+ */
+static uint8_t DMC_MEM_DataBusTest(__IO uint32_t *pu32Mem)
+{
+    uint32_t u32Bit;
+    uint8_t u8Pass = 1U;
+
+    for (u32Bit = 1UL; u32Bit != 0UL; u32Bit <<= 1U) {
+        *pu32Mem = u32Bit;
+        if (*pu32Mem != u32Bit) {
+            u8Pass = 0U;
+            break;
+        }
+    }
+
+    return u8Pass;
+}
+
+/**
+ * @brief  Address bus test, each power of two word offset must be a distinct word.
+ * @param  [in] pu32Mem                 Region base.
+ * @param  [in] u32Words                Region size in words.
+ * @param  [out] pu32FailOffset         Word offset of a faulty line.
+ * @retval 1 if passed.
+ */
+static uint8_t DMC_MEM_AddrBusTest(__IO uint32_t *pu32Mem, uint32_t u32Words, uint32_t *pu32FailOffset)
+{
+    uint32_t u32Off;
+    uint32_t u32Test;
+    uint8_t u8Pass = 1U;
+
+    for (u32Off = 1UL; u32Off < u32Words; u32Off <<= 1U) {
+        pu32Mem[u32Off] = DMC_MEM_PATTERN;
+    }
+    /* Lines stuck high */
+    pu32Mem[0] = DMC_MEM_ANTI_PATTERN;
+    for (u32Off = 1UL; u32Off < u32Words; u32Off <<= 1U) {
+        if (pu32Mem[u32Off] != DMC_MEM_PATTERN) {
+            *pu32FailOffset = u32Off;
+            u8Pass = 0U;
+            break;
+        }
+    }
+    pu32Mem[0] = DMC_MEM_PATTERN;
+
+    /* Lines stuck low or shorted */
+    for (u32Test = 1UL; (u32Test < u32Words) && (0U != u8Pass); u32Test <<= 1U) {
+        pu32Mem[u32Test] = DMC_MEM_ANTI_PATTERN;
+        if (pu32Mem[0] != DMC_MEM_PATTERN) {
+            *pu32FailOffset = u32Test;
+            u8Pass = 0U;
+        }
+        for (u32Off = 1UL; (u32Off < u32Words) && (0U != u8Pass); u32Off <<= 1U) {
+            if ((u32Off != u32Test) && (pu32Mem[u32Off] != DMC_MEM_PATTERN)) {
+                *pu32FailOffset = u32Test;
+                u8Pass = 0U;
+            }
+        }
+        pu32Mem[u32Test] = DMC_MEM_PATTERN;
+    }
+
+    return u8Pass;
+}
+
+/**
+ * @brief  Run one element of the march test.
+ * @param  [in] pu32Mem                 First word of the window.
+ * @param  [in] u32Words                Window size in words.
+ * @param  [in] u8Op                    DMC_MEM_MARCH_RD, DMC_MEM_MARCH_WR and DMC_MEM_MARCH_DOWN.
+ * @param  [in] u32Expect               Word read.
+ * @param  [in] u32Write                Word written.
+ * @param  [out] pu32FailOffset         Word offset of the first faulty word.
+ * @retval 1 if passed.
+ */
+static uint8_t DMC_MEM_MarchElem(__IO uint32_t *pu32Mem, uint32_t u32Words, uint8_t u8Op,
+                                 uint32_t u32Expect, uint32_t u32Write, uint32_t *pu32FailOffset)
+{
+    uint32_t i;
+    uint32_t u32Off;
+    uint8_t u8Pass = 1U;
+
+    for (i = 0UL; i < u32Words; i++) {
+        u32Off = (0U != (u8Op & DMC_MEM_MARCH_DOWN)) ? (u32Words - 1UL - i) : i;
+        if ((0U != (u8Op & DMC_MEM_MARCH_RD)) && (pu32Mem[u32Off] != u32Expect)) {
+            *pu32FailOffset = u32Off;
+            u8Pass = 0U;
+            break;
+        }
+        if (0U != (u8Op & DMC_MEM_MARCH_WR)) {
+            pu32Mem[u32Off] = u32Write;
+        }
+    }
+
+    return u8Pass;
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup DMC_MEM_Global_Functions DMC_MEM Global Functions
+ * @{
+ */
+
+/**
+ * @brief  Initialize a memory region.
+ * @param  [out] pstcRegion             Pointer to a @ref stc_dmc_mem_region_t structure.
+ * @param  [in] u32Base                 First address of the region.
+ * @param  [in] u32Size                 Size of the region in bytes.
+ * @retval int32_t:
+ *           - LL_OK:                   Initialize success
+ *           - LL_ERR_INVD_PARAM:       Invalid parameter
+ * @note   Any memory can be a region, such as internal SRAM or SDRAM not managed by the chip.
+ */
+int32_t DMC_MEM_RegionInit(stc_dmc_mem_region_t *pstcRegion, uint32_t u32Base, uint32_t u32Size)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if ((NULL != pstcRegion) && (0UL != u32Size) && (u32Size <= (0xFFFFFFFFUL - u32Base))) {
+        pstcRegion->u32Base = u32Base;
+        pstcRegion->u32End  = u32Base + u32Size;
+        pstcRegion->u32Top  = u32Base;
+        i32Ret = LL_OK;
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Initialize a memory region over an SDRAM chip.
+ * @param  [out] pstcRegion             Pointer to a @ref stc_dmc_mem_region_t structure.
+ * @param  [in] u32Chip                 The chip number, a value of @ref EXMC_DMC_Chip.
+ * @param  [in] u32ChipSize             Size of the SDRAM in bytes.
+ * @retval int32_t:
+ *           - LL_OK:                   Initialize success
+ *           - LL_ERR_INVD_PARAM:       Invalid parameter
+ * @note   The chip must have been set up by EXMC_DMC_ChipConfig(). The region is the SDRAM size
+ *         clipped by the address window of the chip.
+ */
+int32_t DMC_MEM_RegionInitChip(stc_dmc_mem_region_t *pstcRegion, uint32_t u32Chip, uint32_t u32ChipSize)
+{
+    uint32_t u32Start;
+    uint32_t u32Window;
+
+    u32Start  = EXMC_DMC_GetChipStartAddr(u32Chip);
+    u32Window = (EXMC_DMC_GetChipEndAddr(u32Chip) - u32Start) + DMC_MEM_CHIP_END_BLK;
+    if (u32ChipSize > u32Window) {
+        u32ChipSize = u32Window;
+    }
+
+    return DMC_MEM_RegionInit(pstcRegion, u32Start, u32ChipSize);
+}
+
+/**
+ * @brief  Allocate memory from the arena of a region.
+ * @param  [in] pstcRegion              Pointer to a @ref stc_dmc_mem_region_t structure.
+ * @param  [in] u32Size                 Size in bytes.
+ * @param  [in] u32Align                Alignment in bytes, a power of two.
+ * @retval Memory allocated, NULL if the region is full.
+ * @note   The memory is released by DMC_MEM_ArenaReset() only.
+ */
+void *DMC_MEM_ArenaAlloc(stc_dmc_mem_region_t *pstcRegion, uint32_t u32Size, uint32_t u32Align)
+{
+    void *pvMem = NULL;
+    uint32_t u32Addr;
+    uint32_t u32Primask;
+
+    DDL_ASSERT(NULL != pstcRegion);
+    DDL_ASSERT(IS_DMC_MEM_ALIGN(u32Align));
+
+    u32Primask = __get_PRIMASK();
+    __disable_irq();
+    u32Addr = (pstcRegion->u32Top + (u32Align - 1UL)) & ~(u32Align - 1UL);
+    if ((u32Addr >= pstcRegion->u32Top) && (u32Addr <= pstcRegion->u32End) &&
+        (u32Size <= (pstcRegion->u32End - u32Addr))) {
+        pstcRegion->u32Top = u32Addr + u32Size;
+        pvMem = (void *)u32Addr;
+    }
+    __set_PRIMASK(u32Primask);
+
+    return pvMem;
+}
+
+/**
+ * @brief  Get the arena position, to release later all memory allocated after it.
+ * @param  [in] pstcRegion              Pointer to a @ref stc_dmc_mem_region_t structure.
+ * @retval Mark for DMC_MEM_ArenaReset().
+ */
+uint32_t DMC_MEM_ArenaMark(const stc_dmc_mem_region_t *pstcRegion)
+{
+    DDL_ASSERT(NULL != pstcRegion);
+
+    return pstcRegion->u32Top;
+}
+
+/**
+ * @brief  Release all memory allocated after a mark.
+ * @param  [in] pstcRegion              Pointer to a @ref stc_dmc_mem_region_t structure.
+ * @param  [in] u32Mark                 Value of DMC_MEM_ArenaMark(), or 0 to release all memory.
+ * @retval int32_t:
+ *           - LL_OK:                   Memory released
+ *           - LL_ERR_INVD_PARAM:       u32Mark is above the arena position
+ * @note   Pools carved after the mark are released too.
+ */
+int32_t DMC_MEM_ArenaReset(stc_dmc_mem_region_t *pstcRegion, uint32_t u32Mark)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+    uint32_t u32Primask;
+
+    DDL_ASSERT(NULL != pstcRegion);
+
+    u32Primask = __get_PRIMASK();
+    __disable_irq();
+    if (0UL == u32Mark) {
+        u32Mark = pstcRegion->u32Base;
+    }
+    if ((u32Mark >= pstcRegion->u32Base) && (u32Mark <= pstcRegion->u32Top)) {
+        pstcRegion->u32Top = u32Mark;
+        i32Ret = LL_OK;
+    }
+    __set_PRIMASK(u32Primask);
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Get the free size of the arena of a region.
+ * @param  [in] pstcRegion              Pointer to a @ref stc_dmc_mem_region_t structure.
+ * @retval Free size in bytes.
+ */
+uint32_t DMC_MEM_ArenaGetFree(const stc_dmc_mem_region_t *pstcRegion)
+{
+    DDL_ASSERT(NULL != pstcRegion);
+
+    return pstcRegion->u32End - pstcRegion->u32Top;
+}
+
+/**
+ * @brief  Carve a fixed size block pool from the arena of a region.
+ * @param  [out] pstcPool               Pointer to a @ref stc_dmc_mem_pool_t structure.
+ * @param  [in] pstcRegion              Pointer to a @ref stc_dmc_mem_region_t structure.
+ * @param  [in] u32BlkSize              Block size in bytes, rounded up to @ref DMC_MEM_POOL_ALIGN.
+ * @param  [in] u32BlkNum               Number of blocks.
+ * @retval int32_t:
+ *           - LL_OK:                   Initialize success
+ *           - LL_ERR_INVD_PARAM:       Invalid parameter
+ *           - LL_ERR_BUF_FULL:         The arena is too small
+ */
+int32_t DMC_MEM_PoolInit(stc_dmc_mem_pool_t *pstcPool, stc_dmc_mem_region_t *pstcRegion,
+                         uint32_t u32BlkSize, uint32_t u32BlkNum)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+    uint8_t *pu8Blk;
+    uint32_t i;
+
+    if ((NULL != pstcPool) && (NULL != pstcRegion) && (0UL != u32BlkSize) && (0UL != u32BlkNum) &&
+        (u32BlkSize <= (0xFFFFFFFFUL - DMC_MEM_POOL_ALIGN))) {
+        u32BlkSize = (u32BlkSize + (DMC_MEM_POOL_ALIGN - 1UL)) & ~(DMC_MEM_POOL_ALIGN - 1UL);
+        i32Ret = LL_ERR_BUF_FULL;
+        if (u32BlkNum <= (0xFFFFFFFFUL / u32BlkSize)) {
+            pu8Blk = (uint8_t *)DMC_MEM_ArenaAlloc(pstcRegion, u32BlkSize * u32BlkNum, DMC_MEM_POOL_ALIGN);
+            if (NULL != pu8Blk) {
+                pstcPool->u32Base       = (uint32_t)pu8Blk;
+                pstcPool->u32End        = (uint32_t)pu8Blk + (u32BlkSize * u32BlkNum);
+                pstcPool->u32BlkSize    = u32BlkSize;
+                pstcPool->u32FreeNum    = u32BlkNum;
+                pstcPool->u32MinFreeNum = u32BlkNum;
+                /* Link the free blocks in address order */
+                for (i = 0UL; i < (u32BlkNum - 1UL); i++) {
+                    *(void **)(void *)pu8Blk = (void *)(pu8Blk + u32BlkSize);
+                    pu8Blk += u32BlkSize;
+                }
+                *(void **)(void *)pu8Blk = NULL;
+                pstcPool->pvFree = (void *)pstcPool->u32Base;
+                i32Ret = LL_OK;
+            }
+        }
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Allocate a block from a pool.
+ * @param  [in] pstcPool                Pointer to a @ref stc_dmc_mem_pool_t structure.
+ * @retval Block allocated, NULL if the pool is empty.
+ */
+void *DMC_MEM_PoolAlloc(stc_dmc_mem_pool_t *pstcPool)
+{
+    void *pvBlk;
+    uint32_t u32Primask;
+
+    DDL_ASSERT(NULL != pstcPool);
+
+    u32Primask = __get_PRIMASK();
+    __disable_irq();
+    pvBlk = pstcPool->pvFree;
+    if (NULL != pvBlk) {
+        pstcPool->pvFree = *(void **)pvBlk;
+        pstcPool->u32FreeNum--;
+        if (pstcPool->u32FreeNum < pstcPool->u32MinFreeNum) {
+            pstcPool->u32MinFreeNum = pstcPool->u32FreeNum;
+        }
+    }
+    __set_PRIMASK(u32Primask);
+
+    return pvBlk;
+}
+
+/**
+ * @brief  Give a block back to its pool.
+ * @param  [in] pstcPool                Pointer to a @ref stc_dmc_mem_pool_t structure.
+ * @param  [in] pvBlk                   Block allocated by DMC_MEM_PoolAlloc().
+ * @retval int32_t:
+ *           - LL_OK:                   Block freed
+ *           - LL_ERR_INVD_PARAM:       pvBlk is not a block of the pool
+ */
+int32_t DMC_MEM_PoolFree(stc_dmc_mem_pool_t *pstcPool, void *pvBlk)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+    const uint32_t u32Addr = (uint32_t)pvBlk;
+    uint32_t u32Primask;
+
+    DDL_ASSERT(NULL != pstcPool);
+
+    if ((u32Addr >= pstcPool->u32Base) && (u32Addr < pstcPool->u32End) &&
+        (0UL == ((u32Addr - pstcPool->u32Base) % pstcPool->u32BlkSize))) {
+        u32Primask = __get_PRIMASK();
+        __disable_irq();
+        *(void **)pvBlk = pstcPool->pvFree;
+        pstcPool->pvFree = pvBlk;
+        pstcPool->u32FreeNum++;
+        __set_PRIMASK(u32Primask);
+        i32Ret = LL_OK;
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Get the number of free blocks of a pool.
+ * @param  [in] pstcPool                Pointer to a @ref stc_dmc_mem_pool_t structure.
+ * @retval Free blocks.
+ */
+uint32_t DMC_MEM_PoolGetFree(const stc_dmc_mem_pool_t *pstcPool)
+{
+    DDL_ASSERT(NULL != pstcPool);
+
+    return pstcPool->u32FreeNum;
+}
+
+/**
+ * @brief  Set each @ref stc_dmc_mem_test_t field to default value.
+ * @param  [out] pstcTest               Pointer to a @ref stc_dmc_mem_test_t structure.
+ * @retval int32_t:
+ *           - LL_OK:                   Initialize success
+ *           - LL_ERR_INVD_PARAM:       pstcTest is NULL
+ */
+int32_t DMC_MEM_TestStructInit(stc_dmc_mem_test_t *pstcTest)
+{
+    int32_t i32Ret = LL_OK;
+
+    if (NULL == pstcTest) {
+        i32Ret = LL_ERR_INVD_PARAM;
+    } else {
+        pstcTest->u32Offset = 0UL;
+        pstcTest->u32Size   = 0UL;
+        pstcTest->enBusTest = ENABLE;
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Test the memory of a region.
+ * @param  [in] pstcRegion              Pointer to a @ref stc_dmc_mem_region_t structure.
+ * @param  [in] pstcTest                Pointer to a @ref stc_dmc_mem_test_t structure.
+ * @param  [out] pu32FailAddr           Faulty address, may be NULL.
+ * @retval int32_t:
+ *           - LL_OK:                   Test passed
+ *           - LL_ERR:                  Test failed
+ *           - LL_ERR_INVD_PARAM:       Invalid parameter
+ * @note   The test destroys the content and is run before any allocation. The bus test covers
+ *         the data lines and the address lines of the whole region in a few hundred accesses.
+ *         The word-wide March C- test, 10 accesses per word, covers the cells of the window.
+ *         Its patterns flip every bit of a word at each step. A small window keeps the boot
+ *         short, the bus test still catches wiring faults over the whole region.
+ */
+int32_t DMC_MEM_Test(const stc_dmc_mem_region_t *pstcRegion, const stc_dmc_mem_test_t *pstcTest,
+                     uint32_t *pu32FailAddr)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+    __IO uint32_t *pu32Mem;
+    uint32_t u32Words;
+    uint32_t u32Size;
+    uint32_t u32FailOffset = 0UL;
+    uint8_t u8Pass = 1U;
+
+    if ((NULL != pstcRegion) && (NULL != pstcTest) && (0UL == (pstcTest->u32Offset & 3UL)) &&
+        (0UL == (pstcTest->u32Size & 3UL)) &&
+        (pstcTest->u32Offset < (pstcRegion->u32End - pstcRegion->u32Base))) {
+        u32Size = pstcRegion->u32End - pstcRegion->u32Base - pstcTest->u32Offset;
+        if ((0UL != pstcTest->u32Size) && (pstcTest->u32Size < u32Size)) {
+            u32Size = pstcTest->u32Size;
+        }
+
+        pu32Mem = (__IO uint32_t *)pstcRegion->u32Base;
+        if (ENABLE == pstcTest->enBusTest) {
+            u32Words = (pstcRegion->u32End - pstcRegion->u32Base) / 4UL;
+            u8Pass = DMC_MEM_DataBusTest(pu32Mem);
+            if (0U != u8Pass) {
+                u8Pass = DMC_MEM_AddrBusTest(pu32Mem, u32Words, &u32FailOffset);
+            }
+        }
+
+        if (0U != u8Pass) {
+            pu32Mem = (__IO uint32_t *)(pstcRegion->u32Base + pstcTest->u32Offset);
+            u32Words = u32Size / 4UL;
+            /* March C-: up(w0) up(r0,w1) up(r1,w0) down(r0,w1) down(r1,w0) up(r0) */
+            u8Pass = DMC_MEM_MarchElem(pu32Mem, u32Words, DMC_MEM_MARCH_WR,
+                                       0UL, DMC_MEM_PATTERN, &u32FailOffset);
+            if (0U != u8Pass) {
+                u8Pass = DMC_MEM_MarchElem(pu32Mem, u32Words, DMC_MEM_MARCH_RD | DMC_MEM_MARCH_WR,
+                                           DMC_MEM_PATTERN, DMC_MEM_ANTI_PATTERN, &u32FailOffset);
+            }
+            if (0U != u8Pass) {
+                u8Pass = DMC_MEM_MarchElem(pu32Mem, u32Words, DMC_MEM_MARCH_RD | DMC_MEM_MARCH_WR,
+                                           DMC_MEM_ANTI_PATTERN, DMC_MEM_PATTERN, &u32FailOffset);
+            }
+            if (0U != u8Pass) {
+                u8Pass = DMC_MEM_MarchElem(pu32Mem, u32Words,
+                                           DMC_MEM_MARCH_RD | DMC_MEM_MARCH_WR | DMC_MEM_MARCH_DOWN,
+                                           DMC_MEM_PATTERN, DMC_MEM_ANTI_PATTERN, &u32FailOffset);
+            }
+            if (0U != u8Pass) {
+                u8Pass = DMC_MEM_MarchElem(pu32Mem, u32Words,
+                                           DMC_MEM_MARCH_RD | DMC_MEM_MARCH_WR | DMC_MEM_MARCH_DOWN,
+                                           DMC_MEM_ANTI_PATTERN, DMC_MEM_PATTERN, &u32FailOffset);
+            }
+            if (0U != u8Pass) {
+                u8Pass = DMC_MEM_MarchElem(pu32Mem, u32Words, DMC_MEM_MARCH_RD,
+                                           DMC_MEM_PATTERN, 0UL, &u32FailOffset);
+            }
+        }
+
+        i32Ret = LL_OK;
+        if (0U == u8Pass) {
+            if (NULL != pu32FailAddr) {
+                *pu32FailAddr = (uint32_t)pu32Mem + (u32FailOffset * 4UL);
+            }
+            i32Ret = LL_ERR;
+        }
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @}
+ */
+
+#endif /* LL_DMC_MEM_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,425 @@
+/**
+ *******************************************************************************
+ * @file  hc32_ll_dvfs.c
+ * @brief This file provides firmware functions to switch between operating
+ *        points of the system clock, wait cycles and power mode.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       CDT             First version
+                                    Notify the peripherals through the CLK notifiers, reject a source at two frequencies
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2025, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ll_dvfs.h"
+#include "hc32_ll_efm.h"
+#include "hc32_ll_gpio.h"
+#include "hc32_ll_pwc.h"
+#include "hc32_ll_sram.h"
+#include "hc32_ll_utility.h"
+
+/**
+ * @addtogroup LL_Driver
+ * @{
+ */
+
+/**
+ * @defgroup LL_DVFS DVFS
+ * @brief Dynamic Frequency Scaling Driver Library
+ * @note  An operating point gives the system clock source and frequency, the bus dividers, the
+ *        EFM, SRAM and GPIO wait cycles and the power mode. DVFS_Plan() orders the steps from one
+ *        point to another so that no clock ever runs beyond what the voltage, the wait cycles
+ *        and the bus limits of either point allow:
+ *        - the high speed mode is entered first and the ultra low speed mode last;
+ *        - the wait cycles are raised to the larger of both points before the clock changes and
+ *          set to the target point after it;
+ *        - when the system clock rises the dividers of the target are set before the source,
+ *          otherwise after it.
+ *        The table gives no PLL settings, so all points of one source share its frequency.
+ *        DVFS_SetOpp() wraps the plan in CLK_ChangeBegin() and CLK_ChangeEnd(): the CLK
+ *        notifiers are asked first, any of which may refuse, for example while a frame is on the
+ *        line, and are called once more with the new bus frequencies to recompute their dividers,
+ *        not for each step. The time spent in the steps is measured with the DWT cycle counter at
+ *        the HCLK of each step.
+ * @{
+ */
+
+#if (LL_DVFS_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup DVFS_Local_Macros DVFS Local Macros
+ * @{
+ */
+#define DVFS_NS_PER_S                   (1000000000ULL)
+
+/* SRAMs sharing the wait cycle u32SramWait */
+#define DVFS_SRAM_SEL                   (SRAM_SRAM123 | SRAM_SRAM4 | SRAM_SRAMB)
+
+#define DVFS_MAX(a, b)                  (((a) > (b)) ? (a) : (b))
+
+/**
+ * @defgroup DVFS_Check_Parameters_Validity DVFS Check Parameters Validity
+ * @{
+ */
+#define IS_DVFS_PWR_MD(x)               (((x) == DVFS_PWR_HIGH_SPEED) || ((x) == DVFS_PWR_ULOW_SPEED))
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @defgroup DVFS_Local_Functions DVFS Local Functions
+ * @{
+ */
+
+/**
+ * @brief  Bus clock frequencies of an operating point.
+ * @param  [in] pstcOpp                 Pointer to a @ref stc_dvfs_opp_t structure.
+ * @param  [out] pstcClockFreq          Pointer to a @ref stc_clock_freq_t structure.
+ * @retval None
+ */
+static void OppClockFreq(const stc_dvfs_opp_t *pstcOpp, stc_clock_freq_t *pstcClockFreq)
+{
+    const uint32_t u32Sysclk = pstcOpp->u32SysclkFreq;
+    const uint32_t u32Div = pstcOpp->u32ClockDiv;
+
+    pstcClockFreq->u32SysclkFreq = u32Sysclk;
+    pstcClockFreq->u32HclkFreq   = u32Sysclk >> ((u32Div & CMU_SCFGR_HCLKS)  >> CMU_SCFGR_HCLKS_POS);
+    pstcClockFreq->u32Pclk0Freq  = u32Sysclk >> ((u32Div & CMU_SCFGR_PCLK0S) >> CMU_SCFGR_PCLK0S_POS);
+    pstcClockFreq->u32Pclk1Freq  = u32Sysclk >> ((u32Div & CMU_SCFGR_PCLK1S) >> CMU_SCFGR_PCLK1S_POS);
+    pstcClockFreq->u32Pclk2Freq  = u32Sysclk >> ((u32Div & CMU_SCFGR_PCLK2S) >> CMU_SCFGR_PCLK2S_POS);
+    pstcClockFreq->u32Pclk3Freq  = u32Sysclk >> ((u32Div & CMU_SCFGR_PCLK3S) >> CMU_SCFGR_PCLK3S_POS);
+    pstcClockFreq->u32Pclk4Freq  = u32Sysclk >> ((u32Div & CMU_SCFGR_PCLK4S) >> CMU_SCFGR_PCLK4S_POS);
+    pstcClockFreq->u32ExclkFreq  = u32Sysclk >> ((u32Div & CMU_SCFGR_EXCKS)  >> CMU_SCFGR_EXCKS_POS);
+}
+
+/**
+ * @brief  Set the wait cycles.
+ * @param  [in] u32EfmWait              EFM read wait cycle.
+ * @param  [in] u32SramhWait            SRAMH access wait cycle.
+ * @param  [in] u32SramWait             Other SRAMs access wait cycle.
+ * @param  [in] u16GpioWait             GPIO read wait cycle.
+ * @retval int32_t:
+ *           - LL_OK:                   No error occurred.
+ *           - LL_ERR_TIMEOUT:          The EFM is not ready.
+ */
+static int32_t SetWait(uint32_t u32EfmWait, uint32_t u32SramhWait, uint32_t u32SramWait, uint16_t u16GpioWait)
+{
+    SRAM_SetWaitCycle(SRAM_SRAMH, u32SramhWait, u32SramhWait);
+    SRAM_SetWaitCycle(DVFS_SRAM_SEL, u32SramWait, u32SramWait);
+    GPIO_SetReadWaitCycle(u16GpioWait);
+    return EFM_SetWaitCycle(u32EfmWait);
+}
+
+/**
+ * @brief  Run one step of a transition.
+ * @param  [in] u8Step                  A value of @ref DVFS_Step.
+ * @param  [in] pstcFrom                Current operating point.
+ * @param  [in] pstcTo                  Target operating point.
+ * @retval int32_t:
+ *           - LL_OK:                   No error occurred.
+ *           - LL_ERR:                  The power mode did not switch.
+ *           - LL_ERR_TIMEOUT:          The EFM is not ready.
+ */
+static int32_t RunStep(uint8_t u8Step, const stc_dvfs_opp_t *pstcFrom, const stc_dvfs_opp_t *pstcTo)
+{
+    int32_t i32Ret = LL_OK;
+
+    switch (u8Step) {
+        case DVFS_STEP_HIGH_SPEED:
+            i32Ret = PWC_LowSpeedToHighSpeed();
+            break;
+        case DVFS_STEP_WAIT_RAISE:
+            i32Ret = SetWait(DVFS_MAX(pstcFrom->u32EfmWait, pstcTo->u32EfmWait),
+                             DVFS_MAX(pstcFrom->u32SramhWait, pstcTo->u32SramhWait),
+                             DVFS_MAX(pstcFrom->u32SramWait, pstcTo->u32SramWait),
+                             (uint16_t)DVFS_MAX(pstcFrom->u16GpioWait, pstcTo->u16GpioWait));
+            break;
+        case DVFS_STEP_CLK_DIV:
+            CLK_SetClockDiv(CLK_BUS_CLK_ALL, pstcTo->u32ClockDiv);
+            break;
+        case DVFS_STEP_CLK_SRC:
+            CLK_SetSysClockSrc(pstcTo->u8SysClockSrc);
+            break;
+        case DVFS_STEP_WAIT_FINAL:
+            i32Ret = SetWait(pstcTo->u32EfmWait, pstcTo->u32SramhWait, pstcTo->u32SramWait, pstcTo->u16GpioWait);
+            break;
+        case DVFS_STEP_ULOW_SPEED:
+            i32Ret = PWC_HighSpeedToLowSpeed();
+            break;
+        default:
+            break;
+    }
+    return i32Ret;
+}
+
+/**
+ * @brief  Check that two operating points agree on the frequency of a shared source.
+ * @param  [in] pstcFrom                Current operating point.
+ * @param  [in] pstcTo                  Target operating point.
+ * @retval uint8_t: 1 if the sources differ or run at one frequency, else 0
+ */
+static uint8_t OppClockMatch(const stc_dvfs_opp_t *pstcFrom, const stc_dvfs_opp_t *pstcTo)
+{
+    return (uint8_t)((pstcFrom->u8SysClockSrc != pstcTo->u8SysClockSrc) ||
+                     (pstcFrom->u32SysclkFreq == pstcTo->u32SysclkFreq));
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup DVFS_Global_Functions DVFS Global Functions
+ * @{
+ */
+
+/**
+ * @brief  Initialize a DVFS manager.
+ * @param  [out] pstcDvfs               Pointer to a @ref stc_dvfs_t structure.
+ * @param  [in] pstcOpp                 Operating point table, kept by the driver.
+ * @param  [in] u8OppNum                Number of operating points.
+ * @param  [in] u8Cur                   Operating point the system runs at.
+ * @retval int32_t:
+ *           - LL_OK:                   No error occurred.
+ *           - LL_ERR_INVD_PARAM:       A pointer is NULL, u8Cur is out of the table or two points
+ *                                      give one source different frequencies.
+ * @note   The DWT cycle counter is started for the latency measurement.
+ */
+int32_t DVFS_Init(stc_dvfs_t *pstcDvfs, const stc_dvfs_opp_t *pstcOpp, uint8_t u8OppNum, uint8_t u8Cur)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+    uint8_t i;
+    uint8_t j;
+
+    if ((NULL != pstcDvfs) && (NULL != pstcOpp) && (u8Cur < u8OppNum)) {
+        i32Ret = LL_OK;
+        for (i = 0U; i < u8OppNum; i++) {
+            DDL_ASSERT(IS_DVFS_PWR_MD(pstcOpp[i].u8PowerMode));
+            for (j = (uint8_t)(i + 1U); j < u8OppNum; j++) {
+                if (0U == OppClockMatch(&pstcOpp[i], &pstcOpp[j])) {
+                    i32Ret = LL_ERR_INVD_PARAM;
+                }
+            }
+        }
+    }
+    if (LL_OK == i32Ret) {
+        pstcDvfs->pstcOpp   = pstcOpp;
+        pstcDvfs->u8OppNum  = u8OppNum;
+        pstcDvfs->u8Cur     = u8Cur;
+        pstcDvfs->u32LastNs = 0UL;
+        pstcDvfs->u32MaxNs  = 0UL;
+
+        CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+        DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    }
+    return i32Ret;
+}
+
+/**
+ * @brief  Order the steps of a transition.
+ * @param  [in] pstcFrom                Current operating point.
+ * @param  [in] pstcTo                  Target operating point.
+ * @param  [out] pstcPlan               Pointer to a @ref stc_dvfs_plan_t structure.
+ * @retval int32_t:
+ *           - LL_OK:                   No error occurred.
+ *           - LL_ERR_INVD_PARAM:       A pointer is NULL or both points give one source different
+ *                                      frequencies, which needs the source reconfigured.
+ */
+int32_t DVFS_Plan(const stc_dvfs_opp_t *pstcFrom, const stc_dvfs_opp_t *pstcTo, stc_dvfs_plan_t *pstcPlan)
+{
+    uint8_t u8Num = 0U;
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if ((NULL != pstcFrom) && (NULL != pstcTo) && (NULL != pstcPlan) &&
+        (0U != OppClockMatch(pstcFrom, pstcTo))) {
+        /* The voltage rises before anything runs faster */
+        if ((DVFS_PWR_ULOW_SPEED == pstcFrom->u8PowerMode) && (DVFS_PWR_HIGH_SPEED == pstcTo->u8PowerMode)) {
+            pstcPlan->au8Step[u8Num++] = DVFS_STEP_HIGH_SPEED;
+        }
+        if ((pstcTo->u32EfmWait > pstcFrom->u32EfmWait) || (pstcTo->u32SramhWait > pstcFrom->u32SramhWait) ||
+            (pstcTo->u32SramWait > pstcFrom->u32SramWait) || (pstcTo->u16GpioWait > pstcFrom->u16GpioWait)) {
+            pstcPlan->au8Step[u8Num++] = DVFS_STEP_WAIT_RAISE;
+        }
+        /* Between the two clock steps the buses run at the lower system clock with the dividers of
+           the higher one, or at the lower one with its own dividers */
+        if (pstcTo->u32SysclkFreq > pstcFrom->u32SysclkFreq) {
+            if (pstcTo->u32ClockDiv != pstcFrom->u32ClockDiv) {
+                pstcPlan->au8Step[u8Num++] = DVFS_STEP_CLK_DIV;
+            }
+            if (pstcTo->u8SysClockSrc != pstcFrom->u8SysClockSrc) {
+                pstcPlan->au8Step[u8Num++] = DVFS_STEP_CLK_SRC;
+            }
+        } else {
+            if (pstcTo->u8SysClockSrc != pstcFrom->u8SysClockSrc) {
+                pstcPlan->au8Step[u8Num++] = DVFS_STEP_CLK_SRC;
+            }
+            if (pstcTo->u32ClockDiv != pstcFrom->u32ClockDiv) {
+                pstcPlan->au8Step[u8Num++] = DVFS_STEP_CLK_DIV;
+            }
+        }
+        if ((pstcTo->u32EfmWait < pstcFrom->u32EfmWait) || (pstcTo->u32SramhWait < pstcFrom->u32SramhWait) ||
+            (pstcTo->u32SramWait < pstcFrom->u32SramWait) || (pstcTo->u16GpioWait < pstcFrom->u16GpioWait)) {
+            pstcPlan->au8Step[u8Num++] = DVFS_STEP_WAIT_FINAL;
+        }
+        /* The voltage falls once the clock is low */
+        if ((DVFS_PWR_HIGH_SPEED == pstcFrom->u8PowerMode) && (DVFS_PWR_ULOW_SPEED == pstcTo->u8PowerMode)) {
+            pstcPlan->au8Step[u8Num++] = DVFS_STEP_ULOW_SPEED;
+        }
+        pstcPlan->u8StepNum = u8Num;
+        i32Ret = LL_OK;
+    }
+    return i32Ret;
+}
+
+/**
+ * @brief  Switch to an operating point.
+ * @param  [in] pstcDvfs                Pointer to a @ref stc_dvfs_t structure.
+ * @param  [in] u8Opp                   Index of the target operating point.
+ * @retval int32_t:
+ *           - LL_OK:                   No error occurred.
+ *           - LL_ERR_BUSY:             A CLK notifier refused the transition or another clock change
+ *                                      is running, nothing changed.
+ *           - LL_ERR:                  The power mode did not switch.
+ *           - LL_ERR_TIMEOUT:          The EFM is not ready.
+ *           - LL_ERR_INVD_PARAM:       pstcDvfs == NULL or u8Opp is out of the table.
+ * @note   Call from thread context with the CLK, PWC, EFM, SRAM and GPIO registers unlocked and
+ *         the clock source of the target running. After a step failed the CLK notifiers get
+ *         CLK_NOTIFY_ABORT with the frequencies the clocks were left at.
+ */
+int32_t DVFS_SetOpp(stc_dvfs_t *pstcDvfs, uint8_t u8Opp)
+{
+    const stc_dvfs_opp_t *pstcFrom;
+    const stc_dvfs_opp_t *pstcTo;
+    stc_clock_freq_t stcClockFreq;
+    stc_dvfs_plan_t stcPlan;
+    uint32_t u32Hclk;
+    uint32_t u32Cycle;
+    uint32_t u32Now;
+    uint64_t u64Ns = 0ULL;
+    uint8_t i;
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if ((NULL != pstcDvfs) && (u8Opp < pstcDvfs->u8OppNum)) {
+        i32Ret = LL_OK;
+        if (u8Opp != pstcDvfs->u8Cur) {
+            pstcFrom = &pstcDvfs->pstcOpp[pstcDvfs->u8Cur];
+            pstcTo   = &pstcDvfs->pstcOpp[u8Opp];
+
+            OppClockFreq(pstcTo, &stcClockFreq);
+            (void)DVFS_Plan(pstcFrom, pstcTo, &stcPlan);
+            i32Ret = CLK_ChangeBegin(&stcClockFreq);
+            if (LL_OK == i32Ret) {
+                u32Hclk  = CLK_GetBusClockFreq(CLK_BUS_HCLK);
+                u32Cycle = DWT->CYCCNT;
+                for (i = 0U; (i < stcPlan.u8StepNum) && (LL_OK == i32Ret); i++) {
+                    i32Ret = RunStep(stcPlan.au8Step[i], pstcFrom, pstcTo);
+                    /* Each step runs at the HCLK set by the previous one */
+                    u32Now = DWT->CYCCNT;
+                    u64Ns += ((uint64_t)(u32Now - u32Cycle) * DVFS_NS_PER_S) / u32Hclk;
+                    u32Cycle = u32Now;
+                    u32Hclk  = CLK_GetBusClockFreq(CLK_BUS_HCLK);
+                }
+                pstcDvfs->u32LastNs = (u64Ns > 0xFFFFFFFFULL) ? 0xFFFFFFFFUL : (uint32_t)u64Ns;
+                if (pstcDvfs->u32LastNs > pstcDvfs->u32MaxNs) {
+                    pstcDvfs->u32MaxNs = pstcDvfs->u32LastNs;
+                }
+
+                if (LL_OK == i32Ret) {
+                    pstcDvfs->u8Cur = u8Opp;
+                    CLK_ChangeEnd(CLK_NOTIFY_POST);
+                } else {
+                    CLK_ChangeEnd(CLK_NOTIFY_ABORT);
+                }
+            }
+        }
+    }
+    return i32Ret;
+}
+
+/**
+ * @brief  Get the current operating point.
+ * @param  [in] pstcDvfs                Pointer to a @ref stc_dvfs_t structure.
+ * @retval uint8_t                      Index of the operating point.
+ */
+uint8_t DVFS_GetOpp(const stc_dvfs_t *pstcDvfs)
+{
+    DDL_ASSERT(NULL != pstcDvfs);
+
+    return pstcDvfs->u8Cur;
+}
+
+/**
+ * @brief  Get the transition latency.
+ * @param  [in] pstcDvfs                Pointer to a @ref stc_dvfs_t structure.
+ * @param  [out] pu32LastNs             Latency of the last transition in ns, or NULL.
+ * @param  [out] pu32MaxNs              Largest latency of a transition in ns, or NULL.
+ * @retval None
+ * @note   The latency covers the transition steps, not the peripheral callbacks.
+ */
+void DVFS_GetLatency(const stc_dvfs_t *pstcDvfs, uint32_t *pu32LastNs, uint32_t *pu32MaxNs)
+{
+    DDL_ASSERT(NULL != pstcDvfs);
+
+    if (NULL != pu32LastNs) {
+        *pu32LastNs = pstcDvfs->u32LastNs;
+    }
+    if (NULL != pu32MaxNs) {
+        *pu32MaxNs = pstcDvfs->u32MaxNs;
+    }
+}
+
+/**
+ * @}
+ */
+
+#endif /* LL_DVFS_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,655 @@
+/**
+ *******************************************************************************
+ * @file  hc32_ll_dvp_frame.c
+ * @brief This file provides firmware functions to capture DVP frames into
+ *        memory buffers by DMA.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       CDT             First version
+                                    Checked the DMA trigger target and event source in DVP_FRAME_Init()
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2025, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ll_dvp_frame.h"
+#include "hc32_ll_aos.h"
+#include "hc32_ll_utility.h"
+
+/**
+ * @addtogroup LL_Driver
+ * @{
+ */
+
+/**
+ * @defgroup LL_DVP_FRAME DVP_FRAME
+ * @brief DVP Frame Pipeline Driver Library
+ * @note  Each frame buffer owns a chain of DMA descriptors reading the DVP DMA data register,
+ *        65535 words per descriptor. At the frame end interrupt the channel is stopped, the
+ *        frame is checked and the chain of the next buffer is loaded during the vertical blank:
+ *        - Raw frames must have the line count, counted by the line end interrupt, and the
+ *          byte count of the configuration. A frame caught partly, after a FIFO overflow or a
+ *          sync error is dropped.
+ *        - JPEG frames must start with the SOI marker and end with the EOI marker within the
+ *          buffer, the frame size is the offset after the EOI marker.
+ *        Frames are handed to the consumer in place. When no buffer is free the oldest frame
+ *        not taken yet is overwritten, and when the consumer holds all other buffers the new
+ *        frame is dropped, so a buffer is never written while the consumer reads it.
+ * @{
+ */
+
+#if (LL_DVP_FRAME_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup DVP_FRAME_Local_Macros DVP_FRAME Local Macros
+ * @{
+ */
+
+/* Buffer states */
+#define DVP_FRAME_BUF_FREE              (0U)
+#define DVP_FRAME_BUF_FILL              (1U)
+#define DVP_FRAME_BUF_READY             (2U)
+#define DVP_FRAME_BUF_USER              (3U)
+
+/* Bytes searched back from the end of a JPEG frame for the EOI marker, to skip padding */
+#define DVP_FRAME_JPEG_TAIL             (32UL)
+
+#define DVP_FRAME_INT_ERR               (DVP_INT_FIFO_OVF | DVP_INT_SYNC_ERR)
+
+/**
+ * @defgroup DVP_FRAME_Check_Parameters_Validity DVP_FRAME Check Parameters Validity
+ * @{
+ */
+#define IS_DVP_FRAME_MD(x)                                                     \
+(   ((x) == DVP_FRAME_MD_RAW)               ||                                 \
+    ((x) == DVP_FRAME_MD_JPEG))
+
+#define IS_DVP_FRAME_BUF_NUM(x)                                                \
+(   ((x) >= 2U)                             &&                                 \
+    ((x) <= DVP_FRAME_BUF_MAX))
+
+#define IS_DVP_FRAME_DMA_TARGET(unit, ch, target)                              \
+(   ((target) == ((((unit) == CM_DMA1) ? AOS_DMA1_0 : AOS_DMA2_0) + ((uint32_t)(ch) * 4UL))))
+
+#define IS_DVP_FRAME_EVT(x)             ((x) == EVT_SRC_DVP_DMAREQ)
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @defgroup DVP_FRAME_Local_Functions DVP_FRAME Local Functions
+ * @{
+ */
+
+/**
+ * @brief  Build the descriptor chain of each frame buffer.
+ * @param  [in] pstcPipe                Pointer to a @ref stc_dvp_frame_pipe_t structure.
+ * @param  [in] u32Words                Words written per frame at most.
+ * @retval None
+ */
+static void DVP_FRAME_DescInit(stc_dvp_frame_pipe_t *pstcPipe, uint32_t u32Words)
+{
+    const uint32_t u32ChCtl = DMA_SRC_ADDR_FIX | DMA_DEST_ADDR_INC | DMA_DATAWIDTH_32BIT;
+    stc_dma_llp_descriptor_t *pstcDesc;
+    uint32_t u32Left;
+    uint32_t u32Cnt;
+    uint32_t i;
+    uint32_t j;
+
+    for (i = 0UL; i < pstcPipe->u8BufNum; i++) {
+        u32Left = u32Words;
+        for (j = 0UL; j < DVP_FRAME_SEG_MAX; j++) {
+            pstcDesc = &pstcPipe->astcDesc[i][j];
+            u32Cnt = (u32Left > DVP_FRAME_SEG_WORDS) ? DVP_FRAME_SEG_WORDS : u32Left;
+            u32Left -= u32Cnt;
+            pstcDesc->SARx      = (uint32_t)&CM_DVP->DMR;
+            pstcDesc->DARx      = (uint32_t)pstcPipe->apvBuf[i] + (j * DVP_FRAME_SEG_WORDS * 4UL);
+            pstcDesc->DTCTLx    = (u32Cnt << DMA_DTCTL_CNT_POS) | 1UL;
+            pstcDesc->RPTx      = 0UL;
+            pstcDesc->SNSEQCTLx = 0UL;
+            pstcDesc->DNSEQCTLx = 0UL;
+            if (0UL != u32Left) {
+                pstcDesc->LLPx   = (uint32_t)&pstcPipe->astcDesc[i][j + 1UL];
+                pstcDesc->CHCTLx = u32ChCtl | DMA_LLP_ENABLE | DMA_LLP_WAIT;
+            } else {
+                pstcDesc->LLPx   = 0UL;
+                pstcDesc->CHCTLx = u32ChCtl | DMA_LLP_DISABLE;
+                break;
+            }
+        }
+    }
+}
+
+/**
+ * @brief  Load the descriptor chain of a frame buffer into the channel and enable it.
+ * @param  [in] pstcPipe                Pointer to a @ref stc_dvp_frame_pipe_t structure.
+ * @param  [in] u8Buf                   Frame buffer index.
+ * @retval None
+ */
+static void DVP_FRAME_DmaArm(stc_dvp_frame_pipe_t *pstcPipe, uint8_t u8Buf)
+{
+    CM_DMA_TypeDef *DMAx = pstcPipe->pstcDmaUnit;
+    const stc_dma_llp_descriptor_t *pstcDesc = &pstcPipe->astcDesc[u8Buf][0];
+    stc_dma_init_t stcDmaInit;
+    stc_dma_llp_init_t stcLlpInit;
+
+    (void)DMA_ChCmd(DMAx, pstcPipe->u8DmaCh, DISABLE);
+
+    (void)DMA_StructInit(&stcDmaInit);
+    stcDmaInit.u32IntEn       = DMA_INT_DISABLE;
+    stcDmaInit.u32SrcAddr     = pstcDesc->SARx;
+    stcDmaInit.u32DestAddr    = pstcDesc->DARx;
+    stcDmaInit.u32DataWidth   = DMA_DATAWIDTH_32BIT;
+    stcDmaInit.u32BlockSize   = 1UL;
+    stcDmaInit.u32TransCount  = pstcDesc->DTCTLx >> DMA_DTCTL_CNT_POS;
+    stcDmaInit.u32SrcAddrInc  = DMA_SRC_ADDR_FIX;
+    stcDmaInit.u32DestAddrInc = DMA_DEST_ADDR_INC;
+    (void)DMA_Init(DMAx, pstcPipe->u8DmaCh, &stcDmaInit);
+
+    (void)DMA_LlpStructInit(&stcLlpInit);
+    stcLlpInit.u32State = pstcDesc->CHCTLx & DMA_LLP_ENABLE;
+    stcLlpInit.u32Mode  = DMA_LLP_WAIT;
+    stcLlpInit.u32Addr  = pstcDesc->LLPx;
+    (void)DMA_LlpInit(DMAx, pstcPipe->u8DmaCh, &stcLlpInit);
+
+    pstcPipe->u8Fill = u8Buf;
+    pstcPipe->au8State[u8Buf] = DVP_FRAME_BUF_FILL;
+    pstcPipe->u32LineCnt = 0UL;
+    pstcPipe->u8FrameErr = 0U;
+    (void)DMA_ChCmd(DMAx, pstcPipe->u8DmaCh, ENABLE);
+}
+
+/**
+ * @brief  Size of a JPEG frame.
+ * @param  [in] pu8Data                 Frame data.
+ * @param  [in] u32Bytes                Bytes written by the DMA.
+ * @retval Offset after the EOI marker, 0 if the frame has no SOI or no EOI marker.
+ */
+static uint32_t DVP_FRAME_JpegLen(const uint8_t *pu8Data, uint32_t u32Bytes)
+{
+    uint32_t u32Len = 0UL;
+    uint32_t u32Stop;
+    uint32_t i;
+
+    if ((u32Bytes >= 4UL) && (0xFFU == pu8Data[0]) && (0xD8U == pu8Data[1])) {
+        u32Stop = (u32Bytes > (DVP_FRAME_JPEG_TAIL + 2UL)) ? (u32Bytes - DVP_FRAME_JPEG_TAIL) : 2UL;
+        for (i = u32Bytes - 2UL; i >= u32Stop; i--) {
+            if ((0xFFU == pu8Data[i]) && (0xD9U == pu8Data[i + 1UL])) {
+                u32Len = i + 2UL;
+                break;
+            }
+        }
+    }
+
+    return u32Len;
+}
+
+/**
+ * @brief  Pick the buffer for the next frame.
+ * @param  [in] pstcPipe                Pointer to a @ref stc_dvp_frame_pipe_t structure.
+ * @param  [in] u8Last                  Buffer of the last frame.
+ * @retval A free buffer, else the oldest ready buffer other than u8Last, else u8Last.
+ */
+static uint8_t DVP_FRAME_PickNext(stc_dvp_frame_pipe_t *pstcPipe, uint8_t u8Last)
+{
+    uint8_t u8Next = u8Last;
+    uint8_t u8Free = 0U;
+    uint8_t i;
+
+    for (i = 1U; i <= pstcPipe->u8BufNum; i++) {
+        u8Next = (uint8_t)((u8Last + i) % pstcPipe->u8BufNum);
+        if (DVP_FRAME_BUF_FREE == pstcPipe->au8State[u8Next]) {
+            u8Free = 1U;
+            break;
+        }
+    }
+
+    if (0U == u8Free) {
+        u8Next = u8Last;
+        for (i = 0U; i < pstcPipe->u8BufNum; i++) {
+            if ((i != u8Last) && (DVP_FRAME_BUF_READY == pstcPipe->au8State[i]) &&
+                ((u8Next == u8Last) || (pstcPipe->au32Seq[i] < pstcPipe->au32Seq[u8Next]))) {
+                u8Next = i;
+            }
+        }
+        /* The oldest frame not taken or the new frame is dropped */
+        pstcPipe->u32DropCnt++;
+    }
+
+    return u8Next;
+}
+
+/**
+ * @brief  Close the current frame and start the next one.
+ * @param  [in] pstcPipe                Pointer to a @ref stc_dvp_frame_pipe_t structure.
+ * @retval None
+ */
+static void DVP_FRAME_FrameEnd(stc_dvp_frame_pipe_t *pstcPipe)
+{
+    const uint8_t u8Done = pstcPipe->u8Fill;
+    uint8_t u8Next = u8Done;
+    uint32_t u32Bytes;
+    uint32_t u32Len = 0UL;
+
+    (void)DMA_ChCmd(pstcPipe->pstcDmaUnit, pstcPipe->u8DmaCh, DISABLE);
+    u32Bytes = DMA_GetDestAddr(pstcPipe->pstcDmaUnit, pstcPipe->u8DmaCh) - (uint32_t)pstcPipe->apvBuf[u8Done];
+
+    if (0U == pstcPipe->u8FrameErr) {
+        if (DVP_FRAME_MD_JPEG == pstcPipe->u8Mode) {
+            /* A full buffer means the frame has been cut */
+            if (u32Bytes < pstcPipe->u32BufSize) {
+                u32Len = DVP_FRAME_JpegLen((const uint8_t *)pstcPipe->apvBuf[u8Done], u32Bytes);
+            }
+        } else if ((u32Bytes == pstcPipe->u32FrameBytes) && (pstcPipe->u32LineCnt == pstcPipe->u32Lines)) {
+            u32Len = u32Bytes;
+        } else {
+            /* Incomplete raw frame */
+        }
+    }
+
+    if (0UL != u32Len) {
+        pstcPipe->au8State[u8Done] = DVP_FRAME_BUF_READY;
+        pstcPipe->au32Len[u8Done]  = u32Len;
+        pstcPipe->au32Seq[u8Done]  = pstcPipe->u32Seq;
+        u8Next = DVP_FRAME_PickNext(pstcPipe, u8Done);
+    } else {
+        pstcPipe->u32ErrCnt++;
+    }
+    pstcPipe->u32Seq++;
+
+    DVP_FRAME_DmaArm(pstcPipe, u8Next);
+    if ((u8Next != u8Done) && (NULL != pstcPipe->pfnCallback)) {
+        pstcPipe->pfnCallback(pstcPipe, pstcPipe->pvArg);
+    }
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup DVP_FRAME_Global_Functions DVP_FRAME Global Functions
+ * @{
+ */
+
+/**
+ * @brief  Set each @ref stc_dvp_frame_init_t field to default value.
+ * @param  [out] pstcFrameInit          Pointer to a @ref stc_dvp_frame_init_t structure.
+ * @retval int32_t:
+ *           - LL_OK:                   Initialize success
+ *           - LL_ERR_INVD_PARAM:       pstcFrameInit is NULL
+ */
+int32_t DVP_FRAME_StructInit(stc_dvp_frame_init_t *pstcFrameInit)
+{
+    int32_t i32Ret = LL_OK;
+    uint32_t i;
+
+    if (NULL == pstcFrameInit) {
+        i32Ret = LL_ERR_INVD_PARAM;
+    } else {
+        pstcFrameInit->pstcDmaUnit   = NULL;
+        pstcFrameInit->u8DmaCh       = DMA_CH0;
+        pstcFrameInit->u32TrigTarget = AOS_DMA1_0;
+        pstcFrameInit->enEvtSrc      = EVT_SRC_DVP_DMAREQ;
+        pstcFrameInit->u8Mode        = DVP_FRAME_MD_RAW;
+        pstcFrameInit->u8BufNum      = 2U;
+        for (i = 0UL; i < DVP_FRAME_BUF_MAX; i++) {
+            pstcFrameInit->apvBuf[i] = NULL;
+        }
+        pstcFrameInit->u32BufSize    = 0UL;
+        pstcFrameInit->u32Lines      = 0UL;
+        pstcFrameInit->u32LineBytes  = 0UL;
+        pstcFrameInit->pfnCallback   = NULL;
+        pstcFrameInit->pvArg         = NULL;
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Initialize a DVP frame pipeline.
+ * @param  [out] pstcPipe               Pointer to a @ref stc_dvp_frame_pipe_t structure.
+ * @param  [in] pstcFrameInit           Pointer to a @ref stc_dvp_frame_init_t structure.
+ * @retval int32_t:
+ *           - LL_OK:                   Initialize success
+ *           - LL_ERR_INVD_PARAM:       Invalid parameter, a frame does not fit in a buffer, u32TrigTarget
+ *                                      is not the target of the channel or enEvtSrc is not the DVP
+ *                                      DMA request
+ * @note   The DVP is set up by DVP_Init() and, for cropping, DVP_CropWindowConfig() in continuous
+ *         frame capture mode before DVP_FRAME_Start(). The raw frame size must be a multiple of
+ *         4 bytes, and a buffer holds @ref DVP_FRAME_SEG_MAX * @ref DVP_FRAME_SEG_WORDS words
+ *         at most.
+ */
+int32_t DVP_FRAME_Init(stc_dvp_frame_pipe_t *pstcPipe, const stc_dvp_frame_init_t *pstcFrameInit)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+    uint32_t u32Words;
+    uint32_t i;
+
+    if ((NULL != pstcPipe) && (NULL != pstcFrameInit) && (NULL != pstcFrameInit->pstcDmaUnit) &&
+        IS_DVP_FRAME_DMA_TARGET(pstcFrameInit->pstcDmaUnit, pstcFrameInit->u8DmaCh, pstcFrameInit->u32TrigTarget) &&
+        IS_DVP_FRAME_EVT(pstcFrameInit->enEvtSrc) &&
+        IS_DVP_FRAME_MD(pstcFrameInit->u8Mode) && IS_DVP_FRAME_BUF_NUM(pstcFrameInit->u8BufNum) &&
+        (0UL == (pstcFrameInit->u32BufSize & 3UL)) &&
+        ((pstcFrameInit->u32BufSize / 4UL) <= (DVP_FRAME_SEG_MAX * DVP_FRAME_SEG_WORDS))) {
+        DDL_ASSERT(pstcFrameInit->u8DmaCh <= DMA_CH7);
+
+        pstcPipe->u32FrameBytes = pstcFrameInit->u32Lines * pstcFrameInit->u32LineBytes;
+        u32Words = pstcFrameInit->u32BufSize / 4UL;
+        if (DVP_FRAME_MD_RAW == pstcFrameInit->u8Mode) {
+            u32Words = pstcPipe->u32FrameBytes / 4UL;
+        }
+        if ((0UL != u32Words) && ((DVP_FRAME_MD_JPEG == pstcFrameInit->u8Mode) ||
+                                  ((0UL == (pstcPipe->u32FrameBytes & 3UL)) &&
+                                   (pstcPipe->u32FrameBytes <= pstcFrameInit->u32BufSize)))) {
+            i32Ret = LL_OK;
+            for (i = 0UL; i < pstcFrameInit->u8BufNum; i++) {
+                if ((NULL == pstcFrameInit->apvBuf[i]) || (0UL != ((uint32_t)pstcFrameInit->apvBuf[i] & 3UL))) {
+                    i32Ret = LL_ERR_INVD_PARAM;
+                }
+                pstcPipe->apvBuf[i]   = pstcFrameInit->apvBuf[i];
+                pstcPipe->au8State[i] = DVP_FRAME_BUF_FREE;
+                pstcPipe->au32Len[i]  = 0UL;
+                pstcPipe->au32Seq[i]  = 0UL;
+            }
+        }
+
+        if (LL_OK == i32Ret) {
+            pstcPipe->pstcDmaUnit = pstcFrameInit->pstcDmaUnit;
+            pstcPipe->u8DmaCh     = pstcFrameInit->u8DmaCh;
+            pstcPipe->u8Mode      = pstcFrameInit->u8Mode;
+            pstcPipe->u8BufNum    = pstcFrameInit->u8BufNum;
+            pstcPipe->u8Fill      = 0U;
+            pstcPipe->u8FrameErr  = 0U;
+            pstcPipe->u8Run       = 0U;
+            pstcPipe->u32BufSize  = pstcFrameInit->u32BufSize;
+            pstcPipe->u32Lines    = pstcFrameInit->u32Lines;
+            pstcPipe->u32LineCnt  = 0UL;
+            pstcPipe->u32Seq      = 0UL;
+            pstcPipe->u32DropCnt  = 0UL;
+            pstcPipe->u32ErrCnt   = 0UL;
+            pstcPipe->pfnCallback = pstcFrameInit->pfnCallback;
+            pstcPipe->pvArg       = pstcFrameInit->pvArg;
+            DVP_FRAME_DescInit(pstcPipe, u32Words);
+            AOS_SetTriggerEventSrc(pstcFrameInit->u32TrigTarget, pstcFrameInit->enEvtSrc);
+        }
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Start capturing frames.
+ * @param  [in] pstcPipe                Pointer to a @ref stc_dvp_frame_pipe_t structure.
+ * @retval int32_t:
+ *           - LL_OK:                   Capture started
+ *           - LL_ERR_BUSY:             Capture already started
+ * @note   The DVP interrupts selected here must call DVP_FRAME_IrqHandler(). The first frame is
+ *         usually caught partly and dropped.
+ */
+int32_t DVP_FRAME_Start(stc_dvp_frame_pipe_t *pstcPipe)
+{
+    int32_t i32Ret = LL_ERR_BUSY;
+    uint8_t i;
+
+    DDL_ASSERT(NULL != pstcPipe);
+
+    if (0U == pstcPipe->u8Run) {
+        for (i = 0U; i < pstcPipe->u8BufNum; i++) {
+            pstcPipe->au8State[i] = DVP_FRAME_BUF_FREE;
+        }
+        DVP_FRAME_DmaArm(pstcPipe, 0U);
+        pstcPipe->u8Run = 1U;
+
+        DVP_ClearStatus(DVP_FLAG_ALL);
+        if (DVP_FRAME_MD_JPEG == pstcPipe->u8Mode) {
+            DVP_JPEGCmd(ENABLE);
+            DVP_IntCmd(DVP_INT_FRAME_END | DVP_FRAME_INT_ERR, ENABLE);
+        } else {
+            DVP_JPEGCmd(DISABLE);
+            DVP_IntCmd(DVP_INT_LINE_END | DVP_INT_FRAME_END | DVP_FRAME_INT_ERR, ENABLE);
+        }
+        DVP_CaptureCmd(ENABLE);
+        i32Ret = LL_OK;
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Stop capturing frames.
+ * @param  [in] pstcPipe                Pointer to a @ref stc_dvp_frame_pipe_t structure.
+ * @retval None
+ * @note   The frame being written is dropped, the ready frames can still be taken.
+ */
+void DVP_FRAME_Stop(stc_dvp_frame_pipe_t *pstcPipe)
+{
+    DDL_ASSERT(NULL != pstcPipe);
+
+    DVP_CaptureCmd(DISABLE);
+    DVP_IntCmd(DVP_INT_ALL, DISABLE);
+    (void)DMA_ChCmd(pstcPipe->pstcDmaUnit, pstcPipe->u8DmaCh, DISABLE);
+    if (DVP_FRAME_BUF_FILL == pstcPipe->au8State[pstcPipe->u8Fill]) {
+        pstcPipe->au8State[pstcPipe->u8Fill] = DVP_FRAME_BUF_FREE;
+    }
+    pstcPipe->u8Run = 0U;
+}
+
+/**
+ * @brief  Take the oldest ready frame.
+ * @param  [in] pstcPipe                Pointer to a @ref stc_dvp_frame_pipe_t structure.
+ * @param  [out] pstcFrame              Pointer to a @ref stc_dvp_frame_t structure.
+ * @retval int32_t:
+ *           - LL_OK:                   Frame taken, to be given back by DVP_FRAME_Release()
+ *           - LL_ERR:                  No frame ready
+ *           - LL_ERR_INVD_PARAM:       Invalid parameter
+ */
+int32_t DVP_FRAME_Get(stc_dvp_frame_pipe_t *pstcPipe, stc_dvp_frame_t *pstcFrame)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+    uint32_t u32Primask;
+    uint8_t u8Buf;
+    uint8_t i;
+
+    if ((NULL != pstcPipe) && (NULL != pstcFrame)) {
+        i32Ret = LL_ERR;
+        u8Buf = pstcPipe->u8BufNum;
+        u32Primask = __get_PRIMASK();
+        __disable_irq();
+        for (i = 0U; i < pstcPipe->u8BufNum; i++) {
+            if ((DVP_FRAME_BUF_READY == pstcPipe->au8State[i]) &&
+                ((u8Buf == pstcPipe->u8BufNum) || (pstcPipe->au32Seq[i] < pstcPipe->au32Seq[u8Buf]))) {
+                u8Buf = i;
+            }
+        }
+        if (u8Buf < pstcPipe->u8BufNum) {
+            pstcPipe->au8State[u8Buf] = DVP_FRAME_BUF_USER;
+            pstcFrame->pvBuf  = pstcPipe->apvBuf[u8Buf];
+            pstcFrame->u32Len = pstcPipe->au32Len[u8Buf];
+            pstcFrame->u32Seq = pstcPipe->au32Seq[u8Buf];
+            i32Ret = LL_OK;
+        }
+        __set_PRIMASK(u32Primask);
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Give a frame back to the pipeline.
+ * @param  [in] pstcPipe                Pointer to a @ref stc_dvp_frame_pipe_t structure.
+ * @param  [in] pvBuf                   pvBuf of the frame taken by DVP_FRAME_Get().
+ * @retval int32_t:
+ *           - LL_OK:                   Frame released
+ *           - LL_ERR_INVD_PARAM:       pvBuf is not a frame held by the consumer
+ */
+int32_t DVP_FRAME_Release(stc_dvp_frame_pipe_t *pstcPipe, const void *pvBuf)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+    uint32_t u32Primask;
+    uint8_t i;
+
+    if (NULL != pstcPipe) {
+        u32Primask = __get_PRIMASK();
+        __disable_irq();
+        for (i = 0U; i < pstcPipe->u8BufNum; i++) {
+            if ((pvBuf == pstcPipe->apvBuf[i]) && (DVP_FRAME_BUF_USER == pstcPipe->au8State[i])) {
+                pstcPipe->au8State[i] = DVP_FRAME_BUF_FREE;
+                i32Ret = LL_OK;
+                break;
+            }
+        }
+        __set_PRIMASK(u32Primask);
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Get the dropped frame counters.
+ * @param  [in] pstcPipe                Pointer to a @ref stc_dvp_frame_pipe_t structure.
+ * @param  [out] pu32DropCnt            Frames dropped on consumer stall, may be NULL.
+ * @param  [out] pu32ErrCnt             Frames dropped as incomplete or corrupted, may be NULL.
+ * @retval None
+ */
+void DVP_FRAME_GetStats(const stc_dvp_frame_pipe_t *pstcPipe, uint32_t *pu32DropCnt, uint32_t *pu32ErrCnt)
+{
+    DDL_ASSERT(NULL != pstcPipe);
+
+    if (NULL != pu32DropCnt) {
+        *pu32DropCnt = pstcPipe->u32DropCnt;
+    }
+    if (NULL != pu32ErrCnt) {
+        *pu32ErrCnt = pstcPipe->u32ErrCnt;
+    }
+}
+
+/**
+ * @brief  DVP interrupt handler of a frame pipeline.
+ * @param  [in] pstcPipe                Pointer to a @ref stc_dvp_frame_pipe_t structure.
+ * @retval None
+ * @note   To be called by the line end, frame end, FIFO overflow and sync error interrupts.
+ */
+void DVP_FRAME_IrqHandler(stc_dvp_frame_pipe_t *pstcPipe)
+{
+    DDL_ASSERT(NULL != pstcPipe);
+
+    if (SET == DVP_GetStatus(DVP_FLAG_FIFO_OVF | DVP_FLAG_SYNC_ERR)) {
+        DVP_ClearStatus(DVP_FLAG_FIFO_OVF | DVP_FLAG_SYNC_ERR);
+        pstcPipe->u8FrameErr = 1U;
+    }
+    if (SET == DVP_GetStatus(DVP_FLAG_LINE_END)) {
+        DVP_ClearStatus(DVP_FLAG_LINE_END);
+        pstcPipe->u32LineCnt++;
+    }
+    if (SET == DVP_GetStatus(DVP_FLAG_FRAME_END)) {
+        DVP_ClearStatus(DVP_FLAG_FRAME_END);
+        if (0U != pstcPipe->u8Run) {
+            DVP_FRAME_FrameEnd(pstcPipe);
+        }
+    }
+}
+
+/**
+ * @brief  Lines and bytes per line captured from a sensor frame.
+ * @param  [in] u32SrcLines             Lines per sensor frame.
+ * @param  [in] u32SrcClocks            DVP_PIXCLK clocks per sensor line.
+ * @param  [in] u32DataWidth            A value of @ref DVP_Data_Width.
+ * @param  [in] pstcCrop                Crop window, NULL if cropping is disabled.
+ * @param  [out] pu32Lines              Lines per captured frame.
+ * @param  [out] pu32LineBytes          Bytes per captured line.
+ * @retval int32_t:
+ *           - LL_OK:                   Geometry computed
+ *           - LL_ERR:                  The crop window is outside the sensor frame
+ *           - LL_ERR_INVD_PARAM:       Invalid parameter
+ * @note   The crop window is clipped by the sensor frame. The DVP stores one byte per clock in
+ *         8-bit mode and one half-word per clock in the other modes. It touches no register and
+ *         may be built on the host to model the line count of a cropped frame.
+ */
+int32_t DVP_FRAME_CalcGeometry(uint32_t u32SrcLines, uint32_t u32SrcClocks, uint32_t u32DataWidth,
+                               const stc_dvp_crop_window_config_t *pstcCrop,
+                               uint32_t *pu32Lines, uint32_t *pu32LineBytes)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+    uint32_t u32Lines = u32SrcLines;
+    uint32_t u32Clocks = u32SrcClocks;
+
+    if ((NULL != pu32Lines) && (NULL != pu32LineBytes)) {
+        i32Ret = LL_OK;
+        if (NULL != pstcCrop) {
+            if ((pstcCrop->u16RowStartLine >= u32SrcLines) || (pstcCrop->u16ColumnStartLine >= u32SrcClocks)) {
+                i32Ret = LL_ERR;
+            } else {
+                u32Lines  = u32SrcLines - pstcCrop->u16RowStartLine;
+                u32Clocks = u32SrcClocks - pstcCrop->u16ColumnStartLine;
+                if (u32Lines > pstcCrop->u16RowLineSize) {
+                    u32Lines = pstcCrop->u16RowLineSize;
+                }
+                if (u32Clocks > pstcCrop->u16ColumnLineSize) {
+                    u32Clocks = pstcCrop->u16ColumnLineSize;
+                }
+            }
+        }
+        if (LL_OK == i32Ret) {
+            *pu32Lines     = u32Lines;
+            *pu32LineBytes = (DVP_DATA_WIDTH_8BIT == u32DataWidth) ? u32Clocks : (u32Clocks * 2UL);
+        }
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @}
+ */
+
+#endif /* LL_DVP_FRAME_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
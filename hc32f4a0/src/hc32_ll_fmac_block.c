@@ -0,0 +1,664 @@
+/**
+ *******************************************************************************
+ * @file  hc32_ll_fmac_block.c
+ * @brief This file provides firmware functions to manage the FMAC block FIR
+ *        filtering.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       CDT             First version
+                                    Checked the DMA trigger targets and event source in FMAC_BLOCK_Init()
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2025, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ll_fmac_block.h"
+#include "hc32_ll_fmac.h"
+#include "hc32_ll_aos.h"
+#include "hc32_ll_utility.h"
+
+/**
+ * @addtogroup LL_Driver
+ * @{
+ */
+
+/**
+ * @defgroup LL_FMAC_BLOCK FMAC_BLOCK
+ * @brief FMAC Block FIR Filtering Driver Library
+ * @note  A filter longer than one unit is split into segments of FMAC_BLOCK_UNIT_TAPS taps,
+ *        unit k running segment k on the input delayed by k * FMAC_BLOCK_UNIT_TAPS samples.
+ *        Chained units run without hardware shift, their full results are summed and shifted
+ *        once, so every configuration gives the same output as FMAC_BLOCK_Reference().
+ *        The output keeps the low 32 bits of the shifted accumulator, as RTR1 does; the FMAC
+ *        does not saturate, so the shift must bring the result into range.
+ * @{
+ */
+
+#if (LL_FMAC_BLOCK_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup FMAC_BLOCK_Local_Macros FMAC_BLOCK Local Macros
+ * @{
+ */
+/* Result bits held by RTR0, above the 32 bits of RTR1 */
+#define FMAC_BLOCK_RESULT_HIGH_MASK     (0x1FUL)
+#define FMAC_BLOCK_RESULT_HIGH_SIGN     (0x10UL)
+
+/* Polls of the ready flag, a FIR sample takes a few HCLK cycles */
+#define FMAC_BLOCK_TIMEOUT              (0x1000UL)
+
+/**
+ * @defgroup FMAC_BLOCK_Check_Parameters_Validity FMAC_BLOCK Check Parameters Validity
+ * @{
+ */
+#define IS_FMAC_BLOCK_UNIT(x)                                                  \
+(   ((x) == CM_FMAC1)                       ||                                 \
+    ((x) == CM_FMAC2)                       ||                                 \
+    ((x) == CM_FMAC3)                       ||                                 \
+    ((x) == CM_FMAC4))
+
+#define IS_FMAC_BLOCK_SHIFT(x)          ((x) <= FMAC_FIR_SHIFT_21BIT)
+
+#define IS_FMAC_BLOCK_DMA_CH(out, in)   (((out) < (in)) && ((in) <= DMA_CH7))
+
+#define IS_FMAC_BLOCK_DMA_TARGET(unit, ch, target)                             \
+(   ((target) == ((((unit) == CM_DMA1) ? AOS_DMA1_0 : AOS_DMA2_0) + ((uint32_t)(ch) * 4UL))))
+
+#define IS_FMAC_BLOCK_EVT(fmac, evt)                                           \
+(   (((fmac) == CM_FMAC1) && ((evt) == EVT_SRC_FMAC_1))                     ||  \
+    (((fmac) == CM_FMAC2) && ((evt) == EVT_SRC_FMAC_2))                     ||  \
+    (((fmac) == CM_FMAC3) && ((evt) == EVT_SRC_FMAC_3))                     ||  \
+    (((fmac) == CM_FMAC4) && ((evt) == EVT_SRC_FMAC_4)))
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @defgroup FMAC_BLOCK_Local_Functions FMAC_BLOCK Local Functions
+ * @{
+ */
+
+/**
+ * @brief  Number of units of a coefficient set.
+ * @param  [in] pstcCoef                Pointer to a @ref stc_fmac_coef_set_t structure.
+ * @retval Units.
+ */
+static uint32_t FMAC_BLOCK_UnitNum(const stc_fmac_coef_set_t *pstcCoef)
+{
+    return (pstcCoef->u32Taps + FMAC_BLOCK_UNIT_TAPS - 1UL) / FMAC_BLOCK_UNIT_TAPS;
+}
+
+/**
+ * @brief  Arithmetic right shift of the accumulator, rounding toward minus infinity as the FMAC.
+ * @param  [in] i64Acc                  Accumulator.
+ * @param  [in] u32Shift                Shift bits.
+ * @retval Low 32 bits of the shifted accumulator.
+ */
+static int32_t FMAC_BLOCK_Shift(int64_t i64Acc, uint32_t u32Shift)
+{
+    uint64_t u64Val;
+
+    if (i64Acc < 0LL) {
+        u64Val = ~((~(uint64_t)i64Acc) >> u32Shift);
+    } else {
+        u64Val = (uint64_t)i64Acc >> u32Shift;
+    }
+
+    return (int32_t)(uint32_t)u64Val;
+}
+
+/**
+ * @brief  Read the full result of a unit.
+ * @param  [in] FMACx                   FMAC unit.
+ * @retval Sign extended result.
+ */
+static int64_t FMAC_BLOCK_ReadResult(const CM_FMAC_TypeDef *FMACx)
+{
+    stc_fmac_result_t stcResult;
+    uint64_t u64High;
+
+    (void)FMAC_GetResult(FMACx, &stcResult);
+    u64High = (uint64_t)stcResult.u32ResultHigh & FMAC_BLOCK_RESULT_HIGH_MASK;
+    if (0UL != (stcResult.u32ResultHigh & FMAC_BLOCK_RESULT_HIGH_SIGN)) {
+        u64High |= ~(uint64_t)FMAC_BLOCK_RESULT_HIGH_MASK;
+    }
+
+    return (int64_t)((u64High << 32U) | stcResult.u32ResultLow);
+}
+
+/**
+ * @brief  Get the input of a delayed unit.
+ * @param  [in] pstcBlock               Pointer to a @ref stc_fmac_block_t structure.
+ * @param  [in] pi16In                  Input of the block.
+ * @param  [in] u32Idx                  Index of the current sample in the block.
+ * @param  [in] u32Delay                Delay of the unit in samples.
+ * @retval Delayed sample.
+ */
+static int16_t FMAC_BLOCK_Delayed(const stc_fmac_block_t *pstcBlock, const int16_t *pi16In, uint32_t u32Idx,
+                                  uint32_t u32Delay)
+{
+    int16_t i16Val;
+
+    if (u32Idx >= u32Delay) {
+        i16Val = pi16In[u32Idx - u32Delay];
+    } else {
+        i16Val = pstcBlock->ai16Hist[FMAC_BLOCK_HIST_MAX - (u32Delay - u32Idx)];
+    }
+
+    return i16Val;
+}
+
+/**
+ * @brief  Keep the last inputs of a block for the next one.
+ * @param  [in] pi16Hist                History of FMAC_BLOCK_HIST_MAX samples, oldest first.
+ * @param  [in] pi16In                  Input of the block.
+ * @param  [in] u32Len                  Number of samples of the block.
+ * @retval None
+ */
+static void FMAC_BLOCK_HistUpdate(int16_t *pi16Hist, const int16_t *pi16In, uint32_t u32Len)
+{
+    uint32_t u32Keep;
+    uint32_t i;
+
+    if (u32Len >= FMAC_BLOCK_HIST_MAX) {
+        for (i = 0UL; i < FMAC_BLOCK_HIST_MAX; i++) {
+            pi16Hist[i] = pi16In[(u32Len - FMAC_BLOCK_HIST_MAX) + i];
+        }
+    } else {
+        u32Keep = FMAC_BLOCK_HIST_MAX - u32Len;
+        for (i = 0UL; i < u32Keep; i++) {
+            pi16Hist[i] = pi16Hist[i + u32Len];
+        }
+        for (i = 0UL; i < u32Len; i++) {
+            pi16Hist[u32Keep + i] = pi16In[i];
+        }
+    }
+}
+
+/**
+ * @brief  Wait for the result of a unit.
+ * @param  [in] FMACx                   FMAC unit.
+ * @retval int32_t:
+ *           - LL_OK:                   Result ready
+ *           - LL_ERR_TIMEOUT:          Result not ready
+ */
+static int32_t FMAC_BLOCK_WaitReady(const CM_FMAC_TypeDef *FMACx)
+{
+    __IO uint32_t u32Count = FMAC_BLOCK_TIMEOUT;
+    int32_t i32Ret = LL_OK;
+
+    while (SET != FMAC_GetStatus(FMACx)) {
+        if (0UL == u32Count) {
+            i32Ret = LL_ERR_TIMEOUT;
+            break;
+        }
+        u32Count--;
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Stop the DMA block.
+ * @param  [in] pstcBlock               Pointer to a @ref stc_fmac_block_t structure.
+ * @retval None
+ */
+static void FMAC_BLOCK_DmaHalt(stc_fmac_block_t *pstcBlock)
+{
+    (void)DMA_ChCmd(pstcBlock->pstcDmaUnit, pstcBlock->u8OutCh, DISABLE);
+    (void)DMA_ChCmd(pstcBlock->pstcDmaUnit, pstcBlock->u8InCh, DISABLE);
+    DMA_TransCompleteIntCmd(pstcBlock->pstcDmaUnit, DMA_INT_TC_CH0 << pstcBlock->u8OutCh, DISABLE);
+    DMA_ClearTransCompleteStatus(pstcBlock->pstcDmaUnit,
+                                 (DMA_FLAG_TC_CH0 << pstcBlock->u8OutCh) | (DMA_FLAG_TC_CH0 << pstcBlock->u8InCh));
+    FMAC_IntCmd(pstcBlock->apstcUnit[0], DISABLE);
+    pstcBlock->u8Busy = 0U;
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup FMAC_BLOCK_Global_Functions FMAC_BLOCK Global Functions
+ * @{
+ */
+
+/**
+ * @brief  Build a coefficient set in the register layout.
+ * @param  [out] pstcCoef               Pointer to a @ref stc_fmac_coef_set_t structure.
+ * @param  [in] pi16Coef                Coefficients, pi16Coef[k] weights the input delayed by k samples.
+ * @param  [in] u32Taps                 Number of coefficients, 1 ~ FMAC_BLOCK_TAPS_MAX.
+ * @param  [in] u32Shift                Result right shift, a value of @ref FMAC_Filter_Shift.
+ * @retval int32_t:
+ *           - LL_OK:                   Build success
+ *           - LL_ERR_INVD_PARAM:       Invalid parameter
+ */
+int32_t FMAC_BLOCK_CoefSetInit(stc_fmac_coef_set_t *pstcCoef, const int16_t *pi16Coef, uint32_t u32Taps,
+                               uint32_t u32Shift)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+    uint32_t u32Unit;
+    uint32_t i;
+
+    if ((NULL != pstcCoef) && (NULL != pi16Coef) && (0UL != u32Taps) && (u32Taps <= FMAC_BLOCK_TAPS_MAX) &&
+        IS_FMAC_BLOCK_SHIFT(u32Shift)) {
+        pstcCoef->u32Taps  = u32Taps;
+        pstcCoef->u32Shift = u32Shift;
+        for (u32Unit = 0UL; u32Unit < FMAC_BLOCK_UNIT_MAX; u32Unit++) {
+            for (i = 0UL; i < FMAC_BLOCK_UNIT_TAPS; i++) {
+                pstcCoef->au32Cor[u32Unit][i] = 0UL;
+            }
+        }
+        for (i = 0UL; i < u32Taps; i++) {
+            /* COR holds the sign extended coefficient, as FMAC_Init() writes it */
+            pstcCoef->au32Cor[i / FMAC_BLOCK_UNIT_TAPS][i % FMAC_BLOCK_UNIT_TAPS] = (uint32_t)(int32_t)pi16Coef[i];
+        }
+        i32Ret = LL_OK;
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Set each @ref stc_fmac_block_init_t field to default value.
+ * @param  [out] pstcBlockInit          Pointer to a @ref stc_fmac_block_init_t structure.
+ * @retval int32_t:
+ *           - LL_OK:                   Initialize success
+ *           - LL_ERR_INVD_PARAM:       pstcBlockInit is NULL
+ */
+int32_t FMAC_BLOCK_StructInit(stc_fmac_block_init_t *pstcBlockInit)
+{
+    int32_t i32Ret = LL_OK;
+    uint32_t i;
+
+    if (NULL == pstcBlockInit) {
+        i32Ret = LL_ERR_INVD_PARAM;
+    } else {
+        for (i = 0UL; i < FMAC_BLOCK_UNIT_MAX; i++) {
+            pstcBlockInit->apstcUnit[i] = NULL;
+        }
+        pstcBlockInit->pstcDmaUnit      = NULL;
+        pstcBlockInit->u8OutCh          = DMA_CH0;
+        pstcBlockInit->u8InCh           = DMA_CH1;
+        pstcBlockInit->u32OutTrigTarget = AOS_DMA1_0;
+        pstcBlockInit->u32InTrigTarget  = AOS_DMA1_1;
+        pstcBlockInit->enEvtSrc         = EVT_SRC_FMAC_1;
+        pstcBlockInit->pfnCallback      = NULL;
+        pstcBlockInit->pvArg            = NULL;
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Initialize an FMAC block filter.
+ * @param  [out] pstcBlock              Pointer to a @ref stc_fmac_block_t structure.
+ * @param  [in] pstcBlockInit           Pointer to a @ref stc_fmac_block_init_t structure.
+ * @retval int32_t:
+ *           - LL_OK:                   Initialize success
+ *           - LL_ERR_INVD_PARAM:       Invalid parameter, or with a DMA unit, the channels are not in
+ *                                      order, a target is not the one of its channel or enEvtSrc is
+ *                                      not the event of the first unit
+ * @note   The FMAC units are enabled, load a coefficient set before processing.
+ */
+int32_t FMAC_BLOCK_Init(stc_fmac_block_t *pstcBlock, const stc_fmac_block_init_t *pstcBlockInit)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+    uint32_t i;
+
+    if ((NULL != pstcBlock) && (NULL != pstcBlockInit) && (NULL != pstcBlockInit->apstcUnit[0]) &&
+        ((NULL == pstcBlockInit->pstcDmaUnit) ||
+         (IS_FMAC_BLOCK_DMA_CH(pstcBlockInit->u8OutCh, pstcBlockInit->u8InCh) &&
+          IS_FMAC_BLOCK_DMA_TARGET(pstcBlockInit->pstcDmaUnit, pstcBlockInit->u8OutCh,
+                                   pstcBlockInit->u32OutTrigTarget) &&
+          IS_FMAC_BLOCK_DMA_TARGET(pstcBlockInit->pstcDmaUnit, pstcBlockInit->u8InCh,
+                                   pstcBlockInit->u32InTrigTarget) &&
+          IS_FMAC_BLOCK_EVT(pstcBlockInit->apstcUnit[0], pstcBlockInit->enEvtSrc)))) {
+        pstcBlock->u8UnitNum = 0U;
+        for (i = 0UL; i < FMAC_BLOCK_UNIT_MAX; i++) {
+            pstcBlock->apstcUnit[i] = pstcBlockInit->apstcUnit[i];
+            if ((NULL != pstcBlock->apstcUnit[i]) && (i == pstcBlock->u8UnitNum)) {
+                DDL_ASSERT(IS_FMAC_BLOCK_UNIT(pstcBlock->apstcUnit[i]));
+                pstcBlock->u8UnitNum++;
+                (void)FMAC_DeInit(pstcBlock->apstcUnit[i]);
+                FMAC_Cmd(pstcBlock->apstcUnit[i], ENABLE);
+            }
+        }
+        pstcBlock->u8UsedNum   = 0U;
+        pstcBlock->pstcCoef    = NULL;
+        pstcBlock->pstcDmaUnit = pstcBlockInit->pstcDmaUnit;
+        pstcBlock->u8OutCh     = pstcBlockInit->u8OutCh;
+        pstcBlock->u8InCh      = pstcBlockInit->u8InCh;
+        pstcBlock->pfnCallback = pstcBlockInit->pfnCallback;
+        pstcBlock->pvArg       = pstcBlockInit->pvArg;
+        pstcBlock->pi32Out     = NULL;
+        pstcBlock->u32Len      = 0UL;
+        pstcBlock->u8Busy      = 0U;
+        for (i = 0UL; i < FMAC_BLOCK_HIST_MAX; i++) {
+            pstcBlock->ai16Hist[i] = 0;
+        }
+
+        if (NULL != pstcBlock->pstcDmaUnit) {
+            AOS_SetTriggerEventSrc(pstcBlockInit->u32OutTrigTarget, pstcBlockInit->enEvtSrc);
+            AOS_SetTriggerEventSrc(pstcBlockInit->u32InTrigTarget, pstcBlockInit->enEvtSrc);
+        }
+        i32Ret = LL_OK;
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Load a coefficient set, clearing the filter state.
+ * @param  [in] pstcBlock               Pointer to a @ref stc_fmac_block_t structure.
+ * @param  [in] pstcCoef                Pointer to a @ref stc_fmac_coef_set_t structure, it must stay
+ *                                      valid while loaded.
+ * @retval int32_t:
+ *           - LL_OK:                   Load success
+ *           - LL_ERR_INVD_PARAM:       Invalid parameter, or more taps than the chained units
+ *           - LL_ERR_BUSY:             DMA block in progress
+ */
+int32_t FMAC_BLOCK_LoadCoef(stc_fmac_block_t *pstcBlock, const stc_fmac_coef_set_t *pstcCoef)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+    CM_FMAC_TypeDef *FMACx;
+    __IO uint32_t *FMAC_CORx;
+    uint32_t u32UnitNum;
+    uint32_t u32Stage;
+    uint32_t u32Shift;
+    uint32_t u32Unit;
+    uint32_t i;
+
+    if ((NULL != pstcBlock) && (NULL != pstcCoef)) {
+        u32UnitNum = FMAC_BLOCK_UnitNum(pstcCoef);
+        if (0U != pstcBlock->u8Busy) {
+            i32Ret = LL_ERR_BUSY;
+        } else if ((0UL != u32UnitNum) && (u32UnitNum <= pstcBlock->u8UnitNum)) {
+            /* Chained units keep the full result, the sum is shifted once */
+            u32Shift = (1UL == u32UnitNum) ? pstcCoef->u32Shift : FMAC_FIR_SHIFT_0BIT;
+            for (u32Unit = 0UL; u32Unit < u32UnitNum; u32Unit++) {
+                FMACx = pstcBlock->apstcUnit[u32Unit];
+                u32Stage = FMAC_BLOCK_UNIT_TAPS - 1UL;
+                if (u32Unit == (u32UnitNum - 1UL)) {
+                    u32Stage = (pstcCoef->u32Taps - 1UL) - (u32Unit * FMAC_BLOCK_UNIT_TAPS);
+                }
+                /* Software reset clears the delay line */
+                FMAC_Cmd(FMACx, DISABLE);
+                FMAC_Cmd(FMACx, ENABLE);
+                WRITE_REG32(FMACx->CTR, u32Stage | (u32Shift << FMAC_CTR_SHIFT_POS));
+                FMAC_CORx = &FMACx->COR0;
+                for (i = 0UL; i <= u32Stage; i++) {
+                    WRITE_REG32(FMAC_CORx[i], pstcCoef->au32Cor[u32Unit][i]);
+                }
+            }
+            for (i = 0UL; i < FMAC_BLOCK_HIST_MAX; i++) {
+                pstcBlock->ai16Hist[i] = 0;
+            }
+            pstcBlock->u8UsedNum = (uint8_t)u32UnitNum;
+            pstcBlock->pstcCoef  = pstcCoef;
+            i32Ret = LL_OK;
+        } else {
+            /* Not enough units */
+        }
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Filter a block of samples, by polling.
+ * @param  [in] pstcBlock               Pointer to a @ref stc_fmac_block_t structure.
+ * @param  [in] pi16In                  Input samples.
+ * @param  [out] pi32Out                Output samples, may not alias pi16In.
+ * @param  [in] u32Len                  Number of samples.
+ * @retval int32_t:
+ *           - LL_OK:                   Block filtered
+ *           - LL_ERR_INVD_PARAM:       Invalid parameter
+ *           - LL_ERR_UNINIT:           No coefficient set loaded
+ *           - LL_ERR_BUSY:             DMA block in progress
+ *           - LL_ERR_TIMEOUT:          An FMAC unit did not answer
+ * @note   The filter state carries over from one block to the next.
+ */
+int32_t FMAC_BLOCK_Process(stc_fmac_block_t *pstcBlock, const int16_t *pi16In, int32_t *pi32Out, uint32_t u32Len)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+    uint32_t u32UnitNum;
+    uint32_t u32Unit;
+    int64_t i64Acc;
+    uint32_t i;
+
+    if ((NULL != pstcBlock) && (NULL != pi16In) && (NULL != pi32Out)) {
+        if (NULL == pstcBlock->pstcCoef) {
+            i32Ret = LL_ERR_UNINIT;
+        } else if (0U != pstcBlock->u8Busy) {
+            i32Ret = LL_ERR_BUSY;
+        } else {
+            i32Ret = LL_OK;
+            u32UnitNum = pstcBlock->u8UsedNum;
+            for (i = 0UL; (i < u32Len) && (LL_OK == i32Ret); i++) {
+                for (u32Unit = 0UL; u32Unit < u32UnitNum; u32Unit++) {
+                    FMAC_FIRInput(pstcBlock->apstcUnit[u32Unit],
+                                  FMAC_BLOCK_Delayed(pstcBlock, pi16In, i, u32Unit * FMAC_BLOCK_UNIT_TAPS));
+                }
+                i64Acc = 0LL;
+                for (u32Unit = 0UL; u32Unit < u32UnitNum; u32Unit++) {
+                    i32Ret = FMAC_BLOCK_WaitReady(pstcBlock->apstcUnit[u32Unit]);
+                    if (LL_OK != i32Ret) {
+                        break;
+                    }
+                    i64Acc += FMAC_BLOCK_ReadResult(pstcBlock->apstcUnit[u32Unit]);
+                }
+                /* A single unit has already shifted */
+                pi32Out[i] = FMAC_BLOCK_Shift(i64Acc, (1UL == u32UnitNum) ? 0UL : pstcBlock->pstcCoef->u32Shift);
+            }
+            if (u32UnitNum > 1UL) {
+                FMAC_BLOCK_HistUpdate(pstcBlock->ai16Hist, pi16In, u32Len);
+            }
+        }
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Start filtering a block of samples through DMA.
+ * @param  [in] pstcBlock               Pointer to a @ref stc_fmac_block_t structure.
+ * @param  [in] pi16In                  Input samples, valid until the completion callback.
+ * @param  [out] pi32Out                Output samples.
+ * @param  [in] u32Len                  Number of samples, 1 ~ 0xFFFF.
+ * @retval int32_t:
+ *           - LL_OK:                   Block started
+ *           - LL_ERR_INVD_PARAM:       Invalid parameter
+ *           - LL_ERR_UNINIT:           No coefficient set loaded
+ *           - LL_ERR_INVD_MD:          No DMA, or the coefficient set needs chained units
+ *           - LL_ERR_BUSY:             DMA block in progress
+ * @note   Each result ready event of the first unit makes one channel read RTR1 and then the
+ *         other one write the next input, so the CPU only writes the first input. The
+ *         completion is reported by FMAC_BLOCK_DmaIrqHandler() through the callback.
+ * @note   Only a coefficient set of one unit runs through DMA. Chained units need their
+ *         results summed in 64 bits before the single shift and the inputs of the delayed
+ *         units taken from the history of the previous block, neither of which the DMA can
+ *         do; longer filters run by FMAC_BLOCK_Process().
+ */
+int32_t FMAC_BLOCK_ProcessDma(stc_fmac_block_t *pstcBlock, const int16_t *pi16In, int32_t *pi32Out,
+                              uint32_t u32Len)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+    CM_FMAC_TypeDef *FMACx;
+    stc_dma_init_t stcDmaInit;
+
+    if ((NULL != pstcBlock) && (NULL != pi16In) && (NULL != pi32Out) && (0UL != u32Len) && (u32Len <= 0xFFFFUL)) {
+        if (NULL == pstcBlock->pstcCoef) {
+            i32Ret = LL_ERR_UNINIT;
+        } else if ((NULL == pstcBlock->pstcDmaUnit) || (1U != pstcBlock->u8UsedNum)) {
+            i32Ret = LL_ERR_INVD_MD;
+        } else if (0U != pstcBlock->u8Busy) {
+            i32Ret = LL_ERR_BUSY;
+        } else {
+            FMACx = pstcBlock->apstcUnit[0];
+            pstcBlock->pi32Out = pi32Out;
+            pstcBlock->u32Len  = u32Len;
+            pstcBlock->u8Busy  = 1U;
+
+            (void)DMA_StructInit(&stcDmaInit);
+            stcDmaInit.u32IntEn       = DMA_INT_ENABLE;
+            stcDmaInit.u32SrcAddr     = (uint32_t)&FMACx->RTR1;
+            stcDmaInit.u32DestAddr    = (uint32_t)pi32Out;
+            stcDmaInit.u32DataWidth   = DMA_DATAWIDTH_32BIT;
+            stcDmaInit.u32BlockSize   = 1UL;
+            stcDmaInit.u32TransCount  = u32Len;
+            stcDmaInit.u32SrcAddrInc  = DMA_SRC_ADDR_FIX;
+            stcDmaInit.u32DestAddrInc = DMA_DEST_ADDR_INC;
+            (void)DMA_Init(pstcBlock->pstcDmaUnit, pstcBlock->u8OutCh, &stcDmaInit);
+            DMA_ClearTransCompleteStatus(pstcBlock->pstcDmaUnit, DMA_FLAG_TC_CH0 << pstcBlock->u8OutCh);
+            DMA_TransCompleteIntCmd(pstcBlock->pstcDmaUnit, DMA_INT_TC_CH0 << pstcBlock->u8OutCh, ENABLE);
+            (void)DMA_ChCmd(pstcBlock->pstcDmaUnit, pstcBlock->u8OutCh, ENABLE);
+
+            if (u32Len > 1UL) {
+                stcDmaInit.u32IntEn       = DMA_INT_DISABLE;
+                stcDmaInit.u32SrcAddr     = (uint32_t)&pi16In[1];
+                stcDmaInit.u32DestAddr    = (uint32_t)&FMACx->DTR;
+                stcDmaInit.u32DataWidth   = DMA_DATAWIDTH_16BIT;
+                stcDmaInit.u32TransCount  = u32Len - 1UL;
+                stcDmaInit.u32SrcAddrInc  = DMA_SRC_ADDR_INC;
+                stcDmaInit.u32DestAddrInc = DMA_DEST_ADDR_FIX;
+                (void)DMA_Init(pstcBlock->pstcDmaUnit, pstcBlock->u8InCh, &stcDmaInit);
+                (void)DMA_ChCmd(pstcBlock->pstcDmaUnit, pstcBlock->u8InCh, ENABLE);
+            }
+
+            /* The interrupt request of the FMAC is the DMA trigger */
+            FMAC_IntCmd(FMACx, ENABLE);
+            FMAC_FIRInput(FMACx, pi16In[0]);
+            i32Ret = LL_OK;
+        }
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  DMA transfer complete interrupt handler of an FMAC block filter, call it from the
+ *         TC interrupt of the result channel.
+ * @param  [in] pstcBlock               Pointer to a @ref stc_fmac_block_t structure.
+ * @retval None
+ */
+void FMAC_BLOCK_DmaIrqHandler(stc_fmac_block_t *pstcBlock)
+{
+    DDL_ASSERT(NULL != pstcBlock);
+
+    if ((0U != pstcBlock->u8Busy) &&
+        (SET == DMA_GetTransCompleteStatus(pstcBlock->pstcDmaUnit, DMA_FLAG_TC_CH0 << pstcBlock->u8OutCh))) {
+        FMAC_BLOCK_DmaHalt(pstcBlock);
+        if (NULL != pstcBlock->pfnCallback) {
+            pstcBlock->pfnCallback(pstcBlock, pstcBlock->pi32Out, pstcBlock->u32Len, pstcBlock->pvArg);
+        }
+    }
+}
+
+/**
+ * @brief  Software FIR giving the same output as the FMAC units.
+ * @param  [in] pstcCoef                Pointer to a @ref stc_fmac_coef_set_t structure.
+ * @param  [in,out] pi16State           Last u32Taps - 1 inputs, oldest first, zero before the
+ *                                      first block.
+ * @param  [in] pi16In                  Input samples.
+ * @param  [out] pi32Out                Output samples.
+ * @param  [in] u32Len                  Number of samples.
+ * @retval int32_t:
+ *           - LL_OK:                   Block filtered
+ *           - LL_ERR_INVD_PARAM:       Invalid parameter
+ * @note   The products are summed in 64 bits and shifted once with the rounding of the FMAC,
+ *         the output keeps the low 32 bits. It runs on the host as well as on the target.
+ */
+int32_t FMAC_BLOCK_Reference(const stc_fmac_coef_set_t *pstcCoef, int16_t *pi16State, const int16_t *pi16In,
+                             int32_t *pi32Out, uint32_t u32Len)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+    const uint32_t u32Hist = (NULL != pstcCoef) ? (pstcCoef->u32Taps - 1UL) : 0UL;
+    int64_t i64Acc;
+    int16_t i16X;
+    uint32_t i;
+    uint32_t k;
+
+    if ((NULL != pstcCoef) && (NULL != pi16In) && (NULL != pi32Out) && ((0UL == u32Hist) || (NULL != pi16State))) {
+        for (i = 0UL; i < u32Len; i++) {
+            i64Acc = 0LL;
+            for (k = 0UL; k <= u32Hist; k++) {
+                i16X = (i >= k) ? pi16In[i - k] : pi16State[u32Hist - (k - i)];
+                i64Acc += (int64_t)(int32_t)pstcCoef->au32Cor[k / FMAC_BLOCK_UNIT_TAPS][k % FMAC_BLOCK_UNIT_TAPS] *
+                          i16X;
+            }
+            pi32Out[i] = FMAC_BLOCK_Shift(i64Acc, pstcCoef->u32Shift);
+        }
+        /* Keep the last inputs */
+        if (u32Len >= u32Hist) {
+            for (k = 0UL; k < u32Hist; k++) {
+                pi16State[k] = pi16In[(u32Len - u32Hist) + k];
+            }
+        } else {
+            for (k = 0UL; k < (u32Hist - u32Len); k++) {
+                pi16State[k] = pi16State[k + u32Len];
+            }
+            for (k = 0UL; k < u32Len; k++) {
+                pi16State[(u32Hist - u32Len) + k] = pi16In[k];
+            }
+        }
+        i32Ret = LL_OK;
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @}
+ */
+
+#endif /* LL_FMAC_BLOCK_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
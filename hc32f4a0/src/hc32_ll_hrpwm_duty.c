@@ -0,0 +1,338 @@
+/**
+ *******************************************************************************
+ * @file  hc32_ll_hrpwm_duty.c
+ * @brief This file provides firmware functions to set TMR6 PWM duties with
+ *        HRPWM resolution.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       CDT             First version
+                                    Changed u32Gen in HRPWM_DUTY_CalibInit() only when a code is taken
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2025, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ll_hrpwm_duty.h"
+#include "hc32_ll_hrpwm.h"
+#include "hc32_ll_tmr6.h"
+#include "hc32_ll_utility.h"
+
+/**
+ * @addtogroup LL_Driver
+ * @{
+ */
+
+/**
+ * @defgroup LL_HRPWM_DUTY HRPWM_DUTY
+ * @brief HRPWM High Resolution Duty Driver Library
+ * @note  The calibration code of an HRPWM unit is the number of delay elements in one PCLK0
+ *        cycle. It is measured once by HRPWM_DUTY_CalibInit() and kept in a cache, which
+ *        HRPWM_DUTY_CalibPoll() refreshes without blocking when the temperature has moved or
+ *        after a number of polls.
+ *        A duty is given in timer counts and 1/65536 count, or in picoseconds. The whole
+ *        counts go to the compare buffer register of the TMR6 channel, transferred by the
+ *        timer at the period boundary, and the fraction becomes the delay code of the HRPWM
+ *        channel. HRPWM_DUTY_Apply(), called from the interrupt of the buffer transfer
+ *        event, writes the delay code, so that both take effect in the same period. It also
+ *        rescales the code after a new calibration.
+ * @{
+ */
+
+#if (LL_HRPWM_DUTY_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup HRPWM_DUTY_Local_Macros HRPWM_DUTY Local Macros
+ * @{
+ */
+#define HRPWM_DUTY_PS_PER_S             (1000000000000ULL)
+#define HRPWM_DUTY_FRAC_MASK            (HRPWM_DUTY_FRAC_ONE - 1UL)
+
+/* Polls before a background calibration is given up */
+#define HRPWM_DUTY_CALIB_POLL_MAX       (100UL)
+
+/**
+ * @defgroup HRPWM_DUTY_Check_Parameters_Validity HRPWM_DUTY Check Parameters Validity
+ * @{
+ */
+#define IS_HRPWM_DUTY_EDGE(x)           (((x) == HRPWM_DUTY_EDGE_POS) || ((x) == HRPWM_DUTY_EDGE_NEG))
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @defgroup HRPWM_DUTY_Global_Functions HRPWM_DUTY Global Functions
+ * @{
+ */
+
+/**
+ * @brief  Calibrate an HRPWM unit and initialize its cache.
+ * @param  [out] pstcCalib              Pointer to a @ref stc_hrpwm_duty_calib_t structure.
+ * @param  [in] u32Unit                 Calibration unit, a value of @ref HRPWM_Calib_Unit_Define.
+ * @param  [in] i32Temp                 Current temperature, in any unit.
+ * @param  [in] i32TempDelta            Temperature change starting a new calibration, 0 for none.
+ * @param  [in] u32PollPeriod           Polls between two calibrations, 0 for none.
+ * @retval int32_t:
+ *           - LL_OK:                   No error occurred.
+ *           - LL_ERR_INVD_MD:          The clocks do not allow the calibration.
+ *           - LL_ERR_TIMEOUT:          The calibration did not end, no code is cached.
+ *           - LL_ERR_INVD_PARAM:       pstcCalib == NULL.
+ */
+int32_t HRPWM_DUTY_CalibInit(stc_hrpwm_duty_calib_t *pstcCalib, uint32_t u32Unit, int32_t i32Temp,
+                             int32_t i32TempDelta, uint32_t u32PollPeriod)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if (NULL != pstcCalib) {
+        pstcCalib->u32Unit       = u32Unit;
+        pstcCalib->u8Code        = 0U;
+        pstcCalib->u8Running     = 0U;
+        pstcCalib->i32Temp       = i32Temp;
+        pstcCalib->i32TempDelta  = i32TempDelta;
+        pstcCalib->u32Polls      = 0UL;
+        pstcCalib->u32PollPeriod = u32PollPeriod;
+        pstcCalib->u32Gen        = 0UL;
+
+        if (ENABLE != HRPWM_CondConfirm()) {
+            i32Ret = LL_ERR_INVD_MD;
+        } else {
+            i32Ret = HRPWM_CalibProcess(u32Unit, &pstcCalib->u8Code);
+            if (LL_OK == i32Ret) {
+                pstcCalib->u32Gen++;
+            }
+        }
+    }
+    return i32Ret;
+}
+
+/**
+ * @brief  Refresh the calibration cache in the background.
+ * @param  [in] pstcCalib               Pointer to a @ref stc_hrpwm_duty_calib_t structure.
+ * @param  [in] i32Temp                 Current temperature, in the unit of HRPWM_DUTY_CalibInit().
+ * @retval int32_t:
+ *           - LL_OK:                   No error occurred.
+ *           - LL_ERR_TIMEOUT:          A calibration did not end, the cached code is kept.
+ *           - LL_ERR_INVD_PARAM:       pstcCalib == NULL.
+ * @note   Call periodically from a task. A calibration is started when the temperature has moved
+ *         by i32TempDelta since the last one or after u32PollPeriod polls, and its code is taken
+ *         at a later poll.
+ */
+int32_t HRPWM_DUTY_CalibPoll(stc_hrpwm_duty_calib_t *pstcCalib, int32_t i32Temp)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+    int32_t i32Delta;
+
+    if (NULL != pstcCalib) {
+        i32Ret = LL_OK;
+        pstcCalib->u32Polls++;
+        if (0U != pstcCalib->u8Running) {
+            if (ENABLE == HRPWM_GetCalibState(pstcCalib->u32Unit)) {
+                pstcCalib->u8Code    = HRPWM_GetCalibCode(pstcCalib->u32Unit);
+                pstcCalib->u8Running = 0U;
+                pstcCalib->u32Polls  = 0UL;
+                pstcCalib->u32Gen++;
+            } else if (pstcCalib->u32Polls > HRPWM_DUTY_CALIB_POLL_MAX) {
+                HRPWM_CalibCmd(pstcCalib->u32Unit, DISABLE);
+                pstcCalib->u8Running = 0U;
+                pstcCalib->u32Polls  = 0UL;
+                i32Ret = LL_ERR_TIMEOUT;
+            } else {
+                /* rsvd */
+            }
+        } else {
+            i32Delta = i32Temp - pstcCalib->i32Temp;
+            if (i32Delta < 0L) {
+                i32Delta = -i32Delta;
+            }
+            if (((0L != pstcCalib->i32TempDelta) && (i32Delta >= pstcCalib->i32TempDelta)) ||
+                ((0UL != pstcCalib->u32PollPeriod) && (pstcCalib->u32Polls >= pstcCalib->u32PollPeriod))) {
+                HRPWM_CalibCmd(pstcCalib->u32Unit, ENABLE);
+                pstcCalib->u8Running = 1U;
+                pstcCalib->i32Temp   = i32Temp;
+                pstcCalib->u32Polls  = 0UL;
+            }
+        }
+    }
+    return i32Ret;
+}
+
+/**
+ * @brief  Set the default value of each member of stc_hrpwm_duty_init_t.
+ * @param  [out] pstcDutyInit           Pointer to a @ref stc_hrpwm_duty_init_t structure.
+ * @retval int32_t:
+ *           - LL_OK:                   No error occurred.
+ *           - LL_ERR_INVD_PARAM:       pstcDutyInit == NULL.
+ */
+int32_t HRPWM_DUTY_StructInit(stc_hrpwm_duty_init_t *pstcDutyInit)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if (NULL != pstcDutyInit) {
+        pstcDutyInit->TMR6x        = NULL;
+        pstcDutyInit->u32TmrCh     = TMR6_CH_A;
+        pstcDutyInit->u32HrCh      = HRPWM_CH_MIN;
+        pstcDutyInit->u8Edge       = HRPWM_DUTY_EDGE_NEG;
+        pstcDutyInit->u32ClockFreq = 0UL;
+        pstcDutyInit->pstcCalib    = NULL;
+        i32Ret = LL_OK;
+    }
+    return i32Ret;
+}
+
+/**
+ * @brief  Initialize a high resolution duty channel.
+ * @param  [out] pstcDuty               Pointer to a @ref stc_hrpwm_duty_t structure.
+ * @param  [in] pstcDutyInit            Pointer to a @ref stc_hrpwm_duty_init_t structure.
+ * @retval int32_t:
+ *           - LL_OK:                   No error occurred.
+ *           - LL_ERR_INVD_PARAM:       NULL pointer or frequency 0.
+ * @note   The TMR6 channel must be configured for PWM with a single compare buffer, counting
+ *         PCLK0 without division.
+ */
+int32_t HRPWM_DUTY_Init(stc_hrpwm_duty_t *pstcDuty, const stc_hrpwm_duty_init_t *pstcDutyInit)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if ((NULL != pstcDuty) && (NULL != pstcDutyInit) && (NULL != pstcDutyInit->TMR6x) &&
+        (NULL != pstcDutyInit->pstcCalib) && (0UL != pstcDutyInit->u32ClockFreq)) {
+        DDL_ASSERT((TMR6_CH_A == pstcDutyInit->u32TmrCh) || (TMR6_CH_B == pstcDutyInit->u32TmrCh));
+        DDL_ASSERT(IS_HRPWM_DUTY_EDGE(pstcDutyInit->u8Edge));
+
+        pstcDuty->TMR6x        = pstcDutyInit->TMR6x;
+        pstcDuty->u32CmpBufIdx = (TMR6_CH_A == pstcDutyInit->u32TmrCh) ? TMR6_CMP_REG_C : TMR6_CMP_REG_D;
+        pstcDuty->u32HrCh      = pstcDutyInit->u32HrCh;
+        pstcDuty->u8Edge       = pstcDutyInit->u8Edge;
+        pstcDuty->u32ClockFreq = pstcDutyInit->u32ClockFreq;
+        pstcDuty->pstcCalib    = pstcDutyInit->pstcCalib;
+        pstcDuty->u32Frac      = 0UL;
+        pstcDuty->u32Gen       = pstcDutyInit->pstcCalib->u32Gen;
+        pstcDuty->u8Pending    = 0U;
+
+        if (HRPWM_DUTY_EDGE_POS == pstcDuty->u8Edge) {
+            HRPWM_ChPositiveAdjustConfig(pstcDuty->u32HrCh, 0U);
+            HRPWM_ChPositiveAdjustCmd(pstcDuty->u32HrCh, ENABLE);
+        } else {
+            HRPWM_ChNegativeAdjustConfig(pstcDuty->u32HrCh, 0U);
+            HRPWM_ChNegativeAdjustCmd(pstcDuty->u32HrCh, ENABLE);
+        }
+        HRPWM_ChCmd(pstcDuty->u32HrCh, ENABLE);
+        i32Ret = LL_OK;
+    }
+    return i32Ret;
+}
+
+/**
+ * @brief  Stage a duty in counts and fraction of count.
+ * @param  [in] pstcDuty                Pointer to a @ref stc_hrpwm_duty_t structure.
+ * @param  [in] u32Count                Whole counts, the compare value.
+ * @param  [in] u32Frac                 Fraction in 1/65536 count, below @ref HRPWM_DUTY_FRAC_ONE.
+ * @retval None
+ */
+void HRPWM_DUTY_SetFrac(stc_hrpwm_duty_t *pstcDuty, uint32_t u32Count, uint32_t u32Frac)
+{
+    DDL_ASSERT(NULL != pstcDuty);
+    DDL_ASSERT(u32Frac < HRPWM_DUTY_FRAC_ONE);
+
+    TMR6_SetCompareValue(pstcDuty->TMR6x, pstcDuty->u32CmpBufIdx, u32Count);
+    pstcDuty->u32Frac   = u32Frac & HRPWM_DUTY_FRAC_MASK;
+    pstcDuty->u8Pending = 1U;
+}
+
+/**
+ * @brief  Stage a duty in picoseconds.
+ * @param  [in] pstcDuty                Pointer to a @ref stc_hrpwm_duty_t structure.
+ * @param  [in] u32Ps                   Duty in picoseconds.
+ * @retval None
+ */
+void HRPWM_DUTY_SetPs(stc_hrpwm_duty_t *pstcDuty, uint32_t u32Ps)
+{
+    uint64_t u64Num;
+    uint64_t u64Rem;
+
+    DDL_ASSERT(NULL != pstcDuty);
+
+    u64Num = (uint64_t)u32Ps * pstcDuty->u32ClockFreq;
+    u64Rem = u64Num % HRPWM_DUTY_PS_PER_S;
+    HRPWM_DUTY_SetFrac(pstcDuty, (uint32_t)(u64Num / HRPWM_DUTY_PS_PER_S),
+                       (uint32_t)((u64Rem * HRPWM_DUTY_FRAC_ONE) / HRPWM_DUTY_PS_PER_S));
+}
+
+/**
+ * @brief  Write the delay code of the staged duty.
+ * @param  [in] pstcDuty                Pointer to a @ref stc_hrpwm_duty_t structure.
+ * @retval None
+ * @note   Call from the interrupt of the TMR6 event transferring the compare buffer.
+ */
+void HRPWM_DUTY_Apply(stc_hrpwm_duty_t *pstcDuty)
+{
+    const stc_hrpwm_duty_calib_t *pstcCalib;
+    uint32_t u32Code;
+
+    DDL_ASSERT(NULL != pstcDuty);
+
+    pstcCalib = pstcDuty->pstcCalib;
+    if ((0U != pstcDuty->u8Pending) || (pstcDuty->u32Gen != pstcCalib->u32Gen)) {
+        pstcDuty->u32Gen    = pstcCalib->u32Gen;
+        pstcDuty->u8Pending = 0U;
+        u32Code = (pstcDuty->u32Frac * pstcCalib->u8Code) >> 16U;
+        if (HRPWM_DUTY_EDGE_POS == pstcDuty->u8Edge) {
+            HRPWM_ChPositiveAdjustConfig(pstcDuty->u32HrCh, (uint8_t)u32Code);
+        } else {
+            HRPWM_ChNegativeAdjustConfig(pstcDuty->u32HrCh, (uint8_t)u32Code);
+        }
+    }
+}
+
+/**
+ * @}
+ */
+
+#endif /* LL_HRPWM_DUTY_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,854 @@
+/**
+ *******************************************************************************
+ * @file  hc32_ll_i2c_xfer.c
+ * @brief This file provides firmware functions to manage the interrupt driven
+ *        I2C transaction engine.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       CDT             First version
+                                    Added DMA payloads and register read coalescing
+                                    Fixed double start on resubmission and single byte read ACK
+                                    Added arbitration loss retries
+                                    Masked interrupts while the coalescer list is modified
+                                    Waited for the bus after a lost arbitration from the stop interrupt
+                                    Completed a burst before its callbacks, they may flush the next one
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2025, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ll_i2c_xfer.h"
+#include "hc32_ll_i2c.h"
+#include "hc32_ll_dma.h"
+#include "hc32_ll_aos.h"
+#include "hc32_ll_utility.h"
+
+/**
+ * @addtogroup LL_Driver
+ * @{
+ */
+
+/**
+ * @defgroup LL_I2C_XFER I2C_XFER
+ * @brief Interrupt Driven I2C Transaction Driver Library
+ * @note  Transactions are queued per I2C unit and run one after the other by
+ *        I2C_XFER_IrqHandler(), one interrupt per bus event, so the CPU is free
+ *        between bytes. The I2C unit must be initialized as master by I2C_Init()
+ *        and enabled by I2C_Cmd() before I2C_XFER_Init().
+ *        The register read coalescer merges pending reads of adjacent registers of one
+ *        device into a single write-register/restart/read burst.
+ * @{
+ */
+
+#if (LL_I2C_XFER_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup I2C_XFER_Local_Macros I2C_XFER Local Macros
+ * @{
+ */
+/* Transaction states */
+#define I2C_XFER_ST_IDLE                (0U)    /* No transaction */
+#define I2C_XFER_ST_START               (1U)    /* Start or restart requested */
+#define I2C_XFER_ST_TX                  (2U)    /* Address or data byte written */
+#define I2C_XFER_ST_RX                  (3U)    /* Receiving data */
+#define I2C_XFER_ST_STOP                (4U)    /* Stop requested */
+#define I2C_XFER_ST_ARLO                (5U)    /* Arbitration lost, waiting for the stop of the winner */
+
+#define I2C_XFER_7BIT_MAX               (0x7FU)
+
+/* Bytes of a DMA read left to the CPU for the NACK and stop sequence */
+#define I2C_XFER_DMA_RX_TAIL            (2U)
+#define I2C_XFER_DMA_THRESHOLD_MIN      (I2C_XFER_DMA_RX_TAIL + 1U)
+
+/**
+ * @defgroup I2C_XFER_Check_Parameters_Validity I2C_XFER Check Parameters Validity
+ * @{
+ */
+#define IS_I2C_XFER_UNIT(x)                                                    \
+(   ((x) == CM_I2C1)                        ||                                 \
+    ((x) == CM_I2C2)                        ||                                 \
+    ((x) == CM_I2C3)                        ||                                 \
+    ((x) == CM_I2C4)                        ||                                 \
+    ((x) == CM_I2C5)                        ||                                 \
+    ((x) == CM_I2C6))
+
+#define IS_I2C_XFER_DMA_CH(x)           ((x) <= DMA_CH7)
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @defgroup I2C_XFER_Local_Functions I2C_XFER Local Functions
+ * @{
+ */
+
+/**
+ * @brief  Start the transaction at the head of the queue.
+ * @param  [in] pstcHandle              Pointer to a @ref stc_i2c_xfer_handle_t structure.
+ * @retval None
+ */
+static void I2C_XFER_Begin(stc_i2c_xfer_handle_t *pstcHandle)
+{
+    const stc_i2c_xfer_t *pstcXfer = pstcHandle->pstcHead;
+
+    pstcHandle->i32Result = LL_OK;
+    pstcHandle->u16Pos    = 0U;
+    pstcHandle->u8DmaDir  = I2C_XFER_DMA_NONE;
+    /* Write first, a transaction without data addresses the device for write */
+    pstcHandle->u8Dir     = ((pstcXfer->u16TxLen > 0U) || (pstcXfer->u16RxLen == 0U)) ? I2C_DIR_TX : I2C_DIR_RX;
+    pstcHandle->u8State   = I2C_XFER_ST_START;
+
+    I2C_AckConfig(pstcHandle->pstcUnit, I2C_ACK);
+    I2C_ClearStatus(pstcHandle->pstcUnit, I2C_FLAG_CLR_ALL);
+    I2C_IntCmd(pstcHandle->pstcUnit, I2C_XFER_INT, ENABLE);
+    I2C_GenerateStart(pstcHandle->pstcUnit);
+}
+
+/**
+ * @brief  Get the DMA threshold of the engine.
+ * @param  [in] pstcHandle              Pointer to a @ref stc_i2c_xfer_handle_t structure.
+ * @retval Minimum payload moved by DMA, 0xFFFF if DMA is not configured.
+ */
+static uint32_t I2C_XFER_DmaThreshold(const stc_i2c_xfer_handle_t *pstcHandle)
+{
+    uint32_t u32Threshold = 0xFFFFUL;
+
+    if (NULL != pstcHandle->pstcDma) {
+        u32Threshold = pstcHandle->pstcDma->u16Threshold;
+        if (u32Threshold < I2C_XFER_DMA_THRESHOLD_MIN) {
+            u32Threshold = I2C_XFER_DMA_THRESHOLD_MIN;
+        }
+    }
+    return u32Threshold;
+}
+
+/**
+ * @brief  Hand a payload to the DMA.
+ * @param  [in] pstcHandle              Pointer to a @ref stc_i2c_xfer_handle_t structure.
+ * @param  [in] u8DmaDir                Direction, @ref I2C_XFER_DMA_TX or @ref I2C_XFER_DMA_RX.
+ * @retval None
+ * @note   Write: the TXI event moves every byte and the TX_CPLT interrupt is held off until the
+ *         DMA completes. Read: the RXI event moves all but the last two bytes, which are left to
+ *         the CPU for the NACK and stop sequence, and the RXI IRQ is masked meanwhile.
+ */
+static void I2C_XFER_DmaStart(stc_i2c_xfer_handle_t *pstcHandle, uint8_t u8DmaDir)
+{
+    const stc_i2c_xfer_dma_t *pstcDma = pstcHandle->pstcDma;
+    const stc_i2c_xfer_t *pstcXfer = pstcHandle->pstcHead;
+    CM_I2C_TypeDef *I2Cx = pstcHandle->pstcUnit;
+
+    pstcHandle->u8DmaDir = u8DmaDir;
+    if (I2C_XFER_DMA_TX == u8DmaDir) {
+        (void)DMA_SetSrcAddr(pstcDma->pstcDmaUnit, pstcDma->u8TxCh, (uint32_t)pstcXfer->pu8TxBuf);
+        (void)DMA_SetTransCount(pstcDma->pstcDmaUnit, pstcDma->u8TxCh, pstcXfer->u16TxLen);
+        DMA_ClearTransCompleteStatus(pstcDma->pstcDmaUnit, DMA_FLAG_TC_CH0 << pstcDma->u8TxCh);
+        (void)DMA_ChCmd(pstcDma->pstcDmaUnit, pstcDma->u8TxCh, ENABLE);
+        I2C_IntCmd(I2Cx, I2C_INT_TX_CPLT, DISABLE);
+        I2C_IntCmd(I2Cx, I2C_INT_TX_EMPTY, ENABLE);
+    } else {
+        NVIC_DisableIRQ(pstcDma->enRxIrqn);
+        (void)DMA_SetDestAddr(pstcDma->pstcDmaUnit, pstcDma->u8RxCh, (uint32_t)pstcXfer->pu8RxBuf);
+        (void)DMA_SetTransCount(pstcDma->pstcDmaUnit, pstcDma->u8RxCh,
+                                pstcXfer->u16RxLen - I2C_XFER_DMA_RX_TAIL);
+        DMA_ClearTransCompleteStatus(pstcDma->pstcDmaUnit, DMA_FLAG_TC_CH0 << pstcDma->u8RxCh);
+        (void)DMA_ChCmd(pstcDma->pstcDmaUnit, pstcDma->u8RxCh, ENABLE);
+    }
+}
+
+/**
+ * @brief  Take the payload back from the DMA, it is stopped if still running.
+ * @param  [in] pstcHandle              Pointer to a @ref stc_i2c_xfer_handle_t structure.
+ * @retval None
+ */
+static void I2C_XFER_DmaStop(stc_i2c_xfer_handle_t *pstcHandle)
+{
+    const stc_i2c_xfer_dma_t *pstcDma = pstcHandle->pstcDma;
+    CM_I2C_TypeDef *I2Cx = pstcHandle->pstcUnit;
+
+    if (I2C_XFER_DMA_TX == pstcHandle->u8DmaDir) {
+        (void)DMA_ChCmd(pstcDma->pstcDmaUnit, pstcDma->u8TxCh, DISABLE);
+        DMA_ClearTransCompleteStatus(pstcDma->pstcDmaUnit, DMA_FLAG_TC_CH0 << pstcDma->u8TxCh);
+        I2C_IntCmd(I2Cx, I2C_INT_TX_EMPTY, DISABLE);
+        I2C_IntCmd(I2Cx, I2C_INT_TX_CPLT, ENABLE);
+    } else if (I2C_XFER_DMA_RX == pstcHandle->u8DmaDir) {
+        (void)DMA_ChCmd(pstcDma->pstcDmaUnit, pstcDma->u8RxCh, DISABLE);
+        DMA_ClearTransCompleteStatus(pstcDma->pstcDmaUnit, DMA_FLAG_TC_CH0 << pstcDma->u8RxCh);
+        NVIC_ClearPendingIRQ(pstcDma->enRxIrqn);
+        NVIC_EnableIRQ(pstcDma->enRxIrqn);
+    } else {
+        /* No DMA in progress */
+    }
+    pstcHandle->u8DmaDir = I2C_XFER_DMA_NONE;
+}
+
+/**
+ * @brief  Complete the transaction at the head of the queue and start the next one.
+ * @param  [in] pstcHandle              Pointer to a @ref stc_i2c_xfer_handle_t structure.
+ * @retval None
+ */
+static void I2C_XFER_Finish(stc_i2c_xfer_handle_t *pstcHandle)
+{
+    stc_i2c_xfer_t *pstcXfer = pstcHandle->pstcHead;
+
+    I2C_XFER_DmaStop(pstcHandle);
+    pstcXfer->i32Result  = pstcHandle->i32Result;
+    pstcHandle->u8Retry  = 0U;
+    pstcHandle->pstcHead = pstcXfer->pstcNext;
+    pstcXfer->pstcNext   = NULL;
+    /* The next transaction is started before the callback, so a transaction submitted
+       by the callback is either queued behind it or started by I2C_XFER_Submit() */
+    if (NULL == pstcHandle->pstcHead) {
+        pstcHandle->pstcTail = NULL;
+        pstcHandle->u8State  = I2C_XFER_ST_IDLE;
+        I2C_IntCmd(pstcHandle->pstcUnit, I2C_XFER_INT, DISABLE);
+        I2C_AckConfig(pstcHandle->pstcUnit, I2C_ACK);
+    } else {
+        I2C_XFER_Begin(pstcHandle);
+    }
+
+    if (NULL != pstcXfer->pfnCallback) {
+        pstcXfer->pfnCallback(pstcXfer, pstcXfer->pvArg);
+    }
+}
+
+/**
+ * @brief  Run the transaction again after a lost arbitration, at once if the bus is
+ *         free, otherwise from the stop interrupt of the master that won it.
+ * @param  [in] pstcHandle              Pointer to a @ref stc_i2c_xfer_handle_t structure.
+ * @retval None
+ * @note   The stop flag is cleared before the bus state is read, a stop of the winner
+ *         in between sets it again and its interrupt restarts the transaction.
+ */
+static void I2C_XFER_Retry(stc_i2c_xfer_handle_t *pstcHandle)
+{
+    CM_I2C_TypeDef *I2Cx = pstcHandle->pstcUnit;
+
+    I2C_ClearStatus(I2Cx, I2C_FLAG_CLR_STOP);
+    pstcHandle->u8Retry++;
+    if (RESET == I2C_GetStatus(I2Cx, I2C_FLAG_BUSY)) {
+        I2C_XFER_Begin(pstcHandle);
+    } else {
+        pstcHandle->u8State = I2C_XFER_ST_ARLO;
+    }
+}
+
+/**
+ * @brief  Request the stop condition which ends the transaction.
+ * @param  [in] pstcHandle              Pointer to a @ref stc_i2c_xfer_handle_t structure.
+ * @param  [in] i32Result               Result of the transaction.
+ * @retval None
+ */
+static void I2C_XFER_Stop(stc_i2c_xfer_handle_t *pstcHandle, int32_t i32Result)
+{
+    I2C_XFER_DmaStop(pstcHandle);
+    pstcHandle->i32Result = i32Result;
+    pstcHandle->u8State   = I2C_XFER_ST_STOP;
+    I2C_ClearStatus(pstcHandle->pstcUnit, I2C_FLAG_CLR_STOP);
+    I2C_GenerateStop(pstcHandle->pstcUnit);
+}
+
+/**
+ * @brief  Handle the end of a written byte.
+ * @param  [in] pstcHandle              Pointer to a @ref stc_i2c_xfer_handle_t structure.
+ * @retval None
+ */
+static void I2C_XFER_TxNext(stc_i2c_xfer_handle_t *pstcHandle)
+{
+    CM_I2C_TypeDef *I2Cx = pstcHandle->pstcUnit;
+    const stc_i2c_xfer_t *pstcXfer = pstcHandle->pstcHead;
+
+    if (pstcHandle->u16Pos < pstcXfer->u16TxLen) {
+        I2C_WriteData(I2Cx, pstcXfer->pu8TxBuf[pstcHandle->u16Pos]);
+        pstcHandle->u16Pos++;
+    } else {
+        I2C_ClearStatus(I2Cx, I2C_FLAG_CLR_TX_CPLT);
+        if (pstcXfer->u16RxLen > 0U) {
+            /* Repeated start for the read segment */
+            pstcHandle->u8Dir   = I2C_DIR_RX;
+            pstcHandle->u16Pos  = 0U;
+            pstcHandle->u8State = I2C_XFER_ST_START;
+            I2C_ClearStatus(I2Cx, I2C_FLAG_CLR_START);
+            I2C_GenerateRestart(I2Cx);
+        } else {
+            I2C_XFER_Stop(pstcHandle, LL_OK);
+        }
+    }
+}
+
+/**
+ * @brief  Handle a received byte, the ACK sequence follows I2C_MasterReceiveDataAndStop().
+ * @param  [in] pstcHandle              Pointer to a @ref stc_i2c_xfer_handle_t structure.
+ * @retval None
+ */
+static void I2C_XFER_RxNext(stc_i2c_xfer_handle_t *pstcHandle)
+{
+    CM_I2C_TypeDef *I2Cx = pstcHandle->pstcUnit;
+    const stc_i2c_xfer_t *pstcXfer = pstcHandle->pstcHead;
+    const uint32_t u32Last = (uint32_t)pstcXfer->u16RxLen - 1UL;
+    const uint32_t u32Pos = pstcHandle->u16Pos;
+
+    if (0UL == READ_REG32_BIT(I2Cx->CR3, I2C_CR3_FACKEN)) {
+        if ((u32Last >= 1UL) && (u32Pos == (u32Last - 1UL))) {
+            I2C_AckConfig(I2Cx, I2C_NACK);
+        }
+    } else {
+        I2C_AckConfig(I2Cx, (u32Pos != u32Last) ? I2C_ACK : I2C_NACK);
+    }
+
+    /* Stop before read last data */
+    if (u32Pos == u32Last) {
+        I2C_XFER_Stop(pstcHandle, LL_OK);
+    }
+    pstcXfer->pu8RxBuf[u32Pos] = I2C_ReadData(I2Cx);
+    pstcHandle->u16Pos++;
+}
+
+/**
+ * @brief  Completion callback of a burst segment, scatters the registers to the requests.
+ * @param  [in] pstcXfer                Pointer to the transaction of the segment.
+ * @param  [in] pvArg                   Pointer to the @ref stc_i2c_burst_seg_t segment.
+ * @retval None
+ */
+static void I2C_XFER_BurstDone(stc_i2c_xfer_t *pstcXfer, void *pvArg)
+{
+    stc_i2c_burst_seg_t *pstcSeg = (stc_i2c_burst_seg_t *)pvArg;
+    stc_i2c_burst_t *pstcBurst = (stc_i2c_burst_t *)pstcSeg->pvBurst;
+    stc_i2c_reg_read_t *pstcFirst = pstcSeg->pstcReq;
+    stc_i2c_reg_read_t *pstcReq = pstcFirst;
+    stc_i2c_reg_read_t *pstcNext;
+    const uint32_t u32ReqNum = pstcSeg->u16ReqNum;
+    uint32_t u32Num = u32ReqNum;
+    uint32_t u32Offset;
+    uint32_t i;
+
+    /* Scattered first, a flush from a callback reuses the segments and the pool */
+    while (u32Num > 0UL) {
+        if (pstcXfer->pu8RxBuf != pstcReq->pu8Buf) {
+            u32Offset = (uint32_t)pstcReq->u8Reg - (uint32_t)pstcSeg->u8Reg;
+            for (i = 0UL; i < pstcReq->u16Len; i++) {
+                pstcReq->pu8Buf[i] = pstcXfer->pu8RxBuf[u32Offset + i];
+            }
+        }
+        pstcReq->i32Result = pstcXfer->i32Result;
+        pstcReq = pstcReq->pstcNext;
+        u32Num--;
+    }
+    pstcBurst->u16Outstanding--;
+
+    pstcReq = pstcFirst;
+    u32Num  = u32ReqNum;
+    while (u32Num > 0UL) {
+        /* The request may be resubmitted from its callback */
+        pstcNext = pstcReq->pstcNext;
+        pstcReq->pstcNext = NULL;
+        if (NULL != pstcReq->pfnCallback) {
+            pstcReq->pfnCallback(pstcReq, pstcReq->pvArg);
+        }
+        pstcReq = pstcNext;
+        u32Num--;
+    }
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup I2C_XFER_Global_Functions I2C_XFER Global Functions
+ * @{
+ */
+
+/**
+ * @brief  Initialize the transaction engine of an I2C unit.
+ * @param  [out] pstcHandle             Pointer to a @ref stc_i2c_xfer_handle_t structure.
+ * @param  [in] I2Cx                    Pointer to I2C instance register base.
+ *                                      This parameter can be a value of the following:
+ *         @arg CM_I2C or CM_I2Cx:      I2C instance register base.
+ * @retval int32_t:
+ *           - LL_OK:                   Initialize success
+ *           - LL_ERR_INVD_PARAM:       pstcHandle is NULL
+ */
+int32_t I2C_XFER_Init(stc_i2c_xfer_handle_t *pstcHandle, CM_I2C_TypeDef *I2Cx)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    DDL_ASSERT(IS_I2C_XFER_UNIT(I2Cx));
+
+    if (NULL != pstcHandle) {
+        I2C_IntCmd(I2Cx, I2C_XFER_INT, DISABLE);
+        pstcHandle->pstcUnit  = I2Cx;
+        pstcHandle->pstcHead  = NULL;
+        pstcHandle->pstcTail  = NULL;
+        pstcHandle->pstcDma   = NULL;
+        pstcHandle->u8State   = I2C_XFER_ST_IDLE;
+        pstcHandle->u8DmaDir  = I2C_XFER_DMA_NONE;
+        pstcHandle->u8Dir     = I2C_DIR_TX;
+        pstcHandle->u16Pos    = 0U;
+        pstcHandle->i32Result    = LL_OK;
+        pstcHandle->u8Retry      = 0U;
+        pstcHandle->u32ArloCount = 0UL;
+        i32Ret = LL_OK;
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Queue a transaction, it is started at once if the engine is idle.
+ * @param  [in] pstcHandle              Pointer to a @ref stc_i2c_xfer_handle_t structure.
+ * @param  [in] pstcXfer                Pointer to a @ref stc_i2c_xfer_t structure.
+ * @retval int32_t:
+ *           - LL_OK:                   Transaction queued
+ *           - LL_ERR_INVD_PARAM:       Invalid parameter
+ */
+int32_t I2C_XFER_Submit(stc_i2c_xfer_handle_t *pstcHandle, stc_i2c_xfer_t *pstcXfer)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+    uint32_t u32Primask;
+
+    if ((NULL != pstcHandle) && (NULL != pstcXfer) && (pstcXfer->u16Addr <= I2C_XFER_7BIT_MAX) &&
+        ((0U == pstcXfer->u16TxLen) || (NULL != pstcXfer->pu8TxBuf)) &&
+        ((0U == pstcXfer->u16RxLen) || (NULL != pstcXfer->pu8RxBuf))) {
+        pstcXfer->pstcNext  = NULL;
+        pstcXfer->i32Result = LL_ERR_BUSY;
+
+        u32Primask = __get_PRIMASK();
+        __disable_irq();
+        if (NULL == pstcHandle->pstcTail) {
+            pstcHandle->pstcHead = pstcXfer;
+            pstcHandle->pstcTail = pstcXfer;
+            I2C_XFER_Begin(pstcHandle);
+        } else {
+            pstcHandle->pstcTail->pstcNext = pstcXfer;
+            pstcHandle->pstcTail = pstcXfer;
+        }
+        __set_PRIMASK(u32Primask);
+        i32Ret = LL_OK;
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Get the busy status of the transaction engine.
+ * @param  [in] pstcHandle              Pointer to a @ref stc_i2c_xfer_handle_t structure.
+ * @retval An @ref en_flag_status_t enumeration type value, SET if a transaction is queued or in progress.
+ */
+en_flag_status_t I2C_XFER_GetBusyStatus(const stc_i2c_xfer_handle_t *pstcHandle)
+{
+    DDL_ASSERT(NULL != pstcHandle);
+
+    return (I2C_XFER_ST_IDLE != pstcHandle->u8State) ? SET : RESET;
+}
+
+/**
+ * @brief  Transaction engine interrupt handler, call it from all the I2C interrupts
+ *         selected by @ref I2C_XFER_Int.
+ * @param  [in] pstcHandle              Pointer to a @ref stc_i2c_xfer_handle_t structure.
+ * @retval None
+ */
+void I2C_XFER_IrqHandler(stc_i2c_xfer_handle_t *pstcHandle)
+{
+    CM_I2C_TypeDef *I2Cx;
+    const stc_i2c_xfer_t *pstcXfer;
+
+    DDL_ASSERT(NULL != pstcHandle);
+
+    I2Cx = pstcHandle->pstcUnit;
+    pstcXfer = pstcHandle->pstcHead;
+    if ((NULL == pstcXfer) || (I2C_XFER_ST_IDLE == pstcHandle->u8State)) {
+        I2C_IntCmd(I2Cx, I2C_XFER_INT, DISABLE);
+    } else if (SET == I2C_GetStatus(I2Cx, I2C_FLAG_ARBITRATE_FAIL)) {
+        /* The unit left master mode, no stop condition is to be generated */
+        I2C_ClearStatus(I2Cx, I2C_FLAG_CLR_ARBITRATE_FAIL);
+        I2C_XFER_DmaStop(pstcHandle);
+        pstcHandle->u32ArloCount++;
+        if (pstcHandle->u8Retry < I2C_XFER_ARLO_RETRY) {
+            /* Run the whole transaction again once the winner has released the bus */
+            I2C_XFER_Retry(pstcHandle);
+        } else {
+            pstcHandle->i32Result = LL_ERR_BUSY;
+            I2C_XFER_Finish(pstcHandle);
+        }
+    } else if (I2C_XFER_ST_ARLO == pstcHandle->u8State) {
+        /* The bus belongs to the winner, a timeout must not be ended by a stop of this unit */
+        if (SET == I2C_GetStatus(I2Cx, I2C_FLAG_TMOUTF)) {
+            I2C_ClearStatus(I2Cx, I2C_FLAG_CLR_TMOUTF);
+            pstcHandle->i32Result = LL_ERR_BUSY;
+            I2C_XFER_Finish(pstcHandle);
+        } else if ((SET == I2C_GetStatus(I2Cx, I2C_FLAG_STOP)) || (RESET == I2C_GetStatus(I2Cx, I2C_FLAG_BUSY))) {
+            I2C_ClearStatus(I2Cx, I2C_FLAG_CLR_STOP);
+            I2C_XFER_Begin(pstcHandle);
+        } else {
+            /* Not the end of the winner's transaction */
+        }
+    } else if (SET == I2C_GetStatus(I2Cx, I2C_FLAG_TMOUTF)) {
+        I2C_ClearStatus(I2Cx, I2C_FLAG_CLR_TMOUTF);
+        I2C_XFER_Stop(pstcHandle, LL_ERR_TIMEOUT);
+    } else if (I2C_XFER_ST_STOP == pstcHandle->u8State) {
+        if (SET == I2C_GetStatus(I2Cx, I2C_FLAG_STOP)) {
+            I2C_ClearStatus(I2Cx, I2C_FLAG_CLR_STOP | I2C_FLAG_CLR_NACK | I2C_FLAG_CLR_TX_CPLT);
+            I2C_XFER_Finish(pstcHandle);
+        }
+    } else if (SET == I2C_GetStatus(I2Cx, I2C_FLAG_NACKF)) {
+        /* Address or data not acknowledged */
+        I2C_ClearStatus(I2Cx, I2C_FLAG_CLR_NACK);
+        I2C_XFER_Stop(pstcHandle, LL_ERR);
+    } else if (I2C_XFER_ST_START == pstcHandle->u8State) {
+        if (SET == I2C_GetStatus(I2Cx, I2C_FLAG_START)) {
+            I2C_ClearStatus(I2Cx, I2C_FLAG_CLR_START);
+            if (I2C_DIR_TX == pstcHandle->u8Dir) {
+                pstcHandle->u8State = I2C_XFER_ST_TX;
+                I2C_WriteData(I2Cx, (uint8_t)(pstcXfer->u16Addr << 1U) | I2C_DIR_TX);
+                if (pstcXfer->u16TxLen >= I2C_XFER_DmaThreshold(pstcHandle)) {
+                    I2C_XFER_DmaStart(pstcHandle, I2C_XFER_DMA_TX);
+                }
+            } else {
+                pstcHandle->u8State = I2C_XFER_ST_RX;
+                if (1U == pstcXfer->u16RxLen) {
+                    /* The only byte is clocked in right after the address, it must not be acknowledged */
+                    I2C_AckConfig(I2Cx, I2C_NACK);
+                }
+                if (pstcXfer->u16RxLen >= I2C_XFER_DmaThreshold(pstcHandle)) {
+                    I2C_XFER_DmaStart(pstcHandle, I2C_XFER_DMA_RX);
+                }
+                I2C_WriteData(I2Cx, (uint8_t)(pstcXfer->u16Addr << 1U) | I2C_DIR_RX);
+            }
+        }
+    } else if (I2C_XFER_DMA_NONE != pstcHandle->u8DmaDir) {
+        /* The payload belongs to the DMA */
+    } else if (I2C_XFER_ST_TX == pstcHandle->u8State) {
+        if (SET == I2C_GetStatus(I2Cx, I2C_FLAG_TX_CPLT)) {
+            I2C_XFER_TxNext(pstcHandle);
+        }
+    } else {
+        if (SET == I2C_GetStatus(I2Cx, I2C_FLAG_RX_FULL)) {
+            I2C_XFER_RxNext(pstcHandle);
+        }
+    }
+}
+
+/**
+ * @brief  Configure the DMA used for large payloads.
+ * @param  [in] pstcHandle              Pointer to a @ref stc_i2c_xfer_handle_t structure.
+ * @param  [in] pstcDma                 Pointer to a @ref stc_i2c_xfer_dma_t structure, it must stay valid
+ *                                      while configured. NULL lets the CPU move all the payloads.
+ * @retval int32_t:
+ *           - LL_OK:                   Configure success
+ *           - LL_ERR_INVD_PARAM:       pstcHandle is NULL
+ *           - LL_ERR_BUSY:             A transaction is queued or in progress
+ * @note   The TC interrupts of both channels must call I2C_XFER_DmaIrqHandler().
+ */
+int32_t I2C_XFER_DmaConfig(stc_i2c_xfer_handle_t *pstcHandle, const stc_i2c_xfer_dma_t *pstcDma)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+    stc_dma_init_t stcDmaInit;
+
+    if (NULL != pstcHandle) {
+        if (I2C_XFER_ST_IDLE != pstcHandle->u8State) {
+            i32Ret = LL_ERR_BUSY;
+        } else if (NULL == pstcDma) {
+            pstcHandle->pstcDma = NULL;
+            i32Ret = LL_OK;
+        } else {
+            DDL_ASSERT(IS_I2C_XFER_DMA_CH(pstcDma->u8TxCh));
+            DDL_ASSERT(IS_I2C_XFER_DMA_CH(pstcDma->u8RxCh));
+            DDL_ASSERT(pstcDma->u8TxCh != pstcDma->u8RxCh);
+
+            (void)DMA_StructInit(&stcDmaInit);
+            stcDmaInit.u32IntEn       = DMA_INT_ENABLE;
+            stcDmaInit.u32DataWidth   = DMA_DATAWIDTH_8BIT;
+            stcDmaInit.u32BlockSize   = 1UL;
+            stcDmaInit.u32TransCount  = 0UL;
+
+            (void)DMA_ChCmd(pstcDma->pstcDmaUnit, pstcDma->u8TxCh, DISABLE);
+            stcDmaInit.u32SrcAddr     = 0UL;
+            stcDmaInit.u32DestAddr    = (uint32_t)&pstcHandle->pstcUnit->DTR;
+            stcDmaInit.u32SrcAddrInc  = DMA_SRC_ADDR_INC;
+            stcDmaInit.u32DestAddrInc = DMA_DEST_ADDR_FIX;
+            (void)DMA_Init(pstcDma->pstcDmaUnit, pstcDma->u8TxCh, &stcDmaInit);
+
+            (void)DMA_ChCmd(pstcDma->pstcDmaUnit, pstcDma->u8RxCh, DISABLE);
+            stcDmaInit.u32SrcAddr     = (uint32_t)&pstcHandle->pstcUnit->DRR;
+            stcDmaInit.u32DestAddr    = 0UL;
+            stcDmaInit.u32SrcAddrInc  = DMA_SRC_ADDR_FIX;
+            stcDmaInit.u32DestAddrInc = DMA_DEST_ADDR_INC;
+            (void)DMA_Init(pstcDma->pstcDmaUnit, pstcDma->u8RxCh, &stcDmaInit);
+
+            DMA_TransCompleteIntCmd(pstcDma->pstcDmaUnit,
+                                    (DMA_INT_TC_CH0 << pstcDma->u8TxCh) | (DMA_INT_TC_CH0 << pstcDma->u8RxCh), ENABLE);
+            AOS_SetTriggerEventSrc(pstcDma->u32TxTrigTarget, pstcDma->enTxEvtSrc);
+            AOS_SetTriggerEventSrc(pstcDma->u32RxTrigTarget, pstcDma->enRxEvtSrc);
+
+            pstcHandle->pstcDma = pstcDma;
+            i32Ret = LL_OK;
+        }
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  DMA transfer complete interrupt handler of the transaction engine.
+ * @param  [in] pstcHandle              Pointer to a @ref stc_i2c_xfer_handle_t structure.
+ * @retval None
+ */
+void I2C_XFER_DmaIrqHandler(stc_i2c_xfer_handle_t *pstcHandle)
+{
+    const stc_i2c_xfer_dma_t *pstcDma;
+    const stc_i2c_xfer_t *pstcXfer;
+
+    DDL_ASSERT(NULL != pstcHandle);
+
+    pstcDma = pstcHandle->pstcDma;
+    pstcXfer = pstcHandle->pstcHead;
+    if (NULL != pstcDma) {
+        if (I2C_XFER_DMA_TX == pstcHandle->u8DmaDir) {
+            if (SET == DMA_GetTransCompleteStatus(pstcDma->pstcDmaUnit, DMA_FLAG_TC_CH0 << pstcDma->u8TxCh)) {
+                /* The TX_CPLT interrupt takes over for the last byte */
+                pstcHandle->u16Pos = pstcXfer->u16TxLen;
+                I2C_XFER_DmaStop(pstcHandle);
+            }
+        } else if (I2C_XFER_DMA_RX == pstcHandle->u8DmaDir) {
+            if (SET == DMA_GetTransCompleteStatus(pstcDma->pstcDmaUnit, DMA_FLAG_TC_CH0 << pstcDma->u8RxCh)) {
+                pstcHandle->u16Pos = pstcXfer->u16RxLen - I2C_XFER_DMA_RX_TAIL;
+                I2C_XFER_DmaStop(pstcHandle);
+            }
+        } else {
+            /* Stale flags of an aborted transfer */
+            DMA_ClearTransCompleteStatus(pstcDma->pstcDmaUnit,
+                                         (DMA_FLAG_TC_CH0 << pstcDma->u8TxCh) | (DMA_FLAG_TC_CH0 << pstcDma->u8RxCh));
+        }
+    }
+}
+
+/**
+ * @brief  Initialize a register read coalescer.
+ * @param  [out] pstcBurst              Pointer to a @ref stc_i2c_burst_t structure.
+ * @param  [in] pstcSeg                 Segment array, one segment per bus transaction of a flush.
+ * @param  [in] u16SegNum               Number of segments.
+ * @param  [in] pu8Pool                 Staging pool of the merged bursts.
+ * @param  [in] u16PoolSize             Size of the staging pool.
+ * @param  [in] u16MaxLen               Maximum burst length.
+ * @param  [in] u8MaxGap                Maximum number of unrequested registers read between two requests.
+ * @retval int32_t:
+ *           - LL_OK:                   Initialize success
+ *           - LL_ERR_INVD_PARAM:       Invalid parameter
+ */
+int32_t I2C_XFER_BurstInit(stc_i2c_burst_t *pstcBurst, stc_i2c_burst_seg_t *pstcSeg, uint16_t u16SegNum,
+                           uint8_t *pu8Pool, uint16_t u16PoolSize, uint16_t u16MaxLen, uint8_t u8MaxGap)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if ((NULL != pstcBurst) && (NULL != pstcSeg) && (u16SegNum > 0U) && (u16MaxLen > 0U) &&
+        ((NULL != pu8Pool) || (0U == u16PoolSize))) {
+        pstcBurst->pstcPending    = NULL;
+        pstcBurst->pstcSeg        = pstcSeg;
+        pstcBurst->u16SegNum      = u16SegNum;
+        pstcBurst->pu8Pool        = pu8Pool;
+        pstcBurst->u16PoolSize    = u16PoolSize;
+        pstcBurst->u16MaxLen      = u16MaxLen;
+        pstcBurst->u8MaxGap       = u8MaxGap;
+        pstcBurst->u16Outstanding = 0U;
+        pstcBurst->u32ReqCount    = 0UL;
+        pstcBurst->u32XferCount   = 0UL;
+        i32Ret = LL_OK;
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Add a register read request to the coalescer, it is issued by the next flush.
+ * @param  [in] pstcBurst               Pointer to a @ref stc_i2c_burst_t structure.
+ * @param  [in] pstcReq                 Pointer to a @ref stc_i2c_reg_read_t structure.
+ * @retval int32_t:
+ *           - LL_OK:                   Request added
+ *           - LL_ERR_INVD_PARAM:       Invalid parameter
+ * @note   Requests are kept sorted by address and register so that a flush merges in one pass.
+ */
+int32_t I2C_XFER_BurstAdd(stc_i2c_burst_t *pstcBurst, stc_i2c_reg_read_t *pstcReq)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+    stc_i2c_reg_read_t **ppstcPos;
+    uint32_t u32Key;
+    uint32_t u32PosKey;
+    uint32_t u32Primask;
+
+    if ((NULL != pstcBurst) && (NULL != pstcReq) && (NULL != pstcReq->pu8Buf) && (pstcReq->u16Len > 0U) &&
+        (pstcReq->u16Addr <= I2C_XFER_7BIT_MAX) && (pstcReq->u16Len <= pstcBurst->u16MaxLen)) {
+        u32Key = ((uint32_t)pstcReq->u16Addr << 8U) | pstcReq->u8Reg;
+
+        /* The request may be added from a completion callback */
+        u32Primask = __get_PRIMASK();
+        __disable_irq();
+        ppstcPos = &pstcBurst->pstcPending;
+        while (NULL != *ppstcPos) {
+            u32PosKey = ((uint32_t)(*ppstcPos)->u16Addr << 8U) | (*ppstcPos)->u8Reg;
+            if (u32PosKey > u32Key) {
+                break;
+            }
+            ppstcPos = &(*ppstcPos)->pstcNext;
+        }
+        pstcReq->pstcNext = *ppstcPos;
+        *ppstcPos = pstcReq;
+        __set_PRIMASK(u32Primask);
+        i32Ret = LL_OK;
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Merge the pending register reads into bursts and queue them on the engine.
+ * @param  [in] pstcHandle              Pointer to a @ref stc_i2c_xfer_handle_t structure.
+ * @param  [in] pstcBurst               Pointer to a @ref stc_i2c_burst_t structure.
+ * @retval int32_t:
+ *           - LL_OK:                   Bursts queued, or nothing pending
+ *           - LL_ERR_INVD_PARAM:       Invalid parameter
+ *           - LL_ERR_BUSY:             The bursts of the previous flush are still on the bus
+ *           - LL_ERR_BUF_FULL:         Not enough segments or staging pool, nothing is queued
+ * @note   A burst serving a single request reads straight into the request buffer.
+ * @note   Interrupts are masked while the pending requests are merged.
+ */
+int32_t I2C_XFER_BurstFlush(stc_i2c_xfer_handle_t *pstcHandle, stc_i2c_burst_t *pstcBurst)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+    stc_i2c_burst_seg_t *pstcSeg;
+    stc_i2c_reg_read_t *pstcReq;
+    stc_i2c_reg_read_t *pstcNext;
+    uint32_t u32SegNum = 0UL;
+    uint32_t u32PoolUsed = 0UL;
+    uint32_t u32ReqNum = 0UL;
+    uint32_t u32Start;
+    uint32_t u32End;
+    uint32_t u32ReqEnd;
+    uint32_t u32Primask;
+    uint32_t i;
+
+    if ((NULL != pstcHandle) && (NULL != pstcBurst)) {
+        i32Ret = LL_OK;
+        /* The pending list is not to change between planning and queuing */
+        u32Primask = __get_PRIMASK();
+        __disable_irq();
+        if (0U != pstcBurst->u16Outstanding) {
+            i32Ret = LL_ERR_BUSY;
+        }
+        /* Plan the bursts */
+        pstcReq = pstcBurst->pstcPending;
+        while ((LL_OK == i32Ret) && (NULL != pstcReq)) {
+            if (u32SegNum >= pstcBurst->u16SegNum) {
+                i32Ret = LL_ERR_BUF_FULL;
+                break;
+            }
+            pstcSeg = &pstcBurst->pstcSeg[u32SegNum];
+            pstcSeg->pstcReq   = pstcReq;
+            pstcSeg->u16ReqNum = 1U;
+            pstcSeg->u8Reg     = pstcReq->u8Reg;
+            u32Start = pstcReq->u8Reg;
+            u32End   = u32Start + pstcReq->u16Len;
+            pstcNext = pstcReq->pstcNext;
+            while ((NULL != pstcNext) && (pstcNext->u16Addr == pstcReq->u16Addr) &&
+                   ((uint32_t)pstcNext->u8Reg <= (u32End + pstcBurst->u8MaxGap))) {
+                u32ReqEnd = (uint32_t)pstcNext->u8Reg + pstcNext->u16Len;
+                if (u32ReqEnd < u32End) {
+                    u32ReqEnd = u32End;
+                }
+                if ((u32ReqEnd - u32Start) > pstcBurst->u16MaxLen) {
+                    break;
+                }
+                u32End = u32ReqEnd;
+                pstcSeg->u16ReqNum++;
+                pstcNext = pstcNext->pstcNext;
+            }
+
+            pstcSeg->stcXfer.u16Addr  = pstcReq->u16Addr;
+            pstcSeg->stcXfer.pu8TxBuf = &pstcSeg->u8Reg;
+            pstcSeg->stcXfer.u16TxLen = 1U;
+            pstcSeg->stcXfer.u16RxLen = (uint16_t)(u32End - u32Start);
+            if (1U == pstcSeg->u16ReqNum) {
+                pstcSeg->stcXfer.pu8RxBuf = pstcReq->pu8Buf;
+            } else if ((u32PoolUsed + (u32End - u32Start)) <= pstcBurst->u16PoolSize) {
+                pstcSeg->stcXfer.pu8RxBuf = &pstcBurst->pu8Pool[u32PoolUsed];
+                u32PoolUsed += u32End - u32Start;
+            } else {
+                i32Ret = LL_ERR_BUF_FULL;
+                break;
+            }
+            pstcSeg->stcXfer.pfnCallback = &I2C_XFER_BurstDone;
+            pstcSeg->stcXfer.pvArg       = pstcSeg;
+            pstcSeg->pvBurst             = pstcBurst;
+            u32ReqNum += pstcSeg->u16ReqNum;
+            u32SegNum++;
+            pstcReq = pstcNext;
+        }
+
+        if ((LL_OK == i32Ret) && (u32SegNum > 0UL)) {
+            pstcBurst->pstcPending    = NULL;
+            pstcBurst->u16Outstanding = (uint16_t)u32SegNum;
+            pstcBurst->u32ReqCount   += u32ReqNum;
+            pstcBurst->u32XferCount  += u32SegNum;
+            for (i = 0UL; i < u32SegNum; i++) {
+                (void)I2C_XFER_Submit(pstcHandle, &pstcBurst->pstcSeg[i].stcXfer);
+            }
+        }
+        __set_PRIMASK(u32Primask);
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @}
+ */
+
+#endif /* LL_I2C_XFER_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/******************************************************************************
+ * EOF (not truncated)
+ *****************************************************************************/
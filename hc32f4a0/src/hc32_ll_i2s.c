@@ -11,6 +11,7 @@
    2024-06-30       CDT             Optimize calculate for I2SDIV and ODD in MCK enabled mode
    2024-08-31       CDT             Optimize I2S_DeInit()
                                     Delete needless set data in I2S_Init function
+   2026-10-19       CDT             Get the PCLK1 frequency from the CLK cache
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2022-2025, Xiaohua Semiconductor Co., Ltd. All rights reserved.
@@ -27,6 +28,7 @@
  * Include files
  ******************************************************************************/
 #include "hc32_ll_i2s.h"
+#include "hc32_ll_clk.h"
 #include "hc32_ll_utility.h"
 
 /**
@@ -66,10 +68,6 @@
 
 #define I2S_CMU_PLLXCFGR                PLLACFGR
 
-#define I2S_CMU_SCFGR                   SCFGR
-#define I2S_CMU_SCFGR_PCLK              CMU_SCFGR_PCLK1S
-#define I2S_CMU_SCFGR_PCLK_POS          CMU_SCFGR_PCLK1S_POS
-
 #define I2S_CMU_PLLCFGR_PLLM            CMU_PLLHCFGR_PLLHM
 #define I2S_CMU_PLLCFGR_PLLM_POS        CMU_PLLHCFGR_PLLHM_POS
 #define I2S_CMU_PLLCFGR_PLLN            CMU_PLLHCFGR_PLLHN
@@ -249,8 +247,7 @@ static uint32_t I2S_GetClockFreq(const CM_I2S_TypeDef *I2Sx)
     /* Calculate the clock frequency */
     switch (u16ClockSrc) {
         case I2S_CLK_SRC_PCLK:
-            u32ClockFreq = SystemCoreClock >> ((READ_REG32_BIT(CM_CMU->I2S_CMU_SCFGR,
-                                                               I2S_CMU_SCFGR_PCLK) >> I2S_CMU_SCFGR_PCLK_POS));
+            u32ClockFreq = CLK_GetBusClockFreq(CLK_BUS_PCLK1);
             break;
         case I2S_CLK_SRC_PLLQ:
             u32Temp = READ_REG32(CM_CMU->I2S_CMU_PLLCFGR);
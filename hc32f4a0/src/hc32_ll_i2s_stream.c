@@ -0,0 +1,568 @@
+/**
+ *******************************************************************************
+ * @file  hc32_ll_i2s_stream.c
+ * @brief This file provides firmware functions to manage the I2S DMA streaming.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       CDT             First version
+                                    Checked the DMA trigger targets and event sources in I2S_STREAM_Init()
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2025, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ll_i2s_stream.h"
+#include "hc32_ll_i2s.h"
+#include "hc32_ll_aos.h"
+#include "hc32_ll_utility.h"
+
+/**
+ * @addtogroup LL_Driver
+ * @{
+ */
+
+/**
+ * @defgroup LL_I2S_STREAM I2S_STREAM
+ * @brief I2S DMA Streaming Driver Library
+ * @note  Each direction runs one DMA channel over a two-descriptor linked list, one descriptor
+ *        per half buffer, paced by the I2S TXI/RXI events through AOS. The DMA transfer complete
+ *        interrupt reports the half which has just been played or recorded, while the DMA goes on
+ *        with the other half. The I2S unit must be initialized by I2S_Init() before starting.
+ * @{
+ */
+
+#if (LL_I2S_STREAM_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup I2S_STREAM_Local_Macros I2S_STREAM Local Macros
+ * @{
+ */
+#define I2S_STREAM_HALF_MAX             (0xFFFFUL)
+
+/* DMA channel control of the linked list descriptors */
+#define I2S_STREAM_DMA_CHCTL_COMMON     (DMA_DATAWIDTH_32BIT | DMA_LLP_ENABLE | DMA_LLP_WAIT | DMA_INT_ENABLE)
+#define I2S_STREAM_DMA_CHCTL_TX         (I2S_STREAM_DMA_CHCTL_COMMON | DMA_SRC_ADDR_INC | DMA_DEST_ADDR_FIX)
+#define I2S_STREAM_DMA_CHCTL_RX         (I2S_STREAM_DMA_CHCTL_COMMON | DMA_SRC_ADDR_FIX | DMA_DEST_ADDR_INC)
+
+/**
+ * @defgroup I2S_STREAM_Check_Parameters_Validity I2S_STREAM Check Parameters Validity
+ * @{
+ */
+#define IS_I2S_STREAM_UNIT(x)                                                  \
+(   ((x) == CM_I2S1)                        ||                                 \
+    ((x) == CM_I2S2)                        ||                                 \
+    ((x) == CM_I2S3)                        ||                                 \
+    ((x) == CM_I2S4))
+
+#define IS_I2S_STREAM_DATA_WIDTH(x)                                            \
+(   ((x) == I2S_DATA_LEN_16BIT)             ||                                 \
+    ((x) == I2S_DATA_LEN_24BIT)             ||                                 \
+    ((x) == I2S_DATA_LEN_32BIT))
+
+#define IS_I2S_STREAM_DIR(dir)                                                 \
+(   ((dir)->pu32Buf == NULL)                ||                                 \
+    (((dir)->u8DmaCh <= DMA_CH7)            &&                                 \
+     ((dir)->u32Len >= 2UL)                 &&                                 \
+     (((dir)->u32Len & 1UL) == 0UL)         &&                                 \
+     (((dir)->u32Len / 2UL) <= I2S_STREAM_HALF_MAX)))
+
+#define IS_I2S_STREAM_DMA_TARGET(unit, ch, target)                             \
+(   ((target) == ((((unit) == CM_DMA1) ? AOS_DMA1_0 : AOS_DMA2_0) + ((uint32_t)(ch) * 4UL))))
+
+#define IS_I2S_STREAM_TXI_EVT(i2s, evt)                                        \
+(   (((i2s) == CM_I2S1) && ((evt) == EVT_SRC_I2S1_TXIRQOUT))                ||  \
+    (((i2s) == CM_I2S2) && ((evt) == EVT_SRC_I2S2_TXIRQOUT))                ||  \
+    (((i2s) == CM_I2S3) && ((evt) == EVT_SRC_I2S3_TXIRQOUT))                ||  \
+    (((i2s) == CM_I2S4) && ((evt) == EVT_SRC_I2S4_TXIRQOUT)))
+
+#define IS_I2S_STREAM_RXI_EVT(i2s, evt)                                        \
+(   (((i2s) == CM_I2S1) && ((evt) == EVT_SRC_I2S1_RXIRQOUT))                ||  \
+    (((i2s) == CM_I2S2) && ((evt) == EVT_SRC_I2S2_RXIRQOUT))                ||  \
+    (((i2s) == CM_I2S3) && ((evt) == EVT_SRC_I2S3_RXIRQOUT))                ||  \
+    (((i2s) == CM_I2S4) && ((evt) == EVT_SRC_I2S4_RXIRQOUT)))
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @defgroup I2S_STREAM_Local_Functions I2S_STREAM Local Functions
+ * @{
+ */
+
+/**
+ * @brief  Build the two descriptors of one direction, each one links to the other.
+ * @param  [in] pstcDir                 Pointer to a @ref stc_i2s_stream_dir_t structure.
+ * @param  [out] pstcDesc               Pointer to the two descriptors.
+ * @param  [in] u32FifoAddr             Address of TXBUF or RXBUF.
+ * @param  [in] u32ChCtl                Channel control of the descriptors.
+ * @retval None
+ */
+static void I2S_STREAM_DescInit(const stc_i2s_stream_dir_t *pstcDir, stc_dma_llp_descriptor_t *pstcDesc,
+                                uint32_t u32FifoAddr, uint32_t u32ChCtl)
+{
+    const uint32_t u32Half = pstcDir->u32Len / 2UL;
+    uint32_t u32BufAddr;
+    uint32_t i;
+
+    for (i = 0UL; i < 2UL; i++) {
+        u32BufAddr = (uint32_t)&pstcDir->pu32Buf[i * u32Half];
+        if (I2S_STREAM_DMA_CHCTL_TX == u32ChCtl) {
+            pstcDesc[i].SARx = u32BufAddr;
+            pstcDesc[i].DARx = u32FifoAddr;
+        } else {
+            pstcDesc[i].SARx = u32FifoAddr;
+            pstcDesc[i].DARx = u32BufAddr;
+        }
+        pstcDesc[i].DTCTLx    = (u32Half << DMA_DTCTL_CNT_POS) | 1UL;
+        pstcDesc[i].RPTx      = 0UL;
+        pstcDesc[i].SNSEQCTLx = 0UL;
+        pstcDesc[i].DNSEQCTLx = 0UL;
+        pstcDesc[i].LLPx      = (uint32_t)&pstcDesc[1UL - i];
+        pstcDesc[i].CHCTLx    = u32ChCtl;
+    }
+}
+
+/**
+ * @brief  Load the first descriptor of one direction into its channel and enable it.
+ * @param  [in] DMAx                    DMA unit.
+ * @param  [in] pstcDir                 Pointer to a @ref stc_i2s_stream_dir_t structure.
+ * @param  [in] pstcDesc                Pointer to the two descriptors.
+ * @retval None
+ */
+static void I2S_STREAM_DmaArm(CM_DMA_TypeDef *DMAx, const stc_i2s_stream_dir_t *pstcDir,
+                              const stc_dma_llp_descriptor_t *pstcDesc)
+{
+    stc_dma_init_t stcDmaInit;
+    stc_dma_llp_init_t stcLlpInit;
+
+    (void)DMA_StructInit(&stcDmaInit);
+    stcDmaInit.u32IntEn       = DMA_INT_ENABLE;
+    stcDmaInit.u32SrcAddr     = pstcDesc[0].SARx;
+    stcDmaInit.u32DestAddr    = pstcDesc[0].DARx;
+    stcDmaInit.u32DataWidth   = DMA_DATAWIDTH_32BIT;
+    stcDmaInit.u32BlockSize   = 1UL;
+    stcDmaInit.u32TransCount  = pstcDir->u32Len / 2UL;
+    stcDmaInit.u32SrcAddrInc  = pstcDesc[0].CHCTLx & DMA_CHCTL_SINC;
+    stcDmaInit.u32DestAddrInc = pstcDesc[0].CHCTLx & DMA_CHCTL_DINC;
+    (void)DMA_Init(DMAx, pstcDir->u8DmaCh, &stcDmaInit);
+
+    (void)DMA_LlpStructInit(&stcLlpInit);
+    stcLlpInit.u32State = DMA_LLP_ENABLE;
+    stcLlpInit.u32Mode  = DMA_LLP_WAIT;
+    stcLlpInit.u32Addr  = (uint32_t)&pstcDesc[1];
+    (void)DMA_LlpInit(DMAx, pstcDir->u8DmaCh, &stcLlpInit);
+
+    DMA_ClearTransCompleteStatus(DMAx, DMA_FLAG_TC_CH0 << pstcDir->u8DmaCh);
+    DMA_TransCompleteIntCmd(DMAx, DMA_INT_TC_CH0 << pstcDir->u8DmaCh, ENABLE);
+    (void)DMA_ChCmd(DMAx, pstcDir->u8DmaCh, ENABLE);
+}
+
+/**
+ * @brief  Stop the I2S functions and the DMA channels.
+ * @param  [in] pstcStream              Pointer to a @ref stc_i2s_stream_t structure.
+ * @retval None
+ */
+static void I2S_STREAM_Halt(stc_i2s_stream_t *pstcStream)
+{
+    I2S_FuncCmd(pstcStream->pstcUnit, I2S_FUNC_ALL, DISABLE);
+    I2S_IntCmd(pstcStream->pstcUnit, I2S_INT_ALL, DISABLE);
+    if (NULL != pstcStream->stcTx.pu32Buf) {
+        (void)DMA_ChCmd(pstcStream->pstcDmaUnit, pstcStream->stcTx.u8DmaCh, DISABLE);
+        DMA_ClearTransCompleteStatus(pstcStream->pstcDmaUnit, DMA_FLAG_TC_CH0 << pstcStream->stcTx.u8DmaCh);
+    }
+    if (NULL != pstcStream->stcRx.pu32Buf) {
+        (void)DMA_ChCmd(pstcStream->pstcDmaUnit, pstcStream->stcRx.u8DmaCh, DISABLE);
+        DMA_ClearTransCompleteStatus(pstcStream->pstcDmaUnit, DMA_FLAG_TC_CH0 << pstcStream->stcRx.u8DmaCh);
+    }
+}
+
+/**
+ * @brief  Start the stream from the first half of the buffers.
+ * @param  [in] pstcStream              Pointer to a @ref stc_i2s_stream_t structure.
+ * @retval None
+ * @note   Both transmit halves are filled by the callback before the I2S starts.
+ */
+static void I2S_STREAM_Launch(stc_i2s_stream_t *pstcStream)
+{
+    CM_I2S_TypeDef *I2Sx = pstcStream->pstcUnit;
+    const stc_i2s_stream_dir_t *pstcTx = &pstcStream->stcTx;
+    const uint32_t u32Half = pstcTx->u32Len / 2UL;
+    uint32_t u32Func = 0UL;
+    uint32_t u32Int = I2S_INT_ERR;
+
+    I2S_SWReset(I2Sx, I2S_RST_TYPE_FIFO);
+    I2S_ClearStatus(I2Sx, I2S_FLAG_CLR_ALL);
+
+    if (NULL != pstcTx->pu32Buf) {
+        if (NULL != pstcStream->pfnCallback) {
+            pstcStream->pfnCallback(pstcStream, I2S_STREAM_EVT_TX_HALF, &pstcTx->pu32Buf[0], u32Half,
+                                    pstcStream->pvArg);
+            pstcStream->pfnCallback(pstcStream, I2S_STREAM_EVT_TX_HALF, &pstcTx->pu32Buf[u32Half], u32Half,
+                                    pstcStream->pvArg);
+        }
+        I2S_STREAM_DmaArm(pstcStream->pstcDmaUnit, pstcTx, pstcStream->astcTxDesc);
+        u32Func |= I2S_FUNC_TX;
+        u32Int  |= I2S_INT_TX;
+    }
+    if (NULL != pstcStream->stcRx.pu32Buf) {
+        I2S_STREAM_DmaArm(pstcStream->pstcDmaUnit, &pstcStream->stcRx, pstcStream->astcRxDesc);
+        u32Func |= I2S_FUNC_RX;
+        u32Int  |= I2S_INT_RX;
+    }
+
+    /* The TXI and RXI interrupts are the DMA requests */
+    I2S_IntCmd(I2Sx, u32Int, ENABLE);
+    I2S_FuncCmd(I2Sx, u32Func, ENABLE);
+}
+
+/**
+ * @brief  Report the half completed by one direction.
+ * @param  [in] pstcStream              Pointer to a @ref stc_i2s_stream_t structure.
+ * @param  [in] pstcDir                 Pointer to a @ref stc_i2s_stream_dir_t structure.
+ * @param  [in] u32Event                @ref I2S_STREAM_EVT_TX_HALF or @ref I2S_STREAM_EVT_RX_HALF.
+ * @param  [in] u32CurAddr              Current buffer address of the DMA channel.
+ * @retval None
+ * @note   The DMA has already loaded the next descriptor, so the completed half is the one
+ *         which does not hold the current address.
+ */
+static void I2S_STREAM_HalfDone(stc_i2s_stream_t *pstcStream, const stc_i2s_stream_dir_t *pstcDir,
+                                uint32_t u32Event, uint32_t u32CurAddr)
+{
+    const uint32_t u32Half = pstcDir->u32Len / 2UL;
+    uint32_t *pu32Done = &pstcDir->pu32Buf[0];
+
+    if (u32CurAddr < (uint32_t)&pstcDir->pu32Buf[u32Half]) {
+        pu32Done = &pstcDir->pu32Buf[u32Half];
+    }
+    if (NULL != pstcStream->pfnCallback) {
+        pstcStream->pfnCallback(pstcStream, u32Event, pu32Done, u32Half, pstcStream->pvArg);
+    }
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup I2S_STREAM_Global_Functions I2S_STREAM Global Functions
+ * @{
+ */
+
+/**
+ * @brief  Set each @ref stc_i2s_stream_init_t field to default value.
+ * @param  [out] pstcStreamInit         Pointer to a @ref stc_i2s_stream_init_t structure.
+ * @retval int32_t:
+ *           - LL_OK:                   Initialize success
+ *           - LL_ERR_INVD_PARAM:       pstcStreamInit is NULL
+ */
+int32_t I2S_STREAM_StructInit(stc_i2s_stream_init_t *pstcStreamInit)
+{
+    int32_t i32Ret = LL_OK;
+
+    if (NULL == pstcStreamInit) {
+        i32Ret = LL_ERR_INVD_PARAM;
+    } else {
+        pstcStreamInit->pstcDmaUnit         = NULL;
+        pstcStreamInit->stcTx.pu32Buf       = NULL;
+        pstcStreamInit->stcTx.u32Len        = 0UL;
+        pstcStreamInit->stcTx.u8DmaCh       = DMA_CH0;
+        pstcStreamInit->stcTx.u32TrigTarget = AOS_DMA1_0;
+        pstcStreamInit->stcTx.enEvtSrc      = EVT_SRC_I2S1_TXIRQOUT;
+        pstcStreamInit->stcRx.pu32Buf       = NULL;
+        pstcStreamInit->stcRx.u32Len        = 0UL;
+        pstcStreamInit->stcRx.u8DmaCh       = DMA_CH1;
+        pstcStreamInit->stcRx.u32TrigTarget = AOS_DMA1_1;
+        pstcStreamInit->stcRx.enEvtSrc      = EVT_SRC_I2S1_RXIRQOUT;
+        pstcStreamInit->pfnCallback         = NULL;
+        pstcStreamInit->pvArg               = NULL;
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Initialize an I2S stream.
+ * @param  [out] pstcStream             Pointer to a @ref stc_i2s_stream_t structure.
+ * @param  [in] I2Sx                    Pointer to I2S unit instance
+ *         This parameter can be one of the following values:
+ *           @arg CM_I2Sx:              I2S unit instance
+ * @param  [in] pstcStreamInit          Pointer to a @ref stc_i2s_stream_init_t structure.
+ * @retval int32_t:
+ *           - LL_OK:                   Initialize success
+ *           - LL_ERR_INVD_PARAM:       Invalid parameter, or the u32TrigTarget of a direction is not the
+ *                                      target of its u8DmaCh, or its enEvtSrc is not the TXI/RXI event of I2Sx
+ * @note   Set the buffer of a direction to NULL to leave it unused. Both used for full duplex,
+ *         in which case the I2S unit must be in @ref I2S_TRANS_MD_FULL_DUPLEX mode.
+ */
+int32_t I2S_STREAM_Init(stc_i2s_stream_t *pstcStream, CM_I2S_TypeDef *I2Sx,
+                        const stc_i2s_stream_init_t *pstcStreamInit)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    DDL_ASSERT(IS_I2S_STREAM_UNIT(I2Sx));
+
+    if ((NULL != pstcStream) && (NULL != pstcStreamInit) && (NULL != pstcStreamInit->pstcDmaUnit) &&
+        ((NULL != pstcStreamInit->stcTx.pu32Buf) || (NULL != pstcStreamInit->stcRx.pu32Buf)) &&
+        IS_I2S_STREAM_DIR(&pstcStreamInit->stcTx) && IS_I2S_STREAM_DIR(&pstcStreamInit->stcRx) &&
+        ((NULL == pstcStreamInit->stcTx.pu32Buf) ||
+         (IS_I2S_STREAM_DMA_TARGET(pstcStreamInit->pstcDmaUnit, pstcStreamInit->stcTx.u8DmaCh,
+                                   pstcStreamInit->stcTx.u32TrigTarget) &&
+          IS_I2S_STREAM_TXI_EVT(I2Sx, pstcStreamInit->stcTx.enEvtSrc))) &&
+        ((NULL == pstcStreamInit->stcRx.pu32Buf) ||
+         (IS_I2S_STREAM_DMA_TARGET(pstcStreamInit->pstcDmaUnit, pstcStreamInit->stcRx.u8DmaCh,
+                                   pstcStreamInit->stcRx.u32TrigTarget) &&
+          IS_I2S_STREAM_RXI_EVT(I2Sx, pstcStreamInit->stcRx.enEvtSrc)))) {
+        DDL_ASSERT((NULL == pstcStreamInit->stcTx.pu32Buf) || (NULL == pstcStreamInit->stcRx.pu32Buf) ||
+                   (pstcStreamInit->stcTx.u8DmaCh != pstcStreamInit->stcRx.u8DmaCh));
+
+        pstcStream->pstcUnit         = I2Sx;
+        pstcStream->pstcDmaUnit      = pstcStreamInit->pstcDmaUnit;
+        pstcStream->stcTx            = pstcStreamInit->stcTx;
+        pstcStream->stcRx            = pstcStreamInit->stcRx;
+        pstcStream->pfnCallback      = pstcStreamInit->pfnCallback;
+        pstcStream->pvArg            = pstcStreamInit->pvArg;
+        pstcStream->u8Running        = 0U;
+        pstcStream->u32UnderrunCount = 0UL;
+        pstcStream->u32OverrunCount  = 0UL;
+
+        if (NULL != pstcStream->stcTx.pu32Buf) {
+            I2S_STREAM_DescInit(&pstcStream->stcTx, pstcStream->astcTxDesc,
+                                (uint32_t)&I2Sx->TXBUF, I2S_STREAM_DMA_CHCTL_TX);
+            AOS_SetTriggerEventSrc(pstcStream->stcTx.u32TrigTarget, pstcStream->stcTx.enEvtSrc);
+        }
+        if (NULL != pstcStream->stcRx.pu32Buf) {
+            I2S_STREAM_DescInit(&pstcStream->stcRx, pstcStream->astcRxDesc,
+                                (uint32_t)&I2Sx->RXBUF, I2S_STREAM_DMA_CHCTL_RX);
+            AOS_SetTriggerEventSrc(pstcStream->stcRx.u32TrigTarget, pstcStream->stcRx.enEvtSrc);
+        }
+        i32Ret = LL_OK;
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Start an I2S stream.
+ * @param  [in] pstcStream              Pointer to a @ref stc_i2s_stream_t structure.
+ * @retval int32_t:
+ *           - LL_OK:                   Stream started
+ *           - LL_ERR_INVD_PARAM:       pstcStream is NULL
+ *           - LL_ERR_BUSY:             Stream already running
+ */
+int32_t I2S_STREAM_Start(stc_i2s_stream_t *pstcStream)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if (NULL != pstcStream) {
+        if (0U != pstcStream->u8Running) {
+            i32Ret = LL_ERR_BUSY;
+        } else {
+            I2S_STREAM_Halt(pstcStream);
+            pstcStream->u8Running = 1U;
+            I2S_STREAM_Launch(pstcStream);
+            i32Ret = LL_OK;
+        }
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Stop an I2S stream.
+ * @param  [in] pstcStream              Pointer to a @ref stc_i2s_stream_t structure.
+ * @retval None
+ */
+void I2S_STREAM_Stop(stc_i2s_stream_t *pstcStream)
+{
+    DDL_ASSERT(NULL != pstcStream);
+
+    pstcStream->u8Running = 0U;
+    I2S_STREAM_Halt(pstcStream);
+}
+
+/**
+ * @brief  DMA transfer complete interrupt handler of an I2S stream, call it from the
+ *         TC interrupts of both channels.
+ * @param  [in] pstcStream              Pointer to a @ref stc_i2s_stream_t structure.
+ * @retval None
+ */
+void I2S_STREAM_DmaIrqHandler(stc_i2s_stream_t *pstcStream)
+{
+    CM_DMA_TypeDef *DMAx;
+    uint32_t u32Flag;
+
+    DDL_ASSERT(NULL != pstcStream);
+
+    DMAx = pstcStream->pstcDmaUnit;
+    if (NULL != pstcStream->stcTx.pu32Buf) {
+        u32Flag = DMA_FLAG_TC_CH0 << pstcStream->stcTx.u8DmaCh;
+        if (SET == DMA_GetTransCompleteStatus(DMAx, u32Flag)) {
+            DMA_ClearTransCompleteStatus(DMAx, u32Flag);
+            if (0U != pstcStream->u8Running) {
+                I2S_STREAM_HalfDone(pstcStream, &pstcStream->stcTx, I2S_STREAM_EVT_TX_HALF,
+                                    DMA_GetSrcAddr(DMAx, pstcStream->stcTx.u8DmaCh));
+            }
+        }
+    }
+    if (NULL != pstcStream->stcRx.pu32Buf) {
+        u32Flag = DMA_FLAG_TC_CH0 << pstcStream->stcRx.u8DmaCh;
+        if (SET == DMA_GetTransCompleteStatus(DMAx, u32Flag)) {
+            DMA_ClearTransCompleteStatus(DMAx, u32Flag);
+            if (0U != pstcStream->u8Running) {
+                I2S_STREAM_HalfDone(pstcStream, &pstcStream->stcRx, I2S_STREAM_EVT_RX_HALF,
+                                    DMA_GetDestAddr(DMAx, pstcStream->stcRx.u8DmaCh));
+            }
+        }
+    }
+}
+
+/**
+ * @brief  I2S error interrupt handler of an I2S stream.
+ * @param  [in] pstcStream              Pointer to a @ref stc_i2s_stream_t structure.
+ * @retval None
+ * @note   A transmit underrun or receive overrun leaves the FIFO out of step with the
+ *         left/right slots, the stream is reported and restarted from the first half.
+ */
+void I2S_STREAM_ErrIrqHandler(stc_i2s_stream_t *pstcStream)
+{
+    uint32_t u32Event = 0UL;
+
+    DDL_ASSERT(NULL != pstcStream);
+
+    if (SET == I2S_GetStatus(pstcStream->pstcUnit, I2S_FLAG_TX_ERR)) {
+        pstcStream->u32UnderrunCount++;
+        u32Event |= I2S_STREAM_EVT_TX_UNDERRUN;
+    }
+    if (SET == I2S_GetStatus(pstcStream->pstcUnit, I2S_FLAG_RX_ERR)) {
+        pstcStream->u32OverrunCount++;
+        u32Event |= I2S_STREAM_EVT_RX_OVERRUN;
+    }
+    I2S_ClearStatus(pstcStream->pstcUnit, I2S_FLAG_CLR_ALL);
+
+    if ((0UL != u32Event) && (0U != pstcStream->u8Running)) {
+        I2S_STREAM_Halt(pstcStream);
+        if (NULL != pstcStream->pfnCallback) {
+            pstcStream->pfnCallback(pstcStream, u32Event, NULL, 0UL, pstcStream->pvArg);
+        }
+        /* The callback may have stopped the stream */
+        if (0U != pstcStream->u8Running) {
+            I2S_STREAM_Launch(pstcStream);
+        }
+    }
+}
+
+/**
+ * @brief  Convert 16-bit PCM samples to transmit slots.
+ * @param  [out] pu32Slot               Slots, typically the half buffer of the TX_HALF event.
+ * @param  [in] pi16Pcm                 PCM samples.
+ * @param  [in] u32Len                  Number of samples.
+ * @param  [in] u32DataWidth            Data length of the I2S unit, a value of @ref I2S_Data_Length.
+ * @retval None
+ */
+void I2S_STREAM_Pack16(uint32_t *pu32Slot, const int16_t *pi16Pcm, uint32_t u32Len, uint32_t u32DataWidth)
+{
+    uint32_t i;
+
+    DDL_ASSERT((NULL != pu32Slot) && (NULL != pi16Pcm));
+    DDL_ASSERT(IS_I2S_STREAM_DATA_WIDTH(u32DataWidth));
+
+    if (I2S_DATA_LEN_16BIT == u32DataWidth) {
+        for (i = 0UL; i < u32Len; i++) {
+            pu32Slot[i] = (uint32_t)(uint16_t)pi16Pcm[i];
+        }
+    } else if (I2S_DATA_LEN_24BIT == u32DataWidth) {
+        for (i = 0UL; i < u32Len; i++) {
+            pu32Slot[i] = ((uint32_t)(uint16_t)pi16Pcm[i] << 8U);
+        }
+    } else {
+        for (i = 0UL; i < u32Len; i++) {
+            pu32Slot[i] = ((uint32_t)(uint16_t)pi16Pcm[i] << 16U);
+        }
+    }
+}
+
+/**
+ * @brief  Convert receive slots to 16-bit PCM samples.
+ * @param  [out] pi16Pcm                PCM samples.
+ * @param  [in] pu32Slot                Slots, typically the half buffer of the RX_HALF event.
+ * @param  [in] u32Len                  Number of samples.
+ * @param  [in] u32DataWidth            Data length of the I2S unit, a value of @ref I2S_Data_Length.
+ * @retval None
+ * @note   The 24-bit and 32-bit samples are truncated to their 16 most significant bits.
+ */
+void I2S_STREAM_Unpack16(int16_t *pi16Pcm, const uint32_t *pu32Slot, uint32_t u32Len, uint32_t u32DataWidth)
+{
+    uint32_t i;
+
+    DDL_ASSERT((NULL != pu32Slot) && (NULL != pi16Pcm));
+    DDL_ASSERT(IS_I2S_STREAM_DATA_WIDTH(u32DataWidth));
+
+    if (I2S_DATA_LEN_16BIT == u32DataWidth) {
+        for (i = 0UL; i < u32Len; i++) {
+            pi16Pcm[i] = (int16_t)(uint16_t)pu32Slot[i];
+        }
+    } else if (I2S_DATA_LEN_24BIT == u32DataWidth) {
+        for (i = 0UL; i < u32Len; i++) {
+            pi16Pcm[i] = (int16_t)(uint16_t)(pu32Slot[i] >> 8U);
+        }
+    } else {
+        for (i = 0UL; i < u32Len; i++) {
+            pi16Pcm[i] = (int16_t)(uint16_t)(pu32Slot[i] >> 16U);
+        }
+    }
+}
+
+/**
+ * @}
+ */
+
+#endif /* LL_I2S_STREAM_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/******************************************************************************
+ * EOF (not truncated)
+ *****************************************************************************/
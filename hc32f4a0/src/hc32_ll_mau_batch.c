@@ -0,0 +1,540 @@
+/**
+ *******************************************************************************
+ * @file  hc32_ll_mau_batch.c
+ * @brief This file provides firmware functions to run the MAU on arrays.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       CDT             First version
+                                    Q16 sine table for the software sine, describe what the batch calls overlap
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2025, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ll_mau_batch.h"
+#include "hc32_ll_mau.h"
+#include "hc32_ll_utility.h"
+
+/**
+ * @addtogroup LL_Driver
+ * @{
+ */
+
+/**
+ * @defgroup LL_MAU_BATCH MAU_BATCH
+ * @brief MAU Batch Driver Library
+ * @note  The batch functions run the MAU on arrays without a call per element. A sine is the
+ *        same write, NOP and read as MAU_Sin(), nothing overlaps it. While the MAU computes a
+ *        root, the sqrt only fetches the next radicand from memory, the polar conversion also
+ *        computes the angle of the current vector and the squared magnitude of the next one;
+ *        the MAU itself runs one root at a time. Passing NULL as MAU unit runs
+ *        the software functions instead, with the same angle indexes and Q15 results: a sine
+ *        table with linear interpolation and a rounding integer square root. The software
+ *        functions do not touch any register and may be built on the host.
+ * @{
+ */
+
+#if (LL_MAU_BATCH_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup MAU_BATCH_Local_Macros MAU_BATCH Local Macros
+ * @{
+ */
+/* Quarter sine table: 256 steps, 4 angle indexes per step */
+#define MAU_BATCH_SIN_TBL_STEPS         (256U)
+#define MAU_BATCH_SIN_TBL_SHIFT         (2U)
+#define MAU_BATCH_SIN_TBL_FRAC          (3U)
+#define MAU_BATCH_SIN_Q15_MAX           (32767UL)
+
+/* Octant arctangent table: 128 steps of tan, angle indexes in Q4 */
+#define MAU_BATCH_ATAN_TBL_STEPS        (128UL)
+#define MAU_BATCH_ATAN_RATIO_SHIFT      (16U)
+#define MAU_BATCH_ATAN_STEP_SHIFT       (9U)
+#define MAU_BATCH_ATAN_FRAC_MASK        (0x1FFUL)
+#define MAU_BATCH_ATAN_Q                (4U)
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+/* sin(k * 90 / 256 degrees) in Q16, saturated at 65535 */
+static const uint16_t m_au16SinTbl[MAU_BATCH_SIN_TBL_STEPS + 1U] = {
+    0, 402, 804, 1206, 1608, 2010, 2412, 2814, 3216, 3617, 4019, 4420,
+    4821, 5222, 5623, 6023, 6424, 6824, 7224, 7623, 8022, 8421, 8820, 9218,
+    9616, 10014, 10411, 10808, 11204, 11600, 11996, 12391, 12785, 13180, 13573, 13966,
+    14359, 14751, 15143, 15534, 15924, 16314, 16703, 17091, 17479, 17867, 18253, 18639,
+    19024, 19409, 19792, 20175, 20557, 20939, 21320, 21699, 22078, 22457, 22834, 23210,
+    23586, 23961, 24335, 24708, 25080, 25451, 25821, 26190, 26558, 26925, 27291, 27656,
+    28020, 28383, 28745, 29106, 29466, 29824, 30182, 30538, 30893, 31248, 31600, 31952,
+    32303, 32652, 33000, 33347, 33692, 34037, 34380, 34721, 35062, 35401, 35738, 36075,
+    36410, 36744, 37076, 37407, 37736, 38064, 38391, 38716, 39040, 39362, 39683, 40002,
+    40320, 40636, 40951, 41264, 41576, 41886, 42194, 42501, 42806, 43110, 43412, 43713,
+    44011, 44308, 44604, 44898, 45190, 45480, 45769, 46056, 46341, 46624, 46906, 47186,
+    47464, 47741, 48015, 48288, 48559, 48828, 49095, 49361, 49624, 49886, 50146, 50404,
+    50660, 50914, 51166, 51417, 51665, 51911, 52156, 52398, 52639, 52878, 53114, 53349,
+    53581, 53812, 54040, 54267, 54491, 54714, 54934, 55152, 55368, 55582, 55794, 56004,
+    56212, 56418, 56621, 56823, 57022, 57219, 57414, 57607, 57798, 57986, 58172, 58356,
+    58538, 58718, 58896, 59071, 59244, 59415, 59583, 59750, 59914, 60075, 60235, 60392,
+    60547, 60700, 60851, 60999, 61145, 61288, 61429, 61568, 61705, 61839, 61971, 62101,
+    62228, 62353, 62476, 62596, 62714, 62830, 62943, 63054, 63162, 63268, 63372, 63473,
+    63572, 63668, 63763, 63854, 63944, 64031, 64115, 64197, 64277, 64354, 64429, 64501,
+    64571, 64639, 64704, 64766, 64827, 64884, 64940, 64993, 65043, 65091, 65137, 65180,
+    65220, 65259, 65294, 65328, 65358, 65387, 65413, 65436, 65457, 65476, 65492, 65505,
+    65516, 65525, 65531, 65535, 65535,
+};
+
+/* atan(k / 128) in angle indexes, Q4 */
+static const uint16_t m_au16AtanTbl[MAU_BATCH_ATAN_TBL_STEPS + 1UL] = {
+    0, 81, 163, 244, 326, 407, 489, 570, 651, 732, 813, 894,
+    975, 1056, 1136, 1217, 1297, 1377, 1457, 1537, 1617, 1696, 1775, 1854,
+    1933, 2012, 2090, 2168, 2246, 2324, 2401, 2478, 2555, 2632, 2708, 2784,
+    2860, 2935, 3010, 3085, 3159, 3233, 3307, 3380, 3453, 3526, 3599, 3670,
+    3742, 3813, 3884, 3955, 4025, 4095, 4164, 4233, 4302, 4370, 4438, 4505,
+    4572, 4639, 4705, 4771, 4836, 4901, 4966, 5030, 5094, 5157, 5220, 5282,
+    5344, 5406, 5467, 5528, 5589, 5649, 5708, 5768, 5826, 5885, 5943, 6000,
+    6058, 6114, 6171, 6227, 6282, 6337, 6392, 6446, 6500, 6554, 6607, 6660,
+    6712, 6764, 6815, 6867, 6917, 6968, 7018, 7068, 7117, 7166, 7214, 7262,
+    7310, 7358, 7405, 7451, 7498, 7544, 7589, 7635, 7679, 7724, 7768, 7812,
+    7856, 7899, 7942, 7984, 8026, 8068, 8110, 8151, 8192,
+};
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @defgroup MAU_BATCH_Local_Functions MAU_BATCH Local Functions
+ * @{
+ */
+
+/**
+ * @brief  Sine of one angle on the MAU.
+ * @param  [in] MAUx                    Pointer to MAU instance register base.
+ * @param  [in] u16AngleIdx             Angle index, wrapped to one turn.
+ * @retval Q15 sine.
+ */
+static int16_t MAU_BATCH_SinHw(CM_MAU_TypeDef *MAUx, uint16_t u16AngleIdx)
+{
+    WRITE_REG16(MAUx->DTR1, u16AngleIdx & MAU_BATCH_ANGIDX_MASK);
+    __ASM("NOP");
+    return (int16_t)READ_REG16(MAUx->RTR1);
+}
+
+/**
+ * @brief  Start a sqrt on the MAU.
+ * @param  [in] MAUx                    Pointer to MAU instance register base.
+ * @param  [in] u32Radicand             Data to be square rooted.
+ * @retval None
+ * @note   The NOPs cover the latency of the busy flag, as MAU_Sqrt() does.
+ */
+static void MAU_BATCH_SqrtStart(CM_MAU_TypeDef *MAUx, uint32_t u32Radicand)
+{
+    WRITE_REG32(MAUx->DTR0, u32Radicand);
+    SET_REG32_BIT(MAUx->CSR, MAU_CSR_START);
+    __ASM("NOP");
+    __ASM("NOP");
+    __ASM("NOP");
+}
+
+/**
+ * @brief  Wait for the sqrt started by MAU_BATCH_SqrtStart().
+ * @param  [in] MAUx                    Pointer to MAU instance register base.
+ * @param  [out] pu32Root               Result of sqrt.
+ * @retval int32_t:
+ *           - LL_OK:                   Result read
+ *           - LL_ERR_TIMEOUT:          Sqrt not done
+ */
+static int32_t MAU_BATCH_SqrtWait(const CM_MAU_TypeDef *MAUx, uint32_t *pu32Root)
+{
+    __IO uint32_t u32TimeCount = MAU_SQRT_TIMEOUT;
+    int32_t i32Ret = LL_OK;
+
+    while (0UL != READ_REG32_BIT(MAUx->CSR, MAU_CSR_BUSY)) {
+        if (0UL == u32TimeCount) {
+            i32Ret = LL_ERR_TIMEOUT;
+            break;
+        }
+        u32TimeCount--;
+    }
+    if (LL_OK == i32Ret) {
+        *pu32Root = READ_REG32(MAUx->RTR0);
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Squared magnitude of a vector.
+ * @param  [in] i16X                    X component.
+ * @param  [in] i16Y                    Y component.
+ * @retval x * x + y * y, at most 0x80000000.
+ */
+static uint32_t MAU_BATCH_Norm2(int16_t i16X, int16_t i16Y)
+{
+    return (uint32_t)((int32_t)i16X * i16X) + (uint32_t)((int32_t)i16Y * i16Y);
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup MAU_BATCH_Global_Functions MAU_BATCH Global Functions
+ * @{
+ */
+
+/**
+ * @brief  Sine of an array of angles.
+ * @param  [in] MAUx                    Pointer to MAU instance register base, NULL for the software table.
+ * @param  [in] pu16AngleIdx            Angle indexes, wrapped to one turn.
+ * @param  [out] pi16Sin                Q15 sines, may alias the input.
+ * @param  [in] u32Len                  Number of angles.
+ * @retval None
+ */
+void MAU_BATCH_Sin(CM_MAU_TypeDef *MAUx, const uint16_t *pu16AngleIdx, int16_t *pi16Sin, uint32_t u32Len)
+{
+    uint32_t i;
+
+    DDL_ASSERT(NULL != pu16AngleIdx);
+    DDL_ASSERT(NULL != pi16Sin);
+
+    if (NULL != MAUx) {
+        for (i = 0UL; i < u32Len; i++) {
+            pi16Sin[i] = MAU_BATCH_SinHw(MAUx, pu16AngleIdx[i]);
+        }
+    } else {
+        for (i = 0UL; i < u32Len; i++) {
+            pi16Sin[i] = MAU_BATCH_SinLut(pu16AngleIdx[i]);
+        }
+    }
+}
+
+/**
+ * @brief  Cosine of an array of angles, as the sine a quarter turn ahead.
+ * @param  [in] MAUx                    Pointer to MAU instance register base, NULL for the software table.
+ * @param  [in] pu16AngleIdx            Angle indexes, wrapped to one turn.
+ * @param  [out] pi16Cos                Q15 cosines, may alias the input.
+ * @param  [in] u32Len                  Number of angles.
+ * @retval None
+ */
+void MAU_BATCH_Cos(CM_MAU_TypeDef *MAUx, const uint16_t *pu16AngleIdx, int16_t *pi16Cos, uint32_t u32Len)
+{
+    uint32_t i;
+
+    DDL_ASSERT(NULL != pu16AngleIdx);
+    DDL_ASSERT(NULL != pi16Cos);
+
+    if (NULL != MAUx) {
+        for (i = 0UL; i < u32Len; i++) {
+            pi16Cos[i] = MAU_BATCH_SinHw(MAUx, pu16AngleIdx[i] + MAU_BATCH_ANGIDX_QUARTER);
+        }
+    } else {
+        for (i = 0UL; i < u32Len; i++) {
+            pi16Cos[i] = MAU_BATCH_CosLut(pu16AngleIdx[i]);
+        }
+    }
+}
+
+/**
+ * @brief  Sine and cosine of an array of angles.
+ * @param  [in] MAUx                    Pointer to MAU instance register base, NULL for the software table.
+ * @param  [in] pu16AngleIdx            Angle indexes, wrapped to one turn.
+ * @param  [out] pi16Sin                Q15 sines.
+ * @param  [out] pi16Cos                Q15 cosines.
+ * @param  [in] u32Len                  Number of angles.
+ * @retval None
+ */
+void MAU_BATCH_SinCos(CM_MAU_TypeDef *MAUx, const uint16_t *pu16AngleIdx, int16_t *pi16Sin, int16_t *pi16Cos,
+                      uint32_t u32Len)
+{
+    uint16_t u16Idx;
+    uint32_t i;
+
+    DDL_ASSERT(NULL != pu16AngleIdx);
+    DDL_ASSERT(NULL != pi16Sin);
+    DDL_ASSERT(NULL != pi16Cos);
+
+    for (i = 0UL; i < u32Len; i++) {
+        u16Idx = pu16AngleIdx[i];
+        if (NULL != MAUx) {
+            pi16Sin[i] = MAU_BATCH_SinHw(MAUx, u16Idx);
+            pi16Cos[i] = MAU_BATCH_SinHw(MAUx, u16Idx + MAU_BATCH_ANGIDX_QUARTER);
+        } else {
+            pi16Sin[i] = MAU_BATCH_SinLut(u16Idx);
+            pi16Cos[i] = MAU_BATCH_CosLut(u16Idx);
+        }
+    }
+}
+
+/**
+ * @brief  Square root of an array.
+ * @param  [in] MAUx                    Pointer to MAU instance register base, NULL for the software sqrt.
+ * @param  [in] pu32Radicand            Data to be square rooted.
+ * @param  [out] pu32Root               Results, may alias the input.
+ * @param  [in] u32Len                  Number of data.
+ * @param  [in] u8ShiftNum              Result left shift bits, max value is @ref MAU_SQRT_OUTPUT_LSHIFT_MAX.
+ * @retval int32_t:
+ *           - LL_OK:                   All results read
+ *           - LL_ERR_TIMEOUT:          The MAU did not finish, the remaining results are not written
+ * @note   Only the fetch of the next radicand from memory overlaps the current root, the MAU
+ *         does not start it before the current result is read. The left shift of the MAU is set
+ *         to u8ShiftNum.
+ */
+int32_t MAU_BATCH_Sqrt(CM_MAU_TypeDef *MAUx, const uint32_t *pu32Radicand, uint32_t *pu32Root, uint32_t u32Len,
+                       uint8_t u8ShiftNum)
+{
+    int32_t i32Ret = LL_OK;
+    uint32_t u32Next;
+    uint32_t i;
+
+    DDL_ASSERT(NULL != pu32Radicand);
+    DDL_ASSERT(NULL != pu32Root);
+    DDL_ASSERT(u8ShiftNum <= MAU_SQRT_OUTPUT_LSHIFT_MAX);
+
+    if (NULL == MAUx) {
+        for (i = 0UL; i < u32Len; i++) {
+            pu32Root[i] = MAU_BATCH_SqrtSw(pu32Radicand[i], u8ShiftNum);
+        }
+    } else if (0UL != u32Len) {
+        MAU_SqrtResultLShiftConfig(MAUx, u8ShiftNum);
+        u32Next = pu32Radicand[0];
+        for (i = 0UL; i < u32Len; i++) {
+            MAU_BATCH_SqrtStart(MAUx, u32Next);
+            if ((i + 1UL) < u32Len) {
+                u32Next = pu32Radicand[i + 1UL];
+            }
+            i32Ret = MAU_BATCH_SqrtWait(MAUx, &pu32Root[i]);
+            if (LL_OK != i32Ret) {
+                break;
+            }
+        }
+    } else {
+        /* Nothing to do */
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Magnitude and angle of an array of vectors.
+ * @param  [in] MAUx                    Pointer to MAU instance register base, NULL for the software sqrt.
+ * @param  [in] pi16X                   X components.
+ * @param  [in] pi16Y                   Y components.
+ * @param  [out] pu32Mag                Magnitudes, sqrt(x * x + y * y) rounded, at most 46341.
+ * @param  [out] pu16AngleIdx           Angle indexes of the vectors, NULL if not needed.
+ * @param  [in] u32Len                  Number of vectors.
+ * @retval int32_t:
+ *           - LL_OK:                   All results written
+ *           - LL_ERR_TIMEOUT:          The MAU did not finish, the remaining results are not written
+ * @note   The angle of a vector and the squared magnitude of the next one are computed while
+ *         the MAU computes the current root. The left shift of the MAU is set to 0.
+ */
+int32_t MAU_BATCH_Polar(CM_MAU_TypeDef *MAUx, const int16_t *pi16X, const int16_t *pi16Y, uint32_t *pu32Mag,
+                        uint16_t *pu16AngleIdx, uint32_t u32Len)
+{
+    int32_t i32Ret = LL_OK;
+    uint32_t u32Next;
+    uint32_t i;
+
+    DDL_ASSERT(NULL != pi16X);
+    DDL_ASSERT(NULL != pi16Y);
+    DDL_ASSERT(NULL != pu32Mag);
+
+    if (NULL == MAUx) {
+        for (i = 0UL; i < u32Len; i++) {
+            pu32Mag[i] = MAU_BATCH_SqrtSw(MAU_BATCH_Norm2(pi16X[i], pi16Y[i]), 0U);
+            if (NULL != pu16AngleIdx) {
+                pu16AngleIdx[i] = MAU_BATCH_Atan2(pi16Y[i], pi16X[i]);
+            }
+        }
+    } else if (0UL != u32Len) {
+        MAU_SqrtResultLShiftConfig(MAUx, 0U);
+        u32Next = MAU_BATCH_Norm2(pi16X[0], pi16Y[0]);
+        for (i = 0UL; i < u32Len; i++) {
+            MAU_BATCH_SqrtStart(MAUx, u32Next);
+            if (NULL != pu16AngleIdx) {
+                pu16AngleIdx[i] = MAU_BATCH_Atan2(pi16Y[i], pi16X[i]);
+            }
+            if ((i + 1UL) < u32Len) {
+                u32Next = MAU_BATCH_Norm2(pi16X[i + 1UL], pi16Y[i + 1UL]);
+            }
+            i32Ret = MAU_BATCH_SqrtWait(MAUx, &pu32Mag[i]);
+            if (LL_OK != i32Ret) {
+                break;
+            }
+        }
+    } else {
+        /* Nothing to do */
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Software sine.
+ * @param  [in] u16AngleIdx             Angle index, wrapped to one turn.
+ * @retval Q15 sine, within 0.75 of the exact value saturated at 32767.
+ */
+int16_t MAU_BATCH_SinLut(uint16_t u16AngleIdx)
+{
+    const uint32_t u32Idx = (uint32_t)u16AngleIdx & MAU_BATCH_ANGIDX_MASK;
+    uint32_t u32Pos = u32Idx % MAU_BATCH_ANGIDX_QUARTER;
+    uint32_t u32Step;
+    uint32_t u32Frac;
+    uint32_t u32Sin;
+
+    /* Mirror the second and fourth quadrants onto the first one */
+    if (0UL != ((u32Idx / MAU_BATCH_ANGIDX_QUARTER) & 1UL)) {
+        u32Pos = MAU_BATCH_ANGIDX_QUARTER - u32Pos;
+    }
+    u32Step = u32Pos >> MAU_BATCH_SIN_TBL_SHIFT;
+    u32Frac = u32Pos & MAU_BATCH_SIN_TBL_FRAC;
+    /* Interpolate the Q16 table in Q18, then round once to Q15 */
+    u32Sin = (uint32_t)m_au16SinTbl[u32Step] << MAU_BATCH_SIN_TBL_SHIFT;
+    if (0UL != u32Frac) {
+        u32Sin += ((uint32_t)m_au16SinTbl[u32Step + 1UL] - m_au16SinTbl[u32Step]) * u32Frac;
+    }
+    u32Sin = (u32Sin + (1UL << MAU_BATCH_SIN_TBL_SHIFT)) >> (MAU_BATCH_SIN_TBL_SHIFT + 1U);
+    if (u32Sin > MAU_BATCH_SIN_Q15_MAX) {
+        u32Sin = MAU_BATCH_SIN_Q15_MAX;
+    }
+
+    return (int16_t)((u32Idx >= (2UL * MAU_BATCH_ANGIDX_QUARTER)) ? -(int32_t)u32Sin : (int32_t)u32Sin);
+}
+
+/**
+ * @brief  Software cosine.
+ * @param  [in] u16AngleIdx             Angle index, wrapped to one turn.
+ * @retval Q15 cosine, within 0.75 of the exact value saturated at 32767.
+ */
+int16_t MAU_BATCH_CosLut(uint16_t u16AngleIdx)
+{
+    return MAU_BATCH_SinLut(u16AngleIdx + MAU_BATCH_ANGIDX_QUARTER);
+}
+
+/**
+ * @brief  Software square root.
+ * @param  [in] u32Radicand             Data to be square rooted.
+ * @param  [in] u8ShiftNum              Result left shift bits, max value is @ref MAU_SQRT_OUTPUT_LSHIFT_MAX.
+ * @retval sqrt(u32Radicand) * 2^u8ShiftNum, rounded to nearest.
+ */
+uint32_t MAU_BATCH_SqrtSw(uint32_t u32Radicand, uint8_t u8ShiftNum)
+{
+    const uint64_t u64Val = (uint64_t)u32Radicand << (2U * u8ShiftNum);
+    uint64_t u64Rem = u64Val;
+    uint64_t u64Root = 0ULL;
+    uint64_t u64Bit = 1ULL << 62U;
+
+    DDL_ASSERT(u8ShiftNum <= MAU_SQRT_OUTPUT_LSHIFT_MAX);
+
+    while (u64Bit > u64Rem) {
+        u64Bit >>= 2U;
+    }
+    while (0ULL != u64Bit) {
+        if (u64Rem >= (u64Root + u64Bit)) {
+            u64Rem -= u64Root + u64Bit;
+            u64Root = (u64Root >> 1U) + u64Bit;
+        } else {
+            u64Root >>= 1U;
+        }
+        u64Bit >>= 2U;
+    }
+    /* Round up when the remainder is above the root, (r + 0.5)^2 = r^2 + r + 0.25 */
+    if (u64Rem > u64Root) {
+        u64Root++;
+    }
+
+    return (uint32_t)u64Root;
+}
+
+/**
+ * @brief  Angle of a vector.
+ * @param  [in] i16Y                    Y component.
+ * @param  [in] i16X                    X component.
+ * @retval Angle index from the positive X axis, counterclockwise, 0 for the null vector.
+ * @note   Octant reduction and an interpolated arctangent table, within 1 angle index.
+ */
+uint16_t MAU_BATCH_Atan2(int16_t i16Y, int16_t i16X)
+{
+    const uint32_t u32AbsX = (uint32_t)((i16X < 0) ? -(int32_t)i16X : (int32_t)i16X);
+    const uint32_t u32AbsY = (uint32_t)((i16Y < 0) ? -(int32_t)i16Y : (int32_t)i16Y);
+    uint32_t u32Ratio;
+    uint32_t u32Step;
+    uint32_t u32Frac;
+    uint32_t u32Angle = 0UL;
+
+    if ((0UL != u32AbsX) || (0UL != u32AbsY)) {
+        /* Q16 tangent of the angle to the nearest axis */
+        if (u32AbsY <= u32AbsX) {
+            u32Ratio = (u32AbsY << MAU_BATCH_ATAN_RATIO_SHIFT) / u32AbsX;
+        } else {
+            u32Ratio = (u32AbsX << MAU_BATCH_ATAN_RATIO_SHIFT) / u32AbsY;
+        }
+        u32Step = u32Ratio >> MAU_BATCH_ATAN_STEP_SHIFT;
+        u32Frac = u32Ratio & MAU_BATCH_ATAN_FRAC_MASK;
+        u32Angle = m_au16AtanTbl[u32Step];
+        if (u32Step < MAU_BATCH_ATAN_TBL_STEPS) {
+            u32Angle += ((m_au16AtanTbl[u32Step + 1UL] - u32Angle) * u32Frac) >> MAU_BATCH_ATAN_STEP_SHIFT;
+        }
+
+        /* Unfold the octants, angles in Q4 */
+        if (u32AbsY > u32AbsX) {
+            u32Angle = ((uint32_t)MAU_BATCH_ANGIDX_QUARTER << MAU_BATCH_ATAN_Q) - u32Angle;
+        }
+        if (i16X < 0) {
+            u32Angle = ((2UL * MAU_BATCH_ANGIDX_QUARTER) << MAU_BATCH_ATAN_Q) - u32Angle;
+        }
+        if (i16Y < 0) {
+            u32Angle = ((4UL * MAU_BATCH_ANGIDX_QUARTER) << MAU_BATCH_ATAN_Q) - u32Angle;
+        }
+        u32Angle = (u32Angle + (1UL << (MAU_BATCH_ATAN_Q - 1U))) >> MAU_BATCH_ATAN_Q;
+    }
+
+    return (uint16_t)(u32Angle & MAU_BATCH_ANGIDX_MASK);
+}
+
+/**
+ * @}
+ */
+
+#endif /* LL_MAU_BATCH_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -13,6 +13,7 @@
                                     Optimize SDIOC_GetMode function
                                     Support CMD5/CMD52/CMD53
    2024-08-31       CDT             Add parameter for SDMMC_CMD38_Erase
+   2026-10-19       CDT             Get the bus clock frequency from the CLK cache
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2022-2025, Xiaohua Semiconductor Co., Ltd. All rights reserved.
@@ -29,6 +30,7 @@
  * Include files
  ******************************************************************************/
 #include "hc32_ll_sdioc.h"
+#include "hc32_ll_clk.h"
 #include "hc32_ll_utility.h"
 
 /**
@@ -824,7 +826,7 @@ int32_t SDIOC_GetOptimumClockDiv(uint32_t u32ClockFreq, uint16_t *pu16Div)
         i32Ret = LL_ERR_INVD_PARAM;
     } else {
         /* Get BUS frequency */
-        u32BusClock = SystemCoreClock / (0x01UL << (READ_REG32_BIT(CM_CMU->SCFGR, CMU_SCFGR_PCLK1S) >> CMU_SCFGR_PCLK1S_POS));
+        u32BusClock = CLK_GetBusClockFreq(CLK_BUS_PCLK1);
         u32ClockDiv = u32BusClock / u32ClockFreq;
         if (0UL != (u32BusClock % u32ClockFreq)) {
             u32ClockDiv++;
@@ -888,7 +890,7 @@ int32_t SDIOC_VerifyClockDiv(uint32_t u32Mode, uint8_t u8SpeedMode, uint16_t u16
     DDL_ASSERT(IS_SDIOC_CLK_DIV(u16ClockDiv));
 
     /* Get Bus frequency */
-    u32BusClock = SystemCoreClock / (0x01UL << (READ_REG32_BIT(CM_CMU->SCFGR, CMU_SCFGR_PCLK1S) >> CMU_SCFGR_PCLK1S_POS));
+    u32BusClock = CLK_GetBusClockFreq(CLK_BUS_PCLK1);
     u32DivValue = ((uint32_t)u16ClockDiv >> (SDIOC_CLKCON_FS_POS - 1U));
     if (0UL == u32DivValue) {
         u32ClockFreq = u32BusClock;
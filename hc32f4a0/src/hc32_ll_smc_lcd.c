@@ -0,0 +1,545 @@
+/**
+ *******************************************************************************
+ * @file  hc32_ll_smc_lcd.c
+ * @brief This file provides firmware functions to flush a framebuffer to an
+ *        8080 bus LCD through EXMC_SMC.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       CDT             First version
+                                    Requested the blocks by DMA_MxChSWTrigger() instead of AOS_SW_Trigger()
+                                    Checked the DMA trigger target in SMC_LCD_Init()
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2025, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ll_smc_lcd.h"
+#include "hc32_ll_smc.h"
+#include "hc32_ll_aos.h"
+#include "hc32_ll_utility.h"
+
+/**
+ * @addtogroup LL_Driver
+ * @{
+ */
+
+/**
+ * @defgroup LL_SMC_LCD SMC_LCD
+ * @brief SMC LCD Framebuffer Flush Driver Library
+ * @note  The LCD is a 16-bit 8080 bus controller on an SMC chip, RS selects the data address,
+ *        and the framebuffer holds u16Width * u16Height pixels of 16 bits. The areas changed by
+ *        the UI are recorded with SMC_LCD_Invalidate(), overlapping or touching rectangles
+ *        are merged. SMC_LCD_Flush() sends, for each rectangle, the window address commands
+ *        by the CPU, then the pixels by DMA in blocks of whole rows, each block requested by
+ *        software on the channel alone, and returns at once.
+ *        While the flush runs the UI can render into a second framebuffer, brought up to
+ *        date by SMC_LCD_CopyFlushed().
+ * @{
+ */
+
+#if (LL_SMC_LCD_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup SMC_LCD_Local_Macros SMC_LCD Local Macros
+ * @{
+ */
+#define SMC_LCD_DMA_BLK_MAX             (1024U)
+
+#define SMC_LCD_AREA(r)                 ((uint32_t)(r)->u16Width * (uint32_t)(r)->u16Height)
+
+/**
+ * @defgroup SMC_LCD_Check_Parameters_Validity SMC_LCD Check Parameters Validity
+ * @{
+ */
+#define IS_SMC_LCD_WIDTH(x)             (((x) != 0U) && ((x) <= SMC_LCD_WIDTH_MAX))
+
+#define IS_SMC_LCD_DMA_TARGET(unit, ch, target)                                \
+(   ((target) == ((((unit) == CM_DMA1) ? AOS_DMA1_0 : AOS_DMA2_0) + ((uint32_t)(ch) * 4UL))))
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @defgroup SMC_LCD_Local_Functions SMC_LCD Local Functions
+ * @{
+ */
+
+/**
+ * @brief  Smallest rectangle holding two rectangles.
+ * @param  [in] pstcA                   First rectangle.
+ * @param  [in] pstcB                   Second rectangle.
+ * @param  [out] pstcUnion              Bounding rectangle.
+ * @retval None
+ */
+static void SMC_LCD_Union(const stc_smc_lcd_rect_t *pstcA, const stc_smc_lcd_rect_t *pstcB,
+                          stc_smc_lcd_rect_t *pstcUnion)
+{
+    const uint32_t u32X0 = (pstcA->u16X < pstcB->u16X) ? pstcA->u16X : pstcB->u16X;
+    const uint32_t u32Y0 = (pstcA->u16Y < pstcB->u16Y) ? pstcA->u16Y : pstcB->u16Y;
+    uint32_t u32X1 = (uint32_t)pstcA->u16X + pstcA->u16Width;
+    uint32_t u32Y1 = (uint32_t)pstcA->u16Y + pstcA->u16Height;
+
+    if (((uint32_t)pstcB->u16X + pstcB->u16Width) > u32X1) {
+        u32X1 = (uint32_t)pstcB->u16X + pstcB->u16Width;
+    }
+    if (((uint32_t)pstcB->u16Y + pstcB->u16Height) > u32Y1) {
+        u32Y1 = (uint32_t)pstcB->u16Y + pstcB->u16Height;
+    }
+    pstcUnion->u16X      = (uint16_t)u32X0;
+    pstcUnion->u16Y      = (uint16_t)u32Y0;
+    pstcUnion->u16Width  = (uint16_t)(u32X1 - u32X0);
+    pstcUnion->u16Height = (uint16_t)(u32Y1 - u32Y0);
+}
+
+/**
+ * @brief  Send a start and end address pair after a command.
+ * @param  [in] pstcLcd                 Pointer to a @ref stc_smc_lcd_t structure.
+ * @param  [in] u16Cmd                  Address command.
+ * @param  [in] u16Start                First address.
+ * @param  [in] u16Len                  Number of addresses.
+ * @retval None
+ */
+static void SMC_LCD_SetAddr(const stc_smc_lcd_t *pstcLcd, uint16_t u16Cmd, uint16_t u16Start, uint16_t u16Len)
+{
+    const uint16_t u16End = u16Start + u16Len - 1U;
+    uint16_t au16Param[4];
+
+    au16Param[0] = u16Start >> 8U;
+    au16Param[1] = u16Start & 0xFFU;
+    au16Param[2] = u16End >> 8U;
+    au16Param[3] = u16End & 0xFFU;
+    SMC_LCD_WriteCmd(pstcLcd, u16Cmd, au16Param, 4UL);
+}
+
+/**
+ * @brief  Send the next block of rows, or end the flush.
+ * @param  [in] pstcLcd                 Pointer to a @ref stc_smc_lcd_t structure.
+ * @retval None
+ */
+static void SMC_LCD_Next(stc_smc_lcd_t *pstcLcd)
+{
+    const stc_smc_lcd_rect_t *pstcRect;
+    stc_dma_nonseq_init_t stcNonSeq;
+    uint32_t u32Src;
+    uint8_t u8Sent = 0U;
+
+    while ((pstcLcd->u8FlushIdx < pstcLcd->u8FlushNum) && (0U == u8Sent)) {
+        pstcRect = &pstcLcd->astcFlush[pstcLcd->u8FlushIdx];
+        if (pstcLcd->u16Row < pstcRect->u16Height) {
+            if (0U == pstcLcd->u16Row) {
+                SMC_LCD_SetAddr(pstcLcd, pstcLcd->u16ColAddrCmd, pstcRect->u16X, pstcRect->u16Width);
+                SMC_LCD_SetAddr(pstcLcd, pstcLcd->u16RowAddrCmd, pstcRect->u16Y, pstcRect->u16Height);
+                SMC_LCD_WriteCmd(pstcLcd, pstcLcd->u16MemWriteCmd, NULL, 0UL);
+            }
+
+            pstcLcd->u16Rows = SMC_LCD_DMA_BLK_MAX / pstcRect->u16Width;
+            if (pstcLcd->u16Rows > (pstcRect->u16Height - pstcLcd->u16Row)) {
+                pstcLcd->u16Rows = pstcRect->u16Height - pstcLcd->u16Row;
+            }
+            u32Src = (uint32_t)pstcLcd->pu16Fb +
+                     ((((uint32_t)pstcRect->u16Y + pstcLcd->u16Row) * pstcLcd->u16Width + pstcRect->u16X) * 2UL);
+
+            /* Rows of a narrow rectangle are apart in the framebuffer, the source address moves
+               by the offset instead of by one after each row */
+            (void)DMA_NonSeqStructInit(&stcNonSeq);
+            if ((pstcLcd->u16Rows > 1U) && (pstcRect->u16Width != pstcLcd->u16Width)) {
+                stcNonSeq.u32Mode      = DMA_NON_SEQ_SRC;
+                stcNonSeq.u32SrcCount  = pstcRect->u16Width;
+                stcNonSeq.u32SrcOffset = ((uint32_t)pstcLcd->u16Width - pstcRect->u16Width) + 1UL;
+            }
+            (void)DMA_NonSeqInit(pstcLcd->pstcDmaUnit, pstcLcd->u8DmaCh, &stcNonSeq);
+            (void)DMA_SetSrcAddr(pstcLcd->pstcDmaUnit, pstcLcd->u8DmaCh, u32Src);
+            (void)DMA_SetBlockSize(pstcLcd->pstcDmaUnit, pstcLcd->u8DmaCh,
+                                   (uint16_t)(pstcLcd->u16Rows * pstcRect->u16Width));
+            (void)DMA_SetTransCount(pstcLcd->pstcDmaUnit, pstcLcd->u8DmaCh, 1U);
+            (void)DMA_ChCmd(pstcLcd->pstcDmaUnit, pstcLcd->u8DmaCh, ENABLE);
+            /* The request of the channel alone, AOS_SW_Trigger() would start every channel and
+               peripheral listening to the AOS software event */
+            DMA_MxChSWTrigger(pstcLcd->pstcDmaUnit, (uint8_t)(DMA_MX_CH0 << pstcLcd->u8DmaCh));
+            u8Sent = 1U;
+        } else {
+            pstcLcd->u8FlushIdx++;
+            pstcLcd->u16Row = 0U;
+        }
+    }
+
+    if (0U == u8Sent) {
+        pstcLcd->u8Busy = 0U;
+        if (NULL != pstcLcd->pfnCallback) {
+            pstcLcd->pfnCallback(pstcLcd, pstcLcd->pvArg);
+        }
+    }
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup SMC_LCD_Global_Functions SMC_LCD Global Functions
+ * @{
+ */
+
+/**
+ * @brief  Set each @ref stc_smc_lcd_init_t field to default value.
+ * @param  [out] pstcLcdInit            Pointer to a @ref stc_smc_lcd_init_t structure.
+ * @retval int32_t:
+ *           - LL_OK:                   Initialize success
+ *           - LL_ERR_INVD_PARAM:       pstcLcdInit is NULL
+ */
+int32_t SMC_LCD_StructInit(stc_smc_lcd_init_t *pstcLcdInit)
+{
+    int32_t i32Ret = LL_OK;
+
+    if (NULL == pstcLcdInit) {
+        i32Ret = LL_ERR_INVD_PARAM;
+    } else {
+        pstcLcdInit->u32Chip        = EXMC_SMC_CHIP0;
+        pstcLcdInit->u32DataOffset  = 0UL;
+        pstcLcdInit->u16Width       = 0U;
+        pstcLcdInit->u16Height      = 0U;
+        pstcLcdInit->u16ColAddrCmd  = SMC_LCD_CMD_COL_ADDR;
+        pstcLcdInit->u16RowAddrCmd  = SMC_LCD_CMD_ROW_ADDR;
+        pstcLcdInit->u16MemWriteCmd = SMC_LCD_CMD_MEM_WRITE;
+        pstcLcdInit->pstcDmaUnit    = NULL;
+        pstcLcdInit->u8DmaCh        = DMA_CH0;
+        pstcLcdInit->u32TrigTarget  = AOS_DMA1_0;
+        pstcLcdInit->pfnCallback    = NULL;
+        pstcLcdInit->pvArg          = NULL;
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Initialize an SMC LCD.
+ * @param  [out] pstcLcd                Pointer to a @ref stc_smc_lcd_t structure.
+ * @param  [in] pstcLcdInit             Pointer to a @ref stc_smc_lcd_init_t structure.
+ * @retval int32_t:
+ *           - LL_OK:                   Initialize success
+ *           - LL_ERR_INVD_PARAM:       Invalid parameter, or u32TrigTarget is not the target of u8DmaCh
+ * @note   The SMC chip must have been set up by EXMC_SMC_Init() for a 16-bit bus, and the panel
+ *         initialized by SMC_LCD_WriteCmd(). The DMA transfer complete interrupt must call
+ *         SMC_LCD_DmaIrqHandler().
+ */
+int32_t SMC_LCD_Init(stc_smc_lcd_t *pstcLcd, const stc_smc_lcd_init_t *pstcLcdInit)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+    stc_dma_init_t stcDmaInit;
+
+    if ((NULL != pstcLcd) && (NULL != pstcLcdInit) && (NULL != pstcLcdInit->pstcDmaUnit) &&
+        IS_SMC_LCD_DMA_TARGET(pstcLcdInit->pstcDmaUnit, pstcLcdInit->u8DmaCh, pstcLcdInit->u32TrigTarget) &&
+        IS_SMC_LCD_WIDTH(pstcLcdInit->u16Width) && (0U != pstcLcdInit->u16Height)) {
+        DDL_ASSERT(pstcLcdInit->u8DmaCh <= DMA_CH7);
+
+        pstcLcd->u32CmdAddr     = EXMC_SMC_GetChipStartAddr(pstcLcdInit->u32Chip);
+        pstcLcd->u32DataAddr    = pstcLcd->u32CmdAddr + pstcLcdInit->u32DataOffset;
+        pstcLcd->u16Width       = pstcLcdInit->u16Width;
+        pstcLcd->u16Height      = pstcLcdInit->u16Height;
+        pstcLcd->u16ColAddrCmd  = pstcLcdInit->u16ColAddrCmd;
+        pstcLcd->u16RowAddrCmd  = pstcLcdInit->u16RowAddrCmd;
+        pstcLcd->u16MemWriteCmd = pstcLcdInit->u16MemWriteCmd;
+        pstcLcd->pstcDmaUnit    = pstcLcdInit->pstcDmaUnit;
+        pstcLcd->u8DmaCh        = pstcLcdInit->u8DmaCh;
+        pstcLcd->pfnCallback    = pstcLcdInit->pfnCallback;
+        pstcLcd->pvArg          = pstcLcdInit->pvArg;
+        pstcLcd->u8DirtyNum     = 0U;
+        pstcLcd->u8FlushNum     = 0U;
+        pstcLcd->u8FlushIdx     = 0U;
+        pstcLcd->u16Row         = 0U;
+        pstcLcd->u16Rows        = 0U;
+        pstcLcd->pu16Fb         = NULL;
+        pstcLcd->u8Busy         = 0U;
+
+        (void)DMA_StructInit(&stcDmaInit);
+        stcDmaInit.u32IntEn       = DMA_INT_ENABLE;
+        stcDmaInit.u32SrcAddr     = 0UL;
+        stcDmaInit.u32DestAddr    = pstcLcd->u32DataAddr;
+        stcDmaInit.u32DataWidth   = DMA_DATAWIDTH_16BIT;
+        stcDmaInit.u32BlockSize   = 1UL;
+        stcDmaInit.u32TransCount  = 1UL;
+        stcDmaInit.u32SrcAddrInc  = DMA_SRC_ADDR_INC;
+        stcDmaInit.u32DestAddrInc = DMA_DEST_ADDR_FIX;
+        (void)DMA_Init(pstcLcd->pstcDmaUnit, pstcLcd->u8DmaCh, &stcDmaInit);
+        DMA_ClearTransCompleteStatus(pstcLcd->pstcDmaUnit, DMA_FLAG_TC_CH0 << pstcLcd->u8DmaCh);
+        DMA_TransCompleteIntCmd(pstcLcd->pstcDmaUnit, DMA_INT_TC_CH0 << pstcLcd->u8DmaCh, ENABLE);
+
+        /* No event left by a former user of the channel may request it */
+        AOS_SetTriggerEventSrc(pstcLcdInit->u32TrigTarget, EVT_SRC_MAX);
+        i32Ret = LL_OK;
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Send a command and its parameters by the CPU.
+ * @param  [in] pstcLcd                 Pointer to a @ref stc_smc_lcd_t structure.
+ * @param  [in] u16Cmd                  Command.
+ * @param  [in] pu16Param               Parameters, may be NULL if u32Len is 0.
+ * @param  [in] u32Len                  Number of parameters.
+ * @retval None
+ * @note   It must not be called while a flush runs.
+ */
+void SMC_LCD_WriteCmd(const stc_smc_lcd_t *pstcLcd, uint16_t u16Cmd, const uint16_t *pu16Param, uint32_t u32Len)
+{
+    uint32_t i;
+
+    DDL_ASSERT(NULL != pstcLcd);
+    DDL_ASSERT((NULL != pu16Param) || (0UL == u32Len));
+
+    RW_MEM16(pstcLcd->u32CmdAddr) = u16Cmd;
+    for (i = 0UL; i < u32Len; i++) {
+        RW_MEM16(pstcLcd->u32DataAddr) = pu16Param[i];
+    }
+}
+
+/**
+ * @brief  Record a changed area of the framebuffer.
+ * @param  [in] pstcLcd                 Pointer to a @ref stc_smc_lcd_t structure.
+ * @param  [in] pstcRect                Changed area, clipped by the panel.
+ * @retval None
+ * @note   A rectangle is merged with a recorded one when their bounding rectangle is not larger
+ *         than both together, so no unchanged pixel is sent twice. When the list is full it is
+ *         merged with the rectangle growing the least.
+ */
+void SMC_LCD_Invalidate(stc_smc_lcd_t *pstcLcd, const stc_smc_lcd_rect_t *pstcRect)
+{
+    stc_smc_lcd_rect_t stcNew;
+    stc_smc_lcd_rect_t stcUnion;
+    uint32_t u32Grow;
+    uint32_t u32MinGrow;
+    uint8_t u8Merge;
+    uint8_t u8Best;
+    uint8_t i;
+
+    DDL_ASSERT(NULL != pstcLcd);
+    DDL_ASSERT(NULL != pstcRect);
+
+    if ((pstcRect->u16X < pstcLcd->u16Width) && (pstcRect->u16Y < pstcLcd->u16Height) &&
+        (0U != pstcRect->u16Width) && (0U != pstcRect->u16Height)) {
+        stcNew = *pstcRect;
+        if (stcNew.u16Width > (pstcLcd->u16Width - stcNew.u16X)) {
+            stcNew.u16Width = pstcLcd->u16Width - stcNew.u16X;
+        }
+        if (stcNew.u16Height > (pstcLcd->u16Height - stcNew.u16Y)) {
+            stcNew.u16Height = pstcLcd->u16Height - stcNew.u16Y;
+        }
+
+        do {
+            /* Absorb the recorded rectangles the new one overlaps or touches */
+            u8Merge = 1U;
+            while (0U != u8Merge) {
+                u8Merge = 0U;
+                for (i = 0U; i < pstcLcd->u8DirtyNum; i++) {
+                    SMC_LCD_Union(&stcNew, &pstcLcd->astcDirty[i], &stcUnion);
+                    if (SMC_LCD_AREA(&stcUnion) <= (SMC_LCD_AREA(&stcNew) + SMC_LCD_AREA(&pstcLcd->astcDirty[i]))) {
+                        stcNew = stcUnion;
+                        pstcLcd->u8DirtyNum--;
+                        pstcLcd->astcDirty[i] = pstcLcd->astcDirty[pstcLcd->u8DirtyNum];
+                        u8Merge = 1U;
+                        break;
+                    }
+                }
+            }
+
+            if (pstcLcd->u8DirtyNum >= SMC_LCD_RECT_MAX) {
+                u8Best = 0U;
+                u32MinGrow = 0xFFFFFFFFUL;
+                for (i = 0U; i < pstcLcd->u8DirtyNum; i++) {
+                    SMC_LCD_Union(&stcNew, &pstcLcd->astcDirty[i], &stcUnion);
+                    u32Grow = SMC_LCD_AREA(&stcUnion) - SMC_LCD_AREA(&pstcLcd->astcDirty[i]);
+                    if (u32Grow < u32MinGrow) {
+                        u32MinGrow = u32Grow;
+                        u8Best = i;
+                    }
+                }
+                SMC_LCD_Union(&stcNew, &pstcLcd->astcDirty[u8Best], &stcNew);
+                pstcLcd->u8DirtyNum--;
+                pstcLcd->astcDirty[u8Best] = pstcLcd->astcDirty[pstcLcd->u8DirtyNum];
+                /* The grown rectangle may now overlap others */
+                u8Merge = 1U;
+            }
+        } while (0U != u8Merge);
+
+        pstcLcd->astcDirty[pstcLcd->u8DirtyNum] = stcNew;
+        pstcLcd->u8DirtyNum++;
+    }
+}
+
+/**
+ * @brief  Record the whole framebuffer as changed.
+ * @param  [in] pstcLcd                 Pointer to a @ref stc_smc_lcd_t structure.
+ * @retval None
+ */
+void SMC_LCD_InvalidateAll(stc_smc_lcd_t *pstcLcd)
+{
+    DDL_ASSERT(NULL != pstcLcd);
+
+    pstcLcd->astcDirty[0].u16X      = 0U;
+    pstcLcd->astcDirty[0].u16Y      = 0U;
+    pstcLcd->astcDirty[0].u16Width  = pstcLcd->u16Width;
+    pstcLcd->astcDirty[0].u16Height = pstcLcd->u16Height;
+    pstcLcd->u8DirtyNum = 1U;
+}
+
+/**
+ * @brief  Start sending the changed areas of a framebuffer.
+ * @param  [in] pstcLcd                 Pointer to a @ref stc_smc_lcd_t structure.
+ * @param  [in] pu16Fb                  Framebuffer, not written until the flush done callback.
+ * @retval int32_t:
+ *           - LL_OK:                   Flush started, or nothing to flush
+ *           - LL_ERR_INVD_PARAM:       pu16Fb is NULL
+ *           - LL_ERR_BUSY:             The last flush is running
+ * @note   The recorded areas are moved to the flush, the areas recorded afterwards go to the
+ *         next flush. When nothing is recorded no transfer is started and the callback is not
+ *         called.
+ */
+int32_t SMC_LCD_Flush(stc_smc_lcd_t *pstcLcd, const uint16_t *pu16Fb)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+    uint8_t i;
+
+    DDL_ASSERT(NULL != pstcLcd);
+
+    if (NULL != pu16Fb) {
+        if (0U != pstcLcd->u8Busy) {
+            i32Ret = LL_ERR_BUSY;
+        } else {
+            if (0U != pstcLcd->u8DirtyNum) {
+                for (i = 0U; i < pstcLcd->u8DirtyNum; i++) {
+                    pstcLcd->astcFlush[i] = pstcLcd->astcDirty[i];
+                }
+                pstcLcd->u8FlushNum = pstcLcd->u8DirtyNum;
+                pstcLcd->u8DirtyNum = 0U;
+                pstcLcd->u8FlushIdx = 0U;
+                pstcLcd->u16Row     = 0U;
+                pstcLcd->pu16Fb     = pu16Fb;
+                pstcLcd->u8Busy     = 1U;
+                SMC_LCD_Next(pstcLcd);
+            }
+            i32Ret = LL_OK;
+        }
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Get the flush status.
+ * @param  [in] pstcLcd                 Pointer to a @ref stc_smc_lcd_t structure.
+ * @retval An @ref en_flag_status_t enumeration type value, SET while a flush runs.
+ */
+en_flag_status_t SMC_LCD_GetBusyStatus(const stc_smc_lcd_t *pstcLcd)
+{
+    DDL_ASSERT(NULL != pstcLcd);
+
+    return (0U != pstcLcd->u8Busy) ? SET : RESET;
+}
+
+/**
+ * @brief  Copy the areas of the last flush from one framebuffer to another.
+ * @param  [in] pstcLcd                 Pointer to a @ref stc_smc_lcd_t structure.
+ * @param  [out] pu16Dst                Framebuffer to bring up to date.
+ * @param  [in] pu16Src                 Framebuffer given to the last flush.
+ * @retval None
+ * @note   With two framebuffers, the UI calls it before rendering into the buffer not being
+ *         sent, so that buffer holds the whole last frame.
+ */
+void SMC_LCD_CopyFlushed(const stc_smc_lcd_t *pstcLcd, uint16_t *pu16Dst, const uint16_t *pu16Src)
+{
+    const stc_smc_lcd_rect_t *pstcRect;
+    uint32_t u32Pos;
+    uint32_t u32Row;
+    uint32_t u32Col;
+    uint8_t i;
+
+    DDL_ASSERT(NULL != pstcLcd);
+    DDL_ASSERT(NULL != pu16Dst);
+    DDL_ASSERT(NULL != pu16Src);
+
+    for (i = 0U; i < pstcLcd->u8FlushNum; i++) {
+        pstcRect = &pstcLcd->astcFlush[i];
+        for (u32Row = 0UL; u32Row < pstcRect->u16Height; u32Row++) {
+            u32Pos = ((pstcRect->u16Y + u32Row) * pstcLcd->u16Width) + pstcRect->u16X;
+            for (u32Col = 0UL; u32Col < pstcRect->u16Width; u32Col++) {
+                pu16Dst[u32Pos + u32Col] = pu16Src[u32Pos + u32Col];
+            }
+        }
+    }
+}
+
+/**
+ * @brief  DMA transfer complete interrupt handler of an SMC LCD.
+ * @param  [in] pstcLcd                 Pointer to a @ref stc_smc_lcd_t structure.
+ * @retval None
+ */
+void SMC_LCD_DmaIrqHandler(stc_smc_lcd_t *pstcLcd)
+{
+    const uint32_t u32Flag = DMA_FLAG_TC_CH0 << pstcLcd->u8DmaCh;
+
+    DDL_ASSERT(NULL != pstcLcd);
+
+    if (SET == DMA_GetTransCompleteStatus(pstcLcd->pstcDmaUnit, u32Flag)) {
+        DMA_ClearTransCompleteStatus(pstcLcd->pstcDmaUnit, u32Flag);
+        if (0U != pstcLcd->u8Busy) {
+            pstcLcd->u16Row += pstcLcd->u16Rows;
+            SMC_LCD_Next(pstcLcd);
+        }
+    }
+}
+
+/**
+ * @}
+ */
+
+#endif /* LL_SMC_LCD_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,692 @@
+/**
+ *******************************************************************************
+ * @file  hc32_ll_swtmr.c
+ * @brief This file provides firmware functions to manage the hierarchical
+ *        software timer wheel driven by one TMR0 compare channel.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2025, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ll_swtmr.h"
+#include "hc32_ll_tmr0.h"
+#include "hc32_ll_utility.h"
+
+/**
+ * @addtogroup LL_Driver
+ * @{
+ */
+
+/**
+ * @defgroup LL_SWTMR SWTMR
+ * @brief Software Timer Wheel Driver Library
+ * @note  Timers are hashed into a wheel of 256 slots of one tick, plus four
+ *        levels of 64 slots which are cascaded into the lower level when it
+ *        wraps. Start and stop are O(1). The TMR0 compare value is reprogrammed
+ *        to the next non-empty slot (or to the next cascade), so there is no
+ *        periodic tick interrupt. Expired timers are collected first and their
+ *        callbacks then run in a batch from SWTMR_IrqHandler(), which must be
+ *        called from the compare interrupt of the selected TMR0 channel.
+ * @{
+ */
+
+#if (LL_SWTMR_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup SWTMR_Local_Macros SWTMR Local Macros
+ * @{
+ */
+/* Wheel geometry */
+#define SWTMR_LV0_BITS                  (8UL)
+#define SWTMR_LVN_BITS                  (6UL)
+#define SWTMR_LV0_SIZE                  (1UL << SWTMR_LV0_BITS)
+#define SWTMR_LVN_SIZE                  (1UL << SWTMR_LVN_BITS)
+#define SWTMR_LV0_MASK                  (SWTMR_LV0_SIZE - 1UL)
+#define SWTMR_LVN_MASK                  (SWTMR_LVN_SIZE - 1UL)
+#define SWTMR_LVN_NUM                   (4UL)
+#define SWTMR_SLOT_NUM                  (SWTMR_LV0_SIZE + (SWTMR_LVN_NUM * SWTMR_LVN_SIZE))
+
+/* Pseudo slots */
+#define SWTMR_SLOT_EXPIRED              (SWTMR_SLOT_NUM)
+#define SWTMR_SLOT_NONE                 (0xFFFFU)
+
+/* Slot bitmap, the bit of slot n is (0x80000000 >> (n % 32)) so that CLZ finds the lowest slot */
+#define SWTMR_BITMAP_WORDS              (SWTMR_SLOT_NUM / 32UL)
+#define SWTMR_LV0_BITMAP_WORDS          (SWTMR_LV0_SIZE / 32UL)
+#define SWTMR_SLOT_BIT(n)               (0x80000000UL >> ((n) & 31UL))
+
+/* First slot of level n, n = 1 ~ SWTMR_LVN_NUM */
+#define SWTMR_LVN_SLOT_BASE(n)          (SWTMR_LV0_SIZE + (((n) - 1UL) * SWTMR_LVN_SIZE))
+/* Bit shift of level n */
+#define SWTMR_LVN_SHIFT(n)              (SWTMR_LV0_BITS + (((n) - 1UL) * SWTMR_LVN_BITS))
+
+/* Longest period of the 16-bit counter */
+#define SWTMR_PERIOD_MAX                (0x10000UL)
+
+/**
+ * @defgroup SWTMR_Check_Parameters_Validity SWTMR Check Parameters Validity
+ * @{
+ */
+#define IS_SWTMR_TMR0_UNIT(x)                                                  \
+(   ((x) == CM_TMR0_1)                              ||                         \
+    ((x) == CM_TMR0_2))
+
+#define IS_SWTMR_TMR0_CH(x)                                                    \
+(   ((x) == TMR0_CH_A)                              ||                         \
+    ((x) == TMR0_CH_B))
+
+#define IS_SWTMR_CLK_SRC(x)                                                    \
+(   ((x) == TMR0_CLK_SRC_INTERN_CLK)                ||                         \
+    ((x) == TMR0_CLK_SRC_LRC)                       ||                         \
+    ((x) == TMR0_CLK_SRC_XTAL32))
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+static void SWTMR_AddTimer(stc_swtmr_t *pstcTimer);
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+/**
+ * @defgroup SWTMR_Local_Variables SWTMR Local Variables
+ * @{
+ */
+static CM_TMR0_TypeDef *m_pstcSwtmrUnit = NULL;
+static uint32_t m_u32SwtmrCh;
+static uint32_t m_u32SwtmrFlag;
+
+/* Wheel tick at the start of the current TMR0 period, and length of the period */
+static uint32_t m_u32SwtmrHwBase;
+static uint32_t m_u32SwtmrHwPeriod;
+
+/* Next wheel tick to be processed */
+static uint32_t m_u32SwtmrClk;
+
+static stc_swtmr_t *m_apstcSwtmrSlot[SWTMR_SLOT_NUM + 1UL];
+static uint32_t m_au32SwtmrBitmap[SWTMR_BITMAP_WORDS];
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @defgroup SWTMR_Local_Functions SWTMR Local Functions
+ * @{
+ */
+
+/**
+ * @brief  Link a timer at the head of a slot.
+ * @param  [in] pstcTimer               Pointer to the timer
+ * @param  [in] u32Slot                 Slot index
+ * @retval None
+ */
+static void SWTMR_Link(stc_swtmr_t *pstcTimer, uint32_t u32Slot)
+{
+    stc_swtmr_t *pstcHead = m_apstcSwtmrSlot[u32Slot];
+
+    pstcTimer->pstcPrev = NULL;
+    pstcTimer->pstcNext = pstcHead;
+    if (NULL != pstcHead) {
+        pstcHead->pstcPrev = pstcTimer;
+    }
+    m_apstcSwtmrSlot[u32Slot] = pstcTimer;
+    pstcTimer->u16Slot = (uint16_t)u32Slot;
+    if (u32Slot < SWTMR_SLOT_NUM) {
+        m_au32SwtmrBitmap[u32Slot >> 5U] |= SWTMR_SLOT_BIT(u32Slot);
+    }
+}
+
+/**
+ * @brief  Unlink a timer from its slot.
+ * @param  [in] pstcTimer               Pointer to the timer
+ * @retval None
+ */
+static void SWTMR_Unlink(stc_swtmr_t *pstcTimer)
+{
+    const uint32_t u32Slot = pstcTimer->u16Slot;
+
+    if (NULL != pstcTimer->pstcNext) {
+        pstcTimer->pstcNext->pstcPrev = pstcTimer->pstcPrev;
+    }
+    if (NULL != pstcTimer->pstcPrev) {
+        pstcTimer->pstcPrev->pstcNext = pstcTimer->pstcNext;
+    } else {
+        m_apstcSwtmrSlot[u32Slot] = pstcTimer->pstcNext;
+        if ((NULL == pstcTimer->pstcNext) && (u32Slot < SWTMR_SLOT_NUM)) {
+            m_au32SwtmrBitmap[u32Slot >> 5U] &= ~SWTMR_SLOT_BIT(u32Slot);
+        }
+    }
+    pstcTimer->u16Slot = SWTMR_SLOT_NONE;
+}
+
+/**
+ * @brief  Hash a timer into the wheel according to its expiry.
+ * @param  [in] pstcTimer               Pointer to the timer
+ * @retval None
+ */
+static void SWTMR_AddTimer(stc_swtmr_t *pstcTimer)
+{
+    const uint32_t u32Expires = pstcTimer->u32Expires;
+    const uint32_t u32Idx = u32Expires - m_u32SwtmrClk;
+    uint32_t u32Slot;
+    uint32_t u32Level;
+
+    if ((int32_t)u32Idx < 0) {
+        /* Already due: the next slot to be processed */
+        u32Slot = m_u32SwtmrClk & SWTMR_LV0_MASK;
+    } else if (u32Idx < SWTMR_LV0_SIZE) {
+        u32Slot = u32Expires & SWTMR_LV0_MASK;
+    } else {
+        u32Level = 1UL;
+        while ((u32Level < SWTMR_LVN_NUM) && (u32Idx >= (1UL << (SWTMR_LVN_SHIFT(u32Level) + SWTMR_LVN_BITS)))) {
+            u32Level++;
+        }
+        u32Slot = SWTMR_LVN_SLOT_BASE(u32Level) + ((u32Expires >> SWTMR_LVN_SHIFT(u32Level)) & SWTMR_LVN_MASK);
+    }
+    SWTMR_Link(pstcTimer, u32Slot);
+}
+
+/**
+ * @brief  Re-hash all timers of a slot of an upper level.
+ * @param  [in] u32Level                Level, 1 ~ SWTMR_LVN_NUM
+ * @param  [in] u32Pos                  Slot position in the level
+ * @retval None
+ */
+static void SWTMR_Cascade(uint32_t u32Level, uint32_t u32Pos)
+{
+    const uint32_t u32Slot = SWTMR_LVN_SLOT_BASE(u32Level) + u32Pos;
+    stc_swtmr_t *pstcTimer = m_apstcSwtmrSlot[u32Slot];
+    stc_swtmr_t *pstcNext;
+
+    m_apstcSwtmrSlot[u32Slot] = NULL;
+    m_au32SwtmrBitmap[u32Slot >> 5U] &= ~SWTMR_SLOT_BIT(u32Slot);
+    while (NULL != pstcTimer) {
+        pstcNext = pstcTimer->pstcNext;
+        SWTMR_AddTimer(pstcTimer);
+        pstcTimer = pstcNext;
+    }
+}
+
+/**
+ * @brief  Find the first non-empty slot of level 0 from a position.
+ * @param  [in] u32From                 Start position
+ * @retval uint32_t                     Slot position, SWTMR_LV0_SIZE if none
+ */
+static uint32_t SWTMR_FindSlot(uint32_t u32From)
+{
+    uint32_t u32Word = u32From >> 5U;
+    uint32_t u32Bits = m_au32SwtmrBitmap[u32Word] & (0xFFFFFFFFUL >> (u32From & 31UL));
+    uint32_t u32Pos = SWTMR_LV0_SIZE;
+
+    for (;;) {
+        if (0UL != u32Bits) {
+            u32Pos = (u32Word << 5U) + __CLZ(u32Bits);
+            break;
+        }
+        u32Word++;
+        if (u32Word >= SWTMR_LV0_BITMAP_WORDS) {
+            break;
+        }
+        u32Bits = m_au32SwtmrBitmap[u32Word];
+    }
+    return u32Pos;
+}
+
+/**
+ * @brief  Check whether any upper level holds a timer.
+ * @param  None
+ * @retval en_flag_status_t             SET if an upper level is not empty
+ */
+static en_flag_status_t SWTMR_UpperPending(void)
+{
+    uint32_t i;
+    en_flag_status_t enRet = RESET;
+
+    for (i = SWTMR_LV0_BITMAP_WORDS; i < SWTMR_BITMAP_WORDS; i++) {
+        if (0UL != m_au32SwtmrBitmap[i]) {
+            enRet = SET;
+            break;
+        }
+    }
+    return enRet;
+}
+
+/**
+ * @brief  Read the current wheel tick.
+ * @note   Must be called with interrupts masked.
+ * @param  None
+ * @retval uint32_t                     Wheel tick
+ */
+static uint32_t SWTMR_ReadTick(void)
+{
+    uint32_t u32Tick = m_u32SwtmrHwBase;
+    uint32_t u32Cnt = TMR0_GetCountValue(m_pstcSwtmrUnit, m_u32SwtmrCh);
+
+    if (SET == TMR0_GetStatus(m_pstcSwtmrUnit, m_u32SwtmrFlag)) {
+        u32Cnt = TMR0_GetCountValue(m_pstcSwtmrUnit, m_u32SwtmrCh);
+        u32Tick += m_u32SwtmrHwPeriod;
+    }
+    return u32Tick + u32Cnt;
+}
+
+/**
+ * @brief  Process all slots up to a wheel tick, expired timers are moved to the expired list.
+ * @param  [in] u32Now                  Current wheel tick
+ * @retval None
+ */
+static void SWTMR_Process(uint32_t u32Now)
+{
+    uint32_t u32Idx;
+    uint32_t u32Pos;
+    uint32_t u32Level;
+    uint32_t u32Step;
+    uint32_t u32Slot;
+    stc_swtmr_t *pstcTimer;
+
+    while ((int32_t)(u32Now - m_u32SwtmrClk) >= 0) {
+        u32Idx = m_u32SwtmrClk & SWTMR_LV0_MASK;
+        if (0UL == u32Idx) {
+            for (u32Level = 1UL; u32Level <= SWTMR_LVN_NUM; u32Level++) {
+                u32Pos = (m_u32SwtmrClk >> SWTMR_LVN_SHIFT(u32Level)) & SWTMR_LVN_MASK;
+                SWTMR_Cascade(u32Level, u32Pos);
+                if (0UL != u32Pos) {
+                    break;
+                }
+            }
+        }
+
+        /* Skip the empty slots, but never beyond the next cascade */
+        u32Slot = SWTMR_FindSlot(u32Idx);
+        u32Step = u32Slot - u32Idx;
+        if ((u32Now - m_u32SwtmrClk) < u32Step) {
+            m_u32SwtmrClk = u32Now + 1UL;
+            break;
+        }
+        m_u32SwtmrClk += u32Step;
+        if (u32Slot < SWTMR_LV0_SIZE) {
+            pstcTimer = m_apstcSwtmrSlot[u32Slot];
+            while (NULL != pstcTimer) {
+                SWTMR_Unlink(pstcTimer);
+                SWTMR_Link(pstcTimer, SWTMR_SLOT_EXPIRED);
+                pstcTimer = m_apstcSwtmrSlot[u32Slot];
+            }
+            m_u32SwtmrClk++;
+        }
+    }
+}
+
+/**
+ * @brief  Program the TMR0 compare value for the next wheel event.
+ * @note   Must be called with interrupts masked.
+ * @param  None
+ * @retval None
+ */
+static void SWTMR_Program(void)
+{
+    const uint32_t u32Idx = m_u32SwtmrClk & SWTMR_LV0_MASK;
+    const en_flag_status_t enUpper = SWTMR_UpperPending();
+    uint32_t u32Slot;
+    uint32_t u32Cnt;
+    uint32_t u32Min;
+    uint32_t u32Next;
+    uint32_t u32Period = SWTMR_PERIOD_MAX;
+    en_flag_status_t enValid = SET;
+
+    u32Slot = SWTMR_FindSlot(u32Idx);
+    if ((SET == enUpper) && (0UL == u32Idx)) {
+        u32Next = m_u32SwtmrClk;
+    } else if (u32Slot < SWTMR_LV0_SIZE) {
+        u32Next = m_u32SwtmrClk + (u32Slot - u32Idx);
+    } else if (SET == enUpper) {
+        u32Next = m_u32SwtmrClk + (SWTMR_LV0_SIZE - u32Idx);
+    } else {
+        /* Slots before the current position belong to the next turn of level 0 */
+        u32Slot = SWTMR_FindSlot(0UL);
+        if (u32Slot < SWTMR_LV0_SIZE) {
+            u32Next = m_u32SwtmrClk + (SWTMR_LV0_SIZE - u32Idx) + u32Slot;
+        } else {
+            u32Next = 0UL;
+            enValid = RESET;
+        }
+    }
+
+    if (SET == enValid) {
+        if ((int32_t)(u32Next - m_u32SwtmrHwBase) <= 0) {
+            u32Period = 0UL;
+        } else if ((u32Next - m_u32SwtmrHwBase) < SWTMR_PERIOD_MAX) {
+            u32Period = u32Next - m_u32SwtmrHwBase;
+        } else {
+            /* Keep SWTMR_PERIOD_MAX */
+        }
+    }
+
+    u32Cnt = TMR0_GetCountValue(m_pstcSwtmrUnit, m_u32SwtmrCh);
+    u32Min = u32Cnt + SWTMR_CLK_MARGIN + 1UL;
+    /* Do not touch the compare value when the match is imminent or pending,
+       the interrupt handler re-programs the period */
+    if ((u32Min <= m_u32SwtmrHwPeriod) && (SET != TMR0_GetStatus(m_pstcSwtmrUnit, m_u32SwtmrFlag))) {
+        u32Period = LL_MAX(u32Period, u32Min);
+        if (u32Period != m_u32SwtmrHwPeriod) {
+            TMR0_SetCompareValue(m_pstcSwtmrUnit, m_u32SwtmrCh, (uint16_t)(u32Period - 1UL));
+            m_u32SwtmrHwPeriod = u32Period;
+        }
+    }
+}
+
+/**
+ * @brief  Run the callbacks of the expired timers in a batch, periodic timers are restarted first.
+ * @param  None
+ * @retval None
+ */
+static void SWTMR_RunExpired(void)
+{
+    stc_swtmr_t *pstcTimer;
+    uint32_t u32Primask;
+
+    for (;;) {
+        u32Primask = __get_PRIMASK();
+        __disable_irq();
+        pstcTimer = m_apstcSwtmrSlot[SWTMR_SLOT_EXPIRED];
+        if (NULL != pstcTimer) {
+            SWTMR_Unlink(pstcTimer);
+            if (0UL != pstcTimer->u32Period) {
+                /* Relative to the previous expiry, so the period does not drift */
+                pstcTimer->u32Expires += pstcTimer->u32Period;
+                SWTMR_AddTimer(pstcTimer);
+                SWTMR_Program();
+            }
+        }
+        __set_PRIMASK(u32Primask);
+
+        if (NULL == pstcTimer) {
+            break;
+        }
+        if (NULL != pstcTimer->pfnCallback) {
+            pstcTimer->pfnCallback(pstcTimer, pstcTimer->pvArg);
+        }
+    }
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup SWTMR_Global_Functions SWTMR Global Functions
+ * @{
+ */
+
+/**
+ * @brief  Set the fields of structure stc_swtmr_init_t to default values.
+ * @param  [out] pstcSwtmrInit          Pointer to a @ref stc_swtmr_init_t structure.
+ * @retval int32_t:
+ *           - LL_OK:                   Initialize success
+ *           - LL_ERR_INVD_PARAM:       pstcSwtmrInit is NULL
+ */
+int32_t SWTMR_StructInit(stc_swtmr_init_t *pstcSwtmrInit)
+{
+    int32_t i32Ret = LL_OK;
+
+    if (NULL == pstcSwtmrInit) {
+        i32Ret = LL_ERR_INVD_PARAM;
+    } else {
+        pstcSwtmrInit->u32ClockSrc = TMR0_CLK_SRC_LRC;
+        pstcSwtmrInit->u32ClockDiv = TMR0_CLK_DIV32;
+    }
+    return i32Ret;
+}
+
+/**
+ * @brief  Initialize the timer wheel and start the TMR0 channel.
+ * @note   All timers are dropped.
+ * @param  [in] TMR0x                   Pointer to TMR0 unit instance
+ *         This parameter can be one of the following values:
+ *           @arg CM_TMR0 or CM_TMR0_x: TMR0 unit instance
+ * @param  [in] u32Ch                   TMR0 channel
+ *         This parameter can be one of the following values:
+ *           @arg @ref TMR0_Channel
+ * @param  [in] pstcSwtmrInit           Pointer to a @ref stc_swtmr_init_t structure.
+ * @retval int32_t:
+ *           - LL_OK:                   Initialize success
+ *           - LL_ERR_INVD_PARAM:       pstcSwtmrInit is NULL
+ */
+int32_t SWTMR_Init(CM_TMR0_TypeDef *TMR0x, uint32_t u32Ch, const stc_swtmr_init_t *pstcSwtmrInit)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+    uint32_t i;
+    stc_tmr0_init_t stcTmr0Init;
+
+    if (NULL != pstcSwtmrInit) {
+        DDL_ASSERT(IS_SWTMR_TMR0_UNIT(TMR0x));
+        DDL_ASSERT(IS_SWTMR_TMR0_CH(u32Ch));
+        DDL_ASSERT(IS_SWTMR_CLK_SRC(pstcSwtmrInit->u32ClockSrc));
+
+        (void)TMR0_StructInit(&stcTmr0Init);
+        stcTmr0Init.u32ClockSrc     = pstcSwtmrInit->u32ClockSrc;
+        stcTmr0Init.u32ClockDiv     = pstcSwtmrInit->u32ClockDiv;
+        stcTmr0Init.u32Func         = TMR0_FUNC_CMP;
+        stcTmr0Init.u16CompareValue = (uint16_t)(SWTMR_PERIOD_MAX - 1UL);
+
+        TMR0_Stop(TMR0x, u32Ch);
+        i32Ret = TMR0_Init(TMR0x, u32Ch, &stcTmr0Init);
+        if (LL_OK == i32Ret) {
+            for (i = 0UL; i <= SWTMR_SLOT_NUM; i++) {
+                m_apstcSwtmrSlot[i] = NULL;
+            }
+            for (i = 0UL; i < SWTMR_BITMAP_WORDS; i++) {
+                m_au32SwtmrBitmap[i] = 0UL;
+            }
+            m_pstcSwtmrUnit    = TMR0x;
+            m_u32SwtmrCh       = u32Ch;
+            m_u32SwtmrFlag     = (TMR0_CH_A == u32Ch) ? TMR0_FLAG_CMP_A : TMR0_FLAG_CMP_B;
+            m_u32SwtmrHwBase   = 0UL;
+            m_u32SwtmrHwPeriod = SWTMR_PERIOD_MAX;
+            m_u32SwtmrClk      = 0UL;
+
+            TMR0_ClearStatus(TMR0x, m_u32SwtmrFlag);
+            TMR0_IntCmd(TMR0x, (TMR0_CH_A == u32Ch) ? TMR0_INT_CMP_A : TMR0_INT_CMP_B, ENABLE);
+            TMR0_Start(TMR0x, u32Ch);
+        }
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Stop the TMR0 channel of the timer wheel.
+ * @param  None
+ * @retval None
+ */
+void SWTMR_DeInit(void)
+{
+    if (NULL != m_pstcSwtmrUnit) {
+        TMR0_Stop(m_pstcSwtmrUnit, m_u32SwtmrCh);
+        TMR0_IntCmd(m_pstcSwtmrUnit, (TMR0_CH_A == m_u32SwtmrCh) ? TMR0_INT_CMP_A : TMR0_INT_CMP_B, DISABLE);
+        TMR0_ClearStatus(m_pstcSwtmrUnit, m_u32SwtmrFlag);
+        m_pstcSwtmrUnit = NULL;
+    }
+}
+
+/**
+ * @brief  Initialize a software timer structure.
+ * @param  [out] pstcTimer              Pointer to a @ref stc_swtmr_t structure.
+ * @param  [in] pfnCallback             Expiry callback, called from SWTMR_IrqHandler()
+ * @param  [in] pvArg                   Argument of the expiry callback
+ * @param  [in] u32Period               Reload in wheel ticks, 0 for a one-shot timer
+ * @retval None
+ */
+void SWTMR_TimerInit(stc_swtmr_t *pstcTimer, void (*pfnCallback)(stc_swtmr_t *pstcTimer, void *pvArg),
+                     void *pvArg, uint32_t u32Period)
+{
+    DDL_ASSERT(NULL != pstcTimer);
+    DDL_ASSERT(u32Period <= SWTMR_DELAY_MAX);
+
+    pstcTimer->pstcNext    = NULL;
+    pstcTimer->pstcPrev    = NULL;
+    pstcTimer->u32Expires  = 0UL;
+    pstcTimer->u16Slot     = SWTMR_SLOT_NONE;
+    pstcTimer->u32Period   = u32Period;
+    pstcTimer->pfnCallback = pfnCallback;
+    pstcTimer->pvArg       = pvArg;
+}
+
+/**
+ * @brief  Start or restart a software timer.
+ * @param  [in] pstcTimer               Pointer to a @ref stc_swtmr_t structure.
+ * @param  [in] u32Delay                Delay in wheel ticks, up to SWTMR_DELAY_MAX
+ * @retval int32_t:
+ *           - LL_OK:                   Timer started
+ *           - LL_ERR_INVD_PARAM:       pstcTimer is NULL or u32Delay is out of range
+ *           - LL_ERR_UNINIT:           The timer wheel is not initialized
+ */
+int32_t SWTMR_Start(stc_swtmr_t *pstcTimer, uint32_t u32Delay)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+    uint32_t u32Primask;
+
+    if ((NULL != pstcTimer) && (u32Delay <= SWTMR_DELAY_MAX)) {
+        if (NULL == m_pstcSwtmrUnit) {
+            i32Ret = LL_ERR_UNINIT;
+        } else {
+            u32Primask = __get_PRIMASK();
+            __disable_irq();
+            if (SWTMR_SLOT_NONE != pstcTimer->u16Slot) {
+                SWTMR_Unlink(pstcTimer);
+            }
+            pstcTimer->u32Expires = SWTMR_ReadTick() + u32Delay;
+            SWTMR_AddTimer(pstcTimer);
+            SWTMR_Program();
+            __set_PRIMASK(u32Primask);
+            i32Ret = LL_OK;
+        }
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Stop a software timer, also if it is expired and its callback is not called yet.
+ * @param  [in] pstcTimer               Pointer to a @ref stc_swtmr_t structure.
+ * @retval None
+ */
+void SWTMR_Stop(stc_swtmr_t *pstcTimer)
+{
+    uint32_t u32Primask;
+
+    if (NULL != pstcTimer) {
+        u32Primask = __get_PRIMASK();
+        __disable_irq();
+        if (SWTMR_SLOT_NONE != pstcTimer->u16Slot) {
+            SWTMR_Unlink(pstcTimer);
+        }
+        __set_PRIMASK(u32Primask);
+    }
+}
+
+/**
+ * @brief  Get the status of a software timer.
+ * @param  [in] pstcTimer               Pointer to a @ref stc_swtmr_t structure.
+ * @retval An @ref en_flag_status_t enumeration type value, SET if the timer is started.
+ */
+en_flag_status_t SWTMR_GetStatus(const stc_swtmr_t *pstcTimer)
+{
+    DDL_ASSERT(NULL != pstcTimer);
+
+    return (SWTMR_SLOT_NONE != pstcTimer->u16Slot) ? SET : RESET;
+}
+
+/**
+ * @brief  Get the current wheel tick.
+ * @param  None
+ * @retval uint32_t                     Wheel tick, wraps around at 2^32
+ */
+uint32_t SWTMR_GetTick(void)
+{
+    uint32_t u32Tick = 0UL;
+    uint32_t u32Primask;
+
+    if (NULL != m_pstcSwtmrUnit) {
+        u32Primask = __get_PRIMASK();
+        __disable_irq();
+        u32Tick = SWTMR_ReadTick();
+        __set_PRIMASK(u32Primask);
+    }
+    return u32Tick;
+}
+
+/**
+ * @brief  Timer wheel interrupt handler, call it from the TMR0 channel compare interrupt.
+ * @param  None
+ * @retval None
+ */
+void SWTMR_IrqHandler(void)
+{
+    uint32_t u32Primask;
+
+    if (NULL != m_pstcSwtmrUnit) {
+        u32Primask = __get_PRIMASK();
+        __disable_irq();
+        if (SET == TMR0_GetStatus(m_pstcSwtmrUnit, m_u32SwtmrFlag)) {
+            TMR0_ClearStatus(m_pstcSwtmrUnit, m_u32SwtmrFlag);
+            m_u32SwtmrHwBase += m_u32SwtmrHwPeriod;
+        }
+        SWTMR_Process(SWTMR_ReadTick());
+        SWTMR_Program();
+        __set_PRIMASK(u32Primask);
+
+        SWTMR_RunExpired();
+    }
+}
+
+/**
+ * @}
+ */
+
+#endif /* LL_SWTMR_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/******************************************************************************
+ * EOF (not truncated)
+ *****************************************************************************/
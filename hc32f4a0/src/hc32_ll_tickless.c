@@ -0,0 +1,615 @@
+/**
+ *******************************************************************************
+ * @file  hc32_ll_tickless.c
+ * @brief This file provides firmware functions to manage the tickless time
+ *        base built on a TMR0 compare channel.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       CDT             First version
+                                    Enable the compare interrupt for the delays while suspended by SysTick_Suspend()
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2025, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ll_tickless.h"
+#include "hc32_ll_tmr0.h"
+#include "hc32_ll_pwc.h"
+#include "hc32_ll_utility.h"
+
+/**
+ * @addtogroup LL_Driver
+ * @{
+ */
+
+/**
+ * @defgroup LL_TICKLESS TICKLESS
+ * @brief Tickless Time Base Driver Library
+ * @note  The time base keeps a 64-bit monotonic count of TMR0 clocks. The TMR0
+ *        compare value is programmed for the next deadline only (one-shot), so
+ *        the core is woken up when an alarm or a delay expires, or at the latest
+ *        once per 65536 counts to extend the counter.
+ *        TICKLESS_IrqHandler() must be called from the compare interrupt of the
+ *        selected TMR0 channel, the TMR0 peripheral clock and the interrupt
+ *        registration are left to the application.
+ * @{
+ */
+
+#if (LL_TICKLESS_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup TICKLESS_Local_Types TICKLESS Local Types
+ * @{
+ */
+
+/**
+ * @brief Tickless time base state
+ */
+typedef struct {
+    CM_TMR0_TypeDef *TMR0x;             /*!< TMR0 unit of the time base */
+    uint32_t u32Ch;                     /*!< TMR0 channel of the time base */
+    uint32_t u32Flag;                   /*!< Compare flag of the channel */
+    uint32_t u32Freq;                   /*!< Count frequency in Hz */
+    uint32_t u32Margin;                 /*!< Minimum compare distance in counts */
+    uint64_t u64Base;                   /*!< Count at the start of the current period */
+    uint32_t u32Period;                 /*!< Length of the current period (compare value + 1) */
+    uint64_t u64Alarm;                  /*!< Alarm deadline */
+    uint64_t u64Wait;                   /*!< Delay deadline */
+    func_ptr_t pfnAlarmCallback;        /*!< Alarm callback */
+    uint8_t u8Suspend;                  /*!< Compare interrupt disabled by SysTick_Suspend() */
+} stc_tickless_state_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup TICKLESS_Local_Macros TICKLESS Local Macros
+ * @{
+ */
+
+/* Compare interrupt of the channel */
+#define TICKLESS_INT_CMP(ch)            ((TMR0_CH_A == (ch)) ? TMR0_INT_CMP_A : TMR0_INT_CMP_B)
+
+/* Longest period of the 16-bit counter */
+#define TICKLESS_PERIOD_MAX             (0x10000UL)
+
+#define TICKLESS_US_PER_SEC             (1000000UL)
+#define TICKLESS_MS_PER_SEC             (1000UL)
+
+/**
+ * @defgroup TICKLESS_Check_Parameters_Validity TICKLESS Check Parameters Validity
+ * @{
+ */
+#define IS_TICKLESS_TMR0_UNIT(x)                                               \
+(   ((x) == CM_TMR0_1)                              ||                         \
+    ((x) == CM_TMR0_2))
+
+#define IS_TICKLESS_TMR0_CH(x)                                                 \
+(   ((x) == TMR0_CH_A)                              ||                         \
+    ((x) == TMR0_CH_B))
+
+#define IS_TICKLESS_CLK_SRC(x)                                                 \
+(   ((x) == TMR0_CLK_SRC_INTERN_CLK)                ||                         \
+    ((x) == TMR0_CLK_SRC_LRC)                       ||                         \
+    ((x) == TMR0_CLK_SRC_XTAL32))
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+/**
+ * @defgroup TICKLESS_Local_Variables TICKLESS Local Variables
+ * @{
+ */
+static stc_tickless_state_t m_stcTickless;
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @defgroup TICKLESS_Local_Functions TICKLESS Local Functions
+ * @{
+ */
+
+/**
+ * @brief  Read the 64-bit count.
+ * @note   Must be called with interrupts masked. A compare match that is not
+ *         serviced yet is accounted, since the counter has already restarted.
+ * @param  None
+ * @retval uint64_t                     The current count
+ */
+static uint64_t TICKLESS_ReadCount(void)
+{
+    uint64_t u64Count = m_stcTickless.u64Base;
+    uint32_t u32Cnt = TMR0_GetCountValue(m_stcTickless.TMR0x, m_stcTickless.u32Ch);
+
+    if (SET == TMR0_GetStatus(m_stcTickless.TMR0x, m_stcTickless.u32Flag)) {
+        /* Re-read: the first value may have been taken before the counter cleared */
+        u32Cnt = TMR0_GetCountValue(m_stcTickless.TMR0x, m_stcTickless.u32Ch);
+        u64Count += m_stcTickless.u32Period;
+    }
+
+    return u64Count + u32Cnt;
+}
+
+/**
+ * @brief  Program the compare value of the current period for the nearest deadline.
+ * @note   Must be called with interrupts masked and without pending compare match.
+ * @param  None
+ * @retval None
+ */
+static void TICKLESS_Program(void)
+{
+    uint64_t u64Deadline = LL_MIN(m_stcTickless.u64Alarm, m_stcTickless.u64Wait);
+    uint32_t u32Cnt = TMR0_GetCountValue(m_stcTickless.TMR0x, m_stcTickless.u32Ch);
+    uint32_t u32Min = u32Cnt + m_stcTickless.u32Margin + 1UL;
+    uint32_t u32Period = TICKLESS_PERIOD_MAX;
+
+    /* The current compare match is imminent, the interrupt handler programs the next period */
+    if (u32Min <= m_stcTickless.u32Period) {
+        if (u64Deadline < (m_stcTickless.u64Base + TICKLESS_PERIOD_MAX)) {
+            if (u64Deadline > m_stcTickless.u64Base) {
+                u32Period = (uint32_t)(u64Deadline - m_stcTickless.u64Base);
+            } else {
+                u32Period = 0UL;
+            }
+        }
+        /* Never program a compare value the counter has already passed */
+        u32Period = LL_MAX(u32Period, u32Min);
+
+        if (u32Period != m_stcTickless.u32Period) {
+            TMR0_SetCompareValue(m_stcTickless.TMR0x, m_stcTickless.u32Ch, (uint16_t)(u32Period - 1UL));
+            m_stcTickless.u32Period = u32Period;
+        }
+    }
+}
+
+/**
+ * @brief  Convert microseconds to counts, rounded up.
+ * @param  [in] u32Us                   Microseconds
+ * @retval uint64_t                     Counts
+ */
+static uint64_t TICKLESS_UsToTick(uint32_t u32Us)
+{
+    return (((uint64_t)u32Us * m_stcTickless.u32Freq) + (TICKLESS_US_PER_SEC - 1UL)) / TICKLESS_US_PER_SEC;
+}
+
+/**
+ * @brief  Sleep until the count reaches the deadline.
+ * @note   The compare interrupt wakes the core up, so it is enabled for the wait
+ *         if SysTick_Suspend() disabled it, and disabled again before returning.
+ * @param  [in] u64Deadline             Deadline in counts
+ * @retval None
+ */
+static void TICKLESS_SleepUntil(uint64_t u64Deadline)
+{
+    uint32_t u32Primask = __get_PRIMASK();
+    uint8_t u8Suspend;
+
+    __disable_irq();
+    u8Suspend = m_stcTickless.u8Suspend;
+    if (0U != u8Suspend) {
+        TMR0_IntCmd(m_stcTickless.TMR0x, TICKLESS_INT_CMP(m_stcTickless.u32Ch), ENABLE);
+    }
+    m_stcTickless.u64Wait = u64Deadline;
+    if (SET != TMR0_GetStatus(m_stcTickless.TMR0x, m_stcTickless.u32Flag)) {
+        TICKLESS_Program();
+    }
+    while (TICKLESS_ReadCount() < u64Deadline) {
+        /* WFI wakes up on a pending interrupt even if PRIMASK is set, so no wake-up can be lost */
+        if (PWC_FPRC_FPRCB1 == READ_REG16_BIT(CM_PWC->FPRC, PWC_FPRC_FPRCB1)) {
+            PWC_SLEEP_Enter(PWC_SLEEP_WFI);
+        } else {
+            /* PWC registers locked: sleep mode only, never the stop mode left configured */
+            CLR_REG32_BIT(SCB->SCR, SCB_SCR_SLEEPDEEP_Msk);
+            __WFI();
+        }
+        __enable_irq();
+        __ISB();
+        __disable_irq();
+    }
+    m_stcTickless.u64Wait = TICKLESS_ALARM_NONE;
+    if (0U != u8Suspend) {
+        TMR0_IntCmd(m_stcTickless.TMR0x, TICKLESS_INT_CMP(m_stcTickless.u32Ch), DISABLE);
+    }
+    __set_PRIMASK(u32Primask);
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup TICKLESS_Global_Functions TICKLESS Global Functions
+ * @{
+ */
+
+/**
+ * @brief  Set the fields of structure stc_tickless_init_t to default values.
+ * @param  [out] pstcTicklessInit       Pointer to a @ref stc_tickless_init_t structure.
+ * @retval int32_t:
+ *           - LL_OK:                   Initialize success
+ *           - LL_ERR_INVD_PARAM:       pstcTicklessInit is NULL
+ */
+int32_t TICKLESS_StructInit(stc_tickless_init_t *pstcTicklessInit)
+{
+    int32_t i32Ret = LL_OK;
+
+    if (NULL == pstcTicklessInit) {
+        i32Ret = LL_ERR_INVD_PARAM;
+    } else {
+        pstcTicklessInit->u32ClockSrc      = TMR0_CLK_SRC_LRC;
+        pstcTicklessInit->u32ClockDiv      = TMR0_CLK_DIV1;
+        pstcTicklessInit->u32ClockFreq     = 32768UL;
+        pstcTicklessInit->pfnAlarmCallback = NULL;
+    }
+    return i32Ret;
+}
+
+/**
+ * @brief  Initialize the tickless time base and start counting from 0.
+ * @param  [in] TMR0x                   Pointer to TMR0 unit instance
+ *         This parameter can be one of the following values:
+ *           @arg CM_TMR0 or CM_TMR0_x: TMR0 unit instance
+ * @param  [in] u32Ch                   TMR0 channel
+ *         This parameter can be one of the following values:
+ *           @arg @ref TMR0_Channel
+ * @param  [in] pstcTicklessInit        Pointer to a @ref stc_tickless_init_t structure.
+ * @retval int32_t:
+ *           - LL_OK:                   Initialize success
+ *           - LL_ERR_INVD_PARAM:       pstcTicklessInit is NULL or the count frequency is 0
+ */
+int32_t TICKLESS_Init(CM_TMR0_TypeDef *TMR0x, uint32_t u32Ch, const stc_tickless_init_t *pstcTicklessInit)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+    uint32_t u32Freq;
+    stc_tmr0_init_t stcTmr0Init;
+
+    if (NULL != pstcTicklessInit) {
+        DDL_ASSERT(IS_TICKLESS_TMR0_UNIT(TMR0x));
+        DDL_ASSERT(IS_TICKLESS_TMR0_CH(u32Ch));
+        DDL_ASSERT(IS_TICKLESS_CLK_SRC(pstcTicklessInit->u32ClockSrc));
+
+        u32Freq = pstcTicklessInit->u32ClockFreq >> (pstcTicklessInit->u32ClockDiv >> TMR0_BCONR_CKDIVA_POS);
+        if (0UL != u32Freq) {
+            (void)TMR0_StructInit(&stcTmr0Init);
+            stcTmr0Init.u32ClockSrc     = pstcTicklessInit->u32ClockSrc;
+            stcTmr0Init.u32ClockDiv     = pstcTicklessInit->u32ClockDiv;
+            stcTmr0Init.u32Func         = TMR0_FUNC_CMP;
+            stcTmr0Init.u16CompareValue = (uint16_t)(TICKLESS_PERIOD_MAX - 1UL);
+
+            TMR0_Stop(TMR0x, u32Ch);
+            i32Ret = TMR0_Init(TMR0x, u32Ch, &stcTmr0Init);
+            if (LL_OK == i32Ret) {
+                m_stcTickless.TMR0x            = TMR0x;
+                m_stcTickless.u32Ch            = u32Ch;
+                m_stcTickless.u32Flag          = (TMR0_CH_A == u32Ch) ? TMR0_FLAG_CMP_A : TMR0_FLAG_CMP_B;
+                m_stcTickless.u32Freq          = u32Freq;
+                m_stcTickless.u32Margin        = (TMR0_CLK_SRC_INTERN_CLK == pstcTicklessInit->u32ClockSrc) ?
+                                                 TICKLESS_SYNC_CLK_MARGIN : TICKLESS_ASYNC_CLK_MARGIN;
+                m_stcTickless.u64Base          = 0ULL;
+                m_stcTickless.u32Period        = TICKLESS_PERIOD_MAX;
+                m_stcTickless.u64Alarm         = TICKLESS_ALARM_NONE;
+                m_stcTickless.u64Wait          = TICKLESS_ALARM_NONE;
+                m_stcTickless.pfnAlarmCallback = pstcTicklessInit->pfnAlarmCallback;
+                m_stcTickless.u8Suspend        = 0U;
+
+                TMR0_ClearStatus(TMR0x, m_stcTickless.u32Flag);
+                TMR0_IntCmd(TMR0x, TICKLESS_INT_CMP(u32Ch), ENABLE);
+                TMR0_Start(TMR0x, u32Ch);
+            }
+        }
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  De-initialize the tickless time base and stop the TMR0 channel.
+ * @param  None
+ * @retval None
+ */
+void TICKLESS_DeInit(void)
+{
+    if (NULL != m_stcTickless.TMR0x) {
+        TMR0_Stop(m_stcTickless.TMR0x, m_stcTickless.u32Ch);
+        TMR0_IntCmd(m_stcTickless.TMR0x, TICKLESS_INT_CMP(m_stcTickless.u32Ch), DISABLE);
+        TMR0_ClearStatus(m_stcTickless.TMR0x, m_stcTickless.u32Flag);
+        m_stcTickless.TMR0x = NULL;
+    }
+}
+
+/**
+ * @brief  Get the 64-bit monotonic count since TICKLESS_Init().
+ * @param  None
+ * @retval uint64_t                     Count in units of 1/TICKLESS_GetTickFreq() second
+ */
+uint64_t TICKLESS_GetTick(void)
+{
+    uint64_t u64Count;
+    uint32_t u32Primask = __get_PRIMASK();
+
+    __disable_irq();
+    u64Count = TICKLESS_ReadCount();
+    __set_PRIMASK(u32Primask);
+
+    return u64Count;
+}
+
+/**
+ * @brief  Get the monotonic time since TICKLESS_Init() in microseconds.
+ * @param  None
+ * @retval uint64_t                     Microseconds, 0 before TICKLESS_Init()
+ */
+uint64_t TICKLESS_GetTimeUS(void)
+{
+    uint64_t u64Us = 0ULL;
+    const uint32_t u32Freq = m_stcTickless.u32Freq;
+    uint64_t u64Count;
+
+    if (0UL != u32Freq) {
+        u64Count = TICKLESS_GetTick();
+        /* Split the conversion to avoid the overflow of count * 1000000 */
+        u64Us = ((u64Count / u32Freq) * TICKLESS_US_PER_SEC) +
+                (((u64Count % u32Freq) * TICKLESS_US_PER_SEC) / u32Freq);
+    }
+
+    return u64Us;
+}
+
+/**
+ * @brief  Get the count frequency of the time base.
+ * @param  None
+ * @retval uint32_t                     Count frequency in Hz
+ */
+uint32_t TICKLESS_GetTickFreq(void)
+{
+    return m_stcTickless.u32Freq;
+}
+
+/**
+ * @brief  Set the one-shot alarm.
+ * @note   The alarm callback is called from TICKLESS_IrqHandler(). A deadline in the
+ *         past expires as soon as possible. A previous alarm is replaced.
+ * @param  [in] u64Tick                 Absolute deadline, compare with TICKLESS_GetTick()
+ * @retval int32_t:
+ *           - LL_OK:                   Alarm set
+ *           - LL_ERR_UNINIT:           The time base is not initialized
+ */
+int32_t TICKLESS_SetAlarm(uint64_t u64Tick)
+{
+    int32_t i32Ret = LL_ERR_UNINIT;
+    uint32_t u32Primask;
+
+    if (NULL != m_stcTickless.TMR0x) {
+        u32Primask = __get_PRIMASK();
+        __disable_irq();
+        m_stcTickless.u64Alarm = u64Tick;
+        /* A pending compare match re-programs the period in the interrupt handler */
+        if (SET != TMR0_GetStatus(m_stcTickless.TMR0x, m_stcTickless.u32Flag)) {
+            TICKLESS_Program();
+        }
+        __set_PRIMASK(u32Primask);
+        i32Ret = LL_OK;
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Cancel the one-shot alarm.
+ * @param  None
+ * @retval None
+ */
+void TICKLESS_CancelAlarm(void)
+{
+    uint32_t u32Primask = __get_PRIMASK();
+
+    __disable_irq();
+    m_stcTickless.u64Alarm = TICKLESS_ALARM_NONE;
+    __set_PRIMASK(u32Primask);
+}
+
+/**
+ * @brief  Delay in microseconds, the core sleeps while waiting.
+ * @note   With the PWC registers locked the core sleeps by WFI directly.
+ *         While suspended by SysTick_Suspend(), the compare interrupt is enabled
+ *         for the delay, an expiring alarm calls its callback during the delay.
+ * @param  [in] u32Count                Microseconds
+ * @retval None
+ */
+void TICKLESS_DelayUS(uint32_t u32Count)
+{
+    uint64_t u64Deadline;
+
+    if (NULL != m_stcTickless.TMR0x) {
+        u64Deadline = TICKLESS_GetTick() + TICKLESS_UsToTick(u32Count);
+        TICKLESS_SleepUntil(u64Deadline);
+    }
+}
+
+/**
+ * @brief  Delay in milliseconds, the core sleeps while waiting.
+ * @note   With the PWC registers locked the core sleeps by WFI directly.
+ *         While suspended by SysTick_Suspend(), the compare interrupt is enabled
+ *         for the delay, an expiring alarm calls its callback during the delay.
+ * @param  [in] u32Count                Milliseconds
+ * @retval None
+ */
+void TICKLESS_DelayMS(uint32_t u32Count)
+{
+    uint64_t u64Deadline;
+
+    if (NULL != m_stcTickless.TMR0x) {
+        u64Deadline = TICKLESS_GetTick() +
+                      ((((uint64_t)u32Count * m_stcTickless.u32Freq) + (TICKLESS_MS_PER_SEC - 1UL)) / TICKLESS_MS_PER_SEC);
+        TICKLESS_SleepUntil(u64Deadline);
+    }
+}
+
+/**
+ * @brief  Tickless time base interrupt handler, call it from the TMR0 channel compare interrupt.
+ * @param  None
+ * @retval None
+ */
+void TICKLESS_IrqHandler(void)
+{
+    func_ptr_t pfnCallback = NULL;
+    uint32_t u32Primask = __get_PRIMASK();
+
+    __disable_irq();
+    if ((NULL != m_stcTickless.TMR0x) &&
+        (SET == TMR0_GetStatus(m_stcTickless.TMR0x, m_stcTickless.u32Flag))) {
+        TMR0_ClearStatus(m_stcTickless.TMR0x, m_stcTickless.u32Flag);
+        m_stcTickless.u64Base += m_stcTickless.u32Period;
+
+        if (m_stcTickless.u64Alarm <= TICKLESS_ReadCount()) {
+            m_stcTickless.u64Alarm = TICKLESS_ALARM_NONE;
+            pfnCallback = m_stcTickless.pfnAlarmCallback;
+        }
+        TICKLESS_Program();
+    }
+    __set_PRIMASK(u32Primask);
+
+    if (NULL != pfnCallback) {
+        pfnCallback();
+    }
+}
+
+#if (TICKLESS_SYSTICK_REPLACE == DDL_ON)
+/**
+ * @brief  SysTick initialization is replaced by TICKLESS_Init(), no periodic interrupt is used.
+ * @param  [in] u32Freq                 Unused.
+ * @retval int32_t:
+ *           - LL_OK:                   The time base is running
+ *           - LL_ERR:                  The time base is not initialized
+ */
+int32_t SysTick_Init(uint32_t u32Freq)
+{
+    (void)u32Freq;
+    return (NULL != m_stcTickless.TMR0x) ? LL_OK : LL_ERR;
+}
+
+/**
+ * @brief  Delay in milliseconds on the tickless time base.
+ * @param  [in] u32Delay                Delay specifies the delay time.
+ * @retval None
+ */
+void SysTick_Delay(uint32_t u32Delay)
+{
+    TICKLESS_DelayMS(u32Delay);
+}
+
+/**
+ * @brief  Service the time base, for applications calling it from their tick interrupt.
+ * @note   Same as TICKLESS_IrqHandler(), nothing is done without a pending compare match.
+ * @param  None
+ * @retval None
+ */
+void SysTick_IncTick(void)
+{
+    TICKLESS_IrqHandler();
+}
+
+/**
+ * @brief  Provides a tick value in millisecond.
+ * @param  None
+ * @retval Tick value
+ */
+uint32_t SysTick_GetTick(void)
+{
+    return (uint32_t)(TICKLESS_GetTimeUS() / TICKLESS_MS_PER_SEC);
+}
+
+/**
+ * @brief  Suspend the time base interrupt.
+ * @note   The counter keeps running, but a suspension longer than 65536 counts
+ *         loses the periods in between, like the SysTick ticks lost while suspended.
+ *         SysTick_Delay() still works, the interrupt is enabled for the delay only.
+ * @param  None
+ * @retval None
+ */
+void SysTick_Suspend(void)
+{
+    uint32_t u32Primask;
+
+    if (NULL != m_stcTickless.TMR0x) {
+        u32Primask = __get_PRIMASK();
+        __disable_irq();
+        m_stcTickless.u8Suspend = 1U;
+        TMR0_IntCmd(m_stcTickless.TMR0x, TICKLESS_INT_CMP(m_stcTickless.u32Ch), DISABLE);
+        __set_PRIMASK(u32Primask);
+    }
+}
+
+/**
+ * @brief  Resume the time base interrupt.
+ * @param  None
+ * @retval None
+ */
+void SysTick_Resume(void)
+{
+    uint32_t u32Primask;
+
+    if (NULL != m_stcTickless.TMR0x) {
+        u32Primask = __get_PRIMASK();
+        __disable_irq();
+        m_stcTickless.u8Suspend = 0U;
+        TMR0_IntCmd(m_stcTickless.TMR0x, TICKLESS_INT_CMP(m_stcTickless.u32Ch), ENABLE);
+        __set_PRIMASK(u32Primask);
+    }
+}
+#endif /* TICKLESS_SYSTICK_REPLACE */
+
+/**
+ * @}
+ */
+
+#endif /* LL_TICKLESS_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/******************************************************************************
+ * EOF (not truncated)
+ *****************************************************************************/
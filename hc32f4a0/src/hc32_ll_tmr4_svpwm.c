@@ -0,0 +1,324 @@
+/**
+ *******************************************************************************
+ * @file  hc32_ll_tmr4_svpwm.c
+ * @brief This file provides firmware functions to drive a three-phase bridge
+ *        with space vector PWM on TMR4.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2025, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ll_tmr4_svpwm.h"
+#include "hc32_ll_tmr4.h"
+#include "hc32_ll_utility.h"
+
+/**
+ * @addtogroup LL_Driver
+ * @{
+ */
+
+/**
+ * @defgroup LL_TMR4_SVPWM TMR4_SVPWM
+ * @brief TMR4 Space Vector PWM Driver Library
+ * @note  The voltage command (alpha, beta) is given in Q15 of the DC link voltage. The phase
+ *        references get the min-max zero sequence, which gives the duty cycles of the seven
+ *        segment space vector modulation without angle or sector lookup. The counter runs in
+ *        triangle mode and the OC modes of the U/V/W high channels shall make the high side
+ *        active while the counter is below the compare value.
+ *        The ADC trigger of the EVT channel is placed each cycle in the middle of the longest
+ *        interval without switching edge: around the valley, around the peak, or between two
+ *        phase edges. The compare values are buffered to the valley, so that the new values
+ *        and the matching trigger point are used from the next cycle on.
+ * @{
+ */
+
+#if (LL_TMR4_SVPWM_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup TMR4_SVPWM_Local_Macros TMR4_SVPWM Local Macros
+ * @{
+ */
+#define TMR4_SVPWM_Q15_HALF             (16384L)
+#define TMR4_SVPWM_SQRT3_2              (28378L)    /*!< sqrt(3)/2 in Q15 */
+
+#define TMR4_SVPWM_TRIG_COND_MASK       (TMR4_EVT_MATCH_CNT_UP | TMR4_EVT_MATCH_CNT_DOWN)
+
+/* OC high channel of phase 0..2 */
+#define TMR4_SVPWM_OC_CH(x)             (TMR4_OC_CH_UH + (2UL * (uint32_t)(x)))
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+/* Sector from the phases of the highest and lowest reference */
+static const uint8_t m_au8Sector[3][3] = {
+    {0U, 6U, 1U},
+    {3U, 0U, 2U},
+    {4U, 5U, 0U},
+};
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @defgroup TMR4_SVPWM_Global_Functions TMR4_SVPWM Global Functions
+ * @{
+ */
+
+/**
+ * @brief  Set the default value of each member of stc_tmr4_svpwm_init_t.
+ * @param  [out] pstcSvpwmInit          Pointer to a @ref stc_tmr4_svpwm_init_t structure.
+ * @retval int32_t:
+ *           - LL_OK:                   No error occurred.
+ *           - LL_ERR_INVD_PARAM:       pstcSvpwmInit == NULL.
+ */
+int32_t TMR4_SVPWM_StructInit(stc_tmr4_svpwm_init_t *pstcSvpwmInit)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if (NULL != pstcSvpwmInit) {
+        pstcSvpwmInit->TMR4x          = NULL;
+        pstcSvpwmInit->u32EvtCh       = TMR4_EVT_CH_UH;
+        pstcSvpwmInit->u16DeadTime    = 0U;
+        pstcSvpwmInit->u16SettleTicks = 0U;
+        pstcSvpwmInit->u16SampleTicks = 0U;
+        i32Ret = LL_OK;
+    }
+    return i32Ret;
+}
+
+/**
+ * @brief  Initialize the SVPWM of a TMR4 unit.
+ * @param  [out] pstcSvpwm              Pointer to a @ref stc_tmr4_svpwm_t structure.
+ * @param  [in] pstcSvpwmInit           Pointer to a @ref stc_tmr4_svpwm_init_t structure.
+ * @retval int32_t:
+ *           - LL_OK:                   No error occurred.
+ *           - LL_ERR_INVD_PARAM:       NULL pointer.
+ * @note   The counter, the OC and PWM channels and the EVT channel (compare mode and output
+ *         event) must be configured before, the period must not change afterwards.
+ *         The compare buffers and the EVT match condition are configured here.
+ */
+int32_t TMR4_SVPWM_Init(stc_tmr4_svpwm_t *pstcSvpwm, const stc_tmr4_svpwm_init_t *pstcSvpwmInit)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+    CM_TMR4_TypeDef *TMR4x;
+    uint32_t i;
+
+    if ((NULL != pstcSvpwm) && (NULL != pstcSvpwmInit) && (NULL != pstcSvpwmInit->TMR4x)) {
+        TMR4x = pstcSvpwmInit->TMR4x;
+        pstcSvpwm->TMR4x         = TMR4x;
+        pstcSvpwm->u32EvtCh      = pstcSvpwmInit->u32EvtCh;
+        pstcSvpwm->u16Period     = TMR4_GetPeriodValue(TMR4x);
+        pstcSvpwm->u16Guard      = pstcSvpwmInit->u16DeadTime + pstcSvpwmInit->u16SettleTicks;
+        pstcSvpwm->u16SampleHalf = pstcSvpwmInit->u16SampleTicks / 2U;
+        pstcSvpwm->u16TrigCond   = TMR4_EVT_MATCH_CNT_DOWN;
+
+        for (i = 0UL; i < 3UL; i++) {
+            TMR4_OC_SetCompareBufCond(TMR4x, TMR4_SVPWM_OC_CH(i), TMR4_OC_BUF_CMP_VALUE, TMR4_OC_BUF_COND_VALLEY);
+            TMR4_OC_SetCompareValue(TMR4x, TMR4_SVPWM_OC_CH(i), pstcSvpwm->u16Period / 2U);
+            if (0U != pstcSvpwmInit->u16DeadTime) {
+                TMR4_PWM_SetDeadTimeValue(TMR4x, TMR4_PWM_CH_U + i, TMR4_PWM_PDAR_IDX, pstcSvpwmInit->u16DeadTime);
+                TMR4_PWM_SetDeadTimeValue(TMR4x, TMR4_PWM_CH_U + i, TMR4_PWM_PDBR_IDX, pstcSvpwmInit->u16DeadTime);
+            }
+        }
+
+        /* Sample around the valley until the first update */
+        TMR4_EVT_SetCompareBufCond(TMR4x, pstcSvpwm->u32EvtCh, TMR4_EVT_BUF_COND_VALLEY);
+        TMR4_EVT_MatchCondCmd(TMR4x, pstcSvpwm->u32EvtCh, TMR4_EVT_MATCH_CNT_ALL, DISABLE);
+        TMR4_EVT_MatchCondCmd(TMR4x, pstcSvpwm->u32EvtCh, pstcSvpwm->u16TrigCond, ENABLE);
+        TMR4_EVT_SetCompareValue(TMR4x, pstcSvpwm->u32EvtCh, pstcSvpwm->u16SampleHalf);
+        i32Ret = LL_OK;
+    }
+    return i32Ret;
+}
+
+/**
+ * @brief  Compute the compare values of a voltage command.
+ * @param  [in] pstcSvpwm               Pointer to a @ref stc_tmr4_svpwm_t structure.
+ * @param  [in] i16Alpha                Alpha voltage in Q15 of the DC link voltage.
+ * @param  [in] i16Beta                 Beta voltage in Q15 of the DC link voltage.
+ * @param  [out] pstcCmp                Pointer to a @ref stc_tmr4_svpwm_cmp_t structure.
+ * @retval int32_t:
+ *           - LL_OK:                   No error occurred.
+ *           - LL_ERR:                  No interval is long enough to sample without a switching
+ *                                      edge or its ringing, the trigger is in the longest one.
+ *           - LL_ERR_INVD_PARAM:       NULL pointer.
+ * @note   Vectors longer than @ref TMR4_SVPWM_LINEAR_MAX are clipped per phase.
+ *         The function does not access the registers.
+ */
+int32_t TMR4_SVPWM_Calc(const stc_tmr4_svpwm_t *pstcSvpwm, int16_t i16Alpha, int16_t i16Beta,
+                        stc_tmr4_svpwm_cmp_t *pstcCmp)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+    int32_t ai32V[3];
+    int32_t i32Beta;
+    int32_t i32Off;
+    int32_t i32Duty;
+    uint32_t u32Period;
+    uint32_t u32Min;
+    uint32_t u32Mid;
+    uint32_t u32Max;
+    uint32_t u32Dist;
+    uint32_t u32Center;
+    uint32_t u32Half;
+    uint32_t u32MaxIdx = 0UL;
+    uint32_t u32MinIdx = 0UL;
+    uint32_t i;
+
+    if ((NULL != pstcSvpwm) && (NULL != pstcCmp)) {
+        u32Period = pstcSvpwm->u16Period;
+        u32Half   = pstcSvpwm->u16SampleHalf;
+
+        /* Inverse Clarke */
+        i32Beta  = ((int32_t)i16Beta * TMR4_SVPWM_SQRT3_2) / TMR4_SVPWM_Q15_ONE;
+        ai32V[0] = i16Alpha;
+        ai32V[1] = (-(int32_t)i16Alpha / 2L) + i32Beta;
+        ai32V[2] = (-(int32_t)i16Alpha / 2L) - i32Beta;
+
+        for (i = 1UL; i < 3UL; i++) {
+            if (ai32V[i] > ai32V[u32MaxIdx]) {
+                u32MaxIdx = i;
+            }
+            if (ai32V[i] < ai32V[u32MinIdx]) {
+                u32MinIdx = i;
+            }
+        }
+        if (u32MaxIdx == u32MinIdx) {
+            /* Zero vector */
+            u32MinIdx = 1UL;
+        }
+
+        /* Min-max zero sequence centers the active vectors in the period */
+        i32Off = -(ai32V[u32MaxIdx] + ai32V[u32MinIdx]) / 2L;
+        for (i = 0UL; i < 3UL; i++) {
+            i32Duty = TMR4_SVPWM_Q15_HALF + ai32V[i] + i32Off;
+            if (i32Duty < 0L) {
+                i32Duty = 0L;
+            } else if (i32Duty > TMR4_SVPWM_Q15_ONE) {
+                i32Duty = TMR4_SVPWM_Q15_ONE;
+            } else {
+                /* rsvd */
+            }
+            pstcCmp->au16Cmp[i] = (uint16_t)((((uint32_t)i32Duty * u32Period) + (uint32_t)TMR4_SVPWM_Q15_HALF) >> 15U);
+        }
+        pstcCmp->u8Sector = m_au8Sector[u32MaxIdx][u32MinIdx];
+
+        /* Longest interval without edge: valley, peak, or between two phases */
+        u32Min = pstcCmp->au16Cmp[u32MinIdx];
+        u32Max = pstcCmp->au16Cmp[u32MaxIdx];
+        u32Mid = pstcCmp->au16Cmp[3UL - u32MaxIdx - u32MinIdx];
+
+        pstcCmp->u16QuietTicks = (uint16_t)u32Min;
+        pstcCmp->u16TrigCmp    = (uint16_t)u32Half;
+        pstcCmp->u16TrigCond   = TMR4_EVT_MATCH_CNT_DOWN;
+
+        u32Dist = u32Period - u32Max;
+        if (u32Dist > pstcCmp->u16QuietTicks) {
+            pstcCmp->u16QuietTicks = (uint16_t)u32Dist;
+            pstcCmp->u16TrigCmp    = (uint16_t)((u32Period > u32Half) ? (u32Period - u32Half) : 0UL);
+            pstcCmp->u16TrigCond   = TMR4_EVT_MATCH_CNT_UP;
+        }
+        u32Dist = (u32Mid - u32Min) / 2UL;
+        if (u32Dist > pstcCmp->u16QuietTicks) {
+            u32Center = u32Min + u32Dist;
+            pstcCmp->u16QuietTicks = (uint16_t)u32Dist;
+            pstcCmp->u16TrigCmp    = (uint16_t)((u32Center > u32Half) ? (u32Center - u32Half) : 0UL);
+            pstcCmp->u16TrigCond   = TMR4_EVT_MATCH_CNT_UP;
+        }
+        u32Dist = (u32Max - u32Mid) / 2UL;
+        if (u32Dist > pstcCmp->u16QuietTicks) {
+            u32Center = u32Mid + u32Dist;
+            pstcCmp->u16QuietTicks = (uint16_t)u32Dist;
+            pstcCmp->u16TrigCmp    = (uint16_t)((u32Center > u32Half) ? (u32Center - u32Half) : 0UL);
+            pstcCmp->u16TrigCond   = TMR4_EVT_MATCH_CNT_UP;
+        }
+
+        i32Ret = (pstcCmp->u16QuietTicks >= ((uint32_t)pstcSvpwm->u16Guard + u32Half)) ? LL_OK : LL_ERR;
+    }
+    return i32Ret;
+}
+
+/**
+ * @brief  Apply a voltage command from the next PWM cycle on.
+ * @param  [in] pstcSvpwm               Pointer to a @ref stc_tmr4_svpwm_t structure.
+ * @param  [in] i16Alpha                Alpha voltage in Q15 of the DC link voltage.
+ * @param  [in] i16Beta                 Beta voltage in Q15 of the DC link voltage.
+ * @retval int32_t:
+ *           - LL_OK:                   No error occurred.
+ *           - LL_ERR:                  The ADC trigger could not be kept clear of the switching.
+ *           - LL_ERR_INVD_PARAM:       NULL pointer.
+ * @note   Call once per cycle, between the valley and the next valley, e.g. from the ADC end of
+ *         conversion interrupt. The EVT match condition is written only when it changes; it
+ *         is not buffered and takes effect at once.
+ */
+int32_t TMR4_SVPWM_Update(stc_tmr4_svpwm_t *pstcSvpwm, int16_t i16Alpha, int16_t i16Beta)
+{
+    int32_t i32Ret;
+    stc_tmr4_svpwm_cmp_t stcCmp;
+    CM_TMR4_TypeDef *TMR4x;
+
+    i32Ret = TMR4_SVPWM_Calc(pstcSvpwm, i16Alpha, i16Beta, &stcCmp);
+    if (LL_ERR_INVD_PARAM != i32Ret) {
+        TMR4x = pstcSvpwm->TMR4x;
+        TMR4_OC_SetCompareValue(TMR4x, TMR4_OC_CH_UH, stcCmp.au16Cmp[0]);
+        TMR4_OC_SetCompareValue(TMR4x, TMR4_OC_CH_VH, stcCmp.au16Cmp[1]);
+        TMR4_OC_SetCompareValue(TMR4x, TMR4_OC_CH_WH, stcCmp.au16Cmp[2]);
+        TMR4_EVT_SetCompareValue(TMR4x, pstcSvpwm->u32EvtCh, stcCmp.u16TrigCmp);
+        if (stcCmp.u16TrigCond != pstcSvpwm->u16TrigCond) {
+            TMR4_EVT_MatchCondCmd(TMR4x, pstcSvpwm->u32EvtCh, TMR4_SVPWM_TRIG_COND_MASK, DISABLE);
+            TMR4_EVT_MatchCondCmd(TMR4x, pstcSvpwm->u32EvtCh, stcCmp.u16TrigCond, ENABLE);
+            pstcSvpwm->u16TrigCond = stcCmp.u16TrigCond;
+        }
+    }
+    return i32Ret;
+}
+
+/**
+ * @}
+ */
+
+#endif /* LL_TMR4_SVPWM_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,530 @@
+/**
+ *******************************************************************************
+ * @file  hc32_ll_tmr6_sync.c
+ * @brief This file provides firmware functions to update the PWM of several
+ *        TMR6 units at the same period boundary.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       CDT             First version
+                                    Held the buffer transfer by the buffer function bits, valid in sawtooth mode
+                                    Add API TMR6_SYNC_ReplayStructInit(), check the replay DMA channel, target and event
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2025, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ll_tmr6_sync.h"
+#include "hc32_ll_tmr6.h"
+#include "hc32_ll_aos.h"
+#include "hc32_ll_utility.h"
+
+/**
+ * @addtogroup LL_Driver
+ * @{
+ */
+
+/**
+ * @defgroup LL_TMR6_SYNC TMR6_SYNC
+ * @brief TMR6 Synchronous PWM Update Driver Library
+ * @note  A PWM set is a group of TMR6 units started together by TMR6_SYNC_Start(), with single
+ *        buffered compare and period registers. New values are written to the buffer registers
+ *        (GCMCR, GCMDR, PERBR) while the buffer function is disabled, so that nothing is
+ *        transferred to the working registers in sawtooth or triangle wave mode, then
+ *        TMR6_SYNC_Commit() enables the buffer function of all units again, and the timers
+ *        transfer at the next peak or valley. A commit writes one register per unit, and waits when it is issued
+ *        less than u32GuardTicks before the commit point, so that all units take the new values
+ *        in the same period.
+ *        A duty table can be replayed by DMA into the buffer registers of one unit, one entry
+ *        per PWM period, without the CPU.
+ * @{
+ */
+
+#if (LL_TMR6_SYNC_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup TMR6_SYNC_Local_Macros TMR6_SYNC Local Macros
+ * @{
+ */
+/* BCONR fields, see the TMR6 driver. The transfer condition bits only apply in triangle
+   wave mode, a sawtooth counter transfers at each overflow or underflow while the buffer
+   function is enabled */
+#define TMR6_SYNC_BCONR_CHB_OFS         (0x04UL)
+#define TMR6_SYNC_BCONR_PERIOD_OFS      (0x08UL)
+#define TMR6_SYNC_BCONR_FUNC_MASK       (0x01UL)
+
+/* Bound of the wait for the commit point */
+#define TMR6_SYNC_GUARD_LOOP_MAX        (0x10000UL)
+
+#define TMR6_SYNC_DMA_RPT_MAX           (1024UL)
+
+/* Overflow and underflow events of the unit of index idx in m_apstcTmr6, the units have
+   the same number of events each, in the order of the units */
+#define TMR6_SYNC_EVT_UNIT_STEP         ((uint32_t)EVT_SRC_TMR6_2_OVF - (uint32_t)EVT_SRC_TMR6_1_OVF)
+#define TMR6_SYNC_EVT_OVF(idx)          ((uint32_t)EVT_SRC_TMR6_1_OVF + ((idx) * TMR6_SYNC_EVT_UNIT_STEP))
+#define TMR6_SYNC_EVT_UDF(idx)          ((uint32_t)EVT_SRC_TMR6_1_UDF + ((idx) * TMR6_SYNC_EVT_UNIT_STEP))
+
+/**
+ * @defgroup TMR6_SYNC_Check_Parameters_Validity TMR6_SYNC Check Parameters Validity
+ * @{
+ */
+#define IS_TMR6_SYNC_UNIT_NUM(x)        (((x) != 0U) && ((x) <= TMR6_SYNC_UNIT_MAX))
+
+#define IS_TMR6_SYNC_CH(x)                                                     \
+(   ((x) == TMR6_SYNC_CH_A)                     ||                             \
+    ((x) == TMR6_SYNC_CH_B)                     ||                             \
+    ((x) == TMR6_SYNC_CH_AB))
+
+#define IS_TMR6_SYNC_TRANS_COND(x)                                             \
+(   ((x) == TMR6_BUF_TRANS_OVF)                 ||                             \
+    ((x) == TMR6_BUF_TRANS_UDF)                 ||                             \
+    ((x) == TMR6_BUF_TRANS_OVF_UDF))
+
+#define IS_TMR6_SYNC_DMA_CH(x)          ((x) <= DMA_CH7)
+
+#define IS_TMR6_SYNC_DMA_TARGET(unit, ch, target)                              \
+(   ((target) == ((((unit) == CM_DMA1) ? AOS_DMA1_0 : AOS_DMA2_0) + ((uint32_t)(ch) * 4UL))))
+
+#define IS_TMR6_SYNC_REPLAY_EVT(idx, evt)                                      \
+(   ((uint32_t)(evt) == TMR6_SYNC_EVT_OVF(idx))  ||                            \
+    ((uint32_t)(evt) == TMR6_SYNC_EVT_UDF(idx)))
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+static CM_TMR6_TypeDef *const m_apstcTmr6[TMR6_SYNC_UNIT_MAX] = {
+    CM_TMR6_1, CM_TMR6_2, CM_TMR6_3, CM_TMR6_4, CM_TMR6_5, CM_TMR6_6, CM_TMR6_7, CM_TMR6_8,
+};
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @defgroup TMR6_SYNC_Local_Functions TMR6_SYNC Local Functions
+ * @{
+ */
+
+/**
+ * @brief  Index of a unit.
+ * @param  [in] TMR6x                   Timer6 unit.
+ * @retval Index of the unit in m_apstcTmr6, TMR6_SYNC_UNIT_MAX for an unknown unit.
+ */
+static uint32_t TMR6_SYNC_UnitIdx(const CM_TMR6_TypeDef *TMR6x)
+{
+    uint32_t i;
+
+    for (i = 0UL; i < TMR6_SYNC_UNIT_MAX; i++) {
+        if (m_apstcTmr6[i] == TMR6x) {
+            break;
+        }
+    }
+    return i;
+}
+
+/**
+ * @brief  Software synchronization bit of a unit.
+ * @param  [in] TMR6x                   Timer6 unit.
+ * @retval A value of @ref TMR6_SW_Sync_Unit_define, 0 for an unknown unit.
+ */
+static uint32_t TMR6_SYNC_UnitBit(const CM_TMR6_TypeDef *TMR6x)
+{
+    const uint32_t u32Idx = TMR6_SYNC_UnitIdx(TMR6x);
+
+    return (u32Idx < TMR6_SYNC_UNIT_MAX) ? (TMR6_SW_SYNC_U1 << u32Idx) : 0UL;
+}
+
+/**
+ * @brief  Hold the buffer transfer of all units.
+ * @param  [in] pstcSync                Pointer to a @ref stc_tmr6_sync_t structure.
+ * @retval None
+ */
+static void TMR6_SYNC_Hold(stc_tmr6_sync_t *pstcSync)
+{
+    uint8_t i;
+
+    if (0U == pstcSync->u8Staging) {
+        for (i = 0U; i < pstcSync->u8UnitNum; i++) {
+            WRITE_REG32(pstcSync->apstcTmr6[i]->BCONR, pstcSync->au32BconrHold[i]);
+        }
+        pstcSync->u8Staging = 1U;
+    }
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup TMR6_SYNC_Global_Functions TMR6_SYNC Global Functions
+ * @{
+ */
+
+/**
+ * @brief  Set the default value of each member of stc_tmr6_sync_init_t.
+ * @param  [out] pstcSyncInit           Pointer to a @ref stc_tmr6_sync_init_t structure.
+ * @retval int32_t:
+ *           - LL_OK:                   No error occurred.
+ *           - LL_ERR_INVD_PARAM:       pstcSyncInit == NULL.
+ */
+int32_t TMR6_SYNC_StructInit(stc_tmr6_sync_init_t *pstcSyncInit)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+    uint32_t i;
+
+    if (NULL != pstcSyncInit) {
+        pstcSyncInit->u8UnitNum = 0U;
+        for (i = 0UL; i < TMR6_SYNC_UNIT_MAX; i++) {
+            pstcSyncInit->apstcTmr6[i] = NULL;
+            pstcSyncInit->au8Ch[i]     = TMR6_SYNC_CH_AB;
+        }
+        pstcSyncInit->u32BufTransCond = TMR6_BUF_TRANS_OVF;
+        pstcSyncInit->u32GuardTicks   = 0UL;
+        i32Ret = LL_OK;
+    }
+    return i32Ret;
+}
+
+/**
+ * @brief  Initialize a PWM set.
+ * @param  [out] pstcSync               Pointer to a @ref stc_tmr6_sync_t structure.
+ * @param  [in] pstcSyncInit            Pointer to a @ref stc_tmr6_sync_init_t structure.
+ * @retval int32_t:
+ *           - LL_OK:                   No error occurred.
+ *           - LL_ERR_INVD_PARAM:       NULL pointer or a unit given twice.
+ * @note   The units must be configured by TMR6_Init() and their PWM outputs set up before,
+ *         the compare and period buffers are configured here. The units must be stopped.
+ */
+int32_t TMR6_SYNC_Init(stc_tmr6_sync_t *pstcSync, const stc_tmr6_sync_init_t *pstcSyncInit)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+    stc_tmr6_buf_config_t stcBufConfig;
+    CM_TMR6_TypeDef *TMR6x;
+    uint32_t u32Hold;
+    uint32_t u32Bit;
+    uint8_t i;
+
+    if ((NULL != pstcSync) && (NULL != pstcSyncInit)) {
+        DDL_ASSERT(IS_TMR6_SYNC_UNIT_NUM(pstcSyncInit->u8UnitNum));
+        DDL_ASSERT(IS_TMR6_SYNC_TRANS_COND(pstcSyncInit->u32BufTransCond));
+
+        pstcSync->u8UnitNum     = pstcSyncInit->u8UnitNum;
+        pstcSync->u32SyncUnit   = 0UL;
+        pstcSync->u32GuardTicks = pstcSyncInit->u32GuardTicks;
+        pstcSync->u8Staging     = 0U;
+        i32Ret = LL_OK;
+
+        stcBufConfig.u32BufNum       = TMR6_BUF_SINGLE;
+        stcBufConfig.u32BufTransCond = pstcSyncInit->u32BufTransCond;
+        for (i = 0U; i < pstcSync->u8UnitNum; i++) {
+            TMR6x = pstcSyncInit->apstcTmr6[i];
+            DDL_ASSERT(IS_TMR6_SYNC_CH(pstcSyncInit->au8Ch[i]));
+            u32Bit = TMR6_SYNC_UnitBit(TMR6x);
+            if ((0UL == u32Bit) || (0UL != (pstcSync->u32SyncUnit & u32Bit))) {
+                i32Ret = LL_ERR_INVD_PARAM;
+                break;
+            }
+            pstcSync->u32SyncUnit |= u32Bit;
+            pstcSync->apstcTmr6[i] = TMR6x;
+            pstcSync->au8Ch[i]     = pstcSyncInit->au8Ch[i];
+
+            u32Hold = TMR6_SYNC_BCONR_FUNC_MASK << TMR6_SYNC_BCONR_PERIOD_OFS;
+            (void)TMR6_PeriodBufConfig(TMR6x, &stcBufConfig);
+            TMR6_PeriodBufCmd(TMR6x, ENABLE);
+            if (0U != (pstcSync->au8Ch[i] & TMR6_SYNC_CH_A)) {
+                (void)TMR6_GeneralBufConfig(TMR6x, TMR6_CH_A, &stcBufConfig);
+                TMR6_GeneralBufCmd(TMR6x, TMR6_CH_A, ENABLE);
+                u32Hold |= TMR6_SYNC_BCONR_FUNC_MASK;
+            }
+            if (0U != (pstcSync->au8Ch[i] & TMR6_SYNC_CH_B)) {
+                (void)TMR6_GeneralBufConfig(TMR6x, TMR6_CH_B, &stcBufConfig);
+                TMR6_GeneralBufCmd(TMR6x, TMR6_CH_B, ENABLE);
+                u32Hold |= TMR6_SYNC_BCONR_FUNC_MASK << TMR6_SYNC_BCONR_CHB_OFS;
+            }
+            pstcSync->au32BconrRun[i]  = READ_REG32(TMR6x->BCONR);
+            pstcSync->au32BconrHold[i] = pstcSync->au32BconrRun[i] & ~u32Hold;
+        }
+    }
+    return i32Ret;
+}
+
+/**
+ * @brief  Start the counters of all units of a PWM set at the same time.
+ * @param  [in] pstcSync                Pointer to a @ref stc_tmr6_sync_t structure.
+ * @retval None
+ * @note   The counters should be cleared before, so that the units run in phase.
+ */
+void TMR6_SYNC_Start(const stc_tmr6_sync_t *pstcSync)
+{
+    DDL_ASSERT(NULL != pstcSync);
+    TMR6_SWSyncStart(pstcSync->u32SyncUnit);
+}
+
+/**
+ * @brief  Stop the counters of all units of a PWM set at the same time.
+ * @param  [in] pstcSync                Pointer to a @ref stc_tmr6_sync_t structure.
+ * @retval None
+ */
+void TMR6_SYNC_Stop(const stc_tmr6_sync_t *pstcSync)
+{
+    DDL_ASSERT(NULL != pstcSync);
+    TMR6_SWSyncStop(pstcSync->u32SyncUnit);
+}
+
+/**
+ * @brief  Stage a compare value.
+ * @param  [in] pstcSync                Pointer to a @ref stc_tmr6_sync_t structure.
+ * @param  [in] u8Unit                  Index of the unit in the set.
+ * @param  [in] u8Ch                    TMR6_SYNC_CH_A or TMR6_SYNC_CH_B, a channel of the unit.
+ * @param  [in] u32Value                Compare value, taken by the timer after TMR6_SYNC_Commit().
+ * @retval None
+ */
+void TMR6_SYNC_SetCompare(stc_tmr6_sync_t *pstcSync, uint8_t u8Unit, uint8_t u8Ch, uint32_t u32Value)
+{
+    DDL_ASSERT(NULL != pstcSync);
+    DDL_ASSERT(u8Unit < pstcSync->u8UnitNum);
+    DDL_ASSERT((TMR6_SYNC_CH_A == u8Ch) || (TMR6_SYNC_CH_B == u8Ch));
+    DDL_ASSERT(0U != (pstcSync->au8Ch[u8Unit] & u8Ch));
+
+    TMR6_SYNC_Hold(pstcSync);
+    TMR6_SetCompareValue(pstcSync->apstcTmr6[u8Unit],
+                         (TMR6_SYNC_CH_A == u8Ch) ? TMR6_CMP_REG_C : TMR6_CMP_REG_D, u32Value);
+}
+
+/**
+ * @brief  Stage the compare values of all channels of a PWM set.
+ * @param  [in] pstcSync                Pointer to a @ref stc_tmr6_sync_t structure.
+ * @param  [in] pu32Value               Compare values in the order of the units, channel A
+ *                                      before channel B for a unit using both.
+ * @retval None
+ */
+void TMR6_SYNC_SetCompareAll(stc_tmr6_sync_t *pstcSync, const uint32_t *pu32Value)
+{
+    CM_TMR6_TypeDef *TMR6x;
+    uint8_t i;
+
+    DDL_ASSERT(NULL != pstcSync);
+    DDL_ASSERT(NULL != pu32Value);
+
+    TMR6_SYNC_Hold(pstcSync);
+    for (i = 0U; i < pstcSync->u8UnitNum; i++) {
+        TMR6x = pstcSync->apstcTmr6[i];
+        if (0U != (pstcSync->au8Ch[i] & TMR6_SYNC_CH_A)) {
+            TMR6_SetCompareValue(TMR6x, TMR6_CMP_REG_C, *pu32Value++);
+        }
+        if (0U != (pstcSync->au8Ch[i] & TMR6_SYNC_CH_B)) {
+            TMR6_SetCompareValue(TMR6x, TMR6_CMP_REG_D, *pu32Value++);
+        }
+    }
+}
+
+/**
+ * @brief  Stage a period value.
+ * @param  [in] pstcSync                Pointer to a @ref stc_tmr6_sync_t structure.
+ * @param  [in] u8Unit                  Index of the unit in the set.
+ * @param  [in] u32Value                Period value, taken by the timer after TMR6_SYNC_Commit().
+ * @retval None
+ */
+void TMR6_SYNC_SetPeriod(stc_tmr6_sync_t *pstcSync, uint8_t u8Unit, uint32_t u32Value)
+{
+    DDL_ASSERT(NULL != pstcSync);
+    DDL_ASSERT(u8Unit < pstcSync->u8UnitNum);
+
+    TMR6_SYNC_Hold(pstcSync);
+    TMR6_SetPeriodValue(pstcSync->apstcTmr6[u8Unit], TMR6_PERIOD_REG_B, u32Value);
+}
+
+/**
+ * @brief  Release the staged values of a PWM set.
+ * @param  [in] pstcSync                Pointer to a @ref stc_tmr6_sync_t structure.
+ * @retval None
+ * @note   The values are taken by all units at the next commit point. When the first unit is
+ *         closer than u32GuardTicks to the point, the function waits until it has passed.
+ *         The wait is skipped when the guard is more than half of the period.
+ */
+void TMR6_SYNC_Commit(stc_tmr6_sync_t *pstcSync)
+{
+    CM_TMR6_TypeDef *TMR6x;
+    uint32_t u32Period;
+    uint32_t u32Dist;
+    uint32_t u32Loop = 0UL;
+    uint32_t u32Primask;
+    uint8_t i;
+
+    DDL_ASSERT(NULL != pstcSync);
+
+    if (0U != pstcSync->u8Staging) {
+        TMR6x = pstcSync->apstcTmr6[0];
+        u32Period = TMR6_GetPeriodValue(TMR6x, TMR6_PERIOD_REG_A);
+        if ((pstcSync->u32GuardTicks != 0UL) && (pstcSync->u32GuardTicks <= (u32Period / 2UL))) {
+            for (;;) {
+                if (TMR6_STAT_CNT_UP == TMR6_GetCountDir(TMR6x)) {
+                    u32Dist = u32Period - TMR6_GetCountValue(TMR6x);
+                } else {
+                    u32Dist = TMR6_GetCountValue(TMR6x);
+                }
+                if ((u32Dist >= pstcSync->u32GuardTicks) || (u32Loop >= TMR6_SYNC_GUARD_LOOP_MAX)) {
+                    break;
+                }
+                u32Loop++;
+            }
+        }
+
+        u32Primask = __get_PRIMASK();
+        __disable_irq();
+        for (i = 0U; i < pstcSync->u8UnitNum; i++) {
+            WRITE_REG32(pstcSync->apstcTmr6[i]->BCONR, pstcSync->au32BconrRun[i]);
+        }
+        __set_PRIMASK(u32Primask);
+        pstcSync->u8Staging = 0U;
+    }
+}
+
+/**
+ * @brief  Set the default value of each member of stc_tmr6_sync_replay_t.
+ * @param  [out] pstcReplay             Pointer to a @ref stc_tmr6_sync_replay_t structure.
+ * @retval int32_t:
+ *           - LL_OK:                   No error occurred.
+ *           - LL_ERR_INVD_PARAM:       pstcReplay == NULL.
+ * @note   The default DMA channel and target match for DMA1, the default event is the overflow
+ *         of TMR6_1. Another unit needs its own event.
+ */
+int32_t TMR6_SYNC_ReplayStructInit(stc_tmr6_sync_replay_t *pstcReplay)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if (NULL != pstcReplay) {
+        pstcReplay->pstcDmaUnit   = NULL;
+        pstcReplay->u8DmaCh       = DMA_CH0;
+        pstcReplay->u32TrigTarget = AOS_DMA1_0;
+        pstcReplay->enEvtSrc      = EVT_SRC_TMR6_1_OVF;
+        pstcReplay->pu32Table     = NULL;
+        pstcReplay->u32Len        = 0UL;
+        i32Ret = LL_OK;
+    }
+    return i32Ret;
+}
+
+/**
+ * @brief  Start the replay of a duty table on one unit of a PWM set.
+ * @param  [in] pstcSync                Pointer to a @ref stc_tmr6_sync_t structure.
+ * @param  [in] u8Unit                  Index of the unit in the set.
+ * @param  [in] pstcReplay              Pointer to a @ref stc_tmr6_sync_replay_t structure.
+ * @retval int32_t:
+ *           - LL_OK:                   No error occurred.
+ *           - LL_ERR_INVD_PARAM:       NULL pointer, table too long, u8DmaCh invalid, u32TrigTarget
+ *                                      not the target of u8DmaCh, or enEvtSrc not the overflow or
+ *                                      underflow of the unit.
+ * @note   Each commit point event writes the next entry to the buffer registers of the unit,
+ *         which the timer takes at the following commit point. The table is replayed in a
+ *         loop until TMR6_SYNC_ReplayStop(). The unit must not be staged meanwhile, a staged
+ *         hold of the unit is released here.
+ */
+int32_t TMR6_SYNC_ReplayStart(const stc_tmr6_sync_t *pstcSync, uint8_t u8Unit,
+                              const stc_tmr6_sync_replay_t *pstcReplay)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+    stc_dma_init_t stcDmaInit;
+    stc_dma_repeat_init_t stcRepeatInit;
+    CM_TMR6_TypeDef *TMR6x;
+    uint32_t u32ChNum;
+
+    if ((NULL != pstcSync) && (NULL != pstcReplay) && (NULL != pstcReplay->pu32Table) &&
+        (NULL != pstcReplay->pstcDmaUnit) && IS_TMR6_SYNC_DMA_CH(pstcReplay->u8DmaCh) &&
+        IS_TMR6_SYNC_DMA_TARGET(pstcReplay->pstcDmaUnit, pstcReplay->u8DmaCh, pstcReplay->u32TrigTarget)) {
+        DDL_ASSERT(u8Unit < pstcSync->u8UnitNum);
+        TMR6x = pstcSync->apstcTmr6[u8Unit];
+        u32ChNum = (TMR6_SYNC_CH_AB == pstcSync->au8Ch[u8Unit]) ? 2UL : 1UL;
+
+        if ((0UL != pstcReplay->u32Len) && ((pstcReplay->u32Len * u32ChNum) <= TMR6_SYNC_DMA_RPT_MAX) &&
+            IS_TMR6_SYNC_REPLAY_EVT(TMR6_SYNC_UnitIdx(TMR6x), pstcReplay->enEvtSrc)) {
+            (void)DMA_ChCmd(pstcReplay->pstcDmaUnit, pstcReplay->u8DmaCh, DISABLE);
+
+            (void)DMA_StructInit(&stcDmaInit);
+            stcDmaInit.u32IntEn       = DMA_INT_DISABLE;
+            stcDmaInit.u32SrcAddr     = (uint32_t)pstcReplay->pu32Table;
+            stcDmaInit.u32DestAddr    = (TMR6_SYNC_CH_B == pstcSync->au8Ch[u8Unit]) ?
+                                        (uint32_t)&TMR6x->GCMDR : (uint32_t)&TMR6x->GCMCR;
+            stcDmaInit.u32DataWidth   = DMA_DATAWIDTH_32BIT;
+            stcDmaInit.u32BlockSize   = u32ChNum;
+            stcDmaInit.u32TransCount  = 0UL;
+            stcDmaInit.u32SrcAddrInc  = DMA_SRC_ADDR_INC;
+            stcDmaInit.u32DestAddrInc = (2UL == u32ChNum) ? DMA_DEST_ADDR_INC : DMA_DEST_ADDR_FIX;
+            (void)DMA_Init(pstcReplay->pstcDmaUnit, pstcReplay->u8DmaCh, &stcDmaInit);
+
+            (void)DMA_RepeatStructInit(&stcRepeatInit);
+            stcRepeatInit.u32Mode      = DMA_RPT_BOTH;
+            stcRepeatInit.u32SrcCount  = pstcReplay->u32Len * u32ChNum;
+            stcRepeatInit.u32DestCount = u32ChNum;
+            (void)DMA_RepeatInit(pstcReplay->pstcDmaUnit, pstcReplay->u8DmaCh, &stcRepeatInit);
+
+            AOS_SetTriggerEventSrc(pstcReplay->u32TrigTarget, pstcReplay->enEvtSrc);
+            /* The transfer of the unit must not be held by an earlier staging */
+            WRITE_REG32(TMR6x->BCONR, pstcSync->au32BconrRun[u8Unit]);
+            (void)DMA_ChCmd(pstcReplay->pstcDmaUnit, pstcReplay->u8DmaCh, ENABLE);
+            i32Ret = LL_OK;
+        }
+    }
+    return i32Ret;
+}
+
+/**
+ * @brief  Stop the replay of a duty table.
+ * @param  [in] pstcReplay              Pointer to a @ref stc_tmr6_sync_replay_t structure.
+ * @retval None
+ * @note   The unit keeps the last value written.
+ */
+void TMR6_SYNC_ReplayStop(const stc_tmr6_sync_replay_t *pstcReplay)
+{
+    DDL_ASSERT(NULL != pstcReplay);
+    (void)DMA_ChCmd(pstcReplay->pstcDmaUnit, pstcReplay->u8DmaCh, DISABLE);
+}
+
+/**
+ * @}
+ */
+
+#endif /* LL_TMR6_SYNC_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
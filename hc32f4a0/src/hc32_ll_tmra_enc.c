@@ -0,0 +1,411 @@
+/**
+ *******************************************************************************
+ * @file  hc32_ll_tmra_enc.c
+ * @brief This file provides firmware functions to read quadrature encoders
+ *        with TMRA.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       CDT             First version
+                                    Set a default enEvtSrc in TMRA_ENC_StructInit() and checked it in TMRA_ENC_Init()
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2025, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ll_tmra_enc.h"
+#include "hc32_ll_aos.h"
+#include "hc32_ll_utility.h"
+
+/**
+ * @addtogroup LL_Driver
+ * @{
+ */
+
+/**
+ * @defgroup LL_TMRA_ENC TMRA_ENC
+ * @brief TMRA Quadrature Encoder Driver Library
+ * @note  Each axis counts CLKA/CLKB on a TMRA unit, extended to 64 bits by the overflow and
+ *        underflow interrupt. At each rising edge of the PWM pin of u32PosCaptCh the unit
+ *        captures the position, and its compare event makes a free running time base unit
+ *        capture the timestamp of the same edge.
+ *        TMRA_ENC_Sample(), called periodically, computes the speed with the M/T method: the
+ *        counts between the last captured edges of two samples over the time between them.
+ *        Without a new edge the speed is bounded by the time since the last edge, and is 0
+ *        after u32StopTime. The sample period must be shorter than the wrap time of the time
+ *        base. The result is read with TMRA_ENC_GetState() from any context without lock.
+ * @{
+ */
+
+#if (LL_TMRA_ENC_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup TMRA_ENC_Local_Macros TMRA_ENC Local Macros
+ * @{
+ */
+#define TMRA_ENC_CNT_WRAP               (0x10000LL)
+#define TMRA_ENC_CNT_HALF               (0x8000UL)
+
+#define TMRA_ENC_READ_RETRY             (4U)
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @defgroup TMRA_ENC_Local_Functions TMRA_ENC Local Functions
+ * @{
+ */
+
+/**
+ * @brief  Sample one axis.
+ * @param  [in] pstcEnc                 Pointer to a @ref stc_tmra_enc_t structure.
+ * @retval None
+ */
+static void TMRA_ENC_SampleAxis(stc_tmra_enc_t *pstcEnc)
+{
+    uint16_t u16TimeCapt;
+    uint16_t u16PosCapt;
+    uint16_t u16Now;
+    uint32_t u32EdgeTime;
+    uint32_t u32Elapsed;
+    int64_t i64Pos;
+    int64_t i64EdgePos;
+    int64_t i64Bound;
+    uint8_t u8Retry = 0U;
+
+    /* Position and timestamp of the same edge */
+    do {
+        u16TimeCapt = (uint16_t)TMRA_GetCompareValue(pstcEnc->pstcTimeBase, pstcEnc->u32TimeCaptCh);
+        u16PosCapt  = (uint16_t)TMRA_GetCompareValue(pstcEnc->TMRAx, pstcEnc->u32PosCaptCh);
+        u8Retry++;
+    } while ((u16TimeCapt != (uint16_t)TMRA_GetCompareValue(pstcEnc->pstcTimeBase, pstcEnc->u32TimeCaptCh)) &&
+             (u8Retry < TMRA_ENC_READ_RETRY));
+
+    u16Now = (uint16_t)TMRA_GetCountValue(pstcEnc->pstcTimeBase);
+    pstcEnc->u32Now += (uint16_t)(u16Now - pstcEnc->u16Now);
+    pstcEnc->u16Now = u16Now;
+    i64Pos = TMRA_ENC_GetPosition(pstcEnc);
+
+    if (u16TimeCapt != pstcEnc->u16TimeCapt) {
+        u32EdgeTime = pstcEnc->u32Now - (uint16_t)(u16Now - u16TimeCapt);
+        i64EdgePos  = i64Pos - (int16_t)(uint16_t)((uint16_t)i64Pos - u16PosCapt);
+        if (u32EdgeTime != pstcEnc->u32EdgeTime) {
+            pstcEnc->i32Speed = (int32_t)(((i64EdgePos - pstcEnc->i64EdgePos) * (int64_t)pstcEnc->u32TimeBaseFreq) /
+                                          (int64_t)(u32EdgeTime - pstcEnc->u32EdgeTime));
+        }
+        pstcEnc->u16TimeCapt = u16TimeCapt;
+        pstcEnc->u32EdgeTime = u32EdgeTime;
+        pstcEnc->i64EdgePos  = i64EdgePos;
+    } else {
+        u32Elapsed = pstcEnc->u32Now - pstcEnc->u32EdgeTime;
+        if (u32Elapsed >= pstcEnc->u32StopTime) {
+            pstcEnc->i32Speed = 0L;
+        } else if (0UL != u32Elapsed) {
+            /* The next edge is not yet there, the speed is at most one edge over the elapsed time */
+            i64Bound = ((int64_t)pstcEnc->u32EdgeCounts * (int64_t)pstcEnc->u32TimeBaseFreq) / (int64_t)u32Elapsed;
+            if (pstcEnc->i32Speed > i64Bound) {
+                pstcEnc->i32Speed = (int32_t)i64Bound;
+            } else if (pstcEnc->i32Speed < -i64Bound) {
+                pstcEnc->i32Speed = (int32_t)(-i64Bound);
+            } else {
+                /* rsvd */
+            }
+        } else {
+            /* rsvd */
+        }
+    }
+
+    pstcEnc->u32Seq++;
+    __DMB();
+    pstcEnc->stcState.i64Pos   = i64Pos;
+    pstcEnc->stcState.i32Speed = pstcEnc->i32Speed;
+    pstcEnc->stcState.u32Time  = pstcEnc->u32Now;
+    __DMB();
+    pstcEnc->u32Seq++;
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup TMRA_ENC_Global_Functions TMRA_ENC Global Functions
+ * @{
+ */
+
+/**
+ * @brief  Set the default value of each member of stc_tmra_enc_init_t.
+ * @param  [out] pstcEncInit            Pointer to a @ref stc_tmra_enc_init_t structure.
+ * @retval int32_t:
+ *           - LL_OK:                   No error occurred.
+ *           - LL_ERR_INVD_PARAM:       pstcEncInit == NULL.
+ */
+int32_t TMRA_ENC_StructInit(stc_tmra_enc_init_t *pstcEncInit)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if (NULL != pstcEncInit) {
+        pstcEncInit->TMRAx            = NULL;
+        pstcEncInit->u16CountUpCond   = TMRA_ENC_CNT_UP_X4;
+        pstcEncInit->u16CountDownCond = TMRA_ENC_CNT_DOWN_X4;
+        pstcEncInit->u32PosCaptCh     = TMRA_CH1;
+        pstcEncInit->pstcTimeBase     = NULL;
+        pstcEncInit->u32TimeCaptCh    = TMRA_CH1;
+        pstcEncInit->u32TrigTarget    = AOS_TMRA_1;
+        pstcEncInit->enEvtSrc         = EVT_SRC_MAX;
+        pstcEncInit->u32TimeBaseFreq  = 1000000UL;
+        pstcEncInit->u32EdgeCounts    = 4UL;
+        pstcEncInit->u32StopTime      = 0xFFFFFFFFUL;
+        i32Ret = LL_OK;
+    }
+    return i32Ret;
+}
+
+/**
+ * @brief  Initialize an encoder axis.
+ * @param  [out] pstcEnc                Pointer to a @ref stc_tmra_enc_t structure.
+ * @param  [in] pstcEncInit             Pointer to a @ref stc_tmra_enc_init_t structure.
+ * @retval int32_t:
+ *           - LL_OK:                   No error occurred.
+ *           - LL_ERR_INVD_PARAM:       NULL pointer, frequency 0 or enEvtSrc not set.
+ * @note   The pins, the TMRA clocks and the overflow/underflow interrupt of TMRAx calling
+ *         TMRA_ENC_IrqHandler() must be configured by the user. The counter is started by
+ *         TMRA_ENC_Start().
+ */
+int32_t TMRA_ENC_Init(stc_tmra_enc_t *pstcEnc, const stc_tmra_enc_init_t *pstcEncInit)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+    stc_tmra_init_t stcTmraInit;
+
+    if ((NULL != pstcEnc) && (NULL != pstcEncInit) && (NULL != pstcEncInit->TMRAx) &&
+        (NULL != pstcEncInit->pstcTimeBase) && (0UL != pstcEncInit->u32TimeBaseFreq) &&
+        (EVT_SRC_MAX != pstcEncInit->enEvtSrc)) {
+        pstcEnc->TMRAx           = pstcEncInit->TMRAx;
+        pstcEnc->u32PosCaptCh    = pstcEncInit->u32PosCaptCh;
+        pstcEnc->pstcTimeBase    = pstcEncInit->pstcTimeBase;
+        pstcEnc->u32TimeCaptCh   = pstcEncInit->u32TimeCaptCh;
+        pstcEnc->u32TimeBaseFreq = pstcEncInit->u32TimeBaseFreq;
+        pstcEnc->u32EdgeCounts   = pstcEncInit->u32EdgeCounts;
+        pstcEnc->u32StopTime     = pstcEncInit->u32StopTime;
+
+        (void)TMRA_StructInit(&stcTmraInit);
+        stcTmraInit.u8CountSrc                = TMRA_CNT_SRC_HW;
+        stcTmraInit.hw_count.u16CountUpCond   = pstcEncInit->u16CountUpCond;
+        stcTmraInit.hw_count.u16CountDownCond = pstcEncInit->u16CountDownCond;
+        stcTmraInit.u32PeriodValue            = 0xFFFFUL;
+        stcTmraInit.u8CountReload             = TMRA_CNT_RELOAD_ENABLE;
+        (void)TMRA_Init(pstcEnc->TMRAx, &stcTmraInit);
+        TMRA_SetCountValue(pstcEnc->TMRAx, 0UL);
+
+        /* Edge: position capture, whose event captures the timestamp */
+        TMRA_SetFunc(pstcEnc->TMRAx, pstcEnc->u32PosCaptCh, TMRA_FUNC_CAPT);
+        TMRA_HWCaptureCondCmd(pstcEnc->TMRAx, pstcEnc->u32PosCaptCh, TMRA_CAPT_COND_PWM_RISING, ENABLE);
+        TMRA_EventCmd(pstcEnc->TMRAx, TMRA_EVT_CMP_CH1 << pstcEnc->u32PosCaptCh, ENABLE);
+        TMRA_SetFunc(pstcEnc->pstcTimeBase, pstcEnc->u32TimeCaptCh, TMRA_FUNC_CAPT);
+        TMRA_HWCaptureCondCmd(pstcEnc->pstcTimeBase, pstcEnc->u32TimeCaptCh, TMRA_CAPT_COND_EVT, ENABLE);
+        AOS_SetTriggerEventSrc(pstcEncInit->u32TrigTarget, pstcEncInit->enEvtSrc);
+
+        pstcEnc->i64High     = 0LL;
+        pstcEnc->u32IrqSeq   = 0UL;
+        pstcEnc->u32Now      = 0UL;
+        pstcEnc->u16Now      = (uint16_t)TMRA_GetCountValue(pstcEnc->pstcTimeBase);
+        pstcEnc->u16TimeCapt = (uint16_t)TMRA_GetCompareValue(pstcEnc->pstcTimeBase, pstcEnc->u32TimeCaptCh);
+        pstcEnc->i64EdgePos  = 0LL;
+        pstcEnc->u32EdgeTime = 0UL;
+        pstcEnc->i32Speed    = 0L;
+        pstcEnc->u32Seq      = 0UL;
+        pstcEnc->stcState.i64Pos   = 0LL;
+        pstcEnc->stcState.i32Speed = 0L;
+        pstcEnc->stcState.u32Time  = 0UL;
+
+        TMRA_ClearStatus(pstcEnc->TMRAx, TMRA_FLAG_OVF | TMRA_FLAG_UDF);
+        TMRA_IntCmd(pstcEnc->TMRAx, TMRA_INT_OVF | TMRA_INT_UDF, ENABLE);
+        i32Ret = LL_OK;
+    }
+    return i32Ret;
+}
+
+/**
+ * @brief  Start the counters of several axes together.
+ * @param  [in] pstcEnc                 Array of @ref stc_tmra_enc_t structures.
+ * @param  [in] u8Num                   Number of axes.
+ * @retval None
+ */
+void TMRA_ENC_Start(stc_tmra_enc_t *pstcEnc, uint8_t u8Num)
+{
+    uint32_t u32Primask;
+    uint8_t i;
+
+    DDL_ASSERT(NULL != pstcEnc);
+
+    u32Primask = __get_PRIMASK();
+    __disable_irq();
+    for (i = 0U; i < u8Num; i++) {
+        TMRA_Start(pstcEnc[i].TMRAx);
+    }
+    __set_PRIMASK(u32Primask);
+}
+
+/**
+ * @brief  Read the current position of an axis.
+ * @param  [in] pstcEnc                 Pointer to a @ref stc_tmra_enc_t structure.
+ * @retval Position in counts.
+ * @note   A wrap of the counter whose interrupt is pending, because the caller masks or
+ *         preempts it, is taken into account.
+ */
+int64_t TMRA_ENC_GetPosition(const stc_tmra_enc_t *pstcEnc)
+{
+    int64_t i64High;
+    uint32_t u32Cnt;
+    uint32_t u32Seq;
+    en_flag_status_t enOvf;
+    en_flag_status_t enUdf;
+
+    DDL_ASSERT(NULL != pstcEnc);
+
+    do {
+        u32Seq  = pstcEnc->u32IrqSeq;
+        i64High = pstcEnc->i64High;
+        u32Cnt  = TMRA_GetCountValue(pstcEnc->TMRAx);
+        enOvf   = TMRA_GetStatus(pstcEnc->TMRAx, TMRA_FLAG_OVF);
+        enUdf   = TMRA_GetStatus(pstcEnc->TMRAx, TMRA_FLAG_UDF);
+    } while (u32Seq != pstcEnc->u32IrqSeq);
+
+    /* A flag set after the count was read leaves the count near the wrap it comes from */
+    if ((SET == enOvf) && (u32Cnt < TMRA_ENC_CNT_HALF)) {
+        i64High += TMRA_ENC_CNT_WRAP;
+    }
+    if ((SET == enUdf) && (u32Cnt >= TMRA_ENC_CNT_HALF)) {
+        i64High -= TMRA_ENC_CNT_WRAP;
+    }
+    return i64High + (int64_t)u32Cnt;
+}
+
+/**
+ * @brief  Sample position and speed of several axes.
+ * @param  [in] pstcEnc                 Array of @ref stc_tmra_enc_t structures.
+ * @param  [in] u8Num                   Number of axes.
+ * @retval None
+ * @note   Call at a fixed period, from one context only.
+ */
+void TMRA_ENC_Sample(stc_tmra_enc_t *pstcEnc, uint8_t u8Num)
+{
+    uint8_t i;
+
+    DDL_ASSERT(NULL != pstcEnc);
+
+    for (i = 0U; i < u8Num; i++) {
+        TMRA_ENC_SampleAxis(&pstcEnc[i]);
+    }
+}
+
+/**
+ * @brief  Read the last sample of an axis.
+ * @param  [in] pstcEnc                 Pointer to a @ref stc_tmra_enc_t structure.
+ * @param  [out] pstcState              Pointer to a @ref stc_tmra_enc_state_t structure.
+ * @retval int32_t:
+ *           - LL_OK:                   No error occurred.
+ *           - LL_ERR_BUSY:             The caller preempts TMRA_ENC_Sample() of this axis.
+ *           - LL_ERR_INVD_PARAM:       NULL pointer.
+ */
+int32_t TMRA_ENC_GetState(const stc_tmra_enc_t *pstcEnc, stc_tmra_enc_state_t *pstcState)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+    uint32_t u32Seq;
+    uint8_t u8Retry;
+
+    if ((NULL != pstcEnc) && (NULL != pstcState)) {
+        i32Ret = LL_ERR_BUSY;
+        for (u8Retry = 0U; u8Retry < TMRA_ENC_READ_RETRY; u8Retry++) {
+            u32Seq = pstcEnc->u32Seq;
+            __DMB();
+            pstcState->i64Pos   = pstcEnc->stcState.i64Pos;
+            pstcState->i32Speed = pstcEnc->stcState.i32Speed;
+            pstcState->u32Time  = pstcEnc->stcState.u32Time;
+            __DMB();
+            if ((0UL == (u32Seq & 1UL)) && (u32Seq == pstcEnc->u32Seq)) {
+                i32Ret = LL_OK;
+                break;
+            }
+        }
+    }
+    return i32Ret;
+}
+
+/**
+ * @brief  Overflow and underflow interrupt handler of an axis.
+ * @param  [in] pstcEnc                 Pointer to a @ref stc_tmra_enc_t structure.
+ * @retval None
+ */
+void TMRA_ENC_IrqHandler(stc_tmra_enc_t *pstcEnc)
+{
+    uint32_t u32Primask;
+
+    DDL_ASSERT(NULL != pstcEnc);
+
+    /* Update and flag clear must be seen together by a preempting reader */
+    u32Primask = __get_PRIMASK();
+    __disable_irq();
+    if (SET == TMRA_GetStatus(pstcEnc->TMRAx, TMRA_FLAG_OVF)) {
+        TMRA_ClearStatus(pstcEnc->TMRAx, TMRA_FLAG_OVF);
+        pstcEnc->i64High += TMRA_ENC_CNT_WRAP;
+        pstcEnc->u32IrqSeq++;
+    }
+    if (SET == TMRA_GetStatus(pstcEnc->TMRAx, TMRA_FLAG_UDF)) {
+        TMRA_ClearStatus(pstcEnc->TMRAx, TMRA_FLAG_UDF);
+        pstcEnc->i64High -= TMRA_ENC_CNT_WRAP;
+        pstcEnc->u32IrqSeq++;
+    }
+    __set_PRIMASK(u32Primask);
+}
+
+/**
+ * @}
+ */
+
+#endif /* LL_TMRA_ENC_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,397 @@
+/**
+ *******************************************************************************
+ * @file  hc32_ll_tstamp.c
+ * @brief This file provides firmware functions to manage the 64-bit timestamp
+ *        built on a cascaded TMRA unit pair.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       CDT             First version
+                                    Fixed TSTAMP_GetTick() interrupting TSTAMP_IrqHandler() between the flag and the extension
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2025, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ll_tstamp.h"
+#include "hc32_ll_tmra.h"
+#include "hc32_ll_clk.h"
+#include "hc32_ll_utility.h"
+
+/**
+ * @addtogroup LL_Driver
+ * @{
+ */
+
+/**
+ * @defgroup LL_TSTAMP TSTAMP
+ * @brief Timestamp Driver Library
+ * @note  The low unit counts the divided bus clock, the symmetric high unit
+ *        counts the overflows of the low unit (TMRA_CNT_UP_COND_SYM_OVF), which
+ *        gives a 32-bit hardware counter. The upper 32 bits are extended by
+ *        TSTAMP_IrqHandler(), which must be called from the overflow interrupt
+ *        of the high unit. TSTAMP_GetTick() does not lock and can be called from
+ *        any context, including interrupts with higher priority.
+ * @{
+ */
+
+#if (LL_TSTAMP_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup TSTAMP_Local_Types TSTAMP Local Types
+ * @{
+ */
+
+/**
+ * @brief Timestamp state
+ */
+typedef struct {
+    CM_TMRA_TypeDef *TMRAxL;            /*!< Low 16-bit unit */
+    CM_TMRA_TypeDef *TMRAxH;            /*!< High 16-bit unit */
+    uint8_t u8ClockDiv;                 /*!< Clock division of the low unit */
+    uint32_t u32BusClock;               /*!< Bus clock of the TMRA units */
+    uint32_t u32Freq;                   /*!< Count frequency in Hz */
+    uint64_t u64NsFactor;               /*!< Nanoseconds per count, Q32.32 */
+    uint64_t u64TickFactor;             /*!< Counts per nanosecond, Q32.32 */
+    __IO uint32_t u32Ext;               /*!< Software extension, bits 63:32 of the count */
+    __IO uint32_t u32ExtAck;            /*!< u32Ext once the overflow flag counted in it is cleared */
+} stc_tstamp_state_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup TSTAMP_Local_Macros TSTAMP Local Macros
+ * @{
+ */
+#define TSTAMP_NS_PER_SEC               (1000000000ULL)
+#define TSTAMP_HALF_RANGE               (0x80000000UL)
+
+/**
+ * @defgroup TSTAMP_Check_Parameters_Validity TSTAMP Check Parameters Validity
+ * @{
+ */
+#define IS_TSTAMP_UNIT_PAIR(l, h)                                              \
+(   (((l) == CM_TMRA_1)  && ((h) == CM_TMRA_2))     ||                         \
+    (((l) == CM_TMRA_3)  && ((h) == CM_TMRA_4))     ||                         \
+    (((l) == CM_TMRA_5)  && ((h) == CM_TMRA_6))     ||                         \
+    (((l) == CM_TMRA_7)  && ((h) == CM_TMRA_8))     ||                         \
+    (((l) == CM_TMRA_9)  && ((h) == CM_TMRA_10))    ||                         \
+    (((l) == CM_TMRA_11) && ((h) == CM_TMRA_12)))
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+/**
+ * @defgroup TSTAMP_Local_Variables TSTAMP Local Variables
+ * @{
+ */
+static stc_tstamp_state_t m_stcTstamp;
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @defgroup TSTAMP_Local_Functions TSTAMP Local Functions
+ * @{
+ */
+
+/**
+ * @brief  Multiply a 64-bit value by a Q32.32 factor without 128-bit arithmetic.
+ * @param  [in] u64Value                Value
+ * @param  [in] u64Factor               Q32.32 factor
+ * @retval uint64_t                     Integer part of the product
+ */
+static uint64_t TSTAMP_MulQ32(uint64_t u64Value, uint64_t u64Factor)
+{
+    const uint64_t u64ValueHigh  = u64Value >> 32U;
+    const uint64_t u64ValueLow   = u64Value & 0xFFFFFFFFULL;
+    const uint64_t u64FactorHigh = u64Factor >> 32U;
+    const uint64_t u64FactorLow  = u64Factor & 0xFFFFFFFFULL;
+
+    return (u64ValueHigh * u64Factor) + (u64ValueLow * u64FactorHigh) + ((u64ValueLow * u64FactorLow) >> 32U);
+}
+
+/**
+ * @brief  Read the 32-bit hardware count of the cascaded units.
+ * @param  None
+ * @retval uint32_t                     Count
+ */
+static uint32_t TSTAMP_ReadHwCount(void)
+{
+    uint32_t u32High;
+    uint32_t u32Low;
+
+    /* The high unit must not change while the low unit is read */
+    do {
+        u32High = TMRA_GetCountValue(m_stcTstamp.TMRAxH);
+        u32Low  = TMRA_GetCountValue(m_stcTstamp.TMRAxL);
+    } while (u32High != TMRA_GetCountValue(m_stcTstamp.TMRAxH));
+
+    return ((u32High & 0xFFFFUL) << 16U) | (u32Low & 0xFFFFUL);
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup TSTAMP_Global_Functions TSTAMP Global Functions
+ * @{
+ */
+
+/**
+ * @brief  Set the fields of structure stc_tstamp_init_t to default values.
+ * @param  [out] pstcTstampInit         Pointer to a @ref stc_tstamp_init_t structure.
+ * @retval int32_t:
+ *           - LL_OK:                   Initialize success
+ *           - LL_ERR_INVD_PARAM:       pstcTstampInit is NULL
+ */
+int32_t TSTAMP_StructInit(stc_tstamp_init_t *pstcTstampInit)
+{
+    int32_t i32Ret = LL_OK;
+
+    if (NULL == pstcTstampInit) {
+        i32Ret = LL_ERR_INVD_PARAM;
+    } else {
+        pstcTstampInit->u8ClockDiv  = TMRA_CLK_DIV1;
+        pstcTstampInit->u32BusClock = CLK_BUS_PCLK0;
+    }
+    return i32Ret;
+}
+
+/**
+ * @brief  Initialize the timestamp and start counting from 0.
+ * @note   The peripheral clock of both units must be enabled, and TSTAMP_IrqHandler()
+ *         registered for the overflow interrupt of the high unit.
+ * @param  [in] TMRAxL                  Pointer to the low TMRA unit, an odd unit CM_TMRA_x
+ * @param  [in] TMRAxH                  Pointer to the high TMRA unit, the symmetric even unit of TMRAxL
+ * @param  [in] pstcTstampInit          Pointer to a @ref stc_tstamp_init_t structure.
+ * @retval int32_t:
+ *           - LL_OK:                   Initialize success
+ *           - LL_ERR_INVD_PARAM:       pstcTstampInit is NULL
+ */
+int32_t TSTAMP_Init(CM_TMRA_TypeDef *TMRAxL, CM_TMRA_TypeDef *TMRAxH, const stc_tstamp_init_t *pstcTstampInit)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+    stc_tmra_init_t stcTmraInit;
+
+    if (NULL != pstcTstampInit) {
+        DDL_ASSERT(IS_TSTAMP_UNIT_PAIR(TMRAxL, TMRAxH));
+
+        TMRA_Stop(TMRAxL);
+        TMRA_Stop(TMRAxH);
+
+        /* Low unit: software count up on the divided bus clock */
+        (void)TMRA_StructInit(&stcTmraInit);
+        stcTmraInit.sw_count.u8ClockDiv = pstcTstampInit->u8ClockDiv;
+        stcTmraInit.u32PeriodValue      = 0xFFFFUL;
+        i32Ret = TMRA_Init(TMRAxL, &stcTmraInit);
+
+        if (LL_OK == i32Ret) {
+            /* High unit: count up on the overflow of the low unit */
+            (void)TMRA_StructInit(&stcTmraInit);
+            stcTmraInit.u8CountSrc              = TMRA_CNT_SRC_HW;
+            stcTmraInit.hw_count.u16CountUpCond = TMRA_CNT_UP_COND_SYM_OVF;
+            stcTmraInit.u32PeriodValue          = 0xFFFFUL;
+            i32Ret = TMRA_Init(TMRAxH, &stcTmraInit);
+        }
+
+        if (LL_OK == i32Ret) {
+            m_stcTstamp.TMRAxL      = TMRAxL;
+            m_stcTstamp.TMRAxH      = TMRAxH;
+            m_stcTstamp.u8ClockDiv  = pstcTstampInit->u8ClockDiv;
+            m_stcTstamp.u32BusClock = pstcTstampInit->u32BusClock;
+            m_stcTstamp.u32Ext      = 0UL;
+            m_stcTstamp.u32ExtAck   = 0UL;
+            TSTAMP_UpdateFreq();
+
+            TMRA_SetCountValue(TMRAxL, 0UL);
+            TMRA_SetCountValue(TMRAxH, 0UL);
+            TMRA_ClearStatus(TMRAxH, TMRA_FLAG_OVF);
+            TMRA_IntCmd(TMRAxH, TMRA_INT_OVF, ENABLE);
+            /* Start the high unit first, so no overflow of the low unit is lost */
+            TMRA_Start(TMRAxH);
+            TMRA_Start(TMRAxL);
+        }
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Stop the timestamp.
+ * @param  None
+ * @retval None
+ */
+void TSTAMP_DeInit(void)
+{
+    if (NULL != m_stcTstamp.TMRAxL) {
+        TMRA_Stop(m_stcTstamp.TMRAxL);
+        TMRA_Stop(m_stcTstamp.TMRAxH);
+        TMRA_IntCmd(m_stcTstamp.TMRAxH, TMRA_INT_OVF, DISABLE);
+        m_stcTstamp.TMRAxL = NULL;
+        m_stcTstamp.TMRAxH = NULL;
+    }
+}
+
+/**
+ * @brief  Recompute the count frequency and the conversion factors from the
+ *         current clock configuration.
+ * @note   Call it after the bus clock has changed. The count itself is not
+ *         rescaled, timestamps taken before the change keep the old unit.
+ * @param  None
+ * @retval None
+ */
+void TSTAMP_UpdateFreq(void)
+{
+    const uint32_t u32Freq = CLK_GetBusClockFreq(m_stcTstamp.u32BusClock) >>
+                             (m_stcTstamp.u8ClockDiv >> TMRA_BCSTRL_CKDIV_POS);
+
+    if (0UL != u32Freq) {
+        m_stcTstamp.u32Freq       = u32Freq;
+        m_stcTstamp.u64NsFactor   = (TSTAMP_NS_PER_SEC << 32U) / u32Freq;
+        m_stcTstamp.u64TickFactor = ((uint64_t)u32Freq << 32U) / TSTAMP_NS_PER_SEC;
+    }
+}
+
+/**
+ * @brief  Get the 64-bit timestamp.
+ * @note   An overflow of the high unit whose interrupt is not serviced yet is
+ *         accounted through the overflow flag: it can only be the cause of a count
+ *         in the lower half of the range. When u32Ext differs from u32ExtAck, this
+ *         call interrupted TSTAMP_IrqHandler(), which has already counted the
+ *         overflow whether or not the flag is cleared yet.
+ * @param  None
+ * @retval uint64_t                     Count in units of 1/TSTAMP_GetTickFreq() second
+ */
+uint64_t TSTAMP_GetTick(void)
+{
+    uint32_t u32Ext;
+    uint32_t u32ExtAck;
+    uint32_t u32Count;
+    en_flag_status_t enOvf;
+
+    /* Retry if TSTAMP_IrqHandler() ran in between */
+    do {
+        u32Ext    = m_stcTstamp.u32Ext;
+        u32ExtAck = m_stcTstamp.u32ExtAck;
+        u32Count  = TSTAMP_ReadHwCount();
+        enOvf     = TMRA_GetStatus(m_stcTstamp.TMRAxH, TMRA_FLAG_OVF);
+    } while ((u32Ext != m_stcTstamp.u32Ext) || (u32ExtAck != m_stcTstamp.u32ExtAck));
+
+    if ((u32Ext == u32ExtAck) && (SET == enOvf) && (u32Count < TSTAMP_HALF_RANGE)) {
+        u32Ext++;
+    }
+
+    return ((uint64_t)u32Ext << 32U) | u32Count;
+}
+
+/**
+ * @brief  Get the timestamp in nanoseconds.
+ * @param  None
+ * @retval uint64_t                     Nanoseconds
+ */
+uint64_t TSTAMP_GetNs(void)
+{
+    return TSTAMP_MulQ32(TSTAMP_GetTick(), m_stcTstamp.u64NsFactor);
+}
+
+/**
+ * @brief  Get the count frequency of the timestamp.
+ * @param  None
+ * @retval uint32_t                     Count frequency in Hz
+ */
+uint32_t TSTAMP_GetTickFreq(void)
+{
+    return m_stcTstamp.u32Freq;
+}
+
+/**
+ * @brief  Convert counts to nanoseconds.
+ * @param  [in] u64Tick                 Counts, e.g. the difference of two timestamps
+ * @retval uint64_t                     Nanoseconds
+ */
+uint64_t TSTAMP_TickToNs(uint64_t u64Tick)
+{
+    return TSTAMP_MulQ32(u64Tick, m_stcTstamp.u64NsFactor);
+}
+
+/**
+ * @brief  Convert nanoseconds to counts.
+ * @param  [in] u64Ns                   Nanoseconds
+ * @retval uint64_t                     Counts
+ */
+uint64_t TSTAMP_NsToTick(uint64_t u64Ns)
+{
+    return TSTAMP_MulQ32(u64Ns, m_stcTstamp.u64TickFactor);
+}
+
+/**
+ * @brief  Timestamp interrupt handler, call it from the overflow interrupt of the high unit.
+ * @note   The extension is advanced before the flag is cleared, so a reader interrupting
+ *         the handler always finds the overflow counted by one of them.
+ * @param  None
+ * @retval None
+ */
+void TSTAMP_IrqHandler(void)
+{
+    if ((NULL != m_stcTstamp.TMRAxH) && (SET == TMRA_GetStatus(m_stcTstamp.TMRAxH, TMRA_FLAG_OVF))) {
+        m_stcTstamp.u32Ext++;
+        TMRA_ClearStatus(m_stcTstamp.TMRAxH, TMRA_FLAG_OVF);
+        m_stcTstamp.u32ExtAck = m_stcTstamp.u32Ext;
+    }
+}
+
+/**
+ * @}
+ */
+
+#endif /* LL_TSTAMP_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/******************************************************************************
+ * EOF (not truncated)
+ *****************************************************************************/
@@ -27,6 +27,7 @@
                                     Add assert for the register bit can only be set when TE=0&RE=0
    2024-08-31       CDT             Optimize condition judgment
    2024-11-08       CDT             Add assert for pvBuf pointer alignment for data width 9bit
+   2026-10-19       CDT             Get the bus clock frequency from the CLK cache
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2022-2025, Xiaohua Semiconductor Co., Ltd. All rights reserved.
@@ -43,6 +44,7 @@
  * Include files
  ******************************************************************************/
 #include "hc32_ll_usart.h"
+#include "hc32_ll_clk.h"
 #include "hc32_ll_utility.h"
 
 /**
@@ -669,7 +671,7 @@ static uint32_t USART_GetBusClockFreq(const CM_USART_TypeDef *USARTx)
 
     (void)USARTx;
 
-    u32BusClock = SystemCoreClock >> (READ_REG32_BIT(CM_CMU->SCFGR, CMU_SCFGR_PCLK1S) >> CMU_SCFGR_PCLK1S_POS);
+    u32BusClock = CLK_GetBusClockFreq(CLK_BUS_PCLK1);
 
     return u32BusClock;
 }
@@ -6,6 +6,7 @@
    Change Logs:
    Date             Author          Notes
    2024-09-13       CDT             First version
+   2026-10-19       CDT             Added API MCAN_MsgRamPlan(), MCAN_GetRxElement(), MCAN_AckRxElement()
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2022-2025, Xiaohua Semiconductor Co., Ltd. All rights reserved.
@@ -245,6 +246,8 @@
 /* MCAN data field size */
 #define IS_MCAN_DATA_FIELD_SIZE(x)      ((x) <= MCAN_DATA_SIZE_MAX)
 
+#define IS_MCAN_PAYLOAD_SIZE(x)         ((x) <= 64U)
+
 /* Tx FIFO/Queue operation mode */
 #define IS_MCAN_TX_FIFO_QUEUE_MD(x)     (((x) == MCAN_TX_FIFO_MD) || ((x) == MCAN_TX_QUEUE_MD))
 
@@ -674,6 +677,21 @@ static uint32_t MCAN_GetRxBufferNum(const CM_MCAN_TypeDef *MCANx)
     return (u32Temp / MCAN_RX_BUF_ES(MCANx));
 }
 
+/**
+ * @brief  Get the smallest data field size that holds a payload.
+ * @param  [in]  u32Payload             Payload size in bytes, 0 ~ 64.
+ * @retval An uint32_t type value of @ref MCAN_Data_Field_Size
+ */
+static uint32_t MCAN_PayloadToDataSize(uint32_t u32Payload)
+{
+    uint32_t u32DataSize = MCAN_DATA_SIZE_MIN;
+
+    while ((u32DataSize < MCAN_DATA_SIZE_MAX) && ((uint32_t)m_au8DLC2Size[u32DataSize + 8U] < u32Payload)) {
+        u32DataSize++;
+    }
+    return u32DataSize;
+}
+
 /**
  * @}
  */
@@ -1052,6 +1070,88 @@ int32_t MCAN_ExitSleepMode(CM_MCAN_TypeDef *MCANx)
     return i32Ret;
 }
 
+/**
+ * @brief  Plan the message RAM layout of an MCAN unit from its workload.
+ * @note   Only the layout members of the message RAM configuration structure are written,
+ *         u32TxFifoQueueMode is not changed. Apply the layout with MCAN_Init().
+ * @param  [in]  pstcPlan               Pointer to a @ref stc_mcan_msg_ram_plan_t structure which
+ *                                      describes the workload.
+ * @param  [out] pstcMsgRam             Pointer to a @ref stc_mcan_msg_ram_config_t structure which is used to
+ *                                      save the layout.
+ * @param  [out] pi32Headroom           Bytes of message RAM left to the MCAN unit by the layout.
+ *                                      A negative value is the shortage when the layout does not fit.
+ *                                      This parameter can be NULL.
+ * @retval int32_t:
+ *           - LL_OK:                   The layout fits the message RAM.
+ *           - LL_ERR_INVD_PARAM:       pstcPlan == NULL or pstcMsgRam == NULL;
+ *                                      A member of pstcPlan is out of range.
+ *           - LL_ERR_BUF_FULL:         The layout does not fit the message RAM, pstcMsgRam is not changed.
+ */
+int32_t MCAN_MsgRamPlan(const stc_mcan_msg_ram_plan_t *pstcPlan, stc_mcan_msg_ram_config_t *pstcMsgRam,
+                        int32_t *pi32Headroom)
+{
+    uint32_t u32RxDataSize;
+    uint32_t u32TxDataSize;
+    uint32_t u32RamSize;
+    uint32_t u32Size;
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if ((pstcPlan != NULL) && (pstcMsgRam != NULL)) {
+        if (IS_MCAN_MSG_RAM_OFFSET_ADDR(pstcPlan->u32AddrOffset) &&
+            IS_MCAN_STD_FILTER_NUM(pstcPlan->u32StdIdNum) &&
+            IS_MCAN_EXT_FILTER_NUM(pstcPlan->u32ExtIdNum) &&
+            IS_MCAN_PAYLOAD_SIZE(pstcPlan->u32RxPayload) &&
+            IS_MCAN_RX_FIFO0_NUM(pstcPlan->u32RxFifo0Burst) &&
+            IS_MCAN_RX_FIFO1_NUM(pstcPlan->u32RxFifo1Burst) &&
+            IS_MCAN_RX_BUF_NUM(pstcPlan->u32RxBufferNum) &&
+            IS_MCAN_PAYLOAD_SIZE(pstcPlan->u32TxPayload) &&
+            IS_MCAN_TX_ELMT_NUM(pstcPlan->u32TxBufferNum + pstcPlan->u32TxFifoQueueNum) &&
+            IS_MCAN_TX_EVT_NUM(pstcPlan->u32TxEventNum)) {
+            u32RamSize = MCAN_MSG_RAM_SIZE - pstcPlan->u32AddrOffset;
+            if ((pstcPlan->u32RamSize != 0U) && (pstcPlan->u32RamSize < u32RamSize)) {
+                u32RamSize = pstcPlan->u32RamSize;
+            }
+
+            /* All Rx locations share the element size of the largest payload */
+            u32RxDataSize = MCAN_PayloadToDataSize(pstcPlan->u32RxPayload);
+            u32TxDataSize = MCAN_PayloadToDataSize(pstcPlan->u32TxPayload);
+
+            u32Size  = pstcPlan->u32StdIdNum * MCAN_STD_FILTER_ES;
+            u32Size += pstcPlan->u32ExtIdNum * MCAN_EXT_FILTER_ES;
+            u32Size += (pstcPlan->u32RxFifo0Burst + pstcPlan->u32RxFifo1Burst + pstcPlan->u32RxBufferNum) * \
+                       MCAN_GET_ES(u32RxDataSize);
+            u32Size += pstcPlan->u32TxEventNum * MCAN_TX_EVT_ES;
+            u32Size += (pstcPlan->u32TxBufferNum + pstcPlan->u32TxFifoQueueNum) * MCAN_GET_ES(u32TxDataSize);
+
+            if (pi32Headroom != NULL) {
+                *pi32Headroom = (int32_t)u32RamSize - (int32_t)u32Size;
+            }
+
+            if (u32Size > u32RamSize) {
+                i32Ret = LL_ERR_BUF_FULL;
+            } else {
+                pstcMsgRam->u32AddrOffset       = pstcPlan->u32AddrOffset;
+                pstcMsgRam->u32StdFilterNum     = pstcPlan->u32StdIdNum;
+                pstcMsgRam->u32ExtFilterNum     = pstcPlan->u32ExtIdNum;
+                pstcMsgRam->u32RxFifo0Num       = pstcPlan->u32RxFifo0Burst;
+                pstcMsgRam->u32RxFifo0DataSize  = u32RxDataSize;
+                pstcMsgRam->u32RxFifo1Num       = pstcPlan->u32RxFifo1Burst;
+                pstcMsgRam->u32RxFifo1DataSize  = u32RxDataSize;
+                pstcMsgRam->u32RxBufferNum      = pstcPlan->u32RxBufferNum;
+                pstcMsgRam->u32RxBufferDataSize = u32RxDataSize;
+                pstcMsgRam->u32TxEventNum       = pstcPlan->u32TxEventNum;
+                pstcMsgRam->u32TxBufferNum      = pstcPlan->u32TxBufferNum;
+                pstcMsgRam->u32TxFifoQueueNum   = pstcPlan->u32TxFifoQueueNum;
+                pstcMsgRam->u32TxDataSize       = u32TxDataSize;
+                pstcMsgRam->u32AllocatedSize    = u32Size;
+                i32Ret = LL_OK;
+            }
+        }
+    }
+
+    return i32Ret;
+}
+
 /**
  * @brief Get the address of each element that allocated into the message RAM
  * @param  [in]  MCANx                  Pointer to MCAN instance register base.
@@ -1905,8 +2005,69 @@ void MCAN_AbortTxRequest(CM_MCAN_TypeDef *MCANx, uint32_t u32TxBuffer)
 int32_t MCAN_GetRxMsg(CM_MCAN_TypeDef *MCANx, uint32_t u32RxLocation, stc_mcan_rx_msg_t *pRxMsg)
 {
     uint32_t i;
-    uint32_t u32RxRamAddr = 0U;
     uint32_t u32Tmp;
+    stc_mcan_rx_element_t stcRxElmt;
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if (pRxMsg != NULL) {
+        i32Ret = MCAN_GetRxElement(MCANx, u32RxLocation, &stcRxElmt);
+        if (i32Ret == LL_OK) {
+            pRxMsg->ID             = stcRxElmt.ID;
+            pRxMsg->IDE            = stcRxElmt.IDE;
+            pRxMsg->RTR            = stcRxElmt.RTR;
+            pRxMsg->DLC            = stcRxElmt.DLC;
+            pRxMsg->ESI            = stcRxElmt.ESI;
+            pRxMsg->BRS            = stcRxElmt.BRS;
+            pRxMsg->FDF            = stcRxElmt.FDF;
+            pRxMsg->u32RxTimestamp = stcRxElmt.u32RxTimestamp;
+            pRxMsg->u32FilterIndex = stcRxElmt.u32FilterIndex;
+            pRxMsg->u32NmfFlag     = stcRxElmt.u32NmfFlag;
+            pRxMsg->u32DataSize    = stcRxElmt.u32DataSize;
+
+            /* Retrieve Rx payload */
+            if (pRxMsg->RTR == 0U) {
+                /* Read the Rx payload from the message RAM. */
+                for (i = 0U; i < pRxMsg->u32DataSize; i += 4U) {
+                    u32Tmp = stcRxElmt.pu32Data[i / 4U];
+                    pRxMsg->au8Data[i]      = (uint8_t)(u32Tmp);
+                    pRxMsg->au8Data[i + 1U] = (uint8_t)(u32Tmp >> 8U);
+                    pRxMsg->au8Data[i + 2U] = (uint8_t)(u32Tmp >> 16U);
+                    pRxMsg->au8Data[i + 3U] = (uint8_t)(u32Tmp >> 24U);
+                }
+            }
+
+            (void)MCAN_AckRxElement(MCANx, &stcRxElmt);
+        }
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief Get a received element in place in the Rx buffer/FIFO zone of the message RAM.
+ * @note  The header of the element is decoded, the payload is not copied. The element keeps its
+ *        slot until MCAN_AckRxElement() is called, calling this function again before the
+ *        acknowledgement returns the same Rx FIFO element.
+ * @param  [in]  MCANx                  Pointer to MCAN instance register base.
+ *                                      This parameter can be a value of the following:
+ *   @arg  CM_MCAN1:                    MCAN1 instance register base.
+ *   @arg  CM_MCAN2:                    MCAN2 instance register base.
+ * @param  [in]  u32RxLocation          Location of the received message to be read.
+ *                                      This parameter can be a value of @ref MCAN_Rx_Location
+ * @param  [out] pRxElmt                Pointer to a @ref stc_mcan_rx_element_t structure which is used to save
+ *                                      the header and the payload address of the received frame.
+ * @retval int32_t:
+ *           - LL_OK:                   No error occurred.
+ *           - LL_ERR_INVD_PARAM:       pRxElmt == NULL;
+ *                                      The selected Rx FIFO has no allocated area into the message RAM;
+ *                                      The selected Rx buffer is out of range.
+ *           - LL_ERR_BUF_EMPTY:        The selected Rx FIFO is empty.
+ */
+int32_t MCAN_GetRxElement(const CM_MCAN_TypeDef *MCANx, uint32_t u32RxLocation, stc_mcan_rx_element_t *pRxElmt)
+{
+    uint32_t u32RxRamAddr = 0U;
+    uint32_t u32R0;
+    uint32_t u32R1;
     uint32_t u32DataFiledSize = 0U;
     uint32_t u32RxGetIndex = 0U;
     int32_t i32Ret = LL_ERR_INVD_PARAM;
@@ -1914,7 +2075,7 @@ int32_t MCAN_GetRxMsg(CM_MCAN_TypeDef *MCANx, uint32_t u32RxLocation, stc_mcan_r
     /* Check function parameters */
     DDL_ASSERT(IS_MCAN_UNIT(MCANx));
 
-    if (pRxMsg != NULL) {
+    if (pRxElmt != NULL) {
         i32Ret = LL_OK;
         if (u32RxLocation == MCAN_RX_FIFO0) {
             /* Check that the Rx FIFO0 has an allocated area into the message RAM */
@@ -1980,91 +2141,99 @@ int32_t MCAN_GetRxMsg(CM_MCAN_TypeDef *MCANx, uint32_t u32RxLocation, stc_mcan_r
         }
 
         if (i32Ret == LL_OK) {
+            /* Read the two header words once */
+            u32R0 = RW_MEM32(u32RxRamAddr);
+            u32R1 = RW_MEM32(u32RxRamAddr + 4UL);
+
             /* Retrieve ID type */
-            pRxMsg->IDE = READ_REG32_BIT(RW_MEM32(u32RxRamAddr), MCAN_FRAME_XTD_MASK) >> MCAN_FRAME_XTD_POS;
-            /* Retrieve ID type */
-            if (pRxMsg->IDE == MCAN_STD_ID) {
+            pRxElmt->IDE = (u32R0 & MCAN_FRAME_XTD_MASK) >> MCAN_FRAME_XTD_POS;
+            if (pRxElmt->IDE == MCAN_STD_ID) {
                 /* Standard ID element */
-                pRxMsg->ID = READ_REG32_BIT(RW_MEM32(u32RxRamAddr), MCAN_FRAME_STDID_MASK) >> MCAN_FRAME_STDID_POS;
+                pRxElmt->ID = (u32R0 & MCAN_FRAME_STDID_MASK) >> MCAN_FRAME_STDID_POS;
             } else {
                 /* Extended ID element */
-                pRxMsg->ID = READ_REG32_BIT(RW_MEM32(u32RxRamAddr), MCAN_FRAME_EXTID_MASK);
+                pRxElmt->ID = u32R0 & MCAN_FRAME_EXTID_MASK;
             }
-
             /* Retrieve Rx frame type */
-            pRxMsg->RTR = READ_REG32_BIT(RW_MEM32(u32RxRamAddr), MCAN_FRAME_RTR_MASK) >> MCAN_FRAME_RTR_POS;
-
+            pRxElmt->RTR = (u32R0 & MCAN_FRAME_RTR_MASK) >> MCAN_FRAME_RTR_POS;
             /* Retrieve ESI */
-            pRxMsg->ESI = READ_REG32_BIT(RW_MEM32(u32RxRamAddr), MCAN_FRAME_ESI_MASK) >> MCAN_FRAME_ESI_POS;
-
-            /* Increment Rx memory pointer to second word of Rx FIFO element */
-            u32RxRamAddr += 4UL;
+            pRxElmt->ESI = (u32R0 & MCAN_FRAME_ESI_MASK) >> MCAN_FRAME_ESI_POS;
 
             /* Retrieve Rx timestamp */
-            pRxMsg->u32RxTimestamp = READ_REG32_BIT(RW_MEM32(u32RxRamAddr), MCAN_FRAME_TS_MASK);
-
+            pRxElmt->u32RxTimestamp = u32R1 & MCAN_FRAME_TS_MASK;
             /* Retrieve DLC */
-            pRxMsg->DLC = READ_REG32_BIT(RW_MEM32(u32RxRamAddr), MCAN_FRAME_DLC_MASK) >> MCAN_FRAME_DLC_POS;
-            pRxMsg->u32DataSize = m_au8DLC2Size[pRxMsg->DLC];
-
+            pRxElmt->DLC = (u32R1 & MCAN_FRAME_DLC_MASK) >> MCAN_FRAME_DLC_POS;
+            pRxElmt->u32DataSize = m_au8DLC2Size[pRxElmt->DLC];
             /* Retrieve BRS */
-            pRxMsg->BRS = READ_REG32_BIT(RW_MEM32(u32RxRamAddr), MCAN_FRAME_BRS_MASK) >> MCAN_FRAME_BRS_POS;
-
+            pRxElmt->BRS = (u32R1 & MCAN_FRAME_BRS_MASK) >> MCAN_FRAME_BRS_POS;
             /* Retrieve FDF */
-            pRxMsg->FDF = READ_REG32_BIT(RW_MEM32(u32RxRamAddr), MCAN_FRAME_FDF_MASK) >> MCAN_FRAME_FDF_POS;
+            pRxElmt->FDF = (u32R1 & MCAN_FRAME_FDF_MASK) >> MCAN_FRAME_FDF_POS;
             /* Determine the CAN frame format: classical CAN or FD CAN */
-            if (pRxMsg->FDF == 0U) {
+            if (pRxElmt->FDF == 0U) {
                 /* Max 8 bytes for classical CAN */
-                if (pRxMsg->u32DataSize > CAN20_DATA_SIZE_MAX) {
-                    pRxMsg->u32DataSize = CAN20_DATA_SIZE_MAX;
+                if (pRxElmt->u32DataSize > CAN20_DATA_SIZE_MAX) {
+                    pRxElmt->u32DataSize = CAN20_DATA_SIZE_MAX;
                 }
             } else {
                 /* Max size of the stored data is the allocated size */
-                if (pRxMsg->u32DataSize > u32DataFiledSize) {
-                    pRxMsg->u32DataSize = u32DataFiledSize;
+                if (pRxElmt->u32DataSize > u32DataFiledSize) {
+                    pRxElmt->u32DataSize = u32DataFiledSize;
                 }
             }
-
             /* Retrieve filter index */
-            pRxMsg->u32FilterIndex = READ_REG32_BIT(RW_MEM32(u32RxRamAddr), MCAN_FRAME_FIDX_MASK) >> MCAN_FRAME_FIDX_POS;
-
+            pRxElmt->u32FilterIndex = (u32R1 & MCAN_FRAME_FIDX_MASK) >> MCAN_FRAME_FIDX_POS;
             /* Retrieve non-matching frame */
-            pRxMsg->u32NmfFlag = READ_REG32_BIT(RW_MEM32(u32RxRamAddr), MCAN_FRAME_ANMF_MASK) >> MCAN_FRAME_ANMF_POS;
+            pRxElmt->u32NmfFlag = (u32R1 & MCAN_FRAME_ANMF_MASK) >> MCAN_FRAME_ANMF_POS;
 
-            /* Increment Rx memory pointer to payload of Rx FIFO element */
-            /* Retrieve Rx payload */
-            if (pRxMsg->RTR == 0U) {
-                /* Read the Rx payload from the message RAM. */
-                for (i = 0U; i < pRxMsg->u32DataSize; i += 4U) {
-                    u32RxRamAddr += 4U;
-                    u32Tmp = RW_MEM32(u32RxRamAddr);
-                    pRxMsg->au8Data[i]      = (uint8_t)(u32Tmp);
-                    pRxMsg->au8Data[i + 1U] = (uint8_t)(u32Tmp >> 8U);
-                    pRxMsg->au8Data[i + 2U] = (uint8_t)(u32Tmp >> 16U);
-                    pRxMsg->au8Data[i + 3U] = (uint8_t)(u32Tmp >> 24U);
-                }
-            }
+            /* Payload starts from the third word of the element */
+            pRxElmt->pu32Data      = (__I uint32_t *)(u32RxRamAddr + 8UL);
+            pRxElmt->u32RxLocation = u32RxLocation;
+            pRxElmt->u32RxIndex    = u32RxGetIndex;
+        }
+    }
 
-            if (u32RxLocation == MCAN_RX_FIFO0) {
-                /* Rx element is assigned to the Rx FIFO0.
-                   Acknowledge the Rx FIFO0 that the oldest element
-                   is read so that it increments the get index. */
-                WRITE_REG32(MCANx->RXF0A, u32RxGetIndex);
-            } else if (u32RxLocation == MCAN_RX_FIFO1) {
-                /* Rx element is assigned to the Rx FIFO1.
-                   Acknowledge the Rx FIFO1 that the oldest element
-                   is read so that it increments the get index. */
-                WRITE_REG32(MCANx->RXF1A, u32RxGetIndex);
+    return i32Ret;
+}
+
+/**
+ * @brief Acknowledge a received element got by MCAN_GetRxElement(), its slot is released to the MCAN.
+ * @note  For an Rx FIFO, all the elements up to and including this element are released.
+ * @param  [in]  MCANx                  Pointer to MCAN instance register base.
+ *                                      This parameter can be a value of the following:
+ *   @arg  CM_MCAN1:                    MCAN1 instance register base.
+ *   @arg  CM_MCAN2:                    MCAN2 instance register base.
+ * @param  [in]  pRxElmt                Pointer to a @ref stc_mcan_rx_element_t structure filled by MCAN_GetRxElement().
+ * @retval int32_t:
+ *           - LL_OK:                   No error occurred.
+ *           - LL_ERR_INVD_PARAM:       pRxElmt == NULL.
+ */
+int32_t MCAN_AckRxElement(CM_MCAN_TypeDef *MCANx, const stc_mcan_rx_element_t *pRxElmt)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    DDL_ASSERT(IS_MCAN_UNIT(MCANx));
+
+    if (pRxElmt != NULL) {
+        if (pRxElmt->u32RxLocation == MCAN_RX_FIFO0) {
+            /* Rx element is assigned to the Rx FIFO0.
+               Acknowledge the Rx FIFO0 that the oldest element
+               is read so that it increments the get index. */
+            WRITE_REG32(MCANx->RXF0A, pRxElmt->u32RxIndex);
+        } else if (pRxElmt->u32RxLocation == MCAN_RX_FIFO1) {
+            /* Rx element is assigned to the Rx FIFO1.
+               Acknowledge the Rx FIFO1 that the oldest element
+               is read so that it increments the get index. */
+            WRITE_REG32(MCANx->RXF1A, pRxElmt->u32RxIndex);
+        } else {
+            /* Rx element is assigned to a dedicated Rx buffer.
+               Clear the new data flag of the current Rx buffer. */
+            if (pRxElmt->u32RxLocation < MCAN_RX_BUF32) {
+                WRITE_REG32(MCANx->NDAT1, (1UL << pRxElmt->u32RxLocation));
             } else {
-                /* Rx element is assigned to a dedicated Rx buffer.
-                   Clear the new data flag of the current Rx buffer. */
-                if (u32RxLocation < MCAN_RX_BUF32) {
-                    WRITE_REG32(MCANx->NDAT1, (1UL << u32RxLocation));
-                } else {
-                    WRITE_REG32(MCANx->NDAT2, (1UL << (u32RxLocation & 0x1FUL)));
-                }
+                WRITE_REG32(MCANx->NDAT2, (1UL << (pRxElmt->u32RxLocation & 0x1FUL)));
             }
         }
+        i32Ret = LL_OK;
     }
 
     return i32Ret;
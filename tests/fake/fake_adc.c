@@ -0,0 +1,243 @@
+/**
+ *******************************************************************************
+ * @file  fake_adc.c
+ * @brief Behavioral model of the ADC driver for the host tests.
+ *        Conversions happen when the test calls FAKE_ADC_Convert(), the end of
+ *        sequence A is raised through the AOS model. The analog watchdog flags
+ *        are latched until cleared.
+ *******************************************************************************
+ */
+#include <string.h>
+#include "fake_adc.h"
+#include "fake_dma.h"
+
+#define ADC_UNIT_NUM                    (3U)
+
+typedef struct {
+    uint32_t au32MxCh[2];
+    uint16_t au16Trigger[2];
+    en_functional_state_t aenTrigger[2];
+    en_functional_state_t enStart;
+    uint16_t u16ScanMode;
+    uint8_t au8AwdCh[2];
+    stc_adc_awd_config_t astcAwd[2];
+    en_functional_state_t aenAwd[2];
+    uint16_t u16CombMode;
+    uint16_t u16AwdInt;
+    uint32_t u32AwdFlag;
+    void (*pfnAwdIrq)(void);
+} stc_fake_adc_t;
+
+static stc_fake_adc_t m_astcAdc[ADC_UNIT_NUM];
+
+static uint32_t FAKE_ADC_Index(const CM_ADC_TypeDef *ADCx)
+{
+    return (uint32_t)(ADCx - CM_ADC1) % ADC_UNIT_NUM;
+}
+
+static stc_fake_adc_t *FAKE_ADC_Unit(const CM_ADC_TypeDef *ADCx)
+{
+    return &m_astcAdc[FAKE_ADC_Index(ADCx)];
+}
+
+void FAKE_ADC_Reset(void)
+{
+    (void)memset(m_astcAdc, 0, sizeof(m_astcAdc));
+    (void)memset(HOST_ADC, 0, sizeof(HOST_ADC));
+}
+
+static uint8_t FAKE_ADC_AwdHit(const stc_fake_adc_t *pstcAdc, uint8_t u8Unit, const uint16_t au16Value[])
+{
+    const stc_adc_awd_config_t *pstcAwd = &pstcAdc->astcAwd[u8Unit];
+    const uint8_t u8Ch = pstcAdc->au8AwdCh[u8Unit];
+    uint16_t u16Val;
+    uint8_t u8Hit = 0U;
+
+    if ((ENABLE == pstcAdc->aenAwd[u8Unit]) && (0UL != (pstcAdc->au32MxCh[ADC_SEQ_A] & (1UL << u8Ch)))) {
+        u16Val = au16Value[u8Ch];
+        if (ADC_AWD_MD_CMP_IN == pstcAwd->u16WatchdogMode) {
+            u8Hit = ((u16Val > pstcAwd->u16LowThreshold) && (u16Val < pstcAwd->u16HighThreshold)) ? 1U : 0U;
+        } else {
+            u8Hit = ((u16Val > pstcAwd->u16HighThreshold) || (u16Val < pstcAwd->u16LowThreshold)) ? 1U : 0U;
+        }
+    }
+    return u8Hit;
+}
+
+static void FAKE_ADC_AwdScan(stc_fake_adc_t *pstcAdc, const uint16_t au16Value[])
+{
+    const uint8_t u8Hit0 = FAKE_ADC_AwdHit(pstcAdc, ADC_AWD0, au16Value);
+    const uint8_t u8Hit1 = FAKE_ADC_AwdHit(pstcAdc, ADC_AWD1, au16Value);
+    uint8_t u8Comb = 0U;
+    uint8_t u8Irq;
+
+    if (0U != u8Hit0) {
+        pstcAdc->u32AwdFlag |= ADC_AWD_FLAG_AWD0;
+    }
+    if (0U != u8Hit1) {
+        pstcAdc->u32AwdFlag |= ADC_AWD_FLAG_AWD1;
+    }
+    if (ADC_AWD_COMB_OR == pstcAdc->u16CombMode) {
+        u8Comb = (uint8_t)(u8Hit0 | u8Hit1);
+    } else if (ADC_AWD_COMB_AND == pstcAdc->u16CombMode) {
+        u8Comb = (uint8_t)(u8Hit0 & u8Hit1);
+    } else if (ADC_AWD_COMB_XOR == pstcAdc->u16CombMode) {
+        u8Comb = (uint8_t)(u8Hit0 ^ u8Hit1);
+    } else {
+        /* Not combined */
+    }
+    if (0U != u8Comb) {
+        pstcAdc->u32AwdFlag |= ADC_AWD_FLAG_COMB;
+    }
+
+    if (ADC_AWD_COMB_INVD == pstcAdc->u16CombMode) {
+        u8Irq = (((0U != u8Hit0) && (0U != (pstcAdc->u16AwdInt & ADC_AWD_INT_AWD0))) ||
+                 ((0U != u8Hit1) && (0U != (pstcAdc->u16AwdInt & ADC_AWD_INT_AWD1)))) ? 1U : 0U;
+    } else {
+        u8Irq = ((0U != u8Comb) && (0U != (pstcAdc->u16AwdInt & ADC_AWD_INT_AWD0))) ? 1U : 0U;
+    }
+    if ((0U != u8Irq) && (NULL != pstcAdc->pfnAwdIrq) && (0UL == g_u32HostPrimask)) {
+        pstcAdc->pfnAwdIrq();
+    }
+}
+
+void FAKE_ADC_SetAwdIrq(const CM_ADC_TypeDef *ADCx, void (*pfnIrq)(void))
+{
+    FAKE_ADC_Unit(ADCx)->pfnAwdIrq = pfnIrq;
+}
+
+void FAKE_ADC_Convert(CM_ADC_TypeDef *ADCx, const uint16_t au16Value[])
+{
+    static const en_event_src_t aenEoca[ADC_UNIT_NUM] = {EVT_SRC_ADC1_EOCA, EVT_SRC_ADC2_EOCA, EVT_SRC_ADC3_EOCA};
+    stc_fake_adc_t *pstcAdc = FAKE_ADC_Unit(ADCx);
+    __IO uint16_t *pu16Dr = &ADCx->DR0;
+    uint32_t i;
+
+    if ((ENABLE == pstcAdc->enStart) || (ENABLE == pstcAdc->aenTrigger[ADC_SEQ_A])) {
+        for (i = 0UL; i < 20UL; i++) {
+            if (0UL != (pstcAdc->au32MxCh[ADC_SEQ_A] & (1UL << i))) {
+                pu16Dr[i] = au16Value[i];
+            }
+        }
+        /* The watchdogs compare each channel as it is converted, before the end of the sequence */
+        FAKE_ADC_AwdScan(pstcAdc, au16Value);
+        FAKE_AOS_Fire(aenEoca[FAKE_ADC_Index(ADCx)]);
+    }
+}
+
+uint32_t FAKE_ADC_GetSeqAMxCh(const CM_ADC_TypeDef *ADCx)
+{
+    return FAKE_ADC_Unit(ADCx)->au32MxCh[ADC_SEQ_A];
+}
+
+en_functional_state_t FAKE_ADC_GetRunState(const CM_ADC_TypeDef *ADCx)
+{
+    const stc_fake_adc_t *pstcAdc = FAKE_ADC_Unit(ADCx);
+
+    return ((ENABLE == pstcAdc->enStart) || (ENABLE == pstcAdc->aenTrigger[ADC_SEQ_A])) ? ENABLE : DISABLE;
+}
+
+/*******************************************************************************
+ * ADC driver API
+ ******************************************************************************/
+int32_t ADC_StructInit(stc_adc_init_t *pstcAdcInit)
+{
+    pstcAdcInit->u16ScanMode   = ADC_MD_SEQA_SINGLESHOT;
+    pstcAdcInit->u16Resolution = ADC_RESOLUTION_12BIT;
+    pstcAdcInit->u16DataAlign  = ADC_DATAALIGN_RIGHT;
+    return LL_OK;
+}
+
+int32_t ADC_Init(CM_ADC_TypeDef *ADCx, const stc_adc_init_t *pstcAdcInit)
+{
+    FAKE_ADC_Unit(ADCx)->u16ScanMode = pstcAdcInit->u16ScanMode;
+    return LL_OK;
+}
+
+void ADC_MxChCmd(CM_ADC_TypeDef *ADCx, uint8_t u8Seq, uint32_t u32MxCh, en_functional_state_t enNewState)
+{
+    stc_fake_adc_t *pstcAdc = FAKE_ADC_Unit(ADCx);
+
+    if (ENABLE == enNewState) {
+        pstcAdc->au32MxCh[u8Seq] |= u32MxCh;
+    } else {
+        pstcAdc->au32MxCh[u8Seq] &= ~u32MxCh;
+    }
+}
+
+void ADC_ConvDataAverageConfig(CM_ADC_TypeDef *ADCx, uint16_t u16AverageCount)
+{
+}
+
+void ADC_ConvDataAverageMxChCmd(CM_ADC_TypeDef *ADCx, uint32_t u32MxCh, en_functional_state_t enNewState)
+{
+}
+
+void ADC_TriggerConfig(CM_ADC_TypeDef *ADCx, uint8_t u8Seq, uint16_t u16TriggerSel)
+{
+    FAKE_ADC_Unit(ADCx)->au16Trigger[u8Seq] = u16TriggerSel;
+}
+
+void ADC_TriggerCmd(CM_ADC_TypeDef *ADCx, uint8_t u8Seq, en_functional_state_t enNewState)
+{
+    FAKE_ADC_Unit(ADCx)->aenTrigger[u8Seq] = enNewState;
+}
+
+int32_t ADC_Start(CM_ADC_TypeDef *ADCx)
+{
+    FAKE_ADC_Unit(ADCx)->enStart = ENABLE;
+    return LL_OK;
+}
+
+void ADC_Stop(CM_ADC_TypeDef *ADCx)
+{
+    FAKE_ADC_Unit(ADCx)->enStart = DISABLE;
+}
+
+void ADC_SyncModeConfig(uint16_t u16SyncUnit, uint16_t u16SyncMode, uint8_t u8TriggerDelay)
+{
+}
+
+void ADC_SyncModeCmd(en_functional_state_t enNewState)
+{
+}
+
+int32_t ADC_AWD_Config(CM_ADC_TypeDef *ADCx, uint8_t u8AwdUnit, uint8_t u8Ch, const stc_adc_awd_config_t *pstcAwd)
+{
+    stc_fake_adc_t *pstcAdc = FAKE_ADC_Unit(ADCx);
+
+    pstcAdc->au8AwdCh[u8AwdUnit] = u8Ch;
+    pstcAdc->astcAwd[u8AwdUnit]  = *pstcAwd;
+    return LL_OK;
+}
+
+void ADC_AWD_SetCombMode(CM_ADC_TypeDef *ADCx, uint16_t u16CombMode)
+{
+    FAKE_ADC_Unit(ADCx)->u16CombMode = u16CombMode;
+}
+
+void ADC_AWD_Cmd(CM_ADC_TypeDef *ADCx, uint8_t u8AwdUnit, en_functional_state_t enNewState)
+{
+    FAKE_ADC_Unit(ADCx)->aenAwd[u8AwdUnit] = enNewState;
+}
+
+void ADC_AWD_IntCmd(CM_ADC_TypeDef *ADCx, uint16_t u16IntType, en_functional_state_t enNewState)
+{
+    stc_fake_adc_t *pstcAdc = FAKE_ADC_Unit(ADCx);
+
+    if (ENABLE == enNewState) {
+        pstcAdc->u16AwdInt |= u16IntType;
+    } else {
+        pstcAdc->u16AwdInt &= (uint16_t)~u16IntType;
+    }
+}
+
+en_flag_status_t ADC_AWD_GetStatus(const CM_ADC_TypeDef *ADCx, uint32_t u32Flag)
+{
+    return (0UL != (FAKE_ADC_Unit(ADCx)->u32AwdFlag & u32Flag)) ? SET : RESET;
+}
+
+void ADC_AWD_ClearStatus(CM_ADC_TypeDef *ADCx, uint32_t u32Flag)
+{
+    FAKE_ADC_Unit(ADCx)->u32AwdFlag &= ~u32Flag;
+}
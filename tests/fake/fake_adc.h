@@ -0,0 +1,24 @@
+/**
+ *******************************************************************************
+ * @file  fake_adc.h
+ * @brief Behavioral model of the ADC driver for the host tests.
+ *******************************************************************************
+ */
+#ifndef __FAKE_ADC_H__
+#define __FAKE_ADC_H__
+
+#include "hc32_ll_adc.h"
+
+void FAKE_ADC_Reset(void);
+/* One scan of sequence A, au16Value[] is indexed by channel. The data registers
+   of the sequence A channels are written, the analog watchdogs are evaluated
+   and the EOCA event is raised, if the unit was started or its sequence A
+   trigger is enabled */
+void FAKE_ADC_Convert(CM_ADC_TypeDef *ADCx, const uint16_t au16Value[]);
+/* Called when an enabled AWD interrupt condition is met during a scan. In a
+   combination mode the AWD0 interrupt enable gates the combined flag */
+void FAKE_ADC_SetAwdIrq(const CM_ADC_TypeDef *ADCx, void (*pfnIrq)(void));
+uint32_t FAKE_ADC_GetSeqAMxCh(const CM_ADC_TypeDef *ADCx);
+en_functional_state_t FAKE_ADC_GetRunState(const CM_ADC_TypeDef *ADCx);
+
+#endif /* __FAKE_ADC_H__ */
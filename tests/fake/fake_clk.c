@@ -0,0 +1,255 @@
+/**
+ *******************************************************************************
+ * @file  fake_clk.c
+ * @brief Clock tree model of the CLK, PWC, EFM, SRAM and GPIO drivers for the
+ *        host tests.
+ *        The system clock source, the bus dividers, the wait cycles and the
+ *        speed mode are plain state, every write advances the DWT cycle
+ *        counter and is checked by the callback of the test.
+ *******************************************************************************
+ */
+#include <string.h>
+#include "fake_clk.h"
+
+/* DWT cycles taken by a write */
+#define WRITE_CYCLES                    (64UL)
+
+#define SRAM_SEL_OTHER                  (SRAM_SRAM123 | SRAM_SRAM4 | SRAM_SRAMB)
+
+static struct {
+    uint32_t au32SrcFreq[CLK_SYSCLK_SRC_PLL + 1U];
+    stc_fake_clk_state_t stcState;
+    void (*pfnCheck)(const stc_fake_clk_state_t *pstcState);
+    int32_t i32PreRet;
+    int32_t i32EfmRet;
+    uint8_t u8Change;
+    uint32_t u32Write;
+    uint32_t u32Begin;
+    uint32_t u32End;
+    uint32_t u32EndEvent;
+    uint32_t u32Violation;
+} m_stcClk;
+
+static void Write(void)
+{
+    m_stcClk.u32Write++;
+    HOST_DWT.CYCCNT += WRITE_CYCLES;
+    if (0U == m_stcClk.u8Change) {
+        m_stcClk.u32Violation++;
+    }
+    if (NULL != m_stcClk.pfnCheck) {
+        m_stcClk.pfnCheck(&m_stcClk.stcState);
+    }
+}
+
+static void GetFreq(stc_clock_freq_t *pstcClockFreq)
+{
+    const uint32_t u32Sysclk = m_stcClk.au32SrcFreq[m_stcClk.stcState.u8Src];
+    const uint32_t u32Div = m_stcClk.stcState.u32Div;
+
+    pstcClockFreq->u32SysclkFreq = u32Sysclk;
+    pstcClockFreq->u32HclkFreq   = u32Sysclk >> ((u32Div & CMU_SCFGR_HCLKS)  >> CMU_SCFGR_HCLKS_POS);
+    pstcClockFreq->u32Pclk0Freq  = u32Sysclk >> ((u32Div & CMU_SCFGR_PCLK0S) >> CMU_SCFGR_PCLK0S_POS);
+    pstcClockFreq->u32Pclk1Freq  = u32Sysclk >> ((u32Div & CMU_SCFGR_PCLK1S) >> CMU_SCFGR_PCLK1S_POS);
+    pstcClockFreq->u32Pclk2Freq  = u32Sysclk >> ((u32Div & CMU_SCFGR_PCLK2S) >> CMU_SCFGR_PCLK2S_POS);
+    pstcClockFreq->u32Pclk3Freq  = u32Sysclk >> ((u32Div & CMU_SCFGR_PCLK3S) >> CMU_SCFGR_PCLK3S_POS);
+    pstcClockFreq->u32Pclk4Freq  = u32Sysclk >> ((u32Div & CMU_SCFGR_PCLK4S) >> CMU_SCFGR_PCLK4S_POS);
+    pstcClockFreq->u32ExclkFreq  = u32Sysclk >> ((u32Div & CMU_SCFGR_EXCKS)  >> CMU_SCFGR_EXCKS_POS);
+}
+
+void FAKE_CLK_Reset(const uint32_t *pu32SrcFreq, const stc_fake_clk_state_t *pstcState)
+{
+    (void)memset(&m_stcClk, 0, sizeof(m_stcClk));
+    (void)memcpy(m_stcClk.au32SrcFreq, pu32SrcFreq, sizeof(m_stcClk.au32SrcFreq));
+    m_stcClk.stcState = *pstcState;
+    (void)memset(&HOST_DWT, 0, sizeof(HOST_DWT));
+    (void)memset(&HOST_CoreDebug, 0, sizeof(HOST_CoreDebug));
+}
+
+void FAKE_CLK_SetCheck(void (*pfnCheck)(const stc_fake_clk_state_t *pstcState))
+{
+    m_stcClk.pfnCheck = pfnCheck;
+}
+
+void FAKE_CLK_GetState(stc_fake_clk_state_t *pstcState)
+{
+    *pstcState = m_stcClk.stcState;
+}
+
+void FAKE_CLK_SetPreRet(int32_t i32Ret)
+{
+    m_stcClk.i32PreRet = i32Ret;
+}
+
+void FAKE_CLK_SetEfmRet(int32_t i32Ret)
+{
+    m_stcClk.i32EfmRet = i32Ret;
+}
+
+uint32_t FAKE_CLK_GetWriteCount(void)
+{
+    return m_stcClk.u32Write;
+}
+
+uint32_t FAKE_CLK_GetBeginCount(void)
+{
+    return m_stcClk.u32Begin;
+}
+
+uint32_t FAKE_CLK_GetEndCount(void)
+{
+    return m_stcClk.u32End;
+}
+
+uint32_t FAKE_CLK_GetEndEvent(void)
+{
+    return m_stcClk.u32EndEvent;
+}
+
+uint32_t FAKE_CLK_GetViolation(void)
+{
+    return m_stcClk.u32Violation;
+}
+
+/*******************************************************************************
+ * CLK driver API
+ ******************************************************************************/
+void CLK_SetSysClockSrc(uint8_t u8Src)
+{
+    m_stcClk.stcState.u8Src = u8Src;
+    Write();
+}
+
+void CLK_SetClockDiv(uint32_t u32Clock, uint32_t u32Div)
+{
+    /* The bus selections are the divider fields */
+    m_stcClk.stcState.u32Div = (m_stcClk.stcState.u32Div & ~u32Clock) | (u32Div & u32Clock);
+    Write();
+}
+
+int32_t CLK_PLLInit(const stc_clock_pll_init_t *pstcPLLInit)
+{
+    (void)pstcPLLInit;
+    Write();
+    return LL_OK;
+}
+
+int32_t CLK_GetClockFreq(stc_clock_freq_t *pstcClockFreq)
+{
+    GetFreq(pstcClockFreq);
+    return LL_OK;
+}
+
+uint32_t CLK_GetBusClockFreq(uint32_t u32Clock)
+{
+    stc_clock_freq_t stcClockFreq;
+    uint32_t u32ClockFreq;
+
+    GetFreq(&stcClockFreq);
+    switch (u32Clock) {
+        case CLK_BUS_HCLK:
+            u32ClockFreq = stcClockFreq.u32HclkFreq;
+            break;
+        case CLK_BUS_PCLK0:
+            u32ClockFreq = stcClockFreq.u32Pclk0Freq;
+            break;
+        case CLK_BUS_PCLK1:
+            u32ClockFreq = stcClockFreq.u32Pclk1Freq;
+            break;
+        case CLK_BUS_PCLK2:
+            u32ClockFreq = stcClockFreq.u32Pclk2Freq;
+            break;
+        case CLK_BUS_PCLK3:
+            u32ClockFreq = stcClockFreq.u32Pclk3Freq;
+            break;
+        case CLK_BUS_PCLK4:
+            u32ClockFreq = stcClockFreq.u32Pclk4Freq;
+            break;
+        case CLK_BUS_EXCLK:
+            u32ClockFreq = stcClockFreq.u32ExclkFreq;
+            break;
+        default:
+            u32ClockFreq = stcClockFreq.u32SysclkFreq;
+            break;
+    }
+    return u32ClockFreq;
+}
+
+int32_t CLK_ChangeBegin(const stc_clock_freq_t *pstcClockFreq)
+{
+    int32_t i32Ret = LL_ERR_BUSY;
+
+    if (NULL == pstcClockFreq) {
+        i32Ret = LL_ERR_INVD_PARAM;
+    } else if ((0U == m_stcClk.u8Change) && (LL_OK == m_stcClk.i32PreRet)) {
+        m_stcClk.u8Change = 1U;
+        m_stcClk.u32Begin++;
+        i32Ret = LL_OK;
+    } else {
+        /* Refused, nothing to end */
+    }
+    return i32Ret;
+}
+
+void CLK_ChangeEnd(uint32_t u32Event)
+{
+    if (0U == m_stcClk.u8Change) {
+        m_stcClk.u32Violation++;
+    }
+    m_stcClk.u8Change = 0U;
+    m_stcClk.u32End++;
+    m_stcClk.u32EndEvent = u32Event;
+}
+
+/*******************************************************************************
+ * PWC, EFM, SRAM and GPIO driver API
+ ******************************************************************************/
+int32_t PWC_HighSpeedToLowSpeed(void)
+{
+    int32_t i32Ret = LL_OK;
+
+    if (m_stcClk.au32SrcFreq[m_stcClk.stcState.u8Src] > FAKE_CLK_ULOW_SPEED_MAX) {
+        m_stcClk.u32Violation++;
+        i32Ret = LL_ERR;
+    } else {
+        m_stcClk.stcState.u8UlowSpeed = 1U;
+        Write();
+    }
+    return i32Ret;
+}
+
+int32_t PWC_LowSpeedToHighSpeed(void)
+{
+    m_stcClk.stcState.u8UlowSpeed = 0U;
+    Write();
+    return LL_OK;
+}
+
+int32_t EFM_SetWaitCycle(uint32_t u32WaitCycle)
+{
+    if (LL_OK == m_stcClk.i32EfmRet) {
+        m_stcClk.stcState.u32EfmWait = u32WaitCycle;
+        Write();
+    }
+    return m_stcClk.i32EfmRet;
+}
+
+void SRAM_SetWaitCycle(uint32_t u32SramSel, uint32_t u32WriteCycle, uint32_t u32ReadCycle)
+{
+    if (u32WriteCycle != u32ReadCycle) {
+        m_stcClk.u32Violation++;
+    }
+    if (0UL != (u32SramSel & SRAM_SRAMH)) {
+        m_stcClk.stcState.u32SramhWait = u32ReadCycle;
+    }
+    if (0UL != (u32SramSel & SRAM_SEL_OTHER)) {
+        m_stcClk.stcState.u32SramWait = u32ReadCycle;
+    }
+    Write();
+}
+
+void GPIO_SetReadWaitCycle(uint16_t u16ReadWait)
+{
+    m_stcClk.stcState.u16GpioWait = u16ReadWait;
+    Write();
+}
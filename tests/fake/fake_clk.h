@@ -0,0 +1,46 @@
+/**
+ *******************************************************************************
+ * @file  fake_clk.h
+ * @brief Clock tree model of the CLK, PWC, EFM, SRAM and GPIO drivers for the
+ *        host tests.
+ *******************************************************************************
+ */
+#ifndef __FAKE_CLK_H__
+#define __FAKE_CLK_H__
+
+#include "hc32_ll_clk.h"
+#include "hc32_ll_efm.h"
+#include "hc32_ll_gpio.h"
+#include "hc32_ll_pwc.h"
+#include "hc32_ll_sram.h"
+
+/* Highest system clock of the ultra low speed mode */
+#define FAKE_CLK_ULOW_SPEED_MAX         (8000000UL)
+
+typedef struct {
+    uint8_t u8Src;                      /* A value of @ref CLK_System_Clock_Source */
+    uint32_t u32Div;                    /* Bus dividers, an OR of @ref CLK_Clock_Divider values */
+    uint32_t u32EfmWait;
+    uint32_t u32SramhWait;
+    uint32_t u32SramWait;               /* SRAM123, SRAM4 and SRAMB */
+    uint16_t u16GpioWait;
+    uint8_t u8UlowSpeed;
+} stc_fake_clk_state_t;
+
+/* pu32SrcFreq gives the frequency of each system clock source */
+void FAKE_CLK_Reset(const uint32_t *pu32SrcFreq, const stc_fake_clk_state_t *pstcState);
+/* Called after every write changing the state */
+void FAKE_CLK_SetCheck(void (*pfnCheck)(const stc_fake_clk_state_t *pstcState));
+void FAKE_CLK_GetState(stc_fake_clk_state_t *pstcState);
+/* Answer of the notifiers to CLK_NOTIFY_PRE and return value of EFM_SetWaitCycle() */
+void FAKE_CLK_SetPreRet(int32_t i32Ret);
+void FAKE_CLK_SetEfmRet(int32_t i32Ret);
+uint32_t FAKE_CLK_GetWriteCount(void);
+uint32_t FAKE_CLK_GetBeginCount(void);
+uint32_t FAKE_CLK_GetEndCount(void);
+uint32_t FAKE_CLK_GetEndEvent(void);
+/* Writes outside CLK_ChangeBegin() and CLK_ChangeEnd(), unbalanced calls and
+   the ultra low speed mode entered with a fast clock */
+uint32_t FAKE_CLK_GetViolation(void);
+
+#endif /* __FAKE_CLK_H__ */
@@ -0,0 +1,44 @@
+/**
+ *******************************************************************************
+ * @file  fake_dac.c
+ * @brief Behavioral model of the DAC driver for the host tests.
+ *        The data registers are plain memory written by the DMA model.
+ *******************************************************************************
+ */
+#include <string.h>
+#include "fake_dac.h"
+
+#define DAC_UNIT_NUM                    (2U)
+
+static en_functional_state_t m_aenCh[DAC_UNIT_NUM][2];
+
+static uint32_t FAKE_DAC_Index(const CM_DAC_TypeDef *DACx)
+{
+    return (uint32_t)(DACx - CM_DAC1) % DAC_UNIT_NUM;
+}
+
+void FAKE_DAC_Reset(void)
+{
+    (void)memset(m_aenCh, 0, sizeof(m_aenCh));
+    (void)memset(HOST_DAC, 0, sizeof(HOST_DAC));
+}
+
+en_functional_state_t FAKE_DAC_GetChState(const CM_DAC_TypeDef *DACx, uint16_t u16Ch)
+{
+    return m_aenCh[FAKE_DAC_Index(DACx)][u16Ch & 1U];
+}
+
+/*******************************************************************************
+ * DAC driver API
+ ******************************************************************************/
+int32_t DAC_Start(CM_DAC_TypeDef *DACx, uint16_t u16Ch)
+{
+    m_aenCh[FAKE_DAC_Index(DACx)][u16Ch & 1U] = ENABLE;
+    return LL_OK;
+}
+
+void DAC_StartDualCh(CM_DAC_TypeDef *DACx)
+{
+    m_aenCh[FAKE_DAC_Index(DACx)][DAC_CH1] = ENABLE;
+    m_aenCh[FAKE_DAC_Index(DACx)][DAC_CH2] = ENABLE;
+}
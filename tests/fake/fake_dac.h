@@ -0,0 +1,16 @@
+/**
+ *******************************************************************************
+ * @file  fake_dac.h
+ * @brief Behavioral model of the DAC driver for the host tests.
+ *******************************************************************************
+ */
+#ifndef __FAKE_DAC_H__
+#define __FAKE_DAC_H__
+
+#include "hc32_ll_dac.h"
+
+void FAKE_DAC_Reset(void);
+/* Set by DAC_Start() and DAC_StartDualCh(), the output is the data register */
+en_functional_state_t FAKE_DAC_GetChState(const CM_DAC_TypeDef *DACx, uint16_t u16Ch);
+
+#endif /* __FAKE_DAC_H__ */
@@ -0,0 +1,216 @@
+/**
+ *******************************************************************************
+ * @file  fake_dcu.c
+ * @brief Behavioral model of the DCU driver for the host tests.
+ *        Add and sub run on a DATA1 write, DATA0 keeping the result modulo
+ *        the data width and the carry flag latching an overflow or underflow.
+ *        Compare runs on a DATA0 write, or on any data write with
+ *        DCU_CMP_TRIG_DATA0_DATA1_DATA2. Values are unsigned and masked to
+ *        the data width, as a narrow DMA write leaves the upper bytes.
+ *******************************************************************************
+ */
+#include <string.h>
+#include "fake_dcu.h"
+#include "fake_dma.h"
+
+#define DCU_UNIT_NUM                    (8U)
+
+typedef struct {
+    void (*pfnIrq)(void);
+    uint32_t u32Latency;
+    uint32_t u32IrqCountdown;
+    uint8_t u8IrqPending;
+    uint32_t u32OpNum;
+} stc_fake_dcu_t;
+
+static stc_fake_dcu_t m_astcDcu[DCU_UNIT_NUM];
+
+static uint32_t FAKE_DCU_Index(const CM_DCU_TypeDef *DCUx)
+{
+    return (uint32_t)(DCUx - CM_DCU1) % DCU_UNIT_NUM;
+}
+
+static uint32_t FAKE_DCU_Mask(const CM_DCU_TypeDef *DCUx)
+{
+    uint32_t u32Mask = 0xFFFFFFFFUL;
+
+    if (DCU_DATA_WIDTH_8BIT == (DCUx->CTL & DCU_CTL_DATASIZE)) {
+        u32Mask = 0xFFUL;
+    } else if (DCU_DATA_WIDTH_16BIT == (DCUx->CTL & DCU_CTL_DATASIZE)) {
+        u32Mask = 0xFFFFUL;
+    } else {
+        /* 32 bit */
+    }
+    return u32Mask;
+}
+
+/* Flags raising the interrupt under the INTEVTSEL selection */
+static uint32_t FAKE_DCU_IntCond(const CM_DCU_TypeDef *DCUx, uint32_t u32Flag)
+{
+    const uint32_t u32Sel = DCUx->INTEVTSEL;
+    const uint32_t u32Outside = DCU_FLAG_FLAG_LS2 | DCU_FLAG_FLAG_GT1;
+    uint32_t u32Cond;
+
+    u32Cond = u32Flag & u32Sel & (DCU_FLAG_FLAG_OP | DCU_FLAG_FLAG_LS2 | DCU_FLAG_FLAG_EQ2 | DCU_FLAG_FLAG_GT2 |
+                                  DCU_FLAG_FLAG_LS1 | DCU_FLAG_FLAG_EQ1 | DCU_FLAG_FLAG_GT1);
+    if ((0UL != (u32Sel & DCU_INTEVTSEL_SEL_WIN_1)) && (0UL != (u32Flag & u32Outside))) {
+        u32Cond |= DCU_INTEVTSEL_SEL_WIN_1;
+    }
+    if ((0UL != (u32Sel & DCU_INTEVTSEL_SEL_WIN_0)) && (0UL == (u32Flag & u32Outside))) {
+        u32Cond |= DCU_INTEVTSEL_SEL_WIN_0;
+    }
+    return u32Cond;
+}
+
+static void FAKE_DCU_Op(CM_DCU_TypeDef *DCUx, uint32_t u32DataIdx)
+{
+    stc_fake_dcu_t *pstcDcu = &m_astcDcu[FAKE_DCU_Index(DCUx)];
+    const uint32_t u32Mode = DCUx->CTL & DCU_CTL_MODE;
+    const uint32_t u32Mask = FAKE_DCU_Mask(DCUx);
+    const uint32_t u32D0 = DCUx->DATA0 & u32Mask;
+    const uint32_t u32D1 = DCUx->DATA1 & u32Mask;
+    const uint32_t u32D2 = DCUx->DATA2 & u32Mask;
+    uint32_t u32Flag = 0UL;
+    uint8_t u8Op = 0U;
+
+    if ((DCU_MD_ADD == u32Mode) && (DCU_DATA1_IDX == u32DataIdx)) {
+        if (u32D1 > (u32Mask - u32D0)) {
+            u32Flag = DCU_FLAG_FLAG_OP;
+        }
+        DCUx->DATA0 = (u32D0 + u32D1) & u32Mask;
+        u8Op = 1U;
+    } else if ((DCU_MD_SUB == u32Mode) && (DCU_DATA1_IDX == u32DataIdx)) {
+        if (u32D1 > u32D0) {
+            u32Flag = DCU_FLAG_FLAG_OP;
+        }
+        DCUx->DATA0 = (u32D0 - u32D1) & u32Mask;
+        u8Op = 1U;
+    } else if ((DCU_MD_CMP == u32Mode) &&
+               ((DCU_DATA0_IDX == u32DataIdx) || (0UL != (DCUx->CTL & DCU_CTL_COMPTRG)))) {
+        u32Flag |= (u32D0 < u32D2) ? DCU_FLAG_FLAG_LS2 : ((u32D0 == u32D2) ? DCU_FLAG_FLAG_EQ2 : DCU_FLAG_FLAG_GT2);
+        u32Flag |= (u32D0 < u32D1) ? DCU_FLAG_FLAG_LS1 : ((u32D0 == u32D1) ? DCU_FLAG_FLAG_EQ1 : DCU_FLAG_FLAG_GT1);
+        u8Op = 1U;
+    } else {
+        /* No operation */
+    }
+
+    if (0U != u8Op) {
+        pstcDcu->u32OpNum++;
+        DCUx->FLAG |= u32Flag;
+        if ((0UL != (DCUx->CTL & DCU_CTL_INTEN)) && (0UL != FAKE_DCU_IntCond(DCUx, u32Flag)) &&
+            (0U == pstcDcu->u8IrqPending)) {
+            pstcDcu->u8IrqPending = 1U;
+            pstcDcu->u32IrqCountdown = pstcDcu->u32Latency;
+        }
+    }
+}
+
+static void FAKE_DCU_IrqTick(CM_DCU_TypeDef *DCUx)
+{
+    stc_fake_dcu_t *pstcDcu = &m_astcDcu[FAKE_DCU_Index(DCUx)];
+
+    if ((0U != pstcDcu->u8IrqPending) && (0UL == g_u32HostPrimask)) {
+        if (0UL == pstcDcu->u32IrqCountdown) {
+            pstcDcu->u8IrqPending = 0U;
+            if (NULL != pstcDcu->pfnIrq) {
+                pstcDcu->pfnIrq();
+            }
+        } else {
+            pstcDcu->u32IrqCountdown--;
+        }
+    }
+}
+
+static void FAKE_DCU_DmaWrite(uint32_t u32Dest)
+{
+    CM_DCU_TypeDef *DCUx;
+    uint32_t u32Unit;
+
+    for (u32Unit = 0UL; u32Unit < DCU_UNIT_NUM; u32Unit++) {
+        DCUx = &HOST_DCU[u32Unit];
+        if ((u32Dest >= (uint32_t)&DCUx->DATA0) && (u32Dest <= (uint32_t)&DCUx->DATA2)) {
+            FAKE_DCU_Op(DCUx, (u32Dest - (uint32_t)&DCUx->DATA0) / 4UL);
+        }
+        /* Each write is one bus cycle of latency for a pending interrupt */
+        FAKE_DCU_IrqTick(DCUx);
+    }
+}
+
+void FAKE_DCU_Reset(void)
+{
+    (void)memset(m_astcDcu, 0, sizeof(m_astcDcu));
+    (void)memset(HOST_DCU, 0, sizeof(HOST_DCU));
+    FAKE_DMA_SetWriteHook(&FAKE_DCU_DmaWrite);
+}
+
+void FAKE_DCU_SetIrq(const CM_DCU_TypeDef *DCUx, void (*pfnIrq)(void), uint32_t u32Latency)
+{
+    m_astcDcu[FAKE_DCU_Index(DCUx)].pfnIrq = pfnIrq;
+    m_astcDcu[FAKE_DCU_Index(DCUx)].u32Latency = u32Latency;
+}
+
+uint32_t FAKE_DCU_GetOpCount(const CM_DCU_TypeDef *DCUx)
+{
+    return m_astcDcu[FAKE_DCU_Index(DCUx)].u32OpNum;
+}
+
+/*******************************************************************************
+ * DCU driver API
+ ******************************************************************************/
+int32_t DCU_StructInit(stc_dcu_init_t *pstcDcuInit)
+{
+    pstcDcuInit->u32Mode      = DCU_MD_INVD;
+    pstcDcuInit->u32DataWidth = DCU_DATA_WIDTH_8BIT;
+    return LL_OK;
+}
+
+int32_t DCU_Init(CM_DCU_TypeDef *DCUx, const stc_dcu_init_t *pstcDcuInit)
+{
+    DCUx->CTL = pstcDcuInit->u32Mode | pstcDcuInit->u32DataWidth;
+    DCUx->INTEVTSEL = 0UL;
+    return LL_OK;
+}
+
+void DCU_SetCompareCond(CM_DCU_TypeDef *DCUx, uint32_t u32Cond)
+{
+    DCUx->CTL = (DCUx->CTL & ~DCU_CTL_COMPTRG) | u32Cond;
+}
+
+en_flag_status_t DCU_GetStatus(const CM_DCU_TypeDef *DCUx, uint32_t u32Flag)
+{
+    return (0UL != (DCUx->FLAG & u32Flag)) ? SET : RESET;
+}
+
+void DCU_ClearStatus(CM_DCU_TypeDef *DCUx, uint32_t u32Flag)
+{
+    DCUx->FLAG &= ~u32Flag;
+}
+
+void DCU_GlobalIntCmd(CM_DCU_TypeDef *DCUx, en_functional_state_t enNewState)
+{
+    if (ENABLE == enNewState) {
+        DCUx->CTL |= DCU_CTL_INTEN;
+    } else {
+        DCUx->CTL &= ~DCU_CTL_INTEN;
+    }
+}
+
+void DCU_IntCmd(CM_DCU_TypeDef *DCUx, uint32_t u32IntCategory, uint32_t u32IntType, en_functional_state_t enNewState)
+{
+    if (ENABLE == enNewState) {
+        DCUx->INTEVTSEL |= u32IntType;
+    } else {
+        DCUx->INTEVTSEL &= ~u32IntType;
+    }
+}
+
+uint32_t DCU_ReadData32(const CM_DCU_TypeDef *DCUx, uint32_t u32DataIndex)
+{
+    return (&DCUx->DATA0)[u32DataIndex];
+}
+
+void DCU_WriteData32(CM_DCU_TypeDef *DCUx, uint32_t u32DataIndex, uint32_t u32Data)
+{
+    (&DCUx->DATA0)[u32DataIndex] = u32Data;
+    FAKE_DCU_Op(DCUx, u32DataIndex);
+}
@@ -0,0 +1,21 @@
+/**
+ *******************************************************************************
+ * @file  fake_dcu.h
+ * @brief Behavioral model of the DCU driver for the host tests.
+ *******************************************************************************
+ */
+#ifndef __FAKE_DCU_H__
+#define __FAKE_DCU_H__
+
+#include "hc32_ll_dcu.h"
+
+/* Call after FAKE_DMA_Reset(), the model watches the DMA writes to the data
+   registers */
+void FAKE_DCU_Reset(void);
+/* Called for an enabled interrupt condition, u32Latency data writes later, so
+   that the DMA may run past the element which raised it */
+void FAKE_DCU_SetIrq(const CM_DCU_TypeDef *DCUx, void (*pfnIrq)(void), uint32_t u32Latency);
+/* Data writes which ran the add, sub or compare operation */
+uint32_t FAKE_DCU_GetOpCount(const CM_DCU_TypeDef *DCUx);
+
+#endif /* __FAKE_DCU_H__ */
@@ -0,0 +1,408 @@
+/**
+ *******************************************************************************
+ * @file  fake_dma.c
+ * @brief Behavioral model of the DMA and AOS drivers for the host tests.
+ *        A request moves one block of the channel, addresses are memory of the
+ *        test image. The transfer count reaching 0 sets the TC flag and either
+ *        loads the next linked descriptor or disables the channel, a transfer
+ *        count of 0 never completes. Only the source repeat and the source
+ *        non-sequence mode are modelled: after u32SrcCount data the source
+ *        moves by u32SrcOffset data instead of by one. Writes into the range
+ *        of a device model go to it instead of memory.
+ *******************************************************************************
+ */
+#include <string.h>
+#include "fake_dma.h"
+
+#define DMA_CH_NUM                      (8U)
+
+typedef struct {
+    uint32_t u32Src;
+    uint32_t u32Dest;
+    uint32_t u32Count;
+    uint32_t u32BlockSize;
+    uint32_t u32Width;
+    uint32_t u32SrcInc;
+    uint32_t u32DestInc;
+    uint32_t u32SrcRpt;
+    uint32_t u32SrcRptBase;
+    uint32_t u32SrcRptLeft;
+    uint32_t u32DestRpt;
+    uint32_t u32DestRptBase;
+    uint32_t u32DestRptLeft;
+    uint32_t u32SrcNs;
+    uint32_t u32SrcNsOffset;
+    uint32_t u32SrcNsLeft;
+    uint32_t u32Llp;
+    en_functional_state_t enLlp;
+    en_functional_state_t enIe;
+    en_functional_state_t enCh;
+    en_functional_state_t enTcInt;
+    en_flag_status_t enTc;
+    uint32_t u32BlockCount;
+    void (*pfnIrq)(void);
+} stc_fake_dma_ch_t;
+
+static stc_fake_dma_ch_t m_astcCh[2][DMA_CH_NUM];
+static uint32_t m_u32SwTrigger;
+static void (*m_pfnWriteHook)(uint32_t u32Dest);
+static uint32_t m_u32DevBase;
+static uint32_t m_u32DevSize;
+static void (*m_pfnDevWrite)(uint32_t u32Addr, uint32_t u32Data);
+
+static stc_fake_dma_ch_t *FAKE_DMA_Ch(const CM_DMA_TypeDef *DMAx, uint8_t u8Ch)
+{
+    return &m_astcCh[(CM_DMA1 == DMAx) ? 0 : 1][u8Ch % DMA_CH_NUM];
+}
+
+static uint32_t FAKE_DMA_Step(uint32_t u32Inc, uint32_t u32Size, en_flag_status_t enSrc)
+{
+    uint32_t u32Step = 0UL;
+
+    if (SET == enSrc) {
+        u32Step = (DMA_SRC_ADDR_INC == u32Inc) ? u32Size : ((DMA_SRC_ADDR_DEC == u32Inc) ? (0UL - u32Size) : 0UL);
+    } else {
+        u32Step = (DMA_DEST_ADDR_INC == u32Inc) ? u32Size : ((DMA_DEST_ADDR_DEC == u32Inc) ? (0UL - u32Size) : 0UL);
+    }
+    return u32Step;
+}
+
+static void FAKE_DMA_LoadDescriptor(stc_fake_dma_ch_t *pstcCh)
+{
+    const stc_dma_llp_descriptor_t *pstcDesc = (const stc_dma_llp_descriptor_t *)(uintptr_t)pstcCh->u32Llp;
+
+    pstcCh->u32Src       = pstcDesc->SARx;
+    pstcCh->u32Dest      = pstcDesc->DARx;
+    pstcCh->u32BlockSize = pstcDesc->DTCTLx & 0x3FFUL;
+    pstcCh->u32Count     = pstcDesc->DTCTLx >> 16U;
+    pstcCh->u32Llp       = pstcDesc->LLPx;
+    pstcCh->u32Width     = pstcDesc->CHCTLx & (DMA_CHCTL_HSIZE_0 | DMA_CHCTL_HSIZE_1);
+    pstcCh->u32SrcInc    = pstcDesc->CHCTLx & (DMA_CHCTL_SINC_0 | DMA_CHCTL_SINC_1);
+    pstcCh->u32DestInc   = pstcDesc->CHCTLx & (DMA_CHCTL_DINC_0 | DMA_CHCTL_DINC_1);
+    pstcCh->enLlp        = (0UL != (pstcDesc->CHCTLx & DMA_CHCTL_LLPEN)) ? ENABLE : DISABLE;
+    pstcCh->enIe         = (0UL != (pstcDesc->CHCTLx & DMA_CHCTL_IE)) ? ENABLE : DISABLE;
+    pstcCh->u32SrcRpt    = (0UL != (pstcDesc->CHCTLx & DMA_CHCTL_SRPTEN)) ? (pstcDesc->RPTx & 0x3FFUL) : 0UL;
+    pstcCh->u32SrcRptBase = pstcCh->u32Src;
+    pstcCh->u32SrcRptLeft = pstcCh->u32SrcRpt;
+    pstcCh->u32DestRpt    = (0UL != (pstcDesc->CHCTLx & DMA_CHCTL_DRPTEN)) ? ((pstcDesc->RPTx >> 16U) & 0x3FFUL) : 0UL;
+    pstcCh->u32DestRptBase = pstcCh->u32Dest;
+    pstcCh->u32DestRptLeft = pstcCh->u32DestRpt;
+    pstcCh->u32SrcNs      = 0UL;
+}
+
+void FAKE_DMA_Reset(void)
+{
+    (void)memset(m_astcCh, 0, sizeof(m_astcCh));
+    (void)memset(&HOST_AOS, 0, sizeof(HOST_AOS));
+    m_u32SwTrigger = 0UL;
+    m_pfnWriteHook = NULL;
+    m_pfnDevWrite = NULL;
+}
+
+void FAKE_DMA_SetWriteHook(void (*pfnHook)(uint32_t u32Dest))
+{
+    m_pfnWriteHook = pfnHook;
+}
+
+void FAKE_DMA_SetDevice(uint32_t u32Base, uint32_t u32Size, void (*pfnWrite)(uint32_t u32Addr, uint32_t u32Data))
+{
+    m_u32DevBase  = u32Base;
+    m_u32DevSize  = u32Size;
+    m_pfnDevWrite = pfnWrite;
+}
+
+void FAKE_DMA_SetIrq(const CM_DMA_TypeDef *DMAx, uint8_t u8Ch, void (*pfnIrq)(void))
+{
+    FAKE_DMA_Ch(DMAx, u8Ch)->pfnIrq = pfnIrq;
+}
+
+uint32_t FAKE_DMA_GetBlockCount(const CM_DMA_TypeDef *DMAx, uint8_t u8Ch)
+{
+    return FAKE_DMA_Ch(DMAx, u8Ch)->u32BlockCount;
+}
+
+en_functional_state_t FAKE_DMA_GetChState(const CM_DMA_TypeDef *DMAx, uint8_t u8Ch)
+{
+    return FAKE_DMA_Ch(DMAx, u8Ch)->enCh;
+}
+
+void FAKE_DMA_Request(CM_DMA_TypeDef *DMAx, uint8_t u8Ch)
+{
+    stc_fake_dma_ch_t *pstcCh = FAKE_DMA_Ch(DMAx, u8Ch);
+    const uint32_t u32Size = (DMA_DATAWIDTH_32BIT == pstcCh->u32Width) ? 4UL :
+                             ((DMA_DATAWIDTH_16BIT == pstcCh->u32Width) ? 2UL : 1UL);
+    const uint32_t u32Num = (0UL == pstcCh->u32BlockSize) ? 1024UL : pstcCh->u32BlockSize;
+    uint32_t u32Dest;
+    uint32_t u32SrcStep;
+    uint32_t u32Data;
+    uint8_t u8Ie;
+    uint32_t i;
+
+    if (ENABLE == pstcCh->enCh) {
+        for (i = 0UL; i < u32Num; i++) {
+            u32Dest = pstcCh->u32Dest;
+            if ((NULL != m_pfnDevWrite) && ((u32Dest - m_u32DevBase) < m_u32DevSize)) {
+                u32Data = 0UL;
+                (void)memcpy(&u32Data, (const void *)(uintptr_t)pstcCh->u32Src, u32Size);
+                m_pfnDevWrite(u32Dest, u32Data);
+            } else {
+                (void)memcpy((void *)(uintptr_t)pstcCh->u32Dest, (const void *)(uintptr_t)pstcCh->u32Src, u32Size);
+            }
+            u32SrcStep = FAKE_DMA_Step(pstcCh->u32SrcInc, u32Size, SET);
+            if (0UL != pstcCh->u32SrcNs) {
+                pstcCh->u32SrcNsLeft--;
+                if (0UL == pstcCh->u32SrcNsLeft) {
+                    u32SrcStep *= pstcCh->u32SrcNsOffset;
+                    pstcCh->u32SrcNsLeft = pstcCh->u32SrcNs;
+                }
+            }
+            pstcCh->u32Src  += u32SrcStep;
+            pstcCh->u32Dest += FAKE_DMA_Step(pstcCh->u32DestInc, u32Size, RESET);
+            if (0UL != pstcCh->u32SrcRpt) {
+                pstcCh->u32SrcRptLeft--;
+                if (0UL == pstcCh->u32SrcRptLeft) {
+                    pstcCh->u32Src = pstcCh->u32SrcRptBase;
+                    pstcCh->u32SrcRptLeft = pstcCh->u32SrcRpt;
+                }
+            }
+            if (0UL != pstcCh->u32DestRpt) {
+                pstcCh->u32DestRptLeft--;
+                if (0UL == pstcCh->u32DestRptLeft) {
+                    pstcCh->u32Dest = pstcCh->u32DestRptBase;
+                    pstcCh->u32DestRptLeft = pstcCh->u32DestRpt;
+                }
+            }
+            /* The addresses have moved on, as seen by an interrupt the write raises */
+            if (NULL != m_pfnWriteHook) {
+                m_pfnWriteHook(u32Dest);
+            }
+        }
+        pstcCh->u32BlockCount++;
+        if (1UL == pstcCh->u32Count) {
+            pstcCh->u32Count = 0UL;
+            pstcCh->enTc = SET;
+            u8Ie = (ENABLE == pstcCh->enIe) ? 1U : 0U;
+            if ((ENABLE == pstcCh->enLlp) && (0UL != pstcCh->u32Llp)) {
+                /* The next descriptor waits for the next request */
+                FAKE_DMA_LoadDescriptor(pstcCh);
+            } else {
+                pstcCh->enCh = DISABLE;
+            }
+            if ((0U != u8Ie) && (ENABLE == pstcCh->enTcInt) && (NULL != pstcCh->pfnIrq) &&
+                (0UL == g_u32HostPrimask)) {
+                pstcCh->pfnIrq();
+            }
+        } else if (pstcCh->u32Count > 1UL) {
+            pstcCh->u32Count--;
+        } else {
+            /* Endless */
+        }
+    }
+}
+
+void FAKE_AOS_Fire(en_event_src_t enEvent)
+{
+    const volatile uint32_t *pu32Sel;
+    uint32_t i;
+
+    for (i = 0UL; i < DMA_CH_NUM; i++) {
+        pu32Sel = &HOST_AOS.DMA1_TRGSEL0 + i;
+        if (((*pu32Sel) & AOS_TRIG_SEL_MASK) == (uint32_t)enEvent) {
+            FAKE_DMA_Request(CM_DMA1, (uint8_t)i);
+        }
+        pu32Sel = &HOST_AOS.DMA2_TRGSEL0 + i;
+        if (((*pu32Sel) & AOS_TRIG_SEL_MASK) == (uint32_t)enEvent) {
+            FAKE_DMA_Request(CM_DMA2, (uint8_t)i);
+        }
+    }
+}
+
+uint32_t FAKE_AOS_GetSwTriggerCount(void)
+{
+    return m_u32SwTrigger;
+}
+
+/*******************************************************************************
+ * AOS driver API
+ ******************************************************************************/
+void AOS_SetTriggerEventSrc(uint32_t u32Target, en_event_src_t enSource)
+{
+    *(volatile uint32_t *)(uintptr_t)u32Target = (uint32_t)enSource;
+}
+
+/*******************************************************************************
+ * DMA driver API
+ ******************************************************************************/
+int32_t DMA_StructInit(stc_dma_init_t *pstcDmaInit)
+{
+    (void)memset(pstcDmaInit, 0, sizeof(*pstcDmaInit));
+    pstcDmaInit->u32BlockSize = 1UL;
+    return LL_OK;
+}
+
+int32_t DMA_Init(CM_DMA_TypeDef *DMAx, uint8_t u8Ch, const stc_dma_init_t *pstcDmaInit)
+{
+    stc_fake_dma_ch_t *pstcCh = FAKE_DMA_Ch(DMAx, u8Ch);
+
+    pstcCh->u32Src       = pstcDmaInit->u32SrcAddr;
+    pstcCh->u32Dest      = pstcDmaInit->u32DestAddr;
+    pstcCh->u32Count     = pstcDmaInit->u32TransCount;
+    pstcCh->u32BlockSize = pstcDmaInit->u32BlockSize;
+    pstcCh->u32Width     = pstcDmaInit->u32DataWidth;
+    pstcCh->u32SrcInc    = pstcDmaInit->u32SrcAddrInc;
+    pstcCh->u32DestInc   = pstcDmaInit->u32DestAddrInc;
+    pstcCh->enIe         = (DMA_INT_ENABLE == pstcDmaInit->u32IntEn) ? ENABLE : DISABLE;
+    pstcCh->enLlp        = DISABLE;
+    pstcCh->u32SrcRpt    = 0UL;
+    pstcCh->u32DestRpt   = 0UL;
+    pstcCh->u32SrcNs     = 0UL;
+    return LL_OK;
+}
+
+int32_t DMA_RepeatStructInit(stc_dma_repeat_init_t *pstcDmaRepeatInit)
+{
+    (void)memset(pstcDmaRepeatInit, 0, sizeof(*pstcDmaRepeatInit));
+    return LL_OK;
+}
+
+int32_t DMA_RepeatInit(CM_DMA_TypeDef *DMAx, uint8_t u8Ch, const stc_dma_repeat_init_t *pstcDmaRepeatInit)
+{
+    stc_fake_dma_ch_t *pstcCh = FAKE_DMA_Ch(DMAx, u8Ch);
+
+    pstcCh->u32SrcRpt     = (0UL != (pstcDmaRepeatInit->u32Mode & DMA_RPT_SRC)) ? pstcDmaRepeatInit->u32SrcCount : 0UL;
+    pstcCh->u32SrcRptBase = pstcCh->u32Src;
+    pstcCh->u32SrcRptLeft = pstcCh->u32SrcRpt;
+    pstcCh->u32DestRpt    = (0UL != (pstcDmaRepeatInit->u32Mode & DMA_RPT_DEST)) ? pstcDmaRepeatInit->u32DestCount : 0UL;
+    pstcCh->u32DestRptBase = pstcCh->u32Dest;
+    pstcCh->u32DestRptLeft = pstcCh->u32DestRpt;
+    return LL_OK;
+}
+
+int32_t DMA_NonSeqStructInit(stc_dma_nonseq_init_t *pstcDmaNonSeqInit)
+{
+    (void)memset(pstcDmaNonSeqInit, 0, sizeof(*pstcDmaNonSeqInit));
+    return LL_OK;
+}
+
+int32_t DMA_NonSeqInit(CM_DMA_TypeDef *DMAx, uint8_t u8Ch, const stc_dma_nonseq_init_t *pstcDmaNonSeqInit)
+{
+    stc_fake_dma_ch_t *pstcCh = FAKE_DMA_Ch(DMAx, u8Ch);
+
+    pstcCh->u32SrcNs       = (0UL != (pstcDmaNonSeqInit->u32Mode & DMA_NON_SEQ_SRC)) ?
+                             pstcDmaNonSeqInit->u32SrcCount : 0UL;
+    pstcCh->u32SrcNsOffset = pstcDmaNonSeqInit->u32SrcOffset;
+    pstcCh->u32SrcNsLeft   = pstcCh->u32SrcNs;
+    return LL_OK;
+}
+
+int32_t DMA_LlpStructInit(stc_dma_llp_init_t *pstcDmaLlpInit)
+{
+    (void)memset(pstcDmaLlpInit, 0, sizeof(*pstcDmaLlpInit));
+    return LL_OK;
+}
+
+int32_t DMA_LlpInit(CM_DMA_TypeDef *DMAx, uint8_t u8Ch, const stc_dma_llp_init_t *pstcDmaLlpInit)
+{
+    stc_fake_dma_ch_t *pstcCh = FAKE_DMA_Ch(DMAx, u8Ch);
+
+    pstcCh->enLlp  = (DMA_LLP_ENABLE == pstcDmaLlpInit->u32State) ? ENABLE : DISABLE;
+    pstcCh->u32Llp = pstcDmaLlpInit->u32Addr;
+    return LL_OK;
+}
+
+void DMA_SetLlpAddr(CM_DMA_TypeDef *DMAx, uint8_t u8Ch, uint32_t u32Addr)
+{
+    FAKE_DMA_Ch(DMAx, u8Ch)->u32Llp = u32Addr;
+}
+
+int32_t DMA_ChCmd(CM_DMA_TypeDef *DMAx, uint8_t u8Ch, en_functional_state_t enNewState)
+{
+    FAKE_DMA_Ch(DMAx, u8Ch)->enCh = enNewState;
+    return LL_OK;
+}
+
+void DMA_MxChSWTrigger(CM_DMA_TypeDef *DMAx, uint8_t u8MxCh)
+{
+    uint8_t i;
+
+    m_u32SwTrigger++;
+    for (i = 0U; i < DMA_CH_NUM; i++) {
+        if (0U != (u8MxCh & (1U << i))) {
+            FAKE_DMA_Request(DMAx, i);
+        }
+    }
+}
+
+void DMA_TransCompleteIntCmd(CM_DMA_TypeDef *DMAx, uint32_t u32TransCompleteInt, en_functional_state_t enNewState)
+{
+    uint8_t i;
+
+    for (i = 0U; i < DMA_CH_NUM; i++) {
+        if (0UL != (u32TransCompleteInt & (DMA_INT_TC_CH0 << i))) {
+            FAKE_DMA_Ch(DMAx, i)->enTcInt = enNewState;
+        }
+    }
+}
+
+en_flag_status_t DMA_GetTransCompleteStatus(const CM_DMA_TypeDef *DMAx, uint32_t u32Flag)
+{
+    en_flag_status_t enStatus = RESET;
+    uint8_t i;
+
+    for (i = 0U; i < DMA_CH_NUM; i++) {
+        if ((0UL != (u32Flag & (DMA_FLAG_TC_CH0 << i))) && (SET == FAKE_DMA_Ch(DMAx, i)->enTc)) {
+            enStatus = SET;
+        }
+    }
+    return enStatus;
+}
+
+void DMA_ClearTransCompleteStatus(CM_DMA_TypeDef *DMAx, uint32_t u32Flag)
+{
+    uint8_t i;
+
+    for (i = 0U; i < DMA_CH_NUM; i++) {
+        if (0UL != (u32Flag & (DMA_FLAG_TC_CH0 << i))) {
+            FAKE_DMA_Ch(DMAx, i)->enTc = RESET;
+        }
+    }
+}
+
+int32_t DMA_SetSrcAddr(CM_DMA_TypeDef *DMAx, uint8_t u8Ch, uint32_t u32Addr)
+{
+    FAKE_DMA_Ch(DMAx, u8Ch)->u32Src = u32Addr;
+    return LL_OK;
+}
+
+int32_t DMA_SetDestAddr(CM_DMA_TypeDef *DMAx, uint8_t u8Ch, uint32_t u32Addr)
+{
+    FAKE_DMA_Ch(DMAx, u8Ch)->u32Dest = u32Addr;
+    return LL_OK;
+}
+
+int32_t DMA_SetTransCount(CM_DMA_TypeDef *DMAx, uint8_t u8Ch, uint16_t u16Count)
+{
+    FAKE_DMA_Ch(DMAx, u8Ch)->u32Count = u16Count;
+    return LL_OK;
+}
+
+int32_t DMA_SetBlockSize(CM_DMA_TypeDef *DMAx, uint8_t u8Ch, uint16_t u16Size)
+{
+    FAKE_DMA_Ch(DMAx, u8Ch)->u32BlockSize = u16Size;
+    return LL_OK;
+}
+
+uint32_t DMA_GetSrcAddr(const CM_DMA_TypeDef *DMAx, uint8_t u8Ch)
+{
+    return FAKE_DMA_Ch(DMAx, u8Ch)->u32Src;
+}
+
+uint32_t DMA_GetDestAddr(const CM_DMA_TypeDef *DMAx, uint8_t u8Ch)
+{
+    return FAKE_DMA_Ch(DMAx, u8Ch)->u32Dest;
+}
+
+uint32_t DMA_GetTransCount(const CM_DMA_TypeDef *DMAx, uint8_t u8Ch)
+{
+    return FAKE_DMA_Ch(DMAx, u8Ch)->u32Count;
+}
@@ -0,0 +1,32 @@
+/**
+ *******************************************************************************
+ * @file  fake_dma.h
+ * @brief Behavioral model of the DMA and AOS drivers for the host tests.
+ *******************************************************************************
+ */
+#ifndef __FAKE_DMA_H__
+#define __FAKE_DMA_H__
+
+#include "hc32_ll_dma.h"
+#include "hc32_ll_aos.h"
+
+void FAKE_DMA_Reset(void);
+/* Called on the transfer complete of a channel with the TC interrupt unmasked */
+void FAKE_DMA_SetIrq(const CM_DMA_TypeDef *DMAx, uint8_t u8Ch, void (*pfnIrq)(void));
+/* One request: one block of the channel, if it is enabled */
+void FAKE_DMA_Request(CM_DMA_TypeDef *DMAx, uint8_t u8Ch);
+/* Called after each data the DMA writes, with its destination address and
+   the channel addresses already advanced, so that a peripheral model sees the
+   writes to its registers */
+void FAKE_DMA_SetWriteHook(void (*pfnHook)(uint32_t u32Dest));
+/* Writes into [u32Base, u32Base + u32Size) go to a device model instead of
+   memory, with the data zero extended */
+void FAKE_DMA_SetDevice(uint32_t u32Base, uint32_t u32Size, void (*pfnWrite)(uint32_t u32Addr, uint32_t u32Data));
+uint32_t FAKE_DMA_GetBlockCount(const CM_DMA_TypeDef *DMAx, uint8_t u8Ch);
+en_functional_state_t FAKE_DMA_GetChState(const CM_DMA_TypeDef *DMAx, uint8_t u8Ch);
+
+/* Raise an event: every DMA channel whose AOS target selects it gets a request */
+void FAKE_AOS_Fire(en_event_src_t enEvent);
+uint32_t FAKE_AOS_GetSwTriggerCount(void);
+
+#endif /* __FAKE_DMA_H__ */
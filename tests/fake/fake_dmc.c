@@ -0,0 +1,43 @@
+/**
+ *******************************************************************************
+ * @file  fake_dmc.c
+ * @brief Behavioral model of the EXMC_DMC driver for the host tests.
+ *        The chip address windows are decoded from CSCRx as the device does,
+ *        EXMC_DMC_ChipConfig() only sets the address match and mask.
+ *******************************************************************************
+ */
+#include <string.h>
+#include "fake_dmc.h"
+
+static __IO uint32_t *FAKE_DMC_Cscr(uint32_t u32Chip)
+{
+    return &CM_DMC->CSCR0 + (u32Chip & 3UL);
+}
+
+void FAKE_DMC_Reset(void)
+{
+    (void)memset(&HOST_DMC, 0, sizeof(HOST_DMC));
+}
+
+/*******************************************************************************
+ * EXMC_DMC driver API
+ ******************************************************************************/
+int32_t EXMC_DMC_ChipConfig(uint32_t u32Chip, const stc_exmc_dmc_chip_config_t *pstcChipConfig)
+{
+    *FAKE_DMC_Cscr(u32Chip) = (pstcChipConfig->u32AddrMask << DMC_CSCR_ADDMSK_POS) |
+                              (pstcChipConfig->u32AddrMatch << DMC_CSCR_ADDMAT_POS);
+    return LL_OK;
+}
+
+uint32_t EXMC_DMC_GetChipStartAddr(uint32_t u32Chip)
+{
+    return (*FAKE_DMC_Cscr(u32Chip) & DMC_CSCR_ADDMAT) << 16U;
+}
+
+uint32_t EXMC_DMC_GetChipEndAddr(uint32_t u32Chip)
+{
+    const uint32_t u32Mask = (*FAKE_DMC_Cscr(u32Chip) & DMC_CSCR_ADDMSK) >> DMC_CSCR_ADDMSK_POS;
+    const uint32_t u32Match = (*FAKE_DMC_Cscr(u32Chip) & DMC_CSCR_ADDMAT) >> DMC_CSCR_ADDMAT_POS;
+
+    return (~(u32Match ^ u32Mask)) << 24U;
+}
@@ -0,0 +1,14 @@
+/**
+ *******************************************************************************
+ * @file  fake_dmc.h
+ * @brief Behavioral model of the EXMC_DMC driver for the host tests.
+ *******************************************************************************
+ */
+#ifndef __FAKE_DMC_H__
+#define __FAKE_DMC_H__
+
+#include "hc32_ll_dmc.h"
+
+void FAKE_DMC_Reset(void);
+
+#endif /* __FAKE_DMC_H__ */
@@ -0,0 +1,214 @@
+/**
+ *******************************************************************************
+ * @file  fake_dvp.c
+ * @brief Behavioral model of the DVP driver and of a sensor for the host tests.
+ *        With the capture enabled, the clocks of a line inside the crop window
+ *        are captured, one byte per clock in 8-bit mode and one half-word per
+ *        clock otherwise, and packed in words in DMR, each full word raising
+ *        the DMA request event. A line with a captured clock raises the line
+ *        end flag, the last line of the sensor frame the frame end flag. A
+ *        data error loses the rest of its line. Single frame mode stops the
+ *        capture at the frame end.
+ *******************************************************************************
+ */
+#include <string.h>
+#include "fake_dvp.h"
+#include "fake_dma.h"
+
+static void (*m_pfnIrq)(void);
+static uint32_t m_u32Word;
+static uint32_t m_u32WordBytes;
+static uint32_t m_u32LineEndCnt;
+
+static void FAKE_DVP_Raise(uint32_t u32Flag)
+{
+    CM_DVP->STR |= u32Flag;
+    if ((0UL != (CM_DVP->STR & CM_DVP->IER)) && (NULL != m_pfnIrq) && (0UL == g_u32HostPrimask)) {
+        m_pfnIrq();
+    }
+}
+
+static void FAKE_DVP_Push(uint32_t u32Data, uint32_t u32Bytes)
+{
+    m_u32Word |= u32Data << (m_u32WordBytes * 8UL);
+    m_u32WordBytes += u32Bytes;
+    if (4UL == m_u32WordBytes) {
+        CM_DVP->DMR = m_u32Word;
+        m_u32Word = 0UL;
+        m_u32WordBytes = 0UL;
+        FAKE_AOS_Fire(EVT_SRC_DVP_DMAREQ);
+    }
+}
+
+static uint32_t FAKE_DVP_InWindow(uint32_t u32Value, uint32_t u32Start, uint32_t u32Size)
+{
+    return ((u32Value >= u32Start) && (u32Value < (u32Start + u32Size))) ? 1UL : 0UL;
+}
+
+void FAKE_DVP_Reset(void)
+{
+    (void)memset(&HOST_DVP, 0, sizeof(HOST_DVP));
+    m_pfnIrq = NULL;
+    m_u32Word = 0UL;
+    m_u32WordBytes = 0UL;
+    m_u32LineEndCnt = 0UL;
+}
+
+void FAKE_DVP_SetIrq(void (*pfnIrq)(void))
+{
+    m_pfnIrq = pfnIrq;
+}
+
+uint16_t FAKE_DVP_Pixel(uint32_t u32Seed, uint32_t u32Line, uint32_t u32Clock)
+{
+    const uint32_t u32Width = CM_DVP->CTR & DVP_CTR_BITSEL;
+    uint32_t u32Pixel = (u32Seed * 2654435761UL) ^ (u32Line * 40503UL) ^ (u32Clock * 2246822519UL);
+
+    u32Pixel ^= u32Pixel >> 13U;
+    if (DVP_DATA_WIDTH_8BIT == u32Width) {
+        u32Pixel &= 0xFFUL;
+    } else if (DVP_DATA_WIDTH_10BIT == u32Width) {
+        u32Pixel &= 0x3FFUL;
+    } else if (DVP_DATA_WIDTH_12BIT == u32Width) {
+        u32Pixel &= 0xFFFUL;
+    } else {
+        u32Pixel &= 0x3FFFUL;
+    }
+    return (uint16_t)u32Pixel;
+}
+
+void FAKE_DVP_Frame(const stc_fake_dvp_frame_t *pstcFrame)
+{
+    const uint32_t u32Bytes = (DVP_DATA_WIDTH_8BIT == (CM_DVP->CTR & DVP_CTR_BITSEL)) ? 1UL : 2UL;
+    const uint32_t u32Crop = CM_DVP->CTR & DVP_CTR_CROPEN;
+    const uint32_t u32RowStart = CM_DVP->CPSFTR & DVP_CPSFTR_RSHIFT;
+    const uint32_t u32ColStart = (CM_DVP->CPSFTR & DVP_CPSFTR_CSHIFT) >> DVP_CPSFTR_CSHIFT_POS;
+    const uint32_t u32RowSize = CM_DVP->CPSZER & DVP_CPSZER_RSIZE;
+    const uint32_t u32ColSize = (CM_DVP->CPSZER & DVP_CPSZER_CSIZE) >> DVP_CPSZER_CSIZE_POS;
+    uint32_t u32Captured;
+    uint32_t l;
+    uint32_t c;
+
+    for (l = pstcFrame->u32StartLine; l < pstcFrame->u32Lines; l++) {
+        if ((0UL == (CM_DVP->CTR & DVP_CTR_CAPEN)) ||
+            ((0UL != u32Crop) && (0UL == FAKE_DVP_InWindow(l, u32RowStart, u32RowSize)))) {
+            continue;
+        }
+        u32Captured = 0UL;
+        for (c = 0UL; c < pstcFrame->u32Clocks; c++) {
+            if (l == pstcFrame->u32ErrLine) {
+                FAKE_DVP_Raise(pstcFrame->u32ErrFlag);
+                break;
+            }
+            if ((0UL == u32Crop) || (0UL != FAKE_DVP_InWindow(c, u32ColStart, u32ColSize))) {
+                FAKE_DVP_Push(FAKE_DVP_Pixel(pstcFrame->u32Seed, l, c), u32Bytes);
+                u32Captured++;
+            }
+        }
+        if (0UL != u32Captured) {
+            m_u32LineEndCnt++;
+            FAKE_DVP_Raise(DVP_FLAG_LINE_END);
+        }
+    }
+    if (0UL != (CM_DVP->CTR & DVP_CTR_CAPEN)) {
+        if (0UL != (CM_DVP->CTR & DVP_CTR_CAPMD)) {
+            CM_DVP->CTR &= ~DVP_CTR_CAPEN;
+        }
+        FAKE_DVP_Raise(DVP_FLAG_FRAME_END);
+    }
+}
+
+void FAKE_DVP_JpegFrame(const uint8_t *pu8Data, uint32_t u32Len)
+{
+    uint32_t i;
+
+    if (0UL != (CM_DVP->CTR & DVP_CTR_CAPEN)) {
+        for (i = 0UL; i < u32Len; i++) {
+            FAKE_DVP_Push(pu8Data[i], 1UL);
+        }
+        while (0UL != m_u32WordBytes) {
+            FAKE_DVP_Push(0UL, 1UL);
+        }
+        if (0UL != (CM_DVP->CTR & DVP_CTR_CAPMD)) {
+            CM_DVP->CTR &= ~DVP_CTR_CAPEN;
+        }
+        FAKE_DVP_Raise(DVP_FLAG_FRAME_END);
+    }
+}
+
+uint32_t FAKE_DVP_GetLineEndCount(void)
+{
+    return m_u32LineEndCnt;
+}
+
+/*******************************************************************************
+ * DVP driver API
+ ******************************************************************************/
+int32_t DVP_StructInit(stc_dvp_init_t *pstcDvpInit)
+{
+    (void)memset(pstcDvpInit, 0, sizeof(*pstcDvpInit));
+    return LL_OK;
+}
+
+int32_t DVP_Init(const stc_dvp_init_t *pstcDvpInit)
+{
+    CM_DVP->CTR = pstcDvpInit->u32SyncMode | pstcDvpInit->u32DataWidth | pstcDvpInit->u32CaptureMode |
+                  pstcDvpInit->u32CaptureFreq | pstcDvpInit->u32PIXCLKPolarity | pstcDvpInit->u32HSYNCPolarity |
+                  pstcDvpInit->u32VSYNCPolarity;
+    return LL_OK;
+}
+
+void DVP_IntCmd(uint32_t u32IntType, en_functional_state_t enNewState)
+{
+    if (ENABLE == enNewState) {
+        CM_DVP->IER |= u32IntType;
+    } else {
+        CM_DVP->IER &= ~u32IntType;
+    }
+}
+
+void DVP_CropCmd(en_functional_state_t enNewState)
+{
+    if (ENABLE == enNewState) {
+        CM_DVP->CTR |= DVP_CTR_CROPEN;
+    } else {
+        CM_DVP->CTR &= ~DVP_CTR_CROPEN;
+    }
+}
+
+void DVP_JPEGCmd(en_functional_state_t enNewState)
+{
+    if (ENABLE == enNewState) {
+        CM_DVP->CTR |= DVP_CTR_JPEGEN;
+    } else {
+        CM_DVP->CTR &= ~DVP_CTR_JPEGEN;
+    }
+}
+
+void DVP_CaptureCmd(en_functional_state_t enNewState)
+{
+    if (ENABLE == enNewState) {
+        CM_DVP->CTR |= DVP_CTR_CAPEN;
+    } else {
+        CM_DVP->CTR &= ~DVP_CTR_CAPEN;
+    }
+}
+
+en_flag_status_t DVP_GetStatus(uint32_t u32Flag)
+{
+    return (0UL != (CM_DVP->STR & u32Flag)) ? SET : RESET;
+}
+
+void DVP_ClearStatus(uint32_t u32Flag)
+{
+    CM_DVP->STR &= ~u32Flag;
+}
+
+int32_t DVP_CropWindowConfig(const stc_dvp_crop_window_config_t *pstcConfig)
+{
+    CM_DVP->CPSFTR = (uint32_t)pstcConfig->u16RowStartLine |
+                     ((uint32_t)pstcConfig->u16ColumnStartLine << DVP_CPSFTR_CSHIFT_POS);
+    CM_DVP->CPSZER = (uint32_t)pstcConfig->u16RowLineSize |
+                     ((uint32_t)pstcConfig->u16ColumnLineSize << DVP_CPSZER_CSIZE_POS);
+    return LL_OK;
+}
@@ -0,0 +1,36 @@
+/**
+ *******************************************************************************
+ * @file  fake_dvp.h
+ * @brief Behavioral model of the DVP driver and of a sensor for the host tests.
+ *******************************************************************************
+ */
+#ifndef __FAKE_DVP_H__
+#define __FAKE_DVP_H__
+
+#include "hc32_ll_dvp.h"
+
+/* Sensor frame */
+typedef struct {
+    uint32_t u32Lines;                  /* Lines per frame */
+    uint32_t u32Clocks;                 /* DVP_PIXCLK clocks per line */
+    uint32_t u32Seed;                   /* Pixel data, see FAKE_DVP_Pixel() */
+    uint32_t u32StartLine;              /* Capture joins the frame at this line */
+    uint32_t u32ErrLine;                /* Line losing data, 0xFFFFFFFF for none */
+    uint32_t u32ErrFlag;                /* DVP_FLAG_FIFO_OVF or DVP_FLAG_SYNC_ERR at u32ErrLine */
+} stc_fake_dvp_frame_t;
+
+/* Call after FAKE_DMA_Reset() */
+void FAKE_DVP_Reset(void);
+/* The DVP interrupt, called on a flag with its interrupt enabled */
+void FAKE_DVP_SetIrq(void (*pfnIrq)(void));
+/* Pixel sent at a clock of a line, masked to the data width */
+uint16_t FAKE_DVP_Pixel(uint32_t u32Seed, uint32_t u32Line, uint32_t u32Clock);
+/* Send a raw frame: the captured pixels are packed in words, each word is a
+   DMA request event, and the line end and frame end flags are raised */
+void FAKE_DVP_Frame(const stc_fake_dvp_frame_t *pstcFrame);
+/* Send a JPEG stream, the last word padded with zero */
+void FAKE_DVP_JpegFrame(const uint8_t *pu8Data, uint32_t u32Len);
+/* Line end flags raised since the reset */
+uint32_t FAKE_DVP_GetLineEndCount(void);
+
+#endif /* __FAKE_DVP_H__ */
@@ -0,0 +1,160 @@
+/**
+ *******************************************************************************
+ * @file  fake_fmac.c
+ * @brief Behavioral model of the FMAC driver for the host tests.
+ *        A write to DTR, by FMAC_FIRInput() or by the DMA, runs the FIR at
+ *        once: the delay line shifts, the products of the CTR stages are
+ *        summed, shifted with rounding toward minus infinity and split into
+ *        RTR0 and RTR1. With the interrupt enabled the result ready event is
+ *        raised through the AOS model; the DTR writes it causes are run in
+ *        turn, not nested.
+ *******************************************************************************
+ */
+#include <string.h>
+#include "fake_fmac.h"
+#include "fake_dma.h"
+
+#define FMAC_UNIT_NUM                   (4U)
+#define FMAC_LINE_LEN                   (17U)
+
+typedef struct {
+    int16_t ai16Line[FMAC_LINE_LEN];
+    uint8_t u8Pending;
+    uint32_t u32InputNum;
+} stc_fake_fmac_t;
+
+static stc_fake_fmac_t m_astcFmac[FMAC_UNIT_NUM];
+static uint8_t m_u8Running;
+
+static const en_event_src_t m_aenEvt[FMAC_UNIT_NUM] = {
+    EVT_SRC_FMAC_1, EVT_SRC_FMAC_2, EVT_SRC_FMAC_3, EVT_SRC_FMAC_4
+};
+
+static uint32_t FAKE_FMAC_Index(const CM_FMAC_TypeDef *FMACx)
+{
+    return (uint32_t)(FMACx - CM_FMAC1) % FMAC_UNIT_NUM;
+}
+
+static void FAKE_FMAC_Fir(uint32_t u32Unit)
+{
+    CM_FMAC_TypeDef *FMACx = &HOST_FMAC[u32Unit];
+    stc_fake_fmac_t *pstcFmac = &m_astcFmac[u32Unit];
+    const uint32_t u32Stage = FMACx->CTR & FMAC_CTR_STAGE_NUM;
+    const uint32_t u32Shift = (FMACx->CTR & FMAC_CTR_SHIFT) >> FMAC_CTR_SHIFT_POS;
+    const volatile uint32_t *pu32Cor = &FMACx->COR0;
+    int64_t i64Acc = 0LL;
+    uint32_t k;
+
+    for (k = FMAC_LINE_LEN - 1U; k > 0U; k--) {
+        pstcFmac->ai16Line[k] = pstcFmac->ai16Line[k - 1U];
+    }
+    pstcFmac->ai16Line[0] = (int16_t)(uint16_t)FMACx->DTR;
+    pstcFmac->u32InputNum++;
+    for (k = 0UL; k <= u32Stage; k++) {
+        i64Acc += (int64_t)(int32_t)pu32Cor[k] * pstcFmac->ai16Line[k];
+    }
+    /* Arithmetic shift, the host compilers floor */
+    i64Acc >>= u32Shift;
+    FMACx->RTR1 = (uint32_t)(uint64_t)i64Acc;
+    FMACx->RTR0 = (uint32_t)((uint64_t)i64Acc >> 32U) & 0x1FUL;
+    FMACx->STR  = FMAC_STR_READY;
+    if (0UL != (FMACx->IER & FMAC_IER_INTEN)) {
+        FAKE_AOS_Fire(m_aenEvt[u32Unit]);
+    }
+}
+
+static void FAKE_FMAC_Run(void)
+{
+    uint32_t u32Unit;
+    uint8_t u8More = 1U;
+
+    if (0U == m_u8Running) {
+        m_u8Running = 1U;
+        while (0U != u8More) {
+            u8More = 0U;
+            for (u32Unit = 0UL; u32Unit < FMAC_UNIT_NUM; u32Unit++) {
+                if (0U != m_astcFmac[u32Unit].u8Pending) {
+                    m_astcFmac[u32Unit].u8Pending = 0U;
+                    if (0UL != (HOST_FMAC[u32Unit].ENR & FMAC_ENR_FMACEN)) {
+                        FAKE_FMAC_Fir(u32Unit);
+                    }
+                    u8More = 1U;
+                }
+            }
+        }
+        m_u8Running = 0U;
+    }
+}
+
+static void FAKE_FMAC_DmaWrite(uint32_t u32Dest)
+{
+    uint32_t u32Unit;
+
+    for (u32Unit = 0UL; u32Unit < FMAC_UNIT_NUM; u32Unit++) {
+        if (u32Dest == (uint32_t)&HOST_FMAC[u32Unit].DTR) {
+            m_astcFmac[u32Unit].u8Pending = 1U;
+        }
+    }
+}
+
+void FAKE_FMAC_Reset(void)
+{
+    (void)memset(m_astcFmac, 0, sizeof(m_astcFmac));
+    (void)memset(HOST_FMAC, 0, sizeof(HOST_FMAC));
+    m_u8Running = 0U;
+    FAKE_DMA_SetWriteHook(&FAKE_FMAC_DmaWrite);
+}
+
+uint32_t FAKE_FMAC_GetInputCount(const CM_FMAC_TypeDef *FMACx)
+{
+    return m_astcFmac[FAKE_FMAC_Index(FMACx)].u32InputNum;
+}
+
+/*******************************************************************************
+ * FMAC driver API
+ ******************************************************************************/
+int32_t FMAC_DeInit(CM_FMAC_TypeDef *FMACx)
+{
+    (void)memset(FMACx, 0, sizeof(*FMACx));
+    (void)memset(m_astcFmac[FAKE_FMAC_Index(FMACx)].ai16Line, 0, sizeof(m_astcFmac[0].ai16Line));
+    return LL_OK;
+}
+
+void FMAC_Cmd(CM_FMAC_TypeDef *FMACx, en_functional_state_t enNewState)
+{
+    if (ENABLE == enNewState) {
+        FMACx->ENR |= FMAC_ENR_FMACEN;
+    } else {
+        FMACx->ENR &= ~FMAC_ENR_FMACEN;
+        /* Disabling resets the delay line */
+        (void)memset(m_astcFmac[FAKE_FMAC_Index(FMACx)].ai16Line, 0, sizeof(m_astcFmac[0].ai16Line));
+    }
+}
+
+void FMAC_IntCmd(CM_FMAC_TypeDef *FMACx, en_functional_state_t enNewState)
+{
+    if (ENABLE == enNewState) {
+        FMACx->IER |= FMAC_IER_INTEN;
+    } else {
+        FMACx->IER &= ~FMAC_IER_INTEN;
+    }
+}
+
+void FMAC_FIRInput(CM_FMAC_TypeDef *FMACx, int16_t i16Factor)
+{
+    FMACx->DTR = (uint32_t)(uint16_t)i16Factor;
+    m_astcFmac[FAKE_FMAC_Index(FMACx)].u8Pending = 1U;
+    FAKE_FMAC_Run();
+}
+
+en_flag_status_t FMAC_GetStatus(const CM_FMAC_TypeDef *FMACx)
+{
+    return (0UL != (FMACx->STR & FMAC_STR_READY)) ? SET : RESET;
+}
+
+int32_t FMAC_GetResult(const CM_FMAC_TypeDef *FMACx, stc_fmac_result_t *pstcResult)
+{
+    pstcResult->u32ResultHigh = FMACx->RTR0;
+    pstcResult->u32ResultLow  = FMACx->RTR1;
+    return LL_OK;
+}
@@ -0,0 +1,17 @@
+/**
+ *******************************************************************************
+ * @file  fake_fmac.h
+ * @brief Behavioral model of the FMAC driver for the host tests.
+ *******************************************************************************
+ */
+#ifndef __FAKE_FMAC_H__
+#define __FAKE_FMAC_H__
+
+#include "hc32_ll_fmac.h"
+
+/* Call after FAKE_DMA_Reset(), the model watches the DMA writes to DTR */
+void FAKE_FMAC_Reset(void);
+/* Inputs filtered by a unit, by the CPU or the DMA */
+uint32_t FAKE_FMAC_GetInputCount(const CM_FMAC_TypeDef *FMACx);
+
+#endif /* __FAKE_FMAC_H__ */
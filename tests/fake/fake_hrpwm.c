@@ -0,0 +1,193 @@
+/**
+ *******************************************************************************
+ * @file  fake_hrpwm.c
+ * @brief Behavioral model of the HRPWM and TMR6 drivers for the host tests.
+ *        A calibration ends after a set number of reads of its state, the
+ *        compare values of TMR6 are kept in the registers of the host unit.
+ *******************************************************************************
+ */
+#include <string.h>
+#include "fake_hrpwm.h"
+
+#define CALIB_UNIT_NUM                  (2UL)
+
+static struct {
+    en_functional_state_t enCond;
+    struct {
+        uint8_t u8NextCode;
+        uint8_t u8Code;
+        uint32_t u32Latency;
+        uint32_t u32Left;
+        uint8_t u8Running;
+        uint8_t u8End;
+        uint32_t u32Start;
+    } astcUnit[CALIB_UNIT_NUM];
+    struct {
+        uint8_t u8PosCode;
+        uint8_t u8NegCode;
+        uint32_t u32CodeWrite;
+        uint8_t u8Enable;
+        uint8_t u8PosAdjust;
+        uint8_t u8NegAdjust;
+    } astcCh[HRPWM_CH_MAX];
+} m_stcHrpwm;
+
+static uint32_t ChIdx(uint32_t u32Ch)
+{
+    return (u32Ch - HRPWM_CH_MIN) % HRPWM_CH_MAX;
+}
+
+void FAKE_HRPWM_Reset(void)
+{
+    (void)memset(&m_stcHrpwm, 0, sizeof(m_stcHrpwm));
+    (void)memset(HOST_TMR6, 0, sizeof(HOST_TMR6));
+    m_stcHrpwm.enCond = ENABLE;
+}
+
+void FAKE_HRPWM_SetCond(en_functional_state_t enCond)
+{
+    m_stcHrpwm.enCond = enCond;
+}
+
+void FAKE_HRPWM_SetCalib(uint32_t u32Unit, uint8_t u8Code, uint32_t u32Latency)
+{
+    m_stcHrpwm.astcUnit[u32Unit % CALIB_UNIT_NUM].u8NextCode = u8Code;
+    m_stcHrpwm.astcUnit[u32Unit % CALIB_UNIT_NUM].u32Latency = u32Latency;
+}
+
+uint32_t FAKE_HRPWM_GetCalibStartCount(uint32_t u32Unit)
+{
+    return m_stcHrpwm.astcUnit[u32Unit % CALIB_UNIT_NUM].u32Start;
+}
+
+uint8_t FAKE_HRPWM_IsCalibRunning(uint32_t u32Unit)
+{
+    return m_stcHrpwm.astcUnit[u32Unit % CALIB_UNIT_NUM].u8Running;
+}
+
+uint8_t FAKE_HRPWM_GetPosCode(uint32_t u32Ch)
+{
+    return m_stcHrpwm.astcCh[ChIdx(u32Ch)].u8PosCode;
+}
+
+uint8_t FAKE_HRPWM_GetNegCode(uint32_t u32Ch)
+{
+    return m_stcHrpwm.astcCh[ChIdx(u32Ch)].u8NegCode;
+}
+
+uint32_t FAKE_HRPWM_GetCodeWriteCount(uint32_t u32Ch)
+{
+    return m_stcHrpwm.astcCh[ChIdx(u32Ch)].u32CodeWrite;
+}
+
+uint8_t FAKE_HRPWM_IsChEnabled(uint32_t u32Ch)
+{
+    return m_stcHrpwm.astcCh[ChIdx(u32Ch)].u8Enable;
+}
+
+uint8_t FAKE_HRPWM_IsPosAdjustEnabled(uint32_t u32Ch)
+{
+    return m_stcHrpwm.astcCh[ChIdx(u32Ch)].u8PosAdjust;
+}
+
+uint8_t FAKE_HRPWM_IsNegAdjustEnabled(uint32_t u32Ch)
+{
+    return m_stcHrpwm.astcCh[ChIdx(u32Ch)].u8NegAdjust;
+}
+
+/*******************************************************************************
+ * HRPWM driver API
+ ******************************************************************************/
+en_functional_state_t HRPWM_CondConfirm(void)
+{
+    return m_stcHrpwm.enCond;
+}
+
+void HRPWM_CalibCmd(uint32_t u32Unit, en_functional_state_t enNewState)
+{
+    const uint32_t u32Idx = u32Unit % CALIB_UNIT_NUM;
+
+    if (ENABLE == enNewState) {
+        m_stcHrpwm.astcUnit[u32Idx].u8Running = 1U;
+        m_stcHrpwm.astcUnit[u32Idx].u8End     = 0U;
+        m_stcHrpwm.astcUnit[u32Idx].u32Left   = m_stcHrpwm.astcUnit[u32Idx].u32Latency;
+        m_stcHrpwm.astcUnit[u32Idx].u32Start++;
+    } else {
+        m_stcHrpwm.astcUnit[u32Idx].u8Running = 0U;
+    }
+}
+
+en_functional_state_t HRPWM_GetCalibState(uint32_t u32Unit)
+{
+    const uint32_t u32Idx = u32Unit % CALIB_UNIT_NUM;
+
+    if ((0U != m_stcHrpwm.astcUnit[u32Idx].u8Running) && (0U == m_stcHrpwm.astcUnit[u32Idx].u8End)) {
+        if (0UL == m_stcHrpwm.astcUnit[u32Idx].u32Left) {
+            m_stcHrpwm.astcUnit[u32Idx].u8Code = m_stcHrpwm.astcUnit[u32Idx].u8NextCode;
+            m_stcHrpwm.astcUnit[u32Idx].u8End  = 1U;
+        } else if (FAKE_HRPWM_CALIB_NEVER != m_stcHrpwm.astcUnit[u32Idx].u32Left) {
+            m_stcHrpwm.astcUnit[u32Idx].u32Left--;
+        } else {
+            /* Never ends */
+        }
+    }
+    return (0U != m_stcHrpwm.astcUnit[u32Idx].u8End) ? ENABLE : DISABLE;
+}
+
+uint8_t HRPWM_GetCalibCode(uint32_t u32Unit)
+{
+    return m_stcHrpwm.astcUnit[u32Unit % CALIB_UNIT_NUM].u8Code;
+}
+
+int32_t HRPWM_CalibProcess(uint32_t u32Unit, uint8_t *pu8Code)
+{
+    uint32_t u32Timeout = 1000UL;
+    int32_t i32Ret = LL_OK;
+
+    HRPWM_CalibCmd(u32Unit, ENABLE);
+    while (DISABLE == HRPWM_GetCalibState(u32Unit)) {
+        if (0UL == u32Timeout--) {
+            i32Ret = LL_ERR_TIMEOUT;
+            break;
+        }
+    }
+    if (LL_OK == i32Ret) {
+        *pu8Code = HRPWM_GetCalibCode(u32Unit);
+    }
+    return i32Ret;
+}
+
+void HRPWM_ChCmd(uint32_t u32Ch, en_functional_state_t enNewState)
+{
+    m_stcHrpwm.astcCh[ChIdx(u32Ch)].u8Enable = (ENABLE == enNewState) ? 1U : 0U;
+}
+
+void HRPWM_ChPositiveAdjustCmd(uint32_t u32Ch, en_functional_state_t enNewState)
+{
+    m_stcHrpwm.astcCh[ChIdx(u32Ch)].u8PosAdjust = (ENABLE == enNewState) ? 1U : 0U;
+}
+
+void HRPWM_ChNegativeAdjustCmd(uint32_t u32Ch, en_functional_state_t enNewState)
+{
+    m_stcHrpwm.astcCh[ChIdx(u32Ch)].u8NegAdjust = (ENABLE == enNewState) ? 1U : 0U;
+}
+
+void HRPWM_ChPositiveAdjustConfig(uint32_t u32Ch, uint8_t u8DelayNum)
+{
+    m_stcHrpwm.astcCh[ChIdx(u32Ch)].u8PosCode = u8DelayNum;
+    m_stcHrpwm.astcCh[ChIdx(u32Ch)].u32CodeWrite++;
+}
+
+void HRPWM_ChNegativeAdjustConfig(uint32_t u32Ch, uint8_t u8DelayNum)
+{
+    m_stcHrpwm.astcCh[ChIdx(u32Ch)].u8NegCode = u8DelayNum;
+    m_stcHrpwm.astcCh[ChIdx(u32Ch)].u32CodeWrite++;
+}
+
+/*******************************************************************************
+ * TMR6 driver API
+ ******************************************************************************/
+void TMR6_SetCompareValue(CM_TMR6_TypeDef *TMR6x, uint32_t u32Index, uint32_t u32Value)
+{
+    (&TMR6x->GCMAR)[u32Index % 6UL] = u32Value;
+}
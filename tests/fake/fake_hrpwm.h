@@ -0,0 +1,32 @@
+/**
+ *******************************************************************************
+ * @file  fake_hrpwm.h
+ * @brief Behavioral model of the HRPWM and TMR6 drivers for the host tests.
+ *******************************************************************************
+ */
+#ifndef __FAKE_HRPWM_H__
+#define __FAKE_HRPWM_H__
+
+#include "hc32_ll_hrpwm.h"
+#include "hc32_ll_tmr6.h"
+
+/* Calibration latency of a unit never reaching the end flag */
+#define FAKE_HRPWM_CALIB_NEVER          (0xFFFFFFFFUL)
+
+void FAKE_HRPWM_Reset(void);
+/* Answer of HRPWM_CondConfirm() */
+void FAKE_HRPWM_SetCond(en_functional_state_t enCond);
+/* Code measured by the next calibrations of a unit and the number of state
+   reads before the end flag is set */
+void FAKE_HRPWM_SetCalib(uint32_t u32Unit, uint8_t u8Code, uint32_t u32Latency);
+uint32_t FAKE_HRPWM_GetCalibStartCount(uint32_t u32Unit);
+uint8_t FAKE_HRPWM_IsCalibRunning(uint32_t u32Unit);
+/* Delay codes and enables of a channel, u32Ch from HRPWM_CH_MIN */
+uint8_t FAKE_HRPWM_GetPosCode(uint32_t u32Ch);
+uint8_t FAKE_HRPWM_GetNegCode(uint32_t u32Ch);
+uint32_t FAKE_HRPWM_GetCodeWriteCount(uint32_t u32Ch);
+uint8_t FAKE_HRPWM_IsChEnabled(uint32_t u32Ch);
+uint8_t FAKE_HRPWM_IsPosAdjustEnabled(uint32_t u32Ch);
+uint8_t FAKE_HRPWM_IsNegAdjustEnabled(uint32_t u32Ch);
+
+#endif /* __FAKE_HRPWM_H__ */
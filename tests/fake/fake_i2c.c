@@ -0,0 +1,352 @@
+/**
+ *******************************************************************************
+ * @file  fake_i2c.c
+ * @brief I2C bus model with register-file slaves for the host tests.
+ *        Bus operations requested through the I2C driver API complete one at
+ *        a time in FAKE_I2C_Run(), the interrupt handler is called after each
+ *        one whose flags are enabled, like the I2C interrupt of the master.
+ *******************************************************************************
+ */
+#include <string.h>
+#include "fake_i2c.h"
+
+#define PHASE_IDLE                      (0U)    /* Bus not owned */
+#define PHASE_ADDR                      (1U)    /* Start done, address byte expected */
+#define PHASE_TX                        (2U)    /* Master writes */
+#define PHASE_RX                        (3U)    /* Master reads */
+
+#define OP_NONE                         (0U)
+#define OP_START                        (1U)
+#define OP_RESTART                      (2U)
+#define OP_TX                           (3U)
+#define OP_RX                           (4U)
+#define OP_STOP                         (5U)
+
+#define SLAVE_MAX                       (8U)
+
+static struct {
+    uint32_t u32Sr;
+    uint32_t u32IntEn;
+    uint32_t u32Ack;
+    uint8_t u8Phase;
+    uint8_t u8Op;
+    uint8_t u8TxByte;
+    uint8_t u8LastAcked;
+    uint8_t u8StopReq;
+    uint8_t u8Nacked;
+    uint32_t u32DataIdx;
+    stc_fake_i2c_slave_t *pstcCur;
+    stc_fake_i2c_slave_t *apstcSlave[SLAVE_MAX];
+    uint32_t u32SlaveNum;
+    uint32_t u32ArloCount;
+    uint32_t u32ArloHold;
+    uint32_t u32WinnerOps;
+    uint32_t u32BusyReads;
+    void (*pfnIrq)(void *pvArg);
+    void *pvIrqArg;
+    char acTrace[FAKE_I2C_TRACE_LEN];
+    uint32_t u32TraceLen;
+    uint32_t u32StartCount;
+    uint32_t u32Violation;
+} m_stcBus;
+
+static void Trace(char cEvent)
+{
+    if (m_stcBus.u32TraceLen < (FAKE_I2C_TRACE_LEN - 1U)) {
+        m_stcBus.acTrace[m_stcBus.u32TraceLen++] = cEvent;
+        m_stcBus.acTrace[m_stcBus.u32TraceLen] = '\0';
+    }
+}
+
+static void Request(uint8_t u8Op)
+{
+    if (OP_NONE != m_stcBus.u8Op) {
+        /* A bus operation is already in progress */
+        m_stcBus.u32Violation++;
+    }
+    m_stcBus.u8Op = u8Op;
+}
+
+static stc_fake_i2c_slave_t *FindSlave(uint8_t u8Addr)
+{
+    stc_fake_i2c_slave_t *pstcSlave = NULL;
+    uint32_t i;
+
+    for (i = 0UL; i < m_stcBus.u32SlaveNum; i++) {
+        if (m_stcBus.apstcSlave[i]->u8Addr == u8Addr) {
+            pstcSlave = m_stcBus.apstcSlave[i];
+        }
+    }
+    return pstcSlave;
+}
+
+void FAKE_I2C_Reset(void)
+{
+    (void)memset(&m_stcBus, 0, sizeof(m_stcBus));
+}
+
+void FAKE_I2C_AddSlave(stc_fake_i2c_slave_t *pstcSlave)
+{
+    if (m_stcBus.u32SlaveNum < SLAVE_MAX) {
+        m_stcBus.apstcSlave[m_stcBus.u32SlaveNum++] = pstcSlave;
+    }
+}
+
+void FAKE_I2C_SetIrq(void (*pfnIrq)(void *pvArg), void *pvArg)
+{
+    m_stcBus.pfnIrq = pfnIrq;
+    m_stcBus.pvIrqArg = pvArg;
+}
+
+/* The next u32Count address bytes lose the arbitration, the winner keeps the bus
+   for u32HoldOps bus operations of FAKE_I2C_Run() and releases it with a stop */
+void FAKE_I2C_LoseArbitration(uint32_t u32Count, uint32_t u32HoldOps)
+{
+    m_stcBus.u32ArloCount = u32Count;
+    m_stcBus.u32ArloHold = u32HoldOps;
+}
+
+void FAKE_I2C_Timeout(void)
+{
+    m_stcBus.u32Sr |= I2C_SR_TMOUTF;
+    if ((0UL != (m_stcBus.u32Sr & m_stcBus.u32IntEn)) && (NULL != m_stcBus.pfnIrq) && (0UL == g_u32HostPrimask)) {
+        m_stcBus.pfnIrq(m_stcBus.pvIrqArg);
+    }
+}
+
+const char *FAKE_I2C_GetTrace(void)
+{
+    return m_stcBus.acTrace;
+}
+
+void FAKE_I2C_ClearTrace(void)
+{
+    m_stcBus.u32TraceLen = 0UL;
+    m_stcBus.acTrace[0] = '\0';
+    m_stcBus.u32StartCount = 0UL;
+}
+
+uint32_t FAKE_I2C_GetStartCount(void)
+{
+    return m_stcBus.u32StartCount;
+}
+
+uint32_t FAKE_I2C_GetBusyReads(void)
+{
+    return m_stcBus.u32BusyReads;
+}
+
+uint32_t FAKE_I2C_GetViolation(void)
+{
+    return m_stcBus.u32Violation;
+}
+
+static void CompleteTx(void)
+{
+    const uint8_t u8Byte = m_stcBus.u8TxByte;
+
+    if (PHASE_ADDR == m_stcBus.u8Phase) {
+        if (m_stcBus.u32ArloCount > 0UL) {
+            m_stcBus.u32ArloCount--;
+            m_stcBus.u32WinnerOps = m_stcBus.u32ArloHold;
+            m_stcBus.u8Phase = PHASE_IDLE;
+            m_stcBus.u32Sr = (m_stcBus.u32Sr & ~I2C_SR_MSL) | I2C_SR_ARLOF;
+            Trace('L');
+        } else {
+            m_stcBus.pstcCur = FindSlave(u8Byte >> 1U);
+            m_stcBus.u32DataIdx = 0UL;
+            m_stcBus.u8Nacked = 0U;
+            if (NULL == m_stcBus.pstcCur) {
+                m_stcBus.u8Phase = PHASE_TX;
+                m_stcBus.u8Nacked = 1U;
+                m_stcBus.u32Sr |= I2C_SR_NACKF;
+                Trace('N');
+            } else if (0U == (u8Byte & 1U)) {
+                m_stcBus.u8Phase = PHASE_TX;
+                m_stcBus.u32Sr |= I2C_SR_TENDF | I2C_SR_TEMPTYF;
+                Trace('A');
+            } else {
+                /* The first byte is clocked in right after the address */
+                m_stcBus.u8Phase = PHASE_RX;
+                Trace('A');
+                m_stcBus.u8Op = OP_RX;
+            }
+        }
+    } else {
+        if (0UL == m_stcBus.u32DataIdx) {
+            m_stcBus.pstcCur->u8Ptr = u8Byte;
+        } else {
+            m_stcBus.pstcCur->au8Reg[m_stcBus.pstcCur->u8Ptr++] = u8Byte;
+        }
+        Trace('W');
+        if (m_stcBus.u32DataIdx == m_stcBus.pstcCur->u16NackAfter) {
+            m_stcBus.u8Nacked = 1U;
+            m_stcBus.u32Sr |= I2C_SR_NACKF;
+        } else {
+            m_stcBus.u32Sr |= I2C_SR_TENDF | I2C_SR_TEMPTYF;
+        }
+        m_stcBus.u32DataIdx++;
+    }
+}
+
+static void Complete(void)
+{
+    const uint8_t u8Op = m_stcBus.u8Op;
+
+    m_stcBus.u8Op = OP_NONE;
+    switch (u8Op) {
+        case OP_START:
+        case OP_RESTART:
+            m_stcBus.u32Sr |= I2C_SR_STARTF | I2C_SR_BUSY | I2C_SR_MSL;
+            m_stcBus.u8Phase = PHASE_ADDR;
+            m_stcBus.u8StopReq = 0U;
+            m_stcBus.u8Nacked = 0U;
+            if (OP_START == u8Op) {
+                m_stcBus.u32StartCount++;
+                Trace('S');
+            } else {
+                Trace('R');
+            }
+            break;
+        case OP_TX:
+            CompleteTx();
+            break;
+        case OP_RX:
+            HOST_I2C[0].DRR = m_stcBus.pstcCur->au8Reg[m_stcBus.pstcCur->u8Ptr++];
+            m_stcBus.u8LastAcked = (I2C_ACK == m_stcBus.u32Ack) ? 1U : 0U;
+            m_stcBus.u32Sr |= I2C_SR_RFULLF;
+            Trace((0U != m_stcBus.u8LastAcked) ? 'r' : 'n');
+            break;
+        case OP_STOP:
+            m_stcBus.u32Sr = (m_stcBus.u32Sr & ~(I2C_SR_BUSY | I2C_SR_MSL)) | I2C_SR_STOPF;
+            m_stcBus.u8Phase = PHASE_IDLE;
+            m_stcBus.u8StopReq = 0U;
+            Trace('P');
+            break;
+        default:
+            break;
+    }
+}
+
+/* One bus operation of the master that won the arbitration, the last one is its stop */
+static void WinnerStep(void)
+{
+    if (FAKE_I2C_HOLD_FOREVER != m_stcBus.u32WinnerOps) {
+        m_stcBus.u32WinnerOps--;
+        if (0UL == m_stcBus.u32WinnerOps) {
+            m_stcBus.u32Sr |= I2C_SR_STOPF;
+            Trace('p');
+        }
+    }
+}
+
+void FAKE_I2C_Run(void)
+{
+    uint32_t u32Guard = 1000000UL;
+
+    while (((OP_NONE != m_stcBus.u8Op) ||
+            ((0UL != m_stcBus.u32WinnerOps) && (FAKE_I2C_HOLD_FOREVER != m_stcBus.u32WinnerOps))) &&
+           (u32Guard > 0UL)) {
+        if (OP_NONE != m_stcBus.u8Op) {
+            Complete();
+        } else {
+            WinnerStep();
+        }
+        if ((0UL != (m_stcBus.u32Sr & m_stcBus.u32IntEn)) && (NULL != m_stcBus.pfnIrq) &&
+            (0UL == g_u32HostPrimask)) {
+            m_stcBus.pfnIrq(m_stcBus.pvIrqArg);
+        }
+        u32Guard--;
+    }
+}
+
+/*******************************************************************************
+ * I2C driver API used by the engine
+ ******************************************************************************/
+void I2C_AckConfig(CM_I2C_TypeDef *I2Cx, uint32_t u32AckConfig)
+{
+    m_stcBus.u32Ack = u32AckConfig;
+}
+
+void I2C_IntCmd(CM_I2C_TypeDef *I2Cx, uint32_t u32IntType, en_functional_state_t enNewState)
+{
+    if (ENABLE == enNewState) {
+        m_stcBus.u32IntEn |= u32IntType;
+    } else {
+        m_stcBus.u32IntEn &= ~u32IntType;
+    }
+}
+
+en_flag_status_t I2C_GetStatus(const CM_I2C_TypeDef *I2Cx, uint32_t u32Flag)
+{
+    en_flag_status_t enStatus;
+
+    if (I2C_FLAG_BUSY == u32Flag) {
+        /* Owned by this master or still by the one that won the arbitration */
+        m_stcBus.u32BusyReads++;
+        enStatus = ((PHASE_IDLE != m_stcBus.u8Phase) || (0UL != m_stcBus.u32WinnerOps)) ? SET : RESET;
+    } else {
+        enStatus = ((m_stcBus.u32Sr & u32Flag) == u32Flag) ? SET : RESET;
+    }
+    return enStatus;
+}
+
+void I2C_ClearStatus(CM_I2C_TypeDef *I2Cx, uint32_t u32Flag)
+{
+    m_stcBus.u32Sr &= ~u32Flag;
+}
+
+void I2C_GenerateStart(CM_I2C_TypeDef *I2Cx)
+{
+    if ((PHASE_IDLE != m_stcBus.u8Phase) || (0UL != m_stcBus.u32WinnerOps)) {
+        m_stcBus.u32Violation++;
+    }
+    Request(OP_START);
+}
+
+void I2C_GenerateRestart(CM_I2C_TypeDef *I2Cx)
+{
+    if ((PHASE_TX != m_stcBus.u8Phase) || (0U != m_stcBus.u8Nacked)) {
+        m_stcBus.u32Violation++;
+    }
+    Request(OP_RESTART);
+}
+
+void I2C_GenerateStop(CM_I2C_TypeDef *I2Cx)
+{
+    if (PHASE_IDLE == m_stcBus.u8Phase) {
+        m_stcBus.u32Violation++;
+    }
+    m_stcBus.u8StopReq = 1U;
+    /* A byte in reception completes first */
+    if (OP_RX != m_stcBus.u8Op) {
+        Request(OP_STOP);
+    }
+}
+
+void I2C_WriteData(CM_I2C_TypeDef *I2Cx, uint8_t u8Data)
+{
+    if (((PHASE_ADDR != m_stcBus.u8Phase) && (PHASE_TX != m_stcBus.u8Phase)) || (0U != m_stcBus.u8Nacked)) {
+        m_stcBus.u32Violation++;
+    }
+    m_stcBus.u32Sr &= ~(I2C_SR_TENDF | I2C_SR_TEMPTYF);
+    m_stcBus.u8TxByte = u8Data;
+    Request(OP_TX);
+}
+
+uint8_t I2C_ReadData(const CM_I2C_TypeDef *I2Cx)
+{
+    if (0UL == (m_stcBus.u32Sr & I2C_SR_RFULLF)) {
+        m_stcBus.u32Violation++;
+    }
+    m_stcBus.u32Sr &= ~I2C_SR_RFULLF;
+    /* Reading the data register releases the clock for the next byte */
+    if ((PHASE_RX == m_stcBus.u8Phase) && (0U != m_stcBus.u8LastAcked) && (0U == m_stcBus.u8StopReq)) {
+        Request(OP_RX);
+    } else if ((0U != m_stcBus.u8StopReq) && (OP_NONE == m_stcBus.u8Op)) {
+        Request(OP_STOP);
+    } else {
+        /* The master has to stop */
+    }
+    return HOST_I2C[0].DRR;
+}
@@ -0,0 +1,42 @@
+/**
+ *******************************************************************************
+ * @file  fake_i2c.h
+ * @brief I2C bus model with register-file slaves for the host tests.
+ *******************************************************************************
+ */
+#ifndef __FAKE_I2C_H__
+#define __FAKE_I2C_H__
+
+#include "hc32_ll_i2c.h"
+
+#define FAKE_I2C_TRACE_LEN              (4096U)
+#define FAKE_I2C_HOLD_FOREVER           (0xFFFFFFFFUL)
+
+/* Slave with 256 auto-incremented registers, the first written byte is the register pointer */
+typedef struct {
+    uint8_t u8Addr;
+    uint8_t au8Reg[256];
+    uint8_t u8Ptr;
+    uint16_t u16NackAfter;              /* Index of the first data byte not acknowledged, 0xFFFF never */
+} stc_fake_i2c_slave_t;
+
+void FAKE_I2C_Reset(void);
+void FAKE_I2C_AddSlave(stc_fake_i2c_slave_t *pstcSlave);
+void FAKE_I2C_SetIrq(void (*pfnIrq)(void *pvArg), void *pvArg);
+void FAKE_I2C_LoseArbitration(uint32_t u32Count, uint32_t u32HoldOps);
+/* SCL held low too long, the timeout flag is raised */
+void FAKE_I2C_Timeout(void);
+void FAKE_I2C_Run(void);
+
+/* Bus trace: S start, R restart, A address acked, N not acked, W byte written,
+   r byte read with ACK, n byte read with NACK, L arbitration lost, P stop,
+   p stop of the master that won the arbitration */
+const char *FAKE_I2C_GetTrace(void);
+void FAKE_I2C_ClearTrace(void);
+uint32_t FAKE_I2C_GetStartCount(void);
+/* Reads of the BUSY flag by the master */
+uint32_t FAKE_I2C_GetBusyReads(void);
+/* Sequencing errors of the master, e.g. a START while the bus is owned */
+uint32_t FAKE_I2C_GetViolation(void);
+
+#endif /* __FAKE_I2C_H__ */
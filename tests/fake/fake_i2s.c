@@ -0,0 +1,164 @@
+/**
+ *******************************************************************************
+ * @file  fake_i2s.c
+ * @brief Behavioral model of the I2S driver for the host tests.
+ *        TXBUF and RXBUF are one word deep, they are filled and emptied by
+ *        the DMA model on the TXI and RXI events, the error interrupt is
+ *        called as soon as an enabled error flag is raised.
+ *******************************************************************************
+ */
+#include <string.h>
+#include "fake_i2s.h"
+#include "fake_dma.h"
+
+#define I2S_UNIT_NUM                    (4U)
+
+typedef struct {
+    uint8_t u8TxFull;
+    uint8_t u8RxFull;
+    uint32_t u32Hold;
+    uint32_t u32FifoReset;
+    void (*pfnErrIrq)(void);
+} stc_fake_i2s_t;
+
+static const en_event_src_t m_aenTxi[I2S_UNIT_NUM] = {
+    EVT_SRC_I2S1_TXIRQOUT, EVT_SRC_I2S2_TXIRQOUT, EVT_SRC_I2S3_TXIRQOUT, EVT_SRC_I2S4_TXIRQOUT
+};
+static const en_event_src_t m_aenRxi[I2S_UNIT_NUM] = {
+    EVT_SRC_I2S1_RXIRQOUT, EVT_SRC_I2S2_RXIRQOUT, EVT_SRC_I2S3_RXIRQOUT, EVT_SRC_I2S4_RXIRQOUT
+};
+
+static stc_fake_i2s_t m_astcI2s[I2S_UNIT_NUM];
+static CM_I2S_TypeDef *m_pstcRxRead;
+
+static uint32_t FAKE_I2S_Index(const CM_I2S_TypeDef *I2Sx)
+{
+    return (uint32_t)(I2Sx - CM_I2S1) % I2S_UNIT_NUM;
+}
+
+/* A DMA write into TXBUF fills it, a write during an RXI request has read RXBUF */
+static void FAKE_I2S_DmaWrite(uint32_t u32Dest)
+{
+    uint32_t u32Unit;
+
+    for (u32Unit = 0UL; u32Unit < I2S_UNIT_NUM; u32Unit++) {
+        if (u32Dest == (uint32_t)&HOST_I2S[u32Unit].TXBUF) {
+            m_astcI2s[u32Unit].u8TxFull = 1U;
+        }
+    }
+    if (NULL != m_pstcRxRead) {
+        m_astcI2s[FAKE_I2S_Index(m_pstcRxRead)].u8RxFull = 0U;
+    }
+}
+
+static void FAKE_I2S_Error(CM_I2S_TypeDef *I2Sx, uint32_t u32Err)
+{
+    const stc_fake_i2s_t *pstcI2s = &m_astcI2s[FAKE_I2S_Index(I2Sx)];
+
+    I2Sx->ER |= u32Err;
+    if ((0UL != (I2Sx->CTRL & I2S_CTRL_EIE)) && (NULL != pstcI2s->pfnErrIrq) && (0UL == g_u32HostPrimask)) {
+        pstcI2s->pfnErrIrq();
+    }
+}
+
+void FAKE_I2S_Reset(void)
+{
+    (void)memset(m_astcI2s, 0, sizeof(m_astcI2s));
+    (void)memset(HOST_I2S, 0, sizeof(HOST_I2S));
+    m_pstcRxRead = NULL;
+    FAKE_DMA_SetWriteHook(&FAKE_I2S_DmaWrite);
+}
+
+void FAKE_I2S_SetErrIrq(const CM_I2S_TypeDef *I2Sx, void (*pfnIrq)(void))
+{
+    m_astcI2s[FAKE_I2S_Index(I2Sx)].pfnErrIrq = pfnIrq;
+}
+
+void FAKE_I2S_HoldRequest(const CM_I2S_TypeDef *I2Sx, uint32_t u32Func, en_functional_state_t enHold)
+{
+    if (ENABLE == enHold) {
+        m_astcI2s[FAKE_I2S_Index(I2Sx)].u32Hold |= u32Func;
+    } else {
+        m_astcI2s[FAKE_I2S_Index(I2Sx)].u32Hold &= ~u32Func;
+    }
+}
+
+uint32_t FAKE_I2S_GetFifoResetCount(const CM_I2S_TypeDef *I2Sx)
+{
+    return m_astcI2s[FAKE_I2S_Index(I2Sx)].u32FifoReset;
+}
+
+uint32_t FAKE_I2S_Slot(CM_I2S_TypeDef *I2Sx, uint32_t u32RxSlot)
+{
+    const uint32_t u32Unit = FAKE_I2S_Index(I2Sx);
+    stc_fake_i2s_t *pstcI2s = &m_astcI2s[u32Unit];
+    uint32_t u32TxSlot = 0UL;
+
+    if (0UL != (I2Sx->CTRL & I2S_CTRL_TXE)) {
+        if ((0U == pstcI2s->u8TxFull) && (0UL != (I2Sx->CTRL & I2S_CTRL_TXIE)) &&
+            (0UL == (pstcI2s->u32Hold & I2S_FUNC_TX))) {
+            FAKE_AOS_Fire(m_aenTxi[u32Unit]);
+        }
+        if (0U != pstcI2s->u8TxFull) {
+            pstcI2s->u8TxFull = 0U;
+            u32TxSlot = I2Sx->TXBUF;
+        } else {
+            FAKE_I2S_Error(I2Sx, I2S_ER_TXERR);
+        }
+    }
+    if (0UL != (I2Sx->CTRL & I2S_CTRL_RXE)) {
+        if (0U != pstcI2s->u8RxFull) {
+            FAKE_I2S_Error(I2Sx, I2S_ER_RXERR);
+        } else {
+            I2Sx->RXBUF = u32RxSlot;
+            pstcI2s->u8RxFull = 1U;
+        }
+        if ((0U != pstcI2s->u8RxFull) && (0UL != (I2Sx->CTRL & I2S_CTRL_RXIE)) &&
+            (0UL == (pstcI2s->u32Hold & I2S_FUNC_RX))) {
+            m_pstcRxRead = I2Sx;
+            FAKE_AOS_Fire(m_aenRxi[u32Unit]);
+            m_pstcRxRead = NULL;
+        }
+    }
+    return u32TxSlot;
+}
+
+/*******************************************************************************
+ * I2S driver API
+ ******************************************************************************/
+void I2S_SWReset(CM_I2S_TypeDef *I2Sx, uint32_t u32Type)
+{
+    if (0UL != (u32Type & I2S_RST_TYPE_FIFO)) {
+        m_astcI2s[FAKE_I2S_Index(I2Sx)].u8TxFull = 0U;
+        m_astcI2s[FAKE_I2S_Index(I2Sx)].u8RxFull = 0U;
+        m_astcI2s[FAKE_I2S_Index(I2Sx)].u32FifoReset++;
+    }
+}
+
+void I2S_FuncCmd(CM_I2S_TypeDef *I2Sx, uint32_t u32Func, en_functional_state_t enNewState)
+{
+    if (ENABLE == enNewState) {
+        I2Sx->CTRL |= u32Func;
+    } else {
+        I2Sx->CTRL &= ~u32Func;
+    }
+}
+
+void I2S_IntCmd(CM_I2S_TypeDef *I2Sx, uint32_t u32IntType, en_functional_state_t enNewState)
+{
+    if (ENABLE == enNewState) {
+        I2Sx->CTRL |= u32IntType;
+    } else {
+        I2Sx->CTRL &= ~u32IntType;
+    }
+}
+
+en_flag_status_t I2S_GetStatus(const CM_I2S_TypeDef *I2Sx, uint32_t u32Flag)
+{
+    return ((0UL != (I2Sx->SR & (u32Flag & 0xFFFFUL))) || (0UL != (I2Sx->ER & (u32Flag >> 16U)))) ? SET : RESET;
+}
+
+void I2S_ClearStatus(CM_I2S_TypeDef *I2Sx, uint32_t u32Flag)
+{
+    I2Sx->ER &= ~(u32Flag >> 16U);
+}
@@ -0,0 +1,25 @@
+/**
+ *******************************************************************************
+ * @file  fake_i2s.h
+ * @brief Behavioral model of the I2S driver for the host tests.
+ *******************************************************************************
+ */
+#ifndef __FAKE_I2S_H__
+#define __FAKE_I2S_H__
+
+#include "hc32_ll_i2s.h"
+
+void FAKE_I2S_Reset(void);
+/* Called when an error flag is raised with the error interrupt enabled */
+void FAKE_I2S_SetErrIrq(const CM_I2S_TypeDef *I2Sx, void (*pfnIrq)(void));
+/* One slot period: with TXI enabled an empty TXBUF is requested from the DMA
+   first, then the slot is shifted out and returned, an empty TXBUF underruns.
+   u32RxSlot is received into RXBUF, a full RXBUF overruns, with RXI enabled
+   the DMA is requested to read it */
+uint32_t FAKE_I2S_Slot(CM_I2S_TypeDef *I2Sx, uint32_t u32RxSlot);
+/* Stop the DMA requests of a direction, e.g. a starved transmit DMA */
+void FAKE_I2S_HoldRequest(const CM_I2S_TypeDef *I2Sx, uint32_t u32Func, en_functional_state_t enHold);
+/* FIFO resets by I2S_SWReset() */
+uint32_t FAKE_I2S_GetFifoResetCount(const CM_I2S_TypeDef *I2Sx);
+
+#endif /* __FAKE_I2S_H__ */
@@ -0,0 +1,17 @@
+/**
+ *******************************************************************************
+ * @file  fake_mau.c
+ * @brief Behavioral model of the MAU driver for the host tests.
+ *        Only the shift configuration is modelled, the software functions of
+ *        the batch module run without the unit.
+ *******************************************************************************
+ */
+#include "fake_mau.h"
+
+/*******************************************************************************
+ * MAU driver API
+ ******************************************************************************/
+void MAU_SqrtResultLShiftConfig(CM_MAU_TypeDef *MAUx, uint8_t u8ShiftNum)
+{
+    MAUx->CSR = (MAUx->CSR & ~MAU_CSR_SHIFT) | (((uint32_t)u8ShiftNum << MAU_CSR_SHIFT_POS) & MAU_CSR_SHIFT);
+}
@@ -0,0 +1,12 @@
+/**
+ *******************************************************************************
+ * @file  fake_mau.h
+ * @brief Behavioral model of the MAU driver for the host tests.
+ *******************************************************************************
+ */
+#ifndef __FAKE_MAU_H__
+#define __FAKE_MAU_H__
+
+#include "hc32_ll_mau.h"
+
+#endif /* __FAKE_MAU_H__ */
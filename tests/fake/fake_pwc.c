@@ -0,0 +1,26 @@
+/**
+ *******************************************************************************
+ * @file  fake_pwc.c
+ * @brief Behavioral model of the PWC sleep entry for the host tests.
+ *        The sleep is counted and entered by __WFI() of the host core, where a
+ *        test models the time passing until the wake-up.
+ *******************************************************************************
+ */
+#include "fake_pwc.h"
+
+static uint32_t m_u32SleepCount;
+
+uint32_t FAKE_PWC_GetSleepCount(void)
+{
+    return m_u32SleepCount;
+}
+
+/*******************************************************************************
+ * PWC driver API
+ ******************************************************************************/
+void PWC_SLEEP_Enter(uint8_t u8SleepType)
+{
+    (void)u8SleepType;
+    m_u32SleepCount++;
+    __WFI();
+}
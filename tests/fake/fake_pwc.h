@@ -0,0 +1,14 @@
+/**
+ *******************************************************************************
+ * @file  fake_pwc.h
+ * @brief Behavioral model of the PWC sleep entry for the host tests.
+ *******************************************************************************
+ */
+#ifndef __FAKE_PWC_H__
+#define __FAKE_PWC_H__
+
+#include "hc32_ll_pwc.h"
+
+uint32_t FAKE_PWC_GetSleepCount(void);
+
+#endif /* __FAKE_PWC_H__ */
@@ -0,0 +1,243 @@
+/**
+ *******************************************************************************
+ * @file  fake_smc.c
+ * @brief Behavioral model of the EXMC_SMC driver and of an 8080 bus LCD
+ *        controller for the host tests.
+ *        The chip windows are mapped without access at the device addresses.
+ *        A CPU write to them faults, the page is opened and the writing
+ *        instruction single stepped, then the written half-word is decoded
+ *        and the page closed again. The DMA model hands its writes to
+ *        FAKE_SMC_BusWrite(), so both reach the LCD model in bus order.
+ *******************************************************************************
+ */
+#define _GNU_SOURCE
+#include <signal.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ucontext.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include "fake_smc.h"
+
+#if !defined(__x86_64__) && !defined(__i386__)
+#error "The bus model single steps with the x86 trap flag"
+#endif
+
+#define SMC_CSCR1_RESET                 (0x63626160UL)
+
+#define EFLAGS_TF                       (0x100UL)
+
+#define LCD_CMD_COL_ADDR                (0x2AU)
+#define LCD_CMD_ROW_ADDR                (0x2BU)
+#define LCD_CMD_MEM_WRITE               (0x2CU)
+
+#ifndef MAP_FIXED_NOREPLACE
+#define MAP_FIXED_NOREPLACE             (0)
+#endif
+
+typedef struct {
+    uint32_t u32CmdAddr;
+    uint32_t u32DataAddr;
+    uint16_t u16Width;
+    uint16_t u16Height;
+    uint16_t *pu16Gram;
+    uint16_t u16Cmd;
+    uint16_t au16Param[4];
+    uint32_t u32ParamNum;
+    uint16_t au16Col[2];
+    uint16_t au16Row[2];
+    uint32_t u32Col;
+    uint32_t u32Row;
+    uint32_t u32Left;
+    uint32_t au32CmdCount[256];
+    uint32_t u32PixelCount;
+    uint32_t u32ErrCount;
+    stc_fake_smc_win_t astcWin[FAKE_SMC_WIN_MAX];
+    uint32_t u32WinCount;
+} stc_fake_lcd_t;
+
+static stc_fake_lcd_t m_stcLcd;
+static uint8_t *m_pu8Bus;
+static volatile uint32_t m_u32Fault;
+static long m_lPage;
+
+static void FAKE_SMC_EndCmd(void)
+{
+    uint16_t *pu16Addr;
+
+    if ((LCD_CMD_COL_ADDR == m_stcLcd.u16Cmd) || (LCD_CMD_ROW_ADDR == m_stcLcd.u16Cmd)) {
+        pu16Addr = (LCD_CMD_COL_ADDR == m_stcLcd.u16Cmd) ? m_stcLcd.au16Col : m_stcLcd.au16Row;
+        if (4UL == m_stcLcd.u32ParamNum) {
+            pu16Addr[0] = (uint16_t)((m_stcLcd.au16Param[0] << 8U) | (m_stcLcd.au16Param[1] & 0xFFU));
+            pu16Addr[1] = (uint16_t)((m_stcLcd.au16Param[2] << 8U) | (m_stcLcd.au16Param[3] & 0xFFU));
+            if ((pu16Addr[0] > pu16Addr[1]) ||
+                (pu16Addr[1] >= ((LCD_CMD_COL_ADDR == m_stcLcd.u16Cmd) ? m_stcLcd.u16Width : m_stcLcd.u16Height))) {
+                m_stcLcd.u32ErrCount++;
+            }
+        } else {
+            m_stcLcd.u32ErrCount++;
+        }
+    } else if (LCD_CMD_MEM_WRITE == m_stcLcd.u16Cmd) {
+        /* A memory write cut short is a sequencing fault of the driver */
+        if (0UL != m_stcLcd.u32Left) {
+            m_stcLcd.u32ErrCount++;
+        }
+    } else {
+        /* Other commands are not modelled */
+    }
+}
+
+void FAKE_SMC_BusWrite(uint32_t u32Addr, uint32_t u32Data)
+{
+    const uint16_t u16Data = (uint16_t)u32Data;
+    stc_fake_smc_win_t *pstcWin;
+
+    if (u32Addr == m_stcLcd.u32CmdAddr) {
+        FAKE_SMC_EndCmd();
+        m_stcLcd.u16Cmd = u16Data;
+        m_stcLcd.u32ParamNum = 0UL;
+        m_stcLcd.au32CmdCount[u16Data & 0xFFU]++;
+        if (LCD_CMD_MEM_WRITE == u16Data) {
+            m_stcLcd.u32Col  = m_stcLcd.au16Col[0];
+            m_stcLcd.u32Row  = m_stcLcd.au16Row[0];
+            m_stcLcd.u32Left = ((uint32_t)m_stcLcd.au16Col[1] - m_stcLcd.au16Col[0] + 1UL) *
+                               ((uint32_t)m_stcLcd.au16Row[1] - m_stcLcd.au16Row[0] + 1UL);
+            if (m_stcLcd.u32WinCount < FAKE_SMC_WIN_MAX) {
+                pstcWin = &m_stcLcd.astcWin[m_stcLcd.u32WinCount];
+                pstcWin->u16X      = m_stcLcd.au16Col[0];
+                pstcWin->u16Y      = m_stcLcd.au16Row[0];
+                pstcWin->u16Width  = (uint16_t)(m_stcLcd.au16Col[1] - m_stcLcd.au16Col[0] + 1U);
+                pstcWin->u16Height = (uint16_t)(m_stcLcd.au16Row[1] - m_stcLcd.au16Row[0] + 1U);
+            }
+            m_stcLcd.u32WinCount++;
+        }
+    } else if (u32Addr == m_stcLcd.u32DataAddr) {
+        if (LCD_CMD_MEM_WRITE == m_stcLcd.u16Cmd) {
+            if ((0UL != m_stcLcd.u32Left) && (NULL != m_stcLcd.pu16Gram)) {
+                m_stcLcd.pu16Gram[(m_stcLcd.u32Row * m_stcLcd.u16Width) + m_stcLcd.u32Col] = u16Data;
+                m_stcLcd.u32PixelCount++;
+                m_stcLcd.u32Left--;
+                m_stcLcd.u32Col++;
+                if (m_stcLcd.u32Col > m_stcLcd.au16Col[1]) {
+                    m_stcLcd.u32Col = m_stcLcd.au16Col[0];
+                    m_stcLcd.u32Row++;
+                }
+            } else {
+                m_stcLcd.u32ErrCount++;
+            }
+        } else if (m_stcLcd.u32ParamNum < 4UL) {
+            m_stcLcd.au16Param[m_stcLcd.u32ParamNum] = u16Data;
+            m_stcLcd.u32ParamNum++;
+        } else {
+            m_stcLcd.u32ErrCount++;
+        }
+    } else {
+        m_stcLcd.u32ErrCount++;
+    }
+}
+
+static void *FAKE_SMC_Page(uint32_t u32Addr)
+{
+    return (void *)(uintptr_t)(u32Addr & ~((uint32_t)m_lPage - 1UL));
+}
+
+static void FAKE_SMC_Segv(int iSig, siginfo_t *pstcInfo, void *pvCtx)
+{
+    const uintptr_t uAddr = (uintptr_t)pstcInfo->si_addr;
+    ucontext_t *pstcCtx = (ucontext_t *)pvCtx;
+
+    if ((uAddr >= (uintptr_t)m_pu8Bus) && (uAddr < ((uintptr_t)m_pu8Bus + FAKE_SMC_BUS_SIZE))) {
+        m_u32Fault = (uint32_t)uAddr;
+        (void)mprotect(FAKE_SMC_Page(m_u32Fault), (size_t)m_lPage, PROT_READ | PROT_WRITE);
+        pstcCtx->uc_mcontext.gregs[REG_EFL] |= EFLAGS_TF;
+    } else {
+        /* A real fault, raised again without the handler */
+        (void)signal(SIGSEGV, SIG_DFL);
+    }
+}
+
+static void FAKE_SMC_Trap(int iSig, siginfo_t *pstcInfo, void *pvCtx)
+{
+    ucontext_t *pstcCtx = (ucontext_t *)pvCtx;
+    const uint32_t u32Addr = m_u32Fault;
+
+    if (0UL != u32Addr) {
+        m_u32Fault = 0UL;
+        FAKE_SMC_BusWrite(u32Addr, *(volatile uint16_t *)(uintptr_t)u32Addr);
+        (void)mprotect(FAKE_SMC_Page(u32Addr), (size_t)m_lPage, PROT_NONE);
+        pstcCtx->uc_mcontext.gregs[REG_EFL] &= ~EFLAGS_TF;
+    }
+}
+
+void FAKE_SMC_Reset(void)
+{
+    struct sigaction stcAct;
+
+    if (NULL == m_pu8Bus) {
+        m_lPage = sysconf(_SC_PAGESIZE);
+        m_pu8Bus = mmap((void *)(uintptr_t)FAKE_SMC_BUS_BASE, FAKE_SMC_BUS_SIZE, PROT_NONE,
+                        MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE | MAP_FIXED_NOREPLACE, -1, 0);
+        if ((MAP_FAILED == m_pu8Bus) || ((uintptr_t)FAKE_SMC_BUS_BASE != (uintptr_t)m_pu8Bus)) {
+            abort();
+        }
+        (void)memset(&stcAct, 0, sizeof(stcAct));
+        stcAct.sa_flags = SA_SIGINFO;
+        stcAct.sa_sigaction = &FAKE_SMC_Segv;
+        (void)sigaction(SIGSEGV, &stcAct, NULL);
+        stcAct.sa_sigaction = &FAKE_SMC_Trap;
+        (void)sigaction(SIGTRAP, &stcAct, NULL);
+    }
+    (void)memset(&HOST_SMC, 0, sizeof(HOST_SMC));
+    HOST_SMC.CSCR1 = SMC_CSCR1_RESET;
+    free(m_stcLcd.pu16Gram);
+    (void)memset(&m_stcLcd, 0, sizeof(m_stcLcd));
+}
+
+void FAKE_SMC_Panel(uint32_t u32Chip, uint32_t u32DataOffset, uint16_t u16Width, uint16_t u16Height)
+{
+    free(m_stcLcd.pu16Gram);
+    (void)memset(&m_stcLcd, 0, sizeof(m_stcLcd));
+    m_stcLcd.u32CmdAddr  = EXMC_SMC_GetChipStartAddr(u32Chip);
+    m_stcLcd.u32DataAddr = m_stcLcd.u32CmdAddr + u32DataOffset;
+    m_stcLcd.u16Width    = u16Width;
+    m_stcLcd.u16Height   = u16Height;
+    m_stcLcd.pu16Gram    = calloc((size_t)u16Width * u16Height, sizeof(uint16_t));
+}
+
+const uint16_t *FAKE_SMC_GetGram(void)
+{
+    return m_stcLcd.pu16Gram;
+}
+
+uint32_t FAKE_SMC_GetCmdCount(uint16_t u16Cmd)
+{
+    return m_stcLcd.au32CmdCount[u16Cmd & 0xFFU];
+}
+
+uint32_t FAKE_SMC_GetPixelCount(void)
+{
+    return m_stcLcd.u32PixelCount;
+}
+
+uint32_t FAKE_SMC_GetErrCount(void)
+{
+    return m_stcLcd.u32ErrCount;
+}
+
+uint32_t FAKE_SMC_GetWinCount(void)
+{
+    return m_stcLcd.u32WinCount;
+}
+
+const stc_fake_smc_win_t *FAKE_SMC_GetWin(uint32_t u32Idx)
+{
+    return &m_stcLcd.astcWin[u32Idx % FAKE_SMC_WIN_MAX];
+}
+
+/*******************************************************************************
+ * EXMC_SMC driver API
+ ******************************************************************************/
+uint32_t EXMC_SMC_GetChipStartAddr(uint32_t u32Chip)
+{
+    return ((HOST_SMC.CSCR1 >> ((u32Chip & 3UL) * 8UL)) & 0xFFUL) << 24U;
+}
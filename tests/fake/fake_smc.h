@@ -0,0 +1,43 @@
+/**
+ *******************************************************************************
+ * @file  fake_smc.h
+ * @brief Behavioral model of the EXMC_SMC driver and of an 8080 bus LCD
+ *        controller for the host tests.
+ *******************************************************************************
+ */
+#ifndef __FAKE_SMC_H__
+#define __FAKE_SMC_H__
+
+#include "hc32_ll_smc.h"
+
+#define FAKE_SMC_BUS_BASE               (0x60000000UL)
+#define FAKE_SMC_BUS_SIZE               (4UL * 16UL * 1024UL * 1024UL)
+#define FAKE_SMC_WIN_MAX                (64U)
+
+typedef struct {
+    uint16_t u16X;
+    uint16_t u16Y;
+    uint16_t u16Width;
+    uint16_t u16Height;
+} stc_fake_smc_win_t;
+
+/* Maps the chip windows, every 16-bit CPU write to them is decoded in order by
+   the LCD model */
+void FAKE_SMC_Reset(void);
+/* A write to the chip windows, for the device hook of the DMA model */
+void FAKE_SMC_BusWrite(uint32_t u32Addr, uint32_t u32Data);
+/* LCD on a chip, RS high at u32DataOffset, MIPI DCS column, page and memory
+   write commands, the GRAM is cleared */
+void FAKE_SMC_Panel(uint32_t u32Chip, uint32_t u32DataOffset, uint16_t u16Width, uint16_t u16Height);
+const uint16_t *FAKE_SMC_GetGram(void);
+uint32_t FAKE_SMC_GetCmdCount(uint16_t u16Cmd);
+uint32_t FAKE_SMC_GetPixelCount(void);
+/* Writes breaking the protocol: a wrong number of address parameters, an
+   address out of the panel, pixels outside a memory write or beyond its
+   window, writes to neither the command nor the data address */
+uint32_t FAKE_SMC_GetErrCount(void);
+/* Windows of the memory writes in order, up to FAKE_SMC_WIN_MAX */
+uint32_t FAKE_SMC_GetWinCount(void);
+const stc_fake_smc_win_t *FAKE_SMC_GetWin(uint32_t u32Idx);
+
+#endif /* __FAKE_SMC_H__ */
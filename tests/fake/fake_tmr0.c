@@ -0,0 +1,171 @@
+/**
+ *******************************************************************************
+ * @file  fake_tmr0.c
+ * @brief Behavioral model of the TMR0 driver for the host tests.
+ *        A channel counts up to its compare value, the next count clears the
+ *        counter and sets the compare flag. A compare value below the count
+ *        is only reached after the 16-bit counter wrapped, like the hardware.
+ *******************************************************************************
+ */
+#include "fake_tmr0.h"
+
+typedef struct {
+    uint32_t u32Cnt;
+    uint32_t u32Cmp;
+    en_functional_state_t enRun;
+    en_functional_state_t enInt;
+    en_flag_status_t enFlag;
+    func_ptr_t pfnIrq;
+    uint32_t u32IrqCount;
+    uint32_t u32LostWake;
+} stc_fake_tmr0_ch_t;
+
+static stc_fake_tmr0_ch_t m_astcCh[2][2];
+
+static stc_fake_tmr0_ch_t *FAKE_TMR0_Ch(const CM_TMR0_TypeDef *TMR0x, uint32_t u32Ch)
+{
+    return &m_astcCh[(CM_TMR0_1 == TMR0x) ? 0 : 1][u32Ch & 1UL];
+}
+
+static uint32_t FAKE_TMR0_ChOfFlag(uint32_t u32Flag)
+{
+    return (0UL != (u32Flag & TMR0_FLAG_CMP_A)) ? TMR0_CH_A : TMR0_CH_B;
+}
+
+int32_t TMR0_StructInit(stc_tmr0_init_t *pstcTmr0Init)
+{
+    pstcTmr0Init->u32ClockSrc     = TMR0_CLK_SRC_INTERN_CLK;
+    pstcTmr0Init->u32ClockDiv     = TMR0_CLK_DIV1;
+    pstcTmr0Init->u32Func         = TMR0_FUNC_CMP;
+    pstcTmr0Init->u16CompareValue = 0xFFFFU;
+    return LL_OK;
+}
+
+int32_t TMR0_Init(CM_TMR0_TypeDef *TMR0x, uint32_t u32Ch, const stc_tmr0_init_t *pstcTmr0Init)
+{
+    stc_fake_tmr0_ch_t *pstcCh = FAKE_TMR0_Ch(TMR0x, u32Ch);
+
+    pstcCh->u32Cnt = 0UL;
+    pstcCh->u32Cmp = pstcTmr0Init->u16CompareValue;
+    pstcCh->enFlag = RESET;
+    return LL_OK;
+}
+
+void TMR0_Start(CM_TMR0_TypeDef *TMR0x, uint32_t u32Ch)
+{
+    FAKE_TMR0_Ch(TMR0x, u32Ch)->enRun = ENABLE;
+}
+
+void TMR0_Stop(CM_TMR0_TypeDef *TMR0x, uint32_t u32Ch)
+{
+    FAKE_TMR0_Ch(TMR0x, u32Ch)->enRun = DISABLE;
+}
+
+void TMR0_SetCountValue(CM_TMR0_TypeDef *TMR0x, uint32_t u32Ch, uint16_t u16Value)
+{
+    FAKE_TMR0_Ch(TMR0x, u32Ch)->u32Cnt = u16Value;
+}
+
+uint16_t TMR0_GetCountValue(const CM_TMR0_TypeDef *TMR0x, uint32_t u32Ch)
+{
+    return (uint16_t)FAKE_TMR0_Ch(TMR0x, u32Ch)->u32Cnt;
+}
+
+void TMR0_SetCompareValue(CM_TMR0_TypeDef *TMR0x, uint32_t u32Ch, uint16_t u16Value)
+{
+    FAKE_TMR0_Ch(TMR0x, u32Ch)->u32Cmp = u16Value;
+}
+
+uint16_t TMR0_GetCompareValue(const CM_TMR0_TypeDef *TMR0x, uint32_t u32Ch)
+{
+    return (uint16_t)FAKE_TMR0_Ch(TMR0x, u32Ch)->u32Cmp;
+}
+
+void TMR0_IntCmd(CM_TMR0_TypeDef *TMR0x, uint32_t u32IntType, en_functional_state_t enNewState)
+{
+    const uint32_t u32Ch = (0UL != (u32IntType & TMR0_INT_CMP_A)) ? TMR0_CH_A : TMR0_CH_B;
+
+    FAKE_TMR0_Ch(TMR0x, u32Ch)->enInt = enNewState;
+}
+
+en_flag_status_t TMR0_GetStatus(const CM_TMR0_TypeDef *TMR0x, uint32_t u32Flag)
+{
+    return FAKE_TMR0_Ch(TMR0x, FAKE_TMR0_ChOfFlag(u32Flag))->enFlag;
+}
+
+void TMR0_ClearStatus(CM_TMR0_TypeDef *TMR0x, uint32_t u32Flag)
+{
+    FAKE_TMR0_Ch(TMR0x, FAKE_TMR0_ChOfFlag(u32Flag))->enFlag = RESET;
+}
+
+void FAKE_TMR0_SetIrq(const CM_TMR0_TypeDef *TMR0x, uint32_t u32Ch, func_ptr_t pfnIrq)
+{
+    FAKE_TMR0_Ch(TMR0x, u32Ch)->pfnIrq = pfnIrq;
+}
+
+uint32_t FAKE_TMR0_GetIrqCount(const CM_TMR0_TypeDef *TMR0x, uint32_t u32Ch)
+{
+    return FAKE_TMR0_Ch(TMR0x, u32Ch)->u32IrqCount;
+}
+
+/* Advance the channel by u32Count clocks, the interrupt is taken as soon as the flag is set */
+void FAKE_TMR0_Run(const CM_TMR0_TypeDef *TMR0x, uint32_t u32Ch, uint32_t u32Count)
+{
+    stc_fake_tmr0_ch_t *pstcCh = FAKE_TMR0_Ch(TMR0x, u32Ch);
+    uint32_t u32Dist;
+
+    while ((0UL != u32Count) && (ENABLE == pstcCh->enRun)) {
+        u32Dist = (pstcCh->u32Cnt <= pstcCh->u32Cmp) ? (pstcCh->u32Cmp - pstcCh->u32Cnt) :
+                  (0xFFFFUL - pstcCh->u32Cnt);
+        if (u32Count <= u32Dist) {
+            pstcCh->u32Cnt += u32Count;
+            u32Count = 0UL;
+        } else {
+            u32Count -= u32Dist + 1UL;
+            if (pstcCh->u32Cnt <= pstcCh->u32Cmp) {
+                pstcCh->enFlag = SET;
+            }
+            pstcCh->u32Cnt = 0UL;
+            if ((SET == pstcCh->enFlag) && (ENABLE == pstcCh->enInt) &&
+                (0UL == g_u32HostPrimask) && (NULL != pstcCh->pfnIrq)) {
+                pstcCh->u32IrqCount++;
+                pstcCh->pfnIrq();
+            }
+        }
+    }
+}
+
+uint32_t FAKE_TMR0_GetLostWakeCount(const CM_TMR0_TypeDef *TMR0x, uint32_t u32Ch)
+{
+    return FAKE_TMR0_Ch(TMR0x, u32Ch)->u32LostWake;
+}
+
+/*
+ * Sleep until the compare match of the channel, returns the clocks slept.
+ * The pending interrupt is taken on the wake-up, as the core does once it
+ * unmasks. With the interrupt disabled the core would never wake up: the sleep
+ * is counted as a lost wake-up and ends at the compare match without interrupt.
+ */
+uint32_t FAKE_TMR0_Sleep(const CM_TMR0_TypeDef *TMR0x, uint32_t u32Ch)
+{
+    stc_fake_tmr0_ch_t *pstcCh = FAKE_TMR0_Ch(TMR0x, u32Ch);
+    uint32_t u32Count = 0UL;
+
+    if (ENABLE == pstcCh->enRun) {
+        if ((RESET == pstcCh->enFlag) || (ENABLE != pstcCh->enInt)) {
+            u32Count = ((pstcCh->u32Cnt <= pstcCh->u32Cmp) ? (pstcCh->u32Cmp - pstcCh->u32Cnt) :
+                        (0xFFFFUL - pstcCh->u32Cnt + 1UL + pstcCh->u32Cmp)) + 1UL;
+            pstcCh->u32Cnt = 0UL;
+            pstcCh->enFlag = SET;
+        }
+        if (ENABLE != pstcCh->enInt) {
+            pstcCh->u32LostWake++;
+        } else if (NULL != pstcCh->pfnIrq) {
+            pstcCh->u32IrqCount++;
+            pstcCh->pfnIrq();
+        } else {
+            /* No handler registered */
+        }
+    }
+    return u32Count;
+}
@@ -0,0 +1,18 @@
+/**
+ *******************************************************************************
+ * @file  fake_tmr0.h
+ * @brief Behavioral model of the TMR0 driver for the host tests.
+ *******************************************************************************
+ */
+#ifndef __FAKE_TMR0_H__
+#define __FAKE_TMR0_H__
+
+#include "hc32_ll_tmr0.h"
+
+void FAKE_TMR0_SetIrq(const CM_TMR0_TypeDef *TMR0x, uint32_t u32Ch, func_ptr_t pfnIrq);
+void FAKE_TMR0_Run(const CM_TMR0_TypeDef *TMR0x, uint32_t u32Ch, uint32_t u32Count);
+uint32_t FAKE_TMR0_GetIrqCount(const CM_TMR0_TypeDef *TMR0x, uint32_t u32Ch);
+uint32_t FAKE_TMR0_Sleep(const CM_TMR0_TypeDef *TMR0x, uint32_t u32Ch);
+uint32_t FAKE_TMR0_GetLostWakeCount(const CM_TMR0_TypeDef *TMR0x, uint32_t u32Ch);
+
+#endif /* __FAKE_TMR0_H__ */
@@ -0,0 +1,84 @@
+/**
+ *******************************************************************************
+ * @file  fake_tmr4.c
+ * @brief Behavioral model of the TMR4 driver for the host tests.
+ *        The values are kept in the registers of the host unit, the counter
+ *        is not modelled.
+ *******************************************************************************
+ */
+#include <string.h>
+#include "fake_tmr4.h"
+
+static uint16_t m_au16OcBufCond[3][6];
+static uint32_t m_au32MatchCondCount[3];
+
+static uint32_t FAKE_TMR4_Idx(const CM_TMR4_TypeDef *TMR4x)
+{
+    return (uint32_t)(TMR4x - HOST_TMR4) % 3UL;
+}
+
+void FAKE_TMR4_Reset(void)
+{
+    (void)memset(HOST_TMR4, 0, sizeof(HOST_TMR4));
+    (void)memset(m_au16OcBufCond, 0, sizeof(m_au16OcBufCond));
+    (void)memset(m_au32MatchCondCount, 0, sizeof(m_au32MatchCondCount));
+}
+
+uint16_t FAKE_TMR4_GetOcBufCond(const CM_TMR4_TypeDef *TMR4x, uint32_t u32Ch)
+{
+    return m_au16OcBufCond[FAKE_TMR4_Idx(TMR4x)][u32Ch % 6UL];
+}
+
+uint32_t FAKE_TMR4_GetMatchCondCount(const CM_TMR4_TypeDef *TMR4x)
+{
+    return m_au32MatchCondCount[FAKE_TMR4_Idx(TMR4x)];
+}
+
+/*******************************************************************************
+ * TMR4 driver API
+ ******************************************************************************/
+uint16_t TMR4_GetPeriodValue(const CM_TMR4_TypeDef *TMR4x)
+{
+    return TMR4x->CPSR;
+}
+
+void TMR4_OC_SetCompareValue(CM_TMR4_TypeDef *TMR4x, uint32_t u32Ch, uint16_t u16Value)
+{
+    TMR4x->OCCR[u32Ch % 6UL] = u16Value;
+}
+
+void TMR4_OC_SetCompareBufCond(CM_TMR4_TypeDef *TMR4x, uint32_t u32Ch, uint16_t u16Object, uint16_t u16BufCond)
+{
+    if (TMR4_OC_BUF_CMP_VALUE == u16Object) {
+        m_au16OcBufCond[FAKE_TMR4_Idx(TMR4x)][u32Ch % 6UL] = u16BufCond;
+    }
+}
+
+void TMR4_PWM_SetDeadTimeValue(CM_TMR4_TypeDef *TMR4x, uint32_t u32Ch, uint32_t u32DeadTimeIndex, uint16_t u16Value)
+{
+    if (TMR4_PWM_PDAR_IDX == u32DeadTimeIndex) {
+        TMR4x->PDAR[u32Ch % 3UL] = u16Value;
+    } else {
+        TMR4x->PDBR[u32Ch % 3UL] = u16Value;
+    }
+}
+
+void TMR4_EVT_SetCompareValue(CM_TMR4_TypeDef *TMR4x, uint32_t u32Ch, uint16_t u16Value)
+{
+    TMR4x->SCCR[u32Ch % 6UL] = u16Value;
+}
+
+void TMR4_EVT_SetCompareBufCond(CM_TMR4_TypeDef *TMR4x, uint32_t u32Ch, uint16_t u16BufCond)
+{
+    TMR4x->SCSR[u32Ch % 6UL] = (uint16_t)((TMR4x->SCSR[u32Ch % 6UL] & ~TMR4_SCSR_BUFEN) | u16BufCond);
+}
+
+void TMR4_EVT_MatchCondCmd(CM_TMR4_TypeDef *TMR4x, uint32_t u32Ch, uint16_t u16Cond, en_functional_state_t enNewState)
+{
+    if (ENABLE == enNewState) {
+        TMR4x->SCSR[u32Ch % 6UL] |= u16Cond;
+    } else {
+        TMR4x->SCSR[u32Ch % 6UL] &= (uint16_t)~u16Cond;
+    }
+    m_au32MatchCondCount[FAKE_TMR4_Idx(TMR4x)]++;
+}
@@ -0,0 +1,16 @@
+/**
+ *******************************************************************************
+ * @file  fake_tmr4.h
+ * @brief Behavioral model of the TMR4 driver for the host tests.
+ *******************************************************************************
+ */
+#ifndef __FAKE_TMR4_H__
+#define __FAKE_TMR4_H__
+
+#include "hc32_ll_tmr4.h"
+
+void FAKE_TMR4_Reset(void);
+uint16_t FAKE_TMR4_GetOcBufCond(const CM_TMR4_TypeDef *TMR4x, uint32_t u32Ch);
+uint32_t FAKE_TMR4_GetMatchCondCount(const CM_TMR4_TypeDef *TMR4x);
+
+#endif /* __FAKE_TMR4_H__ */
@@ -0,0 +1,187 @@
+/**
+ *******************************************************************************
+ * @file  fake_tmr6.c
+ * @brief Behavioral model of the TMR6 driver for the host tests.
+ *        The units count up in sawtooth mode from 0 to PERAR. At the
+ *        overflow each enabled buffer function transfers PERBR to PERAR,
+ *        GCMCR to GCMAR and GCMDR to GCMBR, then the overflow event of the
+ *        unit is raised on the AOS model, so that a DMA channel it triggers
+ *        writes the buffers of the next period.
+ *******************************************************************************
+ */
+#include <string.h>
+#include "fake_tmr6.h"
+#include "fake_dma.h"
+
+#define TMR6_UNIT_NUM                   (8U)
+
+#define TMR6_BCONR_OFS_CH_B             (4U)
+#define TMR6_BCONR_OFS_PERIOD           (8U)
+#define TMR6_BCONR_CFG_MASK             (TMR6_BCONR_BSEA | TMR6_BUF_TRANS_OVF_UDF)
+
+static const en_event_src_t m_aenOvf[TMR6_UNIT_NUM] = {
+    EVT_SRC_TMR6_1_OVF, EVT_SRC_TMR6_2_OVF, EVT_SRC_TMR6_3_OVF, EVT_SRC_TMR6_4_OVF,
+    EVT_SRC_TMR6_5_OVF, EVT_SRC_TMR6_6_OVF, EVT_SRC_TMR6_7_OVF, EVT_SRC_TMR6_8_OVF,
+};
+
+static uint32_t m_u32ReadTicks;
+static void (*m_pfnReadHook)(void);
+static uint32_t m_u32ReadCount;
+static uint32_t m_u32BufCallCount;
+static uint32_t m_au32OvfCount[TMR6_UNIT_NUM];
+
+static uint32_t FAKE_TMR6_Index(const CM_TMR6_TypeDef *TMR6x)
+{
+    return (uint32_t)(TMR6x - CM_TMR6_1) % TMR6_UNIT_NUM;
+}
+
+static uint32_t FAKE_TMR6_BconrOfs(uint32_t u32Ch)
+{
+    return (TMR6_CH_A == u32Ch) ? 0UL : TMR6_BCONR_OFS_CH_B;
+}
+
+void FAKE_TMR6_Reset(void)
+{
+    uint32_t i;
+
+    (void)memset(HOST_TMR6, 0, sizeof(HOST_TMR6));
+    (void)memset(&HOST_TMR6_COMMON, 0, sizeof(HOST_TMR6_COMMON));
+    for (i = 0UL; i < TMR6_UNIT_NUM; i++) {
+        HOST_TMR6[i].STFLR = TMR6_STFLR_DIRF;
+        m_au32OvfCount[i]  = 0UL;
+    }
+    m_u32ReadTicks    = 0UL;
+    m_pfnReadHook     = NULL;
+    m_u32ReadCount    = 0UL;
+    m_u32BufCallCount = 0UL;
+}
+
+void FAKE_TMR6_Run(uint32_t u32Ticks)
+{
+    CM_TMR6_TypeDef *TMR6x;
+    uint32_t n;
+    uint32_t i;
+
+    for (n = 0UL; n < u32Ticks; n++) {
+        for (i = 0UL; i < TMR6_UNIT_NUM; i++) {
+            TMR6x = &HOST_TMR6[i];
+            if (0UL == (HOST_TMR6_COMMON.SSTAR & (TMR6_SW_SYNC_U1 << i))) {
+                continue;
+            }
+            if (TMR6x->CNTER < TMR6x->PERAR) {
+                TMR6x->CNTER++;
+                continue;
+            }
+            TMR6x->CNTER = 0UL;
+            if (0UL != (TMR6x->BCONR & TMR6_BCONR_BENP)) {
+                TMR6x->PERAR = TMR6x->PERBR;
+            }
+            if (0UL != (TMR6x->BCONR & TMR6_BCONR_BENA)) {
+                TMR6x->GCMAR = TMR6x->GCMCR;
+            }
+            if (0UL != (TMR6x->BCONR & TMR6_BCONR_BENB)) {
+                TMR6x->GCMBR = TMR6x->GCMDR;
+            }
+            m_au32OvfCount[i]++;
+            FAKE_AOS_Fire(m_aenOvf[i]);
+        }
+    }
+}
+
+void FAKE_TMR6_SetRead(uint32_t u32Ticks, void (*pfnHook)(void))
+{
+    m_u32ReadTicks = u32Ticks;
+    m_pfnReadHook  = pfnHook;
+}
+
+uint32_t FAKE_TMR6_GetReadCount(void)
+{
+    return m_u32ReadCount;
+}
+
+uint32_t FAKE_TMR6_GetBufCallCount(void)
+{
+    return m_u32BufCallCount;
+}
+
+uint32_t FAKE_TMR6_GetOvfCount(const CM_TMR6_TypeDef *TMR6x)
+{
+    return m_au32OvfCount[FAKE_TMR6_Index(TMR6x)];
+}
+
+/*******************************************************************************
+ * TMR6 driver API
+ ******************************************************************************/
+uint32_t TMR6_GetCountDir(CM_TMR6_TypeDef *TMR6x)
+{
+    return TMR6x->STFLR & TMR6_STFLR_DIRF;
+}
+
+uint32_t TMR6_GetCountValue(const CM_TMR6_TypeDef *TMR6x)
+{
+    const uint32_t u32Value = TMR6x->CNTER;
+
+    m_u32ReadCount++;
+    FAKE_TMR6_Run(m_u32ReadTicks);
+    if (NULL != m_pfnReadHook) {
+        m_pfnReadHook();
+    }
+    return u32Value;
+}
+
+uint32_t TMR6_GetPeriodValue(const CM_TMR6_TypeDef *TMR6x, uint32_t u32Index)
+{
+    return (&TMR6x->PERAR)[u32Index % 3UL];
+}
+
+void TMR6_SetPeriodValue(CM_TMR6_TypeDef *TMR6x, uint32_t u32Index, uint32_t u32Value)
+{
+    (&TMR6x->PERAR)[u32Index % 3UL] = u32Value;
+}
+
+void TMR6_SetCompareValue(CM_TMR6_TypeDef *TMR6x, uint32_t u32Index, uint32_t u32Value)
+{
+    (&TMR6x->GCMAR)[u32Index % 6UL] = u32Value;
+}
+
+int32_t TMR6_GeneralBufConfig(CM_TMR6_TypeDef *TMR6x, uint32_t u32Ch, const stc_tmr6_buf_config_t *pstcBufConfig)
+{
+    const uint32_t u32Ofs = FAKE_TMR6_BconrOfs(u32Ch);
+
+    TMR6x->BCONR = (TMR6x->BCONR & ~(TMR6_BCONR_CFG_MASK << u32Ofs)) |
+                   ((pstcBufConfig->u32BufNum | pstcBufConfig->u32BufTransCond) << u32Ofs);
+    m_u32BufCallCount++;
+    return LL_OK;
+}
+
+int32_t TMR6_PeriodBufConfig(CM_TMR6_TypeDef *TMR6x, const stc_tmr6_buf_config_t *pstcBufConfig)
+{
+    TMR6x->BCONR = (TMR6x->BCONR & ~(TMR6_BCONR_CFG_MASK << TMR6_BCONR_OFS_PERIOD)) |
+                   ((pstcBufConfig->u32BufNum | pstcBufConfig->u32BufTransCond) << TMR6_BCONR_OFS_PERIOD);
+    m_u32BufCallCount++;
+    return LL_OK;
+}
+
+void TMR6_GeneralBufCmd(CM_TMR6_TypeDef *TMR6x, uint32_t u32Ch, en_functional_state_t enNewState)
+{
+    const uint32_t u32Bit = TMR6_BCONR_BENA << FAKE_TMR6_BconrOfs(u32Ch);
+
+    TMR6x->BCONR = (ENABLE == enNewState) ? (TMR6x->BCONR | u32Bit) : (TMR6x->BCONR & ~u32Bit);
+    m_u32BufCallCount++;
+}
+
+void TMR6_PeriodBufCmd(CM_TMR6_TypeDef *TMR6x, en_functional_state_t enNewState)
+{
+    TMR6x->BCONR = (ENABLE == enNewState) ? (TMR6x->BCONR | TMR6_BCONR_BENP) : (TMR6x->BCONR & ~TMR6_BCONR_BENP);
+    m_u32BufCallCount++;
+}
+
+void TMR6_SWSyncStart(uint32_t u32Unit)
+{
+    HOST_TMR6_COMMON.SSTAR |= u32Unit;
+}
+
+void TMR6_SWSyncStop(uint32_t u32Unit)
+{
+    HOST_TMR6_COMMON.SSTAR &= ~u32Unit;
+}
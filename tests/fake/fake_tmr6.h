@@ -0,0 +1,23 @@
+/**
+ *******************************************************************************
+ * @file  fake_tmr6.h
+ * @brief Behavioral model of the TMR6 driver for the host tests.
+ *******************************************************************************
+ */
+#ifndef __FAKE_TMR6_H__
+#define __FAKE_TMR6_H__
+
+#include "hc32_ll_tmr6.h"
+
+void FAKE_TMR6_Reset(void);
+/* Count u32Ticks on every started unit */
+void FAKE_TMR6_Run(uint32_t u32Ticks);
+/* Ticks counted by each read of a counter, and a hook called after them */
+void FAKE_TMR6_SetRead(uint32_t u32Ticks, void (*pfnHook)(void));
+uint32_t FAKE_TMR6_GetReadCount(void);
+/* Calls of the buffer configuration API */
+uint32_t FAKE_TMR6_GetBufCallCount(void);
+/* Overflows of a unit since the reset */
+uint32_t FAKE_TMR6_GetOvfCount(const CM_TMR6_TypeDef *TMR6x);
+
+#endif /* __FAKE_TMR6_H__ */
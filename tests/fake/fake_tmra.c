@@ -0,0 +1,217 @@
+/**
+ *******************************************************************************
+ * @file  fake_tmra.c
+ * @brief Behavioral model of the TMRA driver for the host tests.
+ *        A started unit counts the CLKA/CLKB edges selected by HCUPR/HCDOR
+ *        and flags its wraps. A rising edge of CLKA captures the count on the
+ *        channels capturing PWM rising edges, whose compare event, routed by
+ *        TMRA_TRGSEL1, captures the count of the units capturing on event.
+ *        The time base counters are written by the tests.
+ *******************************************************************************
+ */
+#include <string.h>
+#include "fake_tmra.h"
+#include "hc32_ll_aos.h"
+
+#define TMRA_UNIT_NUM                   (4UL)
+#define TMRA_CH_NUM                     (4UL)
+#define TMRA_EVT_CMP_BASE               (0x102UL)
+#define TMRA_EVT_CMP_STEP               (3UL)
+#define FAKE_AOS_SEL_MASK               (0x1FFUL)
+
+/* Quadrature state of CLKA (bit 0) and CLKB (bit 1), forward order */
+static const uint8_t m_au8Quad[4] = {0U, 1U, 3U, 2U};
+
+static uint8_t m_au8Phase[TMRA_UNIT_NUM];
+static void (*m_apfnIrq[TMRA_UNIT_NUM])(void);
+static void (*m_pfnClearHook)(const CM_TMRA_TypeDef *TMRAx, uint8_t u8After);
+
+static uint32_t FAKE_TMRA_Idx(const CM_TMRA_TypeDef *TMRAx)
+{
+    return (uint32_t)(TMRAx - HOST_TMRA) % TMRA_UNIT_NUM;
+}
+
+static void FAKE_TMRA_Wrap(CM_TMRA_TypeDef *TMRAx, uint32_t u32Flag, uint32_t u32Int)
+{
+    TMRAx->STFLR |= (uint16_t)u32Flag;
+    if ((0U != (TMRAx->ICONR & u32Int)) && (0UL == g_u32HostPrimask) &&
+        (NULL != m_apfnIrq[FAKE_TMRA_Idx(TMRAx)])) {
+        m_apfnIrq[FAKE_TMRA_Idx(TMRAx)]();
+    }
+}
+
+static void FAKE_TMRA_Event(uint32_t u32Event)
+{
+    uint32_t i;
+    uint32_t u32Ch;
+
+    if ((HOST_AOS.TMRA_TRGSEL1 & FAKE_AOS_SEL_MASK) == u32Event) {
+        for (i = 0UL; i < TMRA_UNIT_NUM; i++) {
+            for (u32Ch = 0UL; u32Ch < TMRA_CH_NUM; u32Ch++) {
+                if ((TMRA_CCONR_CAPMD | TMRA_CCONR_HICP2) ==
+                    (HOST_TMRA[i].CCONR[u32Ch] & (TMRA_CCONR_CAPMD | TMRA_CCONR_HICP2))) {
+                    HOST_TMRA[i].CMPAR[u32Ch] = HOST_TMRA[i].CNTER;
+                }
+            }
+        }
+    }
+}
+
+void FAKE_TMRA_Reset(void)
+{
+    (void)memset(HOST_TMRA, 0, sizeof(HOST_TMRA));
+    (void)memset(m_au8Phase, 0, sizeof(m_au8Phase));
+    (void)memset(m_apfnIrq, 0, sizeof(m_apfnIrq));
+    m_pfnClearHook = NULL;
+}
+
+void FAKE_TMRA_SetIrq(const CM_TMRA_TypeDef *TMRAx, void (*pfnIrq)(void))
+{
+    m_apfnIrq[FAKE_TMRA_Idx(TMRAx)] = pfnIrq;
+}
+
+void FAKE_TMRA_SetClearHook(void (*pfnHook)(const CM_TMRA_TypeDef *TMRAx, uint8_t u8After))
+{
+    m_pfnClearHook = pfnHook;
+}
+
+void FAKE_TMRA_Step(CM_TMRA_TypeDef *TMRAx, int8_t i8Dir)
+{
+    const uint32_t u32Idx = FAKE_TMRA_Idx(TMRAx);
+    const uint8_t u8Old = m_au8Quad[m_au8Phase[u32Idx]];
+    uint8_t u8New;
+    uint8_t u8Cond;
+    uint32_t u32Ch;
+
+    m_au8Phase[u32Idx] = (uint8_t)((m_au8Phase[u32Idx] + ((i8Dir > 0) ? 1U : 3U)) & 3U);
+    u8New = m_au8Quad[m_au8Phase[u32Idx]];
+
+    /* Condition bit: 0..3 edge of CLKB by level of CLKA, 4..7 edge of CLKA by level of CLKB */
+    if (0U != ((u8Old ^ u8New) & 1U)) {
+        u8Cond = (uint8_t)(4U + (((u8New >> 1U) & 1U) * 2U) + ((0U == (u8New & 1U)) ? 1U : 0U));
+    } else {
+        u8Cond = (uint8_t)(((u8New & 1U) * 2U) + ((0U == (u8New & 2U)) ? 1U : 0U));
+    }
+
+    if (0U != (TMRAx->BCSTRL & TMRA_BCSTRL_START)) {
+        if (0U != (TMRAx->HCUPR & (1U << u8Cond))) {
+            TMRAx->CNTER = (TMRAx->CNTER + 1UL) & 0xFFFFUL;
+            if (0UL == TMRAx->CNTER) {
+                FAKE_TMRA_Wrap(TMRAx, TMRA_FLAG_OVF, TMRA_INT_OVF);
+            }
+        } else if (0U != (TMRAx->HCDOR & (1U << u8Cond))) {
+            TMRAx->CNTER = (TMRAx->CNTER - 1UL) & 0xFFFFUL;
+            if (0xFFFFUL == TMRAx->CNTER) {
+                FAKE_TMRA_Wrap(TMRAx, TMRA_FLAG_UDF, TMRA_INT_UDF);
+            }
+        } else {
+            /* Edge not counted */
+        }
+    }
+
+    if ((0U == (u8Old & 1U)) && (0U != (u8New & 1U))) {
+        for (u32Ch = 0UL; u32Ch < TMRA_CH_NUM; u32Ch++) {
+            if ((TMRA_CCONR_CAPMD | TMRA_CCONR_HICP0) ==
+                (TMRAx->CCONR[u32Ch] & (TMRA_CCONR_CAPMD | TMRA_CCONR_HICP0))) {
+                TMRAx->CMPAR[u32Ch] = TMRAx->CNTER;
+                if (0U != (TMRAx->ECONR & (TMRA_ECONR_ETEN1 << u32Ch))) {
+                    FAKE_TMRA_Event(TMRA_EVT_CMP_BASE + (u32Idx * TMRA_EVT_CMP_STEP));
+                }
+            }
+        }
+    }
+}
+
+/*******************************************************************************
+ * TMRA driver API
+ ******************************************************************************/
+int32_t TMRA_StructInit(stc_tmra_init_t *pstcTmraInit)
+{
+    (void)memset(pstcTmraInit, 0, sizeof(*pstcTmraInit));
+    pstcTmraInit->u32PeriodValue = 0xFFFFUL;
+    return LL_OK;
+}
+
+int32_t TMRA_Init(CM_TMRA_TypeDef *TMRAx, const stc_tmra_init_t *pstcTmraInit)
+{
+    TMRAx->BCSTRL = 0U;
+    TMRAx->PERAR  = pstcTmraInit->u32PeriodValue;
+    if (TMRA_CNT_SRC_HW == pstcTmraInit->u8CountSrc) {
+        TMRAx->HCUPR = pstcTmraInit->hw_count.u16CountUpCond;
+        TMRAx->HCDOR = pstcTmraInit->hw_count.u16CountDownCond;
+    }
+    return LL_OK;
+}
+
+void TMRA_SetCountValue(CM_TMRA_TypeDef *TMRAx, uint32_t u32Value)
+{
+    TMRAx->CNTER = u32Value & 0xFFFFUL;
+}
+
+uint32_t TMRA_GetCountValue(const CM_TMRA_TypeDef *TMRAx)
+{
+    return TMRAx->CNTER;
+}
+
+uint32_t TMRA_GetCompareValue(const CM_TMRA_TypeDef *TMRAx, uint32_t u32Ch)
+{
+    return TMRAx->CMPAR[u32Ch % TMRA_CH_NUM];
+}
+
+void TMRA_SetFunc(CM_TMRA_TypeDef *TMRAx, uint32_t u32Ch, uint16_t u16Func)
+{
+    TMRAx->CCONR[u32Ch % TMRA_CH_NUM] = (uint16_t)((TMRAx->CCONR[u32Ch % TMRA_CH_NUM] & ~TMRA_CCONR_CAPMD) | u16Func);
+}
+
+void TMRA_HWCaptureCondCmd(CM_TMRA_TypeDef *TMRAx, uint32_t u32Ch, uint16_t u16Cond, en_functional_state_t enNewState)
+{
+    if (ENABLE == enNewState) {
+        TMRAx->CCONR[u32Ch % TMRA_CH_NUM] |= u16Cond;
+    } else {
+        TMRAx->CCONR[u32Ch % TMRA_CH_NUM] &= (uint16_t)~u16Cond;
+    }
+}
+
+void TMRA_EventCmd(CM_TMRA_TypeDef *TMRAx, uint32_t u32EventType, en_functional_state_t enNewState)
+{
+    if (ENABLE == enNewState) {
+        TMRAx->ECONR |= (uint16_t)u32EventType;
+    } else {
+        TMRAx->ECONR &= (uint16_t)~u32EventType;
+    }
+}
+
+en_flag_status_t TMRA_GetStatus(const CM_TMRA_TypeDef *TMRAx, uint32_t u32Flag)
+{
+    return (0U != (TMRAx->STFLR & u32Flag)) ? SET : RESET;
+}
+
+void TMRA_ClearStatus(CM_TMRA_TypeDef *TMRAx, uint32_t u32Flag)
+{
+    if (NULL != m_pfnClearHook) {
+        m_pfnClearHook(TMRAx, 0U);
+    }
+    TMRAx->STFLR &= (uint16_t)~u32Flag;
+    if (NULL != m_pfnClearHook) {
+        m_pfnClearHook(TMRAx, 1U);
+    }
+}
+
+void TMRA_IntCmd(CM_TMRA_TypeDef *TMRAx, uint32_t u32IntType, en_functional_state_t enNewState)
+{
+    if (ENABLE == enNewState) {
+        TMRAx->ICONR |= (uint16_t)u32IntType;
+    } else {
+        TMRAx->ICONR &= (uint16_t)~u32IntType;
+    }
+}
+
+void TMRA_Start(CM_TMRA_TypeDef *TMRAx)
+{
+    TMRAx->BCSTRL |= TMRA_BCSTRL_START;
+}
+
+void TMRA_Stop(CM_TMRA_TypeDef *TMRAx)
+{
+    TMRAx->BCSTRL &= (uint8_t)~TMRA_BCSTRL_START;
+}
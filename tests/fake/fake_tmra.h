@@ -0,0 +1,22 @@
+/**
+ *******************************************************************************
+ * @file  fake_tmra.h
+ * @brief Behavioral model of the TMRA driver for the host tests.
+ *******************************************************************************
+ */
+#ifndef __FAKE_TMRA_H__
+#define __FAKE_TMRA_H__
+
+#include "hc32_ll_tmra.h"
+
+void FAKE_TMRA_Reset(void);
+/* Called on an overflow or underflow of a unit with the interrupt unmasked */
+void FAKE_TMRA_SetIrq(const CM_TMRA_TypeDef *TMRAx, void (*pfnIrq)(void));
+/* Called by TMRA_ClearStatus() just before and just after the flags are
+   cleared, u8After tells which */
+void FAKE_TMRA_SetClearHook(void (*pfnHook)(const CM_TMRA_TypeDef *TMRAx, uint8_t u8After));
+/* One quadrature edge on CLKA/CLKB, forward when i8Dir > 0, CLKA leading.
+   The PWM pins of the channels are wired to CLKA. */
+void FAKE_TMRA_Step(CM_TMRA_TypeDef *TMRAx, int8_t i8Dir);
+
+#endif /* __FAKE_TMRA_H__ */
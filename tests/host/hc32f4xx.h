@@ -0,0 +1,851 @@
+/**
+ *******************************************************************************
+ * @file  hc32f4xx.h
+ * @brief Host stand-in of the HC32F4A0 device header for the host tests.
+ *        Register blocks are plain memory defined in host.c, core intrinsics
+ *        emulate PRIMASK only. Only the definitions used by the modules under
+ *        test are provided, bit positions follow the reference manual.
+ *******************************************************************************
+ */
+#ifndef __HC32F4XX_H__
+#define __HC32F4XX_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+/*******************************************************************************
+ * Core
+ ******************************************************************************/
+#define __I                             volatile const
+#define __O                             volatile
+#define __IO                            volatile
+#define __STATIC_INLINE                 static inline
+
+extern uint32_t g_u32HostPrimask;
+/* Called by __WFI(), a test models the sleep there */
+extern void (*g_pfnHostWfi)(void);
+
+__STATIC_INLINE void __disable_irq(void) { g_u32HostPrimask = 1UL; }
+__STATIC_INLINE void __enable_irq(void) { g_u32HostPrimask = 0UL; }
+__STATIC_INLINE uint32_t __get_PRIMASK(void) { return g_u32HostPrimask; }
+__STATIC_INLINE void __set_PRIMASK(uint32_t u32Primask) { g_u32HostPrimask = u32Primask; }
+__STATIC_INLINE void __DSB(void) { }
+__STATIC_INLINE void __ISB(void) { }
+__STATIC_INLINE void __DMB(void) { }
+__STATIC_INLINE void __NOP(void) { }
+#define __ASM                           __asm__
+__STATIC_INLINE void __WFI(void) { if (NULL != g_pfnHostWfi) { g_pfnHostWfi(); } }
+__STATIC_INLINE void __WFE(void) { }
+__STATIC_INLINE void __SEV(void) { }
+__STATIC_INLINE uint32_t __CLZ(uint32_t u32Value)
+{
+    return (0UL == u32Value) ? 32UL : (uint32_t)__builtin_clz(u32Value);
+}
+
+__STATIC_INLINE uint32_t __RBIT(uint32_t u32Value)
+{
+    uint32_t u32Result = 0UL;
+    uint32_t i;
+
+    for (i = 0UL; i < 32UL; i++) {
+        u32Result = (u32Result << 1U) | ((u32Value >> i) & 1UL);
+    }
+    return u32Result;
+}
+
+#define XTAL_VALUE                      (8000000UL)
+#define HRC_VALUE                       (16000000UL)
+#define HCLK_VALUE                      (240000000UL)
+
+typedef int32_t IRQn_Type;
+
+extern uint32_t g_au32HostNvicEn[8];
+
+__STATIC_INLINE void NVIC_EnableIRQ(IRQn_Type IRQn) { g_au32HostNvicEn[(uint32_t)IRQn >> 5] |= 1UL << ((uint32_t)IRQn & 31UL); }
+__STATIC_INLINE void NVIC_DisableIRQ(IRQn_Type IRQn) { g_au32HostNvicEn[(uint32_t)IRQn >> 5] &= ~(1UL << ((uint32_t)IRQn & 31UL)); }
+__STATIC_INLINE void NVIC_ClearPendingIRQ(IRQn_Type IRQn) { (void)IRQn; }
+
+typedef struct {
+    __IO uint32_t DEMCR;
+} CoreDebug_Type;
+
+typedef struct {
+    __IO uint32_t CTRL;
+    __IO uint32_t CYCCNT;
+} DWT_Type;
+
+typedef struct {
+    __IO uint32_t SCR;
+} SCB_Type;
+
+extern CoreDebug_Type HOST_CoreDebug;
+extern DWT_Type HOST_DWT;
+extern SCB_Type HOST_SCB;
+#define CoreDebug                       (&HOST_CoreDebug)
+#define DWT                             (&HOST_DWT)
+#define SCB                             (&HOST_SCB)
+
+#define CoreDebug_DEMCR_TRCENA_Msk      (0x01000000UL)
+#define DWT_CTRL_CYCCNTENA_Msk          (0x00000001UL)
+#define SCB_SCR_SLEEPDEEP_Msk           (0x00000004UL)
+
+/*******************************************************************************
+ * TMR0
+ ******************************************************************************/
+typedef struct {
+    __IO uint32_t CNTAR;
+    __IO uint32_t CNTBR;
+    __IO uint32_t CMPAR;
+    __IO uint32_t CMPBR;
+    __IO uint32_t BCONR;
+    __IO uint32_t STFLR;
+} CM_TMR0_TypeDef;
+
+extern CM_TMR0_TypeDef HOST_TMR0[2];
+#define CM_TMR0_1                       (&HOST_TMR0[0])
+#define CM_TMR0_2                       (&HOST_TMR0[1])
+
+#define TMR0_BCONR_CAPMDA               (0x00000002UL)
+#define TMR0_BCONR_INTENA               (0x00000004UL)
+#define TMR0_BCONR_CKDIVA_POS           (4U)
+#define TMR0_BCONR_SYNSA                (0x00000100UL)
+#define TMR0_BCONR_SYNCLKA              (0x00000200UL)
+#define TMR0_BCONR_ASYNCLKA             (0x00000400UL)
+#define TMR0_BCONR_HICPA                (0x00008000UL)
+#define TMR0_BCONR_INTENB               (0x00040000UL)
+#define TMR0_STFLR_CMFA                 (0x00000001UL)
+#define TMR0_STFLR_CMFB                 (0x00010000UL)
+
+/*******************************************************************************
+ * TMR4
+ ******************************************************************************/
+typedef struct {
+    __IO uint16_t OCCR[6];
+    __IO uint16_t CPSR;
+    __IO uint16_t PDAR[3];
+    __IO uint16_t PDBR[3];
+    __IO uint16_t SCCR[6];
+    __IO uint16_t SCSR[6];
+} CM_TMR4_TypeDef;
+
+extern CM_TMR4_TypeDef HOST_TMR4[3];
+#define CM_TMR4_1                       (&HOST_TMR4[0])
+#define CM_TMR4_2                       (&HOST_TMR4[1])
+#define CM_TMR4_3                       (&HOST_TMR4[2])
+
+#define TMR4_SCSR_BUFEN_0               (0x0001U)
+#define TMR4_SCSR_BUFEN_1               (0x0002U)
+#define TMR4_SCSR_BUFEN                 (0x0003U)
+#define TMR4_SCSR_DEN                   (0x1000U)
+#define TMR4_SCSR_PEN                   (0x2000U)
+#define TMR4_SCSR_UEN                   (0x4000U)
+#define TMR4_SCSR_ZEN                   (0x8000U)
+
+/*******************************************************************************
+ * TMR6
+ ******************************************************************************/
+typedef struct {
+    __IO uint32_t CNTER;
+    __IO uint32_t PERAR;
+    __IO uint32_t PERBR;
+    __IO uint32_t PERCR;
+    __IO uint32_t GCMAR;
+    __IO uint32_t GCMBR;
+    __IO uint32_t GCMCR;
+    __IO uint32_t GCMDR;
+    __IO uint32_t GCMER;
+    __IO uint32_t GCMFR;
+    __IO uint32_t BCONR;
+    __IO uint32_t STFLR;
+} CM_TMR6_TypeDef;
+
+typedef struct {
+    __IO uint32_t SSTAR;
+} CM_TMR6_COMMON_TypeDef;
+
+extern CM_TMR6_TypeDef HOST_TMR6[8];
+extern CM_TMR6_COMMON_TypeDef HOST_TMR6_COMMON;
+#define CM_TMR6_1                       (&HOST_TMR6[0])
+#define CM_TMR6_2                       (&HOST_TMR6[1])
+#define CM_TMR6_3                       (&HOST_TMR6[2])
+#define CM_TMR6_4                       (&HOST_TMR6[3])
+#define CM_TMR6_5                       (&HOST_TMR6[4])
+#define CM_TMR6_6                       (&HOST_TMR6[5])
+#define CM_TMR6_7                       (&HOST_TMR6[6])
+#define CM_TMR6_8                       (&HOST_TMR6[7])
+#define CM_TMR6_COMMON                  (&HOST_TMR6_COMMON)
+
+#define TMR6_BCONR_BENA                 (0x00000001UL)
+#define TMR6_BCONR_BSEA                 (0x00000002UL)
+#define TMR6_BCONR_BENB                 (0x00000010UL)
+#define TMR6_BCONR_BENP                 (0x00000100UL)
+#define TMR6_STFLR_DIRF                 (0x80000000UL)
+#define TMR6_COMMON_SSTAR_SSTA1         (0x00000001UL)
+
+/*******************************************************************************
+ * TMRA
+ ******************************************************************************/
+typedef struct {
+    __IO uint32_t CNTER;
+    __IO uint32_t PERAR;
+    __IO uint32_t CMPAR[4];
+    __IO uint16_t HCUPR;
+    __IO uint16_t HCDOR;
+    __IO uint16_t ICONR;
+    __IO uint16_t ECONR;
+    __IO uint16_t STFLR;
+    __IO uint16_t CCONR[4];
+    __IO uint8_t BCSTRL;
+    __IO uint8_t BCSTRH;
+} CM_TMRA_TypeDef;
+
+extern CM_TMRA_TypeDef HOST_TMRA[4];
+#define CM_TMRA_1                       (&HOST_TMRA[0])
+#define CM_TMRA_2                       (&HOST_TMRA[1])
+#define CM_TMRA_3                       (&HOST_TMRA[2])
+#define CM_TMRA_4                       (&HOST_TMRA[3])
+
+#define TMRA_BCSTRL_START               (0x01U)
+#define TMRA_BCSTRL_CKDIV_POS           (4U)
+#define TMRA_BCSTRL_CKDIV               (0xF0U)
+#define TMRA_HCUPR_HCUP0                (0x0001U)
+#define TMRA_HCUPR_HCUP1                (0x0002U)
+#define TMRA_HCUPR_HCUP2                (0x0004U)
+#define TMRA_HCUPR_HCUP3                (0x0008U)
+#define TMRA_HCUPR_HCUP4                (0x0010U)
+#define TMRA_HCUPR_HCUP5                (0x0020U)
+#define TMRA_HCUPR_HCUP6                (0x0040U)
+#define TMRA_HCUPR_HCUP7                (0x0080U)
+#define TMRA_HCUPR_HCUP11               (0x0800U)
+#define TMRA_HCDOR_HCDO0                (0x0001U)
+#define TMRA_HCDOR_HCDO1                (0x0002U)
+#define TMRA_HCDOR_HCDO2                (0x0004U)
+#define TMRA_HCDOR_HCDO3                (0x0008U)
+#define TMRA_HCDOR_HCDO4                (0x0010U)
+#define TMRA_HCDOR_HCDO5                (0x0020U)
+#define TMRA_HCDOR_HCDO6                (0x0040U)
+#define TMRA_HCDOR_HCDO7                (0x0080U)
+#define TMRA_ECONR_ETEN1                (0x0001U)
+#define TMRA_ECONR_ETEN2                (0x0002U)
+#define TMRA_ECONR_ETEN3                (0x0004U)
+#define TMRA_ECONR_ETEN4                (0x0008U)
+#define TMRA_CCONR_CAPMD                (0x0001U)
+#define TMRA_CCONR_HICP0                (0x0010U)
+#define TMRA_CCONR_HICP1                (0x0020U)
+#define TMRA_CCONR_HICP2                (0x0040U)
+
+/*******************************************************************************
+ * AOS
+ ******************************************************************************/
+typedef enum {
+    EVT_SRC_TMR0_1_CMP_A            = 0x003,
+    EVT_SRC_TMR6_1_OVF              = 0x0BE,
+    EVT_SRC_TMR6_1_UDF              = 0x0BF,
+    EVT_SRC_TMR6_2_OVF              = 0x0C6,
+    EVT_SRC_TMR6_2_UDF              = 0x0C7,
+    EVT_SRC_TMR6_3_OVF              = 0x0CE,
+    EVT_SRC_TMR6_3_UDF              = 0x0CF,
+    EVT_SRC_TMR6_4_OVF              = 0x0D6,
+    EVT_SRC_TMR6_4_UDF              = 0x0D7,
+    EVT_SRC_TMR6_5_OVF              = 0x0DE,
+    EVT_SRC_TMR6_5_UDF              = 0x0DF,
+    EVT_SRC_TMR6_6_OVF              = 0x0E6,
+    EVT_SRC_TMR6_6_UDF              = 0x0E7,
+    EVT_SRC_TMR6_7_OVF              = 0x0EE,
+    EVT_SRC_TMR6_7_UDF              = 0x0EF,
+    EVT_SRC_TMR6_8_OVF              = 0x0F6,
+    EVT_SRC_TMR6_8_UDF              = 0x0F7,
+    EVT_SRC_TMRA_1_CMP              = 0x102,
+    EVT_SRC_TMRA_2_CMP              = 0x105,
+    EVT_SRC_TMRA_3_CMP              = 0x108,
+    EVT_SRC_TMRA_4_CMP              = 0x10B,
+    EVT_SRC_FMAC_1                  = 0x13B,
+    EVT_SRC_FMAC_2                  = 0x13C,
+    EVT_SRC_FMAC_3                  = 0x13D,
+    EVT_SRC_FMAC_4                  = 0x13E,
+    EVT_SRC_I2S1_TXIRQOUT           = 0x160,
+    EVT_SRC_I2S1_RXIRQOUT           = 0x161,
+    EVT_SRC_I2S2_TXIRQOUT           = 0x163,
+    EVT_SRC_I2S2_RXIRQOUT           = 0x164,
+    EVT_SRC_I2S3_TXIRQOUT           = 0x166,
+    EVT_SRC_I2S3_RXIRQOUT           = 0x167,
+    EVT_SRC_I2S4_TXIRQOUT           = 0x168,
+    EVT_SRC_I2S4_RXIRQOUT           = 0x169,
+    EVT_SRC_ADC1_EOCA               = 0x16A,
+    EVT_SRC_ADC2_EOCA               = 0x16E,
+    EVT_SRC_ADC3_EOCA               = 0x172,
+    EVT_SRC_I2C1_RXI                = 0x1D4,
+    EVT_SRC_I2C1_TXI                = 0x1D5,
+    EVT_SRC_DVP_DMAREQ              = 0x1F9,
+    EVT_SRC_MAX                     = 0x1FF,
+} en_event_src_t;
+
+typedef struct {
+    __IO uint32_t INTSFTTRG;
+    __IO uint32_t DCU_TRGSEL1;
+    __IO uint32_t DCU_TRGSEL2;
+    __IO uint32_t DCU_TRGSEL3;
+    __IO uint32_t DCU_TRGSEL4;
+    __IO uint32_t DMA1_TRGSEL0;
+    __IO uint32_t DMA1_TRGSEL1;
+    __IO uint32_t DMA1_TRGSEL2;
+    __IO uint32_t DMA1_TRGSEL3;
+    __IO uint32_t DMA1_TRGSEL4;
+    __IO uint32_t DMA1_TRGSEL5;
+    __IO uint32_t DMA1_TRGSEL6;
+    __IO uint32_t DMA1_TRGSEL7;
+    __IO uint32_t DMA2_TRGSEL0;
+    __IO uint32_t DMA2_TRGSEL1;
+    __IO uint32_t DMA2_TRGSEL2;
+    __IO uint32_t DMA2_TRGSEL3;
+    __IO uint32_t DMA2_TRGSEL4;
+    __IO uint32_t DMA2_TRGSEL5;
+    __IO uint32_t DMA2_TRGSEL6;
+    __IO uint32_t DMA2_TRGSEL7;
+    __IO uint32_t DMA_RC_TRGSEL;
+    __IO uint32_t TMR6_TRGSEL0;
+    __IO uint32_t TMR6_TRGSEL1;
+    __IO uint32_t TMR6_TRGSEL2;
+    __IO uint32_t TMR6_TRGSEL3;
+    __IO uint32_t PEVNT_TRGSEL12;
+    __IO uint32_t PEVNT_TRGSEL34;
+    __IO uint32_t TMR0_TRGSEL;
+    __IO uint32_t TMR2_TRGSEL;
+    __IO uint32_t HASH_TRGSELA;
+    __IO uint32_t HASH_TRGSELB;
+    __IO uint32_t TMRA_TRGSEL0;
+    __IO uint32_t TMRA_TRGSEL1;
+    __IO uint32_t TMRA_TRGSEL2;
+    __IO uint32_t TMRA_TRGSEL3;
+    __IO uint32_t OTS_TRGSEL;
+    __IO uint32_t ADC1_TRGSEL0;
+    __IO uint32_t ADC1_TRGSEL1;
+    __IO uint32_t ADC2_TRGSEL0;
+    __IO uint32_t ADC2_TRGSEL1;
+    __IO uint32_t ADC3_TRGSEL0;
+    __IO uint32_t ADC3_TRGSEL1;
+    __IO uint32_t COMTRG1;
+    __IO uint32_t COMTRG2;
+} CM_AOS_TypeDef;
+
+extern CM_AOS_TypeDef HOST_AOS;
+#define CM_AOS                          (&HOST_AOS)
+
+typedef struct {
+    struct {
+        __IO uint32_t STRG;
+    } INTSFTTRG_b;
+} stc_aos_bitband_t;
+
+extern stc_aos_bitband_t HOST_AOS_BB;
+#define bCM_AOS                         (&HOST_AOS_BB)
+
+/*******************************************************************************
+ * CMU
+ ******************************************************************************/
+#define CMU_SCFGR_PCLK0S_POS            (0U)
+#define CMU_SCFGR_PCLK0S                (0x00000007UL)
+#define CMU_SCFGR_PCLK1S_POS            (4U)
+#define CMU_SCFGR_PCLK1S                (0x00000070UL)
+#define CMU_SCFGR_PCLK2S_POS            (8U)
+#define CMU_SCFGR_PCLK2S                (0x00000700UL)
+#define CMU_SCFGR_PCLK3S_POS            (12U)
+#define CMU_SCFGR_PCLK3S                (0x00007000UL)
+#define CMU_SCFGR_PCLK4S_POS            (16U)
+#define CMU_SCFGR_PCLK4S                (0x00070000UL)
+#define CMU_SCFGR_EXCKS_POS             (20U)
+#define CMU_SCFGR_EXCKS                 (0x00700000UL)
+#define CMU_SCFGR_HCLKS_POS             (24U)
+#define CMU_SCFGR_HCLKS                 (0x07000000UL)
+
+/*******************************************************************************
+ * ADC
+ ******************************************************************************/
+typedef struct {
+    __IO uint16_t DR0;
+    __IO uint16_t DR1;
+    __IO uint16_t DR2;
+    __IO uint16_t DR3;
+    __IO uint16_t DR4;
+    __IO uint16_t DR5;
+    __IO uint16_t DR6;
+    __IO uint16_t DR7;
+    __IO uint16_t DR8;
+    __IO uint16_t DR9;
+    __IO uint16_t DR10;
+    __IO uint16_t DR11;
+    __IO uint16_t DR12;
+    __IO uint16_t DR13;
+    __IO uint16_t DR14;
+    __IO uint16_t DR15;
+    __IO uint16_t DR16;
+    __IO uint16_t DR17;
+    __IO uint16_t DR18;
+    __IO uint16_t DR19;
+} CM_ADC_TypeDef;
+
+extern CM_ADC_TypeDef HOST_ADC[3];
+#define CM_ADC1                         (&HOST_ADC[0])
+#define CM_ADC2                         (&HOST_ADC[1])
+#define CM_ADC3                         (&HOST_ADC[2])
+
+#define ADC_CR0_MS_POS                  (0U)
+#define ADC_TRGSR_TRGSELA_0             (0x0001U)
+#define ADC_TRGSR_TRGSELA_1             (0x0002U)
+#define ADC_TRGSR_TRGSELA_2             (0x0004U)
+#define ADC_AWDCR_AWD0IEN               (0x0002U)
+#define ADC_AWDCR_AWD1IEN               (0x0200U)
+#define ADC_AWDCR_AWDCM_0               (0x0010U)
+#define ADC_AWDCR_AWDCM_1               (0x0020U)
+#define ADC_AWDCR_AWDCM                 (0x0030U)
+#define ADC_AWDSR_AWD0F                 (0x01U)
+#define ADC_AWDSR_AWD1F                 (0x02U)
+#define ADC_AWDSR_AWDCMF                (0x10U)
+
+/*******************************************************************************
+ * DAC
+ ******************************************************************************/
+typedef struct {
+    __IO uint16_t DADR1;
+    __IO uint16_t DADR2;
+    __IO uint16_t DACR;
+    __IO uint16_t DAADPCR;
+} CM_DAC_TypeDef;
+
+extern CM_DAC_TypeDef HOST_DAC[2];
+#define CM_DAC1                         (&HOST_DAC[0])
+#define CM_DAC2                         (&HOST_DAC[1])
+
+#define DAC_DACR_DPSEL                  (0x0100U)
+#define DAC_DACR_EXTDSL1                (0x0400U)
+#define DAC_DAADPCR_ADCSL1              (0x0001U)
+#define DAC_DAADPCR_ADCSL2              (0x0002U)
+#define DAC_DAADPCR_ADCSL3              (0x0004U)
+
+/*******************************************************************************
+ * DCU
+ ******************************************************************************/
+typedef struct {
+    __IO uint32_t CTL;
+    __IO uint32_t FLAG;
+    __IO uint32_t DATA0;
+    __IO uint32_t DATA1;
+    __IO uint32_t DATA2;
+    __IO uint32_t FLAGCLR;
+    __IO uint32_t INTEVTSEL;
+} CM_DCU_TypeDef;
+
+extern CM_DCU_TypeDef HOST_DCU[8];
+#define CM_DCU1                         (&HOST_DCU[0])
+#define CM_DCU2                         (&HOST_DCU[1])
+#define CM_DCU3                         (&HOST_DCU[2])
+#define CM_DCU4                         (&HOST_DCU[3])
+#define CM_DCU5                         (&HOST_DCU[4])
+#define CM_DCU6                         (&HOST_DCU[5])
+#define CM_DCU7                         (&HOST_DCU[6])
+#define CM_DCU8                         (&HOST_DCU[7])
+
+#define DCU_CTL_MODE                    (0x0000000FUL)
+#define DCU_CTL_DATASIZE_0              (0x00000010UL)
+#define DCU_CTL_DATASIZE_1              (0x00000020UL)
+#define DCU_CTL_DATASIZE                (0x00000030UL)
+#define DCU_CTL_COMPTRG                 (0x00000100UL)
+#define DCU_CTL_INTEN                   (0x80000000UL)
+#define DCU_FLAG_FLAG_OP                (0x00000001UL)
+#define DCU_FLAG_FLAG_LS2               (0x00000002UL)
+#define DCU_FLAG_FLAG_EQ2               (0x00000004UL)
+#define DCU_FLAG_FLAG_GT2               (0x00000008UL)
+#define DCU_FLAG_FLAG_LS1               (0x00000010UL)
+#define DCU_FLAG_FLAG_EQ1               (0x00000020UL)
+#define DCU_FLAG_FLAG_GT1               (0x00000040UL)
+#define DCU_FLAG_FLAG_RLD               (0x00000200UL)
+#define DCU_FLAG_FLAG_BTM               (0x00000400UL)
+#define DCU_FLAG_FLAG_TOP               (0x00000800UL)
+#define DCU_INTEVTSEL_SEL_OP            (0x00000001UL)
+#define DCU_INTEVTSEL_SEL_LS2           (0x00000002UL)
+#define DCU_INTEVTSEL_SEL_EQ2           (0x00000004UL)
+#define DCU_INTEVTSEL_SEL_GT2           (0x00000008UL)
+#define DCU_INTEVTSEL_SEL_LS1           (0x00000010UL)
+#define DCU_INTEVTSEL_SEL_EQ1           (0x00000020UL)
+#define DCU_INTEVTSEL_SEL_GT1           (0x00000040UL)
+#define DCU_INTEVTSEL_SEL_WIN_0         (0x00000080UL)
+#define DCU_INTEVTSEL_SEL_WIN_1         (0x00000100UL)
+#define DCU_INTEVTSEL_SEL_TOP           (0x00000400UL)
+#define DCU_INTEVTSEL_SEL_BTM           (0x00000800UL)
+
+/*******************************************************************************
+ * DMA
+ ******************************************************************************/
+typedef struct {
+    __IO uint32_t EN;
+} CM_DMA_TypeDef;
+
+extern CM_DMA_TypeDef HOST_DMA[2];
+#define CM_DMA1                         (&HOST_DMA[0])
+#define CM_DMA2                         (&HOST_DMA[1])
+
+#define DMA_CHEN_CHEN                   (0x000000FFUL)
+#define DMA_INTSTAT1_TC_0               (0x00000001UL)
+#define DMA_INTSTAT1_BTC_0              (0x00010000UL)
+#define DMA_INTMASK1_MSKTC_0            (0x00000001UL)
+#define DMA_INTMASK1_MSKBTC_0           (0x00010000UL)
+#define DMA_CHCTL_SINC_0                (0x00000001UL)
+#define DMA_CHCTL_SINC_1                (0x00000002UL)
+#define DMA_CHCTL_SINC                  (0x00000003UL)
+#define DMA_CHCTL_DINC_0                (0x00000004UL)
+#define DMA_CHCTL_DINC_1                (0x00000008UL)
+#define DMA_CHCTL_DINC                  (0x0000000CUL)
+#define DMA_CHCTL_SRPTEN                (0x00000010UL)
+#define DMA_CHCTL_DRPTEN                (0x00000020UL)
+#define DMA_CHCTL_SNSEQEN               (0x00000040UL)
+#define DMA_CHCTL_DNSEQEN               (0x00000080UL)
+#define DMA_CHCTL_HSIZE_0               (0x00000100UL)
+#define DMA_CHCTL_HSIZE_1               (0x00000200UL)
+#define DMA_CHCTL_HSIZE                 (0x00000300UL)
+#define DMA_CHCTL_LLPEN                 (0x00000400UL)
+#define DMA_CHCTL_LLPRUN                (0x00000800UL)
+#define DMA_CHCTL_IE                    (0x00001000UL)
+#define DMA_DTCTL_CNT_POS               (16U)
+
+/*******************************************************************************
+ * DMC
+ ******************************************************************************/
+typedef struct {
+    __IO uint32_t STSR;
+    uint8_t RESERVED0[508];
+    __IO uint32_t CSCR0;
+    __IO uint32_t CSCR1;
+    __IO uint32_t CSCR2;
+    __IO uint32_t CSCR3;
+} CM_DMC_TypeDef;
+
+extern CM_DMC_TypeDef HOST_DMC;
+#define CM_DMC                          (&HOST_DMC)
+
+#define DMC_STSR_STATUS                 (0x00000003UL)
+#define DMC_CSCR_ADDMSK_POS             (0U)
+#define DMC_CSCR_ADDMSK                 (0x000000FFUL)
+#define DMC_CSCR_ADDMAT_POS             (8U)
+#define DMC_CSCR_ADDMAT                 (0x0000FF00UL)
+
+/*******************************************************************************
+ * DVP
+ ******************************************************************************/
+typedef struct {
+    __IO uint32_t CTR;
+    __IO uint32_t DTR;
+    __IO uint32_t STR;
+    __IO uint32_t IER;
+    __IO uint32_t DMR;
+    uint8_t RESERVED0[12];
+    __IO uint32_t SSYNDR;
+    __IO uint32_t SSYNMR;
+    __IO uint32_t CPSFTR;
+    __IO uint32_t CPSZER;
+} CM_DVP_TypeDef;
+
+extern CM_DVP_TypeDef HOST_DVP;
+#define CM_DVP                          (&HOST_DVP)
+
+#define DVP_CTR_CAPEN                   (0x00000001UL)
+#define DVP_CTR_CAPMD                   (0x00000002UL)
+#define DVP_CTR_CROPEN                  (0x00000004UL)
+#define DVP_CTR_JPEGEN                  (0x00000008UL)
+#define DVP_CTR_SWSYNC                  (0x00000010UL)
+#define DVP_CTR_PIXCKSEL                (0x00000020UL)
+#define DVP_CTR_HSYNCSEL                (0x00000040UL)
+#define DVP_CTR_VSYNCSEL                (0x00000080UL)
+#define DVP_CTR_CAPFRC_0                (0x00000100UL)
+#define DVP_CTR_CAPFRC_1                (0x00000200UL)
+#define DVP_CTR_BITSEL_0                (0x00000400UL)
+#define DVP_CTR_BITSEL_1                (0x00000800UL)
+#define DVP_CTR_BITSEL                  (0x00000C00UL)
+#define DVP_CTR_DVPEN                   (0x00004000UL)
+#define DVP_STR_FSF                     (0x00000001UL)
+#define DVP_STR_LSF                     (0x00000002UL)
+#define DVP_STR_LEF                     (0x00000004UL)
+#define DVP_STR_FEF                     (0x00000008UL)
+#define DVP_STR_SQUERF                  (0x00000010UL)
+#define DVP_STR_FIFOERF                 (0x00000020UL)
+#define DVP_IER_FSIEN                   (0x00000001UL)
+#define DVP_IER_LSIEN                   (0x00000002UL)
+#define DVP_IER_LEIEN                   (0x00000004UL)
+#define DVP_IER_FEIEN                   (0x00000008UL)
+#define DVP_IER_SQUERIEN                (0x00000010UL)
+#define DVP_IER_FIFOERIEN               (0x00000020UL)
+#define DVP_CPSFTR_RSHIFT               (0x00003FFFUL)
+#define DVP_CPSFTR_CSHIFT_POS           (16U)
+#define DVP_CPSFTR_CSHIFT               (0x3FFF0000UL)
+#define DVP_CPSZER_RSIZE                (0x00003FFFUL)
+#define DVP_CPSZER_CSIZE_POS            (16U)
+#define DVP_CPSZER_CSIZE                (0x3FFF0000UL)
+
+/*******************************************************************************
+ * EFM
+ ******************************************************************************/
+typedef struct {
+    __IO uint32_t FAPRT;
+    __IO uint32_t MMF_REMPRT;
+} CM_EFM_TypeDef;
+
+extern CM_EFM_TypeDef HOST_EFM;
+#define CM_EFM                          (&HOST_EFM)
+
+#define EFM_FRMC_FLWT_POS               (0U)
+#define EFM_FRMC_FLWT                   (0x0000000FUL)
+
+/*******************************************************************************
+ * GPIO
+ ******************************************************************************/
+typedef struct {
+    __IO uint16_t PWPR;
+} CM_GPIO_TypeDef;
+
+extern CM_GPIO_TypeDef HOST_GPIO;
+#define CM_GPIO                         (&HOST_GPIO)
+
+#define GPIO_PCCR_RDWT_POS              (12U)
+#define GPIO_PCCR_RDWT                  (0x7000U)
+
+/*******************************************************************************
+ * FMAC
+ ******************************************************************************/
+typedef struct {
+    __IO uint32_t ENR;
+    __IO uint32_t CTR;
+    __IO uint32_t IER;
+    __IO uint32_t DTR;
+    __IO uint32_t RTR0;
+    __IO uint32_t RTR1;
+    __IO uint32_t STR;
+    uint8_t RESERVED0[4];
+    __IO uint32_t COR0;
+    __IO uint32_t COR1;
+    __IO uint32_t COR2;
+    __IO uint32_t COR3;
+    __IO uint32_t COR4;
+    __IO uint32_t COR5;
+    __IO uint32_t COR6;
+    __IO uint32_t COR7;
+    __IO uint32_t COR8;
+    __IO uint32_t COR9;
+    __IO uint32_t COR10;
+    __IO uint32_t COR11;
+    __IO uint32_t COR12;
+    __IO uint32_t COR13;
+    __IO uint32_t COR14;
+    __IO uint32_t COR15;
+    __IO uint32_t COR16;
+} CM_FMAC_TypeDef;
+
+extern CM_FMAC_TypeDef HOST_FMAC[4];
+#define CM_FMAC1                        (&HOST_FMAC[0])
+#define CM_FMAC2                        (&HOST_FMAC[1])
+#define CM_FMAC3                        (&HOST_FMAC[2])
+#define CM_FMAC4                        (&HOST_FMAC[3])
+
+#define FMAC_ENR_FMACEN                 (0x00000001UL)
+#define FMAC_CTR_STAGE_NUM              (0x0000001FUL)
+#define FMAC_CTR_SHIFT_POS              (8U)
+#define FMAC_CTR_SHIFT                  (0x00001F00UL)
+#define FMAC_IER_INTEN                  (0x00000001UL)
+#define FMAC_STR_READY                  (0x00000001UL)
+
+/*******************************************************************************
+ * I2C
+ ******************************************************************************/
+typedef struct {
+    __IO uint32_t CR1;
+    __IO uint32_t CR2;
+    __IO uint32_t CR3;
+    __IO uint32_t CR4;
+    __IO uint32_t SLR0;
+    __IO uint32_t SLR1;
+    __IO uint32_t SLTR;
+    __IO uint32_t SR;
+    __IO uint32_t CLR;
+    __IO uint8_t DTR;
+    uint8_t RESERVED0[3];
+    __IO uint8_t DRR;
+    uint8_t RESERVED1[3];
+    __IO uint32_t CCR;
+    __IO uint32_t FLTR;
+} CM_I2C_TypeDef;
+
+extern CM_I2C_TypeDef HOST_I2C[6];
+#define CM_I2C1                         (&HOST_I2C[0])
+#define CM_I2C2                         (&HOST_I2C[1])
+#define CM_I2C3                         (&HOST_I2C[2])
+#define CM_I2C4                         (&HOST_I2C[3])
+#define CM_I2C5                         (&HOST_I2C[4])
+#define CM_I2C6                         (&HOST_I2C[5])
+
+#define I2C_CR1_ACK                     (0x00000400UL)
+#define I2C_CR3_FACKEN                  (0x00000080UL)
+
+#define I2C_SR_STARTF                   (0x00000001UL)
+#define I2C_SR_SLADDR0F                 (0x00000002UL)
+#define I2C_SR_SLADDR1F                 (0x00000004UL)
+#define I2C_SR_TENDF                    (0x00000008UL)
+#define I2C_SR_STOPF                    (0x00000010UL)
+#define I2C_SR_RFULLF                   (0x00000040UL)
+#define I2C_SR_TEMPTYF                  (0x00000080UL)
+#define I2C_SR_ARLOF                    (0x00000200UL)
+#define I2C_SR_ACKRF                    (0x00000400UL)
+#define I2C_SR_NACKF                    (0x00001000UL)
+#define I2C_SR_TMOUTF                   (0x00004000UL)
+#define I2C_SR_MSL                      (0x00010000UL)
+#define I2C_SR_BUSY                     (0x00020000UL)
+#define I2C_SR_TRA                      (0x00040000UL)
+#define I2C_SR_GENCALLF                 (0x00100000UL)
+#define I2C_SR_SMBDEFAULTF              (0x00200000UL)
+#define I2C_SR_SMBHOSTF                 (0x00400000UL)
+#define I2C_SR_SMBALRTF                 (0x00800000UL)
+
+#define I2C_CLR_STARTFCLR               (I2C_SR_STARTF)
+#define I2C_CLR_SLADDR0FCLR             (I2C_SR_SLADDR0F)
+#define I2C_CLR_SLADDR1FCLR             (I2C_SR_SLADDR1F)
+#define I2C_CLR_TENDFCLR                (I2C_SR_TENDF)
+#define I2C_CLR_STOPFCLR                (I2C_SR_STOPF)
+#define I2C_CLR_RFULLFCLR               (I2C_SR_RFULLF)
+#define I2C_CLR_ARLOFCLR                (I2C_SR_ARLOF)
+#define I2C_CLR_NACKFCLR                (I2C_SR_NACKF)
+#define I2C_CLR_TMOUTFCLR               (I2C_SR_TMOUTF)
+#define I2C_CLR_GENCALLFCLR             (I2C_SR_GENCALLF)
+#define I2C_CLR_SMBDEFAULTFCLR          (I2C_SR_SMBDEFAULTF)
+#define I2C_CLR_SMBHOSTFCLR             (I2C_SR_SMBHOSTF)
+#define I2C_CLR_SMBALRTFCLR             (I2C_SR_SMBALRTF)
+
+#define I2C_CR2_STARTIE                 (I2C_SR_STARTF)
+#define I2C_CR2_SLADDR0IE               (I2C_SR_SLADDR0F)
+#define I2C_CR2_SLADDR1IE               (I2C_SR_SLADDR1F)
+#define I2C_CR2_TENDIE                  (I2C_SR_TENDF)
+#define I2C_CR2_STOPIE                  (I2C_SR_STOPF)
+#define I2C_CR2_RFULLIE                 (I2C_SR_RFULLF)
+#define I2C_CR2_TEMPTYIE                (I2C_SR_TEMPTYF)
+#define I2C_CR2_ARLOIE                  (I2C_SR_ARLOF)
+#define I2C_CR2_NACKIE                  (I2C_SR_NACKF)
+#define I2C_CR2_TMOUTIE                 (I2C_SR_TMOUTF)
+#define I2C_CR2_GENCALLIE               (I2C_SR_GENCALLF)
+#define I2C_CR2_SMBDEFAULTIE            (I2C_SR_SMBDEFAULTF)
+#define I2C_CR2_SMBHOSTIE               (I2C_SR_SMBHOSTF)
+#define I2C_CR2_SMBALRTIE               (I2C_SR_SMBALRTF)
+
+/*******************************************************************************
+ * I2S
+ ******************************************************************************/
+typedef struct {
+    __IO uint32_t TXBUF;
+    __IO uint32_t RXBUF;
+    __IO uint32_t CTRL;
+    __IO uint32_t SR;
+    __IO uint32_t ER;
+    __IO uint32_t CFGR;
+    __IO uint32_t PR;
+} CM_I2S_TypeDef;
+
+extern CM_I2S_TypeDef HOST_I2S[4];
+#define CM_I2S1                         (&HOST_I2S[0])
+#define CM_I2S2                         (&HOST_I2S[1])
+#define CM_I2S3                         (&HOST_I2S[2])
+#define CM_I2S4                         (&HOST_I2S[3])
+
+#define I2S_CTRL_TXE                    (0x00000001UL)
+#define I2S_CTRL_TXIE                   (0x00000002UL)
+#define I2S_CTRL_RXE                    (0x00000004UL)
+#define I2S_CTRL_RXIE                   (0x00000008UL)
+#define I2S_CTRL_EIE                    (0x00000010UL)
+#define I2S_CTRL_WMS                    (0x00000020UL)
+#define I2S_CTRL_MCKOE                  (0x00000080UL)
+#define I2S_CTRL_TXBIRQWL_POS           (8U)
+#define I2S_CTRL_RXBIRQWL_POS           (12U)
+#define I2S_CTRL_FIFOR                  (0x00010000UL)
+#define I2S_CTRL_I2SPLLSEL              (0x00040000UL)
+#define I2S_CTRL_SDOE                   (0x00080000UL)
+#define I2S_CTRL_DUPLEX                 (0x00400000UL)
+#define I2S_CTRL_CLKSEL                 (0x00800000UL)
+#define I2S_CTRL_SRST                   (0x01000000UL)
+#define I2S_SR_TXBA                     (0x00000001UL)
+#define I2S_SR_RXBA                     (0x00000002UL)
+#define I2S_SR_TXBE                     (0x00000004UL)
+#define I2S_SR_TXBF                     (0x00000008UL)
+#define I2S_SR_RXBE                     (0x00000010UL)
+#define I2S_SR_RXBF                     (0x00000020UL)
+#define I2S_ER_TXERR                    (0x00000001UL)
+#define I2S_ER_RXERR                    (0x00000002UL)
+#define I2S_CFGR_I2SSTD_0               (0x00000001UL)
+#define I2S_CFGR_I2SSTD_1               (0x00000002UL)
+#define I2S_CFGR_I2SSTD                 (0x00000003UL)
+#define I2S_CFGR_DATLEN_0               (0x00000004UL)
+#define I2S_CFGR_DATLEN_1               (0x00000008UL)
+#define I2S_CFGR_CHLEN                  (0x00000010UL)
+#define I2S_CFGR_PCMSYNC                (0x00000020UL)
+
+/*******************************************************************************
+ * MAU
+ ******************************************************************************/
+typedef struct {
+    __IO uint32_t CSR;
+    __IO uint32_t DTR0;
+    __IO uint32_t RTR0;
+    __IO uint16_t DTR1;
+    uint8_t RESERVED0[2];
+    __IO uint16_t RTR1;
+    uint8_t RESERVED1[2];
+} CM_MAU_TypeDef;
+
+extern CM_MAU_TypeDef HOST_MAU;
+#define CM_MAU                          (&HOST_MAU)
+
+#define MAU_CSR_START                   (0x00000001UL)
+#define MAU_CSR_INTEN                   (0x00000002UL)
+#define MAU_CSR_INTEN_POS               (1U)
+#define MAU_CSR_BUSY                    (0x00000008UL)
+#define MAU_CSR_SHIFT_POS               (8U)
+#define MAU_CSR_SHIFT                   (0x00001F00UL)
+
+/*******************************************************************************
+ * PWC
+ ******************************************************************************/
+typedef struct {
+    __IO uint32_t FCG0PC;
+    __IO uint16_t FPRC;
+} CM_PWC_TypeDef;
+
+extern CM_PWC_TypeDef HOST_PWC;
+#define CM_PWC                          (&HOST_PWC)
+
+#define PWC_FPRC_FPRCB1                 (0x0002U)
+
+/*******************************************************************************
+ * SMC
+ ******************************************************************************/
+typedef struct {
+    __IO uint32_t STSR;
+    uint8_t RESERVED0[4];
+    __IO uint32_t STCR0;
+    __IO uint32_t STCR1;
+    uint8_t RESERVED1[504];
+    __IO uint32_t CSCR0;
+    __IO uint32_t CSCR1;
+} CM_SMC_TypeDef;
+
+extern CM_SMC_TypeDef HOST_SMC;
+#define CM_SMC                          (&HOST_SMC)
+
+#define SMC_STSR_STATUS                 (0x00000001UL)
+#define SMC_STCR0_LPWIR                 (0x00000004UL)
+#define SMC_STCR1_LPWOR                 (0x00000004UL)
+
+/*******************************************************************************
+ * SRAMC
+ ******************************************************************************/
+typedef struct {
+    __IO uint32_t WTPR;
+    __IO uint32_t CKPR;
+} CM_SRAMC_TypeDef;
+
+extern CM_SRAMC_TypeDef HOST_SRAMC;
+#define CM_SRAMC                        (&HOST_SRAMC)
+
+#endif /* __HC32F4XX_H__ */
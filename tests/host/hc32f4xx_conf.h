@@ -0,0 +1,59 @@
+/**
+ *******************************************************************************
+ * @file  hc32f4xx_conf.h
+ * @brief Driver configuration of the host tests, only the modules under test
+ *        and the drivers they call are enabled.
+ *******************************************************************************
+ */
+#ifndef __HC32F4XX_CONF_H__
+#define __HC32F4XX_CONF_H__
+
+#define LL_PRINT_ENABLE                 (DDL_OFF)
+#define LL_UTILITY_ENABLE               (DDL_ON)
+
+#define LL_ADC_ACQ_ENABLE               (DDL_ON)
+#define LL_ADC_ENABLE                   (DDL_ON)
+#define LL_AOS_ENABLE                   (DDL_ON)
+#define LL_CLK_ENABLE                   (DDL_ON)
+#define LL_CLK_SOLVE_ENABLE             (DDL_ON)
+#define LL_DAC_ENABLE                   (DDL_ON)
+#define LL_DAC_WAVE_ENABLE              (DDL_ON)
+#define LL_DCU_BATCH_ENABLE             (DDL_ON)
+#define LL_DCU_ENABLE                   (DDL_ON)
+#define LL_DMA_ENABLE                   (DDL_ON)
+#define LL_DMC_ENABLE                   (DDL_ON)
+#define LL_DMC_MEM_ENABLE               (DDL_ON)
+#define LL_DVFS_ENABLE                  (DDL_ON)
+#define LL_DVP_ENABLE                   (DDL_ON)
+#define LL_DVP_FRAME_ENABLE             (DDL_ON)
+#define LL_EFM_ENABLE                   (DDL_ON)
+#define LL_FMAC_BLOCK_ENABLE            (DDL_ON)
+#define LL_FMAC_ENABLE                  (DDL_ON)
+#define LL_GPIO_ENABLE                  (DDL_ON)
+#define LL_HRPWM_DUTY_ENABLE            (DDL_ON)
+#define LL_HRPWM_ENABLE                 (DDL_ON)
+#define LL_I2C_ENABLE                   (DDL_ON)
+#define LL_I2C_XFER_ENABLE              (DDL_ON)
+#define LL_I2S_ENABLE                   (DDL_ON)
+#define LL_I2S_STREAM_ENABLE            (DDL_ON)
+#define LL_MAU_BATCH_ENABLE             (DDL_ON)
+#define LL_MAU_ENABLE                   (DDL_ON)
+#define LL_PWC_ENABLE                   (DDL_ON)
+#define LL_SMC_ENABLE                   (DDL_ON)
+#define LL_SMC_LCD_ENABLE               (DDL_ON)
+#define LL_SRAM_ENABLE                  (DDL_ON)
+#define LL_SWTMR_ENABLE                 (DDL_ON)
+#define LL_TICKLESS_ENABLE              (DDL_ON)
+#define LL_TMR0_ENABLE                  (DDL_ON)
+#define LL_TMR4_ENABLE                  (DDL_ON)
+#define LL_TMR4_SVPWM_ENABLE            (DDL_ON)
+#define LL_TMR6_ENABLE                  (DDL_ON)
+#define LL_TMR6_SYNC_ENABLE             (DDL_ON)
+#define LL_TMRA_ENABLE                  (DDL_ON)
+#define LL_TMRA_ENC_ENABLE              (DDL_ON)
+#define LL_TSTAMP_ENABLE                (DDL_ON)
+
+/* The tickless time base replaces the SysTick functions of the utility driver */
+#define TICKLESS_SYSTICK_REPLACE        (DDL_ON)
+
+#endif /* __HC32F4XX_CONF_H__ */
@@ -0,0 +1,37 @@
+/**
+ *******************************************************************************
+ * @file  host.c
+ * @brief Register blocks and core state of the host device stand-in.
+ *******************************************************************************
+ */
+#include "hc32f4xx.h"
+
+uint32_t g_u32HostPrimask;
+void (*g_pfnHostWfi)(void);
+uint32_t g_au32HostNvicEn[8];
+CoreDebug_Type HOST_CoreDebug;
+DWT_Type HOST_DWT;
+SCB_Type HOST_SCB;
+
+CM_ADC_TypeDef HOST_ADC[3];
+CM_AOS_TypeDef HOST_AOS;
+stc_aos_bitband_t HOST_AOS_BB;
+CM_DAC_TypeDef HOST_DAC[2];
+CM_DCU_TypeDef HOST_DCU[8];
+CM_DMA_TypeDef HOST_DMA[2];
+CM_DMC_TypeDef HOST_DMC;
+CM_DVP_TypeDef HOST_DVP;
+CM_EFM_TypeDef HOST_EFM;
+CM_FMAC_TypeDef HOST_FMAC[4];
+CM_GPIO_TypeDef HOST_GPIO;
+CM_I2C_TypeDef HOST_I2C[6];
+CM_I2S_TypeDef HOST_I2S[4];
+CM_MAU_TypeDef HOST_MAU;
+CM_PWC_TypeDef HOST_PWC;
+CM_SMC_TypeDef HOST_SMC;
+CM_SRAMC_TypeDef HOST_SRAMC;
+CM_TMR0_TypeDef HOST_TMR0[2];
+CM_TMR4_TypeDef HOST_TMR4[3];
+CM_TMR6_TypeDef HOST_TMR6[8];
+CM_TMR6_COMMON_TypeDef HOST_TMR6_COMMON;
+CM_TMRA_TypeDef HOST_TMRA[4];
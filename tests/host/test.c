@@ -0,0 +1,42 @@
+/**
+ *******************************************************************************
+ * @file  test.c
+ * @brief Assertion helpers of the host tests.
+ *******************************************************************************
+ */
+#include "test.h"
+
+static uint32_t m_u32FailCount;
+static uint32_t m_u32RandState = 0x12345678UL;
+
+void TEST_Fail(const char *file, int line, const char *expr)
+{
+    if (m_u32FailCount < 20UL) {
+        printf("%s:%d: assertion failed: %s\n", file, line, expr);
+    }
+    m_u32FailCount++;
+}
+
+int TEST_Result(const char *name)
+{
+    printf("%s: %s (%lu failures)\n", name, (0UL == m_u32FailCount) ? "PASS" : "FAIL",
+           (unsigned long)m_u32FailCount);
+    return (0UL == m_u32FailCount) ? 0 : 1;
+}
+
+/* xorshift32, deterministic across hosts */
+uint32_t TEST_Rand(void)
+{
+    uint32_t x = m_u32RandState;
+
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    m_u32RandState = x;
+    return x;
+}
+
+void TEST_Seed(uint32_t u32Seed)
+{
+    m_u32RandState = (0UL != u32Seed) ? u32Seed : 1UL;
+}
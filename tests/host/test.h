@@ -0,0 +1,27 @@
+/**
+ *******************************************************************************
+ * @file  test.h
+ * @brief Minimal assertion helpers of the host tests.
+ *******************************************************************************
+ */
+#ifndef __TEST_H__
+#define __TEST_H__
+
+#include <stdint.h>
+#include <stdio.h>
+
+#define TEST_ASSERT(x)                                                         \
+do {                                                                           \
+    if (!(x)) {                                                                \
+        TEST_Fail(__FILE__, __LINE__, #x);                                     \
+    }                                                                          \
+} while (0)
+
+#define TEST_ASSERT_EQ(x, y)            TEST_ASSERT((x) == (y))
+
+void TEST_Fail(const char *file, int line, const char *expr);
+int TEST_Result(const char *name);
+uint32_t TEST_Rand(void);
+void TEST_Seed(uint32_t u32Seed);
+
+#endif /* __TEST_H__ */
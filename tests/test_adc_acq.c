@@ -0,0 +1,315 @@
+/**
+ *******************************************************************************
+ * @file  test_adc_acq.c
+ * @brief ADC acquisition ring against the ADC and DMA models: trigger
+ *        validation, frame interleave with unconverted channels, blocks
+ *        reported late, and the CIC decimator against a direct-form
+ *        reference.
+ *******************************************************************************
+ */
+#include <string.h>
+#include "test.h"
+#include "fake_adc.h"
+#include "fake_dma.h"
+#include "hc32_ll_adc_acq.h"
+
+#define BLOCK_NUM                       (4U)
+#define BLOCK_FRAMES                    (8U)
+#define FRAME_WIDTH                     (4U)        /* Channels 2 to 5, channel 4 not converted */
+#define FIRST_CH                        (2U)
+#define FRAME_NUM                       (100UL)
+
+#define CIC_IN_MAX                      (512UL)
+
+static stc_adc_acq_t m_stcAcq;
+static uint16_t m_au16Ring[BLOCK_NUM * BLOCK_FRAMES * FRAME_WIDTH];
+static stc_dma_llp_descriptor_t m_astcDesc[BLOCK_NUM];
+static uint16_t m_au16Decim[((BLOCK_FRAMES / 2U) + 1U) * FRAME_WIDTH];
+static stc_adc_acq_cic_t m_stcCic;
+
+static uint32_t m_u32BlockNum;
+static uint32_t m_u32FrameNum;
+static uint16_t m_au16Seen[FRAME_NUM][FRAME_WIDTH];
+
+static uint16_t Sample(uint32_t u32Frame, uint32_t u32Ch)
+{
+    return (uint16_t)(((u32Frame * 7UL) + (u32Ch * 1000UL)) & 0xFFFUL);
+}
+
+static void DmaIrq(void)
+{
+    ADC_ACQ_DmaIrqHandler(&m_stcAcq);
+}
+
+static void BlockCb(stc_adc_acq_t *pstcAcq, const uint16_t *pu16Frame, uint32_t u32FrameNum, void *pvArg)
+{
+    uint32_t i;
+
+    TEST_ASSERT(pstcAcq == &m_stcAcq);
+    TEST_ASSERT(pvArg == &m_u32BlockNum);
+    for (i = 0UL; (i < u32FrameNum) && (m_u32FrameNum < FRAME_NUM); i++) {
+        (void)memcpy(m_au16Seen[m_u32FrameNum], &pu16Frame[i * FRAME_WIDTH], sizeof(m_au16Seen[0]));
+        m_u32FrameNum++;
+    }
+    m_u32BlockNum++;
+}
+
+static void InitDefault(stc_adc_acq_init_t *pstcInit)
+{
+    TEST_ASSERT_EQ(LL_OK, ADC_ACQ_StructInit(pstcInit));
+    pstcInit->u32SeqAMxCh      = ADC_MX_CH2 | ADC_MX_CH3 | ADC_MX_CH5;
+    pstcInit->pstcDmaUnit      = CM_DMA1;
+    pstcInit->u8DmaCh          = DMA_CH3;
+    pstcInit->u32DmaTrigTarget = AOS_DMA1_3;
+    pstcInit->pu16Ring         = m_au16Ring;
+    pstcInit->pstcDesc         = m_astcDesc;
+    pstcInit->u16BlockNum      = BLOCK_NUM;
+    pstcInit->u16BlockFrames   = BLOCK_FRAMES;
+    pstcInit->pfnCallback      = &BlockCb;
+    pstcInit->pvArg            = &m_u32BlockNum;
+}
+
+static void Setup(void)
+{
+    FAKE_ADC_Reset();
+    FAKE_DMA_Reset();
+    FAKE_DMA_SetIrq(CM_DMA1, DMA_CH3, &DmaIrq);
+    (void)memset(m_au16Ring, 0, sizeof(m_au16Ring));
+    (void)memset(m_au16Seen, 0, sizeof(m_au16Seen));
+    m_u32BlockNum = 0UL;
+    m_u32FrameNum = 0UL;
+}
+
+static void Convert(uint32_t u32Frame)
+{
+    uint16_t au16Val[ADC_ACQ_CH_MAX];
+    uint32_t i;
+
+    for (i = 0UL; i < ADC_ACQ_CH_MAX; i++) {
+        au16Val[i] = Sample(u32Frame, i);
+    }
+    FAKE_ADC_Convert(CM_ADC1, au16Val);
+}
+
+static void CheckFrames(uint32_t u32FrameNum)
+{
+    uint32_t f;
+
+    TEST_ASSERT_EQ(u32FrameNum, m_u32FrameNum);
+    for (f = 0UL; f < u32FrameNum; f++) {
+        TEST_ASSERT_EQ(Sample(f, 2UL), m_au16Seen[f][0]);
+        TEST_ASSERT_EQ(Sample(f, 3UL), m_au16Seen[f][1]);
+        /* Slot of the channel not converted */
+        TEST_ASSERT_EQ(0U, m_au16Seen[f][2]);
+        TEST_ASSERT_EQ(Sample(f, 5UL), m_au16Seen[f][3]);
+    }
+}
+
+static void TestTriggerDefaults(void)
+{
+    stc_adc_acq_init_t stcInit;
+
+    Setup();
+    TEST_ASSERT_EQ(LL_OK, ADC_ACQ_StructInit(&stcInit));
+    TEST_ASSERT_EQ(AOS_DMA1_0, stcInit.u32DmaTrigTarget);
+    TEST_ASSERT_EQ(EVT_SRC_ADC1_EOCA, stcInit.enEocaEvtSrc);
+    TEST_ASSERT_EQ(DMA_CH0, stcInit.u8DmaCh);
+
+    /* The defaults are a consistent pair */
+    InitDefault(&stcInit);
+    stcInit.u8DmaCh = DMA_CH0;
+    stcInit.u32DmaTrigTarget = AOS_DMA1_0;
+    TEST_ASSERT_EQ(LL_OK, ADC_ACQ_Init(&m_stcAcq, CM_ADC1, &stcInit));
+    TEST_ASSERT_EQ((uint32_t)EVT_SRC_ADC1_EOCA, HOST_AOS.DMA1_TRGSEL0);
+
+    /* Target of another channel */
+    InitDefault(&stcInit);
+    stcInit.u32DmaTrigTarget = AOS_DMA1_2;
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, ADC_ACQ_Init(&m_stcAcq, CM_ADC1, &stcInit));
+    /* Target of the other DMA unit */
+    InitDefault(&stcInit);
+    stcInit.u32DmaTrigTarget = AOS_DMA2_3;
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, ADC_ACQ_Init(&m_stcAcq, CM_ADC1, &stcInit));
+    /* Event of another ADC unit */
+    InitDefault(&stcInit);
+    stcInit.enEocaEvtSrc = EVT_SRC_ADC2_EOCA;
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, ADC_ACQ_Init(&m_stcAcq, CM_ADC1, &stcInit));
+    TEST_ASSERT_EQ(0UL, HOST_AOS.DMA1_TRGSEL3);
+    /* Unit 2 with its own event */
+    TEST_ASSERT_EQ(LL_OK, ADC_ACQ_Init(&m_stcAcq, CM_ADC2, &stcInit));
+    TEST_ASSERT_EQ((uint32_t)EVT_SRC_ADC2_EOCA, HOST_AOS.DMA1_TRGSEL3);
+}
+
+static void TestInterleave(void)
+{
+    stc_adc_acq_init_t stcInit;
+    uint32_t f;
+
+    Setup();
+    InitDefault(&stcInit);
+    TEST_ASSERT_EQ(LL_OK, ADC_ACQ_Init(&m_stcAcq, CM_ADC1, &stcInit));
+    TEST_ASSERT_EQ(ADC_MX_CH2 | ADC_MX_CH3 | ADC_MX_CH5, FAKE_ADC_GetSeqAMxCh(CM_ADC1));
+    TEST_ASSERT_EQ(LL_OK, ADC_ACQ_Start(&m_stcAcq));
+    TEST_ASSERT_EQ(ENABLE, FAKE_ADC_GetRunState(CM_ADC1));
+
+    for (f = 0UL; f < FRAME_NUM; f++) {
+        Convert(f);
+    }
+    /* The ring wrapped three times, every completed block reported once and in order */
+    TEST_ASSERT_EQ(FRAME_NUM / BLOCK_FRAMES, m_u32BlockNum);
+    TEST_ASSERT_EQ(m_u32BlockNum, m_stcAcq.u32BlockCount);
+    CheckFrames((FRAME_NUM / BLOCK_FRAMES) * BLOCK_FRAMES);
+
+    ADC_ACQ_Stop(&m_stcAcq);
+    TEST_ASSERT_EQ(DISABLE, FAKE_ADC_GetRunState(CM_ADC1));
+    TEST_ASSERT_EQ(DISABLE, FAKE_DMA_GetChState(CM_DMA1, DMA_CH3));
+}
+
+static void TestLateIrq(void)
+{
+    stc_adc_acq_init_t stcInit;
+    uint32_t f;
+
+    Setup();
+    InitDefault(&stcInit);
+    TEST_ASSERT_EQ(LL_OK, ADC_ACQ_Init(&m_stcAcq, CM_ADC1, &stcInit));
+    TEST_ASSERT_EQ(LL_OK, ADC_ACQ_Start(&m_stcAcq));
+
+    /* Three blocks complete while the interrupt is masked */
+    __disable_irq();
+    for (f = 0UL; f < ((3UL * BLOCK_FRAMES) + 2UL); f++) {
+        Convert(f);
+    }
+    TEST_ASSERT_EQ(0UL, m_u32BlockNum);
+    __enable_irq();
+    DmaIrq();
+    TEST_ASSERT_EQ(3UL, m_u32BlockNum);
+    CheckFrames(3UL * BLOCK_FRAMES);
+    /* The flag was consumed */
+    DmaIrq();
+    TEST_ASSERT_EQ(3UL, m_u32BlockNum);
+
+    for (; f < FRAME_NUM; f++) {
+        Convert(f);
+    }
+    CheckFrames((FRAME_NUM / BLOCK_FRAMES) * BLOCK_FRAMES);
+    ADC_ACQ_Stop(&m_stcAcq);
+}
+
+static void TestCicAcq(void)
+{
+    stc_adc_acq_init_t stcInit;
+    uint16_t au16Val[ADC_ACQ_CH_MAX];
+    uint32_t f;
+
+    /* DC input through a power of 2 ratio settles to the input exactly */
+    Setup();
+    TEST_ASSERT_EQ(LL_OK, ADC_ACQ_CicInit(&m_stcCic, 3U, 2U, FRAME_WIDTH));
+    InitDefault(&stcInit);
+    stcInit.pstcCic      = &m_stcCic;
+    stcInit.pu16DecimBuf = m_au16Decim;
+    TEST_ASSERT_EQ(LL_OK, ADC_ACQ_Init(&m_stcAcq, CM_ADC1, &stcInit));
+    TEST_ASSERT_EQ(LL_OK, ADC_ACQ_Start(&m_stcAcq));
+    for (f = 0UL; f < ADC_ACQ_CH_MAX; f++) {
+        au16Val[f] = (uint16_t)(100UL * f);
+    }
+    for (f = 0UL; f < (4UL * BLOCK_FRAMES); f++) {
+        FAKE_ADC_Convert(CM_ADC1, au16Val);
+    }
+    TEST_ASSERT_EQ(4UL, m_u32BlockNum);
+    TEST_ASSERT_EQ(4UL * BLOCK_FRAMES / 2UL, m_u32FrameNum);
+    for (f = 3UL; f < m_u32FrameNum; f++) {
+        TEST_ASSERT_EQ(200U, m_au16Seen[f][0]);
+        TEST_ASSERT_EQ(300U, m_au16Seen[f][1]);
+        TEST_ASSERT_EQ(500U, m_au16Seen[f][3]);
+    }
+    ADC_ACQ_Stop(&m_stcAcq);
+}
+
+/* Direct form: N cascaded boxcars of R taps, sampled every R inputs */
+static uint32_t CicReference(const uint16_t *pu16In, uint32_t u32Width, uint32_t u32Ch, uint32_t u32N,
+                             uint32_t u32Order, uint32_t u32Decim, uint32_t u32Shift)
+{
+    static uint64_t au64H[(4UL * 16UL) + 1UL];
+    uint32_t u32Len = 1UL;
+    uint64_t u64Sum = 0ULL;
+    uint32_t i;
+    uint32_t k;
+    uint32_t j;
+
+    (void)memset(au64H, 0, sizeof(au64H));
+    au64H[0] = 1ULL;
+    for (i = 0UL; i < u32Order; i++) {
+        /* Convolve with a boxcar of u32Decim taps */
+        for (k = u32Len + u32Decim - 1UL; k-- > 0UL;) {
+            uint64_t u64Acc = 0ULL;
+
+            for (j = 0UL; (j < u32Decim) && (j <= k); j++) {
+                if ((k - j) < u32Len) {
+                    u64Acc += au64H[k - j];
+                }
+            }
+            au64H[k] = u64Acc;
+        }
+        u32Len += u32Decim - 1UL;
+    }
+    for (k = 0UL; (k < u32Len) && (k <= u32N); k++) {
+        u64Sum += au64H[k] * pu16In[((u32N - k) * u32Width) + u32Ch];
+    }
+    return (uint32_t)(u64Sum >> u32Shift);
+}
+
+static void TestCicMath(void)
+{
+    static const uint8_t au8Order[] = {1U, 2U, 3U, 4U, 4U, 2U};
+    static const uint16_t au16Decim[] = {2U, 4U, 5U, 8U, 16U, 16U};
+    static uint16_t au16In[CIC_IN_MAX * 2UL];
+    static uint16_t au16Out[((CIC_IN_MAX / 2UL) + 1UL) * 2UL];
+    uint32_t u32Shift;
+    uint32_t u32OutNum;
+    uint32_t u32Total;
+    uint32_t u32Chunk;
+    uint32_t t;
+    uint32_t i;
+    uint32_t m;
+
+    TEST_Seed(0xC1CUL);
+    for (t = 0UL; t < sizeof(au8Order); t++) {
+        for (i = 0UL; i < (CIC_IN_MAX * 2UL); i++) {
+            au16In[i] = (uint16_t)TEST_Rand();
+        }
+        TEST_ASSERT_EQ(LL_OK, ADC_ACQ_CicInit(&m_stcCic, au8Order[t], au16Decim[t], 2U));
+        u32Shift = m_stcCic.u8Shift;
+        /* Fed in uneven chunks, the phase carries over */
+        u32Total = 0UL;
+        i = 0UL;
+        while (i < CIC_IN_MAX) {
+            u32Chunk = 1UL + (TEST_Rand() % 37UL);
+            u32Chunk = LL_MIN(u32Chunk, CIC_IN_MAX - i);
+            u32OutNum = ADC_ACQ_CicProcess(&m_stcCic, &au16In[i * 2UL], u32Chunk, &au16Out[u32Total * 2UL]);
+            u32Total += u32OutNum;
+            i += u32Chunk;
+        }
+        TEST_ASSERT_EQ(CIC_IN_MAX / au16Decim[t], u32Total);
+        for (m = 0UL; m < u32Total; m++) {
+            const uint32_t u32N = ((m + 1UL) * au16Decim[t]) - 1UL;
+
+            TEST_ASSERT_EQ(CicReference(au16In, 2UL, 0UL, u32N, au8Order[t], au16Decim[t], u32Shift), au16Out[m * 2UL]);
+            TEST_ASSERT_EQ(CicReference(au16In, 2UL, 1UL, u32N, au8Order[t], au16Decim[t], u32Shift),
+                           au16Out[(m * 2UL) + 1UL]);
+        }
+    }
+    /* Gain beyond the 32-bit states */
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, ADC_ACQ_CicInit(&m_stcCic, 4U, 32U, 2U));
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, ADC_ACQ_CicInit(&m_stcCic, 1U, 1U, 2U));
+}
+
+int main(void)
+{
+    TestTriggerDefaults();
+    TestInterleave();
+    TestLateIrq();
+    TestCicAcq();
+    TestCicMath();
+    return TEST_Result("adc_acq");
+}
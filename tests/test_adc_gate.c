@@ -0,0 +1,219 @@
+/**
+ *******************************************************************************
+ * @file  test_adc_gate.c
+ * @brief Analog watchdog gated capture against the ADC and DMA models: the
+ *        snapshot holds the frames around each event, events during a capture
+ *        are ignored and a combined window needs both watchdogs.
+ *******************************************************************************
+ */
+#include <string.h>
+#include "test.h"
+#include "fake_adc.h"
+#include "fake_dma.h"
+#include "hc32_ll_adc_acq.h"
+
+#define BLOCK_NUM                       (4U)
+#define BLOCK_FRAMES                    (8U)
+#define FRAME_WIDTH                     (2U)        /* Channels 6 and 7 */
+#define PRE_FRAMES                      (5U)
+#define POST_FRAMES                     (6U)
+#define EVENT_MAX                       (4U)
+
+#define LEVEL_NORMAL                    (1000U)
+#define LEVEL_HIGH                      (3500U)
+
+static stc_adc_acq_t m_stcAcq;
+static uint16_t m_au16Ring[BLOCK_NUM * BLOCK_FRAMES * FRAME_WIDTH];
+static stc_dma_llp_descriptor_t m_astcDesc[BLOCK_NUM];
+static uint16_t m_au16Snapshot[(PRE_FRAMES + POST_FRAMES) * FRAME_WIDTH];
+static stc_adc_acq_gate_t m_stcGate;
+
+static uint32_t m_u32BlockNum;
+static uint32_t m_u32CaptureNum;
+static uint32_t m_au32Flags[EVENT_MAX];
+static uint16_t m_au16Capture[EVENT_MAX][(PRE_FRAMES + POST_FRAMES) * FRAME_WIDTH];
+static uint16_t m_au16Ch6[256];
+static uint16_t m_au16Ch7[256];
+
+static void DmaIrq(void)
+{
+    ADC_ACQ_DmaIrqHandler(&m_stcAcq);
+}
+
+static void AwdIrq(void)
+{
+    ADC_ACQ_AwdIrqHandler(&m_stcAcq);
+}
+
+static void BlockCb(stc_adc_acq_t *pstcAcq, const uint16_t *pu16Frame, uint32_t u32FrameNum, void *pvArg)
+{
+    m_u32BlockNum++;
+}
+
+static void CaptureCb(stc_adc_acq_t *pstcAcq, const uint16_t *pu16Frame, uint32_t u32FrameNum, void *pvArg)
+{
+    TEST_ASSERT(pvArg == &m_stcGate);
+    TEST_ASSERT_EQ(PRE_FRAMES + POST_FRAMES, u32FrameNum);
+    if (m_u32CaptureNum < EVENT_MAX) {
+        m_au32Flags[m_u32CaptureNum] = ADC_ACQ_GetGateFlags(pstcAcq);
+        (void)memcpy(m_au16Capture[m_u32CaptureNum], pu16Frame, sizeof(m_au16Capture[0]));
+    }
+    m_u32CaptureNum++;
+}
+
+static void Setup(uint16_t u16CombMode)
+{
+    stc_adc_acq_init_t stcInit;
+    uint32_t i;
+
+    FAKE_ADC_Reset();
+    FAKE_DMA_Reset();
+    FAKE_DMA_SetIrq(CM_DMA2, DMA_CH1, &DmaIrq);
+    FAKE_ADC_SetAwdIrq(CM_ADC2, &AwdIrq);
+    m_u32BlockNum = 0UL;
+    m_u32CaptureNum = 0UL;
+    for (i = 0UL; i < 256UL; i++) {
+        /* Ramps, so a frame is identified by its values */
+        m_au16Ch6[i] = (uint16_t)(LEVEL_NORMAL + i);
+        m_au16Ch7[i] = (uint16_t)(LEVEL_NORMAL - i);
+    }
+
+    (void)ADC_ACQ_StructInit(&stcInit);
+    stcInit.u32SeqAMxCh      = ADC_MX_CH6 | ADC_MX_CH7;
+    stcInit.pstcDmaUnit      = CM_DMA2;
+    stcInit.u8DmaCh          = DMA_CH1;
+    stcInit.u32DmaTrigTarget = AOS_DMA2_1;
+    stcInit.enEocaEvtSrc     = EVT_SRC_ADC2_EOCA;
+    stcInit.pu16Ring         = m_au16Ring;
+    stcInit.pstcDesc         = m_astcDesc;
+    stcInit.u16BlockNum      = BLOCK_NUM;
+    stcInit.u16BlockFrames   = BLOCK_FRAMES;
+    stcInit.pfnCallback      = &BlockCb;
+    TEST_ASSERT_EQ(LL_OK, ADC_ACQ_Init(&m_stcAcq, CM_ADC2, &stcInit));
+
+    (void)memset(&m_stcGate, 0, sizeof(m_stcGate));
+    m_stcGate.u8Awd0Ch                       = ADC_CH6;
+    m_stcGate.stcAwd0.u16WatchdogMode        = ADC_AWD_MD_CMP_OUT;
+    m_stcGate.stcAwd0.u16LowThreshold        = 500U;
+    m_stcGate.stcAwd0.u16HighThreshold       = 3000U;
+    m_stcGate.u8Awd1Ch                       = ADC_ACQ_AWD_CH_NONE;
+    m_stcGate.u16CombMode                    = u16CombMode;
+    if (ADC_AWD_COMB_INVD != u16CombMode) {
+        m_stcGate.u8Awd1Ch                   = ADC_CH7;
+        m_stcGate.stcAwd1.u16WatchdogMode    = ADC_AWD_MD_CMP_IN;
+        m_stcGate.stcAwd1.u16LowThreshold    = 0U;
+        m_stcGate.stcAwd1.u16HighThreshold   = 800U;
+    }
+    m_stcGate.u16PreFrames                   = PRE_FRAMES;
+    m_stcGate.u16PostFrames                  = POST_FRAMES;
+    m_stcGate.pu16Snapshot                   = m_au16Snapshot;
+    m_stcGate.pfnCallback                    = &CaptureCb;
+    m_stcGate.pvArg                          = &m_stcGate;
+    TEST_ASSERT_EQ(LL_OK, ADC_ACQ_GateConfig(&m_stcAcq, &m_stcGate));
+    TEST_ASSERT_EQ(LL_OK, ADC_ACQ_Start(&m_stcAcq));
+}
+
+static void Run(uint32_t u32FrameNum)
+{
+    uint16_t au16Val[ADC_ACQ_CH_MAX] = {0U};
+    uint32_t f;
+
+    for (f = 0UL; f < u32FrameNum; f++) {
+        au16Val[ADC_CH6] = m_au16Ch6[f];
+        au16Val[ADC_CH7] = m_au16Ch7[f];
+        FAKE_ADC_Convert(CM_ADC2, au16Val);
+    }
+}
+
+static void CheckCapture(uint32_t u32Capture, uint32_t u32EventFrame)
+{
+    uint32_t i;
+    const uint32_t u32First = u32EventFrame - PRE_FRAMES;
+
+    for (i = 0UL; i < (PRE_FRAMES + POST_FRAMES); i++) {
+        TEST_ASSERT_EQ(m_au16Ch6[u32First + i], m_au16Capture[u32Capture][i * FRAME_WIDTH]);
+        TEST_ASSERT_EQ(m_au16Ch7[u32First + i], m_au16Capture[u32Capture][(i * FRAME_WIDTH) + 1UL]);
+    }
+}
+
+static void TestConfig(void)
+{
+    Setup(ADC_AWD_COMB_INVD);
+    /* The ring is too short for the windows and a block */
+    m_stcGate.u16PreFrames = (BLOCK_NUM * BLOCK_FRAMES) - POST_FRAMES - BLOCK_FRAMES + 1U;
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, ADC_ACQ_GateConfig(&m_stcAcq, &m_stcGate));
+    m_stcGate.u16PreFrames = PRE_FRAMES;
+    m_stcGate.u16PostFrames = 0U;
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, ADC_ACQ_GateConfig(&m_stcAcq, &m_stcGate));
+    m_stcGate.u16PostFrames = POST_FRAMES;
+    /* A combination needs both units */
+    m_stcGate.u16CombMode = ADC_AWD_COMB_AND;
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, ADC_ACQ_GateConfig(&m_stcAcq, &m_stcGate));
+    m_stcGate.u16CombMode = ADC_AWD_COMB_INVD;
+    TEST_ASSERT_EQ(LL_OK, ADC_ACQ_GateConfig(&m_stcAcq, &m_stcGate));
+    /* Ungated again */
+    TEST_ASSERT_EQ(LL_OK, ADC_ACQ_GateConfig(&m_stcAcq, NULL));
+    Run(4UL * BLOCK_FRAMES);
+    TEST_ASSERT_EQ(4UL, m_u32BlockNum);
+    TEST_ASSERT_EQ(0UL, m_u32CaptureNum);
+    ADC_ACQ_Stop(&m_stcAcq);
+}
+
+static void TestSingle(void)
+{
+    Setup(ADC_AWD_COMB_INVD);
+    m_au16Ch6[40] = LEVEL_HIGH;
+    /* Inside the post window of the first event, ignored */
+    m_au16Ch6[43] = LEVEL_HIGH;
+    m_au16Ch6[100] = LEVEL_HIGH;
+    m_au16Ch6[101] = LEVEL_HIGH;
+    Run(200UL);
+    TEST_ASSERT_EQ(0UL, m_u32BlockNum);
+    TEST_ASSERT_EQ(2UL, m_u32CaptureNum);
+    TEST_ASSERT_EQ(2UL, m_stcAcq.u32EventCount);
+    TEST_ASSERT_EQ(ADC_AWD_FLAG_AWD0, m_au32Flags[0]);
+    CheckCapture(0UL, 40UL);
+    CheckCapture(1UL, 100UL);
+    ADC_ACQ_Stop(&m_stcAcq);
+}
+
+static void TestWrap(void)
+{
+    uint32_t u32Event;
+
+    /* Events at every position of the ring, the windows wrap around it */
+    for (u32Event = PRE_FRAMES; u32Event < (PRE_FRAMES + (BLOCK_NUM * BLOCK_FRAMES)); u32Event++) {
+        Setup(ADC_AWD_COMB_INVD);
+        m_au16Ch6[u32Event] = LEVEL_HIGH;
+        Run(u32Event + POST_FRAMES + BLOCK_FRAMES);
+        TEST_ASSERT_EQ(1UL, m_u32CaptureNum);
+        CheckCapture(0UL, u32Event);
+        ADC_ACQ_Stop(&m_stcAcq);
+    }
+}
+
+static void TestComb(void)
+{
+    Setup(ADC_AWD_COMB_AND);
+    /* AWD0 alone */
+    m_au16Ch6[30] = LEVEL_HIGH;
+    /* Both, channel 7 is in its window from frame 200 on */
+    m_au16Ch6[60] = LEVEL_HIGH;
+    m_au16Ch7[60] = 700U;
+    /* AWD1 alone */
+    m_au16Ch7[90] = 700U;
+    Run(150UL);
+    TEST_ASSERT_EQ(1UL, m_u32CaptureNum);
+    TEST_ASSERT_EQ(ADC_AWD_FLAG_AWD0 | ADC_AWD_FLAG_AWD1 | ADC_AWD_FLAG_COMB, m_au32Flags[0]);
+    CheckCapture(0UL, 60UL);
+    ADC_ACQ_Stop(&m_stcAcq);
+}
+
+int main(void)
+{
+    TestConfig();
+    TestSingle();
+    TestWrap();
+    TestComb();
+    return TEST_Result("adc_gate");
+}
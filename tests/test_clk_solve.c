@@ -0,0 +1,396 @@
+/**
+ *******************************************************************************
+ * @file  test_clk_solve.c
+ * @brief Clock tree solver: the PLLH and PLLA settings of random targets
+ *        against an exhaustive search of every M, N and output divider
+ *        within the limits checked by the CLK driver, the bus dividers and
+ *        EFM wait cycles of CLK_SOLVE_Config(), their order against the
+ *        switch to PLLH in CLK_SOLVE_Apply(), and a benchmark of a PLLH
+ *        solution.
+ *******************************************************************************
+ */
+#define _GNU_SOURCE
+#include <string.h>
+#include <time.h>
+#include "test.h"
+#include "fake_clk.h"
+#include "hc32_ll_clk_solve.h"
+
+#define MHZ                             (1000000UL)
+#define PPB                             (1000000000ULL)
+#define BENCH_OPS                       (200UL)
+
+/* Limits of the CLK driver, see CLK_PLLInit() and CLK_PLLxInit() */
+typedef struct {
+    uint32_t u32MMax;
+    uint32_t u32NMin;
+    uint32_t u32NMax;
+    uint32_t u32VcoInMin;
+    uint32_t u32VcoInMax;
+    uint32_t u32VcoOutMin;
+    uint32_t u32VcoOutMax;
+    uint32_t u32FreqMin;
+    uint32_t u32FreqMax;
+} stc_limit_t;
+
+static const stc_limit_t m_stcPllLimit = {
+    4UL, 25UL, 150UL, 8UL * MHZ, 25UL * MHZ, 600UL * MHZ, 1200UL * MHZ, 37500000UL, 240UL * MHZ
+};
+static const stc_limit_t m_stcPllxLimit = {
+    25UL, 20UL, 480UL, 1UL * MHZ, 25UL * MHZ, 240UL * MHZ, 480UL * MHZ, 15UL * MHZ, 240UL * MHZ
+};
+
+typedef struct {
+    uint32_t u32M;
+    uint32_t u32N;
+    uint64_t au64Err[3];
+    uint64_t u64Worst;
+} stc_ref_t;
+
+static double NowNs(void)
+{
+    struct timespec stcTs;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &stcTs);
+    return ((double)stcTs.tv_sec * 1e9) + (double)stcTs.tv_nsec;
+}
+
+static uint64_t ErrPpb(uint32_t u32In, uint32_t u32M, uint32_t u32N, uint32_t u32Div, uint32_t u32Target)
+{
+    const uint64_t u64Num = (uint64_t)u32In * u32N;
+    const uint64_t u64Want = (uint64_t)u32Target * u32M * u32Div;
+    const uint64_t u64Diff = (u64Num > u64Want) ? (u64Num - u64Want) : (u64Want - u64Num);
+
+    /* From 10 % on the product may overflow, no tolerance of the test reaches it */
+    return ((u64Diff * 10ULL) >= u64Want) ? UINT64_MAX : ((u64Diff * PPB) / u64Want);
+}
+
+/* Every legal setting: the smallest largest error, then the smallest M, then the smallest N */
+static int32_t Reference(const stc_clk_solve_target_t *pstcTarget, const stc_limit_t *pstcLimit, stc_ref_t *pstcRef)
+{
+    const uint32_t au32Target[3] = {pstcTarget->u32PFreq, pstcTarget->u32QFreq, pstcTarget->u32RFreq};
+    const uint64_t u64Tol = (uint64_t)pstcTarget->u32Tol * 1000ULL;
+    uint64_t au64Err[3];
+    uint64_t u64Worst;
+    uint64_t u64Err;
+    uint32_t u32VcoIn;
+    uint32_t u32VcoOut;
+    uint32_t u32Freq;
+    uint32_t u32M;
+    uint32_t u32N;
+    uint32_t u32Div;
+    uint32_t i;
+    int32_t i32Ret = LL_ERR;
+
+    for (u32M = 1UL; u32M <= pstcLimit->u32MMax; u32M++) {
+        u32VcoIn = pstcTarget->u32InFreq / u32M;
+        if ((u32VcoIn < pstcLimit->u32VcoInMin) || (u32VcoIn > pstcLimit->u32VcoInMax)) {
+            continue;
+        }
+        for (u32N = pstcLimit->u32NMin; u32N <= pstcLimit->u32NMax; u32N++) {
+            if (((uint64_t)u32VcoIn * u32N) > pstcLimit->u32VcoOutMax) {
+                continue;
+            }
+            u32VcoOut = u32VcoIn * u32N;
+            if (u32VcoOut < pstcLimit->u32VcoOutMin) {
+                continue;
+            }
+            u64Worst = 0ULL;
+            for (i = 0UL; i < 3UL; i++) {
+                au64Err[i] = UINT64_MAX;
+                for (u32Div = 2UL; u32Div <= 16UL; u32Div++) {
+                    u32Freq = u32VcoOut / u32Div;
+                    if ((u32Freq < pstcLimit->u32FreqMin) || (u32Freq > pstcLimit->u32FreqMax)) {
+                        continue;
+                    }
+                    u64Err = (0UL == au32Target[i]) ? 0ULL :
+                             ErrPpb(pstcTarget->u32InFreq, u32M, u32N, u32Div, au32Target[i]);
+                    au64Err[i] = (u64Err < au64Err[i]) ? u64Err : au64Err[i];
+                }
+                u64Worst = (au64Err[i] > u64Worst) ? au64Err[i] : u64Worst;
+            }
+            if ((u64Worst <= u64Tol) && ((LL_OK != i32Ret) || (u64Worst < pstcRef->u64Worst))) {
+                pstcRef->u32M = u32M;
+                pstcRef->u32N = u32N;
+                pstcRef->au64Err[0] = au64Err[0];
+                pstcRef->au64Err[1] = au64Err[1];
+                pstcRef->au64Err[2] = au64Err[2];
+                pstcRef->u64Worst = u64Worst;
+                i32Ret = LL_OK;
+            }
+        }
+    }
+    return i32Ret;
+}
+
+/* A found setting is the reference one, legal, with the reported outputs */
+static void Check(const stc_clk_solve_target_t *pstcTarget, const stc_limit_t *pstcLimit, const stc_ref_t *pstcRef,
+                  uint32_t u32M, uint32_t u32N, const uint32_t *pu32Div, const stc_clk_solve_result_t *pstcResult)
+{
+    const uint32_t au32Target[3] = {pstcTarget->u32PFreq, pstcTarget->u32QFreq, pstcTarget->u32RFreq};
+    const uint32_t au32Out[3] = {pstcResult->u32PFreq, pstcResult->u32QFreq, pstcResult->u32RFreq};
+    const uint64_t u64Num = (uint64_t)pstcTarget->u32InFreq * u32N;
+    const uint32_t u32VcoOut = (pstcTarget->u32InFreq / u32M) * u32N;
+    uint32_t u32Lowest;
+    uint32_t u32Freq;
+    uint32_t u32Div;
+    uint32_t i;
+
+    TEST_ASSERT_EQ(pstcRef->u32M, u32M);
+    TEST_ASSERT_EQ(pstcRef->u32N, u32N);
+    TEST_ASSERT_EQ((uint32_t)((pstcRef->u64Worst + 999ULL) / 1000ULL), pstcResult->u32Err);
+    TEST_ASSERT_EQ(pstcTarget->u32InFreq / u32M, pstcResult->u32VcoIn);
+    TEST_ASSERT_EQ((uint32_t)(u64Num / u32M), pstcResult->u32VcoOut);
+    for (i = 0UL; i < 3UL; i++) {
+        TEST_ASSERT((pu32Div[i] >= 2UL) && (pu32Div[i] <= 16UL));
+        u32Freq = u32VcoOut / pu32Div[i];
+        TEST_ASSERT((u32Freq >= pstcLimit->u32FreqMin) && (u32Freq <= pstcLimit->u32FreqMax));
+        TEST_ASSERT_EQ((uint32_t)(u64Num / ((uint64_t)u32M * pu32Div[i])), au32Out[i]);
+        if (0UL != au32Target[i]) {
+            TEST_ASSERT_EQ(pstcRef->au64Err[i], ErrPpb(pstcTarget->u32InFreq, u32M, u32N, pu32Div[i], au32Target[i]));
+        } else {
+            u32Lowest = UINT32_MAX;
+            for (u32Div = 2UL; u32Div <= 16UL; u32Div++) {
+                if (((u32VcoOut / u32Div) >= pstcLimit->u32FreqMin) && ((u32VcoOut / u32Div) < u32Lowest)) {
+                    u32Lowest = u32VcoOut / u32Div;
+                }
+            }
+            TEST_ASSERT_EQ(u32Lowest, u32Freq);
+        }
+    }
+}
+
+static uint32_t RandFreq(uint32_t u32Min, uint32_t u32Max)
+{
+    uint32_t u32Freq = u32Min + (TEST_Rand() % (u32Max - u32Min + 1UL));
+
+    /* Mostly round frequencies, which have exact solutions */
+    switch (TEST_Rand() % 4UL) {
+        case 0UL:
+            u32Freq -= u32Freq % MHZ;
+            break;
+        case 1UL:
+            u32Freq -= u32Freq % (MHZ / 4UL);
+            break;
+        case 2UL:
+            u32Freq -= u32Freq % 1000UL;
+            break;
+        default:
+            break;
+    }
+    return (u32Freq < u32Min) ? u32Min : u32Freq;
+}
+
+static void RandTarget(stc_clk_solve_target_t *pstcTarget, const stc_limit_t *pstcLimit)
+{
+    static const uint32_t au32Xtal[] = {4UL * MHZ, 8UL * MHZ, 12UL * MHZ, 16UL * MHZ, 20UL * MHZ, 24UL * MHZ, 25UL * MHZ};
+    static const uint32_t au32Tol[] = {0UL, 10UL, 100UL, 1000UL, 5000UL, 20000UL};
+
+    (void)CLK_SOLVE_TargetStructInit(pstcTarget);
+    if (0UL == (TEST_Rand() % 5UL)) {
+        pstcTarget->u32PllSrc = CLK_PLL_SRC_HRC;
+        pstcTarget->u32InFreq = HRC_VALUE;
+    } else if (0UL == (TEST_Rand() % 3UL)) {
+        pstcTarget->u32InFreq = 4UL * MHZ + (TEST_Rand() % (21UL * MHZ));
+    } else {
+        pstcTarget->u32InFreq = au32Xtal[TEST_Rand() % (sizeof(au32Xtal) / sizeof(au32Xtal[0]))];
+    }
+    pstcTarget->u32PFreq = RandFreq(pstcLimit->u32FreqMin, pstcLimit->u32FreqMax);
+    pstcTarget->u32QFreq = (0UL == (TEST_Rand() % 2UL)) ? 0UL : RandFreq(pstcLimit->u32FreqMin, 120UL * MHZ);
+    pstcTarget->u32RFreq = (0UL == (TEST_Rand() % 2UL)) ? 0UL : RandFreq(pstcLimit->u32FreqMin, 120UL * MHZ);
+    pstcTarget->u32Tol   = au32Tol[TEST_Rand() % (sizeof(au32Tol) / sizeof(au32Tol[0]))];
+}
+
+static void TestPll(void)
+{
+    stc_clk_solve_target_t stcTarget;
+    stc_clock_pll_init_t stcPLLInit;
+    stc_clk_solve_result_t stcResult;
+    stc_ref_t stcRef;
+    uint32_t au32Div[3];
+    uint32_t u32Found = 0UL;
+    uint32_t i;
+    int32_t i32Ret;
+
+    TEST_Seed(48UL);
+    for (i = 0UL; i < 2000UL; i++) {
+        RandTarget(&stcTarget, &m_stcPllLimit);
+        i32Ret = CLK_SOLVE_PLL(&stcTarget, &stcPLLInit, &stcResult);
+        TEST_ASSERT_EQ(Reference(&stcTarget, &m_stcPllLimit, &stcRef), i32Ret);
+        if (LL_OK == i32Ret) {
+            u32Found++;
+            TEST_ASSERT_EQ(CLK_PLL_ON, stcPLLInit.u8PLLState);
+            TEST_ASSERT_EQ(stcTarget.u32PllSrc, stcPLLInit.PLLCFGR_f.PLLSRC);
+            au32Div[0] = stcPLLInit.PLLCFGR_f.PLLP + 1UL;
+            au32Div[1] = stcPLLInit.PLLCFGR_f.PLLQ + 1UL;
+            au32Div[2] = stcPLLInit.PLLCFGR_f.PLLR + 1UL;
+            Check(&stcTarget, &m_stcPllLimit, &stcRef, stcPLLInit.PLLCFGR_f.PLLM + 1UL,
+                  stcPLLInit.PLLCFGR_f.PLLN + 1UL, au32Div, &stcResult);
+        }
+    }
+    printf("clk_solve PLLH: %u of 2000 targets solved\n", (unsigned int)u32Found);
+    TEST_ASSERT(u32Found > 300UL);
+
+    /* 8 MHz: 240 MHz exactly, 241 MHz not within 10 ppm */
+    (void)CLK_SOLVE_TargetStructInit(&stcTarget);
+    stcTarget.u32PFreq = 240UL * MHZ;
+    TEST_ASSERT_EQ(LL_OK, CLK_SOLVE_PLL(&stcTarget, &stcPLLInit, &stcResult));
+    TEST_ASSERT_EQ(240UL * MHZ, stcResult.u32PFreq);
+    TEST_ASSERT_EQ(0UL, stcResult.u32Err);
+    stcTarget.u32PFreq = 241UL * MHZ;
+    stcTarget.u32Tol   = 10UL;
+    TEST_ASSERT_EQ(LL_ERR, CLK_SOLVE_PLL(&stcTarget, &stcPLLInit, &stcResult));
+
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, CLK_SOLVE_PLL(NULL, &stcPLLInit, &stcResult));
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, CLK_SOLVE_PLL(&stcTarget, NULL, &stcResult));
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, CLK_SOLVE_TargetStructInit(NULL));
+}
+
+static void TestPllx(void)
+{
+    stc_clk_solve_target_t stcTarget;
+    stc_clock_pllx_init_t stcPLLxInit;
+    stc_clk_solve_result_t stcResult;
+    stc_ref_t stcRef;
+    uint32_t au32Div[3];
+    uint32_t u32Found = 0UL;
+    uint32_t i;
+    int32_t i32Ret;
+
+    TEST_Seed(480UL);
+    for (i = 0UL; i < 300UL; i++) {
+        RandTarget(&stcTarget, &m_stcPllxLimit);
+        i32Ret = CLK_SOLVE_PLLx(&stcTarget, &stcPLLxInit, &stcResult);
+        TEST_ASSERT_EQ(Reference(&stcTarget, &m_stcPllxLimit, &stcRef), i32Ret);
+        if (LL_OK == i32Ret) {
+            u32Found++;
+            TEST_ASSERT_EQ(CLK_PLLX_ON, stcPLLxInit.u8PLLState);
+            au32Div[0] = stcPLLxInit.PLLCFGR_f.PLLP + 1UL;
+            au32Div[1] = stcPLLxInit.PLLCFGR_f.PLLQ + 1UL;
+            au32Div[2] = stcPLLxInit.PLLCFGR_f.PLLR + 1UL;
+            Check(&stcTarget, &m_stcPllxLimit, &stcRef, stcPLLxInit.PLLCFGR_f.PLLM + 1UL,
+                  stcPLLxInit.PLLCFGR_f.PLLN + 1UL, au32Div, &stcResult);
+        }
+    }
+    printf("clk_solve PLLA: %u of 300 targets solved\n", (unsigned int)u32Found);
+    TEST_ASSERT(u32Found > 50UL);
+}
+
+/* Each bus at its highest frequency within its maximum, one EFM wait cycle per 40 MHz of HCLK */
+static void TestConfig(void)
+{
+    static const uint32_t au32BusMax[7] = {
+        CLK_SOLVE_PCLK0_MAX, CLK_SOLVE_PCLK1_MAX, CLK_SOLVE_PCLK2_MAX, CLK_SOLVE_PCLK3_MAX,
+        CLK_SOLVE_PCLK4_MAX, CLK_SOLVE_EXCLK_MAX, CLK_SOLVE_HCLK_MAX
+    };
+    stc_clk_solve_target_t stcTarget;
+    stc_clk_solve_cfg_t stcCfg;
+    stc_clk_solve_result_t stcResult;
+    uint32_t u32Sysclk;
+    uint32_t u32Div;
+    uint32_t u32Hclk;
+    uint32_t u32Wait;
+    uint32_t i;
+
+    for (u32Sysclk = 1UL * MHZ; u32Sysclk <= 240UL * MHZ; u32Sysclk += 250000UL) {
+        u32Div = CLK_SOLVE_ClockDiv(u32Sysclk);
+        for (i = 0UL; i < 7UL; i++) {
+            const uint32_t u32Shift = (u32Div >> (i * 4UL)) & 7UL;
+            TEST_ASSERT((u32Sysclk >> u32Shift) <= au32BusMax[i]);
+            TEST_ASSERT((0UL == u32Shift) || ((u32Sysclk >> (u32Shift - 1UL)) > au32BusMax[i]));
+        }
+        u32Wait = CLK_SOLVE_WaitCycle(u32Sysclk) >> EFM_FRMC_FLWT_POS;
+        TEST_ASSERT(u32Sysclk <= ((u32Wait + 1UL) * CLK_SOLVE_EFM_WAIT_STEP));
+        TEST_ASSERT((0UL == u32Wait) || (u32Sysclk > (u32Wait * CLK_SOLVE_EFM_WAIT_STEP)));
+    }
+    TEST_ASSERT_EQ(0UL, CLK_SOLVE_WaitCycle(0UL));
+
+    (void)CLK_SOLVE_TargetStructInit(&stcTarget);
+    stcTarget.u32PFreq = 200UL * MHZ;
+    TEST_ASSERT_EQ(LL_OK, CLK_SOLVE_Config(&stcTarget, &stcCfg, &stcResult));
+    TEST_ASSERT_EQ(200UL * MHZ, stcResult.u32PFreq);
+    TEST_ASSERT_EQ(CLK_SOLVE_ClockDiv(200UL * MHZ), stcCfg.u32ClockDiv);
+    u32Hclk = (200UL * MHZ) >> ((stcCfg.u32ClockDiv & CMU_SCFGR_HCLKS) >> CMU_SCFGR_HCLKS_POS);
+    TEST_ASSERT_EQ(CLK_SOLVE_WaitCycle(u32Hclk), stcCfg.u32WaitCycle);
+    TEST_ASSERT_EQ(4UL << EFM_FRMC_FLWT_POS, stcCfg.u32WaitCycle);
+
+    stcTarget.u32PFreq = 0UL;
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, CLK_SOLVE_Config(&stcTarget, &stcCfg, &stcResult));
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, CLK_SOLVE_Config(NULL, &stcCfg, &stcResult));
+}
+
+static stc_clk_solve_cfg_t m_stcApplyCfg;
+static uint32_t m_u32ApplyFail;
+
+/* PLLH is selected only once the dividers and the wait cycle are in place */
+static void ApplyCheck(const stc_fake_clk_state_t *pstcState)
+{
+    if ((CLK_SYSCLK_SRC_PLL == pstcState->u8Src) &&
+        ((m_stcApplyCfg.u32ClockDiv != pstcState->u32Div) || (m_stcApplyCfg.u32WaitCycle != pstcState->u32EfmWait))) {
+        m_u32ApplyFail++;
+    }
+}
+
+static void TestApply(void)
+{
+    const uint32_t au32SrcFreq[CLK_SYSCLK_SRC_PLL + 1U] = {
+        HRC_VALUE, 8UL * MHZ, 32768UL, XTAL_VALUE, 32768UL, 200UL * MHZ
+    };
+    stc_clk_solve_target_t stcTarget;
+    stc_fake_clk_state_t stcState;
+
+    (void)CLK_SOLVE_TargetStructInit(&stcTarget);
+    stcTarget.u32PFreq = 200UL * MHZ;
+    TEST_ASSERT_EQ(LL_OK, CLK_SOLVE_Config(&stcTarget, &m_stcApplyCfg, NULL));
+
+    (void)memset(&stcState, 0, sizeof(stcState));
+    stcState.u8Src = CLK_SYSCLK_SRC_HRC;
+    FAKE_CLK_Reset(au32SrcFreq, &stcState);
+    FAKE_CLK_SetCheck(ApplyCheck);
+    m_u32ApplyFail = 0UL;
+    TEST_ASSERT_EQ(LL_OK, CLK_SOLVE_Apply(&m_stcApplyCfg));
+    FAKE_CLK_GetState(&stcState);
+    TEST_ASSERT_EQ(CLK_SYSCLK_SRC_PLL, stcState.u8Src);
+    TEST_ASSERT_EQ(m_stcApplyCfg.u32ClockDiv, stcState.u32Div);
+    TEST_ASSERT_EQ(m_stcApplyCfg.u32WaitCycle, stcState.u32EfmWait);
+    TEST_ASSERT_EQ(0UL, m_u32ApplyFail);
+
+    /* The EFM is not ready: the system clock stays on its source */
+    (void)memset(&stcState, 0, sizeof(stcState));
+    stcState.u8Src = CLK_SYSCLK_SRC_HRC;
+    FAKE_CLK_Reset(au32SrcFreq, &stcState);
+    FAKE_CLK_SetEfmRet(LL_ERR_TIMEOUT);
+    TEST_ASSERT_EQ(LL_ERR_TIMEOUT, CLK_SOLVE_Apply(&m_stcApplyCfg));
+    FAKE_CLK_GetState(&stcState);
+    TEST_ASSERT_EQ(CLK_SYSCLK_SRC_HRC, stcState.u8Src);
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, CLK_SOLVE_Apply(NULL));
+}
+
+static void Bench(void)
+{
+    stc_clk_solve_target_t stcTarget;
+    stc_clock_pll_init_t stcPLLInit;
+    double dStart;
+    uint32_t i;
+
+    (void)CLK_SOLVE_TargetStructInit(&stcTarget);
+    stcTarget.u32PFreq = 240UL * MHZ;
+    stcTarget.u32QFreq = 48UL * MHZ;
+    stcTarget.u32RFreq = 100UL * MHZ;
+    stcTarget.u32Tol   = 100UL;
+    dStart = NowNs();
+    for (i = 0UL; i < BENCH_OPS; i++) {
+        (void)CLK_SOLVE_PLL(&stcTarget, &stcPLLInit, NULL);
+    }
+    printf("clk_solve PLLH: %.1f ns/op\n", (NowNs() - dStart) / (double)BENCH_OPS);
+}
+
+int main(void)
+{
+    TestPll();
+    TestPllx();
+    TestConfig();
+    TestApply();
+    Bench();
+    return TEST_Result("test_clk_solve");
+}
@@ -0,0 +1,194 @@
+/**
+ *******************************************************************************
+ * @file  test_dac_wave.c
+ * @brief DAC waveform against the DAC and DMA models: trigger validation, a
+ *        looped table on one channel, a streamed dual channel table refilled
+ *        half by half, and the accuracy of the sine generator.
+ *******************************************************************************
+ */
+#include <math.h>
+#include <string.h>
+#include "test.h"
+#include "fake_dac.h"
+#include "fake_dma.h"
+#include "hc32_ll_dac_wave.h"
+
+#define PACING_EVT                      (EVT_SRC_TMR0_1_CMP_A)
+#define LOOP_LEN                        (50UL)
+#define STREAM_LEN                      (16UL)
+#define STREAM_SAMPLES                  (200UL)
+
+static stc_dac_wave_t m_stcWave;
+static uint16_t m_au16Table[LOOP_LEN];
+static uint32_t m_au32Stream[STREAM_LEN];
+static uint32_t m_u32NextSample;
+static uint32_t m_u32RefillNum;
+
+static void DmaIrq(void)
+{
+    DAC_WAVE_DmaIrqHandler(&m_stcWave);
+}
+
+static uint32_t StreamPair(uint32_t u32Sample)
+{
+    return ((uint32_t)(0xFFFUL - (u32Sample & 0xFFFUL)) << 16U) | (u32Sample & 0xFFFUL);
+}
+
+static void Refill(stc_dac_wave_t *pstcWave, void *pvBuf, uint32_t u32Len, void *pvArg)
+{
+    uint32_t *pu32Half = (uint32_t *)pvBuf;
+    uint32_t i;
+
+    TEST_ASSERT(pvArg == &m_stcWave);
+    TEST_ASSERT_EQ(STREAM_LEN / 2UL, u32Len);
+    /* The halves are handed back in turn */
+    TEST_ASSERT(pu32Half == &m_au32Stream[(m_u32RefillNum % 2UL) * (STREAM_LEN / 2UL)]);
+    for (i = 0UL; i < u32Len; i++) {
+        pu32Half[i] = StreamPair(m_u32NextSample);
+        m_u32NextSample++;
+    }
+    m_u32RefillNum++;
+}
+
+static void Setup(stc_dac_wave_init_t *pstcInit)
+{
+    FAKE_DAC_Reset();
+    FAKE_DMA_Reset();
+    FAKE_DMA_SetIrq(CM_DMA2, DMA_CH4, &DmaIrq);
+    (void)DAC_WAVE_StructInit(pstcInit);
+    pstcInit->pstcDmaUnit   = CM_DMA2;
+    pstcInit->u8DmaCh       = DMA_CH4;
+    pstcInit->u32TrigTarget = AOS_DMA2_4;
+    pstcInit->enEvtSrc      = PACING_EVT;
+}
+
+static void TestInit(void)
+{
+    stc_dac_wave_init_t stcInit;
+
+    (void)DAC_WAVE_StructInit(&stcInit);
+    /* The defaults are a consistent pair */
+    TEST_ASSERT_EQ(DMA_CH0, stcInit.u8DmaCh);
+    TEST_ASSERT_EQ(AOS_DMA1_0, stcInit.u32TrigTarget);
+    stcInit.pvBuf       = m_au16Table;
+    stcInit.u32Len      = LOOP_LEN;
+    stcInit.pstcDmaUnit = CM_DMA1;
+    TEST_ASSERT_EQ(LL_OK, DAC_WAVE_Init(&m_stcWave, CM_DAC1, &stcInit));
+
+    Setup(&stcInit);
+    stcInit.pvBuf  = m_au16Table;
+    stcInit.u32Len = LOOP_LEN;
+    /* Target of another channel, or of the same channel of the other unit */
+    stcInit.u32TrigTarget = AOS_DMA2_3;
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, DAC_WAVE_Init(&m_stcWave, CM_DAC1, &stcInit));
+    stcInit.u32TrigTarget = AOS_DMA1_4;
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, DAC_WAVE_Init(&m_stcWave, CM_DAC1, &stcInit));
+    TEST_ASSERT_EQ(0UL, HOST_AOS.DMA1_TRGSEL4);
+    stcInit.u32TrigTarget = AOS_DMA2_4;
+    TEST_ASSERT_EQ(LL_OK, DAC_WAVE_Init(&m_stcWave, CM_DAC1, &stcInit));
+    TEST_ASSERT_EQ((uint32_t)PACING_EVT, HOST_AOS.DMA2_TRGSEL4 & AOS_TRIG_SEL_MASK);
+    /* Stream mode needs an even length */
+    stcInit.u16Mode = DAC_WAVE_MD_STREAM;
+    stcInit.u32Len  = LOOP_LEN - 1UL;
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, DAC_WAVE_Init(&m_stcWave, CM_DAC1, &stcInit));
+}
+
+static void TestLoop(void)
+{
+    stc_dac_wave_init_t stcInit;
+    uint32_t i;
+
+    Setup(&stcInit);
+    TEST_ASSERT_EQ(LL_OK, DAC_WAVE_GenTriangle(m_au16Table, LOOP_LEN, 2000U, 2048U, DAC_DATA_ALIGN_RIGHT));
+    stcInit.u16Ch  = DAC_WAVE_CH2;
+    stcInit.pvBuf  = m_au16Table;
+    stcInit.u32Len = LOOP_LEN;
+    TEST_ASSERT_EQ(LL_OK, DAC_WAVE_Init(&m_stcWave, CM_DAC2, &stcInit));
+    TEST_ASSERT_EQ(LL_OK, DAC_WAVE_Start(&m_stcWave));
+    TEST_ASSERT_EQ(LL_ERR_BUSY, DAC_WAVE_Start(&m_stcWave));
+    TEST_ASSERT_EQ(ENABLE, FAKE_DAC_GetChState(CM_DAC2, DAC_CH2));
+    TEST_ASSERT_EQ(DISABLE, FAKE_DAC_GetChState(CM_DAC2, DAC_CH1));
+
+    for (i = 0UL; i < (LOOP_LEN * 5UL) + 7UL; i++) {
+        FAKE_AOS_Fire(PACING_EVT);
+        TEST_ASSERT_EQ(m_au16Table[i % LOOP_LEN], CM_DAC2->DADR2);
+        TEST_ASSERT_EQ(0U, CM_DAC2->DADR1);
+    }
+    /* The self-linked descriptor never stops the channel nor interrupts */
+    TEST_ASSERT_EQ(ENABLE, FAKE_DMA_GetChState(CM_DMA2, DMA_CH4));
+    TEST_ASSERT_EQ(0UL, m_stcWave.u32HalfCount);
+
+    DAC_WAVE_Stop(&m_stcWave);
+    FAKE_AOS_Fire(PACING_EVT);
+    TEST_ASSERT_EQ(m_au16Table[((LOOP_LEN * 5UL) + 6UL) % LOOP_LEN], CM_DAC2->DADR2);
+}
+
+static void TestStream(void)
+{
+    stc_dac_wave_init_t stcInit;
+    uint32_t i;
+
+    Setup(&stcInit);
+    for (m_u32NextSample = 0UL; m_u32NextSample < STREAM_LEN; m_u32NextSample++) {
+        m_au32Stream[m_u32NextSample] = StreamPair(m_u32NextSample);
+    }
+    m_u32RefillNum = 0UL;
+    stcInit.u16Ch       = DAC_WAVE_CH_DUAL;
+    stcInit.u16Mode     = DAC_WAVE_MD_STREAM;
+    stcInit.pvBuf       = m_au32Stream;
+    stcInit.u32Len      = STREAM_LEN;
+    stcInit.pfnCallback = &Refill;
+    stcInit.pvArg       = &m_stcWave;
+    TEST_ASSERT_EQ(LL_OK, DAC_WAVE_Init(&m_stcWave, CM_DAC1, &stcInit));
+    TEST_ASSERT_EQ(LL_OK, DAC_WAVE_Start(&m_stcWave));
+
+    /* Each sample is played once, in order, on both channels in phase */
+    for (i = 0UL; i < STREAM_SAMPLES; i++) {
+        FAKE_AOS_Fire(PACING_EVT);
+        TEST_ASSERT_EQ(i & 0xFFFUL, CM_DAC1->DADR1);
+        TEST_ASSERT_EQ(0xFFFUL - (i & 0xFFFUL), CM_DAC1->DADR2);
+    }
+    TEST_ASSERT_EQ(STREAM_SAMPLES / (STREAM_LEN / 2UL), m_u32RefillNum);
+    TEST_ASSERT_EQ(m_u32RefillNum, m_stcWave.u32HalfCount);
+    DAC_WAVE_Stop(&m_stcWave);
+}
+
+static void TestSine(void)
+{
+    static uint16_t au16Sine[1000];
+    const uint32_t au32Len[] = {4UL, 37UL, 256UL, 1000UL};
+    const uint16_t u16Amp = 2047U;
+    const double dPi = 3.14159265358979323846;
+    double dRef;
+    double dErr;
+    double dMax = 0.0;
+    uint32_t n;
+    uint32_t i;
+
+    for (n = 0UL; n < (sizeof(au32Len) / sizeof(au32Len[0])); n++) {
+        TEST_ASSERT_EQ(LL_OK, DAC_WAVE_GenSine(au16Sine, au32Len[n], u16Amp, 2048U, DAC_DATA_ALIGN_RIGHT));
+        for (i = 0UL; i < au32Len[n]; i++) {
+            dRef = 2048.0 + (u16Amp * sin((2.0 * dPi * (double)i) / (double)au32Len[n]));
+            dErr = fabs((double)au16Sine[i] - dRef);
+            dMax = (dErr > dMax) ? dErr : dMax;
+        }
+    }
+    /* Sine error, phase truncated to 1 / 65536 of a turn, truncation of the scaling */
+    TEST_ASSERT(dMax < (1.0 + (((4.0 + dPi) * u16Amp) / 32768.0)));
+
+    /* Left alignment and clipping */
+    TEST_ASSERT_EQ(LL_OK, DAC_WAVE_GenSine(au16Sine, 4UL, 3000U, 2048U, DAC_DATA_ALIGN_LEFT));
+    TEST_ASSERT_EQ(2048U << 4U, au16Sine[0]);
+    TEST_ASSERT_EQ(0xFFFU << 4U, au16Sine[1]);
+    TEST_ASSERT_EQ(0U, au16Sine[3]);
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, DAC_WAVE_GenSine(NULL, 4UL, 3000U, 2048U, DAC_DATA_ALIGN_LEFT));
+}
+
+int main(void)
+{
+    TestInit();
+    TestLoop();
+    TestStream();
+    TestSine();
+    return TEST_Result("dac_wave");
+}
@@ -0,0 +1,243 @@
+/**
+ *******************************************************************************
+ * @file  test_dcu_batch.c
+ * @brief DCU batch kernels against the DCU and DMA models: wrap and saturation
+ *        of DCU_BATCH_AccumulateModel() on the edges of each width, the
+ *        accumulation kernel against the model over several chunks, and the
+ *        compare kernel finding the first crossing whatever the interrupt
+ *        latency.
+ *******************************************************************************
+ */
+#include <string.h>
+#include "test.h"
+#include "fake_dcu.h"
+#include "fake_dma.h"
+#include "hc32_ll_dcu_batch.h"
+
+#define ARRAY_LEN                       (2600UL)
+#define CHUNK                           (1024UL)
+
+static stc_dcu_batch_t m_stcBatch;
+static uint32_t m_au32Array[ARRAY_LEN];
+static uint32_t m_u32Event;
+static uint32_t m_u32EventNum;
+
+static void DmaIrq(void)
+{
+    DCU_BATCH_DmaIrqHandler(&m_stcBatch);
+}
+
+static void DcuIrq(void)
+{
+    DCU_BATCH_DcuIrqHandler(&m_stcBatch);
+}
+
+static void Done(stc_dcu_batch_t *pstcBatch, uint32_t u32Event, void *pvArg)
+{
+    TEST_ASSERT(pvArg == &m_stcBatch);
+    m_u32Event = u32Event;
+    m_u32EventNum++;
+}
+
+static void Setup(uint32_t u32Latency)
+{
+    stc_dcu_batch_init_t stcInit;
+
+    FAKE_DMA_Reset();
+    FAKE_DCU_Reset();
+    FAKE_DMA_SetIrq(CM_DMA2, DMA_CH3, &DmaIrq);
+    FAKE_DCU_SetIrq(CM_DCU5, &DcuIrq, u32Latency);
+    m_u32Event = 0UL;
+    m_u32EventNum = 0UL;
+
+    (void)DCU_BATCH_StructInit(&stcInit);
+    stcInit.pstcDmaUnit   = CM_DMA2;
+    stcInit.u8DmaCh       = DMA_CH3;
+    stcInit.u32TrigTarget = AOS_DMA2_3;
+    stcInit.pfnCallback   = &Done;
+    stcInit.pvArg         = &m_stcBatch;
+    TEST_ASSERT_EQ(LL_OK, DCU_BATCH_Init(&m_stcBatch, CM_DCU5, &stcInit));
+}
+
+static void TestInit(void)
+{
+    stc_dcu_batch_init_t stcInit;
+
+    FAKE_DMA_Reset();
+    (void)DCU_BATCH_StructInit(&stcInit);
+    stcInit.pstcDmaUnit = CM_DMA1;
+    /* A stale event on the channel is removed */
+    HOST_AOS.DMA1_TRGSEL0 = (uint32_t)EVT_SRC_ADC1_EOCA;
+    TEST_ASSERT_EQ(LL_OK, DCU_BATCH_Init(&m_stcBatch, CM_DCU1, &stcInit));
+    TEST_ASSERT_EQ((uint32_t)EVT_SRC_MAX, HOST_AOS.DMA1_TRGSEL0);
+
+    stcInit.u8DmaCh = DMA_CH6;
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, DCU_BATCH_Init(&m_stcBatch, CM_DCU1, &stcInit));
+    stcInit.u32TrigTarget = AOS_DMA2_6;
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, DCU_BATCH_Init(&m_stcBatch, CM_DCU1, &stcInit));
+    stcInit.u32TrigTarget = AOS_DMA1_6;
+    TEST_ASSERT_EQ(LL_OK, DCU_BATCH_Init(&m_stcBatch, CM_DCU1, &stcInit));
+}
+
+static void CheckModel(uint32_t u32Mode, uint32_t u32Width, const void *pvSrc, uint32_t u32Len, uint32_t u32Seed,
+                       uint32_t u32Sum, uint32_t u32SatSum, uint8_t u8Carry)
+{
+    stc_dcu_batch_acc_t stcAcc;
+
+    TEST_ASSERT_EQ(LL_OK, DCU_BATCH_AccumulateModel(u32Mode, u32Width, pvSrc, u32Len, u32Seed, &stcAcc));
+    TEST_ASSERT_EQ(u32Sum, stcAcc.u32Sum);
+    TEST_ASSERT_EQ(u32SatSum, stcAcc.u32SatSum);
+    TEST_ASSERT_EQ(u8Carry, stcAcc.u8Carry);
+}
+
+static void TestModel(void)
+{
+    const uint8_t au8Val[] = {3U, 4U};
+    const uint8_t au8Max[] = {0xFFU, 0xFFU, 0xFFU};
+    const uint16_t au16Val[] = {0x8000U, 0x7FFFU, 0x0001U};
+    const uint32_t au32Val[] = {0xFFFFFFFEUL, 1UL, 1UL};
+    const uint32_t au32Big[] = {0x80000000UL, 0x80000000UL};
+    stc_dcu_batch_acc_t stcAcc;
+
+    /* 8 bit: exact up to the bound, wraps past it */
+    CheckModel(DCU_MD_ADD, DCU_DATA_WIDTH_8BIT, au8Val, 2UL, 248UL, 255UL, 255UL, 0U);
+    CheckModel(DCU_MD_ADD, DCU_DATA_WIDTH_8BIT, au8Val, 2UL, 250UL, 1UL, 255UL, 1U);
+    CheckModel(DCU_MD_SUB, DCU_DATA_WIDTH_8BIT, au8Val, 2UL, 7UL, 0UL, 0UL, 0U);
+    CheckModel(DCU_MD_SUB, DCU_DATA_WIDTH_8BIT, au8Val, 2UL, 5UL, 254UL, 0UL, 1U);
+    /* Wrapping several times, the carry stays */
+    CheckModel(DCU_MD_ADD, DCU_DATA_WIDTH_8BIT, au8Max, 3UL, 3UL, 0UL, 255UL, 1U);
+    /* The seed is cut to the width */
+    CheckModel(DCU_MD_ADD, DCU_DATA_WIDTH_8BIT, au8Val, 1UL, 0x1FDUL, 0UL, 255UL, 1U);
+    /* 16 bit */
+    CheckModel(DCU_MD_ADD, DCU_DATA_WIDTH_16BIT, au16Val, 2UL, 0UL, 0xFFFFUL, 0xFFFFUL, 0U);
+    CheckModel(DCU_MD_ADD, DCU_DATA_WIDTH_16BIT, au16Val, 3UL, 0UL, 0UL, 0xFFFFUL, 1U);
+    CheckModel(DCU_MD_SUB, DCU_DATA_WIDTH_16BIT, au16Val, 3UL, 0xFFFFUL, 0xFFFFUL, 0UL, 1U);
+    /* 32 bit, no wider intermediate */
+    CheckModel(DCU_MD_ADD, DCU_DATA_WIDTH_32BIT, au32Val, 2UL, 0UL, 0xFFFFFFFFUL, 0xFFFFFFFFUL, 0U);
+    CheckModel(DCU_MD_ADD, DCU_DATA_WIDTH_32BIT, au32Val, 3UL, 0UL, 0UL, 0xFFFFFFFFUL, 1U);
+    CheckModel(DCU_MD_ADD, DCU_DATA_WIDTH_32BIT, au32Big, 2UL, 0UL, 0UL, 0xFFFFFFFFUL, 1U);
+    CheckModel(DCU_MD_SUB, DCU_DATA_WIDTH_32BIT, au32Val, 1UL, 0xFFFFFFFEUL, 0UL, 0UL, 0U);
+    CheckModel(DCU_MD_SUB, DCU_DATA_WIDTH_32BIT, au32Val, 2UL, 0xFFFFFFFEUL, 0xFFFFFFFFUL, 0UL, 1U);
+    /* Empty array: the seed */
+    CheckModel(DCU_MD_SUB, DCU_DATA_WIDTH_16BIT, au16Val, 0UL, 1234UL, 1234UL, 1234UL, 0U);
+
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, DCU_BATCH_AccumulateModel(DCU_MD_CMP, DCU_DATA_WIDTH_8BIT, au8Val, 2UL, 0UL,
+                                                                &stcAcc));
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, DCU_BATCH_AccumulateModel(DCU_MD_ADD, DCU_DATA_WIDTH_8BIT, NULL, 2UL, 0UL,
+                                                                &stcAcc));
+}
+
+static void FillArray(uint32_t u32Width, uint32_t u32Len, uint32_t u32Max)
+{
+    uint8_t *pu8 = (uint8_t *)m_au32Array;
+    uint16_t *pu16 = (uint16_t *)m_au32Array;
+    uint32_t i;
+
+    for (i = 0UL; i < u32Len; i++) {
+        if (DCU_DATA_WIDTH_8BIT == u32Width) {
+            pu8[i] = (uint8_t)(TEST_Rand() % (u32Max + 1UL));
+        } else if (DCU_DATA_WIDTH_16BIT == u32Width) {
+            pu16[i] = (uint16_t)(TEST_Rand() % (u32Max + 1UL));
+        } else {
+            m_au32Array[i] = (0xFFFFFFFFUL == u32Max) ? TEST_Rand() : (TEST_Rand() % (u32Max + 1UL));
+        }
+    }
+}
+
+static void TestAccumulate(void)
+{
+    const uint32_t au32Width[] = {DCU_DATA_WIDTH_8BIT, DCU_DATA_WIDTH_16BIT, DCU_DATA_WIDTH_32BIT};
+    const uint32_t au32Mask[] = {0xFFUL, 0xFFFFUL, 0xFFFFFFFFUL};
+    const uint32_t au32Len[] = {1UL, CHUNK, CHUNK + 1UL, ARRAY_LEN};
+    const uint32_t au32Mode[] = {DCU_MD_ADD, DCU_MD_SUB};
+    stc_dcu_batch_acc_t stcAcc;
+    stc_dcu_batch_acc_t stcModel;
+    uint32_t u32Seed;
+    uint32_t u32Max;
+    uint32_t w;
+    uint32_t n;
+    uint32_t m;
+    uint32_t r;
+
+    TEST_Seed(40UL);
+    for (w = 0UL; w < 3UL; w++) {
+        for (n = 0UL; n < 4UL; n++) {
+            for (m = 0UL; m < 2UL; m++) {
+                /* Small elements stay in range, large ones wrap */
+                for (r = 0UL; r < 2UL; r++) {
+                    u32Max = (0UL == r) ? (au32Mask[w] / (2UL * ARRAY_LEN)) : au32Mask[w];
+                    u32Seed = (DCU_MD_ADD == au32Mode[m]) ? 0UL : au32Mask[w];
+                    FillArray(au32Width[w], au32Len[n], u32Max);
+                    Setup(0UL);
+                    TEST_ASSERT_EQ(LL_OK, DCU_BATCH_Accumulate(&m_stcBatch, au32Mode[m], au32Width[w], m_au32Array,
+                                                               au32Len[n], u32Seed));
+                    TEST_ASSERT_EQ(1UL, m_u32EventNum);
+                    TEST_ASSERT_EQ(DCU_BATCH_EVT_ACC_DONE, m_u32Event);
+                    TEST_ASSERT_EQ(LL_OK, DCU_BATCH_GetAccResult(&m_stcBatch, &stcAcc));
+                    TEST_ASSERT_EQ(LL_OK, DCU_BATCH_AccumulateModel(au32Mode[m], au32Width[w], m_au32Array,
+                                                                    au32Len[n], u32Seed, &stcModel));
+                    TEST_ASSERT_EQ(stcModel.u32Sum, stcAcc.u32Sum);
+                    TEST_ASSERT_EQ(stcModel.u32SatSum, stcAcc.u32SatSum);
+                    TEST_ASSERT_EQ(stcModel.u8Carry, stcAcc.u8Carry);
+                    TEST_ASSERT_EQ(((0UL == r) || (1UL == au32Len[n])) ? 0U : 1U, stcAcc.u8Carry);
+                    /* One software request of the channel per chunk, nothing else */
+                    TEST_ASSERT_EQ((au32Len[n] + CHUNK - 1UL) / CHUNK, FAKE_AOS_GetSwTriggerCount());
+                    TEST_ASSERT_EQ(au32Len[n], FAKE_DCU_GetOpCount(CM_DCU5));
+                }
+            }
+        }
+    }
+}
+
+static void TestCompare(void)
+{
+    const uint32_t au32Cross[] = {0UL, 5UL, CHUNK - 1UL, CHUNK, 1500UL, ARRAY_LEN - 1UL};
+    const uint32_t au32Latency[] = {0UL, 1UL, 3UL, 40UL};
+    uint16_t *pu16 = (uint16_t *)m_au32Array;
+    uint32_t u32Idx;
+    uint32_t c;
+    uint32_t l;
+    uint32_t i;
+
+    TEST_Seed(4UL);
+    for (c = 0UL; c < (sizeof(au32Cross) / sizeof(au32Cross[0])); c++) {
+        for (l = 0UL; l < (sizeof(au32Latency) / sizeof(au32Latency[0])); l++) {
+            for (i = 0UL; i < ARRAY_LEN; i++) {
+                pu16[i] = (uint16_t)(100UL + (TEST_Rand() % 801UL));
+            }
+            /* Further crossings after the first one */
+            pu16[au32Cross[c]] = (0UL == (c & 1UL)) ? 99U : 901U;
+            for (i = au32Cross[c] + 2UL; i < ARRAY_LEN; i += 7UL) {
+                pu16[i] = 0U;
+            }
+            Setup(au32Latency[l]);
+            TEST_ASSERT_EQ(LL_OK, DCU_BATCH_Compare(&m_stcBatch, DCU_DATA_WIDTH_16BIT, pu16, ARRAY_LEN, 100UL, 900UL));
+            TEST_ASSERT_EQ(1UL, m_u32EventNum);
+            TEST_ASSERT_EQ(DCU_BATCH_EVT_CMP_CROSS, m_u32Event);
+            TEST_ASSERT_EQ(LL_OK, DCU_BATCH_GetCrossing(&m_stcBatch, &u32Idx));
+            TEST_ASSERT_EQ(au32Cross[c], u32Idx);
+            TEST_ASSERT_EQ(DISABLE, FAKE_DMA_GetChState(CM_DMA2, DMA_CH3));
+        }
+    }
+
+    /* All within the limits, bounds included */
+    for (i = 0UL; i < ARRAY_LEN; i++) {
+        pu16[i] = (uint16_t)(100UL + (i % 801UL));
+    }
+    Setup(2UL);
+    TEST_ASSERT_EQ(LL_OK, DCU_BATCH_Compare(&m_stcBatch, DCU_DATA_WIDTH_16BIT, pu16, ARRAY_LEN, 100UL, 900UL));
+    TEST_ASSERT_EQ(1UL, m_u32EventNum);
+    TEST_ASSERT_EQ(DCU_BATCH_EVT_CMP_DONE, m_u32Event);
+    TEST_ASSERT_EQ(LL_ERR, DCU_BATCH_GetCrossing(&m_stcBatch, &u32Idx));
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, DCU_BATCH_Compare(&m_stcBatch, DCU_DATA_WIDTH_16BIT, pu16, ARRAY_LEN,
+                                                        901UL, 900UL));
+}
+
+int main(void)
+{
+    TestInit();
+    TestModel();
+    TestAccumulate();
+    TestCompare();
+    return TEST_Result("dcu_batch");
+}
@@ -0,0 +1,337 @@
+/**
+ *******************************************************************************
+ * @file  test_dmc_mem.c
+ * @brief SDRAM memory manager on a region backed by mmap(): chip windows,
+ *        arena and pool allocators against a shadow of the allocations, the
+ *        boot memory test on good memory and on a region whose upper half
+ *        aliases the lower half as with an open address line, and a benchmark
+ *        of the allocators against malloc().
+ *******************************************************************************
+ */
+#define _GNU_SOURCE
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include "test.h"
+#include "fake_dmc.h"
+#include "hc32_ll_dmc_mem.h"
+
+/* The driver keeps addresses in uint32_t: the region is mapped below 4 GiB */
+#define REGION_HINT                     (0x50000000UL)
+#define REGION_SIZE                     (16UL * 1024UL * 1024UL)
+#define ALIAS_SIZE                      (256UL * 1024UL)
+
+#define BENCH_OPS                       (1000000UL)
+#define BENCH_BLK_NUM                   (1024UL)
+
+#ifndef MAP_FIXED_NOREPLACE
+#define MAP_FIXED_NOREPLACE             (0)
+#endif
+
+static uint8_t *m_pu8Region;
+
+static void *MapLow(uint32_t u32Hint, uint32_t u32Size)
+{
+    void *pvMem = mmap((void *)(uintptr_t)u32Hint, u32Size, PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+
+    if ((MAP_FAILED == pvMem) || (((uintptr_t)pvMem + u32Size) > 0x100000000ULL)) {
+        pvMem = NULL;
+    }
+    return pvMem;
+}
+
+static double NowNs(void)
+{
+    struct timespec stcTs;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &stcTs);
+    return ((double)stcTs.tv_sec * 1e9) + (double)stcTs.tv_nsec;
+}
+
+static void TestChip(void)
+{
+    stc_exmc_dmc_chip_config_t stcChip;
+    stc_dmc_mem_region_t stcRegion;
+
+    FAKE_DMC_Reset();
+    stcChip.u32AddrMatch = 0x80UL;
+    stcChip.u32AddrMask  = EXMC_DMC_ADDR_MASK_32MB;
+    stcChip.u32AddrDecodeMode = 0UL;
+    (void)EXMC_DMC_ChipConfig(EXMC_DMC_CHIP1, &stcChip);
+
+    /* The SDRAM fills the window, or is clipped by it */
+    TEST_ASSERT_EQ(LL_OK, DMC_MEM_RegionInitChip(&stcRegion, EXMC_DMC_CHIP1, 8UL * 1024UL * 1024UL));
+    TEST_ASSERT_EQ(0x80000000UL, DMC_MEM_ArenaMark(&stcRegion));
+    TEST_ASSERT_EQ(8UL * 1024UL * 1024UL, DMC_MEM_ArenaGetFree(&stcRegion));
+    TEST_ASSERT_EQ(LL_OK, DMC_MEM_RegionInitChip(&stcRegion, EXMC_DMC_CHIP1, 64UL * 1024UL * 1024UL));
+    TEST_ASSERT_EQ(32UL * 1024UL * 1024UL, DMC_MEM_ArenaGetFree(&stcRegion));
+
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, DMC_MEM_RegionInit(&stcRegion, 0xFFFFF000UL, 0x2000UL));
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, DMC_MEM_RegionInit(&stcRegion, 0x20000000UL, 0UL));
+}
+
+static void TestArena(void)
+{
+    stc_dmc_mem_region_t stcRegion;
+    const uint32_t u32Base = (uint32_t)(uintptr_t)m_pu8Region;
+    uint8_t *pu8Prev = NULL;
+    uint8_t *pu8;
+    uint32_t u32Size;
+    uint32_t u32Align;
+    uint32_t u32Mark = 0UL;
+    uint32_t u32Num = 0UL;
+    uint32_t i;
+
+    TEST_ASSERT_EQ(LL_OK, DMC_MEM_RegionInit(&stcRegion, u32Base, REGION_SIZE));
+    TEST_Seed(42UL);
+    for (i = 0UL; i < 4000UL; i++) {
+        u32Size  = TEST_Rand() % 5000UL;
+        u32Align = 1UL << (TEST_Rand() % 8UL);
+        pu8 = (uint8_t *)DMC_MEM_ArenaAlloc(&stcRegion, u32Size, u32Align);
+        if (NULL == pu8) {
+            break;
+        }
+        TEST_ASSERT_EQ(0UL, (uintptr_t)pu8 & (u32Align - 1UL));
+        TEST_ASSERT((NULL == pu8Prev) || (pu8 >= pu8Prev));
+        TEST_ASSERT(((uintptr_t)pu8 + u32Size) <= (u32Base + REGION_SIZE));
+        /* The whole block is usable */
+        (void)memset(pu8, (int)i, u32Size);
+        pu8Prev = pu8 + u32Size;
+        TEST_ASSERT_EQ((uint32_t)(uintptr_t)pu8Prev, DMC_MEM_ArenaMark(&stcRegion));
+        if (1000UL == i) {
+            u32Mark = DMC_MEM_ArenaMark(&stcRegion);
+        }
+        u32Num++;
+    }
+    TEST_ASSERT_EQ(4000UL, u32Num);
+
+    /* Back to the mark, then the arena is full */
+    TEST_ASSERT_EQ(LL_OK, DMC_MEM_ArenaReset(&stcRegion, u32Mark));
+    TEST_ASSERT_EQ(u32Base + REGION_SIZE - u32Mark, DMC_MEM_ArenaGetFree(&stcRegion));
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, DMC_MEM_ArenaReset(&stcRegion, u32Mark + 4UL));
+    TEST_ASSERT(NULL == DMC_MEM_ArenaAlloc(&stcRegion, DMC_MEM_ArenaGetFree(&stcRegion) + 1UL, 1UL));
+    TEST_ASSERT(NULL != DMC_MEM_ArenaAlloc(&stcRegion, DMC_MEM_ArenaGetFree(&stcRegion), 1UL));
+    TEST_ASSERT_EQ(0UL, DMC_MEM_ArenaGetFree(&stcRegion));
+    TEST_ASSERT(NULL == DMC_MEM_ArenaAlloc(&stcRegion, 1UL, 1UL));
+    TEST_ASSERT(NULL == DMC_MEM_ArenaAlloc(&stcRegion, 0xFFFFFFFFUL, 1UL));
+    TEST_ASSERT_EQ(LL_OK, DMC_MEM_ArenaReset(&stcRegion, 0UL));
+    TEST_ASSERT_EQ(REGION_SIZE, DMC_MEM_ArenaGetFree(&stcRegion));
+    /* An alignment past the end of the region */
+    TEST_ASSERT(NULL == DMC_MEM_ArenaAlloc(&stcRegion, 0UL, 0x80000000UL));
+}
+
+static void TestPool(void)
+{
+    static void *apvBlk[600];
+    stc_dmc_mem_region_t stcRegion;
+    stc_dmc_mem_pool_t stcPool;
+    const uint32_t u32Base = (uint32_t)(uintptr_t)m_pu8Region;
+    uint32_t u32Used = 0UL;
+    uint32_t u32MinFree = 600UL;
+    uint32_t i;
+    uint32_t j;
+    uint32_t n;
+
+    TEST_ASSERT_EQ(LL_OK, DMC_MEM_RegionInit(&stcRegion, u32Base, 64UL * 1024UL));
+    (void)DMC_MEM_ArenaAlloc(&stcRegion, 3UL, 1UL);
+    TEST_ASSERT_EQ(LL_OK, DMC_MEM_PoolInit(&stcPool, &stcRegion, 100UL, 600UL));
+    TEST_ASSERT_EQ(600UL, DMC_MEM_PoolGetFree(&stcPool));
+    /* 104 byte blocks after the 8 byte aligned start */
+    TEST_ASSERT_EQ(u32Base + 8UL + (600UL * 104UL), DMC_MEM_ArenaMark(&stcRegion));
+    TEST_ASSERT_EQ(LL_ERR_BUF_FULL, DMC_MEM_PoolInit(&stcPool, &stcRegion, 100UL, 600UL));
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, DMC_MEM_PoolInit(&stcPool, &stcRegion, 0UL, 1UL));
+
+    /* Random alloc and free, blocks distinct, aligned and kept intact */
+    TEST_ASSERT_EQ(LL_OK, DMC_MEM_ArenaReset(&stcRegion, 0UL));
+    TEST_ASSERT_EQ(LL_OK, DMC_MEM_PoolInit(&stcPool, &stcRegion, 100UL, 600UL));
+    TEST_Seed(4242UL);
+    for (n = 0UL; n < 200000UL; n++) {
+        if ((0UL == u32Used) || ((u32Used < 600UL) && (0UL != (TEST_Rand() % 2UL)))) {
+            apvBlk[u32Used] = DMC_MEM_PoolAlloc(&stcPool);
+            TEST_ASSERT(NULL != apvBlk[u32Used]);
+            TEST_ASSERT_EQ(0UL, (uintptr_t)apvBlk[u32Used] & (DMC_MEM_POOL_ALIGN - 1UL));
+            (void)memset(apvBlk[u32Used], (int)(((uintptr_t)apvBlk[u32Used] >> 3U) & 0xFFU), 100UL);
+            u32Used++;
+        } else {
+            i = TEST_Rand() % u32Used;
+            for (j = 0UL; j < 100UL; j++) {
+                if (((uint8_t *)apvBlk[i])[j] != (uint8_t)(((uintptr_t)apvBlk[i] >> 3U) & 0xFFU)) {
+                    break;
+                }
+            }
+            TEST_ASSERT_EQ(100UL, j);
+            TEST_ASSERT_EQ(LL_OK, DMC_MEM_PoolFree(&stcPool, apvBlk[i]));
+            u32Used--;
+            apvBlk[i] = apvBlk[u32Used];
+        }
+        TEST_ASSERT_EQ(600UL - u32Used, DMC_MEM_PoolGetFree(&stcPool));
+        if ((600UL - u32Used) < u32MinFree) {
+            u32MinFree = 600UL - u32Used;
+        }
+    }
+    TEST_ASSERT_EQ(u32MinFree, stcPool.u32MinFreeNum);
+
+    /* Exhaustion, then blocks outside of the pool or misaligned */
+    while (u32Used < 600UL) {
+        apvBlk[u32Used] = DMC_MEM_PoolAlloc(&stcPool);
+        u32Used++;
+    }
+    TEST_ASSERT(NULL == DMC_MEM_PoolAlloc(&stcPool));
+    TEST_ASSERT_EQ(0UL, stcPool.u32MinFreeNum);
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, DMC_MEM_PoolFree(&stcPool, (uint8_t *)apvBlk[0] + 8));
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, DMC_MEM_PoolFree(&stcPool, m_pu8Region + (64UL * 1024UL)));
+    TEST_ASSERT_EQ(0UL, DMC_MEM_PoolGetFree(&stcPool));
+}
+
+static void TestMemTest(void)
+{
+    stc_dmc_mem_region_t stcRegion;
+    stc_dmc_mem_test_t stcTest;
+    const uint32_t u32Base = (uint32_t)(uintptr_t)m_pu8Region;
+    uint32_t u32FailAddr = 0UL;
+    uint8_t *pu8Alias;
+    FILE *pFile;
+    int iFd;
+
+    /* Good memory, whole region */
+    TEST_ASSERT_EQ(LL_OK, DMC_MEM_RegionInit(&stcRegion, u32Base, REGION_SIZE));
+    (void)DMC_MEM_TestStructInit(&stcTest);
+    TEST_ASSERT_EQ(LL_OK, DMC_MEM_Test(&stcRegion, &stcTest, &u32FailAddr));
+
+    /* A window leaves the rest of the region untouched when the bus test is off */
+    (void)memset(m_pu8Region, 0x5A, REGION_SIZE);
+    stcTest.u32Offset = 4096UL;
+    stcTest.u32Size   = 8192UL;
+    stcTest.enBusTest = DISABLE;
+    TEST_ASSERT_EQ(LL_OK, DMC_MEM_Test(&stcRegion, &stcTest, &u32FailAddr));
+    TEST_ASSERT_EQ(0x5AU, m_pu8Region[4095]);
+    TEST_ASSERT_EQ(0x5AU, m_pu8Region[4096UL + 8192UL]);
+    TEST_ASSERT_EQ(0x55U, m_pu8Region[4096]);
+    stcTest.u32Offset = 2UL;
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, DMC_MEM_Test(&stcRegion, &stcTest, &u32FailAddr));
+    stcTest.u32Offset = REGION_SIZE;
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, DMC_MEM_Test(&stcRegion, &stcTest, &u32FailAddr));
+
+    /* The same pages twice: the address line of ALIAS_SIZE is open */
+    pFile = tmpfile();
+    TEST_ASSERT(NULL != pFile);
+    if (NULL == pFile) {
+        return;
+    }
+    iFd = fileno(pFile);
+    TEST_ASSERT_EQ(0, ftruncate(iFd, (off_t)ALIAS_SIZE));
+    pu8Alias = (uint8_t *)MapLow(REGION_HINT + (2UL * REGION_SIZE), 2UL * ALIAS_SIZE);
+    TEST_ASSERT(NULL != pu8Alias);
+    if (NULL != pu8Alias) {
+        TEST_ASSERT(MAP_FAILED != mmap(pu8Alias, ALIAS_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, iFd, 0));
+        TEST_ASSERT(MAP_FAILED != mmap(pu8Alias + ALIAS_SIZE, ALIAS_SIZE, PROT_READ | PROT_WRITE,
+                                       MAP_SHARED | MAP_FIXED, iFd, 0));
+        TEST_ASSERT_EQ(LL_OK, DMC_MEM_RegionInit(&stcRegion, (uint32_t)(uintptr_t)pu8Alias, 2UL * ALIAS_SIZE));
+
+        /* Found by the bus test in a few accesses */
+        (void)DMC_MEM_TestStructInit(&stcTest);
+        stcTest.u32Size = 64UL;
+        TEST_ASSERT_EQ(LL_ERR, DMC_MEM_Test(&stcRegion, &stcTest, &u32FailAddr));
+        TEST_ASSERT_EQ((uint32_t)(uintptr_t)pu8Alias + ALIAS_SIZE, u32FailAddr);
+        /* Found by the march test at the first aliased word */
+        stcTest.u32Size   = 0UL;
+        stcTest.enBusTest = DISABLE;
+        TEST_ASSERT_EQ(LL_ERR, DMC_MEM_Test(&stcRegion, &stcTest, &u32FailAddr));
+        TEST_ASSERT_EQ((uint32_t)(uintptr_t)pu8Alias + ALIAS_SIZE, u32FailAddr);
+        /* Missed by a window in one half only */
+        stcTest.u32Size = ALIAS_SIZE;
+        TEST_ASSERT_EQ(LL_OK, DMC_MEM_Test(&stcRegion, &stcTest, &u32FailAddr));
+        (void)munmap(pu8Alias, 2UL * ALIAS_SIZE);
+    }
+    (void)fclose(pFile);
+}
+
+static void Bench(void)
+{
+    static void *apvBlk[BENCH_BLK_NUM];
+    stc_dmc_mem_region_t stcRegion;
+    stc_dmc_mem_pool_t stcPool;
+    double dStart;
+    double dArena;
+    double dPool;
+    double dPoolRand;
+    double dMalloc;
+    uint32_t u32Check = 0UL;
+    uint32_t i;
+    uint32_t n;
+
+    (void)DMC_MEM_RegionInit(&stcRegion, (uint32_t)(uintptr_t)m_pu8Region, REGION_SIZE);
+
+    /* Arena: 64 byte buffers, reset when full */
+    dStart = NowNs();
+    for (n = 0UL; n < BENCH_OPS; n++) {
+        if (NULL == DMC_MEM_ArenaAlloc(&stcRegion, 64UL, 8UL)) {
+            (void)DMC_MEM_ArenaReset(&stcRegion, 0UL);
+        }
+    }
+    dArena = (NowNs() - dStart) / (double)BENCH_OPS;
+
+    /* Pool: alloc and free in stack order, then in random order */
+    (void)DMC_MEM_ArenaReset(&stcRegion, 0UL);
+    (void)DMC_MEM_PoolInit(&stcPool, &stcRegion, 64UL, BENCH_BLK_NUM);
+    dStart = NowNs();
+    for (n = 0UL; n < (BENCH_OPS / BENCH_BLK_NUM); n++) {
+        for (i = 0UL; i < BENCH_BLK_NUM; i++) {
+            apvBlk[i] = DMC_MEM_PoolAlloc(&stcPool);
+        }
+        for (i = BENCH_BLK_NUM; i > 0UL; i--) {
+            u32Check += (uint32_t)DMC_MEM_PoolFree(&stcPool, apvBlk[i - 1UL]);
+        }
+    }
+    dPool = (NowNs() - dStart) / (double)BENCH_OPS;
+    TEST_Seed(7UL);
+    for (i = 0UL; i < BENCH_BLK_NUM; i++) {
+        apvBlk[i] = DMC_MEM_PoolAlloc(&stcPool);
+    }
+    dStart = NowNs();
+    for (n = 0UL; n < BENCH_OPS; n++) {
+        i = TEST_Rand() % BENCH_BLK_NUM;
+        u32Check += (uint32_t)DMC_MEM_PoolFree(&stcPool, apvBlk[i]);
+        apvBlk[i] = DMC_MEM_PoolAlloc(&stcPool);
+    }
+    dPoolRand = (NowNs() - dStart) / (double)BENCH_OPS;
+    TEST_ASSERT_EQ(0UL, u32Check);
+    TEST_ASSERT_EQ(0UL, DMC_MEM_PoolGetFree(&stcPool));
+
+    /* The same random pattern through malloc() */
+    TEST_Seed(7UL);
+    for (i = 0UL; i < BENCH_BLK_NUM; i++) {
+        apvBlk[i] = malloc(64UL);
+    }
+    dStart = NowNs();
+    for (n = 0UL; n < BENCH_OPS; n++) {
+        i = TEST_Rand() % BENCH_BLK_NUM;
+        free(apvBlk[i]);
+        apvBlk[i] = malloc(64UL);
+    }
+    dMalloc = (NowNs() - dStart) / (double)BENCH_OPS;
+    for (i = 0UL; i < BENCH_BLK_NUM; i++) {
+        free(apvBlk[i]);
+    }
+
+    (void)printf("arena alloc %.1f ns, pool alloc+free %.1f ns (stack) %.1f ns (random), malloc+free %.1f ns\n",
+                 dArena, dPool, dPoolRand, dMalloc);
+}
+
+int main(void)
+{
+    m_pu8Region = (uint8_t *)MapLow(REGION_HINT, REGION_SIZE);
+    TEST_ASSERT(NULL != m_pu8Region);
+    if (NULL != m_pu8Region) {
+        TestChip();
+        TestArena();
+        TestPool();
+        TestMemTest();
+        Bench();
+        (void)munmap(m_pu8Region, REGION_SIZE);
+    }
+    return TEST_Result("dmc_mem");
+}
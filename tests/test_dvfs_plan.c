@@ -0,0 +1,442 @@
+/**
+ *******************************************************************************
+ * @file  test_dvfs_plan.c
+ * @brief DVFS transitions: random operating point tables run through
+ *        DVFS_SetOpp() on the clock tree model, checked after every write
+ *        against the bus clocks of both points, the wait cycles needed by the
+ *        HCLK and the ultra low speed limit. Also the plans of single pairs,
+ *        the rejection of a source at two frequencies, a refusing notifier,
+ *        a failing step and a benchmark of DVFS_Plan().
+ *******************************************************************************
+ */
+#define _GNU_SOURCE
+#include <string.h>
+#include <time.h>
+#include "test.h"
+#include "fake_clk.h"
+#include "hc32_ll_dvfs.h"
+
+#define MHZ                             (1000000UL)
+#define OPP_MAX                         (8U)
+#define TABLES                          (500UL)
+
+#define BENCH_OPS                       (1000000UL)
+
+static const uint32_t m_au32BusMask[7] = {
+    CMU_SCFGR_HCLKS, CMU_SCFGR_PCLK0S, CMU_SCFGR_PCLK1S, CMU_SCFGR_PCLK2S,
+    CMU_SCFGR_PCLK3S, CMU_SCFGR_PCLK4S, CMU_SCFGR_EXCKS,
+};
+static const uint32_t m_au32BusPos[7] = {
+    CMU_SCFGR_HCLKS_POS, CMU_SCFGR_PCLK0S_POS, CMU_SCFGR_PCLK1S_POS, CMU_SCFGR_PCLK2S_POS,
+    CMU_SCFGR_PCLK3S_POS, CMU_SCFGR_PCLK4S_POS, CMU_SCFGR_EXCKS_POS,
+};
+static const uint32_t m_au32BusMax[7] = {
+    240UL * MHZ, 240UL * MHZ, 120UL * MHZ, 60UL * MHZ, 50UL * MHZ, 120UL * MHZ, 120UL * MHZ,
+};
+
+static uint32_t m_au32SrcFreq[CLK_SYSCLK_SRC_PLL + 1U];
+static stc_clock_freq_t m_stcFromFreq;
+static stc_clock_freq_t m_stcToFreq;
+static uint32_t m_u32CheckFail;
+
+static double NowNs(void)
+{
+    struct timespec stcTs;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &stcTs);
+    return ((double)stcTs.tv_sec * 1e9) + (double)stcTs.tv_nsec;
+}
+
+/* Wait cycles needed by an HCLK */
+static uint32_t EfmWait(uint32_t u32Hclk)
+{
+    return ((u32Hclk + (40UL * MHZ) - 1UL) / (40UL * MHZ) - 1UL) << EFM_FRMC_FLWT_POS;
+}
+
+static uint32_t SramhWait(uint32_t u32Hclk)
+{
+    return (u32Hclk > (200UL * MHZ)) ? SRAM_WAIT_CYCLE1 : SRAM_WAIT_CYCLE0;
+}
+
+static uint32_t SramWait(uint32_t u32Hclk)
+{
+    return (u32Hclk > (100UL * MHZ)) ? SRAM_WAIT_CYCLE1 : SRAM_WAIT_CYCLE0;
+}
+
+static uint16_t GpioWait(uint32_t u32Hclk)
+{
+    return (uint16_t)(((u32Hclk + (42UL * MHZ) - 1UL) / (42UL * MHZ) - 1UL) << GPIO_PCCR_RDWT_POS);
+}
+
+static uint32_t BusFreq(const stc_clock_freq_t *pstcClockFreq, uint32_t u32Bus)
+{
+    const uint32_t au32Freq[7] = {
+        pstcClockFreq->u32HclkFreq, pstcClockFreq->u32Pclk0Freq, pstcClockFreq->u32Pclk1Freq,
+        pstcClockFreq->u32Pclk2Freq, pstcClockFreq->u32Pclk3Freq, pstcClockFreq->u32Pclk4Freq,
+        pstcClockFreq->u32ExclkFreq,
+    };
+
+    return au32Freq[u32Bus];
+}
+
+static void OppState(const stc_dvfs_opp_t *pstcOpp, stc_fake_clk_state_t *pstcState)
+{
+    pstcState->u8Src        = pstcOpp->u8SysClockSrc;
+    pstcState->u32Div       = pstcOpp->u32ClockDiv;
+    pstcState->u32EfmWait   = pstcOpp->u32EfmWait;
+    pstcState->u32SramhWait = pstcOpp->u32SramhWait;
+    pstcState->u32SramWait  = pstcOpp->u32SramWait;
+    pstcState->u16GpioWait  = pstcOpp->u16GpioWait;
+    pstcState->u8UlowSpeed  = (DVFS_PWR_ULOW_SPEED == pstcOpp->u8PowerMode) ? 1U : 0U;
+}
+
+static void StateFreq(const stc_fake_clk_state_t *pstcState, stc_clock_freq_t *pstcClockFreq)
+{
+    const uint32_t u32Sysclk = m_au32SrcFreq[pstcState->u8Src];
+    uint32_t au32Freq[7];
+    uint32_t i;
+
+    for (i = 0UL; i < 7UL; i++) {
+        au32Freq[i] = u32Sysclk >> ((pstcState->u32Div & m_au32BusMask[i]) >> m_au32BusPos[i]);
+    }
+    pstcClockFreq->u32SysclkFreq = u32Sysclk;
+    pstcClockFreq->u32HclkFreq   = au32Freq[0];
+    pstcClockFreq->u32Pclk0Freq  = au32Freq[1];
+    pstcClockFreq->u32Pclk1Freq  = au32Freq[2];
+    pstcClockFreq->u32Pclk2Freq  = au32Freq[3];
+    pstcClockFreq->u32Pclk3Freq  = au32Freq[4];
+    pstcClockFreq->u32Pclk4Freq  = au32Freq[5];
+    pstcClockFreq->u32ExclkFreq  = au32Freq[6];
+}
+
+static uint8_t StateEq(const stc_fake_clk_state_t *pstcA, const stc_fake_clk_state_t *pstcB)
+{
+    return (uint8_t)((pstcA->u8Src == pstcB->u8Src) && (pstcA->u32Div == pstcB->u32Div) &&
+                     (pstcA->u32EfmWait == pstcB->u32EfmWait) && (pstcA->u32SramhWait == pstcB->u32SramhWait) &&
+                     (pstcA->u32SramWait == pstcB->u32SramWait) && (pstcA->u16GpioWait == pstcB->u16GpioWait) &&
+                     (pstcA->u8UlowSpeed == pstcB->u8UlowSpeed));
+}
+
+static void OppFreq(const stc_dvfs_opp_t *pstcOpp, stc_clock_freq_t *pstcClockFreq)
+{
+    stc_fake_clk_state_t stcState;
+
+    OppState(pstcOpp, &stcState);
+    StateFreq(&stcState, pstcClockFreq);
+}
+
+/* Every intermediate state: no bus beyond both points, enough wait cycles for
+   the HCLK, a slow clock in the ultra low speed mode */
+static void Check(const stc_fake_clk_state_t *pstcState)
+{
+    stc_clock_freq_t stcFreq;
+    uint32_t u32Max;
+    uint32_t i;
+
+    StateFreq(pstcState, &stcFreq);
+    for (i = 0UL; i < 7UL; i++) {
+        u32Max = BusFreq(&m_stcFromFreq, i);
+        if (BusFreq(&m_stcToFreq, i) > u32Max) {
+            u32Max = BusFreq(&m_stcToFreq, i);
+        }
+        if (BusFreq(&stcFreq, i) > u32Max) {
+            m_u32CheckFail++;
+        }
+    }
+    if ((pstcState->u32EfmWait < EfmWait(stcFreq.u32HclkFreq)) ||
+        (pstcState->u32SramhWait < SramhWait(stcFreq.u32HclkFreq)) ||
+        (pstcState->u32SramWait < SramWait(stcFreq.u32HclkFreq)) ||
+        (pstcState->u16GpioWait < GpioWait(stcFreq.u32HclkFreq))) {
+        m_u32CheckFail++;
+    }
+    if ((0U != pstcState->u8UlowSpeed) && (stcFreq.u32SysclkFreq > FAKE_CLK_ULOW_SPEED_MAX)) {
+        m_u32CheckFail++;
+    }
+}
+
+/* Source frequencies of a table, the PLL is set up once by the user */
+static void RandSrc(void)
+{
+    const uint32_t au32Pll[] = {100UL * MHZ, 120UL * MHZ, 168UL * MHZ, 200UL * MHZ, 240UL * MHZ};
+
+    m_au32SrcFreq[CLK_SYSCLK_SRC_HRC]    = HRC_VALUE;
+    m_au32SrcFreq[CLK_SYSCLK_SRC_MRC]    = 8UL * MHZ;
+    m_au32SrcFreq[CLK_SYSCLK_SRC_LRC]    = 32768UL;
+    m_au32SrcFreq[CLK_SYSCLK_SRC_XTAL]   = XTAL_VALUE;
+    m_au32SrcFreq[CLK_SYSCLK_SRC_XTAL32] = 32768UL;
+    m_au32SrcFreq[CLK_SYSCLK_SRC_PLL]    = au32Pll[TEST_Rand() % (sizeof(au32Pll) / sizeof(au32Pll[0]))];
+}
+
+/* A legal operating point of a random source with random dividers and slack */
+static void RandOpp(stc_dvfs_opp_t *pstcOpp)
+{
+    stc_clock_freq_t stcFreq;
+    uint32_t au32Hclk[4];
+    uint32_t u32Shift;
+    uint32_t i;
+
+    (void)memset(pstcOpp, 0, sizeof(*pstcOpp));
+    pstcOpp->u8SysClockSrc = (uint8_t)(TEST_Rand() % (CLK_SYSCLK_SRC_PLL + 1U));
+    pstcOpp->u32SysclkFreq = m_au32SrcFreq[pstcOpp->u8SysClockSrc];
+    for (i = 0UL; i < 7UL; i++) {
+        u32Shift = 0UL;
+        while ((pstcOpp->u32SysclkFreq >> u32Shift) > m_au32BusMax[i]) {
+            u32Shift++;
+        }
+        u32Shift += TEST_Rand() % 3UL;
+        if (u32Shift > 6UL) {
+            u32Shift = 6UL;
+        }
+        pstcOpp->u32ClockDiv |= (u32Shift << m_au32BusPos[i]) & m_au32BusMask[i];
+    }
+    OppFreq(pstcOpp, &stcFreq);
+    /* Each wait cycle for the HCLK or, with slack, for the fastest one */
+    for (i = 0UL; i < 4UL; i++) {
+        au32Hclk[i] = (0UL == (TEST_Rand() % 4UL)) ? (240UL * MHZ) : stcFreq.u32HclkFreq;
+    }
+    pstcOpp->u32EfmWait   = EfmWait(au32Hclk[0]);
+    pstcOpp->u32SramhWait = SramhWait(au32Hclk[1]);
+    pstcOpp->u32SramWait  = SramWait(au32Hclk[2]);
+    pstcOpp->u16GpioWait  = GpioWait(au32Hclk[3]);
+    pstcOpp->u8PowerMode  = DVFS_PWR_HIGH_SPEED;
+    if ((pstcOpp->u32SysclkFreq <= FAKE_CLK_ULOW_SPEED_MAX) && (0UL != (TEST_Rand() % 2UL))) {
+        pstcOpp->u8PowerMode = DVFS_PWR_ULOW_SPEED;
+    }
+}
+
+static void Setup(stc_dvfs_t *pstcDvfs, const stc_dvfs_opp_t *pstcOpp, uint8_t u8OppNum, uint8_t u8Cur)
+{
+    stc_fake_clk_state_t stcState;
+
+    OppState(&pstcOpp[u8Cur], &stcState);
+    FAKE_CLK_Reset(m_au32SrcFreq, &stcState);
+    FAKE_CLK_SetCheck(Check);
+    TEST_ASSERT_EQ(LL_OK, DVFS_Init(pstcDvfs, pstcOpp, u8OppNum, u8Cur));
+    TEST_ASSERT(0UL != (HOST_DWT.CTRL & DWT_CTRL_CYCCNTENA_Msk));
+}
+
+static void TestTransition(void)
+{
+    stc_dvfs_opp_t astcOpp[OPP_MAX];
+    stc_fake_clk_state_t stcState;
+    stc_fake_clk_state_t stcWant;
+    stc_dvfs_t stcDvfs;
+    uint32_t u32LastNs;
+    uint32_t u32MaxNs;
+    uint32_t u32Write;
+    uint32_t u32Begin;
+    uint8_t u8Num;
+    uint8_t u8To;
+    uint32_t t;
+    uint32_t n;
+    uint32_t i;
+
+    TEST_Seed(1UL);
+    for (t = 0UL; t < TABLES; t++) {
+        RandSrc();
+        u8Num = (uint8_t)(2UL + (TEST_Rand() % (OPP_MAX - 1UL)));
+        for (i = 0UL; i < u8Num; i++) {
+            RandOpp(&astcOpp[i]);
+        }
+        Setup(&stcDvfs, astcOpp, u8Num, 0U);
+        m_u32CheckFail = 0UL;
+        u32MaxNs = 0UL;
+
+        for (n = 0UL; n < 40UL; n++) {
+            const uint8_t u8From = DVFS_GetOpp(&stcDvfs);
+
+            u8To = (uint8_t)(TEST_Rand() % u8Num);
+            OppFreq(&astcOpp[u8From], &m_stcFromFreq);
+            OppFreq(&astcOpp[u8To], &m_stcToFreq);
+            u32Write = FAKE_CLK_GetWriteCount();
+            u32Begin = FAKE_CLK_GetBeginCount();
+
+            TEST_ASSERT_EQ(LL_OK, DVFS_SetOpp(&stcDvfs, u8To));
+            TEST_ASSERT_EQ(u8To, DVFS_GetOpp(&stcDvfs));
+            FAKE_CLK_GetState(&stcState);
+            OppState(&astcOpp[u8To], &stcWant);
+            TEST_ASSERT(0U != StateEq(&stcWant, &stcState));
+
+            if (u8To == u8From) {
+                TEST_ASSERT_EQ(u32Write, FAKE_CLK_GetWriteCount());
+                TEST_ASSERT_EQ(u32Begin, FAKE_CLK_GetBeginCount());
+            } else {
+                /* One change for the whole transition, closed with the new frequencies */
+                TEST_ASSERT_EQ(u32Begin + 1UL, FAKE_CLK_GetBeginCount());
+                TEST_ASSERT_EQ(FAKE_CLK_GetBeginCount(), FAKE_CLK_GetEndCount());
+                TEST_ASSERT_EQ(CLK_NOTIFY_POST, FAKE_CLK_GetEndEvent());
+                DVFS_GetLatency(&stcDvfs, &u32LastNs, &u32MaxNs);
+                TEST_ASSERT((FAKE_CLK_GetWriteCount() == u32Write) || (u32LastNs > 0UL));
+                TEST_ASSERT(u32MaxNs >= u32LastNs);
+            }
+        }
+        TEST_ASSERT_EQ(0UL, m_u32CheckFail);
+        TEST_ASSERT_EQ(0UL, FAKE_CLK_GetViolation());
+    }
+}
+
+static void TestPlan(void)
+{
+    stc_dvfs_opp_t stcFrom;
+    stc_dvfs_opp_t stcTo;
+    stc_dvfs_plan_t stcPlan;
+    uint32_t u32Seen;
+    uint32_t n;
+    uint32_t i;
+
+    (void)memset(&stcFrom, 0, sizeof(stcFrom));
+    (void)memset(&stcTo, 0, sizeof(stcTo));
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, DVFS_Plan(NULL, &stcTo, &stcPlan));
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, DVFS_Plan(&stcFrom, NULL, &stcPlan));
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, DVFS_Plan(&stcFrom, &stcTo, NULL));
+
+    TEST_Seed(2UL);
+    for (n = 0UL; n < 100000UL; n++) {
+        RandSrc();
+        RandOpp(&stcFrom);
+        RandOpp(&stcTo);
+        TEST_ASSERT_EQ(LL_OK, DVFS_Plan(&stcFrom, &stcTo, &stcPlan));
+        TEST_ASSERT(stcPlan.u8StepNum <= DVFS_STEP_MAX);
+        u32Seen = 0UL;
+        for (i = 0UL; i < stcPlan.u8StepNum; i++) {
+            TEST_ASSERT(stcPlan.au8Step[i] < DVFS_STEP_MAX);
+            TEST_ASSERT_EQ(0UL, u32Seen & (1UL << stcPlan.au8Step[i]));
+            u32Seen |= 1UL << stcPlan.au8Step[i];
+        }
+        /* A step for each difference, none without one */
+        TEST_ASSERT_EQ(stcFrom.u8SysClockSrc != stcTo.u8SysClockSrc, 0UL != (u32Seen & (1UL << DVFS_STEP_CLK_SRC)));
+        TEST_ASSERT_EQ(stcFrom.u32ClockDiv != stcTo.u32ClockDiv, 0UL != (u32Seen & (1UL << DVFS_STEP_CLK_DIV)));
+        TEST_ASSERT_EQ(stcFrom.u8PowerMode > stcTo.u8PowerMode, 0UL != (u32Seen & (1UL << DVFS_STEP_HIGH_SPEED)));
+        TEST_ASSERT_EQ(stcFrom.u8PowerMode < stcTo.u8PowerMode, 0UL != (u32Seen & (1UL << DVFS_STEP_ULOW_SPEED)));
+        TEST_ASSERT_EQ((stcFrom.u32EfmWait < stcTo.u32EfmWait) || (stcFrom.u32SramhWait < stcTo.u32SramhWait) ||
+                       (stcFrom.u32SramWait < stcTo.u32SramWait) || (stcFrom.u16GpioWait < stcTo.u16GpioWait),
+                       0UL != (u32Seen & (1UL << DVFS_STEP_WAIT_RAISE)));
+        TEST_ASSERT_EQ((stcFrom.u32EfmWait > stcTo.u32EfmWait) || (stcFrom.u32SramhWait > stcTo.u32SramhWait) ||
+                       (stcFrom.u32SramWait > stcTo.u32SramWait) || (stcFrom.u16GpioWait > stcTo.u16GpioWait),
+                       0UL != (u32Seen & (1UL << DVFS_STEP_WAIT_FINAL)));
+    }
+
+    /* Identical points */
+    RandOpp(&stcFrom);
+    TEST_ASSERT_EQ(LL_OK, DVFS_Plan(&stcFrom, &stcFrom, &stcPlan));
+    TEST_ASSERT_EQ(0U, stcPlan.u8StepNum);
+}
+
+static void TestReject(void)
+{
+    stc_dvfs_opp_t astcOpp[3];
+    stc_dvfs_plan_t stcPlan;
+    stc_dvfs_t stcDvfs;
+
+    TEST_Seed(3UL);
+    RandSrc();
+    m_au32SrcFreq[CLK_SYSCLK_SRC_PLL] = 240UL * MHZ;
+    RandOpp(&astcOpp[0]);
+    RandOpp(&astcOpp[1]);
+    RandOpp(&astcOpp[2]);
+    astcOpp[0].u8SysClockSrc = CLK_SYSCLK_SRC_PLL;
+    astcOpp[0].u32SysclkFreq = 240UL * MHZ;
+    astcOpp[1].u8SysClockSrc = CLK_SYSCLK_SRC_MRC;
+    astcOpp[1].u32SysclkFreq = 8UL * MHZ;
+    astcOpp[2].u8SysClockSrc = CLK_SYSCLK_SRC_PLL;
+    astcOpp[2].u32SysclkFreq = 240UL * MHZ;
+
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, DVFS_Init(NULL, astcOpp, 3U, 0U));
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, DVFS_Init(&stcDvfs, NULL, 3U, 0U));
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, DVFS_Init(&stcDvfs, astcOpp, 3U, 3U));
+    TEST_ASSERT_EQ(LL_OK, DVFS_Init(&stcDvfs, astcOpp, 3U, 0U));
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, DVFS_SetOpp(&stcDvfs, 3U));
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, DVFS_SetOpp(NULL, 0U));
+
+    /* The PLL cannot run at 240 MHz and 120 MHz without new settings */
+    astcOpp[2].u32SysclkFreq = 120UL * MHZ;
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, DVFS_Init(&stcDvfs, astcOpp, 3U, 1U));
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, DVFS_Plan(&astcOpp[0], &astcOpp[2], &stcPlan));
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, DVFS_Plan(&astcOpp[2], &astcOpp[0], &stcPlan));
+    TEST_ASSERT_EQ(LL_OK, DVFS_Plan(&astcOpp[1], &astcOpp[2], &stcPlan));
+    TEST_ASSERT_EQ(LL_OK, DVFS_Init(&stcDvfs, astcOpp, 2U, 1U));
+}
+
+static void TestAbort(void)
+{
+    stc_dvfs_opp_t astcOpp[2];
+    stc_fake_clk_state_t stcState;
+    stc_fake_clk_state_t stcWant;
+    stc_dvfs_t stcDvfs;
+    uint32_t u32Write;
+
+    TEST_Seed(4UL);
+    RandSrc();
+    m_au32SrcFreq[CLK_SYSCLK_SRC_PLL] = 240UL * MHZ;
+    do {
+        RandOpp(&astcOpp[0]);
+        RandOpp(&astcOpp[1]);
+    } while ((astcOpp[1].u8SysClockSrc != CLK_SYSCLK_SRC_PLL) || (astcOpp[0].u32SysclkFreq >= (100UL * MHZ)) ||
+             (astcOpp[1].u32EfmWait <= astcOpp[0].u32EfmWait));
+
+    /* Refused by a notifier: nothing is written, no change to end */
+    Setup(&stcDvfs, astcOpp, 2U, 0U);
+    FAKE_CLK_SetPreRet(LL_ERR_BUSY);
+    TEST_ASSERT_EQ(LL_ERR_BUSY, DVFS_SetOpp(&stcDvfs, 1U));
+    TEST_ASSERT_EQ(0U, DVFS_GetOpp(&stcDvfs));
+    TEST_ASSERT_EQ(0UL, FAKE_CLK_GetWriteCount());
+    TEST_ASSERT_EQ(0UL, FAKE_CLK_GetEndCount());
+    FAKE_CLK_GetState(&stcState);
+    OppState(&astcOpp[0], &stcWant);
+    TEST_ASSERT(0U != StateEq(&stcWant, &stcState));
+
+    /* The EFM wait raise fails: the clock is left alone and the change is aborted */
+    FAKE_CLK_SetPreRet(LL_OK);
+    FAKE_CLK_SetEfmRet(LL_ERR_TIMEOUT);
+    u32Write = FAKE_CLK_GetWriteCount();
+    TEST_ASSERT_EQ(LL_ERR_TIMEOUT, DVFS_SetOpp(&stcDvfs, 1U));
+    TEST_ASSERT_EQ(0U, DVFS_GetOpp(&stcDvfs));
+    TEST_ASSERT_EQ(1UL, FAKE_CLK_GetEndCount());
+    TEST_ASSERT_EQ(CLK_NOTIFY_ABORT, FAKE_CLK_GetEndEvent());
+    FAKE_CLK_GetState(&stcState);
+    TEST_ASSERT_EQ(astcOpp[0].u8SysClockSrc, stcState.u8Src);
+    TEST_ASSERT_EQ(astcOpp[0].u32ClockDiv, stcState.u32Div);
+    TEST_ASSERT(FAKE_CLK_GetWriteCount() > u32Write);
+
+    /* Retried once the EFM is ready */
+    FAKE_CLK_SetEfmRet(LL_OK);
+    OppFreq(&astcOpp[0], &m_stcFromFreq);
+    OppFreq(&astcOpp[1], &m_stcToFreq);
+    m_u32CheckFail = 0UL;
+    TEST_ASSERT_EQ(LL_OK, DVFS_SetOpp(&stcDvfs, 1U));
+    TEST_ASSERT_EQ(1U, DVFS_GetOpp(&stcDvfs));
+    TEST_ASSERT_EQ(CLK_NOTIFY_POST, FAKE_CLK_GetEndEvent());
+    TEST_ASSERT_EQ(0UL, m_u32CheckFail);
+    TEST_ASSERT_EQ(0UL, FAKE_CLK_GetViolation());
+}
+
+static void Bench(void)
+{
+    stc_dvfs_opp_t astcOpp[OPP_MAX];
+    stc_dvfs_plan_t stcPlan;
+    volatile uint32_t u32Sink = 0UL;
+    double dStart;
+    uint32_t n;
+
+    TEST_Seed(5UL);
+    RandSrc();
+    for (n = 0UL; n < OPP_MAX; n++) {
+        RandOpp(&astcOpp[n]);
+    }
+    dStart = NowNs();
+    for (n = 0UL; n < BENCH_OPS; n++) {
+        (void)DVFS_Plan(&astcOpp[n % OPP_MAX], &astcOpp[(n / OPP_MAX) % OPP_MAX], &stcPlan);
+        u32Sink += stcPlan.u8StepNum;
+    }
+    printf("DVFS_Plan: %.1f ns/op\n", (NowNs() - dStart) / (double)BENCH_OPS);
+}
+
+int main(void)
+{
+    TestTransition();
+    TestPlan();
+    TestReject();
+    TestAbort();
+    Bench();
+    return TEST_Result("dvfs_plan");
+}
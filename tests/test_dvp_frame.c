@@ -0,0 +1,395 @@
+/**
+ *******************************************************************************
+ * @file  test_dvp_frame.c
+ * @brief DVP frame pipeline against a DVP signal model: the line count and the
+ *        data of cropped frames against DVP_FRAME_CalcGeometry(), frames split
+ *        over several descriptors, incomplete frames dropped, consumer stalls
+ *        and JPEG frame detection.
+ *******************************************************************************
+ */
+#include <string.h>
+#include "test.h"
+#include "fake_dma.h"
+#include "fake_dvp.h"
+#include "hc32_ll_dvp_frame.h"
+
+#define BUF_NUM                         (3U)
+#define BUF_WORDS                       (160000UL)
+#define NO_ERR                          (0xFFFFFFFFUL)
+
+static stc_dvp_frame_pipe_t m_stcPipe;
+static uint32_t m_au32Buf[BUF_NUM][BUF_WORDS];
+static uint32_t m_u32ReadyNum;
+
+static void DvpIrq(void)
+{
+    DVP_FRAME_IrqHandler(&m_stcPipe);
+}
+
+static void Ready(stc_dvp_frame_pipe_t *pstcPipe, void *pvArg)
+{
+    TEST_ASSERT(pvArg == &m_stcPipe);
+    m_u32ReadyNum++;
+}
+
+static void SetupDvp(uint32_t u32DataWidth, const stc_dvp_crop_window_config_t *pstcCrop)
+{
+    stc_dvp_init_t stcDvpInit;
+
+    FAKE_DMA_Reset();
+    FAKE_DVP_Reset();
+    FAKE_DVP_SetIrq(&DvpIrq);
+    m_u32ReadyNum = 0UL;
+
+    (void)DVP_StructInit(&stcDvpInit);
+    stcDvpInit.u32DataWidth   = u32DataWidth;
+    stcDvpInit.u32CaptureMode = DVP_CAPT_MD_CONT_FRAME;
+    (void)DVP_Init(&stcDvpInit);
+    if (NULL != pstcCrop) {
+        (void)DVP_CropWindowConfig(pstcCrop);
+        DVP_CropCmd(ENABLE);
+    }
+}
+
+static int32_t SetupPipe(uint8_t u8Mode, uint8_t u8BufNum, uint32_t u32BufSize, uint32_t u32Lines,
+                         uint32_t u32LineBytes)
+{
+    stc_dvp_frame_init_t stcInit;
+    uint8_t i;
+
+    (void)DVP_FRAME_StructInit(&stcInit);
+    stcInit.pstcDmaUnit   = CM_DMA2;
+    stcInit.u8DmaCh       = DMA_CH5;
+    stcInit.u32TrigTarget = AOS_DMA2_5;
+    stcInit.u8Mode        = u8Mode;
+    stcInit.u8BufNum      = u8BufNum;
+    for (i = 0U; i < u8BufNum; i++) {
+        stcInit.apvBuf[i] = m_au32Buf[i];
+    }
+    stcInit.u32BufSize    = u32BufSize;
+    stcInit.u32Lines      = u32Lines;
+    stcInit.u32LineBytes  = u32LineBytes;
+    stcInit.pfnCallback   = &Ready;
+    stcInit.pvArg         = &m_stcPipe;
+    return DVP_FRAME_Init(&m_stcPipe, &stcInit);
+}
+
+static void SendFrame(uint32_t u32Lines, uint32_t u32Clocks, uint32_t u32Seed, uint32_t u32StartLine,
+                      uint32_t u32ErrLine, uint32_t u32ErrFlag)
+{
+    stc_fake_dvp_frame_t stcFrame;
+
+    stcFrame.u32Lines     = u32Lines;
+    stcFrame.u32Clocks    = u32Clocks;
+    stcFrame.u32Seed      = u32Seed;
+    stcFrame.u32StartLine = u32StartLine;
+    stcFrame.u32ErrLine   = u32ErrLine;
+    stcFrame.u32ErrFlag   = u32ErrFlag;
+    FAKE_DVP_Frame(&stcFrame);
+}
+
+/* The frame holds the pixels of the crop window, line by line */
+static uint32_t CheckData(const void *pvBuf, uint32_t u32Seed, uint32_t u32Wide,
+                          const stc_dvp_crop_window_config_t *pstcCrop, uint32_t u32Lines, uint32_t u32LineBytes)
+{
+    const uint8_t *pu8 = (const uint8_t *)pvBuf;
+    const uint16_t *pu16 = (const uint16_t *)pvBuf;
+    const uint32_t u32Row = (NULL != pstcCrop) ? pstcCrop->u16RowStartLine : 0UL;
+    const uint32_t u32Col = (NULL != pstcCrop) ? pstcCrop->u16ColumnStartLine : 0UL;
+    const uint32_t u32Pixels = (0UL != u32Wide) ? (u32LineBytes / 2UL) : u32LineBytes;
+    uint32_t u32Bad = 0UL;
+    uint32_t l;
+    uint32_t c;
+
+    for (l = 0UL; l < u32Lines; l++) {
+        for (c = 0UL; c < u32Pixels; c++) {
+            if (0UL != u32Wide) {
+                u32Bad += (pu16[(l * u32Pixels) + c] != FAKE_DVP_Pixel(u32Seed, u32Row + l, u32Col + c)) ? 1UL : 0UL;
+            } else {
+                u32Bad += (pu8[(l * u32Pixels) + c] != FAKE_DVP_Pixel(u32Seed, u32Row + l, u32Col + c)) ? 1UL : 0UL;
+            }
+        }
+    }
+    return u32Bad;
+}
+
+static void TestInit(void)
+{
+    stc_dvp_frame_init_t stcInit;
+
+    FAKE_DMA_Reset();
+    (void)DVP_FRAME_StructInit(&stcInit);
+    TEST_ASSERT_EQ(DMA_CH0, stcInit.u8DmaCh);
+    TEST_ASSERT_EQ(AOS_DMA1_0, stcInit.u32TrigTarget);
+    TEST_ASSERT_EQ(EVT_SRC_DVP_DMAREQ, stcInit.enEvtSrc);
+    stcInit.pstcDmaUnit = CM_DMA1;
+    stcInit.apvBuf[0]   = m_au32Buf[0];
+    stcInit.apvBuf[1]   = m_au32Buf[1];
+    stcInit.u32BufSize  = 4096UL;
+    stcInit.u32Lines    = 16UL;
+    stcInit.u32LineBytes = 64UL;
+    TEST_ASSERT_EQ(LL_OK, DVP_FRAME_Init(&m_stcPipe, &stcInit));
+    TEST_ASSERT_EQ((uint32_t)EVT_SRC_DVP_DMAREQ, HOST_AOS.DMA1_TRGSEL0);
+
+    /* Target of another channel or unit, or another event */
+    FAKE_DMA_Reset();
+    stcInit.u8DmaCh = DMA_CH2;
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, DVP_FRAME_Init(&m_stcPipe, &stcInit));
+    stcInit.u32TrigTarget = AOS_DMA2_2;
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, DVP_FRAME_Init(&m_stcPipe, &stcInit));
+    stcInit.u32TrigTarget = AOS_DMA1_2;
+    stcInit.enEvtSrc = EVT_SRC_ADC1_EOCA;
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, DVP_FRAME_Init(&m_stcPipe, &stcInit));
+    TEST_ASSERT_EQ(0UL, HOST_AOS.DMA1_TRGSEL2);
+    stcInit.enEvtSrc = EVT_SRC_DVP_DMAREQ;
+    TEST_ASSERT_EQ(LL_OK, DVP_FRAME_Init(&m_stcPipe, &stcInit));
+    TEST_ASSERT_EQ((uint32_t)EVT_SRC_DVP_DMAREQ, HOST_AOS.DMA1_TRGSEL2);
+
+    /* A raw frame larger than the buffers, or not a whole number of words */
+    stcInit.u32Lines = 65UL;
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, DVP_FRAME_Init(&m_stcPipe, &stcInit));
+    stcInit.u32Lines = 3UL;
+    stcInit.u32LineBytes = 5UL;
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, DVP_FRAME_Init(&m_stcPipe, &stcInit));
+}
+
+/* Random sensor frames and crop windows, clipped or not */
+static void TestCrop(void)
+{
+    const uint32_t au32Width[] = {DVP_DATA_WIDTH_8BIT, DVP_DATA_WIDTH_10BIT, DVP_DATA_WIDTH_12BIT,
+                                  DVP_DATA_WIDTH_14BIT};
+    stc_dvp_crop_window_config_t stcCrop;
+    const stc_dvp_crop_window_config_t *pstcCrop;
+    stc_dvp_frame_t stcFrame;
+    uint32_t u32SrcLines;
+    uint32_t u32SrcClocks;
+    uint32_t u32Lines;
+    uint32_t u32LineBytes;
+    uint32_t u32DropCnt;
+    uint32_t u32ErrCnt;
+    uint32_t u32Width;
+    uint32_t u32Run = 0UL;
+    uint32_t n;
+    uint32_t f;
+
+    TEST_Seed(41UL);
+    for (n = 0UL; n < 300UL; n++) {
+        u32Width = au32Width[n % 4UL];
+        u32SrcLines  = 4UL + (TEST_Rand() % 120UL);
+        u32SrcClocks = 4UL + (TEST_Rand() % 200UL);
+        stcCrop.u16RowStartLine    = (uint16_t)(TEST_Rand() % (u32SrcLines + 4UL));
+        stcCrop.u16ColumnStartLine = (uint16_t)(TEST_Rand() % (u32SrcClocks + 4UL));
+        stcCrop.u16RowLineSize     = (uint16_t)(4UL + (TEST_Rand() % u32SrcLines));
+        stcCrop.u16ColumnLineSize  = (uint16_t)(4UL * (1UL + (TEST_Rand() % (u32SrcClocks / 4UL))));
+        pstcCrop = (0UL == (n % 5UL)) ? NULL : &stcCrop;
+
+        SetupDvp(u32Width, pstcCrop);
+        if (LL_OK != DVP_FRAME_CalcGeometry(u32SrcLines, u32SrcClocks, u32Width, pstcCrop, &u32Lines,
+                                            &u32LineBytes)) {
+            /* The window misses the frame: nothing captured */
+            TEST_ASSERT((stcCrop.u16RowStartLine >= u32SrcLines) || (stcCrop.u16ColumnStartLine >= u32SrcClocks));
+            DVP_CaptureCmd(ENABLE);
+            SendFrame(u32SrcLines, u32SrcClocks, n, 0UL, NO_ERR, 0UL);
+            TEST_ASSERT_EQ(0UL, FAKE_DVP_GetLineEndCount());
+            continue;
+        }
+        if (LL_OK != SetupPipe(DVP_FRAME_MD_RAW, BUF_NUM, 4UL * BUF_WORDS, u32Lines, u32LineBytes)) {
+            /* Only frames which are not a whole number of words are refused */
+            TEST_ASSERT(0UL != ((u32Lines * u32LineBytes) & 3UL));
+            continue;
+        }
+        u32Run++;
+        TEST_ASSERT_EQ(LL_OK, DVP_FRAME_Start(&m_stcPipe));
+        for (f = 0UL; f < 3UL; f++) {
+            SendFrame(u32SrcLines, u32SrcClocks, (n * 8UL) + f, 0UL, NO_ERR, 0UL);
+            TEST_ASSERT_EQ(u32Lines * (f + 1UL), FAKE_DVP_GetLineEndCount());
+            TEST_ASSERT_EQ(f + 1UL, m_u32ReadyNum);
+            TEST_ASSERT_EQ(LL_OK, DVP_FRAME_Get(&m_stcPipe, &stcFrame));
+            TEST_ASSERT_EQ(u32Lines * u32LineBytes, stcFrame.u32Len);
+            TEST_ASSERT_EQ(f, stcFrame.u32Seq);
+            TEST_ASSERT_EQ(0UL, CheckData(stcFrame.pvBuf, (n * 8UL) + f, (DVP_DATA_WIDTH_8BIT != u32Width) ? 1UL : 0UL,
+                                          pstcCrop, u32Lines, u32LineBytes));
+            TEST_ASSERT_EQ(LL_OK, DVP_FRAME_Release(&m_stcPipe, stcFrame.pvBuf));
+        }
+        DVP_FRAME_GetStats(&m_stcPipe, &u32DropCnt, &u32ErrCnt);
+        TEST_ASSERT_EQ(0UL, u32DropCnt);
+        TEST_ASSERT_EQ(0UL, u32ErrCnt);
+        DVP_FRAME_Stop(&m_stcPipe);
+    }
+    TEST_ASSERT(u32Run > 150UL);
+}
+
+/* A frame of several descriptors */
+static void TestLarge(void)
+{
+    stc_dvp_frame_t stcFrame;
+    uint32_t u32Lines;
+    uint32_t u32LineBytes;
+
+    SetupDvp(DVP_DATA_WIDTH_12BIT, NULL);
+    TEST_ASSERT_EQ(LL_OK, DVP_FRAME_CalcGeometry(480UL, 640UL, DVP_DATA_WIDTH_12BIT, NULL, &u32Lines, &u32LineBytes));
+    TEST_ASSERT_EQ(480UL, u32Lines);
+    TEST_ASSERT_EQ(1280UL, u32LineBytes);
+    TEST_ASSERT((u32Lines * u32LineBytes) > (2UL * 4UL * DVP_FRAME_SEG_WORDS));
+    TEST_ASSERT_EQ(LL_OK, SetupPipe(DVP_FRAME_MD_RAW, 2U, 4UL * BUF_WORDS, u32Lines, u32LineBytes));
+    TEST_ASSERT_EQ(LL_OK, DVP_FRAME_Start(&m_stcPipe));
+    SendFrame(480UL, 640UL, 7UL, 0UL, NO_ERR, 0UL);
+    TEST_ASSERT_EQ(LL_OK, DVP_FRAME_Get(&m_stcPipe, &stcFrame));
+    TEST_ASSERT_EQ(u32Lines * u32LineBytes, stcFrame.u32Len);
+    TEST_ASSERT_EQ(0UL, CheckData(stcFrame.pvBuf, 7UL, 1UL, NULL, u32Lines, u32LineBytes));
+    DVP_FRAME_Stop(&m_stcPipe);
+}
+
+/* Frames caught partly, corrupted, or longer than the geometry are dropped */
+static void TestIncomplete(void)
+{
+    stc_dvp_crop_window_config_t stcCrop = {10U, 8U, 20U, 32U};
+    stc_dvp_frame_t stcFrame;
+    uint32_t u32DropCnt;
+    uint32_t u32ErrCnt;
+    uint32_t u32Lines;
+    uint32_t u32LineBytes;
+
+    SetupDvp(DVP_DATA_WIDTH_8BIT, &stcCrop);
+    TEST_ASSERT_EQ(LL_OK, DVP_FRAME_CalcGeometry(60UL, 80UL, DVP_DATA_WIDTH_8BIT, &stcCrop, &u32Lines, &u32LineBytes));
+    TEST_ASSERT_EQ(LL_OK, SetupPipe(DVP_FRAME_MD_RAW, BUF_NUM, 4096UL, u32Lines, u32LineBytes));
+    TEST_ASSERT_EQ(LL_OK, DVP_FRAME_Start(&m_stcPipe));
+
+    /* Capture joining inside the window: frame 0 */
+    SendFrame(60UL, 80UL, 0UL, 15UL, NO_ERR, 0UL);
+    /* FIFO overflow and sync error: frames 1 and 2 */
+    SendFrame(60UL, 80UL, 1UL, 0UL, 12UL, DVP_FLAG_FIFO_OVF);
+    SendFrame(60UL, 80UL, 2UL, 0UL, 29UL, DVP_FLAG_SYNC_ERR);
+    /* Good frame 3 */
+    SendFrame(60UL, 80UL, 3UL, 0UL, NO_ERR, 0UL);
+    /* Window taller than configured, the DMA stops at the frame size: frame 4 */
+    stcCrop.u16RowLineSize = 21U;
+    (void)DVP_CropWindowConfig(&stcCrop);
+    SendFrame(60UL, 80UL, 4UL, 0UL, NO_ERR, 0UL);
+    /* Joining in the blank before the window is a whole frame: frame 5 */
+    stcCrop.u16RowLineSize = 20U;
+    (void)DVP_CropWindowConfig(&stcCrop);
+    SendFrame(60UL, 80UL, 5UL, 10UL, NO_ERR, 0UL);
+
+    DVP_FRAME_GetStats(&m_stcPipe, &u32DropCnt, &u32ErrCnt);
+    TEST_ASSERT_EQ(0UL, u32DropCnt);
+    TEST_ASSERT_EQ(4UL, u32ErrCnt);
+    TEST_ASSERT_EQ(2UL, m_u32ReadyNum);
+    TEST_ASSERT_EQ(LL_OK, DVP_FRAME_Get(&m_stcPipe, &stcFrame));
+    TEST_ASSERT_EQ(3UL, stcFrame.u32Seq);
+    TEST_ASSERT_EQ(0UL, CheckData(stcFrame.pvBuf, 3UL, 0UL, &stcCrop, u32Lines, u32LineBytes));
+    TEST_ASSERT_EQ(LL_OK, DVP_FRAME_Get(&m_stcPipe, &stcFrame));
+    TEST_ASSERT_EQ(5UL, stcFrame.u32Seq);
+    TEST_ASSERT_EQ(0UL, CheckData(stcFrame.pvBuf, 5UL, 0UL, &stcCrop, u32Lines, u32LineBytes));
+    TEST_ASSERT_EQ(LL_ERR, DVP_FRAME_Get(&m_stcPipe, &stcFrame));
+    DVP_FRAME_Stop(&m_stcPipe);
+}
+
+/* A slow consumer loses the oldest frames, a held frame is never written */
+static void TestStall(void)
+{
+    stc_dvp_frame_t stcFrame;
+    stc_dvp_frame_t stcHeld;
+    uint32_t u32DropCnt;
+    uint32_t u32ErrCnt;
+    uint32_t f;
+
+    SetupDvp(DVP_DATA_WIDTH_8BIT, NULL);
+    TEST_ASSERT_EQ(LL_OK, SetupPipe(DVP_FRAME_MD_RAW, BUF_NUM, 4096UL, 16UL, 64UL));
+    TEST_ASSERT_EQ(LL_OK, DVP_FRAME_Start(&m_stcPipe));
+
+    /* Nothing taken: the two newest complete frames stay */
+    for (f = 0UL; f < 6UL; f++) {
+        SendFrame(16UL, 64UL, f, 0UL, NO_ERR, 0UL);
+    }
+    DVP_FRAME_GetStats(&m_stcPipe, &u32DropCnt, &u32ErrCnt);
+    TEST_ASSERT_EQ(4UL, u32DropCnt);
+    TEST_ASSERT_EQ(0UL, u32ErrCnt);
+    TEST_ASSERT_EQ(LL_OK, DVP_FRAME_Get(&m_stcPipe, &stcHeld));
+    TEST_ASSERT_EQ(4UL, stcHeld.u32Seq);
+    TEST_ASSERT_EQ(LL_OK, DVP_FRAME_Get(&m_stcPipe, &stcFrame));
+    TEST_ASSERT_EQ(5UL, stcFrame.u32Seq);
+    TEST_ASSERT_EQ(LL_ERR, DVP_FRAME_Get(&m_stcPipe, &stcFrame));
+
+    /* Both held: every new frame is written in the third buffer and dropped */
+    for (f = 6UL; f < 9UL; f++) {
+        SendFrame(16UL, 64UL, f, 0UL, NO_ERR, 0UL);
+    }
+    TEST_ASSERT_EQ(0UL, CheckData(stcHeld.pvBuf, 4UL, 0UL, NULL, 16UL, 64UL));
+    TEST_ASSERT_EQ(0UL, CheckData(stcFrame.pvBuf, 5UL, 0UL, NULL, 16UL, 64UL));
+    DVP_FRAME_GetStats(&m_stcPipe, &u32DropCnt, &u32ErrCnt);
+    TEST_ASSERT_EQ(7UL, u32DropCnt);
+
+    TEST_ASSERT_EQ(LL_OK, DVP_FRAME_Release(&m_stcPipe, stcHeld.pvBuf));
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, DVP_FRAME_Release(&m_stcPipe, stcHeld.pvBuf));
+    /* Two buffers turn again: frame 10 goes to the freed buffer and frame 9 is overwritten by the next one */
+    SendFrame(16UL, 64UL, 9UL, 0UL, NO_ERR, 0UL);
+    SendFrame(16UL, 64UL, 10UL, 0UL, NO_ERR, 0UL);
+    DVP_FRAME_GetStats(&m_stcPipe, &u32DropCnt, &u32ErrCnt);
+    TEST_ASSERT_EQ(8UL, u32DropCnt);
+    TEST_ASSERT_EQ(LL_OK, DVP_FRAME_Get(&m_stcPipe, &stcHeld));
+    TEST_ASSERT_EQ(10UL, stcHeld.u32Seq);
+    TEST_ASSERT_EQ(0UL, CheckData(stcHeld.pvBuf, 10UL, 0UL, NULL, 16UL, 64UL));
+    TEST_ASSERT_EQ(LL_ERR, DVP_FRAME_Get(&m_stcPipe, &stcFrame));
+    TEST_ASSERT(stcHeld.pvBuf != stcFrame.pvBuf);
+    DVP_FRAME_Stop(&m_stcPipe);
+}
+
+static void TestJpeg(void)
+{
+    static uint8_t au8Jpeg[3000];
+    const uint32_t au32Len[] = {100UL, 101UL, 102UL, 103UL, 2000UL};
+    stc_dvp_frame_t stcFrame;
+    uint32_t u32DropCnt;
+    uint32_t u32ErrCnt;
+    uint32_t i;
+    uint32_t n;
+
+    SetupDvp(DVP_DATA_WIDTH_8BIT, NULL);
+    TEST_ASSERT_EQ(LL_OK, SetupPipe(DVP_FRAME_MD_JPEG, 2U, 2048UL, 0UL, 0UL));
+    TEST_ASSERT_EQ(LL_OK, DVP_FRAME_Start(&m_stcPipe));
+
+    TEST_Seed(1041UL);
+    for (n = 0UL; n < (sizeof(au32Len) / sizeof(au32Len[0])); n++) {
+        for (i = 0UL; i < au32Len[n]; i++) {
+            au8Jpeg[i] = (uint8_t)(TEST_Rand() & 0x7FUL);
+        }
+        au8Jpeg[0] = 0xFFU;
+        au8Jpeg[1] = 0xD8U;
+        au8Jpeg[au32Len[n] - 2UL] = 0xFFU;
+        au8Jpeg[au32Len[n] - 1UL] = 0xD9U;
+        /* Padding after the EOI marker */
+        FAKE_DVP_JpegFrame(au8Jpeg, au32Len[n] + (n * 3UL));
+        TEST_ASSERT_EQ(LL_OK, DVP_FRAME_Get(&m_stcPipe, &stcFrame));
+        TEST_ASSERT_EQ(au32Len[n], stcFrame.u32Len);
+        TEST_ASSERT_EQ(0, memcmp(stcFrame.pvBuf, au8Jpeg, au32Len[n]));
+        TEST_ASSERT_EQ(LL_OK, DVP_FRAME_Release(&m_stcPipe, stcFrame.pvBuf));
+    }
+
+    /* No EOI, no SOI, and a frame filling the buffer are dropped */
+    au8Jpeg[98] = 0x00U;
+    FAKE_DVP_JpegFrame(au8Jpeg, 100UL);
+    au8Jpeg[98] = 0xFFU;
+    au8Jpeg[0] = 0x00U;
+    FAKE_DVP_JpegFrame(au8Jpeg, 100UL);
+    au8Jpeg[0] = 0xFFU;
+    au8Jpeg[2998] = 0xFFU;
+    au8Jpeg[2999] = 0xD9U;
+    FAKE_DVP_JpegFrame(au8Jpeg, 3000UL);
+    TEST_ASSERT_EQ(LL_ERR, DVP_FRAME_Get(&m_stcPipe, &stcFrame));
+    DVP_FRAME_GetStats(&m_stcPipe, &u32DropCnt, &u32ErrCnt);
+    TEST_ASSERT_EQ(0UL, u32DropCnt);
+    TEST_ASSERT_EQ(3UL, u32ErrCnt);
+    DVP_FRAME_Stop(&m_stcPipe);
+}
+
+int main(void)
+{
+    TestInit();
+    TestCrop();
+    TestLarge();
+    TestIncomplete();
+    TestStall();
+    TestJpeg();
+    return TEST_Result("dvp_frame");
+}
@@ -0,0 +1,252 @@
+/**
+ *******************************************************************************
+ * @file  test_fmac_block.c
+ * @brief FMAC block filter against the FMAC and DMA models, in the manner of
+ *        the CMSIS-DSP FIR tests: bit exact against FMAC_BLOCK_Reference() for
+ *        every chain length in uneven blocks, impulse and step responses, and
+ *        the SNR of a Q15 low pass against a double precision FIR.
+ *******************************************************************************
+ */
+#include <math.h>
+#include <string.h>
+#include "test.h"
+#include "fake_dma.h"
+#include "fake_fmac.h"
+#include "hc32_ll_fmac_block.h"
+
+#define SIG_LEN                         (600UL)
+#define LPF_TAPS                        (29UL)
+#define SNR_THRESHOLD                   (70.0)
+
+static stc_fmac_block_t m_stcBlock;
+static stc_fmac_coef_set_t m_stcCoef;
+static int16_t m_ai16In[SIG_LEN];
+static int32_t m_ai32Out[SIG_LEN];
+static int32_t m_ai32Ref[SIG_LEN];
+static int16_t m_ai16State[FMAC_BLOCK_TAPS_MAX];
+static uint32_t m_u32DoneNum;
+
+static void DmaIrq(void)
+{
+    FMAC_BLOCK_DmaIrqHandler(&m_stcBlock);
+}
+
+static void Done(stc_fmac_block_t *pstcBlock, int32_t *pi32Out, uint32_t u32Len, void *pvArg)
+{
+    TEST_ASSERT(pvArg == &m_stcBlock);
+    m_u32DoneNum++;
+}
+
+static int16_t RandSample(uint32_t u32Range)
+{
+    return (int16_t)((int32_t)(TEST_Rand() % (2UL * u32Range + 1UL)) - (int32_t)u32Range);
+}
+
+static void Setup(uint32_t u32UnitNum, CM_DMA_TypeDef *pstcDma)
+{
+    stc_fmac_block_init_t stcInit;
+    CM_FMAC_TypeDef *const apstcUnit[] = {CM_FMAC1, CM_FMAC2, CM_FMAC3, CM_FMAC4};
+    uint32_t i;
+
+    FAKE_DMA_Reset();
+    FAKE_FMAC_Reset();
+    FAKE_DMA_SetIrq(CM_DMA1, DMA_CH2, &DmaIrq);
+    m_u32DoneNum = 0UL;
+    (void)memset(m_ai16State, 0, sizeof(m_ai16State));
+
+    (void)FMAC_BLOCK_StructInit(&stcInit);
+    for (i = 0UL; i < u32UnitNum; i++) {
+        stcInit.apstcUnit[i] = apstcUnit[i];
+    }
+    if (NULL != pstcDma) {
+        stcInit.pstcDmaUnit      = pstcDma;
+        stcInit.u8OutCh          = DMA_CH2;
+        stcInit.u8InCh           = DMA_CH5;
+        stcInit.u32OutTrigTarget = AOS_DMA1_2;
+        stcInit.u32InTrigTarget  = AOS_DMA1_5;
+        stcInit.enEvtSrc         = EVT_SRC_FMAC_1;
+        stcInit.pfnCallback      = &Done;
+        stcInit.pvArg            = &m_stcBlock;
+    }
+    TEST_ASSERT_EQ(LL_OK, FMAC_BLOCK_Init(&m_stcBlock, &stcInit));
+}
+
+static void RandCoef(uint32_t u32Taps, uint32_t u32Shift)
+{
+    int16_t ai16Coef[FMAC_BLOCK_TAPS_MAX];
+    uint32_t i;
+
+    for (i = 0UL; i < u32Taps; i++) {
+        ai16Coef[i] = RandSample(32767UL);
+    }
+    TEST_ASSERT_EQ(LL_OK, FMAC_BLOCK_CoefSetInit(&m_stcCoef, ai16Coef, u32Taps, u32Shift));
+}
+
+static void TestInit(void)
+{
+    stc_fmac_block_init_t stcInit;
+
+    (void)FMAC_BLOCK_StructInit(&stcInit);
+    stcInit.apstcUnit[0] = CM_FMAC1;
+    /* The defaults are consistent once a DMA unit is given */
+    stcInit.pstcDmaUnit = CM_DMA1;
+    TEST_ASSERT_EQ(LL_OK, FMAC_BLOCK_Init(&m_stcBlock, &stcInit));
+
+    FAKE_DMA_Reset();
+    stcInit.u32InTrigTarget = AOS_DMA1_2;
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, FMAC_BLOCK_Init(&m_stcBlock, &stcInit));
+    stcInit.u32InTrigTarget = AOS_DMA1_1;
+    stcInit.u32OutTrigTarget = AOS_DMA2_0;
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, FMAC_BLOCK_Init(&m_stcBlock, &stcInit));
+    stcInit.u32OutTrigTarget = AOS_DMA1_0;
+    /* Event of another unit */
+    stcInit.enEvtSrc = EVT_SRC_FMAC_2;
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, FMAC_BLOCK_Init(&m_stcBlock, &stcInit));
+    stcInit.apstcUnit[0] = CM_FMAC2;
+    TEST_ASSERT_EQ(LL_OK, FMAC_BLOCK_Init(&m_stcBlock, &stcInit));
+    /* The result channel must be served first */
+    FAKE_DMA_Reset();
+    stcInit.u8OutCh = DMA_CH1;
+    stcInit.u8InCh = DMA_CH0;
+    stcInit.u32OutTrigTarget = AOS_DMA1_1;
+    stcInit.u32InTrigTarget = AOS_DMA1_0;
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, FMAC_BLOCK_Init(&m_stcBlock, &stcInit));
+    TEST_ASSERT_EQ(0UL, HOST_AOS.DMA1_TRGSEL0 | HOST_AOS.DMA1_TRGSEL1);
+    /* Without DMA the DMA fields are not looked at */
+    stcInit.pstcDmaUnit = NULL;
+    TEST_ASSERT_EQ(LL_OK, FMAC_BLOCK_Init(&m_stcBlock, &stcInit));
+}
+
+static void TestChain(void)
+{
+    const uint32_t au32Taps[] = {1UL, 5UL, 16UL, 17UL, 18UL, 34UL, 35UL, 51UL, 52UL, 68UL};
+    const uint32_t au32Shift[] = {FMAC_FIR_SHIFT_0BIT, FMAC_FIR_SHIFT_7BIT, FMAC_FIR_SHIFT_15BIT,
+                                  FMAC_FIR_SHIFT_21BIT};
+    uint32_t u32Pos;
+    uint32_t u32Len;
+    uint32_t n;
+    uint32_t s;
+    uint32_t i;
+
+    TEST_Seed(38UL);
+    for (n = 0UL; n < (sizeof(au32Taps) / sizeof(au32Taps[0])); n++) {
+        for (s = 0UL; s < (sizeof(au32Shift) / sizeof(au32Shift[0])); s++) {
+            Setup(FMAC_BLOCK_UNIT_MAX, NULL);
+            RandCoef(au32Taps[n], au32Shift[s]);
+            TEST_ASSERT_EQ(LL_OK, FMAC_BLOCK_LoadCoef(&m_stcBlock, &m_stcCoef));
+            for (i = 0UL; i < SIG_LEN; i++) {
+                m_ai16In[i] = RandSample(32768UL);
+            }
+            /* Blocks shorter and longer than the history of the chain */
+            for (u32Pos = 0UL; u32Pos < SIG_LEN; u32Pos += u32Len) {
+                u32Len = 1UL + (TEST_Rand() % 70UL);
+                if (u32Len > (SIG_LEN - u32Pos)) {
+                    u32Len = SIG_LEN - u32Pos;
+                }
+                TEST_ASSERT_EQ(LL_OK, FMAC_BLOCK_Process(&m_stcBlock, &m_ai16In[u32Pos], &m_ai32Out[u32Pos], u32Len));
+            }
+            TEST_ASSERT_EQ(LL_OK, FMAC_BLOCK_Reference(&m_stcCoef, m_ai16State, m_ai16In, m_ai32Ref, SIG_LEN));
+            TEST_ASSERT(0 == memcmp(m_ai32Out, m_ai32Ref, sizeof(m_ai32Out)));
+        }
+    }
+
+    /* More taps than the chained units */
+    Setup(2UL, NULL);
+    RandCoef(35UL, FMAC_FIR_SHIFT_0BIT);
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, FMAC_BLOCK_LoadCoef(&m_stcBlock, &m_stcCoef));
+    TEST_ASSERT_EQ(LL_ERR_UNINIT, FMAC_BLOCK_Process(&m_stcBlock, m_ai16In, m_ai32Out, 1UL));
+    RandCoef(34UL, FMAC_FIR_SHIFT_0BIT);
+    TEST_ASSERT_EQ(LL_OK, FMAC_BLOCK_LoadCoef(&m_stcBlock, &m_stcCoef));
+}
+
+static void TestDma(void)
+{
+    const uint32_t au32Len[] = {1UL, 2UL, 7UL, 64UL, 300UL};
+    uint32_t u32Pos = 0UL;
+    uint32_t n;
+
+    TEST_Seed(83UL);
+    Setup(2UL, CM_DMA1);
+    RandCoef(17UL, FMAC_FIR_SHIFT_11BIT);
+    TEST_ASSERT_EQ(LL_OK, FMAC_BLOCK_LoadCoef(&m_stcBlock, &m_stcCoef));
+    for (n = 0UL; n < SIG_LEN; n++) {
+        m_ai16In[n] = RandSample(32768UL);
+    }
+    /* The state carries over from one DMA block to the next */
+    for (n = 0UL; n < (sizeof(au32Len) / sizeof(au32Len[0])); n++) {
+        TEST_ASSERT_EQ(LL_OK, FMAC_BLOCK_ProcessDma(&m_stcBlock, &m_ai16In[u32Pos], &m_ai32Out[u32Pos], au32Len[n]));
+        TEST_ASSERT_EQ(n + 1UL, m_u32DoneNum);
+        TEST_ASSERT_EQ(LL_OK, FMAC_BLOCK_Reference(&m_stcCoef, m_ai16State, &m_ai16In[u32Pos], &m_ai32Ref[u32Pos],
+                                                   au32Len[n]));
+        u32Pos += au32Len[n];
+    }
+    TEST_ASSERT(0 == memcmp(m_ai32Out, m_ai32Ref, u32Pos * sizeof(int32_t)));
+    TEST_ASSERT_EQ(u32Pos, FAKE_FMAC_GetInputCount(CM_FMAC1));
+    TEST_ASSERT_EQ(0UL, HOST_FMAC[0].IER);
+    TEST_ASSERT_EQ(DISABLE, FAKE_DMA_GetChState(CM_DMA1, DMA_CH2));
+
+    /* A chained set runs by polling only */
+    RandCoef(18UL, FMAC_FIR_SHIFT_11BIT);
+    TEST_ASSERT_EQ(LL_OK, FMAC_BLOCK_LoadCoef(&m_stcBlock, &m_stcCoef));
+    TEST_ASSERT_EQ(LL_ERR_INVD_MD, FMAC_BLOCK_ProcessDma(&m_stcBlock, m_ai16In, m_ai32Out, 8UL));
+    TEST_ASSERT_EQ(LL_OK, FMAC_BLOCK_Process(&m_stcBlock, m_ai16In, m_ai32Out, 8UL));
+}
+
+static void TestLowPass(void)
+{
+    const double dPi = 3.14159265358979323846;
+    const double dFc = 0.1;
+    double adCoef[LPF_TAPS];
+    int16_t ai16Coef[LPF_TAPS];
+    double dRef;
+    double dSig = 0.0;
+    double dNoise = 0.0;
+    double dT;
+    uint32_t i;
+    uint32_t k;
+
+    /* Hamming windowed sinc, cut off at 0.1 of the sample rate */
+    for (k = 0UL; k < LPF_TAPS; k++) {
+        dT = (double)k - ((LPF_TAPS - 1UL) / 2.0);
+        adCoef[k] = (0.0 == dT) ? (2.0 * dFc) : (sin(2.0 * dPi * dFc * dT) / (dPi * dT));
+        adCoef[k] *= 0.54 - (0.46 * cos((2.0 * dPi * (double)k) / (LPF_TAPS - 1UL)));
+        ai16Coef[k] = (int16_t)lround(adCoef[k] * 32768.0);
+    }
+    Setup(2UL, NULL);
+    TEST_ASSERT_EQ(LL_OK, FMAC_BLOCK_CoefSetInit(&m_stcCoef, ai16Coef, LPF_TAPS, FMAC_FIR_SHIFT_15BIT));
+    TEST_ASSERT_EQ(LL_OK, FMAC_BLOCK_LoadCoef(&m_stcBlock, &m_stcCoef));
+
+    /* Impulse response: the coefficients, scaled down by the shift */
+    (void)memset(m_ai16In, 0, sizeof(m_ai16In));
+    m_ai16In[0] = 0x4000;
+    TEST_ASSERT_EQ(LL_OK, FMAC_BLOCK_Process(&m_stcBlock, m_ai16In, m_ai32Out, LPF_TAPS + 4UL));
+    for (k = 0UL; k < LPF_TAPS; k++) {
+        TEST_ASSERT_EQ(ai16Coef[k] >> 1, m_ai32Out[k]);
+    }
+    TEST_ASSERT_EQ(0L, m_ai32Out[LPF_TAPS] | m_ai32Out[LPF_TAPS + 3UL]);
+
+    /* Two tones, one in the pass band and one in the stop band */
+    TEST_ASSERT_EQ(LL_OK, FMAC_BLOCK_LoadCoef(&m_stcBlock, &m_stcCoef));
+    for (i = 0UL; i < SIG_LEN; i++) {
+        m_ai16In[i] = (int16_t)lround((12000.0 * sin(2.0 * dPi * 0.02 * i)) + (8000.0 * sin(2.0 * dPi * 0.3 * i)));
+    }
+    TEST_ASSERT_EQ(LL_OK, FMAC_BLOCK_Process(&m_stcBlock, m_ai16In, m_ai32Out, SIG_LEN));
+    for (i = LPF_TAPS; i < SIG_LEN; i++) {
+        dRef = 0.0;
+        for (k = 0UL; k < LPF_TAPS; k++) {
+            dRef += adCoef[k] * m_ai16In[i - k];
+        }
+        dSig += dRef * dRef;
+        dNoise += (dRef - m_ai32Out[i]) * (dRef - m_ai32Out[i]);
+    }
+    TEST_ASSERT((10.0 * log10(dSig / dNoise)) > SNR_THRESHOLD);
+}
+
+int main(void)
+{
+    TestInit();
+    TestChain();
+    TestDma();
+    TestLowPass();
+    return TEST_Result("fmac_block");
+}
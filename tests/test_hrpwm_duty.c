@@ -0,0 +1,360 @@
+/**
+ *******************************************************************************
+ * @file  test_hrpwm_duty.c
+ * @brief HRPWM high resolution duty: the counts and fraction of
+ *        HRPWM_DUTY_SetPs() against an exact 128 bit division, the edge
+ *        placed by the compare value and the delay code within one delay
+ *        element and one fraction step of the requested duty, the registers written by
+ *        HRPWM_DUTY_Apply() and the rescaling after a new calibration, the
+ *        background calibration of HRPWM_DUTY_CalibPoll() against a model
+ *        of its triggers, and a benchmark of the per period update.
+ *******************************************************************************
+ */
+#define _GNU_SOURCE
+#include <stdlib.h>
+#include <time.h>
+#include "test.h"
+#include "fake_hrpwm.h"
+#include "hc32_ll_hrpwm_duty.h"
+
+#define PS_PER_S                        (1000000000000ULL)
+/* Polls before a background calibration is given up, see the driver */
+#define CALIB_POLL_MAX                  (100UL)
+
+#define BENCH_OPS                       (1000000UL)
+
+static stc_hrpwm_duty_calib_t m_stcCalib;
+static stc_hrpwm_duty_t m_stcDuty;
+
+static double NowNs(void)
+{
+    struct timespec stcTs;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &stcTs);
+    return ((double)stcTs.tv_sec * 1e9) + (double)stcTs.tv_nsec;
+}
+
+static void Setup(uint32_t u32TmrCh, uint32_t u32HrCh, uint8_t u8Edge, uint32_t u32ClockFreq, uint8_t u8Code)
+{
+    stc_hrpwm_duty_init_t stcInit;
+
+    FAKE_HRPWM_Reset();
+    FAKE_HRPWM_SetCalib(HRPWM_CALIB_UNIT1, u8Code, 3UL);
+    TEST_ASSERT_EQ(LL_OK, HRPWM_DUTY_CalibInit(&m_stcCalib, HRPWM_CALIB_UNIT1, 25L, 0L, 0UL));
+    (void)HRPWM_DUTY_StructInit(&stcInit);
+    stcInit.TMR6x        = CM_TMR6_3;
+    stcInit.u32TmrCh     = u32TmrCh;
+    stcInit.u32HrCh      = u32HrCh;
+    stcInit.u8Edge       = u8Edge;
+    stcInit.u32ClockFreq = u32ClockFreq;
+    stcInit.pstcCalib    = &m_stcCalib;
+    TEST_ASSERT_EQ(LL_OK, HRPWM_DUTY_Init(&m_stcDuty, &stcInit));
+}
+
+static uint32_t Compare(uint32_t u32TmrCh)
+{
+    return (TMR6_CH_A == u32TmrCh) ? CM_TMR6_3->GCMCR : CM_TMR6_3->GCMDR;
+}
+
+static uint8_t Code(uint32_t u32HrCh, uint8_t u8Edge)
+{
+    return (HRPWM_DUTY_EDGE_POS == u8Edge) ? FAKE_HRPWM_GetPosCode(u32HrCh) : FAKE_HRPWM_GetNegCode(u32HrCh);
+}
+
+static void TestPs(void)
+{
+    unsigned __int128 u128Frac;
+    uint32_t u32ClockFreq;
+    uint32_t u32Ps;
+    uint32_t u32HrCh;
+    uint32_t u32TmrCh;
+    uint32_t u32Count;
+    uint32_t u32PrevCount;
+    uint32_t u32PrevCode;
+    uint8_t u8Code;
+    uint8_t u8Edge;
+    double dEdge;
+    double dElement;
+    double dStep;
+    uint32_t i;
+    uint32_t n;
+
+    TEST_Seed(47UL);
+    for (i = 0UL; i < 2000UL; i++) {
+        u32ClockFreq = 1000000UL + (TEST_Rand() % 249000001UL);
+        u8Code       = (uint8_t)(1U + (TEST_Rand() % 255UL));
+        u32TmrCh     = TEST_Rand() % 2UL;
+        u32HrCh      = HRPWM_CH_MIN + (TEST_Rand() % HRPWM_CH_MAX);
+        u8Edge       = (uint8_t)(TEST_Rand() % 2UL);
+        Setup(u32TmrCh, u32HrCh, u8Edge, u32ClockFreq, u8Code);
+        dElement = 1e12 / ((double)u32ClockFreq * (double)u8Code);
+        dStep    = 1e12 / ((double)u32ClockFreq * (double)HRPWM_DUTY_FRAC_ONE);
+
+        for (n = 0UL; n < 50UL; n++) {
+            u32Ps = TEST_Rand();
+            if (0UL == (n % 10UL)) {
+                u32Ps = (0UL == n) ? 0UL : 0xFFFFFFFFUL;
+            }
+            HRPWM_DUTY_SetPs(&m_stcDuty, u32Ps);
+            HRPWM_DUTY_Apply(&m_stcDuty);
+
+            /* Duty in 1/65536 count, rounded down */
+            u128Frac = ((unsigned __int128)u32Ps * u32ClockFreq * HRPWM_DUTY_FRAC_ONE) / PS_PER_S;
+            TEST_ASSERT_EQ((uint32_t)(u128Frac >> 16U), Compare(u32TmrCh));
+            TEST_ASSERT_EQ((uint32_t)(u128Frac & 0xFFFFU), m_stcDuty.u32Frac);
+            TEST_ASSERT_EQ((uint8_t)(((uint32_t)(u128Frac & 0xFFFFU) * u8Code) >> 16U), Code(u32HrCh, u8Edge));
+            TEST_ASSERT_EQ(0U, Code(u32HrCh, (uint8_t)(1U - u8Edge)));
+
+            /* The edge falls at most one delay element and one fraction step before the duty */
+            u32Count = Compare(u32TmrCh);
+            dEdge = (((double)u32Count * 1e12) / (double)u32ClockFreq) +
+                    ((double)Code(u32HrCh, u8Edge) * dElement);
+            TEST_ASSERT(dEdge <= ((double)u32Ps + 1e-3));
+            TEST_ASSERT(((double)u32Ps - dEdge) < (dElement + dStep + 1e-3));
+        }
+
+        /* A longer duty never moves the edge back */
+        u32PrevCount = 0UL;
+        u32PrevCode  = 0UL;
+        u32Ps = TEST_Rand() % 1000000UL;
+        for (n = 0UL; n < 200UL; n++) {
+            u32Ps += 1UL + (TEST_Rand() % 97UL);
+            HRPWM_DUTY_SetPs(&m_stcDuty, u32Ps);
+            HRPWM_DUTY_Apply(&m_stcDuty);
+            u32Count = Compare(u32TmrCh);
+            TEST_ASSERT((u32Count > u32PrevCount) ||
+                        ((u32Count == u32PrevCount) && (Code(u32HrCh, u8Edge) >= u32PrevCode)));
+            u32PrevCount = u32Count;
+            u32PrevCode  = Code(u32HrCh, u8Edge);
+        }
+    }
+}
+
+static void TestApply(void)
+{
+    uint32_t u32Write;
+
+    /* Init clears the code and enables the edge of the channel only */
+    Setup(TMR6_CH_B, 5UL, HRPWM_DUTY_EDGE_POS, 240000000UL, 100U);
+    TEST_ASSERT_EQ(1U, FAKE_HRPWM_IsChEnabled(5UL));
+    TEST_ASSERT_EQ(1U, FAKE_HRPWM_IsPosAdjustEnabled(5UL));
+    TEST_ASSERT_EQ(0U, FAKE_HRPWM_IsNegAdjustEnabled(5UL));
+    TEST_ASSERT_EQ(0U, FAKE_HRPWM_IsChEnabled(6UL));
+    TEST_ASSERT_EQ(1UL, FAKE_HRPWM_GetCodeWriteCount(5UL));
+
+    /* The compare buffer is written at once, the code waits for Apply() */
+    HRPWM_DUTY_SetFrac(&m_stcDuty, 1234UL, 0x8000UL);
+    TEST_ASSERT_EQ(1234UL, CM_TMR6_3->GCMDR);
+    TEST_ASSERT_EQ(0UL, CM_TMR6_3->GCMCR);
+    TEST_ASSERT_EQ(0U, FAKE_HRPWM_GetPosCode(5UL));
+    HRPWM_DUTY_Apply(&m_stcDuty);
+    TEST_ASSERT_EQ(50U, FAKE_HRPWM_GetPosCode(5UL));
+    TEST_ASSERT_EQ(0U, FAKE_HRPWM_GetNegCode(5UL));
+
+    /* Nothing staged, nothing written */
+    u32Write = FAKE_HRPWM_GetCodeWriteCount(5UL);
+    HRPWM_DUTY_Apply(&m_stcDuty);
+    HRPWM_DUTY_Apply(&m_stcDuty);
+    TEST_ASSERT_EQ(u32Write, FAKE_HRPWM_GetCodeWriteCount(5UL));
+
+    /* The last staged duty of a period wins */
+    HRPWM_DUTY_SetFrac(&m_stcDuty, 10UL, 0x4000UL);
+    HRPWM_DUTY_SetFrac(&m_stcDuty, 11UL, 0xC000UL);
+    HRPWM_DUTY_Apply(&m_stcDuty);
+    TEST_ASSERT_EQ(11UL, CM_TMR6_3->GCMDR);
+    TEST_ASSERT_EQ(75U, FAKE_HRPWM_GetPosCode(5UL));
+    TEST_ASSERT_EQ(u32Write + 1UL, FAKE_HRPWM_GetCodeWriteCount(5UL));
+
+    /* A new calibration rescales the applied fraction without a new duty */
+    m_stcCalib.i32TempDelta = 5L;
+    FAKE_HRPWM_SetCalib(HRPWM_CALIB_UNIT1, 120U, 0UL);
+    TEST_ASSERT_EQ(LL_OK, HRPWM_DUTY_CalibPoll(&m_stcCalib, 31L));
+    HRPWM_DUTY_Apply(&m_stcDuty);
+    TEST_ASSERT_EQ(75U, FAKE_HRPWM_GetPosCode(5UL));
+    TEST_ASSERT_EQ(LL_OK, HRPWM_DUTY_CalibPoll(&m_stcCalib, 31L));
+    TEST_ASSERT_EQ(120U, m_stcCalib.u8Code);
+    HRPWM_DUTY_Apply(&m_stcDuty);
+    TEST_ASSERT_EQ(90U, FAKE_HRPWM_GetPosCode(5UL));
+    TEST_ASSERT_EQ(11UL, CM_TMR6_3->GCMDR);
+    u32Write = FAKE_HRPWM_GetCodeWriteCount(5UL);
+    HRPWM_DUTY_Apply(&m_stcDuty);
+    TEST_ASSERT_EQ(u32Write, FAKE_HRPWM_GetCodeWriteCount(5UL));
+
+    /* The falling edge on channel A */
+    Setup(TMR6_CH_A, HRPWM_CH_MAX, HRPWM_DUTY_EDGE_NEG, 240000000UL, 255U);
+    TEST_ASSERT_EQ(1U, FAKE_HRPWM_IsNegAdjustEnabled(HRPWM_CH_MAX));
+    TEST_ASSERT_EQ(0U, FAKE_HRPWM_IsPosAdjustEnabled(HRPWM_CH_MAX));
+    HRPWM_DUTY_SetFrac(&m_stcDuty, 0xFFFFUL, HRPWM_DUTY_FRAC_ONE - 1UL);
+    HRPWM_DUTY_Apply(&m_stcDuty);
+    TEST_ASSERT_EQ(0xFFFFUL, CM_TMR6_3->GCMCR);
+    TEST_ASSERT_EQ(254U, FAKE_HRPWM_GetNegCode(HRPWM_CH_MAX));
+    TEST_ASSERT_EQ(0U, FAKE_HRPWM_GetPosCode(HRPWM_CH_MAX));
+}
+
+static void TestCalibInit(void)
+{
+    stc_hrpwm_duty_init_t stcInit;
+
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, HRPWM_DUTY_CalibInit(NULL, HRPWM_CALIB_UNIT0, 0L, 0L, 0UL));
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, HRPWM_DUTY_CalibPoll(NULL, 0L));
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, HRPWM_DUTY_StructInit(NULL));
+
+    FAKE_HRPWM_Reset();
+    FAKE_HRPWM_SetCalib(HRPWM_CALIB_UNIT0, 77U, 10UL);
+    FAKE_HRPWM_SetCond(DISABLE);
+    TEST_ASSERT_EQ(LL_ERR_INVD_MD, HRPWM_DUTY_CalibInit(&m_stcCalib, HRPWM_CALIB_UNIT0, 0L, 0L, 0UL));
+    TEST_ASSERT_EQ(0UL, FAKE_HRPWM_GetCalibStartCount(HRPWM_CALIB_UNIT0));
+    TEST_ASSERT_EQ(0UL, m_stcCalib.u32Gen);
+
+    FAKE_HRPWM_SetCond(ENABLE);
+    FAKE_HRPWM_SetCalib(HRPWM_CALIB_UNIT0, 77U, FAKE_HRPWM_CALIB_NEVER);
+    TEST_ASSERT_EQ(LL_ERR_TIMEOUT, HRPWM_DUTY_CalibInit(&m_stcCalib, HRPWM_CALIB_UNIT0, 0L, 0L, 0UL));
+    TEST_ASSERT_EQ(0U, m_stcCalib.u8Code);
+    TEST_ASSERT_EQ(0UL, m_stcCalib.u32Gen);
+
+    FAKE_HRPWM_SetCalib(HRPWM_CALIB_UNIT0, 77U, 10UL);
+    TEST_ASSERT_EQ(LL_OK, HRPWM_DUTY_CalibInit(&m_stcCalib, HRPWM_CALIB_UNIT0, 0L, 0L, 0UL));
+    TEST_ASSERT_EQ(77U, m_stcCalib.u8Code);
+    TEST_ASSERT_EQ(1UL, m_stcCalib.u32Gen);
+    TEST_ASSERT_EQ(0UL, FAKE_HRPWM_GetCalibStartCount(HRPWM_CALIB_UNIT1));
+
+    /* Init rejects a missing timer, calibration or clock */
+    (void)HRPWM_DUTY_StructInit(&stcInit);
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, HRPWM_DUTY_Init(&m_stcDuty, &stcInit));
+    stcInit.TMR6x = CM_TMR6_1;
+    stcInit.u32ClockFreq = 240000000UL;
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, HRPWM_DUTY_Init(&m_stcDuty, &stcInit));
+    stcInit.pstcCalib = &m_stcCalib;
+    stcInit.u32ClockFreq = 0UL;
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, HRPWM_DUTY_Init(&m_stcDuty, &stcInit));
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, HRPWM_DUTY_Init(NULL, &stcInit));
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, HRPWM_DUTY_Init(&m_stcDuty, NULL));
+}
+
+static void TestCalibPoll(void)
+{
+    int32_t i32Temp;
+    int32_t i32TempDelta;
+    int32_t i32LastTemp;
+    int32_t i32Ret;
+    uint32_t u32PollPeriod;
+    uint32_t u32Latency;
+    uint32_t u32Polls;
+    uint32_t u32Reads;
+    uint32_t u32Start;
+    uint32_t u32Gen;
+    uint32_t u32Timeout;
+    uint8_t u8Code;
+    uint8_t u8Running;
+    uint32_t i;
+    uint32_t n;
+
+    TEST_Seed(4700UL);
+    u32Timeout = 0UL;
+    for (i = 0UL; i < 200UL; i++) {
+        i32TempDelta  = (0UL == (i % 4UL)) ? 0L : (int32_t)(1UL + (TEST_Rand() % 20UL));
+        u32PollPeriod = (1UL == (i % 4UL)) ? 0UL : (1UL + (TEST_Rand() % 300UL));
+        i32Temp = (int32_t)(TEST_Rand() % 200UL) - 100L;
+
+        FAKE_HRPWM_Reset();
+        u8Code = (uint8_t)(1U + (TEST_Rand() % 255UL));
+        FAKE_HRPWM_SetCalib(HRPWM_CALIB_UNIT0, u8Code, 0UL);
+        TEST_ASSERT_EQ(LL_OK, HRPWM_DUTY_CalibInit(&m_stcCalib, HRPWM_CALIB_UNIT0, i32Temp,
+                                                   i32TempDelta, u32PollPeriod));
+
+        /* Model of the triggers */
+        i32LastTemp = i32Temp;
+        u32Polls    = 0UL;
+        u8Running   = 0U;
+        u32Reads    = 0UL;
+        u32Start    = 1UL;
+        u32Gen      = 1UL;
+        u32Latency  = 0UL;
+        for (n = 0UL; n < 5000UL; n++) {
+            if (0U == u8Running) {
+                /* Next calibration: a new code, a few polls or no end at all */
+                u8Code = (uint8_t)(1U + (TEST_Rand() % 255UL));
+                u32Latency = (0UL == (TEST_Rand() % 16UL)) ? FAKE_HRPWM_CALIB_NEVER : (TEST_Rand() % 8UL);
+                FAKE_HRPWM_SetCalib(HRPWM_CALIB_UNIT0, u8Code, u32Latency);
+            }
+            i32Temp += (int32_t)(TEST_Rand() % 5UL) - 2L;
+
+            i32Ret = HRPWM_DUTY_CalibPoll(&m_stcCalib, i32Temp);
+
+            u32Polls++;
+            if (0U != u8Running) {
+                if ((FAKE_HRPWM_CALIB_NEVER != u32Latency) && (u32Reads >= u32Latency)) {
+                    u8Running = 0U;
+                    u32Polls  = 0UL;
+                    u32Gen++;
+                    TEST_ASSERT_EQ(LL_OK, i32Ret);
+                    TEST_ASSERT_EQ(u8Code, m_stcCalib.u8Code);
+                } else if (u32Polls > CALIB_POLL_MAX) {
+                    u8Running = 0U;
+                    u32Polls  = 0UL;
+                    u32Timeout++;
+                    TEST_ASSERT_EQ(LL_ERR_TIMEOUT, i32Ret);
+                    TEST_ASSERT_EQ(0U, FAKE_HRPWM_IsCalibRunning(HRPWM_CALIB_UNIT0));
+                } else {
+                    u32Reads++;
+                    TEST_ASSERT_EQ(LL_OK, i32Ret);
+                }
+            } else {
+                TEST_ASSERT_EQ(LL_OK, i32Ret);
+                if (((0L != i32TempDelta) && (labs((long)(i32Temp - i32LastTemp)) >= i32TempDelta)) ||
+                    ((0UL != u32PollPeriod) && (u32Polls >= u32PollPeriod))) {
+                    u8Running   = 1U;
+                    u32Polls    = 0UL;
+                    u32Reads    = 0UL;
+                    i32LastTemp = i32Temp;
+                    u32Start++;
+                }
+            }
+            TEST_ASSERT_EQ(u32Start, FAKE_HRPWM_GetCalibStartCount(HRPWM_CALIB_UNIT0));
+            TEST_ASSERT_EQ(u32Gen, m_stcCalib.u32Gen);
+            TEST_ASSERT_EQ(u8Running, m_stcCalib.u8Running);
+        }
+        /* Both triggers are exercised by the walk */
+        if ((0L != i32TempDelta) || (0UL != u32PollPeriod)) {
+            TEST_ASSERT(u32Start > 1UL);
+        }
+    }
+    /* Some calibrations never ended */
+    TEST_ASSERT(u32Timeout > 0UL);
+
+    /* No trigger, no calibration */
+    FAKE_HRPWM_Reset();
+    FAKE_HRPWM_SetCalib(HRPWM_CALIB_UNIT0, 9U, 0UL);
+    TEST_ASSERT_EQ(LL_OK, HRPWM_DUTY_CalibInit(&m_stcCalib, HRPWM_CALIB_UNIT0, 0L, 0L, 0UL));
+    for (n = 0UL; n < 1000UL; n++) {
+        TEST_ASSERT_EQ(LL_OK, HRPWM_DUTY_CalibPoll(&m_stcCalib, (int32_t)n * 1000L));
+    }
+    TEST_ASSERT_EQ(1UL, FAKE_HRPWM_GetCalibStartCount(HRPWM_CALIB_UNIT0));
+    TEST_ASSERT_EQ(1UL, m_stcCalib.u32Gen);
+}
+
+static void Bench(void)
+{
+    volatile uint32_t u32Sink = 0UL;
+    double dStart;
+    uint32_t n;
+
+    Setup(TMR6_CH_A, 1UL, HRPWM_DUTY_EDGE_NEG, 240000000UL, 110U);
+    dStart = NowNs();
+    for (n = 0UL; n < BENCH_OPS; n++) {
+        HRPWM_DUTY_SetPs(&m_stcDuty, 1000000UL + (n * 7919UL % 3000000UL));
+        HRPWM_DUTY_Apply(&m_stcDuty);
+        u32Sink += CM_TMR6_3->GCMCR;
+    }
+    printf("HRPWM_DUTY_SetPs + Apply: %.1f ns/op\n", (NowNs() - dStart) / (double)BENCH_OPS);
+}
+
+int main(void)
+{
+    TestPs();
+    TestApply();
+    TestCalibInit();
+    TestCalibPoll();
+    Bench();
+    return TEST_Result("hrpwm_duty");
+}
@@ -0,0 +1,209 @@
+/**
+ *******************************************************************************
+ * @file  test_i2c_burst.c
+ * @brief Register read coalescing: a sensor sweep of adjacent register reads
+ *        across devices is run with and without merging, the bus transactions
+ *        are counted and the scattered values are checked, and the next sweep
+ *        is flushed from a completion callback.
+ *******************************************************************************
+ */
+#include <string.h>
+#include "test.h"
+#include "fake_i2c.h"
+#include "hc32_ll_i2c_xfer.h"
+
+#define DEV_NUM                         (3U)
+#define REQ_PER_DEV                     (6U)
+#define REQ_NUM                         (DEV_NUM * REQ_PER_DEV)
+#define SWEEP_NUM                       (20UL)
+
+/* Per device, in a scrambled order: data X/Y/Z at 0x28, a status register one
+   unread register below it, an identity register and a FIFO level far away */
+static const uint8_t m_au8Reg[REQ_PER_DEV] = {0x2AU, 0x28U, 0x0FU, 0x2CU, 0x26U, 0x80U};
+static const uint8_t m_au8Len[REQ_PER_DEV] = {2U, 2U, 1U, 2U, 1U, 1U};
+static const uint8_t m_au8Addr[DEV_NUM] = {0x6BU, 0x1EU, 0x77U};
+
+static stc_i2c_xfer_handle_t m_stcHandle;
+static stc_fake_i2c_slave_t m_astcSlave[DEV_NUM];
+static stc_i2c_reg_read_t m_astcReq[REQ_NUM];
+static uint8_t m_au8Buf[REQ_NUM][2];
+static stc_i2c_burst_seg_t m_astcSeg[REQ_NUM];
+static uint8_t m_au8Pool[256];
+static stc_i2c_burst_t m_stcBurst;
+static uint32_t m_u32Done;
+static uint8_t m_u8ReAdd;
+static uint32_t m_u32FlushLeft;
+
+static void BusIrq(void *pvArg)
+{
+    I2C_XFER_IrqHandler((stc_i2c_xfer_handle_t *)pvArg);
+}
+
+static void ReqDone(stc_i2c_reg_read_t *pstcReq, void *pvArg)
+{
+    m_u32Done++;
+    TEST_ASSERT_EQ(LL_OK, pstcReq->i32Result);
+    if (0U != m_u8ReAdd) {
+        /* Queued for the next sweep from interrupt context */
+        TEST_ASSERT_EQ(LL_OK, I2C_XFER_BurstAdd(&m_stcBurst, pstcReq));
+    }
+}
+
+static void ReqFlush(stc_i2c_reg_read_t *pstcReq, void *pvArg)
+{
+    m_u32Done++;
+    TEST_ASSERT_EQ(LL_OK, pstcReq->i32Result);
+    if (m_u32FlushLeft > 0UL) {
+        /* The burst is complete once its last segment calls back, the next one can start */
+        TEST_ASSERT_EQ(LL_OK, I2C_XFER_BurstAdd(&m_stcBurst, pstcReq));
+        if (LL_OK == I2C_XFER_BurstFlush(&m_stcHandle, &m_stcBurst)) {
+            m_u32FlushLeft--;
+        }
+    }
+}
+
+static uint8_t RegValue(uint32_t u32Dev, uint32_t u32Reg, uint32_t u32Sweep)
+{
+    return (uint8_t)((u32Dev * 0x40UL) + u32Reg + u32Sweep);
+}
+
+static void Setup(uint16_t u16MaxLen, uint8_t u8MaxGap)
+{
+    uint32_t i;
+    uint32_t j;
+
+    FAKE_I2C_Reset();
+    for (i = 0UL; i < DEV_NUM; i++) {
+        (void)memset(&m_astcSlave[i], 0, sizeof(m_astcSlave[i]));
+        m_astcSlave[i].u8Addr = m_au8Addr[i];
+        m_astcSlave[i].u16NackAfter = 0xFFFFU;
+        FAKE_I2C_AddSlave(&m_astcSlave[i]);
+    }
+    TEST_ASSERT_EQ(LL_OK, I2C_XFER_Init(&m_stcHandle, CM_I2C1));
+    FAKE_I2C_SetIrq(&BusIrq, &m_stcHandle);
+    TEST_ASSERT_EQ(LL_OK, I2C_XFER_BurstInit(&m_stcBurst, m_astcSeg, REQ_NUM, m_au8Pool, sizeof(m_au8Pool),
+                                             u16MaxLen, u8MaxGap));
+    for (i = 0UL; i < DEV_NUM; i++) {
+        for (j = 0UL; j < REQ_PER_DEV; j++) {
+            stc_i2c_reg_read_t *pstcReq = &m_astcReq[(i * REQ_PER_DEV) + j];
+
+            (void)memset(pstcReq, 0, sizeof(*pstcReq));
+            pstcReq->u16Addr     = m_au8Addr[i];
+            pstcReq->u8Reg       = m_au8Reg[j];
+            pstcReq->u16Len      = m_au8Len[j];
+            pstcReq->pu8Buf      = m_au8Buf[(i * REQ_PER_DEV) + j];
+            pstcReq->pfnCallback = &ReqDone;
+        }
+    }
+    m_u32Done = 0UL;
+}
+
+/* Runs the sweeps, returns the number of bus transactions */
+static uint32_t Sweep(uint16_t u16MaxLen, uint8_t u8MaxGap)
+{
+    uint32_t u32Sweep;
+    uint32_t u32Start = 0UL;
+    uint32_t i;
+    uint32_t j;
+    uint32_t k;
+    uint32_t u32Dev;
+
+    Setup(u16MaxLen, u8MaxGap);
+    for (i = 0UL; i < REQ_NUM; i++) {
+        /* Devices interleaved */
+        k = ((i % DEV_NUM) * REQ_PER_DEV) + (i / DEV_NUM);
+        TEST_ASSERT_EQ(LL_OK, I2C_XFER_BurstAdd(&m_stcBurst, &m_astcReq[k]));
+    }
+    for (u32Sweep = 0UL; u32Sweep < SWEEP_NUM; u32Sweep++) {
+        for (i = 0UL; i < DEV_NUM; i++) {
+            for (j = 0UL; j < 256UL; j++) {
+                m_astcSlave[i].au8Reg[j] = RegValue(i, j, u32Sweep);
+            }
+        }
+        (void)memset(m_au8Buf, 0, sizeof(m_au8Buf));
+        m_u8ReAdd = (u32Sweep < (SWEEP_NUM - 1UL)) ? 1U : 0U;
+        FAKE_I2C_ClearTrace();
+        TEST_ASSERT_EQ(LL_OK, I2C_XFER_BurstFlush(&m_stcHandle, &m_stcBurst));
+        TEST_ASSERT_EQ(LL_ERR_BUSY, I2C_XFER_BurstFlush(&m_stcHandle, &m_stcBurst));
+        FAKE_I2C_Run();
+        u32Start += FAKE_I2C_GetStartCount();
+        TEST_ASSERT_EQ(0U, m_stcBurst.u16Outstanding);
+
+        for (i = 0UL; i < REQ_NUM; i++) {
+            u32Dev = i / REQ_PER_DEV;
+            for (j = 0UL; j < m_astcReq[i].u16Len; j++) {
+                TEST_ASSERT_EQ(RegValue(u32Dev, (uint32_t)m_astcReq[i].u8Reg + j, u32Sweep), m_au8Buf[i][j]);
+            }
+        }
+    }
+    TEST_ASSERT_EQ(SWEEP_NUM * REQ_NUM, m_u32Done);
+    TEST_ASSERT_EQ(SWEEP_NUM * REQ_NUM, m_stcBurst.u32ReqCount);
+    TEST_ASSERT_EQ(u32Start, m_stcBurst.u32XferCount);
+    TEST_ASSERT_EQ(0U, FAKE_I2C_GetViolation());
+    TEST_ASSERT(NULL == m_stcBurst.pstcPending);
+    return u32Start;
+}
+
+static void TestLimits(void)
+{
+    stc_i2c_reg_read_t stcReq;
+    uint8_t au8Buf[8];
+
+    Setup(4U, 0U);
+    (void)memset(&stcReq, 0, sizeof(stcReq));
+    stcReq.u16Addr = m_au8Addr[0];
+    stcReq.pu8Buf  = au8Buf;
+    stcReq.u16Len  = 5U;
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, I2C_XFER_BurstAdd(&m_stcBurst, &stcReq));
+    stcReq.u16Len  = 0U;
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, I2C_XFER_BurstAdd(&m_stcBurst, &stcReq));
+    /* Nothing pending */
+    TEST_ASSERT_EQ(LL_OK, I2C_XFER_BurstFlush(&m_stcHandle, &m_stcBurst));
+    TEST_ASSERT_EQ(0UL, m_stcBurst.u32XferCount);
+}
+
+static void TestFlushFromCallback(void)
+{
+    uint32_t i;
+    uint32_t j;
+
+    Setup(32U, 2U);
+    for (i = 0UL; i < DEV_NUM; i++) {
+        for (j = 0UL; j < 256UL; j++) {
+            m_astcSlave[i].au8Reg[j] = RegValue(i, j, 0UL);
+        }
+    }
+    for (i = 0UL; i < REQ_NUM; i++) {
+        m_astcReq[i].pfnCallback = &ReqFlush;
+        TEST_ASSERT_EQ(LL_OK, I2C_XFER_BurstAdd(&m_stcBurst, &m_astcReq[i]));
+    }
+    m_u32FlushLeft = 4UL;
+    TEST_ASSERT_EQ(LL_OK, I2C_XFER_BurstFlush(&m_stcHandle, &m_stcBurst));
+    FAKE_I2C_Run();
+    TEST_ASSERT_EQ(0UL, m_u32FlushLeft);
+    TEST_ASSERT_EQ(0U, m_stcBurst.u16Outstanding);
+    TEST_ASSERT(m_u32Done > REQ_NUM);
+    for (i = 0UL; i < REQ_NUM; i++) {
+        for (j = 0UL; j < m_astcReq[i].u16Len; j++) {
+            TEST_ASSERT_EQ(RegValue(i / REQ_PER_DEV, (uint32_t)m_astcReq[i].u8Reg + j, 0UL), m_au8Buf[i][j]);
+        }
+    }
+    TEST_ASSERT_EQ(0U, FAKE_I2C_GetViolation());
+}
+
+int main(void)
+{
+    const uint32_t u32Plain = Sweep(2U, 0U);
+    const uint32_t u32Adjacent = Sweep(32U, 0U);
+    const uint32_t u32Merged = Sweep(32U, 2U);
+
+    /* One transaction per request, then X/Y/Z merged, then the status merged across the gap */
+    TEST_ASSERT_EQ(SWEEP_NUM * REQ_NUM, u32Plain);
+    TEST_ASSERT_EQ(SWEEP_NUM * DEV_NUM * 4UL, u32Adjacent);
+    TEST_ASSERT_EQ(SWEEP_NUM * DEV_NUM * 3UL, u32Merged);
+    printf("i2c_burst: %u requests in %u, %u and %u transactions\n", (unsigned)(SWEEP_NUM * REQ_NUM),
+           (unsigned)u32Plain, (unsigned)u32Adjacent, (unsigned)u32Merged);
+    TestLimits();
+    TestFlushFromCallback();
+    return TEST_Result("i2c_burst");
+}
@@ -0,0 +1,292 @@
+/**
+ *******************************************************************************
+ * @file  test_i2c_xfer.c
+ * @brief Transaction engine against the bus model: write, write-read, read,
+ *        NACKs, queued batches, resubmission from the callback and the
+ *        arbitration loss retries, woken by the stop of the winning master.
+ *******************************************************************************
+ */
+#include <string.h>
+#include "test.h"
+#include "fake_i2c.h"
+#include "hc32_ll_i2c_xfer.h"
+
+#define SLAVE_A                         (0x48U)
+#define SLAVE_B                         (0x1DU)
+#define SLAVE_ABSENT                    (0x30U)
+
+static stc_i2c_xfer_handle_t m_stcHandle;
+static stc_fake_i2c_slave_t m_stcSlaveA;
+static stc_fake_i2c_slave_t m_stcSlaveB;
+static uint32_t m_au32Done[8];
+static uint32_t m_u32DoneNum;
+static uint32_t m_u32Resubmit;
+
+static void BusIrq(void *pvArg)
+{
+    I2C_XFER_IrqHandler((stc_i2c_xfer_handle_t *)pvArg);
+}
+
+static void XferDone(stc_i2c_xfer_t *pstcXfer, void *pvArg)
+{
+    if (m_u32DoneNum < 8UL) {
+        m_au32Done[m_u32DoneNum] = (uint32_t)(uintptr_t)pvArg;
+    }
+    m_u32DoneNum++;
+}
+
+static void XferResubmit(stc_i2c_xfer_t *pstcXfer, void *pvArg)
+{
+    m_u32DoneNum++;
+    if (m_u32Resubmit > 0UL) {
+        m_u32Resubmit--;
+        /* The engine is idle again, the resubmission starts right away */
+        TEST_ASSERT_EQ(LL_OK, I2C_XFER_Submit(&m_stcHandle, pstcXfer));
+    }
+}
+
+static void Setup(void)
+{
+    uint32_t i;
+
+    FAKE_I2C_Reset();
+    (void)memset(&m_stcSlaveA, 0, sizeof(m_stcSlaveA));
+    (void)memset(&m_stcSlaveB, 0, sizeof(m_stcSlaveB));
+    m_stcSlaveA.u8Addr = SLAVE_A;
+    m_stcSlaveA.u16NackAfter = 0xFFFFU;
+    m_stcSlaveB.u8Addr = SLAVE_B;
+    m_stcSlaveB.u16NackAfter = 0xFFFFU;
+    for (i = 0UL; i < 256UL; i++) {
+        m_stcSlaveA.au8Reg[i] = (uint8_t)i;
+        m_stcSlaveB.au8Reg[i] = (uint8_t)(0xFFUL - i);
+    }
+    FAKE_I2C_AddSlave(&m_stcSlaveA);
+    FAKE_I2C_AddSlave(&m_stcSlaveB);
+    TEST_ASSERT_EQ(LL_OK, I2C_XFER_Init(&m_stcHandle, CM_I2C1));
+    FAKE_I2C_SetIrq(&BusIrq, &m_stcHandle);
+    m_u32DoneNum = 0UL;
+}
+
+static void XferSet(stc_i2c_xfer_t *pstcXfer, uint16_t u16Addr, const uint8_t *pu8Tx, uint16_t u16TxLen,
+                    uint8_t *pu8Rx, uint16_t u16RxLen, uint32_t u32Tag)
+{
+    (void)memset(pstcXfer, 0, sizeof(*pstcXfer));
+    pstcXfer->u16Addr     = u16Addr;
+    pstcXfer->pu8TxBuf    = pu8Tx;
+    pstcXfer->u16TxLen    = u16TxLen;
+    pstcXfer->pu8RxBuf    = pu8Rx;
+    pstcXfer->u16RxLen    = u16RxLen;
+    pstcXfer->pfnCallback = &XferDone;
+    pstcXfer->pvArg       = (void *)(uintptr_t)u32Tag;
+}
+
+static void TestWrite(void)
+{
+    const uint8_t au8Tx[] = {0x10U, 0xAAU, 0xBBU, 0xCCU};
+    stc_i2c_xfer_t stcXfer;
+
+    Setup();
+    XferSet(&stcXfer, SLAVE_A, au8Tx, sizeof(au8Tx), NULL, 0U, 1UL);
+    TEST_ASSERT_EQ(LL_OK, I2C_XFER_Submit(&m_stcHandle, &stcXfer));
+    FAKE_I2C_Run();
+    TEST_ASSERT_EQ(1UL, m_u32DoneNum);
+    TEST_ASSERT_EQ(LL_OK, stcXfer.i32Result);
+    TEST_ASSERT_EQ(0, strcmp("SAWWWWP", FAKE_I2C_GetTrace()));
+    TEST_ASSERT_EQ(0xAAU, m_stcSlaveA.au8Reg[0x10]);
+    TEST_ASSERT_EQ(0xBBU, m_stcSlaveA.au8Reg[0x11]);
+    TEST_ASSERT_EQ(0xCCU, m_stcSlaveA.au8Reg[0x12]);
+    TEST_ASSERT_EQ(RESET, I2C_XFER_GetBusyStatus(&m_stcHandle));
+}
+
+static void TestWriteRead(void)
+{
+    const uint8_t u8Reg = 0x20U;
+    uint8_t au8Rx[5] = {0U};
+    stc_i2c_xfer_t stcXfer;
+    uint32_t i;
+
+    Setup();
+    XferSet(&stcXfer, SLAVE_B, &u8Reg, 1U, au8Rx, sizeof(au8Rx), 1UL);
+    TEST_ASSERT_EQ(LL_OK, I2C_XFER_Submit(&m_stcHandle, &stcXfer));
+    FAKE_I2C_Run();
+    TEST_ASSERT_EQ(1UL, m_u32DoneNum);
+    TEST_ASSERT_EQ(LL_OK, stcXfer.i32Result);
+    /* The last byte is not acknowledged */
+    TEST_ASSERT_EQ(0, strcmp("SAWRArrrrnP", FAKE_I2C_GetTrace()));
+    for (i = 0UL; i < sizeof(au8Rx); i++) {
+        TEST_ASSERT_EQ((uint8_t)(0xFFUL - 0x20UL - i), au8Rx[i]);
+    }
+}
+
+static void TestRead(void)
+{
+    uint8_t au8Rx[1] = {0U};
+    stc_i2c_xfer_t stcXfer;
+
+    Setup();
+    m_stcSlaveA.u8Ptr = 0x42U;
+    XferSet(&stcXfer, SLAVE_A, NULL, 0U, au8Rx, sizeof(au8Rx), 1UL);
+    TEST_ASSERT_EQ(LL_OK, I2C_XFER_Submit(&m_stcHandle, &stcXfer));
+    FAKE_I2C_Run();
+    TEST_ASSERT_EQ(LL_OK, stcXfer.i32Result);
+    TEST_ASSERT_EQ(0, strcmp("SAnP", FAKE_I2C_GetTrace()));
+    TEST_ASSERT_EQ(0x42U, au8Rx[0]);
+}
+
+static void TestNack(void)
+{
+    const uint8_t au8Tx[] = {0x00U, 0x01U, 0x02U, 0x03U};
+    stc_i2c_xfer_t stcXfer;
+
+    /* Address not acknowledged */
+    Setup();
+    XferSet(&stcXfer, SLAVE_ABSENT, au8Tx, sizeof(au8Tx), NULL, 0U, 1UL);
+    TEST_ASSERT_EQ(LL_OK, I2C_XFER_Submit(&m_stcHandle, &stcXfer));
+    FAKE_I2C_Run();
+    TEST_ASSERT_EQ(1UL, m_u32DoneNum);
+    TEST_ASSERT_EQ(LL_ERR, stcXfer.i32Result);
+    TEST_ASSERT_EQ(0, strcmp("SNP", FAKE_I2C_GetTrace()));
+
+    /* Data byte not acknowledged */
+    Setup();
+    m_stcSlaveA.u16NackAfter = 1U;
+    XferSet(&stcXfer, SLAVE_A, au8Tx, sizeof(au8Tx), NULL, 0U, 1UL);
+    TEST_ASSERT_EQ(LL_OK, I2C_XFER_Submit(&m_stcHandle, &stcXfer));
+    FAKE_I2C_Run();
+    TEST_ASSERT_EQ(1UL, m_u32DoneNum);
+    TEST_ASSERT_EQ(LL_ERR, stcXfer.i32Result);
+    TEST_ASSERT_EQ(0, strcmp("SAWWP", FAKE_I2C_GetTrace()));
+    TEST_ASSERT_EQ(0U, FAKE_I2C_GetViolation());
+}
+
+static void TestBatch(void)
+{
+    const uint8_t au8Reg[3] = {0x00U, 0x10U, 0x80U};
+    uint8_t au8Rx[3][2];
+    stc_i2c_xfer_t astcXfer[3];
+    uint32_t i;
+
+    Setup();
+    XferSet(&astcXfer[0], SLAVE_A, &au8Reg[0], 1U, au8Rx[0], 2U, 0UL);
+    XferSet(&astcXfer[1], SLAVE_ABSENT, &au8Reg[1], 1U, au8Rx[1], 2U, 1UL);
+    XferSet(&astcXfer[2], SLAVE_B, &au8Reg[2], 1U, au8Rx[2], 2U, 2UL);
+    for (i = 0UL; i < 3UL; i++) {
+        TEST_ASSERT_EQ(LL_OK, I2C_XFER_Submit(&m_stcHandle, &astcXfer[i]));
+    }
+    TEST_ASSERT_EQ(SET, I2C_XFER_GetBusyStatus(&m_stcHandle));
+    FAKE_I2C_Run();
+    TEST_ASSERT_EQ(3UL, m_u32DoneNum);
+    for (i = 0UL; i < 3UL; i++) {
+        TEST_ASSERT_EQ(i, m_au32Done[i]);
+    }
+    TEST_ASSERT_EQ(LL_OK, astcXfer[0].i32Result);
+    TEST_ASSERT_EQ(LL_ERR, astcXfer[1].i32Result);
+    TEST_ASSERT_EQ(LL_OK, astcXfer[2].i32Result);
+    TEST_ASSERT_EQ(0x00U, au8Rx[0][0]);
+    TEST_ASSERT_EQ(0x01U, au8Rx[0][1]);
+    TEST_ASSERT_EQ(0x7FU, au8Rx[2][0]);
+    TEST_ASSERT_EQ(0x7EU, au8Rx[2][1]);
+    TEST_ASSERT_EQ(3UL, FAKE_I2C_GetStartCount());
+    TEST_ASSERT_EQ(0U, FAKE_I2C_GetViolation());
+    TEST_ASSERT_EQ(RESET, I2C_XFER_GetBusyStatus(&m_stcHandle));
+}
+
+static void TestResubmit(void)
+{
+    const uint8_t u8Reg = 0x05U;
+    uint8_t u8Rx = 0U;
+    stc_i2c_xfer_t stcXfer;
+
+    Setup();
+    XferSet(&stcXfer, SLAVE_A, &u8Reg, 1U, &u8Rx, 1U, 0UL);
+    stcXfer.pfnCallback = &XferResubmit;
+    m_u32Resubmit = 4UL;
+    TEST_ASSERT_EQ(LL_OK, I2C_XFER_Submit(&m_stcHandle, &stcXfer));
+    FAKE_I2C_Run();
+    /* One START per transaction, none while the bus was still owned */
+    TEST_ASSERT_EQ(5UL, m_u32DoneNum);
+    TEST_ASSERT_EQ(5UL, FAKE_I2C_GetStartCount());
+    TEST_ASSERT_EQ(0U, FAKE_I2C_GetViolation());
+    TEST_ASSERT_EQ(LL_OK, stcXfer.i32Result);
+    TEST_ASSERT_EQ(0x05U, u8Rx);
+    TEST_ASSERT_EQ(RESET, I2C_XFER_GetBusyStatus(&m_stcHandle));
+}
+
+static void TestArbitration(void)
+{
+    const uint8_t au8Tx[] = {0x30U, 0x5AU};
+    stc_i2c_xfer_t stcXfer;
+
+    /* Lost and retried until won */
+    Setup();
+    FAKE_I2C_LoseArbitration(I2C_XFER_ARLO_RETRY, 10UL);
+    XferSet(&stcXfer, SLAVE_A, au8Tx, sizeof(au8Tx), NULL, 0U, 1UL);
+    TEST_ASSERT_EQ(LL_OK, I2C_XFER_Submit(&m_stcHandle, &stcXfer));
+    FAKE_I2C_Run();
+    TEST_ASSERT_EQ(1UL, m_u32DoneNum);
+    TEST_ASSERT_EQ(LL_OK, stcXfer.i32Result);
+    TEST_ASSERT_EQ(I2C_XFER_ARLO_RETRY, m_stcHandle.u32ArloCount);
+    TEST_ASSERT_EQ(0x5AU, m_stcSlaveA.au8Reg[0x30]);
+    TEST_ASSERT_EQ(0U, FAKE_I2C_GetViolation());
+
+    /* Lost more times than retried */
+    Setup();
+    FAKE_I2C_LoseArbitration(I2C_XFER_ARLO_RETRY + 1UL, 10UL);
+    XferSet(&stcXfer, SLAVE_A, au8Tx, sizeof(au8Tx), NULL, 0U, 1UL);
+    TEST_ASSERT_EQ(LL_OK, I2C_XFER_Submit(&m_stcHandle, &stcXfer));
+    FAKE_I2C_Run();
+    TEST_ASSERT_EQ(1UL, m_u32DoneNum);
+    TEST_ASSERT_EQ(LL_ERR_BUSY, stcXfer.i32Result);
+    TEST_ASSERT_EQ(I2C_XFER_ARLO_RETRY + 1UL, m_stcHandle.u32ArloCount);
+    TEST_ASSERT_EQ(RESET, I2C_XFER_GetBusyStatus(&m_stcHandle));
+
+    /* The winner keeps the bus for long, the retry waits for its stop without polling */
+    Setup();
+    FAKE_I2C_LoseArbitration(1UL, 100000UL);
+    XferSet(&stcXfer, SLAVE_A, au8Tx, sizeof(au8Tx), NULL, 0U, 1UL);
+    TEST_ASSERT_EQ(LL_OK, I2C_XFER_Submit(&m_stcHandle, &stcXfer));
+    FAKE_I2C_Run();
+    TEST_ASSERT_EQ(1UL, m_u32DoneNum);
+    TEST_ASSERT_EQ(LL_OK, stcXfer.i32Result);
+    TEST_ASSERT_EQ(0, strcmp("SLpSAWWP", FAKE_I2C_GetTrace()));
+    TEST_ASSERT(FAKE_I2C_GetBusyReads() <= 2UL);
+    TEST_ASSERT_EQ(0U, FAKE_I2C_GetViolation());
+
+    /* The winner has already released the bus, retried at once */
+    Setup();
+    FAKE_I2C_LoseArbitration(2UL, 0UL);
+    XferSet(&stcXfer, SLAVE_A, au8Tx, sizeof(au8Tx), NULL, 0U, 1UL);
+    TEST_ASSERT_EQ(LL_OK, I2C_XFER_Submit(&m_stcHandle, &stcXfer));
+    FAKE_I2C_Run();
+    TEST_ASSERT_EQ(LL_OK, stcXfer.i32Result);
+    TEST_ASSERT_EQ(0, strcmp("SLSLSAWWP", FAKE_I2C_GetTrace()));
+    TEST_ASSERT_EQ(0U, FAKE_I2C_GetViolation());
+
+    /* The winner never releases the bus, the SCL timeout ends the wait without a stop */
+    Setup();
+    FAKE_I2C_LoseArbitration(1UL, FAKE_I2C_HOLD_FOREVER);
+    XferSet(&stcXfer, SLAVE_A, au8Tx, sizeof(au8Tx), NULL, 0U, 1UL);
+    TEST_ASSERT_EQ(LL_OK, I2C_XFER_Submit(&m_stcHandle, &stcXfer));
+    FAKE_I2C_Run();
+    TEST_ASSERT_EQ(0UL, m_u32DoneNum);
+    TEST_ASSERT_EQ(SET, I2C_XFER_GetBusyStatus(&m_stcHandle));
+    FAKE_I2C_Timeout();
+    FAKE_I2C_Run();
+    TEST_ASSERT_EQ(1UL, m_u32DoneNum);
+    TEST_ASSERT_EQ(LL_ERR_BUSY, stcXfer.i32Result);
+    TEST_ASSERT_EQ(0, strcmp("SL", FAKE_I2C_GetTrace()));
+    TEST_ASSERT_EQ(0U, FAKE_I2C_GetViolation());
+    TEST_ASSERT_EQ(RESET, I2C_XFER_GetBusyStatus(&m_stcHandle));
+}
+
+int main(void)
+{
+    TestWrite();
+    TestWriteRead();
+    TestRead();
+    TestNack();
+    TestBatch();
+    TestResubmit();
+    TestArbitration();
+    return TEST_Result("i2c_xfer");
+}
@@ -0,0 +1,292 @@
+/**
+ *******************************************************************************
+ * @file  test_i2s_stream.c
+ * @brief I2S stream against the I2S and DMA models: trigger validation, the
+ *        half buffers reported by I2S_STREAM_DmaIrqHandler() in full duplex,
+ *        the restart after a transmit underrun and a receive overrun, and the
+ *        16-bit PCM packing for each data length.
+ *******************************************************************************
+ */
+#include <string.h>
+#include "test.h"
+#include "fake_dma.h"
+#include "fake_i2s.h"
+#include "hc32_ll_i2s_stream.h"
+
+#define BUF_LEN                         (8UL)
+#define HALF_LEN                        (BUF_LEN / 2UL)
+#define SLOT_NUM                        (1000UL)
+
+static stc_i2s_stream_t m_stcStream;
+static uint32_t m_au32Tx[BUF_LEN];
+static uint32_t m_au32Rx[BUF_LEN];
+static uint32_t m_u32TxNext;
+static uint32_t m_u32RxNext;
+static uint32_t m_u32TxHalfNum;
+static uint32_t m_u32RxHalfNum;
+static uint32_t m_u32ErrEvent;
+static uint32_t m_u32ErrNum;
+static uint8_t m_u8StopOnErr;
+
+static void DmaIrq(void)
+{
+    I2S_STREAM_DmaIrqHandler(&m_stcStream);
+}
+
+static void ErrIrq(void)
+{
+    I2S_STREAM_ErrIrqHandler(&m_stcStream);
+}
+
+static void StreamEvent(stc_i2s_stream_t *pstcStream, uint32_t u32Event, uint32_t *pu32Buf, uint32_t u32Len,
+                        void *pvArg)
+{
+    uint32_t i;
+
+    TEST_ASSERT(pvArg == &m_stcStream);
+    if (I2S_STREAM_EVT_TX_HALF == u32Event) {
+        /* The halves are handed back in turn, from the first one after a (re)start */
+        TEST_ASSERT_EQ(HALF_LEN, u32Len);
+        TEST_ASSERT(pu32Buf == &m_au32Tx[(m_u32TxHalfNum % 2UL) * HALF_LEN]);
+        for (i = 0UL; i < u32Len; i++) {
+            pu32Buf[i] = m_u32TxNext;
+            m_u32TxNext++;
+        }
+        m_u32TxHalfNum++;
+    } else if (I2S_STREAM_EVT_RX_HALF == u32Event) {
+        TEST_ASSERT_EQ(HALF_LEN, u32Len);
+        TEST_ASSERT(pu32Buf == &m_au32Rx[(m_u32RxHalfNum % 2UL) * HALF_LEN]);
+        for (i = 0UL; i < u32Len; i++) {
+            TEST_ASSERT_EQ(m_u32RxNext, pu32Buf[i]);
+            m_u32RxNext++;
+        }
+        m_u32RxHalfNum++;
+    } else {
+        TEST_ASSERT(NULL == pu32Buf);
+        TEST_ASSERT_EQ(0UL, u32Len);
+        m_u32ErrEvent |= u32Event;
+        m_u32ErrNum++;
+        /* Restarted from the first halves */
+        m_u32TxHalfNum = 0UL;
+        m_u32RxHalfNum = 0UL;
+        if (0U != m_u8StopOnErr) {
+            I2S_STREAM_Stop(pstcStream);
+        }
+    }
+}
+
+static void Setup(stc_i2s_stream_init_t *pstcInit, uint8_t u8Tx, uint8_t u8Rx)
+{
+    FAKE_DMA_Reset();
+    FAKE_I2S_Reset();
+    FAKE_DMA_SetIrq(CM_DMA1, DMA_CH0, &DmaIrq);
+    FAKE_DMA_SetIrq(CM_DMA1, DMA_CH1, &DmaIrq);
+    FAKE_I2S_SetErrIrq(CM_I2S1, &ErrIrq);
+    (void)I2S_STREAM_StructInit(pstcInit);
+    pstcInit->pstcDmaUnit   = CM_DMA1;
+    pstcInit->stcTx.pu32Buf = (0U != u8Tx) ? m_au32Tx : NULL;
+    pstcInit->stcTx.u32Len  = BUF_LEN;
+    pstcInit->stcRx.pu32Buf = (0U != u8Rx) ? m_au32Rx : NULL;
+    pstcInit->stcRx.u32Len  = BUF_LEN;
+    pstcInit->pfnCallback   = &StreamEvent;
+    pstcInit->pvArg         = &m_stcStream;
+    m_u32TxNext    = 0UL;
+    m_u32RxNext    = 0UL;
+    m_u32TxHalfNum = 0UL;
+    m_u32RxHalfNum = 0UL;
+    m_u32ErrEvent  = 0UL;
+    m_u32ErrNum    = 0UL;
+    m_u8StopOnErr  = 0U;
+}
+
+static void TestInit(void)
+{
+    stc_i2s_stream_init_t stcInit;
+
+    /* The defaults are consistent DMA1 targets and the I2S1 TXI/RXI events */
+    Setup(&stcInit, 1U, 1U);
+    TEST_ASSERT_EQ(AOS_DMA1_0, stcInit.stcTx.u32TrigTarget);
+    TEST_ASSERT_EQ(EVT_SRC_I2S1_TXIRQOUT, stcInit.stcTx.enEvtSrc);
+    TEST_ASSERT_EQ(AOS_DMA1_1, stcInit.stcRx.u32TrigTarget);
+    TEST_ASSERT_EQ(EVT_SRC_I2S1_RXIRQOUT, stcInit.stcRx.enEvtSrc);
+    TEST_ASSERT_EQ(LL_OK, I2S_STREAM_Init(&m_stcStream, CM_I2S1, &stcInit));
+    TEST_ASSERT_EQ((uint32_t)EVT_SRC_I2S1_TXIRQOUT, HOST_AOS.DMA1_TRGSEL0);
+    TEST_ASSERT_EQ((uint32_t)EVT_SRC_I2S1_RXIRQOUT, HOST_AOS.DMA1_TRGSEL1);
+
+    /* Target of another channel, of the other DMA unit */
+    Setup(&stcInit, 1U, 1U);
+    stcInit.stcRx.u32TrigTarget = AOS_DMA1_0;
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, I2S_STREAM_Init(&m_stcStream, CM_I2S1, &stcInit));
+    Setup(&stcInit, 1U, 1U);
+    stcInit.pstcDmaUnit = CM_DMA2;
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, I2S_STREAM_Init(&m_stcStream, CM_I2S1, &stcInit));
+    stcInit.stcTx.u32TrigTarget = AOS_DMA2_0;
+    stcInit.stcRx.u32TrigTarget = AOS_DMA2_1;
+    TEST_ASSERT_EQ(LL_OK, I2S_STREAM_Init(&m_stcStream, CM_I2S1, &stcInit));
+
+    /* Event of another unit, of the other direction */
+    Setup(&stcInit, 1U, 1U);
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, I2S_STREAM_Init(&m_stcStream, CM_I2S2, &stcInit));
+    stcInit.stcTx.enEvtSrc = EVT_SRC_I2S2_TXIRQOUT;
+    stcInit.stcRx.enEvtSrc = EVT_SRC_I2S2_RXIRQOUT;
+    TEST_ASSERT_EQ(LL_OK, I2S_STREAM_Init(&m_stcStream, CM_I2S2, &stcInit));
+    Setup(&stcInit, 1U, 1U);
+    stcInit.stcTx.enEvtSrc = EVT_SRC_I2S1_RXIRQOUT;
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, I2S_STREAM_Init(&m_stcStream, CM_I2S1, &stcInit));
+    Setup(&stcInit, 1U, 1U);
+    stcInit.stcRx.enEvtSrc = EVT_SRC_I2S1_TXIRQOUT;
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, I2S_STREAM_Init(&m_stcStream, CM_I2S1, &stcInit));
+
+    /* The trigger of an unused direction is not checked */
+    Setup(&stcInit, 1U, 0U);
+    stcInit.stcRx.u32TrigTarget = 0UL;
+    TEST_ASSERT_EQ(LL_OK, I2S_STREAM_Init(&m_stcStream, CM_I2S1, &stcInit));
+}
+
+static void TestDuplex(void)
+{
+    stc_i2s_stream_init_t stcInit;
+    uint32_t n;
+
+    Setup(&stcInit, 1U, 1U);
+    TEST_ASSERT_EQ(LL_OK, I2S_STREAM_Init(&m_stcStream, CM_I2S1, &stcInit));
+    TEST_ASSERT_EQ(LL_OK, I2S_STREAM_Start(&m_stcStream));
+    TEST_ASSERT_EQ(LL_ERR_BUSY, I2S_STREAM_Start(&m_stcStream));
+    /* Both transmit halves filled before the I2S starts */
+    TEST_ASSERT_EQ(2UL, m_u32TxHalfNum);
+    TEST_ASSERT_EQ(1UL, FAKE_I2S_GetFifoResetCount(CM_I2S1));
+
+    for (n = 0UL; n < SLOT_NUM; n++) {
+        TEST_ASSERT_EQ(n, FAKE_I2S_Slot(CM_I2S1, n));
+    }
+    /* Each half reported once it has been played or recorded, none left behind */
+    TEST_ASSERT_EQ(2UL + (SLOT_NUM / HALF_LEN), m_u32TxHalfNum);
+    TEST_ASSERT_EQ(SLOT_NUM / HALF_LEN, m_u32RxHalfNum);
+    TEST_ASSERT_EQ(SLOT_NUM, m_u32RxNext);
+    TEST_ASSERT_EQ(0UL, m_u32ErrNum);
+
+    I2S_STREAM_Stop(&m_stcStream);
+    TEST_ASSERT_EQ(DISABLE, FAKE_DMA_GetChState(CM_DMA1, DMA_CH0));
+    TEST_ASSERT_EQ(DISABLE, FAKE_DMA_GetChState(CM_DMA1, DMA_CH1));
+    TEST_ASSERT_EQ(0UL, CM_I2S1->CTRL & I2S_FUNC_ALL);
+    TEST_ASSERT_EQ(0UL, FAKE_I2S_Slot(CM_I2S1, 0UL));
+    TEST_ASSERT_EQ(SLOT_NUM / HALF_LEN, m_u32RxHalfNum);
+}
+
+static void TestUnderrun(void)
+{
+    stc_i2s_stream_init_t stcInit;
+    uint32_t u32Expect;
+    uint32_t n;
+
+    Setup(&stcInit, 1U, 0U);
+    TEST_ASSERT_EQ(LL_OK, I2S_STREAM_Init(&m_stcStream, CM_I2S1, &stcInit));
+    TEST_ASSERT_EQ(LL_OK, I2S_STREAM_Start(&m_stcStream));
+    for (n = 0UL; n < 10UL; n++) {
+        TEST_ASSERT_EQ(n, FAKE_I2S_Slot(CM_I2S1, 0UL));
+    }
+
+    /* The DMA misses a request in the middle of a half */
+    u32Expect = m_u32TxNext;
+    FAKE_I2S_HoldRequest(CM_I2S1, I2S_FUNC_TX, ENABLE);
+    TEST_ASSERT_EQ(0UL, FAKE_I2S_Slot(CM_I2S1, 0UL));
+    FAKE_I2S_HoldRequest(CM_I2S1, I2S_FUNC_TX, DISABLE);
+    TEST_ASSERT_EQ(I2S_STREAM_EVT_TX_UNDERRUN, m_u32ErrEvent);
+    TEST_ASSERT_EQ(1UL, m_stcStream.u32UnderrunCount);
+    TEST_ASSERT_EQ(0UL, CM_I2S1->ER);
+    TEST_ASSERT_EQ(2UL, FAKE_I2S_GetFifoResetCount(CM_I2S1));
+    /* Both halves refilled, played from the first one */
+    TEST_ASSERT_EQ(2UL, m_u32TxHalfNum);
+    for (n = 0UL; n < (5UL * BUF_LEN); n++) {
+        TEST_ASSERT_EQ(u32Expect + n, FAKE_I2S_Slot(CM_I2S1, 0UL));
+    }
+    TEST_ASSERT_EQ(1UL, m_u32ErrNum);
+
+    /* Stopped by the callback, not restarted */
+    m_u8StopOnErr = 1U;
+    FAKE_I2S_HoldRequest(CM_I2S1, I2S_FUNC_TX, ENABLE);
+    (void)FAKE_I2S_Slot(CM_I2S1, 0UL);
+    FAKE_I2S_HoldRequest(CM_I2S1, I2S_FUNC_TX, DISABLE);
+    TEST_ASSERT_EQ(2UL, m_u32ErrNum);
+    TEST_ASSERT_EQ(0UL, m_u32TxHalfNum);
+    TEST_ASSERT_EQ(DISABLE, FAKE_DMA_GetChState(CM_DMA1, DMA_CH0));
+    TEST_ASSERT_EQ(0UL, CM_I2S1->CTRL & I2S_FUNC_TX);
+    TEST_ASSERT_EQ(LL_OK, I2S_STREAM_Start(&m_stcStream));
+}
+
+static void TestOverrun(void)
+{
+    stc_i2s_stream_init_t stcInit;
+    uint32_t n;
+
+    Setup(&stcInit, 0U, 1U);
+    TEST_ASSERT_EQ(LL_OK, I2S_STREAM_Init(&m_stcStream, CM_I2S1, &stcInit));
+    TEST_ASSERT_EQ(LL_OK, I2S_STREAM_Start(&m_stcStream));
+    for (n = 0UL; n < 6UL; n++) {
+        (void)FAKE_I2S_Slot(CM_I2S1, n);
+    }
+    TEST_ASSERT_EQ(1UL, m_u32RxHalfNum);
+
+    /* Two slots without a DMA read, the second one overruns */
+    FAKE_I2S_HoldRequest(CM_I2S1, I2S_FUNC_RX, ENABLE);
+    (void)FAKE_I2S_Slot(CM_I2S1, 0UL);
+    (void)FAKE_I2S_Slot(CM_I2S1, 0UL);
+    FAKE_I2S_HoldRequest(CM_I2S1, I2S_FUNC_RX, DISABLE);
+    TEST_ASSERT_EQ(I2S_STREAM_EVT_RX_OVERRUN, m_u32ErrEvent);
+    TEST_ASSERT_EQ(1UL, m_stcStream.u32OverrunCount);
+
+    /* Recorded from the first half again */
+    m_u32RxNext = 100UL;
+    for (n = 0UL; n < (3UL * BUF_LEN); n++) {
+        (void)FAKE_I2S_Slot(CM_I2S1, 100UL + n);
+    }
+    TEST_ASSERT_EQ(6UL, m_u32RxHalfNum);
+    TEST_ASSERT_EQ(100UL + (3UL * BUF_LEN), m_u32RxNext);
+}
+
+static void TestPack(void)
+{
+    static const uint32_t au32Width[] = {I2S_DATA_LEN_16BIT, I2S_DATA_LEN_24BIT, I2S_DATA_LEN_32BIT};
+    static const uint32_t au32Shift[] = {0UL, 8UL, 16UL};
+    static int16_t ai16Pcm[0x10000];
+    static int16_t ai16Back[0x10000];
+    static uint32_t au32Slot[0x10000];
+    uint32_t u32Slot;
+    uint32_t i;
+    uint32_t n;
+
+    for (n = 0UL; n < 0x10000UL; n++) {
+        ai16Pcm[n] = (int16_t)(uint16_t)n;
+    }
+    for (i = 0UL; i < 3UL; i++) {
+        I2S_STREAM_Pack16(au32Slot, ai16Pcm, 0x10000UL, au32Width[i]);
+        for (n = 0UL; n < 0x10000UL; n++) {
+            /* Left aligned in the data length, the bits below are 0 */
+            TEST_ASSERT_EQ(n << au32Shift[i], au32Slot[n]);
+        }
+        (void)memset(ai16Back, 0, sizeof(ai16Back));
+        I2S_STREAM_Unpack16(ai16Back, au32Slot, 0x10000UL, au32Width[i]);
+        TEST_ASSERT_EQ(0, memcmp(ai16Pcm, ai16Back, sizeof(ai16Pcm)));
+    }
+
+    /* The low bits of the wider samples are truncated */
+    TEST_Seed(34UL);
+    for (n = 0UL; n < 10000UL; n++) {
+        u32Slot = TEST_Rand();
+        I2S_STREAM_Unpack16(ai16Back, &u32Slot, 1UL, I2S_DATA_LEN_32BIT);
+        TEST_ASSERT_EQ((int16_t)(uint16_t)(u32Slot >> 16U), ai16Back[0]);
+        u32Slot &= 0xFFFFFFUL;
+        I2S_STREAM_Unpack16(ai16Back, &u32Slot, 1UL, I2S_DATA_LEN_24BIT);
+        TEST_ASSERT_EQ((int16_t)(uint16_t)(u32Slot >> 8U), ai16Back[0]);
+    }
+}
+
+int main(void)
+{
+    TestInit();
+    TestDuplex();
+    TestUnderrun();
+    TestOverrun();
+    TestPack();
+    return TEST_Result("i2s_stream");
+}
@@ -0,0 +1,195 @@
+/**
+ *******************************************************************************
+ * @file  test_mau_batch.c
+ * @brief MAU batch software functions against libm: the sine and cosine
+ *        tables over every angle index, the arctangent over random and edge
+ *        vectors, the integer square root over random and edge radicands
+ *        with every left shift, and the batch calls without a MAU unit.
+ *******************************************************************************
+ */
+#include <math.h>
+#include "test.h"
+#include "fake_mau.h"
+#include "hc32_ll_mau_batch.h"
+
+#define ANGIDX_TOTAL                    (4096UL)
+#define TWO_PI                          (6.283185307179586)
+
+/* Exact Q15 value, the magnitude saturated at 32767 as the table */
+static double ExactQ15(double dVal)
+{
+    double dQ15 = dVal * 32768.0;
+
+    if (dQ15 > 32767.0) {
+        dQ15 = 32767.0;
+    } else if (dQ15 < -32767.0) {
+        dQ15 = -32767.0;
+    } else {
+        /* In range */
+    }
+    return dQ15;
+}
+
+static void TestSinCos(void)
+{
+    double dErr;
+    double dSinMax = 0.0;
+    double dCosMax = 0.0;
+    uint32_t i;
+
+    for (i = 0UL; i < 0x10000UL; i++) {
+        dErr = fabs((double)MAU_BATCH_SinLut((uint16_t)i) -
+                    ExactQ15(sin(TWO_PI * (double)(i % ANGIDX_TOTAL) / (double)ANGIDX_TOTAL)));
+        dSinMax = (dErr > dSinMax) ? dErr : dSinMax;
+        dErr = fabs((double)MAU_BATCH_CosLut((uint16_t)i) -
+                    ExactQ15(cos(TWO_PI * (double)(i % ANGIDX_TOTAL) / (double)ANGIDX_TOTAL)));
+        dCosMax = (dErr > dCosMax) ? dErr : dCosMax;
+    }
+    TEST_ASSERT(dSinMax <= 0.75);
+    TEST_ASSERT(dCosMax <= 0.75);
+    printf("SinLut max error: %.3f\n", dSinMax);
+    printf("CosLut max error: %.3f\n", dCosMax);
+
+    /* Exact at the axes, odd and even */
+    TEST_ASSERT_EQ(0, MAU_BATCH_SinLut(0U));
+    TEST_ASSERT_EQ(32767, MAU_BATCH_SinLut(0x400U));
+    TEST_ASSERT_EQ(0, MAU_BATCH_SinLut(0x800U));
+    TEST_ASSERT_EQ(-32767, MAU_BATCH_SinLut(0xC00U));
+    for (i = 1UL; i < ANGIDX_TOTAL; i++) {
+        TEST_ASSERT_EQ(-MAU_BATCH_SinLut((uint16_t)i), MAU_BATCH_SinLut((uint16_t)(ANGIDX_TOTAL - i)));
+        TEST_ASSERT_EQ(MAU_BATCH_CosLut((uint16_t)i), MAU_BATCH_CosLut((uint16_t)(ANGIDX_TOTAL - i)));
+    }
+}
+
+/* Angle index of a vector, the distance to the exact angle on the circle */
+static double Atan2Err(int16_t i16Y, int16_t i16X)
+{
+    double dExact = atan2((double)i16Y, (double)i16X) * (double)ANGIDX_TOTAL / TWO_PI;
+    double dErr = fmod((double)MAU_BATCH_Atan2(i16Y, i16X) - dExact + (double)(2UL * ANGIDX_TOTAL),
+                       (double)ANGIDX_TOTAL);
+
+    return (dErr > ((double)ANGIDX_TOTAL / 2.0)) ? ((double)ANGIDX_TOTAL - dErr) : dErr;
+}
+
+static void TestAtan2(void)
+{
+    static const int16_t ai16Edge[] = {-32768, -32767, -23170, -1, 0, 1, 23170, 23171, 32767};
+    double dErr;
+    double dMax = 0.0;
+    int16_t i16X;
+    int16_t i16Y;
+    uint32_t i;
+    uint32_t j;
+
+    for (i = 0UL; i < (sizeof(ai16Edge) / sizeof(ai16Edge[0])); i++) {
+        for (j = 0UL; j < (sizeof(ai16Edge) / sizeof(ai16Edge[0])); j++) {
+            if ((0 != ai16Edge[i]) || (0 != ai16Edge[j])) {
+                dErr = Atan2Err(ai16Edge[i], ai16Edge[j]);
+                dMax = (dErr > dMax) ? dErr : dMax;
+            }
+        }
+    }
+    TEST_Seed(39UL);
+    for (i = 0UL; i < 1000000UL; i++) {
+        i16X = (int16_t)(TEST_Rand() & 0xFFFFUL);
+        i16Y = (int16_t)(TEST_Rand() & 0xFFFFUL);
+        /* Short vectors too, the ratio is coarse there */
+        if (0UL == (i & 1UL)) {
+            i16X >>= TEST_Rand() % 15UL;
+            i16Y >>= TEST_Rand() % 15UL;
+        }
+        if ((0 != i16X) || (0 != i16Y)) {
+            dErr = Atan2Err(i16Y, i16X);
+            dMax = (dErr > dMax) ? dErr : dMax;
+        }
+    }
+    TEST_ASSERT(dMax <= 1.0);
+    printf("Atan2 max error: %.3f\n", dMax);
+
+    /* Axes exact, null vector 0 */
+    TEST_ASSERT_EQ(0U, MAU_BATCH_Atan2(0, 0));
+    TEST_ASSERT_EQ(0U, MAU_BATCH_Atan2(0, 100));
+    TEST_ASSERT_EQ(0x400U, MAU_BATCH_Atan2(100, 0));
+    TEST_ASSERT_EQ(0x800U, MAU_BATCH_Atan2(0, -100));
+    TEST_ASSERT_EQ(0xC00U, MAU_BATCH_Atan2(-100, 0));
+    TEST_ASSERT_EQ(0xA00U, MAU_BATCH_Atan2(-32767, -32767));
+}
+
+/* sqrt(u32Radicand) * 2^u8ShiftNum rounded to nearest */
+static void CheckSqrt(uint32_t u32Radicand, uint8_t u8ShiftNum)
+{
+    const double dExact = sqrt((double)u32Radicand) * (double)(1UL << u8ShiftNum);
+    const uint32_t u32Root = MAU_BATCH_SqrtSw(u32Radicand, u8ShiftNum);
+
+    TEST_ASSERT(fabs((double)u32Root - dExact) <= 0.5);
+}
+
+static void TestSqrt(void)
+{
+    uint32_t u32Val;
+    uint32_t i;
+    uint8_t u8Shift;
+
+    for (u8Shift = 0U; u8Shift <= MAU_SQRT_OUTPUT_LSHIFT_MAX; u8Shift++) {
+        for (i = 0UL; i < 0x10000UL; i++) {
+            CheckSqrt(i, u8Shift);
+            CheckSqrt(0xFFFFFFFFUL - i, u8Shift);
+            /* Squares and the midpoints between them */
+            CheckSqrt(i * i, u8Shift);
+            CheckSqrt((i * i) + i, u8Shift);
+            CheckSqrt((i * i) + i + 1UL, u8Shift);
+        }
+    }
+    TEST_Seed(3900UL);
+    for (i = 0UL; i < 1000000UL; i++) {
+        u32Val = TEST_Rand() >> (TEST_Rand() % 32UL);
+        CheckSqrt(u32Val, (uint8_t)(TEST_Rand() % (MAU_SQRT_OUTPUT_LSHIFT_MAX + 1U)));
+    }
+    TEST_ASSERT_EQ(0UL, MAU_BATCH_SqrtSw(0UL, 16U));
+    TEST_ASSERT_EQ(65536UL, MAU_BATCH_SqrtSw(0xFFFFFFFFUL, 0U));
+    TEST_ASSERT_EQ(0xFFFFFFFFUL, MAU_BATCH_SqrtSw(0xFFFFFFFFUL, 16U));
+}
+
+/* Without a unit the batch calls run the software functions per element */
+static void TestBatch(void)
+{
+    uint16_t au16Angle[64];
+    int16_t ai16Sin[64];
+    int16_t ai16Cos[64];
+    int16_t ai16X[64];
+    int16_t ai16Y[64];
+    uint32_t au32Val[64];
+    uint32_t au32Root[64];
+    uint32_t i;
+
+    TEST_Seed(390UL);
+    for (i = 0UL; i < 64UL; i++) {
+        au16Angle[i] = (uint16_t)TEST_Rand();
+        ai16X[i] = (int16_t)TEST_Rand();
+        ai16Y[i] = (int16_t)TEST_Rand();
+        au32Val[i] = TEST_Rand();
+    }
+    MAU_BATCH_SinCos(NULL, au16Angle, ai16Sin, ai16Cos, 64UL);
+    for (i = 0UL; i < 64UL; i++) {
+        TEST_ASSERT_EQ(MAU_BATCH_SinLut(au16Angle[i]), ai16Sin[i]);
+        TEST_ASSERT_EQ(MAU_BATCH_CosLut(au16Angle[i]), ai16Cos[i]);
+    }
+    TEST_ASSERT_EQ(LL_OK, MAU_BATCH_Sqrt(NULL, au32Val, au32Root, 64UL, 5U));
+    for (i = 0UL; i < 64UL; i++) {
+        TEST_ASSERT_EQ(MAU_BATCH_SqrtSw(au32Val[i], 5U), au32Root[i]);
+    }
+    TEST_ASSERT_EQ(LL_OK, MAU_BATCH_Polar(NULL, ai16X, ai16Y, au32Root, au16Angle, 64UL));
+    for (i = 0UL; i < 64UL; i++) {
+        TEST_ASSERT(fabs((double)au32Root[i] - hypot((double)ai16X[i], (double)ai16Y[i])) <= 0.5);
+        TEST_ASSERT_EQ(MAU_BATCH_Atan2(ai16Y[i], ai16X[i]), au16Angle[i]);
+    }
+}
+
+int main(void)
+{
+    TestSinCos();
+    TestAtan2();
+    TestSqrt();
+    TestBatch();
+    return TEST_Result("mau_batch");
+}
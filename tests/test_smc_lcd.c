@@ -0,0 +1,356 @@
+/**
+ *******************************************************************************
+ * @file  test_smc_lcd.c
+ * @brief SMC LCD flush against the SMC bus, LCD and DMA models: the trigger
+ *        set up of SMC_LCD_Init(), the command sequence and the pixels of
+ *        full and partial flushes decoded from the bus in order, the merging
+ *        of dirty rectangles, and double buffering with a flush held by the
+ *        masked DMA interrupt.
+ *******************************************************************************
+ */
+#include <string.h>
+#include "test.h"
+#include "fake_smc.h"
+#include "fake_dma.h"
+#include "hc32_ll_smc_lcd.h"
+
+#define LCD_WIDTH                       (320U)
+#define LCD_HEIGHT                      (240U)
+#define LCD_PIXELS                      ((uint32_t)LCD_WIDTH * LCD_HEIGHT)
+#define LCD_DATA_OFFSET                 (0x20000UL)
+
+#define DMA_BLK_MAX                     (1024UL)
+
+static stc_smc_lcd_t m_stcLcd;
+static uint16_t m_au16FbA[LCD_PIXELS];
+static uint16_t m_au16FbB[LCD_PIXELS];
+static uint8_t m_au8Mask[LCD_PIXELS];
+static uint32_t m_u32DoneNum;
+
+static void DmaIrq(void)
+{
+    SMC_LCD_DmaIrqHandler(&m_stcLcd);
+}
+
+static void Done(stc_smc_lcd_t *pstcLcd, void *pvArg)
+{
+    TEST_ASSERT(pvArg == &m_stcLcd);
+    TEST_ASSERT(pstcLcd == &m_stcLcd);
+    m_u32DoneNum++;
+}
+
+static void Setup(void)
+{
+    stc_smc_lcd_init_t stcInit;
+
+    FAKE_DMA_Reset();
+    FAKE_SMC_Reset();
+    FAKE_SMC_Panel(EXMC_SMC_CHIP2, LCD_DATA_OFFSET, LCD_WIDTH, LCD_HEIGHT);
+    FAKE_DMA_SetIrq(CM_DMA2, DMA_CH5, &DmaIrq);
+    FAKE_DMA_SetDevice(FAKE_SMC_BUS_BASE, FAKE_SMC_BUS_SIZE, &FAKE_SMC_BusWrite);
+    m_u32DoneNum = 0UL;
+
+    (void)SMC_LCD_StructInit(&stcInit);
+    stcInit.u32Chip       = EXMC_SMC_CHIP2;
+    stcInit.u32DataOffset = LCD_DATA_OFFSET;
+    stcInit.u16Width      = LCD_WIDTH;
+    stcInit.u16Height     = LCD_HEIGHT;
+    stcInit.pstcDmaUnit   = CM_DMA2;
+    stcInit.u8DmaCh       = DMA_CH5;
+    stcInit.u32TrigTarget = AOS_DMA2_5;
+    stcInit.pfnCallback   = &Done;
+    stcInit.pvArg         = &m_stcLcd;
+    TEST_ASSERT_EQ(LL_OK, SMC_LCD_Init(&m_stcLcd, &stcInit));
+}
+
+static void Fill(uint16_t *pu16Fb, const stc_smc_lcd_rect_t *pstcRect)
+{
+    uint32_t u32Row;
+    uint32_t u32Col;
+
+    for (u32Row = pstcRect->u16Y; u32Row < ((uint32_t)pstcRect->u16Y + pstcRect->u16Height); u32Row++) {
+        for (u32Col = pstcRect->u16X; u32Col < ((uint32_t)pstcRect->u16X + pstcRect->u16Width); u32Col++) {
+            pu16Fb[(u32Row * LCD_WIDTH) + u32Col] = (uint16_t)TEST_Rand();
+        }
+    }
+}
+
+/* Rows sent per DMA block, as many whole rows as fit */
+static uint32_t BlockNum(uint32_t u32Width, uint32_t u32Height)
+{
+    const uint32_t u32Rows = DMA_BLK_MAX / u32Width;
+
+    return (u32Height + u32Rows - 1UL) / u32Rows;
+}
+
+static void TestInit(void)
+{
+    stc_smc_lcd_init_t stcInit;
+
+    FAKE_DMA_Reset();
+    FAKE_SMC_Reset();
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, SMC_LCD_StructInit(NULL));
+    (void)SMC_LCD_StructInit(&stcInit);
+    TEST_ASSERT_EQ(DMA_CH0, stcInit.u8DmaCh);
+    TEST_ASSERT_EQ(AOS_DMA1_0, stcInit.u32TrigTarget);
+    TEST_ASSERT_EQ(SMC_LCD_CMD_MEM_WRITE, stcInit.u16MemWriteCmd);
+
+    /* No DMA unit and no size by default */
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, SMC_LCD_Init(&m_stcLcd, &stcInit));
+    stcInit.pstcDmaUnit = CM_DMA1;
+    stcInit.u16Width    = LCD_WIDTH;
+    stcInit.u16Height   = LCD_HEIGHT;
+    /* A stale event on the channel is removed */
+    HOST_AOS.DMA1_TRGSEL0 = (uint32_t)EVT_SRC_ADC1_EOCA;
+    TEST_ASSERT_EQ(LL_OK, SMC_LCD_Init(&m_stcLcd, &stcInit));
+    TEST_ASSERT_EQ((uint32_t)EVT_SRC_MAX, HOST_AOS.DMA1_TRGSEL0);
+    TEST_ASSERT_EQ(RESET, SMC_LCD_GetBusyStatus(&m_stcLcd));
+
+    stcInit.u8DmaCh = DMA_CH5;
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, SMC_LCD_Init(&m_stcLcd, &stcInit));
+    stcInit.u32TrigTarget = AOS_DMA2_5;
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, SMC_LCD_Init(&m_stcLcd, &stcInit));
+    stcInit.u32TrigTarget = AOS_DMA1_5;
+    TEST_ASSERT_EQ(LL_OK, SMC_LCD_Init(&m_stcLcd, &stcInit));
+
+    stcInit.u16Width = SMC_LCD_WIDTH_MAX + 1U;
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, SMC_LCD_Init(&m_stcLcd, &stcInit));
+}
+
+static void TestFull(void)
+{
+    const stc_smc_lcd_rect_t stcAll = {0U, 0U, LCD_WIDTH, LCD_HEIGHT};
+    uint16_t au16Param[2] = {0x48U, 0x55U};
+
+    TEST_Seed(1UL);
+    Setup();
+    /* Commands of the panel set up reach the bus in order */
+    SMC_LCD_WriteCmd(&m_stcLcd, 0x36U, au16Param, 1UL);
+    SMC_LCD_WriteCmd(&m_stcLcd, 0x3AU, &au16Param[1], 1UL);
+    TEST_ASSERT_EQ(1UL, FAKE_SMC_GetCmdCount(0x36U));
+    TEST_ASSERT_EQ(1UL, FAKE_SMC_GetCmdCount(0x3AU));
+
+    /* Nothing recorded, nothing sent */
+    TEST_ASSERT_EQ(LL_OK, SMC_LCD_Flush(&m_stcLcd, m_au16FbA));
+    TEST_ASSERT_EQ(0UL, m_u32DoneNum);
+    TEST_ASSERT_EQ(0UL, FAKE_AOS_GetSwTriggerCount());
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, SMC_LCD_Flush(&m_stcLcd, NULL));
+
+    Fill(m_au16FbA, &stcAll);
+    SMC_LCD_InvalidateAll(&m_stcLcd);
+    TEST_ASSERT_EQ(LL_OK, SMC_LCD_Flush(&m_stcLcd, m_au16FbA));
+    TEST_ASSERT_EQ(1UL, m_u32DoneNum);
+    TEST_ASSERT_EQ(RESET, SMC_LCD_GetBusyStatus(&m_stcLcd));
+    TEST_ASSERT_EQ(0UL, FAKE_SMC_GetErrCount());
+    TEST_ASSERT_EQ(LCD_PIXELS, FAKE_SMC_GetPixelCount());
+    TEST_ASSERT_EQ(0, memcmp(m_au16FbA, FAKE_SMC_GetGram(), sizeof(m_au16FbA)));
+    TEST_ASSERT_EQ(1UL, FAKE_SMC_GetCmdCount(SMC_LCD_CMD_COL_ADDR));
+    TEST_ASSERT_EQ(1UL, FAKE_SMC_GetCmdCount(SMC_LCD_CMD_ROW_ADDR));
+    TEST_ASSERT_EQ(1UL, FAKE_SMC_GetCmdCount(SMC_LCD_CMD_MEM_WRITE));
+    /* One software request of the channel per block */
+    TEST_ASSERT_EQ(BlockNum(LCD_WIDTH, LCD_HEIGHT), FAKE_AOS_GetSwTriggerCount());
+    TEST_ASSERT_EQ(BlockNum(LCD_WIDTH, LCD_HEIGHT), FAKE_DMA_GetBlockCount(CM_DMA2, DMA_CH5));
+    TEST_ASSERT_EQ(0UL, FAKE_DMA_GetBlockCount(CM_DMA1, DMA_CH5));
+}
+
+static void TestPartial(void)
+{
+    const stc_smc_lcd_rect_t stcAll = {0U, 0U, LCD_WIDTH, LCD_HEIGHT};
+    stc_smc_lcd_rect_t stcRect;
+    const stc_fake_smc_win_t *pstcWin;
+    uint32_t u32Blocks;
+    uint32_t u32Pixels;
+    uint32_t u32Num;
+    uint32_t u32Triggers;
+    uint32_t u32Row;
+    uint32_t u32Col;
+    uint32_t n;
+    uint32_t i;
+
+    TEST_Seed(2UL);
+    Setup();
+    Fill(m_au16FbA, &stcAll);
+    SMC_LCD_InvalidateAll(&m_stcLcd);
+    TEST_ASSERT_EQ(LL_OK, SMC_LCD_Flush(&m_stcLcd, m_au16FbA));
+
+    for (n = 0UL; n < 200UL; n++) {
+        (void)memcpy(m_au16FbB, m_au16FbA, sizeof(m_au16FbB));
+        u32Num = 1UL + (TEST_Rand() % 12UL);
+        for (i = 0UL; i < u32Num; i++) {
+            stcRect.u16X      = (uint16_t)(TEST_Rand() % LCD_WIDTH);
+            stcRect.u16Y      = (uint16_t)(TEST_Rand() % LCD_HEIGHT);
+            stcRect.u16Width  = (uint16_t)(1UL + (TEST_Rand() % ((0UL == (n & 3UL)) ? LCD_WIDTH : 40UL)));
+            stcRect.u16Height = (uint16_t)(1UL + (TEST_Rand() % ((0UL == (n & 3UL)) ? LCD_HEIGHT : 40UL)));
+            /* Clipped by the panel, the framebuffer only changes within it */
+            SMC_LCD_Invalidate(&m_stcLcd, &stcRect);
+            if (stcRect.u16Width > (LCD_WIDTH - stcRect.u16X)) {
+                stcRect.u16Width = (uint16_t)(LCD_WIDTH - stcRect.u16X);
+            }
+            if (stcRect.u16Height > (LCD_HEIGHT - stcRect.u16Y)) {
+                stcRect.u16Height = (uint16_t)(LCD_HEIGHT - stcRect.u16Y);
+            }
+            Fill(m_au16FbA, &stcRect);
+        }
+
+        u32Triggers = FAKE_AOS_GetSwTriggerCount();
+        FAKE_SMC_Panel(EXMC_SMC_CHIP2, LCD_DATA_OFFSET, LCD_WIDTH, LCD_HEIGHT);
+        m_u32DoneNum = 0UL;
+        TEST_ASSERT_EQ(LL_OK, SMC_LCD_Flush(&m_stcLcd, m_au16FbA));
+        TEST_ASSERT_EQ(1UL, m_u32DoneNum);
+        TEST_ASSERT_EQ(0UL, FAKE_SMC_GetErrCount());
+        TEST_ASSERT(FAKE_SMC_GetWinCount() <= SMC_LCD_RECT_MAX);
+        TEST_ASSERT_EQ(FAKE_SMC_GetWinCount(), FAKE_SMC_GetCmdCount(SMC_LCD_CMD_COL_ADDR));
+        TEST_ASSERT_EQ(FAKE_SMC_GetWinCount(), FAKE_SMC_GetCmdCount(SMC_LCD_CMD_ROW_ADDR));
+
+        /* The windows hold every changed pixel, the GRAM outside them is untouched */
+        (void)memset(m_au8Mask, 0, sizeof(m_au8Mask));
+        u32Blocks = 0UL;
+        u32Pixels = 0UL;
+        for (i = 0UL; i < FAKE_SMC_GetWinCount(); i++) {
+            pstcWin = FAKE_SMC_GetWin(i);
+            u32Blocks += BlockNum(pstcWin->u16Width, pstcWin->u16Height);
+            u32Pixels += (uint32_t)pstcWin->u16Width * pstcWin->u16Height;
+            for (u32Row = pstcWin->u16Y; u32Row < ((uint32_t)pstcWin->u16Y + pstcWin->u16Height); u32Row++) {
+                for (u32Col = pstcWin->u16X; u32Col < ((uint32_t)pstcWin->u16X + pstcWin->u16Width); u32Col++) {
+                    m_au8Mask[(u32Row * LCD_WIDTH) + u32Col] = 1U;
+                }
+            }
+        }
+        TEST_ASSERT_EQ(u32Pixels, FAKE_SMC_GetPixelCount());
+        TEST_ASSERT_EQ(u32Blocks, FAKE_AOS_GetSwTriggerCount() - u32Triggers);
+        for (i = 0UL; i < LCD_PIXELS; i++) {
+            if (0U != m_au8Mask[i]) {
+                TEST_ASSERT_EQ(m_au16FbA[i], FAKE_SMC_GetGram()[i]);
+            } else {
+                TEST_ASSERT_EQ(m_au16FbB[i], m_au16FbA[i]);
+                TEST_ASSERT_EQ(0U, FAKE_SMC_GetGram()[i]);
+            }
+        }
+    }
+}
+
+static void TestMerge(void)
+{
+    const stc_smc_lcd_rect_t astcRect[] = {
+        {10U, 10U, 20U, 20U},
+        /* Touching the first one on the right */
+        {30U, 10U, 20U, 20U},
+        /* Far away */
+        {200U, 150U, 10U, 10U},
+        /* Inside the first two */
+        {15U, 15U, 5U, 5U},
+    };
+    stc_smc_lcd_rect_t stcRect;
+    const stc_fake_smc_win_t *pstcWin;
+    uint32_t i;
+
+    TEST_Seed(3UL);
+    Setup();
+    for (i = 0UL; i < (sizeof(astcRect) / sizeof(astcRect[0])); i++) {
+        SMC_LCD_Invalidate(&m_stcLcd, &astcRect[i]);
+    }
+    /* Out of the panel or empty */
+    stcRect.u16X = LCD_WIDTH;
+    stcRect.u16Y = 0U;
+    stcRect.u16Width = 4U;
+    stcRect.u16Height = 4U;
+    SMC_LCD_Invalidate(&m_stcLcd, &stcRect);
+    stcRect.u16X = 0U;
+    stcRect.u16Width = 0U;
+    SMC_LCD_Invalidate(&m_stcLcd, &stcRect);
+
+    TEST_ASSERT_EQ(LL_OK, SMC_LCD_Flush(&m_stcLcd, m_au16FbA));
+    TEST_ASSERT_EQ(2UL, FAKE_SMC_GetWinCount());
+    TEST_ASSERT_EQ(0UL, FAKE_SMC_GetErrCount());
+    for (i = 0UL; i < FAKE_SMC_GetWinCount(); i++) {
+        pstcWin = FAKE_SMC_GetWin(i);
+        if (10U == pstcWin->u16X) {
+            TEST_ASSERT_EQ(10U, pstcWin->u16Y);
+            TEST_ASSERT_EQ(40U, pstcWin->u16Width);
+            TEST_ASSERT_EQ(20U, pstcWin->u16Height);
+        } else {
+            TEST_ASSERT_EQ(200U, pstcWin->u16X);
+            TEST_ASSERT_EQ(150U, pstcWin->u16Y);
+            TEST_ASSERT_EQ(10U, pstcWin->u16Width);
+            TEST_ASSERT_EQ(10U, pstcWin->u16Height);
+        }
+    }
+
+    /* More rectangles than the list holds: none is lost */
+    Setup();
+    (void)memset(m_au16FbA, 0, sizeof(m_au16FbA));
+    for (i = 0UL; i < (SMC_LCD_RECT_MAX * 3UL); i++) {
+        stcRect.u16X      = (uint16_t)((i % 6UL) * 50UL);
+        stcRect.u16Y      = (uint16_t)((i / 6UL) * 50UL);
+        stcRect.u16Width  = 8U;
+        stcRect.u16Height = 8U;
+        Fill(m_au16FbA, &stcRect);
+        SMC_LCD_Invalidate(&m_stcLcd, &stcRect);
+    }
+    TEST_ASSERT_EQ(LL_OK, SMC_LCD_Flush(&m_stcLcd, m_au16FbA));
+    TEST_ASSERT(FAKE_SMC_GetWinCount() <= SMC_LCD_RECT_MAX);
+    TEST_ASSERT_EQ(0UL, FAKE_SMC_GetErrCount());
+    TEST_ASSERT_EQ(0, memcmp(m_au16FbA, FAKE_SMC_GetGram(), sizeof(m_au16FbA)));
+}
+
+static void TestDouble(void)
+{
+    const stc_smc_lcd_rect_t stcAll = {0U, 0U, LCD_WIDTH, LCD_HEIGHT};
+    const stc_smc_lcd_rect_t stcRect = {100U, 60U, 50U, 70U};
+    uint16_t *pu16Front = m_au16FbA;
+    uint16_t *pu16Back = m_au16FbB;
+    uint16_t *pu16Swap;
+    uint32_t n;
+
+    TEST_Seed(4UL);
+    Setup();
+    Fill(pu16Front, &stcAll);
+    (void)memset(pu16Back, 0, sizeof(m_au16FbB));
+    SMC_LCD_InvalidateAll(&m_stcLcd);
+
+    /* The interrupt is held: the first block only is sent */
+    g_u32HostPrimask = 1UL;
+    TEST_ASSERT_EQ(LL_OK, SMC_LCD_Flush(&m_stcLcd, pu16Front));
+    TEST_ASSERT_EQ(SET, SMC_LCD_GetBusyStatus(&m_stcLcd));
+    TEST_ASSERT_EQ(1UL, FAKE_AOS_GetSwTriggerCount());
+    TEST_ASSERT_EQ((DMA_BLK_MAX / LCD_WIDTH) * LCD_WIDTH, FAKE_SMC_GetPixelCount());
+
+    /* The UI renders the next frame into the other buffer meanwhile */
+    SMC_LCD_CopyFlushed(&m_stcLcd, pu16Back, pu16Front);
+    TEST_ASSERT_EQ(0, memcmp(pu16Back, pu16Front, sizeof(m_au16FbA)));
+    Fill(pu16Back, &stcRect);
+    SMC_LCD_Invalidate(&m_stcLcd, &stcRect);
+    TEST_ASSERT_EQ(LL_ERR_BUSY, SMC_LCD_Flush(&m_stcLcd, pu16Back));
+
+    g_u32HostPrimask = 0UL;
+    SMC_LCD_DmaIrqHandler(&m_stcLcd);
+    TEST_ASSERT_EQ(RESET, SMC_LCD_GetBusyStatus(&m_stcLcd));
+    TEST_ASSERT_EQ(1UL, m_u32DoneNum);
+    TEST_ASSERT_EQ(0, memcmp(pu16Front, FAKE_SMC_GetGram(), sizeof(m_au16FbA)));
+
+    /* Swap and flush the next frames, the last window only is sent each time */
+    for (n = 0UL; n < 8UL; n++) {
+        pu16Swap = pu16Front;
+        pu16Front = pu16Back;
+        pu16Back = pu16Swap;
+        TEST_ASSERT_EQ(LL_OK, SMC_LCD_Flush(&m_stcLcd, pu16Front));
+        TEST_ASSERT_EQ(n + 2UL, m_u32DoneNum);
+        TEST_ASSERT_EQ(0UL, FAKE_SMC_GetErrCount());
+        TEST_ASSERT_EQ(0, memcmp(pu16Front, FAKE_SMC_GetGram(), sizeof(m_au16FbA)));
+        SMC_LCD_CopyFlushed(&m_stcLcd, pu16Back, pu16Front);
+        TEST_ASSERT_EQ(0, memcmp(pu16Back, pu16Front, sizeof(m_au16FbA)));
+        Fill(pu16Back, &stcRect);
+        SMC_LCD_Invalidate(&m_stcLcd, &stcRect);
+    }
+    TEST_ASSERT_EQ(LCD_PIXELS + (8UL * 50UL * 70UL), FAKE_SMC_GetPixelCount());
+}
+
+int main(void)
+{
+    TestInit();
+    TestFull();
+    TestPartial();
+    TestMerge();
+    TestDouble();
+    return TEST_Result("smc_lcd");
+}
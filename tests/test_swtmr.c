@@ -0,0 +1,217 @@
+/**
+ *******************************************************************************
+ * @file  test_swtmr.c
+ * @brief Timer wheel simulation: 10000 one-shot and periodic timers with
+ *        random restarts and stops, every expiry is checked against the
+ *        simulated TMR0 count. Also a benchmark of the insert, cancel and
+ *        expiry of 10000 timers, each timed separately.
+ *******************************************************************************
+ */
+#define _GNU_SOURCE
+#include <time.h>
+#include "test.h"
+#include "fake_tmr0.h"
+#include "hc32_ll_swtmr.h"
+
+#define TIMER_NUM                       (10000UL)
+#define RUN_TICKS                       (1UL << 23)
+
+#define BENCH_ROUNDS                    (50UL)
+
+typedef struct {
+    stc_swtmr_t stcTimer;
+    uint32_t u32Expected;
+    uint32_t u32Fired;
+    uint8_t u8Running;
+} stc_sim_timer_t;
+
+static stc_sim_timer_t m_astcSim[TIMER_NUM];
+static uint32_t m_u32FireCount;
+static uint32_t m_u32MaxLate;
+
+static stc_swtmr_t m_astcBench[TIMER_NUM];
+static uint32_t m_au32BenchDelay[TIMER_NUM];
+static uint32_t m_u32BenchFired;
+
+static double NowNs(void)
+{
+    struct timespec stcTs;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &stcTs);
+    return ((double)stcTs.tv_sec * 1e9) + (double)stcTs.tv_nsec;
+}
+
+static uint32_t RandDelay(void)
+{
+    /* Mostly short delays, some reaching the upper wheel levels */
+    const uint32_t u32Bits = 1UL + (TEST_Rand() % 22UL);
+
+    return 1UL + (TEST_Rand() & ((1UL << u32Bits) - 1UL));
+}
+
+static void SimStart(stc_sim_timer_t *pstcSim, uint32_t u32Delay)
+{
+    pstcSim->u32Expected = SWTMR_GetTick() + u32Delay;
+    pstcSim->u8Running = 1U;
+    TEST_ASSERT_EQ(LL_OK, SWTMR_Start(&pstcSim->stcTimer, u32Delay));
+}
+
+static void SimStop(stc_sim_timer_t *pstcSim)
+{
+    SWTMR_Stop(&pstcSim->stcTimer);
+    pstcSim->u8Running = 0U;
+    TEST_ASSERT_EQ(RESET, SWTMR_GetStatus(&pstcSim->stcTimer));
+}
+
+static void SimCallback(stc_swtmr_t *pstcTimer, void *pvArg)
+{
+    stc_sim_timer_t *pstcSim = (stc_sim_timer_t *)pvArg;
+    stc_sim_timer_t *pstcOther;
+    const uint32_t u32Now = SWTMR_GetTick();
+    const uint32_t u32Late = u32Now - pstcSim->u32Expected;
+
+    TEST_ASSERT(pstcTimer == &pstcSim->stcTimer);
+    TEST_ASSERT_EQ(1U, pstcSim->u8Running);
+    /* Never early, late by the compare margin at most */
+    TEST_ASSERT((int32_t)u32Late >= 0);
+    TEST_ASSERT(u32Late <= (SWTMR_CLK_MARGIN + 1UL));
+    m_u32MaxLate = LL_MAX(m_u32MaxLate, u32Late);
+    m_u32FireCount++;
+    pstcSim->u32Fired++;
+
+    if (0UL != pstcTimer->u32Period) {
+        pstcSim->u32Expected += pstcTimer->u32Period;
+        TEST_ASSERT_EQ(SET, SWTMR_GetStatus(pstcTimer));
+    } else {
+        pstcSim->u8Running = 0U;
+        TEST_ASSERT_EQ(RESET, SWTMR_GetStatus(pstcTimer));
+        if (0UL == (TEST_Rand() % 2UL)) {
+            SimStart(pstcSim, RandDelay());
+        }
+    }
+
+    /* Churn: restart or stop another timer from the callback */
+    pstcOther = &m_astcSim[TEST_Rand() % TIMER_NUM];
+    if ((pstcOther != pstcSim) && (0UL == pstcOther->stcTimer.u32Period)) {
+        if (0UL == (TEST_Rand() % 3UL)) {
+            SimStop(pstcOther);
+        } else {
+            SimStart(pstcOther, RandDelay());
+        }
+    }
+}
+
+static void BenchCallback(stc_swtmr_t *pstcTimer, void *pvArg)
+{
+    (void)pstcTimer;
+    (void)pvArg;
+    m_u32BenchFired++;
+}
+
+static void TestWheel(void)
+{
+    stc_swtmr_init_t stcInit;
+    uint32_t i;
+    uint32_t u32Step;
+    uint32_t u32Elapsed = 0UL;
+    uint32_t u32Pending = 0UL;
+    clock_t tStart;
+
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, SWTMR_StructInit(NULL));
+    TEST_ASSERT_EQ(LL_OK, SWTMR_StructInit(&stcInit));
+    TEST_ASSERT_EQ(LL_OK, SWTMR_Init(CM_TMR0_1, TMR0_CH_A, &stcInit));
+    FAKE_TMR0_SetIrq(CM_TMR0_1, TMR0_CH_A, &SWTMR_IrqHandler);
+
+    for (i = 0UL; i < TIMER_NUM; i++) {
+        SWTMR_TimerInit(&m_astcSim[i].stcTimer, &SimCallback, &m_astcSim[i],
+                        (0UL == (i % 10UL)) ? (1UL + (TEST_Rand() % 50000UL)) : 0UL);
+        SimStart(&m_astcSim[i], RandDelay());
+    }
+
+    tStart = clock();
+    while (u32Elapsed < RUN_TICKS) {
+        u32Step = 1UL + (TEST_Rand() % 5000UL);
+        FAKE_TMR0_Run(CM_TMR0_1, TMR0_CH_A, u32Step);
+        u32Elapsed += u32Step;
+        TEST_ASSERT_EQ(u32Elapsed, SWTMR_GetTick());
+
+        /* Occasional stop from thread level */
+        if (0UL == (TEST_Rand() % 8UL)) {
+            SimStop(&m_astcSim[TEST_Rand() % TIMER_NUM]);
+        }
+    }
+
+    /* Nothing due is left behind */
+    for (i = 0UL; i < TIMER_NUM; i++) {
+        if (0U != m_astcSim[i].u8Running) {
+            TEST_ASSERT((int32_t)(m_astcSim[i].u32Expected - u32Elapsed) > 0);
+            u32Pending++;
+        }
+    }
+
+    printf("swtmr: %lu expiries over %lu ticks in %lu interrupts, max late %lu, %lu pending, %.2f s\n",
+           (unsigned long)m_u32FireCount, (unsigned long)u32Elapsed,
+           (unsigned long)FAKE_TMR0_GetIrqCount(CM_TMR0_1, TMR0_CH_A), (unsigned long)m_u32MaxLate,
+           (unsigned long)u32Pending, (double)(clock() - tStart) / CLOCKS_PER_SEC);
+    TEST_ASSERT(m_u32FireCount > TIMER_NUM);
+
+    SWTMR_DeInit();
+    TEST_ASSERT_EQ(LL_ERR_UNINIT, SWTMR_Start(&m_astcSim[0].stcTimer, 1UL));
+}
+
+static void Bench(void)
+{
+    stc_swtmr_init_t stcInit;
+    uint32_t u32DelayMax = 0UL;
+    double dInsert = 0.0;
+    double dCancel = 0.0;
+    double dExpire = 0.0;
+    double dStart;
+    uint32_t n;
+    uint32_t i;
+
+    TEST_ASSERT_EQ(LL_OK, SWTMR_StructInit(&stcInit));
+    TEST_ASSERT_EQ(LL_OK, SWTMR_Init(CM_TMR0_1, TMR0_CH_A, &stcInit));
+    FAKE_TMR0_SetIrq(CM_TMR0_1, TMR0_CH_A, &SWTMR_IrqHandler);
+    TEST_Seed(28UL);
+    for (i = 0UL; i < TIMER_NUM; i++) {
+        SWTMR_TimerInit(&m_astcBench[i], &BenchCallback, NULL, 0UL);
+        m_au32BenchDelay[i] = RandDelay();
+        u32DelayMax = LL_MAX(u32DelayMax, m_au32BenchDelay[i]);
+    }
+
+    for (n = 0UL; n < BENCH_ROUNDS; n++) {
+        /* Insert then cancel every timer */
+        dStart = NowNs();
+        for (i = 0UL; i < TIMER_NUM; i++) {
+            (void)SWTMR_Start(&m_astcBench[i], m_au32BenchDelay[i]);
+        }
+        dInsert += NowNs() - dStart;
+        dStart = NowNs();
+        for (i = 0UL; i < TIMER_NUM; i++) {
+            SWTMR_Stop(&m_astcBench[i]);
+        }
+        dCancel += NowNs() - dStart;
+
+        /* Insert again and run until every timer expired, the interrupts of the TMR0 model included */
+        for (i = 0UL; i < TIMER_NUM; i++) {
+            (void)SWTMR_Start(&m_astcBench[i], m_au32BenchDelay[i]);
+        }
+        m_u32BenchFired = 0UL;
+        dStart = NowNs();
+        FAKE_TMR0_Run(CM_TMR0_1, TMR0_CH_A, u32DelayMax + SWTMR_CLK_MARGIN + 1UL);
+        dExpire += NowNs() - dStart;
+        TEST_ASSERT_EQ(TIMER_NUM, m_u32BenchFired);
+    }
+    printf("SWTMR_Start: %.1f ns/op\n", dInsert / (double)(BENCH_ROUNDS * TIMER_NUM));
+    printf("SWTMR_Stop: %.1f ns/op\n", dCancel / (double)(BENCH_ROUNDS * TIMER_NUM));
+    printf("SWTMR expiry: %.1f ns/op\n", dExpire / (double)(BENCH_ROUNDS * TIMER_NUM));
+    SWTMR_DeInit();
+}
+
+int main(void)
+{
+    TestWheel();
+    Bench();
+    return TEST_Result("swtmr");
+}
@@ -0,0 +1,318 @@
+/**
+ *******************************************************************************
+ * @file  test_tickless.c
+ * @brief Tickless time base: TICKLESS_GetTick() against a 64-bit model of the
+ *        TMR0 channel across many wraps of the 16-bit counter, with the compare
+ *        interrupt taken at once or left pending, alarms never early and late
+ *        by the compare margin at most, and delays sleeping until their
+ *        deadline, also while SysTick_Suspend() disabled the interrupt.
+ *******************************************************************************
+ */
+#include "test.h"
+#include "fake_tmr0.h"
+#include "fake_pwc.h"
+#include "hc32_ll_tickless.h"
+#include "hc32_ll_utility.h"
+
+#define TMR0X                           (CM_TMR0_1)
+#define TMR0_CH                         (TMR0_CH_B)
+
+static uint64_t m_u64Now;
+static uint32_t m_u32Margin;
+static uint32_t m_u32Wfi;
+static uint32_t m_u32Spurious;
+static uint32_t m_u32AlarmCount;
+static uint64_t m_u64AlarmTick;
+
+static void AlarmCallback(void)
+{
+    m_u32AlarmCount++;
+    m_u64AlarmTick = TICKLESS_GetTick();
+}
+
+static void Setup(uint32_t u32ClockSrc, uint32_t u32ClockFreq)
+{
+    stc_tickless_init_t stcInit;
+
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, TICKLESS_StructInit(NULL));
+    TEST_ASSERT_EQ(LL_OK, TICKLESS_StructInit(&stcInit));
+    TEST_ASSERT_EQ(TMR0_CLK_SRC_LRC, stcInit.u32ClockSrc);
+    stcInit.u32ClockSrc      = u32ClockSrc;
+    stcInit.u32ClockFreq     = u32ClockFreq;
+    stcInit.pfnAlarmCallback = &AlarmCallback;
+    TEST_ASSERT_EQ(LL_OK, TICKLESS_Init(TMR0X, TMR0_CH, &stcInit));
+    TEST_ASSERT_EQ(u32ClockFreq, TICKLESS_GetTickFreq());
+    FAKE_TMR0_SetIrq(TMR0X, TMR0_CH, &TICKLESS_IrqHandler);
+
+    m_u32Margin = (TMR0_CLK_SRC_INTERN_CLK == u32ClockSrc) ? TICKLESS_SYNC_CLK_MARGIN : TICKLESS_ASYNC_CLK_MARGIN;
+    m_u64Now = 0ULL;
+    m_u32AlarmCount = 0UL;
+    g_u32HostPrimask = 0UL;
+}
+
+/* Count u32Count clocks, the compare interrupt is taken unless masked */
+static void Advance(uint32_t u32Count)
+{
+    FAKE_TMR0_Run(TMR0X, TMR0_CH, u32Count);
+    m_u64Now += u32Count;
+}
+
+static void Check(void)
+{
+    TEST_ASSERT_EQ(m_u64Now, TICKLESS_GetTick());
+}
+
+/* WFI of the core: woken up by the compare interrupt, or early by another one */
+static void Wfi(void)
+{
+    const uint32_t u32Lost = FAKE_TMR0_GetLostWakeCount(TMR0X, TMR0_CH);
+
+    m_u32Wfi++;
+    /* The driver sleeps masked, a pending interrupt still wakes the core up */
+    TEST_ASSERT(0UL != g_u32HostPrimask);
+    if ((SET != TMR0_GetStatus(TMR0X, TMR0_FLAG_CMP_B)) && (0UL == (TEST_Rand() % 4UL))) {
+        /* Short enough to reach the compare match once at most */
+        m_u32Spurious++;
+        Advance(1UL + (TEST_Rand() % 3UL));
+    } else {
+        m_u64Now += FAKE_TMR0_Sleep(TMR0X, TMR0_CH);
+        if (u32Lost != FAKE_TMR0_GetLostWakeCount(TMR0X, TMR0_CH)) {
+            /* Hung forever on the target, serviced here to end the test */
+            TICKLESS_IrqHandler();
+        }
+    }
+}
+
+/* Distance in clocks to the next compare match */
+static uint32_t ToCompare(void)
+{
+    const uint32_t u32Cnt = TMR0_GetCountValue(TMR0X, TMR0_CH);
+    const uint32_t u32Cmp = TMR0_GetCompareValue(TMR0X, TMR0_CH);
+
+    return ((u32Cnt <= u32Cmp) ? (u32Cmp - u32Cnt) : (0x10000UL - u32Cnt + u32Cmp)) + 1UL;
+}
+
+/* A compare match left pending by the last wake-up is taken as the delay unmasks */
+static void TakePending(void)
+{
+    if (SET == TMR0_GetStatus(TMR0X, TMR0_FLAG_CMP_B)) {
+        TICKLESS_IrqHandler();
+    }
+}
+
+/* Sleep until the deadline, never early, late by the compare margin and a spurious wake-up */
+static void CheckDelay(uint64_t u64Start, uint64_t u64Ticks)
+{
+    TEST_ASSERT(m_u64Now >= (u64Start + u64Ticks));
+    TEST_ASSERT((m_u64Now - (u64Start + u64Ticks)) <= (m_u32Margin + 4UL));
+    TEST_ASSERT_EQ(0UL, FAKE_TMR0_GetLostWakeCount(TMR0X, TMR0_CH));
+    TEST_ASSERT_EQ(0UL, g_u32HostPrimask);
+    Check();
+}
+
+static void TestTick(void)
+{
+    uint32_t u32Delta;
+    uint32_t n;
+
+    Setup(TMR0_CLK_SRC_LRC, 32768UL);
+    Check();
+    TEST_Seed(26UL);
+    for (n = 0UL; n < 200000UL; n++) {
+        switch (TEST_Rand() % 4UL) {
+            case 0UL:
+                u32Delta = TEST_Rand() % 0x10UL;
+                break;
+            case 1UL:
+                u32Delta = 0xFFF0UL + (TEST_Rand() % 0x20UL);
+                break;
+            default:
+                u32Delta = TEST_Rand() % 0x40000UL;
+                break;
+        }
+        Advance(u32Delta);
+        Check();
+
+        /* The interrupt is late: one compare match pending while masked */
+        if (0UL == (TEST_Rand() % 8UL)) {
+            __disable_irq();
+            Advance(0x10000UL - TMR0_GetCountValue(TMR0X, TMR0_CH));
+            TEST_ASSERT_EQ(SET, TMR0_GetStatus(TMR0X, TMR0_FLAG_CMP_B));
+            Check();
+            Advance(TEST_Rand() % 0x100UL);
+            Check();
+            __enable_irq();
+            TICKLESS_IrqHandler();
+            Check();
+        }
+    }
+    TEST_ASSERT(m_u64Now > (1ULL << 34U));
+    TEST_ASSERT_EQ((m_u64Now / 32768ULL) * 1000000ULL + (((m_u64Now % 32768ULL) * 1000000ULL) / 32768ULL),
+                   TICKLESS_GetTimeUS());
+    TEST_ASSERT_EQ(0UL, m_u32AlarmCount);
+
+    /* Stopped, restarted from 0 */
+    TICKLESS_DeInit();
+    TEST_ASSERT_EQ(LL_ERR_UNINIT, TICKLESS_SetAlarm(0ULL));
+    TICKLESS_DelayMS(1UL);
+    Setup(TMR0_CLK_SRC_LRC, 32768UL);
+    Check();
+}
+
+static void TestAlarm(void)
+{
+    uint64_t u64Alarm;
+    uint64_t u64Set;
+    uint32_t u32Count;
+    uint32_t n;
+
+    TEST_Seed(260UL);
+    for (n = 0UL; n < 20000UL; n++) {
+        if (0UL == (n % 5000UL)) {
+            Setup(((n / 5000UL) % 2UL) ? TMR0_CLK_SRC_INTERN_CLK : TMR0_CLK_SRC_LRC, 32768UL);
+        }
+        Advance(TEST_Rand() % 0x20000UL);
+        u64Set = m_u64Now;
+        switch (TEST_Rand() % 4UL) {
+            case 0UL:
+                /* In the past */
+                u64Alarm = m_u64Now - (LL_MIN(m_u64Now, TEST_Rand() % 0x100UL));
+                break;
+            case 1UL:
+                u64Alarm = m_u64Now + (TEST_Rand() % 0x10UL);
+                break;
+            default:
+                u64Alarm = m_u64Now + (TEST_Rand() % 0x50000UL);
+                break;
+        }
+        u32Count = m_u32AlarmCount;
+        TEST_ASSERT_EQ(LL_OK, TICKLESS_SetAlarm(u64Alarm));
+
+        if (0UL == (TEST_Rand() % 8UL)) {
+            TICKLESS_CancelAlarm();
+            Advance(0x50000UL);
+            TEST_ASSERT_EQ(u32Count, m_u32AlarmCount);
+            continue;
+        }
+        while (u32Count == m_u32AlarmCount) {
+            TEST_ASSERT(m_u64Now <= (LL_MAX(u64Alarm, u64Set) + m_u32Margin + 1UL));
+            Advance(1UL + (TEST_Rand() % 0x400UL));
+        }
+        TEST_ASSERT_EQ(u32Count + 1UL, m_u32AlarmCount);
+        TEST_ASSERT(m_u64AlarmTick >= u64Alarm);
+        TEST_ASSERT(m_u64AlarmTick <= (LL_MAX(u64Alarm, u64Set) + m_u32Margin + 1UL));
+        Check();
+    }
+}
+
+static void TestDelay(void)
+{
+    uint64_t u64Start;
+    uint64_t u64Alarm;
+    uint32_t u32Us;
+    uint32_t u32Sleep;
+    uint32_t n;
+
+    Setup(TMR0_CLK_SRC_INTERN_CLK, 1000000UL);
+    g_pfnHostWfi = &Wfi;
+    TEST_Seed(2600UL);
+    for (n = 0UL; n < 5000UL; n++) {
+        Advance(TEST_Rand() % 0x20000UL);
+        u32Us = TEST_Rand() % ((0UL == (n % 2UL)) ? 100UL : 500000UL);
+
+        /* An alarm expiring during the delay */
+        u64Alarm = TICKLESS_ALARM_NONE;
+        if ((0UL == (n % 3UL)) && (u32Us > m_u32Margin)) {
+            u64Alarm = m_u64Now + m_u32Margin + 1UL + (TEST_Rand() % (u32Us - m_u32Margin));
+            TEST_ASSERT_EQ(LL_OK, TICKLESS_SetAlarm(u64Alarm));
+        }
+        /* Sleep mode by PWC, or WFI directly with the PWC registers locked */
+        CM_PWC->FPRC = (0UL == (n % 4UL)) ? 0U : PWC_FPRC_FPRCB1;
+        SCB->SCR = SCB_SCR_SLEEPDEEP_Msk;
+        u32Sleep = FAKE_PWC_GetSleepCount();
+        m_u32Wfi = 0UL;
+        m_u32Spurious = 0UL;
+
+        u64Start = m_u64Now;
+        m_u32AlarmCount = 0UL;
+        TICKLESS_DelayUS(u32Us);
+        TakePending();
+        CheckDelay(u64Start, u32Us);
+        if (TICKLESS_ALARM_NONE != u64Alarm) {
+            TEST_ASSERT_EQ(1UL, m_u32AlarmCount);
+            TEST_ASSERT(m_u64AlarmTick >= u64Alarm);
+        }
+        if (0UL == m_u32Wfi) {
+            TEST_ASSERT_EQ(0UL, u32Us);
+        } else if (0U == CM_PWC->FPRC) {
+            TEST_ASSERT_EQ(0UL, SCB->SCR & SCB_SCR_SLEEPDEEP_Msk);
+            TEST_ASSERT_EQ(u32Sleep, FAKE_PWC_GetSleepCount());
+        } else {
+            TEST_ASSERT_EQ(u32Sleep + m_u32Wfi, FAKE_PWC_GetSleepCount());
+        }
+        /* Woken up by the compare match once per counter period, the alarm and the deadline */
+        TEST_ASSERT((m_u32Wfi - m_u32Spurious) <= ((u32Us / 0x10000UL) + 3UL));
+    }
+
+    /* Milliseconds at the LRC, rounded up */
+    Setup(TMR0_CLK_SRC_LRC, 32768UL);
+    for (n = 0UL; n < 200UL; n++) {
+        u64Start = m_u64Now;
+        TICKLESS_DelayMS(n * 37UL);
+        TakePending();
+        CheckDelay(u64Start, ((n * 37ULL * 32768ULL) + 999ULL) / 1000ULL);
+    }
+    g_pfnHostWfi = NULL;
+}
+
+static void TestSuspend(void)
+{
+    uint32_t u32Irq;
+    uint64_t u64Start;
+    uint32_t n;
+
+    Setup(TMR0_CLK_SRC_LRC, 32768UL);
+    TEST_ASSERT_EQ(LL_OK, SysTick_Init(1000UL));
+    g_pfnHostWfi = &Wfi;
+    TEST_Seed(26000UL);
+    for (n = 0UL; n < 500UL; n++) {
+        SysTick_Suspend();
+        Advance(TEST_Rand() % 0x8000UL);
+        u64Start = m_u64Now;
+        if (0UL == (n % 2UL)) {
+            SysTick_Delay(n);
+            CheckDelay(u64Start, (((uint64_t)n * 32768ULL) + 999ULL) / 1000ULL);
+        } else {
+            TICKLESS_DelayUS(n * 100UL);
+            CheckDelay(u64Start, (((uint64_t)n * 100ULL * 32768ULL) + 999999ULL) / 1000000ULL);
+        }
+
+        /* Still suspended: the next compare match is left pending */
+        u32Irq = FAKE_TMR0_GetIrqCount(TMR0X, TMR0_CH);
+        if (SET != TMR0_GetStatus(TMR0X, TMR0_FLAG_CMP_B)) {
+            Advance(ToCompare());
+        }
+        TEST_ASSERT_EQ(u32Irq, FAKE_TMR0_GetIrqCount(TMR0X, TMR0_CH));
+        TEST_ASSERT_EQ(SET, TMR0_GetStatus(TMR0X, TMR0_FLAG_CMP_B));
+        Check();
+
+        /* Resumed, the pending interrupt is taken */
+        SysTick_Resume();
+        SysTick_IncTick();
+        Check();
+        Advance(0x20000UL);
+        TEST_ASSERT(FAKE_TMR0_GetIrqCount(TMR0X, TMR0_CH) > u32Irq);
+        Check();
+        TEST_ASSERT_EQ((uint32_t)(TICKLESS_GetTimeUS() / 1000ULL), SysTick_GetTick());
+    }
+    g_pfnHostWfi = NULL;
+}
+
+int main(void)
+{
+    TestTick();
+    TestAlarm();
+    TestDelay();
+    TestSuspend();
+    return TEST_Result("tickless");
+}
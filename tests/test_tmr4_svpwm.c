@@ -0,0 +1,344 @@
+/**
+ *******************************************************************************
+ * @file  test_tmr4_svpwm.c
+ * @brief TMR4 space vector PWM: the compare values of TMR4_SVPWM_Calc()
+ *        against the seven segment modulation computed by sector and angle in
+ *        floating point, clipping beyond the linear range, the ADC trigger
+ *        point against a search of the quietest instant on the counter
+ *        timeline, the registers written by TMR4_SVPWM_Update(), and a
+ *        benchmark of the per cycle computation.
+ *******************************************************************************
+ */
+#define _GNU_SOURCE
+#include <math.h>
+#include <stdlib.h>
+#include <time.h>
+#include "test.h"
+#include "fake_tmr4.h"
+#include "hc32_ll_tmr4_svpwm.h"
+
+#define PI                              (3.14159265358979323846)
+#define SQRT3                           (1.73205080756887729353)
+
+#define BENCH_OPS                       (1000000UL)
+
+static stc_tmr4_svpwm_t m_stcSvpwm;
+
+static double NowNs(void)
+{
+    struct timespec stcTs;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &stcTs);
+    return ((double)stcTs.tv_sec * 1e9) + (double)stcTs.tv_nsec;
+}
+
+static void Setup(uint16_t u16Period, uint16_t u16DeadTime, uint16_t u16Settle, uint16_t u16Sample)
+{
+    stc_tmr4_svpwm_init_t stcInit;
+
+    FAKE_TMR4_Reset();
+    CM_TMR4_2->CPSR = u16Period;
+    (void)TMR4_SVPWM_StructInit(&stcInit);
+    stcInit.TMR4x          = CM_TMR4_2;
+    stcInit.u32EvtCh       = TMR4_EVT_CH_UH + 3UL;
+    stcInit.u16DeadTime    = u16DeadTime;
+    stcInit.u16SettleTicks = u16Settle;
+    stcInit.u16SampleTicks = u16Sample;
+    TEST_ASSERT_EQ(LL_OK, TMR4_SVPWM_Init(&m_stcSvpwm, &stcInit));
+}
+
+/* Seven segment SVPWM by sector and angle, duty cycles of the phases in [0, 1] */
+static uint32_t Reference(double dAlpha, double dBeta, double *pdDuty)
+{
+    const double dMag = sqrt((dAlpha * dAlpha) + (dBeta * dBeta));
+    double dAngle = atan2(dBeta, dAlpha);
+    double dT1;
+    double dT2;
+    double dT0;
+    double dIn;
+    uint32_t u32Sector;
+
+    if (dAngle < 0.0) {
+        dAngle += 2.0 * PI;
+    }
+    u32Sector = (uint32_t)(dAngle / (PI / 3.0));
+    if (u32Sector > 5UL) {
+        u32Sector = 5UL;
+    }
+    dIn = dAngle - ((double)u32Sector * (PI / 3.0));
+    dT1 = SQRT3 * dMag * sin((PI / 3.0) - dIn);
+    dT2 = SQRT3 * dMag * sin(dIn);
+    dT0 = 1.0 - dT1 - dT2;
+
+    switch (u32Sector) {
+        case 0UL:
+            pdDuty[0] = dT1 + dT2 + (dT0 / 2.0);
+            pdDuty[1] = dT2 + (dT0 / 2.0);
+            pdDuty[2] = dT0 / 2.0;
+            break;
+        case 1UL:
+            pdDuty[0] = dT1 + (dT0 / 2.0);
+            pdDuty[1] = dT1 + dT2 + (dT0 / 2.0);
+            pdDuty[2] = dT0 / 2.0;
+            break;
+        case 2UL:
+            pdDuty[0] = dT0 / 2.0;
+            pdDuty[1] = dT1 + dT2 + (dT0 / 2.0);
+            pdDuty[2] = dT2 + (dT0 / 2.0);
+            break;
+        case 3UL:
+            pdDuty[0] = dT0 / 2.0;
+            pdDuty[1] = dT1 + (dT0 / 2.0);
+            pdDuty[2] = dT1 + dT2 + (dT0 / 2.0);
+            break;
+        case 4UL:
+            pdDuty[0] = dT2 + (dT0 / 2.0);
+            pdDuty[1] = dT0 / 2.0;
+            pdDuty[2] = dT1 + dT2 + (dT0 / 2.0);
+            break;
+        default:
+            pdDuty[0] = dT1 + dT2 + (dT0 / 2.0);
+            pdDuty[1] = dT0 / 2.0;
+            pdDuty[2] = dT1 + (dT0 / 2.0);
+            break;
+    }
+    return u32Sector + 1UL;
+}
+
+/* Ticks from an instant of the cycle (valley at 0, peak at u32Period) to the nearest edge */
+static uint32_t EdgeDist(const stc_tmr4_svpwm_cmp_t *pstcCmp, uint32_t u32Period, uint32_t u32Time)
+{
+    const uint32_t u32Cycle = 2UL * u32Period;
+    uint32_t u32Min = u32Cycle;
+    uint32_t u32Edge;
+    uint32_t u32Dist;
+    uint32_t i;
+    uint32_t j;
+
+    for (i = 0UL; i < 3UL; i++) {
+        for (j = 0UL; j < 2UL; j++) {
+            u32Edge = (0UL == j) ? pstcCmp->au16Cmp[i] : (u32Cycle - pstcCmp->au16Cmp[i]);
+            u32Dist = (u32Time > u32Edge) ? (u32Time - u32Edge) : (u32Edge - u32Time);
+            if ((u32Cycle - u32Dist) < u32Dist) {
+                u32Dist = u32Cycle - u32Dist;
+            }
+            if (u32Dist < u32Min) {
+                u32Min = u32Dist;
+            }
+        }
+    }
+    return u32Min;
+}
+
+static void TestDuty(void)
+{
+    const uint16_t au16Period[] = {2100U, 4200U, 8400U, 65535U};
+    stc_tmr4_svpwm_cmp_t stcCmp;
+    double adDuty[3];
+    double dAngle;
+    double dMag;
+    double dTol;
+    double dSector;
+    int16_t i16Alpha;
+    int16_t i16Beta;
+    uint32_t u32Sector;
+    uint32_t p;
+    uint32_t n;
+    uint32_t i;
+
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, TMR4_SVPWM_StructInit(NULL));
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, TMR4_SVPWM_Calc(NULL, 0, 0, &stcCmp));
+
+    TEST_Seed(1UL);
+    for (p = 0UL; p < (sizeof(au16Period) / sizeof(au16Period[0])); p++) {
+        Setup(au16Period[p], 0U, 0U, 0U);
+        TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, TMR4_SVPWM_Calc(&m_stcSvpwm, 0, 0, NULL));
+        /* Q15 rounding of the inputs and of sqrt(3)/2 */
+        dTol = 1.0 + ((double)au16Period[p] * 4.0 / 32768.0);
+
+        /* Zero vector: every phase at half duty */
+        (void)TMR4_SVPWM_Calc(&m_stcSvpwm, 0, 0, &stcCmp);
+        for (i = 0UL; i < 3UL; i++) {
+            TEST_ASSERT(abs((int32_t)stcCmp.au16Cmp[i] - (int32_t)(au16Period[p] / 2U)) <= 1);
+        }
+
+        for (n = 0UL; n < 20000UL; n++) {
+            dAngle = 2.0 * PI * (double)(TEST_Rand() % 100000UL) / 100000.0;
+            dMag = (double)TMR4_SVPWM_LINEAR_MAX * (double)(TEST_Rand() % 1001UL) / 1000.0;
+            i16Alpha = (int16_t)lround(dMag * cos(dAngle));
+            i16Beta  = (int16_t)lround(dMag * sin(dAngle));
+            (void)TMR4_SVPWM_Calc(&m_stcSvpwm, i16Alpha, i16Beta, &stcCmp);
+
+            u32Sector = Reference((double)i16Alpha / 32768.0, (double)i16Beta / 32768.0, adDuty);
+            for (i = 0UL; i < 3UL; i++) {
+                TEST_ASSERT(fabs((double)stcCmp.au16Cmp[i] - (adDuty[i] * au16Period[p])) <= dTol);
+                TEST_ASSERT(stcCmp.au16Cmp[i] <= au16Period[p]);
+            }
+            /* Sector away from its borders, where two phases tie */
+            dSector = atan2((double)i16Beta, (double)i16Alpha) / (PI / 3.0);
+            if (dSector < 0.0) {
+                dSector += 6.0;
+            }
+            if ((dMag > 100.0) && (fabs(dSector - round(dSector)) > 0.01)) {
+                TEST_ASSERT_EQ(u32Sector, stcCmp.u8Sector);
+            }
+        }
+    }
+}
+
+static void TestClip(void)
+{
+    stc_tmr4_svpwm_cmp_t stcCmp;
+    double dAngle;
+    int16_t i16Alpha;
+    int16_t i16Beta;
+    int32_t ai32V[3];
+    uint32_t n;
+    uint32_t i;
+    uint32_t j;
+
+    TEST_Seed(2UL);
+    Setup(4200U, 0U, 0U, 0U);
+    for (n = 0UL; n < 20000UL; n++) {
+        dAngle = 2.0 * PI * (double)(TEST_Rand() % 100000UL) / 100000.0;
+        i16Alpha = (int16_t)lround(32767.0 * cos(dAngle));
+        i16Beta  = (int16_t)lround(32767.0 * sin(dAngle));
+        (void)TMR4_SVPWM_Calc(&m_stcSvpwm, i16Alpha, i16Beta, &stcCmp);
+
+        /* Clipped to the period, the order of the phase voltages is kept */
+        ai32V[0] = 2L * i16Alpha;
+        ai32V[1] = -(int32_t)i16Alpha + lround(SQRT3 * i16Beta);
+        ai32V[2] = -(int32_t)i16Alpha - lround(SQRT3 * i16Beta);
+        for (i = 0UL; i < 3UL; i++) {
+            TEST_ASSERT(stcCmp.au16Cmp[i] <= 4200U);
+            for (j = 0UL; j < 3UL; j++) {
+                if (ai32V[i] > (ai32V[j] + 8L)) {
+                    TEST_ASSERT(stcCmp.au16Cmp[i] >= stcCmp.au16Cmp[j]);
+                }
+            }
+        }
+    }
+}
+
+static void TestTrigger(void)
+{
+    const uint16_t au16Sample[] = {0U, 20U, 60U, 200U};
+    stc_tmr4_svpwm_cmp_t stcCmp;
+    double dAngle;
+    double dMag;
+    uint32_t u32Period = 4200UL;
+    uint32_t u32Half;
+    uint32_t u32Center;
+    uint32_t u32Best;
+    uint32_t u32Dist;
+    int32_t i32Ret;
+    uint32_t s;
+    uint32_t n;
+    uint32_t t;
+
+    TEST_Seed(3UL);
+    for (s = 0UL; s < (sizeof(au16Sample) / sizeof(au16Sample[0])); s++) {
+        Setup((uint16_t)u32Period, 40U, 30U, au16Sample[s]);
+        u32Half = au16Sample[s] / 2UL;
+        for (n = 0UL; n < 1000UL; n++) {
+            dAngle = 2.0 * PI * (double)(TEST_Rand() % 100000UL) / 100000.0;
+            dMag = (double)TMR4_SVPWM_LINEAR_MAX * (double)(TEST_Rand() % 1001UL) / 1000.0;
+            i32Ret = TMR4_SVPWM_Calc(&m_stcSvpwm, (int16_t)lround(dMag * cos(dAngle)),
+                                     (int16_t)lround(dMag * sin(dAngle)), &stcCmp);
+
+            /* Sampling center on the timeline of the cycle */
+            if (TMR4_EVT_MATCH_CNT_DOWN == stcCmp.u16TrigCond) {
+                TEST_ASSERT_EQ(u32Half, stcCmp.u16TrigCmp);
+                u32Center = 0UL;
+            } else {
+                TEST_ASSERT_EQ(TMR4_EVT_MATCH_CNT_UP, stcCmp.u16TrigCond);
+                u32Center = stcCmp.u16TrigCmp + u32Half;
+            }
+            u32Dist = EdgeDist(&stcCmp, u32Period, u32Center);
+            TEST_ASSERT((u32Dist + 1UL) >= stcCmp.u16QuietTicks);
+            TEST_ASSERT(u32Dist <= ((uint32_t)stcCmp.u16QuietTicks + 1UL));
+
+            /* No instant of the cycle is quieter */
+            u32Best = 0UL;
+            for (t = 0UL; t < (2UL * u32Period); t++) {
+                u32Dist = EdgeDist(&stcCmp, u32Period, t);
+                if (u32Dist > u32Best) {
+                    u32Best = u32Dist;
+                }
+            }
+            TEST_ASSERT(u32Best <= ((uint32_t)stcCmp.u16QuietTicks + 1UL));
+
+            TEST_ASSERT_EQ((stcCmp.u16QuietTicks >= (70UL + u32Half)) ? LL_OK : LL_ERR, i32Ret);
+        }
+    }
+}
+
+static void TestUpdate(void)
+{
+    stc_tmr4_svpwm_cmp_t stcCmp;
+    uint32_t u32Cond;
+    uint32_t u32Count;
+    uint32_t n;
+    uint32_t i;
+
+    TEST_Seed(4UL);
+    Setup(4200U, 40U, 30U, 60U);
+    for (i = 0UL; i < 3UL; i++) {
+        TEST_ASSERT_EQ(TMR4_OC_BUF_COND_VALLEY, FAKE_TMR4_GetOcBufCond(CM_TMR4_2, TMR4_OC_CH_UH + (2UL * i)));
+        TEST_ASSERT_EQ(2100U, CM_TMR4_2->OCCR[2UL * i]);
+        TEST_ASSERT_EQ(40U, CM_TMR4_2->PDAR[i]);
+        TEST_ASSERT_EQ(40U, CM_TMR4_2->PDBR[i]);
+    }
+    TEST_ASSERT_EQ(TMR4_EVT_BUF_COND_VALLEY | TMR4_EVT_MATCH_CNT_DOWN, CM_TMR4_2->SCSR[3]);
+    TEST_ASSERT_EQ(30U, CM_TMR4_2->SCCR[3]);
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, TMR4_SVPWM_Update(NULL, 0, 0));
+
+    u32Cond = TMR4_EVT_MATCH_CNT_DOWN;
+    for (n = 0UL; n < 2000UL; n++) {
+        const int16_t i16Alpha = (int16_t)((int32_t)(TEST_Rand() % 37839UL) - 18919L);
+        const int16_t i16Beta  = (int16_t)((int32_t)(TEST_Rand() % 37839UL) - 18919L);
+
+        (void)TMR4_SVPWM_Calc(&m_stcSvpwm, i16Alpha, i16Beta, &stcCmp);
+        u32Count = FAKE_TMR4_GetMatchCondCount(CM_TMR4_2);
+        (void)TMR4_SVPWM_Update(&m_stcSvpwm, i16Alpha, i16Beta);
+        TEST_ASSERT_EQ(stcCmp.au16Cmp[0], CM_TMR4_2->OCCR[TMR4_OC_CH_UH]);
+        TEST_ASSERT_EQ(stcCmp.au16Cmp[1], CM_TMR4_2->OCCR[TMR4_OC_CH_VH]);
+        TEST_ASSERT_EQ(stcCmp.au16Cmp[2], CM_TMR4_2->OCCR[TMR4_OC_CH_WH]);
+        TEST_ASSERT_EQ(stcCmp.u16TrigCmp, CM_TMR4_2->SCCR[3]);
+        TEST_ASSERT_EQ(TMR4_EVT_BUF_COND_VALLEY | stcCmp.u16TrigCond, CM_TMR4_2->SCSR[3]);
+        /* The match condition is not buffered, it is written on a change only */
+        TEST_ASSERT_EQ((stcCmp.u16TrigCond != u32Cond) ? (u32Count + 2UL) : u32Count,
+                       FAKE_TMR4_GetMatchCondCount(CM_TMR4_2));
+        u32Cond = stcCmp.u16TrigCond;
+    }
+}
+
+static void Bench(void)
+{
+    stc_tmr4_svpwm_cmp_t stcCmp;
+    volatile uint32_t u32Sink = 0UL;
+    double dStart;
+    int16_t i16Alpha;
+    int16_t i16Beta;
+    uint32_t n;
+
+    Setup(4200U, 40U, 30U, 60U);
+    dStart = NowNs();
+    for (n = 0UL; n < BENCH_OPS; n++) {
+        i16Alpha = (int16_t)((int32_t)(n * 37UL % 37839UL) - 18919L);
+        i16Beta  = (int16_t)((int32_t)(n * 101UL % 37839UL) - 18919L);
+        (void)TMR4_SVPWM_Calc(&m_stcSvpwm, i16Alpha, i16Beta, &stcCmp);
+        u32Sink += stcCmp.u16TrigCmp;
+    }
+    printf("TMR4_SVPWM_Calc: %.1f ns/op\n", (NowNs() - dStart) / (double)BENCH_OPS);
+}
+
+int main(void)
+{
+    TestDuty();
+    TestClip();
+    TestTrigger();
+    TestUpdate();
+    Bench();
+    return TEST_Result("tmr4_svpwm");
+}
@@ -0,0 +1,325 @@
+/**
+ *******************************************************************************
+ * @file  test_tmr6_sync.c
+ * @brief TMR6 PWM set against the TMR6 and DMA models: staged values held
+ *        over any number of periods, a commit releasing every unit by its
+ *        BCONR without a buffer API call, the guard wait before the writes
+ *        when a commit is issued close to the commit point, all units taking
+ *        the values at the same overflow, and the duty table replay with its
+ *        parameter checks, releasing a staged hold of the replayed unit.
+ *******************************************************************************
+ */
+#include "test.h"
+#include "fake_dma.h"
+#include "fake_tmr6.h"
+#include "hc32_ll_tmr6_sync.h"
+
+#define UNIT_NUM                        (3U)
+#define CH_NUM                          (4UL)
+#define PERIOD                          (999UL)
+#define GUARD                           (40UL)
+
+static CM_TMR6_TypeDef *const m_apstcUnit[UNIT_NUM] = {CM_TMR6_2, CM_TMR6_5, CM_TMR6_7};
+static const uint8_t m_au8Ch[UNIT_NUM] = {TMR6_SYNC_CH_AB, TMR6_SYNC_CH_A, TMR6_SYNC_CH_B};
+
+static stc_tmr6_sync_t m_stcSync;
+static uint8_t m_u8Held;
+static uint32_t m_u32Violation;
+
+/* Buffer functions of a unit: all its channels and the period when released, none when held */
+static uint32_t BufBits(uint32_t u32Unit, uint8_t u8Run)
+{
+    uint32_t u32Bits = 0UL;
+
+    if (0U != u8Run) {
+        u32Bits = TMR6_BCONR_BENP;
+        if (0U != (m_au8Ch[u32Unit] & TMR6_SYNC_CH_A)) {
+            u32Bits |= TMR6_BCONR_BENA;
+        }
+        if (0U != (m_au8Ch[u32Unit] & TMR6_SYNC_CH_B)) {
+            u32Bits |= TMR6_BCONR_BENB;
+        }
+    }
+    return u32Bits;
+}
+
+static uint32_t BufState(uint32_t u32Unit)
+{
+    return m_apstcUnit[u32Unit]->BCONR & (TMR6_BCONR_BENA | TMR6_BCONR_BENB | TMR6_BCONR_BENP);
+}
+
+/* The commit waits with every unit still held */
+static void ReadHook(void)
+{
+    uint32_t i;
+
+    for (i = 0UL; i < UNIT_NUM; i++) {
+        if (BufState(i) != BufBits(i, (uint8_t)(0U == m_u8Held))) {
+            m_u32Violation++;
+        }
+    }
+}
+
+static void Setup(void)
+{
+    stc_tmr6_sync_init_t stcInit;
+    uint32_t i;
+
+    FAKE_DMA_Reset();
+    FAKE_TMR6_Reset();
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, TMR6_SYNC_StructInit(NULL));
+    (void)TMR6_SYNC_StructInit(&stcInit);
+    stcInit.u8UnitNum     = UNIT_NUM;
+    stcInit.u32GuardTicks = GUARD;
+    for (i = 0UL; i < UNIT_NUM; i++) {
+        m_apstcUnit[i]->PERAR = PERIOD;
+        m_apstcUnit[i]->PERBR = PERIOD;
+        stcInit.apstcTmr6[i]  = m_apstcUnit[i];
+        stcInit.au8Ch[i]      = m_au8Ch[i];
+    }
+    TEST_ASSERT_EQ(LL_OK, TMR6_SYNC_Init(&m_stcSync, &stcInit));
+    for (i = 0UL; i < UNIT_NUM; i++) {
+        TEST_ASSERT_EQ(BufBits(i, 1U), BufState(i));
+    }
+    TMR6_SYNC_Start(&m_stcSync);
+    m_u8Held = 0U;
+    m_u32Violation = 0UL;
+}
+
+/* Working compare registers in the order of TMR6_SYNC_SetCompareAll() */
+static void GetWorking(uint32_t *pu32Value)
+{
+    uint32_t i;
+
+    for (i = 0UL; i < UNIT_NUM; i++) {
+        if (0U != (m_au8Ch[i] & TMR6_SYNC_CH_A)) {
+            *pu32Value++ = m_apstcUnit[i]->GCMAR;
+        }
+        if (0U != (m_au8Ch[i] & TMR6_SYNC_CH_B)) {
+            *pu32Value++ = m_apstcUnit[i]->GCMBR;
+        }
+    }
+}
+
+static void CheckWorking(const uint32_t *pu32Expect)
+{
+    uint32_t au32Value[CH_NUM];
+    uint32_t i;
+
+    GetWorking(au32Value);
+    for (i = 0UL; i < CH_NUM; i++) {
+        TEST_ASSERT_EQ(pu32Expect[i], au32Value[i]);
+    }
+}
+
+static void TestCommit(void)
+{
+    uint32_t au32Old[CH_NUM];
+    uint32_t au32New[CH_NUM];
+    uint32_t u32Ovf;
+    uint32_t u32Reads;
+    uint32_t u32Calls;
+    uint32_t u32Dist;
+    uint32_t u32Wait = 0UL;
+    uint32_t n;
+    uint32_t i;
+
+    Setup();
+    FAKE_TMR6_SetRead(1UL, &ReadHook);
+    TEST_Seed(44UL);
+    for (n = 0UL; n < 2000UL; n++) {
+        FAKE_TMR6_Run(TEST_Rand() % 3000UL);
+        GetWorking(au32Old);
+        for (i = 0UL; i < CH_NUM; i++) {
+            au32New[i] = TEST_Rand() % PERIOD;
+        }
+        TMR6_SYNC_SetCompareAll(&m_stcSync, au32New);
+        TMR6_SYNC_SetPeriod(&m_stcSync, (uint8_t)(n % UNIT_NUM), PERIOD);
+        m_u8Held = 1U;
+        ReadHook();
+
+        /* Held over any number of periods */
+        FAKE_TMR6_Run(TEST_Rand() % 3000UL);
+        CheckWorking(au32Old);
+
+        /* Half of the commits are issued inside the guard */
+        u32Dist = PERIOD - m_apstcUnit[0]->CNTER;
+        if ((0UL != (n & 1UL)) && (u32Dist >= GUARD)) {
+            FAKE_TMR6_Run(u32Dist - (TEST_Rand() % GUARD));
+            u32Dist = PERIOD - m_apstcUnit[0]->CNTER;
+        }
+        u32Ovf   = FAKE_TMR6_GetOvfCount(m_apstcUnit[0]);
+        u32Reads = FAKE_TMR6_GetReadCount();
+        u32Calls = FAKE_TMR6_GetBufCallCount();
+        TMR6_SYNC_Commit(&m_stcSync);
+        m_u8Held = 0U;
+        ReadHook();
+        TEST_ASSERT_EQ(u32Calls, FAKE_TMR6_GetBufCallCount());
+
+        if (u32Dist >= GUARD) {
+            TEST_ASSERT_EQ(u32Reads + 1UL, FAKE_TMR6_GetReadCount());
+            TEST_ASSERT_EQ(u32Ovf, FAKE_TMR6_GetOvfCount(m_apstcUnit[0]));
+        } else {
+            /* Waited past the point, which the held units let go by */
+            u32Wait++;
+            TEST_ASSERT(FAKE_TMR6_GetReadCount() > (u32Reads + 1UL));
+            TEST_ASSERT_EQ(u32Ovf + 1UL, FAKE_TMR6_GetOvfCount(m_apstcUnit[0]));
+            TEST_ASSERT((PERIOD - m_apstcUnit[0]->CNTER) >= GUARD);
+            u32Ovf++;
+        }
+        CheckWorking(au32Old);
+
+        /* All units take the values at the next overflow */
+        while (FAKE_TMR6_GetOvfCount(m_apstcUnit[0]) == u32Ovf) {
+            CheckWorking(au32Old);
+            FAKE_TMR6_Run(1UL);
+        }
+        CheckWorking(au32New);
+        for (i = 0UL; i < UNIT_NUM; i++) {
+            TEST_ASSERT_EQ(0UL, m_apstcUnit[i]->CNTER);
+            TEST_ASSERT_EQ(PERIOD, m_apstcUnit[i]->PERAR);
+        }
+
+        /* Nothing staged, nothing written */
+        TMR6_SYNC_Commit(&m_stcSync);
+        TEST_ASSERT_EQ(u32Calls, FAKE_TMR6_GetBufCallCount());
+    }
+    TEST_ASSERT(u32Wait > 500UL);
+    TEST_ASSERT_EQ(0UL, m_u32Violation);
+    FAKE_TMR6_SetRead(0UL, NULL);
+}
+
+static void TestReplay(void)
+{
+    static const uint32_t au32TableA[5] = {100UL, 300UL, 500UL, 700UL, 900UL};
+    static const uint32_t au32TableAB[6] = {10UL, 990UL, 20UL, 980UL, 30UL, 970UL};
+    stc_tmr6_sync_replay_t stcReplay;
+    stc_tmr6_sync_replay_t stcReplayAB;
+    uint32_t u32Ovf;
+    uint32_t n;
+
+    Setup();
+    /* A staged hold of every unit, the replay releases its own unit only */
+    TMR6_SYNC_SetCompare(&m_stcSync, 0U, TMR6_SYNC_CH_A, 5UL);
+    TMR6_SYNC_SetCompare(&m_stcSync, 1U, TMR6_SYNC_CH_A, 1UL);
+    TEST_ASSERT_EQ(0UL, BufState(0UL) | BufState(1UL) | BufState(2UL));
+
+    (void)TMR6_SYNC_ReplayStructInit(&stcReplay);
+    stcReplay.pstcDmaUnit   = CM_DMA1;
+    stcReplay.u8DmaCh       = DMA_CH2;
+    stcReplay.u32TrigTarget = AOS_DMA1_2;
+    stcReplay.enEvtSrc      = EVT_SRC_TMR6_5_OVF;
+    stcReplay.pu32Table     = au32TableA;
+    stcReplay.u32Len        = 5UL;
+    TEST_ASSERT_EQ(LL_OK, TMR6_SYNC_ReplayStart(&m_stcSync, 1U, &stcReplay));
+    TEST_ASSERT_EQ(ENABLE, FAKE_DMA_GetChState(CM_DMA1, DMA_CH2));
+    TEST_ASSERT_EQ(BufBits(1UL, 1U), BufState(1UL));
+    TEST_ASSERT_EQ(0UL, BufState(0UL) | BufState(2UL));
+
+    /* Each entry is written at an overflow and taken at the next one */
+    u32Ovf = FAKE_TMR6_GetOvfCount(CM_TMR6_5);
+    FAKE_TMR6_Run(PERIOD + 1UL - CM_TMR6_5->CNTER);
+    for (n = 0UL; n < 12UL; n++) {
+        FAKE_TMR6_Run(PERIOD + 1UL);
+        TEST_ASSERT_EQ(u32Ovf + n + 2UL, FAKE_TMR6_GetOvfCount(CM_TMR6_5));
+        TEST_ASSERT_EQ(au32TableA[n % 5UL], CM_TMR6_5->GCMAR);
+    }
+    TEST_ASSERT_EQ(0UL, CM_TMR6_2->GCMAR);
+    TMR6_SYNC_ReplayStop(&stcReplay);
+    TEST_ASSERT_EQ(DISABLE, FAKE_DMA_GetChState(CM_DMA1, DMA_CH2));
+    FAKE_TMR6_Run(3UL * (PERIOD + 1UL));
+    TEST_ASSERT_EQ(au32TableA[2], CM_TMR6_5->GCMAR);
+    /* The other units are still held until the commit */
+    TEST_ASSERT_EQ(0UL, CM_TMR6_2->GCMAR);
+    TMR6_SYNC_Commit(&m_stcSync);
+    FAKE_TMR6_Run(PERIOD + 1UL);
+    TEST_ASSERT_EQ(5UL, CM_TMR6_2->GCMAR);
+
+    /* Both channels of a unit, interleaved, on the underflow event */
+    (void)TMR6_SYNC_ReplayStructInit(&stcReplayAB);
+    stcReplayAB.pstcDmaUnit   = CM_DMA2;
+    stcReplayAB.u8DmaCh       = DMA_CH7;
+    stcReplayAB.u32TrigTarget = AOS_DMA2_7;
+    stcReplayAB.enEvtSrc      = EVT_SRC_TMR6_2_UDF;
+    stcReplayAB.pu32Table     = au32TableAB;
+    stcReplayAB.u32Len        = 3UL;
+    TEST_ASSERT_EQ(LL_OK, TMR6_SYNC_ReplayStart(&m_stcSync, 0U, &stcReplayAB));
+    TEST_ASSERT_EQ(BufBits(0UL, 1U), BufState(0UL));
+    for (n = 0UL; n < 7UL; n++) {
+        FAKE_AOS_Fire(EVT_SRC_TMR6_2_UDF);
+        TEST_ASSERT_EQ(au32TableAB[(2UL * n) % 6UL], CM_TMR6_2->GCMCR);
+        TEST_ASSERT_EQ(au32TableAB[((2UL * n) + 1UL) % 6UL], CM_TMR6_2->GCMDR);
+    }
+    TMR6_SYNC_ReplayStop(&stcReplayAB);
+}
+
+static void TestReplayParam(void)
+{
+    static const uint32_t au32Table[4] = {1UL, 2UL, 3UL, 4UL};
+    stc_tmr6_sync_replay_t stcReplay;
+
+    Setup();
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, TMR6_SYNC_ReplayStructInit(NULL));
+    TEST_ASSERT_EQ(LL_OK, TMR6_SYNC_ReplayStructInit(&stcReplay));
+    TEST_ASSERT(NULL == stcReplay.pstcDmaUnit);
+    TEST_ASSERT_EQ(DMA_CH0, stcReplay.u8DmaCh);
+    TEST_ASSERT_EQ(AOS_DMA1_0, stcReplay.u32TrigTarget);
+    TEST_ASSERT_EQ(EVT_SRC_TMR6_1_OVF, stcReplay.enEvtSrc);
+    TEST_ASSERT(NULL == stcReplay.pu32Table);
+    TEST_ASSERT_EQ(0UL, stcReplay.u32Len);
+
+    /* No unit */
+    stcReplay.pu32Table     = au32Table;
+    stcReplay.u32Len        = 4UL;
+    stcReplay.enEvtSrc      = EVT_SRC_TMR6_7_OVF;
+    stcReplay.u32TrigTarget = AOS_DMA2_0;
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, TMR6_SYNC_ReplayStart(&m_stcSync, 2U, &stcReplay));
+    stcReplay.pstcDmaUnit   = CM_DMA1;
+    stcReplay.u32TrigTarget = AOS_DMA1_0;
+    TEST_ASSERT_EQ(LL_OK, TMR6_SYNC_ReplayStart(&m_stcSync, 2U, &stcReplay));
+    TMR6_SYNC_ReplayStop(&stcReplay);
+
+    /* The default event is of TMR6_1, not in the set */
+    stcReplay.enEvtSrc = EVT_SRC_TMR6_1_OVF;
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, TMR6_SYNC_ReplayStart(&m_stcSync, 2U, &stcReplay));
+    /* The event of another unit of the set */
+    stcReplay.enEvtSrc = EVT_SRC_TMR6_5_UDF;
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, TMR6_SYNC_ReplayStart(&m_stcSync, 2U, &stcReplay));
+    stcReplay.enEvtSrc = EVT_SRC_TMR6_7_UDF;
+    TEST_ASSERT_EQ(LL_OK, TMR6_SYNC_ReplayStart(&m_stcSync, 2U, &stcReplay));
+    TMR6_SYNC_ReplayStop(&stcReplay);
+
+    /* Target of another channel or unit */
+    stcReplay.u8DmaCh = DMA_CH1;
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, TMR6_SYNC_ReplayStart(&m_stcSync, 2U, &stcReplay));
+    stcReplay.u32TrigTarget = AOS_DMA1_1;
+    stcReplay.pstcDmaUnit   = CM_DMA2;
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, TMR6_SYNC_ReplayStart(&m_stcSync, 2U, &stcReplay));
+    stcReplay.u32TrigTarget = AOS_DMA2_1;
+    TEST_ASSERT_EQ(LL_OK, TMR6_SYNC_ReplayStart(&m_stcSync, 2U, &stcReplay));
+    TMR6_SYNC_ReplayStop(&stcReplay);
+
+    /* Channel 8 of DMA1 would alias the target of channel 0 of DMA2 */
+    stcReplay.pstcDmaUnit   = CM_DMA1;
+    stcReplay.u8DmaCh       = DMA_CH7 + 1U;
+    stcReplay.u32TrigTarget = AOS_DMA1_0 + ((uint32_t)stcReplay.u8DmaCh * 4UL);
+    TEST_ASSERT_EQ(AOS_DMA2_0, stcReplay.u32TrigTarget);
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, TMR6_SYNC_ReplayStart(&m_stcSync, 2U, &stcReplay));
+    TEST_ASSERT_EQ(DISABLE, FAKE_DMA_GetChState(CM_DMA2, DMA_CH0));
+
+    /* Table too long for the repeat counter, both channels */
+    stcReplay.u8DmaCh       = DMA_CH0;
+    stcReplay.u32TrigTarget = AOS_DMA1_0;
+    stcReplay.enEvtSrc      = EVT_SRC_TMR6_2_OVF;
+    stcReplay.u32Len        = 513UL;
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, TMR6_SYNC_ReplayStart(&m_stcSync, 0U, &stcReplay));
+    TEST_ASSERT_EQ(DISABLE, FAKE_DMA_GetChState(CM_DMA1, DMA_CH0));
+}
+
+int main(void)
+{
+    TestCommit();
+    TestReplay();
+    TestReplayParam();
+    return TEST_Result("tmr6_sync");
+}
@@ -0,0 +1,246 @@
+/**
+ *******************************************************************************
+ * @file  test_tmra_enc.c
+ * @brief TMRA quadrature encoder: the default event source, the position
+ *        across counter wraps against the edges fed to the counter model,
+ *        the M/T speed against the true speed at constant speeds, the bound
+ *        and the stop without edges, wraps seen with the interrupt masked,
+ *        and the sequence check of TMRA_ENC_GetState().
+ *******************************************************************************
+ */
+#include <math.h>
+#include <stdlib.h>
+#include "test.h"
+#include "fake_tmra.h"
+#include "hc32_ll_tmra_enc.h"
+
+#define TIME_BASE_FREQ                  (1000000UL)
+#define SAMPLE_TICKS                    (1000UL)
+#define SEGMENT_SAMPLES                 (200UL)
+#define SETTLE_SAMPLES                  (50UL)
+#define STOP_TICKS                      (50000UL)
+
+static stc_tmra_enc_t m_stcEnc;
+static int64_t m_i64TruePos;
+static double m_dTime;
+static double m_dNextEdge;
+
+static void EncIrq(void)
+{
+    TMRA_ENC_IrqHandler(&m_stcEnc);
+}
+
+static void Setup(void)
+{
+    stc_tmra_enc_init_t stcInit;
+
+    FAKE_TMRA_Reset();
+    HOST_AOS.TMRA_TRGSEL1 = 0UL;
+    (void)TMRA_ENC_StructInit(&stcInit);
+    stcInit.TMRAx        = CM_TMRA_1;
+    stcInit.pstcTimeBase = CM_TMRA_2;
+    stcInit.enEvtSrc     = EVT_SRC_TMRA_1_CMP;
+    stcInit.u32StopTime  = STOP_TICKS;
+    TEST_ASSERT_EQ(LL_OK, TMRA_ENC_Init(&m_stcEnc, &stcInit));
+    FAKE_TMRA_SetIrq(CM_TMRA_1, EncIrq);
+    TMRA_ENC_Start(&m_stcEnc, 1U);
+
+    m_i64TruePos = 0LL;
+    m_dTime      = 0.0;
+    m_dNextEdge  = -1.0;
+}
+
+/* Advance the time by u32Ticks at a constant speed in counts per second */
+static void Run(int32_t i32Speed, uint32_t u32Ticks)
+{
+    const double dEnd = m_dTime + (double)u32Ticks;
+    const double dPeriod = (0L != i32Speed) ? ((double)TIME_BASE_FREQ / fabs((double)i32Speed)) : 0.0;
+
+    if ((0L == i32Speed) || (m_dNextEdge < m_dTime)) {
+        m_dNextEdge = m_dTime + dPeriod;
+    }
+    if (0L != i32Speed) {
+        while (m_dNextEdge < dEnd) {
+            CM_TMRA_2->CNTER = (uint32_t)floor(m_dNextEdge) & 0xFFFFUL;
+            FAKE_TMRA_Step(CM_TMRA_1, (i32Speed > 0L) ? 1 : -1);
+            m_i64TruePos += (i32Speed > 0L) ? 1LL : -1LL;
+            m_dNextEdge += dPeriod;
+        }
+    }
+    m_dTime = dEnd;
+    CM_TMRA_2->CNTER = (uint32_t)floor(m_dTime) & 0xFFFFUL;
+}
+
+static void Sample(stc_tmra_enc_state_t *pstcState)
+{
+    TMRA_ENC_Sample(&m_stcEnc, 1U);
+    TEST_ASSERT_EQ(LL_OK, TMRA_ENC_GetState(&m_stcEnc, pstcState));
+    TEST_ASSERT_EQ(m_i64TruePos, pstcState->i64Pos);
+}
+
+static void TestInit(void)
+{
+    stc_tmra_enc_init_t stcInit;
+    stc_tmra_enc_t stcEnc;
+
+    FAKE_TMRA_Reset();
+    HOST_AOS.TMRA_TRGSEL1 = 0UL;
+    TEST_ASSERT_EQ(LL_OK, TMRA_ENC_StructInit(&stcInit));
+    TEST_ASSERT_EQ(EVT_SRC_MAX, stcInit.enEvtSrc);
+    stcInit.TMRAx        = CM_TMRA_1;
+    stcInit.pstcTimeBase = CM_TMRA_2;
+    /* No event source: nothing is routed */
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, TMRA_ENC_Init(&stcEnc, &stcInit));
+    TEST_ASSERT_EQ(0UL, HOST_AOS.TMRA_TRGSEL1);
+
+    stcInit.enEvtSrc = EVT_SRC_TMRA_1_CMP;
+    TEST_ASSERT_EQ(LL_OK, TMRA_ENC_Init(&stcEnc, &stcInit));
+    TEST_ASSERT_EQ((uint32_t)EVT_SRC_TMRA_1_CMP, HOST_AOS.TMRA_TRGSEL1);
+    TEST_ASSERT_EQ(TMRA_ENC_CNT_UP_X4, CM_TMRA_1->HCUPR);
+    TEST_ASSERT_EQ(TMRA_ENC_CNT_DOWN_X4, CM_TMRA_1->HCDOR);
+    TEST_ASSERT_EQ(TMRA_EVT_CMP_CH1, CM_TMRA_1->ECONR);
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, TMRA_ENC_StructInit(NULL));
+}
+
+/* Constant speeds in both directions, several wraps of the counter */
+static void TestSpeed(void)
+{
+    static const int32_t ai32Speed[] = {200L, 3000L, 50000L, 400000L, -400000L, -50000L, -3000L, -200L, 123457L};
+    stc_tmra_enc_state_t stcState;
+    double dErr;
+    double dMaxErr = 0.0;
+    double dSpan;
+    int64_t i64MaxPos = 0LL;
+    uint32_t i;
+    uint32_t j;
+
+    Setup();
+    for (i = 0UL; i < (sizeof(ai32Speed) / sizeof(ai32Speed[0])); i++) {
+        /* Shortest time between the edges of two samples */
+        dSpan = (4.0 * (double)TIME_BASE_FREQ) / fabs((double)ai32Speed[i]);
+        if (dSpan < (double)SAMPLE_TICKS) {
+            dSpan = (double)SAMPLE_TICKS - dSpan;
+        }
+        for (j = 0UL; j < SEGMENT_SAMPLES; j++) {
+            Run(ai32Speed[i], SAMPLE_TICKS);
+            Sample(&stcState);
+            i64MaxPos = (stcState.i64Pos > i64MaxPos) ? stcState.i64Pos : i64MaxPos;
+            if (j >= SETTLE_SAMPLES) {
+                /* One tick at each end of the edges spanned, plus the truncation to counts per second */
+                dErr = fabs((double)stcState.i32Speed - (double)ai32Speed[i]);
+                TEST_ASSERT(dErr <= (((2.0 * fabs((double)ai32Speed[i])) / dSpan) + 1.0));
+                dErr /= fabs((double)ai32Speed[i]);
+                dMaxErr = (dErr > dMaxErr) ? dErr : dMaxErr;
+            }
+        }
+    }
+    printf("tmra_enc speed: max error %.4f%%\n", dMaxErr * 100.0);
+    /* 400000 counts/s for 200 ms spans more than one wrap */
+    TEST_ASSERT(i64MaxPos > 0x10000LL);
+}
+
+/* Random speeds: the position stays exact through reversals and wraps */
+static void TestReverse(void)
+{
+    stc_tmra_enc_state_t stcState;
+    int32_t i32Speed;
+    uint32_t i;
+    uint32_t j;
+
+    Setup();
+    TEST_Seed(46UL);
+    for (i = 0UL; i < 100UL; i++) {
+        i32Speed = (int32_t)(TEST_Rand() % 600001UL) - 300000L;
+        for (j = 0UL; j < (1UL + (TEST_Rand() % 20UL)); j++) {
+            Run(i32Speed, SAMPLE_TICKS);
+            Sample(&stcState);
+        }
+    }
+}
+
+/* Without edges the speed is bounded by one edge over the elapsed time, then 0 */
+static void TestStop(void)
+{
+    stc_tmra_enc_state_t stcState;
+    int32_t i32Last;
+    uint32_t u32Elapsed = 0UL;
+    uint32_t i;
+
+    Setup();
+    for (i = 0UL; i < 100UL; i++) {
+        Run(-8000L, SAMPLE_TICKS);
+        Sample(&stcState);
+    }
+    TEST_ASSERT(abs(stcState.i32Speed + 8000) < 80);
+    i32Last = stcState.i32Speed;
+
+    for (i = 0UL; i < ((STOP_TICKS / SAMPLE_TICKS) + 5UL); i++) {
+        Run(0L, SAMPLE_TICKS);
+        Sample(&stcState);
+        u32Elapsed += SAMPLE_TICKS;
+        TEST_ASSERT(stcState.i32Speed <= 0L);
+        TEST_ASSERT(stcState.i32Speed >= i32Last);
+        TEST_ASSERT((int64_t)-stcState.i32Speed <= ((4LL * (int64_t)TIME_BASE_FREQ) / (int64_t)u32Elapsed));
+        i32Last = stcState.i32Speed;
+    }
+    TEST_ASSERT_EQ(0L, stcState.i32Speed);
+}
+
+/* A wrap whose interrupt is masked is counted once, before and after the handler */
+static void TestMasked(void)
+{
+    uint32_t i;
+
+    Setup();
+    CM_TMRA_1->CNTER = 0xFFFDUL;
+    m_i64TruePos = 0xFFFDLL;
+
+    g_u32HostPrimask = 1UL;
+    for (i = 0UL; i < 6UL; i++) {
+        FAKE_TMRA_Step(CM_TMRA_1, 1);
+        m_i64TruePos++;
+        TEST_ASSERT_EQ(m_i64TruePos, TMRA_ENC_GetPosition(&m_stcEnc));
+    }
+    g_u32HostPrimask = 0UL;
+    EncIrq();
+    TEST_ASSERT_EQ(m_i64TruePos, TMRA_ENC_GetPosition(&m_stcEnc));
+
+    g_u32HostPrimask = 1UL;
+    for (i = 0UL; i < 12UL; i++) {
+        FAKE_TMRA_Step(CM_TMRA_1, -1);
+        m_i64TruePos--;
+        TEST_ASSERT_EQ(m_i64TruePos, TMRA_ENC_GetPosition(&m_stcEnc));
+    }
+    g_u32HostPrimask = 0UL;
+    EncIrq();
+    TEST_ASSERT_EQ(m_i64TruePos, TMRA_ENC_GetPosition(&m_stcEnc));
+    TEST_ASSERT_EQ(0xFFF7LL, m_i64TruePos);
+}
+
+static void TestState(void)
+{
+    stc_tmra_enc_state_t stcState;
+
+    Setup();
+    Run(1000L, SAMPLE_TICKS);
+    Sample(&stcState);
+    TEST_ASSERT_EQ(SAMPLE_TICKS, stcState.u32Time);
+
+    /* A reader preempting the writer gives up */
+    m_stcEnc.u32Seq++;
+    TEST_ASSERT_EQ(LL_ERR_BUSY, TMRA_ENC_GetState(&m_stcEnc, &stcState));
+    m_stcEnc.u32Seq++;
+    TEST_ASSERT_EQ(LL_OK, TMRA_ENC_GetState(&m_stcEnc, &stcState));
+    TEST_ASSERT_EQ(LL_ERR_INVD_PARAM, TMRA_ENC_GetState(&m_stcEnc, NULL));
+}
+
+int main(void)
+{
+    TestInit();
+    TestSpeed();
+    TestReverse();
+    TestStop();
+    TestMasked();
+    TestState();
+    return TEST_Result("test_tmra_enc");
+}
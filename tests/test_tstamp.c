@@ -0,0 +1,235 @@
+/**
+ *******************************************************************************
+ * @file  test_tstamp.c
+ * @brief 64-bit timestamp: TSTAMP_GetTick() against a 64-bit model of the
+ *        cascaded TMRA units, with the overflow interrupt serviced at once or
+ *        left pending, a reader injected inside TSTAMP_IrqHandler() around the
+ *        clearing of the overflow flag, the tick and nanosecond conversions
+ *        against exact integer arithmetic, and a benchmark of the reads.
+ *******************************************************************************
+ */
+#define _GNU_SOURCE
+#include <time.h>
+#include "test.h"
+#include "fake_clk.h"
+#include "fake_tmra.h"
+#include "hc32_ll_tstamp.h"
+
+#define BENCH_OPS                       (1000000UL)
+
+#define TMRAX_L                         (CM_TMRA_3)
+#define TMRAX_H                         (CM_TMRA_4)
+
+static uint64_t m_u64Count;
+static uint64_t m_u64Last;
+static uint32_t m_u32Inject;
+
+static double NowNs(void)
+{
+    struct timespec stcTs;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &stcTs);
+    return ((double)stcTs.tv_sec * 1e9) + (double)stcTs.tv_nsec;
+}
+
+static void Setup(uint32_t u32Pclk1, uint8_t u8ClockDiv)
+{
+    uint32_t au32SrcFreq[CLK_SYSCLK_SRC_PLL + 1U] = {0UL};
+    stc_fake_clk_state_t stcState = {0};
+    stc_tstamp_init_t stcInit;
+
+    au32SrcFreq[CLK_SYSCLK_SRC_PLL] = u32Pclk1;
+    stcState.u8Src = CLK_SYSCLK_SRC_PLL;
+    FAKE_CLK_Reset(au32SrcFreq, &stcState);
+    FAKE_TMRA_Reset();
+
+    (void)TSTAMP_StructInit(&stcInit);
+    stcInit.u8ClockDiv  = u8ClockDiv;
+    stcInit.u32BusClock = CLK_BUS_PCLK1;
+    TEST_ASSERT_EQ(LL_OK, TSTAMP_Init(TMRAX_L, TMRAX_H, &stcInit));
+    TEST_ASSERT_EQ(0U, TMRAX_L->CNTER);
+    TEST_ASSERT_EQ(0U, TMRAX_H->CNTER);
+    TEST_ASSERT(0U != (TMRAX_L->BCSTRL & TMRA_BCSTRL_START));
+    TEST_ASSERT(0U != (TMRAX_H->BCSTRL & TMRA_BCSTRL_START));
+    TEST_ASSERT(0U != (TMRAX_H->ICONR & TMRA_INT_OVF));
+    TEST_ASSERT_EQ(TMRA_CNT_UP_COND_SYM_OVF, TMRAX_H->HCUPR);
+    m_u64Count = 0ULL;
+    m_u64Last  = 0ULL;
+}
+
+/* Count u32Delta clocks, the high unit flags its overflow, u8Irq services it at once */
+static void Advance(uint32_t u32Delta, uint8_t u8Irq)
+{
+    const uint32_t u32Old = (uint32_t)m_u64Count;
+    uint32_t u32New;
+
+    m_u64Count += u32Delta;
+    u32New = (uint32_t)m_u64Count;
+    TMRAX_L->CNTER = u32New & 0xFFFFUL;
+    TMRAX_H->CNTER = u32New >> 16U;
+    if (u32New < u32Old) {
+        TMRAX_H->STFLR |= (uint16_t)TMRA_FLAG_OVF;
+    }
+    if (0U != u8Irq) {
+        TSTAMP_IrqHandler();
+    }
+}
+
+static void Check(void)
+{
+    const uint64_t u64Tick = TSTAMP_GetTick();
+
+    TEST_ASSERT_EQ(m_u64Count, u64Tick);
+    TEST_ASSERT(u64Tick >= m_u64Last);
+    m_u64Last = u64Tick;
+}
+
+/* A reader of higher priority than the overflow interrupt */
+static void ClearHook(const CM_TMRA_TypeDef *TMRAx, uint8_t u8After)
+{
+    (void)u8After;
+    if (TMRAX_H == TMRAx) {
+        TEST_ASSERT_EQ(m_u64Count, TSTAMP_GetTick());
+        m_u32Inject++;
+    }
+}
+
+static void TestTick(void)
+{
+    uint32_t u32Delta;
+    uint32_t u32Wrap = 0UL;
+    uint32_t n;
+
+    Setup(120000000UL, TMRA_CLK_DIV1);
+    Check();
+    TEST_Seed(27UL);
+    for (n = 0UL; n < 200000UL; n++) {
+        switch (TEST_Rand() % 4UL) {
+            case 0UL:
+                u32Delta = 1UL + (TEST_Rand() % 0x100UL);
+                break;
+            case 1UL:
+                u32Delta = 0x10000UL - (TEST_Rand() % 0x100UL);
+                break;
+            default:
+                u32Delta = TEST_Rand() % 0x40000000UL;
+                break;
+        }
+        if ((uint32_t)(m_u64Count + u32Delta) < (uint32_t)m_u64Count) {
+            u32Wrap++;
+            /* The interrupt is late: read with the flag pending first */
+            if (0UL != (TEST_Rand() % 2UL)) {
+                Advance(u32Delta, 0U);
+                Check();
+                Advance(TEST_Rand() % 0x1000UL, 0U);
+                Check();
+                TSTAMP_IrqHandler();
+                Check();
+                continue;
+            }
+        }
+        Advance(u32Delta, 1U);
+        Check();
+    }
+    TEST_ASSERT(u32Wrap > 1000UL);
+    TEST_ASSERT(m_u64Count > (1ULL << 40U));
+
+    /* Stopped and restarted from 0 */
+    TSTAMP_DeInit();
+    TEST_ASSERT_EQ(0U, TMRAX_L->BCSTRL & TMRA_BCSTRL_START);
+    TEST_ASSERT_EQ(0U, TMRAX_H->ICONR & TMRA_INT_OVF);
+    TSTAMP_IrqHandler();
+    Setup(120000000UL, TMRA_CLK_DIV1);
+    Check();
+}
+
+static void TestInject(void)
+{
+    uint32_t u32Before;
+    uint32_t n;
+
+    Setup(240000000UL, TMRA_CLK_DIV1);
+    FAKE_TMRA_SetClearHook(&ClearHook);
+    m_u32Inject = 0UL;
+    TEST_Seed(2700UL);
+    for (n = 0UL; n < 1000UL; n++) {
+        /* Just before the wrap, then across it by a few counts */
+        u32Before = 1UL + (TEST_Rand() % 0x100UL);
+        Advance((uint32_t)(0UL - (uint32_t)m_u64Count) - u32Before, 1U);
+        Check();
+        Advance(u32Before + (TEST_Rand() % 0x200UL), 1U);
+        Check();
+    }
+    TEST_ASSERT_EQ(2000UL, m_u32Inject);
+    FAKE_TMRA_SetClearHook(NULL);
+}
+
+static void TestConvert(void)
+{
+    static const uint8_t au8Div[] = {TMRA_CLK_DIV1, TMRA_CLK_DIV2, TMRA_CLK_DIV16, TMRA_CLK_DIV1024};
+    unsigned __int128 u128Exact;
+    uint32_t u32Pclk1;
+    uint32_t u32Freq;
+    uint64_t u64Tick;
+    uint64_t u64Ns;
+    uint64_t u64Got;
+    uint32_t i;
+    uint32_t n;
+
+    TEST_Seed(270UL);
+    for (i = 0UL; i < 400UL; i++) {
+        u32Pclk1 = 1000000UL + (TEST_Rand() % 239000001UL);
+        Setup(u32Pclk1, au8Div[i % 4UL]);
+        u32Freq = u32Pclk1 >> (au8Div[i % 4UL] >> TMRA_BCSTRL_CKDIV_POS);
+        TEST_ASSERT_EQ(u32Freq, TSTAMP_GetTickFreq());
+
+        for (n = 0UL; n < 200UL; n++) {
+            u64Tick = ((uint64_t)TEST_Rand() << 20U) | (TEST_Rand() & 0xFFFFFUL);
+            u64Tick >>= TEST_Rand() % 52UL;
+
+            /* Truncated, at most one ns plus the error of the Q32.32 factor */
+            u128Exact = ((unsigned __int128)u64Tick * 1000000000ULL) / u32Freq;
+            u64Got = TSTAMP_TickToNs(u64Tick);
+            TEST_ASSERT(u64Got <= (uint64_t)u128Exact);
+            TEST_ASSERT(((uint64_t)u128Exact - u64Got) <= (2ULL + (u64Tick >> 32U)));
+
+            u64Ns = u64Tick;
+            u128Exact = ((unsigned __int128)u64Ns * u32Freq) / 1000000000ULL;
+            u64Got = TSTAMP_NsToTick(u64Ns);
+            TEST_ASSERT(u64Got <= (uint64_t)u128Exact);
+            TEST_ASSERT(((uint64_t)u128Exact - u64Got) <= (2ULL + (u64Ns >> 32U)));
+        }
+
+        Advance(TEST_Rand(), 1U);
+        TEST_ASSERT_EQ(TSTAMP_TickToNs(m_u64Count), TSTAMP_GetNs());
+    }
+}
+
+static void Bench(void)
+{
+    volatile uint64_t u64Sink = 0ULL;
+    double dStart;
+    uint32_t n;
+
+    Setup(120000000UL, TMRA_CLK_DIV1);
+    Advance(0x12345678UL, 1U);
+    dStart = NowNs();
+    for (n = 0UL; n < BENCH_OPS; n++) {
+        u64Sink += TSTAMP_GetTick();
+    }
+    printf("TSTAMP_GetTick: %.1f ns/op\n", (NowNs() - dStart) / (double)BENCH_OPS);
+    dStart = NowNs();
+    for (n = 0UL; n < BENCH_OPS; n++) {
+        u64Sink += TSTAMP_GetNs();
+    }
+    printf("TSTAMP_GetNs: %.1f ns/op\n", (NowNs() - dStart) / (double)BENCH_OPS);
+}
+
+int main(void)
+{
+    TestTick();
+    TestInject();
+    TestConvert();
+    Bench();
+    return TEST_Result("tstamp");
+}